@@ -1764,7 +1764,7 @@ bool MainWindow::loadSceneFile(const QString& filePath, bool untitled)
     // The pre-CST "Merge" option is GONE (2026-07-12): every GUI load
     // routes through the canonical CST path, whose load-once guard
     // refuses a second load into a populated Job
-    // (Job::LoadAsciiSceneViaCst: "this Job already loaded a scene;
+    // (Job::LoadParsedCstDocument_: "this Job already loaded a scene;
     // re-load is not supported") -- the old Merge button could only ever
     // end in the Error state.  It was also doubly broken at the bridge
     // level even when the loader still allowed it: the merge-load
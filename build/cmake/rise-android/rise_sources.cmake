@@ -31,6 +31,7 @@ set(RISE_LIB_SOURCES
     "${RISE_LIB}/Utilities/Log/StreamPrinter.cpp"
     "${RISE_LIB}/Utilities/Threads/ThreadsPTHREADs.cpp"
     "${RISE_LIB}/Utilities/ThreadPool.cpp"
+    "${RISE_LIB}/Utilities/CancellationToken.cpp"
     "${RISE_LIB}/Utilities/CPUTopology.cpp"
     "${RISE_LIB}/Utilities/CPU_Count.cpp"
     "${RISE_LIB}/Utilities/DiskBuffer.cpp"
@@ -45,6 +46,7 @@ set(RISE_LIB_SOURCES
     "${RISE_LIB}/Utilities/RandomWalkSSS.cpp"
     "${RISE_LIB}/Utilities/MersenneTwister.cpp"
     "${RISE_LIB}/Utilities/ManifoldSolver.cpp"
+    "${RISE_LIB}/Utilities/SMSChainCache.cpp"
     "${RISE_LIB}/Utilities/SMSPhotonMap.cpp"
     "${RISE_LIB}/Utilities/CompletePathGuide.cpp"
     "${RISE_LIB}/Utilities/PathGuidingField.cpp"
@@ -67,6 +69,7 @@ set(RISE_LIB_SOURCES
     "${RISE_LIB}/Functions/Resultant.cpp"
 
     # SRCLIBNOISE
+    "${RISE_LIB}/Noise/NoiseBatch.cpp"
     "${RISE_LIB}/Noise/InterpolatedNoise.cpp"
     "${RISE_LIB}/Noise/PerlinNoise1D.cpp"
     "${RISE_LIB}/Noise/PerlinNoise2D.cpp"
@@ -96,6 +99,7 @@ set(RISE_LIB_SOURCES
     "${RISE_LIB}/Painters/PolynomialFunction2DPainter.cpp"
     "${RISE_LIB}/Painters/GerstnerWavePainter.cpp"
     "${RISE_LIB}/Painters/Perlin3DPainter.cpp"
+    "${RISE_LIB}/Painters/PainterProgram.cpp"
     "${RISE_LIB}/Painters/Turbulence3DPainter.cpp"
     "${RISE_LIB}/Painters/Worley3DPainter.cpp"
     "${RISE_LIB}/Painters/PerlinWorley3DPainter.cpp"
@@ -166,6 +170,8 @@ set(RISE_LIB_SOURCES
     "${RISE_LIB}/Geometry/ClippedPlaneGeometry.cpp"
     "${RISE_LIB}/Geometry/CylinderGeometry.cpp"
     "${RISE_LIB}/Geometry/CylindricalUVGenerator.cpp"
+    "${RISE_LIB}/Geometry/LazyDisplacedMesh.cpp"
+    "${RISE_LIB}/Geometry/InstanceArrayGeometry.cpp"
     "${RISE_LIB}/Geometry/DisplacedGeometry.cpp"
     "${RISE_LIB}/Geometry/EllipsoidGeometry.cpp"
     "${RISE_LIB}/Geometry/Geometry.cpp"
@@ -176,6 +182,7 @@ set(RISE_LIB_SOURCES
     "${RISE_LIB}/Geometry/SphericalUVGenerator.cpp"
     "${RISE_LIB}/Geometry/TorusGeometry.cpp"
     "${RISE_LIB}/Geometry/TriangleMeshGeometry.cpp"
+    "${RISE_LIB}/Geometry/TriangleMeshCache.cpp"
     "${RISE_LIB}/Geometry/TriangleMeshGeometryIndexed.cpp"
     "${RISE_LIB}/Geometry/TriangleMeshLoader3DS.cpp"
     "${RISE_LIB}/Geometry/TriangleMeshLoaderPLY.cpp"
@@ -288,6 +295,8 @@ set(RISE_LIB_SOURCES
     "${RISE_LIB}/Rendering/FrameStore.cpp"
     "${RISE_LIB}/Rendering/FrameEncoders.cpp"
     "${RISE_LIB}/Rendering/FrameSink.cpp"
+    "${RISE_LIB}/Rendering/PixelReuseCache.cpp"
+    "${RISE_LIB}/Rendering/FrameEncodeQueue.cpp"
     "${RISE_LIB}/Rendering/FileEncoderObserver.cpp"
     "${RISE_LIB}/Rendering/ViewportFrameStore.cpp"
 
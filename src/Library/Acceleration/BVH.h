@@ -39,6 +39,7 @@
 #include <cmath>
 #include <cstdint>
 #include <cfloat>
+#include <cstring>
 
 // Phase 3 SIMD selection.  Apple Silicon and arm64 Android (Galaxy Fold)
 // route to NEON 128-bit; x86_64 with AVX2 routes to SSE2/SSE4.1 intrinsics
@@ -108,6 +109,26 @@ namespace RISE
 			float e2[3];   // edge2 = v2 - v0
 		};
 
+		// Analytic leaf filter packet: up to four analytic primitives of
+		// one leaf (any mix of spheres, boxes, cylinders, ...), SoA so a
+		// single SIMD load fetches one field for all four lanes.  Each
+		// lane holds the primitive's world-to-local affine rows, its
+		// local bounds and its axis-aligned bounding quadric (see
+		// AnalyticShape).  Lanes whose primitive supplies no shape are
+		// flagged in alwaysMask and reported as candidates at t = 0.
+		struct alignas(16) AnalyticPacket
+		{
+			float    m[3][4][4];    // [local axis][x,y,z,translation][lane]
+			float    ll[3][4];      // local bounds
+			float    ur[3][4];
+			float    slack[3][4];   // eps * max(|ll|,|ur|) per axis
+			float    q[3][4];       // quadric weights (0 = no quadric)
+			float    radius[4];     // sqrt of the quadric threshold
+			float    qs[4];         // sqrt of the largest weight
+			uint32_t count;         // lanes in use, 1..4
+			uint32_t alwaysMask;    // lanes without a shape
+		};
+
 		// Phase 3 wide-BVH node layout (BVH4 SoA).  Up to 4 children per
 		// internal node, child AABBs stored in struct-of-arrays so a single
 		// SIMD load fetches all 4 mins (or maxes) on each axis for a
@@ -141,6 +162,9 @@ namespace RISE
 		std::vector<Element>                 prims;
 		std::vector<TriangleFilterData>      fastFilter;  // Phase 2; empty = filter off
 		bool                                 hasFastFilter;
+		std::vector<AnalyticPacket>          analyticPackets;   // empty = analytic filter off
+		std::vector<uint32_t>                analyticLeafPacket;// per prim: first packet of the leaf starting there, or kNoPacket
+		bool                                 hasAnalyticFilter;
 		std::vector<BVH4Node>                nodes4;      // Phase 3; empty = BVH4 off
 		bool                                 useBVH4;
 		BoundingBox                          overallBox;
@@ -156,6 +180,31 @@ namespace RISE
 		// rebuild fallback in TriangleMeshGeometryIndexed::UpdateVertices.
 		Scalar                               originalSAH = 0;
 
+		// One traversal's pending nodes, kept above whatever is already
+		// on the thread's shared vector.  A leaf can start a nested
+		// traversal of another BVH with the same Element type (an
+		// instance array of triangle meshes, both over unsigned int), so
+		// a traversal must never clear the vector; it drops only its own
+		// entries, when it ends or returns early.
+		class TraversalStack
+		{
+			std::vector<uint32_t>&	v;
+			const size_t			base;
+
+		public:
+			explicit TraversalStack( std::vector<uint32_t>& v_ ) : v( v_ ), base( v_.size() ) {}
+			~TraversalStack() { v.resize( base ); }
+
+			bool empty() const { return v.size() == base; }
+			void push_back( const uint32_t i ) { v.push_back( i ); }
+			uint32_t back() const { return v.back(); }
+			void pop_back() { v.pop_back(); }
+
+		private:
+			TraversalStack( const TraversalStack& );
+			TraversalStack& operator=( const TraversalStack& );
+		};
+
 		virtual ~BVH() {}
 
 	public:
@@ -164,6 +213,7 @@ namespace RISE
 		     const BoundingBox&                   overallBoxHint,
 		     const AccelerationConfig&            cfg_ )
 			: hasFastFilter( false ),
+			  hasAnalyticFilter( false ),
 			  useBVH4( false ),
 			  overallBox( overallBoxHint ),
 			  ep( ep_ ),
@@ -182,6 +232,7 @@ namespace RISE
 			Build( inputPrims );
 
 			BuildFastFilter();
+			BuildAnalyticFilter();
 			BuildBVH4();
 
 			// Tier C3: snapshot the SAH cost of the freshly-built tree.
@@ -195,6 +246,8 @@ namespace RISE
 		size_t numNodes4()  const { return nodes4.size(); }
 		size_t numPrims()   const { return prims.size(); }
 		bool   FastFilterEnabled() const { return hasFastFilter; }
+		bool   AnalyticFilterEnabled() const { return hasAnalyticFilter; }
+		size_t numAnalyticPackets() const { return analyticPackets.size(); }
 		bool   BVH4Enabled() const { return useBVH4; }
 		const BoundingBox& GetBBox() const { return overallBox; }
 
@@ -244,8 +297,9 @@ namespace RISE
 		{
 			Timer t; t.start();
 			if( nodes.empty() ) {
-				BuildFastFilter();  // no-op on empty
-				BuildBVH4();        // no-op on empty
+				BuildFastFilter();      // no-op on empty
+				BuildAnalyticFilter();  // no-op on empty
+				BuildBVH4();            // no-op on empty
 				t.stop();
 				return (unsigned int)t.getInterval();
 			}
@@ -298,6 +352,7 @@ namespace RISE
 			// dominated by per-prim float-vertex extraction (filter)
 			// and a single tree walk (collapse).
 			BuildFastFilter();
+			BuildAnalyticFilter();
 			BuildBVH4();
 
 			t.stop();
@@ -326,59 +381,62 @@ namespace RISE
 		}
 
 		//////////////////////////////////////////////////////////////////
-		//  Serialization (Tier 1 §2 — `.risemesh` v3 BVH cache).
+		//  Serialization (Tier 1 §2 — `.risemesh` v3 BVH cache; C2 —
+		//  persisted precompute).
 		//
-		//  Writes the BVH2 representation only (nodes + DFS prim-index
-		//  ordering).  BVH4 collapse and float-filter precompute are
-		//  derived at load time from the BVH2 + the input prims, so the
-		//  on-disk format stays compatible across Phase 3+ traversal
-		//  changes.  See docs/BVH_ACCELERATION_PLAN.md §4.5 (deferred
-		//  but partially-realised here for the Tier 1 scope).
+		//  Serialize writes the BVH2 representation only (nodes + DFS
+		//  prim-index ordering); the BVH4 collapse and float-filter
+		//  precompute are derived at load time from the BVH2 + the input
+		//  prims.  SerializeWithPrecompute additionally writes those
+		//  derived arrays so a load is bulk reads with no re-derivation
+		//  (see docs/BVH_RETROSPECTIVE.md → C2).
 		//
 		//  Format:
 		//    "BVH2"           4 bytes magic
-		//    uint32 version   = 1
+		//    uint32 version   = 1 (Serialize) or 2 (SerializeWithPrecompute)
 		//    uint32 numNodes
 		//    Node[numNodes]   raw bytes (POD, 32 bytes each)
 		//    uint32 numPrims
-		//    uint32[numPrims] DFS-ordered indices into the caller's
-		//                     original primitive list
+		//    v1: uint32 per prim, DFS-ordered indices into the caller's
+		//        original primitive list
+		//    v2: the same indices as one raw uint32[numPrims] block
 		//    Scalar overallBox.ll[3], overallBox.ur[3]
+		//  v2 only:
+		//    Scalar originalSAH
+		//    uint32 sizeof(BVH4Node), uint32 numNodes4, BVH4Node[] raw
+		//    uint32 sizeof(TriangleFilterData), uint32 numFilter,
+		//           TriangleFilterData[] raw (0 = filter off)
+		//
+		//  The raw blocks are native-endian, as the Node block always
+		//  was.  The element sizes let a reader whose BVH4Node or
+		//  TriangleFilterData layout has changed skip the stale block
+		//  and re-derive it instead.
 		//
 		//  primIdxFn maps each `prims[i]` back to its index in the
 		//  caller's authoritative ordering (since BVH<Element>::prims
 		//  is reordered by the SAH partition).  For
-		//  TriangleMeshGeometryIndexed, `prims[i] - &ptr_polygons[0]`.
+		//  TriangleMeshGeometryIndexed, each prim is its own index.
 		//////////////////////////////////////////////////////////////////
 		template< class IndexOf >
 		void Serialize( IWriteBuffer& buffer, const IndexOf& primIdxFn ) const
 		{
-			buffer.setBytes( "BVH2", 4 );
-			buffer.setUInt( 1u );  // version
-			buffer.setUInt( (unsigned int)nodes.size() );
-			if( !nodes.empty() ) {
-				buffer.setBytes( nodes.data(),
-					(unsigned int)( nodes.size() * sizeof( Node ) ) );
-			}
-			buffer.setUInt( (unsigned int)prims.size() );
-			for( const Element& p : prims ) {
-				buffer.setUInt( (unsigned int)primIdxFn( p ) );
-			}
-			buffer.setDouble( overallBox.ll.x );
-			buffer.setDouble( overallBox.ll.y );
-			buffer.setDouble( overallBox.ll.z );
-			buffer.setDouble( overallBox.ur.x );
-			buffer.setDouble( overallBox.ur.y );
-			buffer.setDouble( overallBox.ur.z );
+			WriteCache( buffer, primIdxFn, false );
 		}
 
-		// Deserialize: returns true on success, false if magic mismatches
-		// or version is unsupported.  `primAt(i)` should return the
-		// caller's primitive at index i.  After a successful load,
-		// the BVH4 collapse + filter precompute are re-run via the
-		// post-build hooks (BuildBVH4 + BuildFastFilter), so a v3
-		// `.risemesh` benefits from any improvement in those layers
-		// without re-baking.
+		template< class IndexOf >
+		void SerializeWithPrecompute( IWriteBuffer& buffer, const IndexOf& primIdxFn ) const
+		{
+			WriteCache( buffer, primIdxFn, true );
+		}
+
+		// Deserialize: returns true on success, false if magic mismatches,
+		// version is unsupported or the prim indices are out of range.
+		// `primAt(i)` should return the caller's primitive at index i.
+		// A v1 cache re-runs the post-build hooks (BuildFastFilter +
+		// BuildBVH4), so it benefits from any improvement in those
+		// layers without re-baking.  A v2 cache takes the stored arrays
+		// as they are, falling back to the hooks only for a block whose
+		// layout or contents don't fit this build.
 		template< class PrimAtFn >
 		bool Deserialize( IReadBuffer& buffer, uint32_t numInputPrims, const PrimAtFn& primAt )
 		{
@@ -387,7 +445,7 @@ namespace RISE
 			if( magic[0]!='B' || magic[1]!='V' || magic[2]!='H' || magic[3]!='2' ) return false;
 
 			const unsigned int ver = buffer.getUInt();
-			if( ver != 1u ) return false;
+			if( ver != 1u && ver != 2u ) return false;
 
 			const unsigned int nNodes = buffer.getUInt();
 			nodes.resize( nNodes );
@@ -400,13 +458,28 @@ namespace RISE
 
 			const unsigned int nPrims = buffer.getUInt();
 			prims.resize( nPrims );
-			for( unsigned int i = 0; i < nPrims; ++i ) {
-				const unsigned int idx = buffer.getUInt();
-				if( idx >= numInputPrims ) {
+			if( ver == 1u ) {
+				for( unsigned int i = 0; i < nPrims; ++i ) {
+					const unsigned int idx = buffer.getUInt();
+					if( idx >= numInputPrims ) {
+						nodes.clear(); prims.clear();
+						return false;
+					}
+					prims[i] = primAt( idx );
+				}
+			} else {
+				std::vector<uint32_t> idx( nPrims );
+				if( nPrims > 0 && !buffer.getBytes( idx.data(), (unsigned int)( nPrims * sizeof( uint32_t ) ) ) ) {
 					nodes.clear(); prims.clear();
 					return false;
 				}
-				prims[i] = primAt( idx );
+				for( unsigned int i = 0; i < nPrims; ++i ) {
+					if( idx[i] >= numInputPrims ) {
+						nodes.clear(); prims.clear();
+						return false;
+					}
+					prims[i] = primAt( idx[i] );
+				}
 			}
 
 			overallBox.ll.x = buffer.getDouble();
@@ -416,12 +489,203 @@ namespace RISE
 			overallBox.ur.y = buffer.getDouble();
 			overallBox.ur.z = buffer.getDouble();
 
-			// Run post-build hooks (filter precompute + BVH4 collapse).
-			BuildFastFilter();
-			BuildBVH4();
+			if( ver == 1u ) {
+				// Run post-build hooks (filter precompute + BVH4 collapse).
+				BuildFastFilter();
+				BuildAnalyticFilter();
+				BuildBVH4();
+				return true;
+			}
+
+			originalSAH = buffer.getDouble();
+
+			bool haveNodes4 = false, haveFilter = false;
+			if( !ReadPrecomputeBlock( buffer, nodes4, haveNodes4 ) ||
+				!ReadPrecomputeBlock( buffer, fastFilter, haveFilter ) ) {
+				nodes.clear(); prims.clear(); nodes4.clear(); fastFilter.clear();
+				return false;
+			}
+
+			if( haveFilter && !FastFilterMatches() ) {
+				GlobalLog()->PrintEasyWarning( "BVH:: Stored float filter does not match the primitives; re-deriving" );
+				haveFilter = false;
+			}
+			if( haveFilter ) {
+				hasFastFilter = !fastFilter.empty();
+			} else {
+				BuildFastFilter();
+			}
+
+			if( haveNodes4 && !BVH4Consistent() ) {
+				GlobalLog()->PrintEasyWarning( "BVH:: Stored BVH4 nodes are inconsistent with the BVH2; re-deriving" );
+				haveNodes4 = false;
+			}
+			if( haveNodes4 ) {
+				useBVH4 = !nodes4.empty();
+			} else {
+				BuildBVH4();
+			}
+
+			// Per leaf and never used by a triangle BVH, so not stored
+			BuildAnalyticFilter();
+
+			GlobalLog()->PrintEx( eLog_Info,
+				"BVH:: Loaded stored precompute (%u BVH4 nodes%s, %u filter triangles%s)",
+				(unsigned)nodes4.size(), haveNodes4 ? "" : " re-derived",
+				(unsigned)fastFilter.size(), haveFilter ? "" : " re-derived" );
+			return true;
+		}
+
+	protected:
+		template< class IndexOf >
+		void WriteCache( IWriteBuffer& buffer, const IndexOf& primIdxFn, const bool bPrecompute ) const
+		{
+			buffer.setBytes( "BVH2", 4 );
+			buffer.setUInt( bPrecompute ? 2u : 1u );  // version
+			buffer.setUInt( (unsigned int)nodes.size() );
+			if( !nodes.empty() ) {
+				buffer.setBytes( nodes.data(),
+					(unsigned int)( nodes.size() * sizeof( Node ) ) );
+			}
+			buffer.setUInt( (unsigned int)prims.size() );
+
+			// One resize for the indices and the box; the per-prim
+			// setUInt would otherwise grow the buffer one index at a time
+			buffer.ResizeForMore( (unsigned int)( prims.size() * sizeof( uint32_t ) + 6 * sizeof( double ) ) );
+			if( bPrecompute ) {
+				std::vector<uint32_t> idx( prims.size() );
+				for( size_t i = 0; i < prims.size(); ++i ) {
+					idx[i] = (uint32_t)primIdxFn( prims[i] );
+				}
+				if( !idx.empty() ) {
+					buffer.setBytes( idx.data(), (unsigned int)( idx.size() * sizeof( uint32_t ) ) );
+				}
+			} else {
+				for( const Element& p : prims ) {
+					buffer.setUInt( (unsigned int)primIdxFn( p ) );
+				}
+			}
+			buffer.setDouble( overallBox.ll.x );
+			buffer.setDouble( overallBox.ll.y );
+			buffer.setDouble( overallBox.ll.z );
+			buffer.setDouble( overallBox.ur.x );
+			buffer.setDouble( overallBox.ur.y );
+			buffer.setDouble( overallBox.ur.z );
+
+			if( bPrecompute ) {
+				buffer.setDouble( originalSAH );
+				WritePrecomputeBlock( buffer, nodes4 );
+				WritePrecomputeBlock( buffer, fastFilter );
+			}
+		}
+
+		template< class T >
+		static void WritePrecomputeBlock( IWriteBuffer& buffer, const std::vector<T>& v )
+		{
+			buffer.setUInt( (unsigned int)sizeof( T ) );
+			buffer.setUInt( (unsigned int)v.size() );
+			if( !v.empty() ) {
+				buffer.setBytes( v.data(), (unsigned int)( v.size() * sizeof( T ) ) );
+			}
+		}
+
+		// Reads one block written by WritePrecomputeBlock.  Returns false
+		// only when the stream is truncated; `bUsable` is false when the
+		// block was written for a different element layout, in which
+		// case its bytes are skipped and `v` is left empty.
+		template< class T >
+		static bool ReadPrecomputeBlock( IReadBuffer& buffer, std::vector<T>& v, bool& bUsable )
+		{
+			const unsigned int elemSize = buffer.getUInt();
+			const unsigned int count = buffer.getUInt();
+			v.clear();
+			bUsable = false;
+			if( count == 0 ) {
+				bUsable = ( elemSize == sizeof( T ) );
+				return true;
+			}
+			// A count no stream could hold is a damaged header; refuse it
+			// before sizing anything from it
+			if( (uint64_t)elemSize * count > buffer.Size() ) {
+				return false;
+			}
+			if( elemSize != sizeof( T ) ) {
+				std::vector<char> skip( (size_t)elemSize * count );
+				return buffer.getBytes( skip.data(), (unsigned int)skip.size() );
+			}
+			v.resize( count );
+			if( !buffer.getBytes( v.data(), (unsigned int)( count * sizeof( T ) ) ) ) {
+				v.clear();
+				return false;
+			}
+			bUsable = true;
+			return true;
+		}
+
+		// A stored filter belongs to these prims if it has one entry per
+		// prim and reproduces the processor's vertices at a few samples;
+		// the full comparison would cost what re-deriving it does.
+		bool FastFilterMatches() const
+		{
+			if( fastFilter.empty() ) {
+				return true;
+			}
+			if( fastFilter.size() != prims.size() ) {
+				return false;
+			}
+			const size_t n = prims.size();
+			const size_t samples[] = { 0, n / 3, n / 2, ( 2 * n ) / 3, n - 1 };
+			for( const size_t i : samples ) {
+				float v0[3], v1[3], v2[3];
+				if( !ep.GetFloatTriangleVertices( prims[i], v0, v1, v2 ) ) {
+					return false;
+				}
+				const TriangleFilterData& fd = fastFilter[i];
+				for( int k = 0; k < 3; ++k ) {
+					if( fd.p0[k] != v0[k] ||
+						fd.e1[k] != v1[k] - v0[k] ||
+						fd.e2[k] != v2[k] - v0[k] ) {
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+
+		// Every stored BVH4 child must stay inside nodes4 / prims, so a
+		// damaged block cannot send traversal out of bounds.
+		bool BVH4Consistent() const
+		{
+			if( nodes4.empty() ) {
+				return nodes.empty();
+			}
+			if( nodes.empty() ) {
+				return false;
+			}
+			for( size_t ni = 0; ni < nodes4.size(); ++ni ) {
+				const BVH4Node& n = nodes4[ni];
+				if( n.numChildren < 1 || n.numChildren > 4 ) {
+					return false;
+				}
+				for( int i = 0; i < n.numChildren; ++i ) {
+					if( n.children[i] < 0 ) {
+						return false;
+					}
+					const uint32_t c = (uint32_t)n.children[i];
+					if( n.primCount[i] > 0 ) {
+						if( (uint64_t)c + n.primCount[i] > prims.size() ) {
+							return false;
+						}
+					} else if( c <= ni || c >= nodes4.size() ) {
+						return false;
+					}
+				}
+			}
 			return true;
 		}
 
+	public:
+
 		//////////////////////////////////////////////////////////////////
 		//  BuildFastFilter: precompute float Möller-Trumbore edges for
 		//  every leaf primitive that the element processor can supply
@@ -466,6 +730,128 @@ namespace RISE
 				(unsigned)( fastFilter.size() * sizeof( TriangleFilterData ) ) );
 		}
 
+		//////////////////////////////////////////////////////////////////
+		//  BuildAnalyticFilter: pack the analytic primitives of every
+		//  leaf holding at least two of them into AnalyticPackets, four
+		//  lanes each.  Unlike the triangle filter this is per leaf, so
+		//  a TLAS mixing meshes and spheres still filters the sphere
+		//  leaves.  Triangle BVHs (fast filter on) never have shapes.
+		//////////////////////////////////////////////////////////////////
+		static constexpr uint32_t kNoPacket = 0xFFFFFFFFu;
+		static constexpr uint32_t kMaxAnalyticLeaf = 16;
+		static constexpr float kAnalyticEps = 1e-5f;
+
+		void BuildAnalyticFilter()
+		{
+			analyticPackets.clear();
+			analyticLeafPacket.clear();
+			hasAnalyticFilter = false;
+
+			if( hasFastFilter || nodes.empty() ) {
+				return;
+			}
+
+			AnalyticShape shapes[kMaxAnalyticLeaf];
+			Matrix4       mx[kMaxAnalyticLeaf];
+			bool          has[kMaxAnalyticLeaf];
+			unsigned int  numLeaves = 0, numShapes = 0;
+
+			for( size_t ni = 0; ni < nodes.size(); ++ni ) {
+				const Node& n = nodes[ni];
+				if( n.primCount < 2 || n.primCount > kMaxAnalyticLeaf ) {
+					continue;
+				}
+
+				unsigned int numHas = 0;
+				for( uint32_t i = 0; i < n.primCount; ++i ) {
+					has[i] = ep.GetAnalyticElementShape( prims[n.firstPrimOrLeft + i], shapes[i], mx[i] ) &&
+					         AnalyticShapeUsable( shapes[i], mx[i] );
+					if( has[i] ) numHas++;
+				}
+				if( numHas < 2 ) {
+					continue;
+				}
+
+				if( analyticLeafPacket.empty() ) {
+					analyticLeafPacket.assign( prims.size(), kNoPacket );
+				}
+				analyticLeafPacket[n.firstPrimOrLeft] = (uint32_t)analyticPackets.size();
+
+				for( uint32_t first = 0; first < n.primCount; first += 4 ) {
+					AnalyticPacket pk;
+					memset( &pk, 0, sizeof( pk ) );
+					pk.count = std::min<uint32_t>( 4, n.primCount - first );
+					for( uint32_t lane = 0; lane < pk.count; ++lane ) {
+						const uint32_t i = first + lane;
+						if( !has[i] ) {
+							pk.alwaysMask |= ( 1u << lane );
+							continue;
+						}
+						FillAnalyticLane( pk, lane, shapes[i], mx[i] );
+					}
+					analyticPackets.push_back( pk );
+				}
+				numLeaves++;
+				numShapes += numHas;
+			}
+
+			hasAnalyticFilter = !analyticPackets.empty();
+			if( !hasAnalyticFilter ) {
+				analyticLeafPacket.clear();
+				return;
+			}
+
+			GlobalLog()->PrintEx( eLog_Info,
+				"BVH:: Analytic leaf filter enabled (%u leaves, %u shapes, %u packets)",
+				numLeaves, numShapes, (unsigned)analyticPackets.size() );
+		}
+
+		// Shapes whose numbers do not survive the trip to float are left
+		// to the full intersection
+		static bool AnalyticShapeUsable( const AnalyticShape& s, const Matrix4& m )
+		{
+			const Scalar big = 1e30;
+			const Scalar v[] = {
+				s.bounds.ll.x, s.bounds.ll.y, s.bounds.ll.z,
+				s.bounds.ur.x, s.bounds.ur.y, s.bounds.ur.z,
+				s.q.x, s.q.y, s.q.z, s.radius2,
+				m._00, m._01, m._02, m._10, m._11, m._12,
+				m._20, m._21, m._22, m._30, m._31, m._32 };
+			for( size_t i = 0; i < sizeof( v ) / sizeof( v[0] ); ++i ) {
+				if( !( std::fabs( v[i] ) < big ) ) {
+					return false;
+				}
+			}
+			return s.bounds.ll.x <= s.bounds.ur.x &&
+			       s.bounds.ll.y <= s.bounds.ur.y &&
+			       s.bounds.ll.z <= s.bounds.ur.z &&
+			       ( !s.bQuadric || ( s.q.x >= 0 && s.q.y >= 0 && s.q.z >= 0 && s.radius2 >= 0 ) );
+		}
+
+		static void FillAnalyticLane( AnalyticPacket& pk, uint32_t lane, const AnalyticShape& s, const Matrix4& m )
+		{
+			// Local = world * m (Point3Ops::Transform convention): local
+			// axis k takes column k of the upper 3x3 plus row 3
+			const Scalar cols[3][4] = {
+				{ m._00, m._10, m._20, m._30 },
+				{ m._01, m._11, m._21, m._31 },
+				{ m._02, m._12, m._22, m._32 } };
+			const Scalar ll[3] = { s.bounds.ll.x, s.bounds.ll.y, s.bounds.ll.z };
+			const Scalar ur[3] = { s.bounds.ur.x, s.bounds.ur.y, s.bounds.ur.z };
+			const Scalar q[3]  = { s.q.x, s.q.y, s.q.z };
+			for( int k = 0; k < 3; ++k ) {
+				for( int j = 0; j < 4; ++j ) {
+					pk.m[k][j][lane] = (float)cols[k][j];
+				}
+				pk.ll[k][lane]    = (float)ll[k];
+				pk.ur[k][lane]    = (float)ur[k];
+				pk.slack[k][lane] = kAnalyticEps * (float)std::max( std::fabs( ll[k] ), std::fabs( ur[k] ) );
+				pk.q[k][lane]     = s.bQuadric ? (float)q[k] : 0.0f;
+			}
+			pk.radius[lane] = s.bQuadric ? (float)std::sqrt( s.radius2 ) : 0.0f;
+			pk.qs[lane]     = s.bQuadric ? (float)std::sqrt( std::max( q[0], std::max( q[1], q[2] ) ) ) : 0.0f;
+		}
+
 		//////////////////////////////////////////////////////////////////
 		//  BuildBVH4: collapse the BVH2 into a BVH4 by absorbing each
 		//  internal child's two children into the parent slot.  Result:
@@ -764,6 +1150,261 @@ namespace RISE
 #endif
 		}
 
+		//////////////////////////////////////////////////////////////////
+		//  Analytic leaf kernel: one ray against the four primitives of
+		//  an AnalyticPacket.  Each lane brings the ray into the
+		//  primitive's local frame WITHOUT normalizing, so t stays the
+		//  world distance, clips it to the local bounds (slab test) and
+		//  then to the bounding quadric.  Every tolerance widens the
+		//  interval, so a lane is only dropped when the ray certainly
+		//  misses: the float transform error (eps * the magnitudes that
+		//  went into it), the direction error growing with t, and the
+		//  cancellation in the quadric discriminant.  Returns the
+		//  candidate mask in the low 4 bits and a lower bound on each
+		//  candidate's hit distance in tNear (FLT_MAX for the rest).
+		//  Callers mask off lanes >= count.
+		//////////////////////////////////////////////////////////////////
+		static inline uint32_t RayAnalytic4(
+			const float origin[3], const float dir[3], float currentBest,
+			const AnalyticPacket& p, float tNear[4] )
+		{
+#if defined(RISE_BVH_HAVE_NEON)
+			const float32x4_t eps     = vdupq_n_f32( kAnalyticEps );
+			const float32x4_t zero    = vdupq_n_f32( 0.0f );
+			const float32x4_t vBig    = vdupq_n_f32( FLT_MAX );
+			const float32x4_t vNegBig = vdupq_n_f32( -FLT_MAX );
+			const float32x4_t tinyD   = vdupq_n_f32( 1e-30f );
+			const float32x4_t o[3] = { vdupq_n_f32( origin[0] ), vdupq_n_f32( origin[1] ), vdupq_n_f32( origin[2] ) };
+			const float32x4_t d[3] = { vdupq_n_f32( dir[0] ), vdupq_n_f32( dir[1] ), vdupq_n_f32( dir[2] ) };
+
+			float32x4_t lo = vNegBig, hi = vBig;
+			float32x4_t lorig[3], ldir[3];
+			float32x4_t padSum = zero, dSum = zero;
+			for( int k = 0; k < 3; ++k ) {
+				const float32x4_t m0 = vld1q_f32( p.m[k][0] );
+				const float32x4_t m1 = vld1q_f32( p.m[k][1] );
+				const float32x4_t m2 = vld1q_f32( p.m[k][2] );
+				const float32x4_t m3 = vld1q_f32( p.m[k][3] );
+				const float32x4_t a0 = vmulq_f32( m0, o[0] ), a1 = vmulq_f32( m1, o[1] ), a2 = vmulq_f32( m2, o[2] );
+				const float32x4_t b0 = vmulq_f32( m0, d[0] ), b1 = vmulq_f32( m1, d[1] ), b2 = vmulq_f32( m2, d[2] );
+				lorig[k] = vaddq_f32( vaddq_f32( a0, a1 ), vaddq_f32( a2, m3 ) );
+				ldir[k]  = vaddq_f32( vaddq_f32( b0, b1 ), b2 );
+				const float32x4_t O = vaddq_f32( vaddq_f32( vabsq_f32( a0 ), vabsq_f32( a1 ) ),
+				                                 vaddq_f32( vabsq_f32( a2 ), vabsq_f32( m3 ) ) );
+				const float32x4_t D = vaddq_f32( vaddq_f32( vabsq_f32( b0 ), vabsq_f32( b1 ) ), vabsq_f32( b2 ) );
+				const float32x4_t pad = vaddq_f32( vmulq_f32( eps, O ), vld1q_f32( p.slack[k] ) );
+
+				const float32x4_t ldg = vbslq_f32( vcltq_f32( vabsq_f32( ldir[k] ), tinyD ), tinyD, ldir[k] );
+				const float32x4_t inv = vdivq_f32( vdupq_n_f32( 1.0f ), ldg );
+				float32x4_t ta = vmulq_f32( vsubq_f32( vsubq_f32( vld1q_f32( p.ll[k] ), pad ), lorig[k] ), inv );
+				float32x4_t tb = vmulq_f32( vsubq_f32( vaddq_f32( vld1q_f32( p.ur[k] ), pad ), lorig[k] ), inv );
+				ta = vminq_f32( vmaxq_f32( ta, vNegBig ), vBig );
+				tb = vminq_f32( vmaxq_f32( tb, vNegBig ), vBig );
+				float32x4_t t0 = vminq_f32( ta, tb );
+				float32x4_t t1 = vmaxq_f32( ta, tb );
+				const float32x4_t w = vmulq_f32( vmulq_f32( eps, D ), vabsq_f32( inv ) );
+				t0 = vsubq_f32( t0, vmulq_f32( vabsq_f32( t0 ), w ) );
+				t1 = vaddq_f32( t1, vmulq_f32( vabsq_f32( t1 ), w ) );
+				lo = vmaxq_f32( lo, t0 );
+				hi = vminq_f32( hi, t1 );
+				padSum = vaddq_f32( padSum, pad );
+				dSum   = vaddq_f32( dSum, D );
+			}
+
+			float32x4_t A = zero, B = zero, S = zero;
+			for( int k = 0; k < 3; ++k ) {
+				const float32x4_t q = vld1q_f32( p.q[k] );
+				A = vaddq_f32( A, vmulq_f32( q, vmulq_f32( ldir[k], ldir[k] ) ) );
+				B = vaddq_f32( B, vmulq_f32( q, vmulq_f32( lorig[k], ldir[k] ) ) );
+				S = vaddq_f32( S, vmulq_f32( q, vmulq_f32( lorig[k], lorig[k] ) ) );
+			}
+			const float32x4_t qs    = vld1q_f32( p.qs );
+			const float32x4_t reff  = vaddq_f32( vld1q_f32( p.radius ),
+			                          vmulq_f32( qs, vaddq_f32( padSum, vmulq_f32( vmulq_f32( eps, dSum ), vabsq_f32( hi ) ) ) ) );
+			const float32x4_t reff2 = vmulq_f32( reff, reff );
+			const float32x4_t disc  = vsubq_f32( vmulq_f32( B, B ), vmulq_f32( A, vsubq_f32( S, reff2 ) ) );
+			const float32x4_t tol   = vmulq_f32( vmulq_f32( eps, A ), vaddq_f32( S, reff2 ) );
+			const float32x4_t ldLen = vaddq_f32( vaddq_f32( vmulq_f32( ldir[0], ldir[0] ), vmulq_f32( ldir[1], ldir[1] ) ),
+			                                     vmulq_f32( ldir[2], ldir[2] ) );
+			const uint32x4_t  flat  = vcleq_f32( A, vmulq_f32( vmulq_f32( eps, vmulq_f32( qs, qs ) ), ldLen ) );
+			const uint32x4_t  qok   = vorrq_u32( flat, vcgeq_f32( disc, vnegq_f32( tol ) ) );
+			const float32x4_t invA  = vdivq_f32( vdupq_n_f32( 1.0f ), A );
+			const float32x4_t hw    = vmulq_f32( vsqrtq_f32( vaddq_f32( vmaxq_f32( disc, zero ), tol ) ), invA );
+			const float32x4_t tc    = vnegq_f32( vmulq_f32( B, invA ) );
+			const float32x4_t wq    = vmulq_f32( eps, vaddq_f32( vabsq_f32( tc ), hw ) );
+			lo = vbslq_f32( flat, lo, vmaxq_f32( lo, vsubq_f32( vsubq_f32( tc, hw ), wq ) ) );
+			hi = vbslq_f32( flat, hi, vminq_f32( hi, vaddq_f32( vaddq_f32( tc, hw ), wq ) ) );
+
+			const float32x4_t tau = vmulq_f32( eps, vaddq_f32( vabsq_f32( lo ), vabsq_f32( hi ) ) );
+			uint32x4_t hit = vandq_u32( qok, vcleq_f32( lo, vaddq_f32( hi, tau ) ) );
+			hit = vandq_u32( hit, vcgeq_f32( hi, vnegq_f32( tau ) ) );
+			hit = vandq_u32( hit, vcleq_f32( lo, vaddq_f32( vdupq_n_f32( currentBest ), tau ) ) );
+
+			static const uint32_t bitsArr[4] = { 1u, 2u, 4u, 8u };
+			const uint32x4_t bits   = vld1q_u32( bitsArr );
+			const uint32x4_t always = vtstq_u32( vdupq_n_u32( p.alwaysMask ), bits );
+			const float32x4_t tOut = vbslq_f32( hit, vmaxq_f32( vsubq_f32( lo, tau ), zero ), vBig );
+			vst1q_f32( tNear, vbslq_f32( always, zero, tOut ) );
+			return vaddvq_u32( vandq_u32( vorrq_u32( hit, always ), bits ) );
+
+#elif defined(RISE_BVH_HAVE_SSE)
+			const __m128 eps     = _mm_set1_ps( kAnalyticEps );
+			const __m128 zero    = _mm_setzero_ps();
+			const __m128 vBig    = _mm_set1_ps( FLT_MAX );
+			const __m128 vNegBig = _mm_set1_ps( -FLT_MAX );
+			const __m128 tinyD   = _mm_set1_ps( 1e-30f );
+			const __m128 absMask = _mm_castsi128_ps( _mm_set1_epi32( 0x7FFFFFFF ) );
+			const __m128 o[3] = { _mm_set1_ps( origin[0] ), _mm_set1_ps( origin[1] ), _mm_set1_ps( origin[2] ) };
+			const __m128 d[3] = { _mm_set1_ps( dir[0] ), _mm_set1_ps( dir[1] ), _mm_set1_ps( dir[2] ) };
+
+			__m128 lo = vNegBig, hi = vBig;
+			__m128 lorig[3], ldir[3];
+			__m128 padSum = zero, dSum = zero;
+			for( int k = 0; k < 3; ++k ) {
+				const __m128 m0 = _mm_loadu_ps( p.m[k][0] );
+				const __m128 m1 = _mm_loadu_ps( p.m[k][1] );
+				const __m128 m2 = _mm_loadu_ps( p.m[k][2] );
+				const __m128 m3 = _mm_loadu_ps( p.m[k][3] );
+				const __m128 a0 = _mm_mul_ps( m0, o[0] ), a1 = _mm_mul_ps( m1, o[1] ), a2 = _mm_mul_ps( m2, o[2] );
+				const __m128 b0 = _mm_mul_ps( m0, d[0] ), b1 = _mm_mul_ps( m1, d[1] ), b2 = _mm_mul_ps( m2, d[2] );
+				lorig[k] = _mm_add_ps( _mm_add_ps( a0, a1 ), _mm_add_ps( a2, m3 ) );
+				ldir[k]  = _mm_add_ps( _mm_add_ps( b0, b1 ), b2 );
+				const __m128 O = _mm_add_ps( _mm_add_ps( _mm_and_ps( a0, absMask ), _mm_and_ps( a1, absMask ) ),
+				                             _mm_add_ps( _mm_and_ps( a2, absMask ), _mm_and_ps( m3, absMask ) ) );
+				const __m128 D = _mm_add_ps( _mm_add_ps( _mm_and_ps( b0, absMask ), _mm_and_ps( b1, absMask ) ),
+				                             _mm_and_ps( b2, absMask ) );
+				const __m128 pad = _mm_add_ps( _mm_mul_ps( eps, O ), _mm_loadu_ps( p.slack[k] ) );
+
+				const __m128 flatD = _mm_cmplt_ps( _mm_and_ps( ldir[k], absMask ), tinyD );
+				const __m128 ldg   = _mm_or_ps( _mm_and_ps( flatD, tinyD ), _mm_andnot_ps( flatD, ldir[k] ) );
+				const __m128 inv   = _mm_div_ps( _mm_set1_ps( 1.0f ), ldg );
+				__m128 ta = _mm_mul_ps( _mm_sub_ps( _mm_sub_ps( _mm_loadu_ps( p.ll[k] ), pad ), lorig[k] ), inv );
+				__m128 tb = _mm_mul_ps( _mm_sub_ps( _mm_add_ps( _mm_loadu_ps( p.ur[k] ), pad ), lorig[k] ), inv );
+				ta = _mm_min_ps( _mm_max_ps( ta, vNegBig ), vBig );
+				tb = _mm_min_ps( _mm_max_ps( tb, vNegBig ), vBig );
+				__m128 t0 = _mm_min_ps( ta, tb );
+				__m128 t1 = _mm_max_ps( ta, tb );
+				const __m128 w = _mm_mul_ps( _mm_mul_ps( eps, D ), _mm_and_ps( inv, absMask ) );
+				t0 = _mm_sub_ps( t0, _mm_mul_ps( _mm_and_ps( t0, absMask ), w ) );
+				t1 = _mm_add_ps( t1, _mm_mul_ps( _mm_and_ps( t1, absMask ), w ) );
+				lo = _mm_max_ps( lo, t0 );
+				hi = _mm_min_ps( hi, t1 );
+				padSum = _mm_add_ps( padSum, pad );
+				dSum   = _mm_add_ps( dSum, D );
+			}
+
+			__m128 A = zero, B = zero, S = zero;
+			for( int k = 0; k < 3; ++k ) {
+				const __m128 q = _mm_loadu_ps( p.q[k] );
+				A = _mm_add_ps( A, _mm_mul_ps( q, _mm_mul_ps( ldir[k], ldir[k] ) ) );
+				B = _mm_add_ps( B, _mm_mul_ps( q, _mm_mul_ps( lorig[k], ldir[k] ) ) );
+				S = _mm_add_ps( S, _mm_mul_ps( q, _mm_mul_ps( lorig[k], lorig[k] ) ) );
+			}
+			const __m128 qs    = _mm_loadu_ps( p.qs );
+			const __m128 reff  = _mm_add_ps( _mm_loadu_ps( p.radius ),
+			                     _mm_mul_ps( qs, _mm_add_ps( padSum, _mm_mul_ps( _mm_mul_ps( eps, dSum ), _mm_and_ps( hi, absMask ) ) ) ) );
+			const __m128 reff2 = _mm_mul_ps( reff, reff );
+			const __m128 disc  = _mm_sub_ps( _mm_mul_ps( B, B ), _mm_mul_ps( A, _mm_sub_ps( S, reff2 ) ) );
+			const __m128 tol   = _mm_mul_ps( _mm_mul_ps( eps, A ), _mm_add_ps( S, reff2 ) );
+			const __m128 ldLen = _mm_add_ps( _mm_add_ps( _mm_mul_ps( ldir[0], ldir[0] ), _mm_mul_ps( ldir[1], ldir[1] ) ),
+			                                 _mm_mul_ps( ldir[2], ldir[2] ) );
+			const __m128 flat  = _mm_cmple_ps( A, _mm_mul_ps( _mm_mul_ps( eps, _mm_mul_ps( qs, qs ) ), ldLen ) );
+			const __m128 qok   = _mm_or_ps( flat, _mm_cmpge_ps( disc, _mm_sub_ps( zero, tol ) ) );
+			const __m128 invA  = _mm_div_ps( _mm_set1_ps( 1.0f ), A );
+			const __m128 hw    = _mm_mul_ps( _mm_sqrt_ps( _mm_add_ps( _mm_max_ps( disc, zero ), tol ) ), invA );
+			const __m128 tc    = _mm_sub_ps( zero, _mm_mul_ps( B, invA ) );
+			const __m128 wq    = _mm_mul_ps( eps, _mm_add_ps( _mm_and_ps( tc, absMask ), hw ) );
+			const __m128 qlo   = _mm_max_ps( lo, _mm_sub_ps( _mm_sub_ps( tc, hw ), wq ) );
+			const __m128 qhi   = _mm_min_ps( hi, _mm_add_ps( _mm_add_ps( tc, hw ), wq ) );
+			lo = _mm_or_ps( _mm_and_ps( flat, lo ), _mm_andnot_ps( flat, qlo ) );
+			hi = _mm_or_ps( _mm_and_ps( flat, hi ), _mm_andnot_ps( flat, qhi ) );
+
+			const __m128 tau = _mm_mul_ps( eps, _mm_add_ps( _mm_and_ps( lo, absMask ), _mm_and_ps( hi, absMask ) ) );
+			__m128 hit = _mm_and_ps( qok, _mm_cmple_ps( lo, _mm_add_ps( hi, tau ) ) );
+			hit = _mm_and_ps( hit, _mm_cmpge_ps( hi, _mm_sub_ps( zero, tau ) ) );
+			hit = _mm_and_ps( hit, _mm_cmple_ps( lo, _mm_add_ps( _mm_set1_ps( currentBest ), tau ) ) );
+
+			const __m128i bits   = _mm_set_epi32( 8, 4, 2, 1 );
+			const __m128  always = _mm_castsi128_ps( _mm_cmpeq_epi32(
+				_mm_and_si128( _mm_set1_epi32( (int)p.alwaysMask ), bits ), bits ) );
+			const __m128 tN   = _mm_max_ps( _mm_sub_ps( lo, tau ), zero );
+			const __m128 tOut = _mm_or_ps( _mm_and_ps( hit, tN ), _mm_andnot_ps( hit, vBig ) );
+			_mm_storeu_ps( tNear, _mm_andnot_ps( always, tOut ) );
+			return (uint32_t)_mm_movemask_ps( _mm_or_ps( hit, always ) ) & 0xF;
+
+#else
+			// Scalar fallback — same arithmetic, four times.
+			uint32_t mask = 0;
+			for( int i = 0; i < 4; ++i ) {
+				if( p.alwaysMask & ( 1u << i ) ) {
+					tNear[i] = 0.0f;
+					mask |= ( 1u << i );
+					continue;
+				}
+
+				float lo = -FLT_MAX, hi = FLT_MAX;
+				float lorig[3], ldir[3];
+				float padSum = 0.0f, dSum = 0.0f;
+				for( int k = 0; k < 3; ++k ) {
+					const float a0 = p.m[k][0][i] * origin[0], a1 = p.m[k][1][i] * origin[1], a2 = p.m[k][2][i] * origin[2];
+					const float b0 = p.m[k][0][i] * dir[0],    b1 = p.m[k][1][i] * dir[1],    b2 = p.m[k][2][i] * dir[2];
+					lorig[k] = ( a0 + a1 ) + ( a2 + p.m[k][3][i] );
+					ldir[k]  = ( b0 + b1 ) + b2;
+					const float O = ( std::fabs( a0 ) + std::fabs( a1 ) ) + ( std::fabs( a2 ) + std::fabs( p.m[k][3][i] ) );
+					const float D = ( std::fabs( b0 ) + std::fabs( b1 ) ) + std::fabs( b2 );
+					const float pad = kAnalyticEps * O + p.slack[k][i];
+
+					const float ldg = ( std::fabs( ldir[k] ) < 1e-30f ) ? 1e-30f : ldir[k];
+					const float inv = 1.0f / ldg;
+					float ta = ( ( p.ll[k][i] - pad ) - lorig[k] ) * inv;
+					float tb = ( ( p.ur[k][i] + pad ) - lorig[k] ) * inv;
+					ta = std::fmin( std::fmax( ta, -FLT_MAX ), FLT_MAX );
+					tb = std::fmin( std::fmax( tb, -FLT_MAX ), FLT_MAX );
+					float t0 = std::fmin( ta, tb );
+					float t1 = std::fmax( ta, tb );
+					const float w = kAnalyticEps * D * std::fabs( inv );
+					t0 -= std::fabs( t0 ) * w;
+					t1 += std::fabs( t1 ) * w;
+					lo = std::fmax( lo, t0 );
+					hi = std::fmin( hi, t1 );
+					padSum += pad;
+					dSum   += D;
+				}
+
+				float A = 0.0f, B = 0.0f, S = 0.0f;
+				for( int k = 0; k < 3; ++k ) {
+					A += p.q[k][i] * ( ldir[k] * ldir[k] );
+					B += p.q[k][i] * ( lorig[k] * ldir[k] );
+					S += p.q[k][i] * ( lorig[k] * lorig[k] );
+				}
+				const float qs    = p.qs[i];
+				const float ldLen = ldir[0]*ldir[0] + ldir[1]*ldir[1] + ldir[2]*ldir[2];
+				bool qok = true;
+				if( A > kAnalyticEps * ( qs * qs ) * ldLen ) {
+					const float reff  = p.radius[i] + qs * ( padSum + kAnalyticEps * dSum * std::fabs( hi ) );
+					const float reff2 = reff * reff;
+					const float disc  = B * B - A * ( S - reff2 );
+					const float tol   = kAnalyticEps * A * ( S + reff2 );
+					qok = ( disc >= -tol );
+					const float hw = std::sqrt( std::fmax( disc, 0.0f ) + tol ) / A;
+					const float tc = -B / A;
+					const float wq = kAnalyticEps * ( std::fabs( tc ) + hw );
+					lo = std::fmax( lo, tc - hw - wq );
+					hi = std::fmin( hi, tc + hw + wq );
+				}
+
+				const float tau = kAnalyticEps * ( std::fabs( lo ) + std::fabs( hi ) );
+				if( qok && lo <= hi + tau && hi >= -tau && lo <= currentBest + tau ) {
+					tNear[i] = std::fmax( lo - tau, 0.0f );
+					mask |= ( 1u << i );
+				} else {
+					tNear[i] = FLT_MAX;
+				}
+			}
+			return mask;
+#endif
+		}
+
 	protected:
 
 		//////////////////////////////////////////////////////////////////
@@ -1233,6 +1874,44 @@ namespace RISE
 		// Leaf intersection just calls the processor directly with `ri`
 		// — saves the RayIntersectionGeometric/RayIntersection copy
 		// (~120 bytes ea on 64-bit doubles) per leaf-prim test.
+		//
+		// Leaves with an AnalyticPacket run RayAnalytic4 first and only
+		// intersect its candidates, nearest lower bound first, stopping
+		// once the bound passes the hit in hand.  The BVH2 traversals
+		// share these helpers.
+
+		inline bool IsAnalyticLeaf( uint32_t firstPrim ) const
+		{
+			return hasAnalyticFilter && analyticLeafPacket[firstPrim] != kNoPacket;
+		}
+
+		// Candidates of an analytic leaf sorted by tNear (stable, so
+		// ties keep leaf order).  Returns how many.
+		inline uint32_t AnalyticLeafCandidates(
+			uint32_t firstPrim, uint32_t primCnt,
+			const float origin[3], const float dir[3], float currentBest,
+			uint32_t cand[kMaxAnalyticLeaf], float tNear[kMaxAnalyticLeaf] ) const
+		{
+			const AnalyticPacket* pk = &analyticPackets[ analyticLeafPacket[firstPrim] ];
+			uint32_t n = 0;
+			for( uint32_t first = 0; first < primCnt; first += 4, ++pk ) {
+				float t[4];
+				const uint32_t mask = RayAnalytic4( origin, dir, currentBest, *pk, t ) &
+				                      ( ( 1u << pk->count ) - 1u );
+				for( uint32_t lane = 0; lane < pk->count; ++lane ) {
+					if( !( mask & ( 1u << lane ) ) ) continue;
+					uint32_t j = n++;
+					while( j > 0 && tNear[j-1] > t[lane] ) {
+						tNear[j] = tNear[j-1];
+						cand[j]  = cand[j-1];
+						--j;
+					}
+					tNear[j] = t[lane];
+					cand[j]  = firstPrim + first + lane;
+				}
+			}
+			return n;
+		}
 
 		inline void Bvh4Leaf_Geometric(
 			RayIntersectionGeometric& ri,
@@ -1240,6 +1919,18 @@ namespace RISE
 			const float origin[3], const float dir[3],
 			bool bHitFrontFaces, bool bHitBackFaces ) const
 		{
+			if( IsAnalyticLeaf( firstPrim ) ) {
+				uint32_t cand[kMaxAnalyticLeaf];
+				float    tNear[kMaxAnalyticLeaf];
+				const uint32_t n = AnalyticLeafCandidates( firstPrim, primCnt, origin, dir,
+				                                           (float)ri.range, cand, tNear );
+				for( uint32_t c = 0; c < n && tNear[c] <= (float)ri.range; ++c ) {
+					ep.RayElementIntersection( ri, prims[cand[c]],
+					                           bHitFrontFaces, bHitBackFaces );
+				}
+				return;
+			}
+
 			const uint32_t end = firstPrim + primCnt;
 			for( uint32_t i = firstPrim; i < end; ++i ) {
 				if( hasFastFilter ) {
@@ -1260,6 +1951,19 @@ namespace RISE
 			const float origin[3], const float dir[3],
 			bool bHitFrontFaces, bool bHitBackFaces, bool bComputeExitInfo ) const
 		{
+			if( IsAnalyticLeaf( firstPrim ) ) {
+				uint32_t cand[kMaxAnalyticLeaf];
+				float    tNear[kMaxAnalyticLeaf];
+				const uint32_t n = AnalyticLeafCandidates( firstPrim, primCnt, origin, dir,
+				                                           (float)ri.geometric.range, cand, tNear );
+				for( uint32_t c = 0; c < n && tNear[c] <= (float)ri.geometric.range; ++c ) {
+					ep.RayElementIntersection( ri, prims[cand[c]],
+					                           bHitFrontFaces, bHitBackFaces,
+					                           bComputeExitInfo );
+				}
+				return;
+			}
+
 			const uint32_t end = firstPrim + primCnt;
 			for( uint32_t i = firstPrim; i < end; ++i ) {
 				if( hasFastFilter ) {
@@ -1281,8 +1985,23 @@ namespace RISE
 			const float origin[3], const float dir[3],
 			bool bHitFrontFaces, bool bHitBackFaces ) const
 		{
-			const uint32_t end = firstPrim + primCnt;
 			const float currentBest = (float)dHowFar;
+			if( IsAnalyticLeaf( firstPrim ) ) {
+				uint32_t cand[kMaxAnalyticLeaf];
+				float    tNear[kMaxAnalyticLeaf];
+				const uint32_t n = AnalyticLeafCandidates( firstPrim, primCnt, origin, dir,
+				                                           currentBest, cand, tNear );
+				for( uint32_t c = 0; c < n; ++c ) {
+					if( ep.RayElementIntersection_IntersectionOnly(
+					        ray, dHowFar, prims[cand[c]],
+					        bHitFrontFaces, bHitBackFaces ) ) {
+						return true;
+					}
+				}
+				return false;
+			}
+
+			const uint32_t end = firstPrim + primCnt;
 			for( uint32_t i = firstPrim; i < end; ++i ) {
 				if( hasFastFilter ) {
 					float fT;
@@ -1316,8 +2035,8 @@ namespace RISE
 			// `thread_local` keeps allocations to one warm-up grow per
 			// worker thread, then steady-state zero heap traffic.
 			// (Caught by adversarial review, 2026-04-27.)
-			static thread_local std::vector<uint32_t> stack;
-			stack.clear();
+			static thread_local std::vector<uint32_t> stackStore;
+			TraversalStack stack( stackStore );
 			stack.push_back( 0 );
 
 			while( !stack.empty() ) {
@@ -1379,8 +2098,8 @@ namespace RISE
 
 			// Bounded dynamic stack — see geometric overload above for
 			// rationale.
-			static thread_local std::vector<uint32_t> stack;
-			stack.clear();
+			static thread_local std::vector<uint32_t> stackStore;
+			TraversalStack stack( stackStore );
 			stack.push_back( 0 );
 
 			while( !stack.empty() ) {
@@ -1433,8 +2152,8 @@ namespace RISE
 
 			// Bounded dynamic stack — see geometric overload above for
 			// rationale.
-			static thread_local std::vector<uint32_t> stack;
-			stack.clear();
+			static thread_local std::vector<uint32_t> stackStore;
+			TraversalStack stack( stackStore );
 			stack.push_back( 0 );
 			const float currentBest = (float)dHowFar;
 
@@ -1506,8 +2225,8 @@ namespace RISE
 			// Bounded dynamic stack — see IntersectRay4 (BVH4 path) above
 			// for full rationale.  thread_local keeps allocations to one
 			// warm-up grow per worker thread.
-			static thread_local std::vector<uint32_t> stack;
-			stack.clear();
+			static thread_local std::vector<uint32_t> stackStore;
+			TraversalStack stack( stackStore );
 			stack.push_back( 0 );
 
 			while( !stack.empty() ) {
@@ -1528,19 +2247,9 @@ namespace RISE
 					// Cleanup §1+§2: closest-hit guard is now native in
 					// TriangleMeshGeometry{,Indexed}::RayElementIntersection,
 					// so the BSP-pattern myRI copy/compare workaround is no
-					// longer needed.  Phase 2 float-filter gate stays.
-					const uint32_t end = node.firstPrimOrLeft + node.primCount;
-					for( uint32_t i = node.firstPrimOrLeft; i < end; ++i ) {
-						if( hasFastFilter ) {
-							float fT;
-							if( !MollerTrumboreFloat( origin, dir, fastFilter[i],
-							                          (float)ri.range, fT ) ) {
-								continue;
-							}
-						}
-						ep.RayElementIntersection( ri, prims[i],
-						                           bHitFrontFaces, bHitBackFaces );
-					}
+					// longer needed.  Same leaf helper (and filters) as BVH4.
+					Bvh4Leaf_Geometric( ri, node.firstPrimOrLeft, node.primCount,
+					                    origin, dir, bHitFrontFaces, bHitBackFaces );
 				} else {
 					// Internal — push children near-far order based on
 					// ray direction sign on splitAxis.  Near goes on
@@ -1589,8 +2298,8 @@ namespace RISE
 			}
 
 			// Bounded dynamic stack — see IntersectRay4 (BVH4 path) above.
-			static thread_local std::vector<uint32_t> stack;
-			stack.clear();
+			static thread_local std::vector<uint32_t> stackStore;
+			TraversalStack stack( stackStore );
 			stack.push_back( 0 );
 
 			while( !stack.empty() ) {
@@ -1606,19 +2315,9 @@ namespace RISE
 				if( node.primCount > 0 ) {
 					// Cleanup §1+§2: same closest-hit-native pattern as the
 					// geometric overload above — call processor directly.
-					const uint32_t end = node.firstPrimOrLeft + node.primCount;
-					for( uint32_t i = node.firstPrimOrLeft; i < end; ++i ) {
-						if( hasFastFilter ) {
-							float fT;
-							if( !MollerTrumboreFloat( origin, dir, fastFilter[i],
-							                          (float)ri.geometric.range, fT ) ) {
-								continue;
-							}
-						}
-						ep.RayElementIntersection( ri, prims[i],
-						                           bHitFrontFaces, bHitBackFaces,
-						                           bComputeExitInfo );
-					}
+					Bvh4Leaf_Full( ri, node.firstPrimOrLeft, node.primCount,
+					               origin, dir, bHitFrontFaces, bHitBackFaces,
+					               bComputeExitInfo );
 				} else {
 					const uint32_t leftIdx  = node.firstPrimOrLeft;
 					const uint32_t rightIdx = leftIdx + 1;
@@ -1663,8 +2362,8 @@ namespace RISE
 			}
 
 			// Bounded dynamic stack — see IntersectRay4 (BVH4 path) above.
-			static thread_local std::vector<uint32_t> stack;
-			stack.clear();
+			static thread_local std::vector<uint32_t> stackStore;
+			TraversalStack stack( stackStore );
 			stack.push_back( 0 );
 			const float currentBest = (float)dHowFar;
 
@@ -1685,20 +2384,11 @@ namespace RISE
 					// We still defer the verdict to the production
 					// _IntersectionOnly call.  The filter's job is to
 					// skip non-hits, not to grant hits.
-					const uint32_t end = node.firstPrimOrLeft + node.primCount;
-					for( uint32_t i = node.firstPrimOrLeft; i < end; ++i ) {
-						if( hasFastFilter ) {
-							float fT;
-							if( !MollerTrumboreFloat( origin, dir, fastFilter[i],
-							                          currentBest, fT ) ) {
-								continue;
-							}
-						}
-						if( ep.RayElementIntersection_IntersectionOnly(
-						        ray, dHowFar, prims[i],
-						        bHitFrontFaces, bHitBackFaces ) ) {
-							return true;
-						}
+					if( Bvh4Leaf_IntersectionOnly( ray, dHowFar,
+					                               node.firstPrimOrLeft, node.primCount,
+					                               origin, dir,
+					                               bHitFrontFaces, bHitBackFaces ) ) {
+						return true;
 					}
 				} else {
 					const uint32_t leftIdx  = node.firstPrimOrLeft;
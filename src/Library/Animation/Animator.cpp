@@ -178,6 +178,21 @@ void Animator::EvaluateAtTime( const Scalar time )
 	}
 }
 
+void Animator::GetAnimatedElements( std::vector<IKeyframable*>& out ) const
+{
+	// Same active-name resolution as EvaluateAtTime
+	const String& active =
+		!IsBlankName( activeAnimation ) ? activeAnimation :
+		( !animations.empty() ? animations[0].name : activeAnimation );
+
+	out.clear();
+	for( ElementList::const_iterator it=elements.begin(); it!=elements.end(); it++ ) {
+		if( it->second->IsAnimatedIn( active ) ) {
+			out.push_back( it->second->GetElement() );
+		}
+	}
+}
+
 bool Animator::DeclareAnimation(
 	const String& name,
 	const double time_start,
@@ -78,6 +78,10 @@ namespace RISE
 
 			inline bool AreThereAnyKeyframedObjects(){ return (elements.size()>0); }
 
+			//! Every element EvaluateAtTime would change, that is every
+			//! element with timelines in the active animation
+			void GetAnimatedElements( std::vector<IKeyframable*>& out ) const;
+
 			// Named animation paths
 			bool InsertKeyframeForAnimation(
 				IKeyframable* pElem,
@@ -54,6 +54,14 @@ namespace RISE
 			//! If this element has no timelines in that animation it is left
 			//! untouched (RegenerateData is not called).
 			void EvaluateAtTimeForAnimation( const Scalar time, const String& animation );
+
+			//! Whether the element has any timelines in the given animation
+			bool IsAnimatedIn( const String& animation ) const
+			{
+				return animations.find( animation ) != animations.end();
+			}
+
+			IKeyframable* GetElement() const { return pElement; }
 		};
 	}
 }
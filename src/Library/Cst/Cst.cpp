@@ -28,6 +28,7 @@
 #include "../Parsers/ChunkParserRegistry.h"   // CreateAllChunkParsers (the LIVE registry)
 #include "../Parsers/IAsciiChunkParser.h"     // IAsciiChunkParser, DispatchChunkParameters
 #include "../Painters/ExpressionEval.h"      // ExpressionProgram (expr(...) derive-time eval, #5 slice 2)
+#include "../Utilities/ThreadPool.h"      // GlobalThreadPool (region-parallel ParseToCst)
 
 #include <algorithm>
 #include <cerrno>
@@ -80,36 +81,50 @@ namespace
 
 	bool IsWs( char c ) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
 
-	std::vector<RawTok> Tokenize( const std::string& in )
+	enum class TokClass { Trivia, LBrace, RBrace, Word };
+
+	//! Scan the one token starting at in[i] (i < n), returning its class and
+	//! the position just past it. The ONE lexer: Tokenize builds the token
+	//! stream from it and FindRegionSplits walks it without allocating, so the
+	//! two can never disagree on where a token (or a comment) ends.
+	size_t ScanToken( const char* in, size_t i, const size_t n, TokClass& cls )
 	{
-		std::vector<RawTok> out;
-		size_t i = 0, n = in.size();
 		auto isBlockStart = [&]( size_t k ) { return k + 1 < n && in[k] == '/' && in[k+1] == '*'; };
-		while( i < n ) {
-			char c = in[i];
-			if( IsWs(c) || c == '#' || isBlockStart(i) ) {
-				size_t s = i;
-				for( ;; ) {
-					if( i >= n ) break;
-					if( IsWs(in[i]) ) { ++i; continue; }
-					if( in[i] == '#' ) { while( i < n && in[i] != '\n' ) ++i; continue; }
-					if( isBlockStart(i) ) {
-						i += 2;
-						while( i + 1 < n && !(in[i] == '*' && in[i+1] == '/') ) ++i;
-						i = (i + 1 < n) ? i + 2 : n;   // skip the closing */ (or to EOF if unterminated)
-						continue;
-					}
-					break;
+		const char c = in[i];
+		if( IsWs(c) || c == '#' || isBlockStart(i) ) {
+			for( ;; ) {
+				if( i >= n ) break;
+				if( IsWs(in[i]) ) { ++i; continue; }
+				if( in[i] == '#' ) { while( i < n && in[i] != '\n' ) ++i; continue; }
+				if( isBlockStart(i) ) {
+					i += 2;
+					while( i + 1 < n && !(in[i] == '*' && in[i+1] == '/') ) ++i;
+					i = (i + 1 < n) ? i + 2 : n;   // skip the closing */ (or to EOF if unterminated)
+					continue;
 				}
-				out.push_back( { true, in.substr(s, i-s) } );
-			} else if( c == '{' || c == '}' ) {
-				out.push_back( { false, std::string(1,c) } );
-				++i;
-			} else {
-				size_t s = i;
-				while( i < n ) { char d = in[i]; if( IsWs(d) || d == '#' || d == '{' || d == '}' || isBlockStart(i) ) break; ++i; }
-				out.push_back( { false, in.substr(s, i-s) } );
+				break;
 			}
+			cls = TokClass::Trivia;
+			return i;
+		}
+		if( c == '{' || c == '}' ) {
+			cls = ( c == '{' ) ? TokClass::LBrace : TokClass::RBrace;
+			return i + 1;
+		}
+		while( i < n ) { char d = in[i]; if( IsWs(d) || d == '#' || d == '{' || d == '}' || isBlockStart(i) ) break; ++i; }
+		cls = TokClass::Word;
+		return i;
+	}
+
+	std::vector<RawTok> Tokenize( const char* in, const size_t n )
+	{
+		std::vector<RawTok> out;
+		size_t i = 0;
+		while( i < n ) {
+			TokClass cls;
+			const size_t e = ScanToken( in, i, n, cls );
+			out.push_back( { cls == TokClass::Trivia, std::string( in + i, e - i ) } );
+			i = e;
 		}
 		return out;
 	}
@@ -119,36 +134,37 @@ namespace
 	// closing brace. Brace-depth counter -> nested '{...}' captured losslessly,
 	// never truncates. Flat "pname pvalue" lines at body-depth 1 bind to Param
 	// nodes; everything else is generic (still lossless). Bounds-guarded.
+	// Consumed tokens' text is moved into the nodes, not copied.
 	//----------------------------------------------------------------------
-	NodeRef ParseChunk( const std::vector<RawTok>& t, size_t& i )
+	NodeRef ParseChunk( std::vector<RawTok>& t, size_t& i )
 	{
 		std::vector<NodeRef> ck;
 		std::string keyword = t[i].text;
-		ck.push_back( Leaf(NodeKind::Token, t[i++].text, "kw") );
-		while( i < t.size() && t[i].trivia ) ck.push_back( Leaf(NodeKind::Trivia, t[i++].text, "") );
-		if( i < t.size() && !t[i].trivia && t[i].text == "{" ) ck.push_back( Leaf(NodeKind::Token, t[i++].text, "lbrace") );
+		ck.push_back( Leaf(NodeKind::Token, std::move(t[i++].text), "kw") );
+		while( i < t.size() && t[i].trivia ) ck.push_back( Leaf(NodeKind::Trivia, std::move(t[i++].text), "") );
+		if( i < t.size() && !t[i].trivia && t[i].text == "{" ) ck.push_back( Leaf(NodeKind::Token, std::move(t[i++].text), "lbrace") );
 
 		int depth = 1;
 		while( i < t.size() && depth > 0 ) {
-			if( t[i].trivia ) { ck.push_back( Leaf(NodeKind::Trivia, t[i++].text, "") ); continue; }
+			if( t[i].trivia ) { ck.push_back( Leaf(NodeKind::Trivia, std::move(t[i++].text), "") ); continue; }
 			const std::string& tx = t[i].text;
-			if( tx == "}" ) { --depth; ck.push_back( Leaf(NodeKind::Token, t[i++].text, depth == 0 ? "rbrace" : "tok") ); continue; }
-			if( tx == "{" ) { ++depth; ck.push_back( Leaf(NodeKind::Token, t[i++].text, "tok") ); continue; }
+			if( tx == "}" ) { --depth; ck.push_back( Leaf(NodeKind::Token, std::move(t[i++].text), depth == 0 ? "rbrace" : "tok") ); continue; }
+			if( tx == "{" ) { ++depth; ck.push_back( Leaf(NodeKind::Token, std::move(t[i++].text), "tok") ); continue; }
 			if( depth == 1 ) {
 				std::string pname = tx;
 				std::vector<NodeRef> pk;
-				pk.push_back( Leaf(NodeKind::Token, t[i++].text, "pname") );
+				pk.push_back( Leaf(NodeKind::Token, std::move(t[i++].text), "pname") );
 				bool sawNewline = false;
 				while( i < t.size() && t[i].trivia ) {
 					if( t[i].text.find('\n') != std::string::npos ) sawNewline = true;
-					pk.push_back( Leaf(NodeKind::Trivia, t[i++].text, "") );
+					pk.push_back( Leaf(NodeKind::Trivia, std::move(t[i++].text), "") );
 				}
 				// A param's value is on the SAME line as its name. If the next
 				// token is on a later line (or a brace), this is a value-less
 				// line -- flatten it; do NOT swallow the next line's token as the
 				// value (which the legacy parser would never do).
 				if( !sawNewline && i < t.size() && !t[i].trivia && t[i].text != "}" && t[i].text != "{" ) {
-					pk.push_back( Leaf(NodeKind::Token, t[i++].text, "pvalue") );   // first value token
+					pk.push_back( Leaf(NodeKind::Token, std::move(t[i++].text), "pvalue") );   // first value token
 					// A param's value can be MULTIPLE same-line tokens (e.g.
 					// `color 1 0 0`). Capture each additional same-line token (with
 					// its inter-token trivia) as another pvalue, until a newline or a
@@ -158,20 +174,86 @@ namespace
 						size_t k = i; bool nl = false;
 						while( k < t.size() && t[k].trivia ) { if( t[k].text.find('\n') != std::string::npos ) nl = true; ++k; }
 						if( nl || k >= t.size() || t[k].text == "}" || t[k].text == "{" ) break;
-						while( i < k ) pk.push_back( Leaf(NodeKind::Trivia, t[i++].text, "") );   // inter-value trivia
-						pk.push_back( Leaf(NodeKind::Token, t[i++].text, "pvalue") );             // next value token
+						while( i < k ) pk.push_back( Leaf(NodeKind::Trivia, std::move(t[i++].text), "") );   // inter-value trivia
+						pk.push_back( Leaf(NodeKind::Token, std::move(t[i++].text), "pvalue") );             // next value token
 					}
 					ck.push_back( Internal(NodeKind::Param, std::move(pk), pname) );
 				} else {
 					for( auto& x : pk ) ck.push_back( x );   // value-less line: flatten (lossless)
 				}
 			} else {
-				ck.push_back( Leaf(NodeKind::Token, t[i++].text, "tok") );  // nested-block content: generic (lossless)
+				ck.push_back( Leaf(NodeKind::Token, std::move(t[i++].text), "tok") );  // nested-block content: generic (lossless)
 			}
 		}
 		return Internal( NodeKind::Chunk, std::move(ck), keyword );
 	}
 
+	//----------------------------------------------------------------------
+	// Parse the top-level items of in[0,n): chunks, and the trivia and stray
+	// tokens between them. A chunk is `keyword {` (brace may be on the next
+	// line). A bare word not followed by `{` -- e.g. each token of the `RISE
+	// ASCII SCENE 7` header -- is preserved losslessly as a stray Token, NOT
+	// swallowed as a never-closed chunk. (A dedicated version-header node is a
+	// later item.)
+	//----------------------------------------------------------------------
+	void ParseItems( const char* in, const size_t n, std::vector<NodeRef>& items )
+	{
+		std::vector<RawTok> t = Tokenize( in, n );
+		size_t i = 0;
+		while( i < t.size() ) {
+			if( t[i].trivia ) { items.push_back( Leaf(NodeKind::Trivia, std::move(t[i++].text), "") ); continue; }
+			size_t j = i + 1;
+			while( j < t.size() && t[j].trivia ) ++j;
+			if( j < t.size() && !t[j].trivia && t[j].text == "{" ) items.push_back( ParseChunk( t, i ) );
+			else items.push_back( Leaf(NodeKind::Token, std::move(t[i++].text), "stray") );
+		}
+	}
+
+	//! Smallest region ParseToCst hands a pool worker: below this the split
+	//! scan and the hand-off cost more than the parse they would share.
+	const size_t PARSE_REGION_BYTES = (size_t)1 << 20;
+
+	//! Positions in in[0,n) where the top level of ParseItems stands between
+	//! two items, about `spacing` bytes apart -- each just past a chunk's
+	//! closing brace. Walks the tokens ParseItems would see, with the same
+	//! chunk rule and brace depth as ParseChunk, but allocates nothing; every
+	//! region between two splits then parses, on its own, to exactly the items
+	//! the whole text gives there.
+	std::vector<size_t> FindRegionSplits( const char* in, const size_t n, const size_t spacing )
+	{
+		std::vector<size_t> splits;
+		size_t next = spacing;
+		size_t i = 0;
+		TokClass cls;
+		while( i < n ) {
+			const size_t e = ScanToken( in, i, n, cls );
+			if( cls == TokClass::Trivia ) { i = e; continue; }
+			size_t j = e;
+			TokClass nextCls = TokClass::Trivia;
+			size_t je = j;
+			while( j < n ) {
+				je = ScanToken( in, j, n, nextCls );
+				if( nextCls != TokClass::Trivia ) break;
+				j = je;
+			}
+			if( j >= n || nextCls != TokClass::LBrace ) { i = e; continue; }   // a stray token
+
+			// A chunk: count braces from its opening one to the close
+			int depth = 1;
+			i = je;
+			while( i < n && depth > 0 ) {
+				i = ScanToken( in, i, n, cls );
+				if( cls == TokClass::LBrace ) ++depth;
+				else if( cls == TokClass::RBrace ) --depth;
+			}
+			if( i < n && i >= next ) {
+				splits.push_back( i );
+				next = i + spacing;
+			}
+		}
+		return splits;
+	}
+
 	void Serialize( const NodeRef& g, std::string& out )
 	{
 		if( g->kids.empty() ) out += g->text;
@@ -798,6 +880,36 @@ namespace
 			byId = IdMapSet( byId, pid, rp.node, 0 );
 		}
 	}
+
+	//----------------------------------------------------------------------
+	// Bulk builds for a fresh parse. ParseToCst knows every key up front, so
+	// it sorts them and builds each index perfectly balanced in O(N), as
+	// SeqBuild/IdBuild do for the sequences, instead of N path-copying
+	// O(log N) inserts. A perfectly balanced tree satisfies the weight-
+	// balance invariant, so later edits rebalance it as usual.
+	//----------------------------------------------------------------------
+	struct IdMapEntry { NodeId key; NodeRef val; std::int64_t label; };
+	IdMapRef IdMapBuild( const std::vector<IdMapEntry>& v, int lo, int hi )   // v ascending by key
+	{
+		if( lo >= hi ) return IdMapRef();
+		const int mid = (lo + hi) / 2;
+		return IdMapMk( IdMapBuild(v, lo, mid), v[mid].key, v[mid].val, v[mid].label, IdMapBuild(v, mid+1, hi) );
+	}
+	struct NameEntry { std::string name; std::vector<NodeId> ids; };
+	NameMapRef NameBuild( const std::vector<NameEntry>& v, int lo, int hi )   // v ascending by name, names unique
+	{
+		if( lo >= hi ) return NameMapRef();
+		const int mid = (lo + hi) / 2;
+		return NameMk( NameBuild(v, lo, mid), v[mid].name, v[mid].ids, NameBuild(v, mid+1, hi) );
+	}
+	struct ParamEntry { std::string key; NodeId id; };
+	ParamMapRef ParamBuild( const std::vector<ParamEntry>& v, int lo, int hi )   // v ascending by key, keys unique
+	{
+		if( lo >= hi ) return ParamMapRef();
+		const int mid = (lo + hi) / 2;
+		return ParamMk( ParamBuild(v, lo, mid), v[mid].key, v[mid].id, ParamBuild(v, mid+1, hi) );
+	}
+
 	//! Drop `oldChunk`'s param ids from both indices (erase path); push them to
 	//! `inv` (if non-null) -- their durable bindings just died.
 	void DropChunkParams( ParamMapRef& pids, IdMapRef& byId, NodeId chunkId, const NodeRef& oldChunk, std::vector<NodeId>* inv )
@@ -994,38 +1106,73 @@ bool IsNativeV7Document( const Document& doc )
 
 Document ParseToCst( const std::string& bytes )
 {
-	std::vector<RawTok> t = Tokenize( bytes );
-	size_t i = 0;
+	// A large text is cut at chunk boundaries into regions of at least
+	// PARSE_REGION_BYTES, a few per pool worker, and the regions are parsed
+	// on the thread pool.  Concatenated in document order their items are
+	// exactly what one pass over the whole text gives (FindRegionSplits).
 	std::vector<NodeRef> items;
-	while( i < t.size() ) {
-		if( t[i].trivia ) { items.push_back( Leaf(NodeKind::Trivia, t[i++].text, "") ); continue; }
-		// A chunk is `keyword {` (brace may be on the next line). A bare word not
-		// followed by `{` -- e.g. each token of the `RISE ASCII SCENE 7` header --
-		// is preserved losslessly as a stray Token, NOT swallowed as a never-closed
-		// chunk. (A dedicated version-header node is a later item.)
-		size_t j = i + 1;
-		while( j < t.size() && t[j].trivia ) ++j;
-		if( j < t.size() && !t[j].trivia && t[j].text == "{" ) items.push_back( ParseChunk( t, i ) );
-		else items.push_back( Leaf(NodeKind::Token, t[i++].text, "stray") );
+	std::vector<size_t> splits;
+	if( bytes.size() >= 2 * PARSE_REGION_BYTES ) {
+		const size_t perWorker = bytes.size() / ( 4 * (size_t)std::max( Implementation::GlobalThreadPool().NumWorkers(), 1u ) );
+		splits = FindRegionSplits( bytes.data(), bytes.size(), std::max( perWorker, PARSE_REGION_BYTES ) );
+	}
+	if( splits.empty() ) {
+		ParseItems( bytes.data(), bytes.size(), items );
+	} else {
+		std::vector< std::vector<NodeRef> > regionItems( splits.size() + 1 );
+		Implementation::GlobalThreadPool().ParallelFor( (unsigned int)regionItems.size(), [&]( unsigned int r )
+		{
+			const size_t begin = ( r == 0 ) ? 0 : splits[r-1];
+			const size_t end = ( r < splits.size() ) ? splits[r] : bytes.size();
+			ParseItems( bytes.data() + begin, end - begin, regionItems[r] );
+		} );
+		size_t total = 0;
+		for( const auto& ri : regionItems ) total += ri.size();
+		items.reserve( total );
+		for( auto& ri : regionItems ) items.insert( items.end(), ri.begin(), ri.end() );
 	}
+
 	Document d;
 	d.items = SeqBuild( items, 0, (int)items.size() );
 	// item 4: fresh NodeIds 1..N in lockstep (the identity side-map) + name index
-	// + the NodeId -> node reverse index.
-	std::vector<NodeId> ids; std::vector<std::int64_t> labels;
-	for( int k = 0; k < (int)items.size(); ++k ) {
-		NodeId id = (NodeId)( k + 1 );
-		std::int64_t label = (std::int64_t)( k + 1 ) * LABEL_GAP;       // evenly-spaced order labels
-		ids.push_back( id ); labels.push_back( label );
-		d.byId = IdMapSet( d.byId, id, items[k], label );
+	// + the NodeId -> node reverse index, then per-param occurrence ids N+1...
+	// Every key is known here, so each index is bulk-built (see IdMapBuild).
+	const int numItems = (int)items.size();
+	std::vector<NodeId> ids( numItems ); std::vector<std::int64_t> labels( numItems );
+	std::vector<IdMapEntry> byId; byId.reserve( numItems );
+	std::vector< std::pair<std::string, NodeId> > names;
+	for( int k = 0; k < numItems; ++k ) {
+		ids[k] = (NodeId)( k + 1 );
+		labels[k] = (std::int64_t)( k + 1 ) * LABEL_GAP;       // evenly-spaced order labels
+		byId.push_back( IdMapEntry{ ids[k], items[k], labels[k] } );
 		std::string np = ChunkNamePath( items[k] );
-		if( !np.empty() ) d.byName = NameInsert( d.byName, np, id );
+		if( !np.empty() ) names.push_back( std::make_pair( std::move(np), ids[k] ) );
 		if( items[k]->kind == NodeKind::Chunk && items[k]->role == "instance_array" ) ++d.instanceArrayCount;   // P1-A: the O(1) incremental-refuse signal
 	}
-	d.idseq  = IdBuild( ids, labels, 0, (int)ids.size() );
-	d.nextId = (NodeId)items.size() + 1;
-	for( int k = 0; k < (int)items.size(); ++k )
-		AddChunkParams( d.paramIds, d.byId, ids[k], items[k], d.nextId );   // per-param occurrence ids
+	d.idseq  = IdBuild( ids, labels, 0, numItems );
+	d.nextId = (NodeId)numItems + 1;
+
+	std::vector<ParamEntry> params;
+	for( int k = 0; k < numItems; ++k )
+		for( auto& rp : ChunkParams( items[k] ) ) {
+			const NodeId pid = d.nextId++;
+			params.push_back( ParamEntry{ ParamKey( ids[k], rp.role, rp.occ ), pid } );
+			byId.push_back( IdMapEntry{ pid, rp.node, 0 } );   // ids ascend, so byId stays sorted
+		}
+	std::sort( params.begin(), params.end(), []( const ParamEntry& x, const ParamEntry& y ) { return x.key < y.key; } );
+
+	// A name shared by several chunks keeps its ids in document order, as
+	// NameInsert appends them
+	std::stable_sort( names.begin(), names.end(), []( const std::pair<std::string, NodeId>& x, const std::pair<std::string, NodeId>& y ) { return x.first < y.first; } );
+	std::vector<NameEntry> nameEntries;
+	for( auto& nm : names ) {
+		if( nameEntries.empty() || nameEntries.back().name != nm.first ) nameEntries.push_back( NameEntry{ std::move(nm.first), std::vector<NodeId>() } );
+		nameEntries.back().ids.push_back( nm.second );
+	}
+
+	d.byId     = IdMapBuild( byId, 0, (int)byId.size() );
+	d.byName   = NameBuild( nameEntries, 0, (int)nameEntries.size() );
+	d.paramIds = ParamBuild( params, 0, (int)params.size() );
 	return d;
 }
 
@@ -1311,13 +1458,95 @@ static bool DropChunkByCategory( IJob& pJob, ChunkCategory cat, const char* name
 	}
 }
 
+//! `instance_array` with `compact true`: instead of count_u*count_v standard_objects, ONE instance array
+//! geometry `name.instances` (a packed 3x4 transform per instance over the shared template, with its own
+//! BVH -- see InstanceArrayGeometry) placed by ONE standard_object `name`.  Only the transform params
+//! (position / orientation / scale / matrix, same precedence and composition as standard_object) are
+//! evaluated per instance; everything else is shared by every instance, so it is evaluated once and a
+//! value that would differ between instances (an expr over i/j/u/v) refuses rather than silently taking
+//! the first instance's value.  `quaternion` is refused (use `matrix`).  The array must not be placed
+//! through the object's own position/orientation/scale -- those are the per-instance transforms.
+static bool ExpandCompactInstanceArray( const std::string& name, const std::string& templ, const int countU, const int countV,
+                                        const std::vector<std::pair<std::string,std::string> >& pass, const LetBindings& lets,
+                                        const IAsciiChunkParser* stdObj, IJob& pJob, std::vector<std::string>& diags, int& made )
+{
+	made = 0;
+	const ChunkDescriptor& desc = stdObj->Describe();
+	auto isTransform = []( const std::string& pn ) { return pn == "position" || pn == "orientation" || pn == "scale" || pn == "matrix"; };
+	for( const std::pair<std::string,std::string>& op : pass )
+		if( op.first == "quaternion" ) { diags.push_back( "instance_array '" + name + "': compact arrays take `matrix` or position/orientation/scale, not `quaternion`" ); return false; }
+
+	const size_t count = (size_t)countU * (size_t)countV;
+	std::vector<double> matrices( count * 16 );
+	for( int j = 0; j < countV; ++j ) {
+		for( int i = 0; i < countU; ++i ) {
+			const double u = ( countU > 1 ) ? (double)i / (double)( countU - 1 ) : 0.0;
+			const double v = ( countV > 1 ) ? (double)j / (double)( countV - 1 ) : 0.0;
+			IAsciiChunkParser::ParamsList plist;
+			plist.push_back( String( ( std::string( "geometry " ) + templ ).c_str() ) );
+			for( const std::pair<std::string,std::string>& op : pass ) {
+				if( !isTransform( op.first ) ) continue;
+				std::string ev, e;
+				if( !EvalInstanceValue( op.second, lets, i, j, u, v, ev, e ) ) {
+					char where[64]; std::snprintf( where, sizeof(where), "[%d,%d]", i, j );
+					diags.push_back( "instance_array '" + name + "' " + where + ": " + op.first + " " + e ); return false;
+				}
+				plist.push_back( String( ( op.first + " " + ev ).c_str() ) );
+			}
+			ParseStateBag bag( &desc );
+			if( !DispatchChunkParameters( desc, bag, plist ) ) { diags.push_back( "instance_array '" + name + "': an instance has invalid transform params (see log)" ); return false; }
+
+			double* M = &matrices[ ( (size_t)j * countU + i ) * 16 ];
+			if( !bag.GetMat4( "matrix", M ) ) {
+				// Transformable's composition: Position * XRot*YRot*ZRot * Stretch
+				double pos[3] = {0,0,0}, orient[3] = {0,0,0}, scale[3] = {1,1,1};
+				bag.GetVec3( "position", pos );
+				bag.GetVec3( "orientation", orient );
+				bag.GetVec3( "scale", scale );
+				const Matrix4 mx = Matrix4Ops::Translation( Vector3( pos[0], pos[1], pos[2] ) ) *
+					Matrix4Ops::XRotation( orient[0]*DEG_TO_RAD ) * Matrix4Ops::YRotation( orient[1]*DEG_TO_RAD ) * Matrix4Ops::ZRotation( orient[2]*DEG_TO_RAD ) *
+					Matrix4Ops::Stretch( Vector3( scale[0], scale[1], scale[2] ) );
+				M[ 0] = mx._00; M[ 1] = mx._01; M[ 2] = mx._02; M[ 3] = mx._03;
+				M[ 4] = mx._10; M[ 5] = mx._11; M[ 6] = mx._12; M[ 7] = mx._13;
+				M[ 8] = mx._20; M[ 9] = mx._21; M[10] = mx._22; M[11] = mx._23;
+				M[12] = mx._30; M[13] = mx._31; M[14] = mx._32; M[15] = mx._33;
+			}
+		}
+	}
+
+	const std::string geomName = name + ".instances";
+	if( !pJob.AddInstanceArrayGeometry( geomName.c_str(), templ.c_str(), (unsigned int)count, count ? &matrices[0] : 0 ) ) {
+		diags.push_back( "instance_array '" + name + "': could not create the instance array geometry (template geometry missing?)" );
+		return false;
+	}
+
+	IAsciiChunkParser::ParamsList plist;
+	plist.push_back( String( ( std::string( "name " ) + name ).c_str() ) );
+	plist.push_back( String( ( std::string( "geometry " ) + geomName ).c_str() ) );
+	for( const std::pair<std::string,std::string>& op : pass ) {
+		if( isTransform( op.first ) ) continue;
+		std::string first, last, e;
+		if( !EvalInstanceValue( op.second, lets, 0, 0, 0.0, 0.0, first, e ) ||
+			!EvalInstanceValue( op.second, lets, countU-1, countV-1, countU > 1 ? 1.0 : 0.0, countV > 1 ? 1.0 : 0.0, last, e ) ) {
+			diags.push_back( "instance_array '" + name + "': " + op.first + " " + e ); return false;
+		}
+		if( first != last ) { diags.push_back( "instance_array '" + name + "': " + op.first + " varies per instance, which a compact array cannot do (every instance shares it)" ); return false; }
+		plist.push_back( String( ( op.first + " " + first ).c_str() ) );
+	}
+	ParseStateBag bag( &desc );
+	if( !DispatchChunkParameters( desc, bag, plist ) ) { diags.push_back( "instance_array '" + name + "': the synthesized standard_object has invalid params (see log)" ); return false; }
+	if( !stdObj->Finalize( bag, pJob ) ) { diags.push_back( "instance_array '" + name + "': object Finalize failed (a referenced material missing, or the name taken?)" ); return false; }
+	made = 1;
+	return true;
+}
+
 //! #5 slice 4: expand an `instance_array` generator (§2.6.1) into N standard_objects.  The generator
 //! is NOT an engine entity -- the CST stores it; DeriveToJob expands it here (the canonical derive)
 //! AFTER the normal entities so the template geometry + referenced materials exist.  Params: name +
 //! template (-> the object's geometry) + count_u (+ optional count_v, default 1); EVERY OTHER param
 //! (material / position / orientation / scale / ...) is passed through to each object with PER-COMPONENT
 //! expr eval (instance vars: i,j indices; u=i/(count_u-1), v=j/(count_v-1) in [0,1]).  Each object is
-//! named `name[i,j]`.  Errors are apply-time (a partial apply, like DeriveToJob's other Finalize
+//! named `name[i,j]`; `compact true` instead makes one instance array (ExpandCompactInstanceArray).  Errors are apply-time (a partial apply, like DeriveToJob's other Finalize
 //! failures); the editor's incremental re-expansion + the generated objects' reference-graph tracing are
 //! deferred (Facet-2).  Because the static graph SKIPS instance_array (not a registry chunk), editing the
 //! array's TEMPLATE geometry / a referenced MATERIAL / a painter is NOT traced to the array (the closure
@@ -1328,7 +1557,7 @@ static bool ExpandInstanceArray( const NodeRef& chunk, const LetBindings& lets,
                                  IJob& pJob, std::vector<std::string>& diags, int& made )
 {
 	made = 0;
-	std::string name, templ, countU_raw, countV_raw;
+	std::string name, templ, countU_raw, countV_raw, compact_raw;
 	std::vector<std::pair<std::string,std::string> > pass;   // params passed through to each generated object
 	for( const NodeRef& kid : chunk->kids ) {
 		if( kid->kind != NodeKind::Param ) continue;
@@ -1342,6 +1571,7 @@ static bool ExpandInstanceArray( const NodeRef& chunk, const LetBindings& lets,
 		else if( pn == "template" ) templ = pv;
 		else if( pn == "count_u" ) countU_raw = pv;
 		else if( pn == "count_v" ) countV_raw = pv;
+		else if( pn == "compact" ) compact_raw = pv;
 		else pass.push_back( std::make_pair( pn, pv ) );
 	}
 	if( name.empty() )       { diags.push_back( "instance_array: needs a `name`" ); return false; }
@@ -1371,6 +1601,8 @@ static bool ExpandInstanceArray( const NodeRef& chunk, const LetBindings& lets,
 	const int countV = countV_raw.empty() ? 1 : evalCount( countV_raw, "count_v" );
 	if( !countOk ) return false;
 	if( (long long)countU * (long long)countV > 10000000LL ) { diags.push_back( "instance_array '" + name + "': count_u*count_v exceeds 10,000,000 instances" ); return false; }
+	if( !compact_raw.empty() && String( compact_raw.c_str() ).toBoolean() )
+		return ExpandCompactInstanceArray( name, templ, countU, countV, pass, lets, stdObj, pJob, diags, made );
 	IJobPriv* priv = dynamic_cast<IJobPriv*>( &pJob );          // collision pre-check: emit a generator-localized diagnostic
 	IObjectManager* objMgr = priv ? priv->GetObjects() : 0;     // (names the exact generated index that clashes) BEFORE building
 	                                                            // the synthesized object.  Job::AddObject now also rejects a
@@ -688,6 +688,253 @@ int Polynomial::SolveQuartic( const Scalar (&coeff)[ 5 ], Scalar (&sol)[ 4 ] )
 	return num;
 }
 
+//////////////////////////////////////////////////////////////////////
+// Interval solvers for intersection kernels.
+//
+//   A ray kernel usually knows the window its roots must lie in (the
+//   span of a bounding sphere, the [0,1] parameter range of a patch),
+//   and wants only the roots inside it.  Rather than factor the whole
+//   polynomial, these split the window at the roots of the derivative
+//   -- found the same way, one degree down, ending at a closed-form
+//   quadratic -- so that the polynomial is monotone on every piece.  A
+//   piece whose end values differ in sign holds exactly one root, which
+//   a Newton iteration kept inside the shrinking bracket finds to
+//   within a few ulps; a step that would leave the bracket becomes a
+//   bisection.  (Yuksel, "High-Performance Polynomial Root Finding for
+//   Graphics", HPG 2022.)
+//
+//   There is no trigonometry, no cube root and no 4x4 refinement, the
+//   fixed-degree Horner loops unroll, and the bracket update is a
+//   select, so the work per piece is a handful of multiply-adds.  The
+//   roots come out sorted.  A double root that only touches zero has
+//   no sign change around it and is reported only if the polynomial
+//   lands exactly on zero there; for a ray that is a graze.
+//////////////////////////////////////////////////////////////////////
+namespace
+{
+	// Horner evaluation, leading coefficient first
+	template< int N >
+	inline Scalar EvaluatePolynomial( const Scalar* c, const Scalar x )
+	{
+		Scalar r = c[0];
+		for( int i = 1; i <= N; i++ ) {
+			r = r * x + c[i];
+		}
+		return r;
+	}
+
+	// Relative accuracy the roots, and the critical points that split
+	// them, are found to.  The critical points need it as much as the
+	// roots: near a double root a misplaced extremum leaves the sign
+	// change on the wrong side of the split.
+	static const Scalar ROOT_TOL = 2.0 * DBL_EPSILON;
+
+	// The single root of a degree N polynomial on [x0,x1], over which it
+	// is monotone and changes sign, to ROOT_TOL
+	template< int N >
+	Scalar MonotoneRoot(
+		const Scalar* c,
+		const Scalar x0,
+		const Scalar y0,
+		const Scalar x1,
+		const Scalar y1
+		)
+	{
+		// lo keeps the negative end and hi the other, whichever side of
+		// each other they are
+		Scalar lo = ( y0 < 0 ) ? x0 : x1;
+		Scalar hi = ( y0 < 0 ) ? x1 : x0;
+		const Scalar absTol = 0.5e-3 * ROOT_TOL * ( fabs( x0 ) + fabs( x1 ) );
+
+		// Start from the secant through the ends, which is inside the
+		// bracket by construction
+		Scalar x = x0 - y0 * ( x1 - x0 ) / ( y1 - y0 );
+		if( !IsFiniteDouble( x ) || x <= fmin( x0, x1 ) || x >= fmax( x0, x1 ) ) {
+			x = 0.5 * ( x0 + x1 );
+		}
+
+		for( int iter = 0; iter < 100; iter++ ) {
+			// Horner for the value and the derivative together, alongside
+			// the same recurrence on the magnitudes, which bounds the
+			// rounding error in the value
+			Scalar y = c[0];
+			Scalar dy = 0;
+			Scalar mag = fabs( c[0] );
+			const Scalar ax = fabs( x );
+			for( int i = 1; i <= N; i++ ) {
+				dy = dy * x + y;
+				y = y * x + c[i];
+				mag = mag * ax + fabs( c[i] );
+			}
+			// Past this the sign of y is noise and Newton only wanders
+			if( fabs( y ) <= DBL_EPSILON * mag ) {
+				return x;
+			}
+			lo = ( y < 0 ) ? x : lo;
+			hi = ( y < 0 ) ? hi : x;
+
+			// A Newton step that would leave the bracket, or a flat
+			// derivative, bisects instead
+			Scalar xn = ( dy != 0 ) ? x - y / dy : lo;
+			if( ( xn - lo ) * ( xn - hi ) >= 0 ) {
+				xn = 0.5 * ( lo + hi );
+			}
+
+			if( fabs( xn - x ) <= ROOT_TOL * fabs( xn ) + absTol ) {
+				return xn;
+			}
+			x = xn;
+		}
+
+		return 0.5 * ( lo + hi );
+	}
+
+	// Walks [min,max] split at the sorted critical points crit, and
+	// brackets the root on each piece that changes sign
+	template< int N >
+	int RootsOfMonotonePieces(
+		const Scalar* c,
+		const Scalar* crit,
+		const int numCrit,
+		const Scalar min,
+		const Scalar max,
+		Scalar* sol
+		)
+	{
+		int num = 0;
+		Scalar x0 = min;
+		Scalar y0 = EvaluatePolynomial<N>( c, min );
+		if( y0 == 0 ) {
+			sol[num++] = min;
+		}
+		for( int i = 0; i <= numCrit && num < N; i++ ) {
+			const Scalar x1 = ( i < numCrit ) ? crit[i] : max;
+			const Scalar y1 = EvaluatePolynomial<N>( c, x1 );
+			// An end that lands exactly on zero is the root of the piece
+			// (and, at a critical point, a double root counted once)
+			if( y1 == 0 ) {
+				if( num == 0 || sol[num-1] != x1 ) {
+					sol[num++] = x1;
+				}
+			} else if( y0 != 0 && ( y0 < 0 ) != ( y1 < 0 ) ) {
+				sol[num++] = MonotoneRoot<N>( c, x0, y0, x1, y1 );
+			}
+			x0 = x1;
+			y0 = y1;
+		}
+		return num;
+	}
+
+	// Real roots of a x^2 + b x + c within [min,max], in increasing order
+	int QuadraticRootsWithinInterval( const Scalar a, const Scalar b, const Scalar c, Scalar (&sol)[ 2 ], const Scalar min, const Scalar max )
+	{
+		Scalar r[2];
+		int n = 0;
+		if( a == 0 ) {
+			if( b != 0 ) {
+				r[n++] = -c / b;
+			}
+		} else {
+			const Scalar d = b * b - 4.0 * a * c;
+			if( d >= 0 ) {
+				// Vieta-stable pair: the larger-magnitude root directly,
+				// the other from the product of the roots
+				const Scalar q = -0.5 * ( b + copysign( sqrt( d ), b ) );
+				r[n++] = q / a;
+				if( q != 0 ) {
+					r[n++] = c / q;
+				}
+				if( n == 2 && r[1] < r[0] ) {
+					const Scalar t = r[0]; r[0] = r[1]; r[1] = t;
+				}
+			}
+		}
+
+		int num = 0;
+		for( int i = 0; i < n; i++ ) {
+			if( r[i] >= min && r[i] <= max ) {
+				sol[num++] = r[i];
+			}
+		}
+		return num;
+	}
+
+	// Cubic roots within [min,max], for coefficients already known to be
+	// finite
+	int CubicRootsWithinInterval( const Scalar (&coeff)[ 4 ], Scalar (&sol)[ 3 ], const Scalar min, const Scalar max )
+	{
+		if( IsReallyZero( coeff[0] ) ) {
+			Scalar sols[2];
+			const int n = QuadraticRootsWithinInterval( coeff[1], coeff[2], coeff[3], sols, min, max );
+			for( int i = 0; i < n; i++ ) sol[i] = sols[i];
+			return n;
+		}
+
+		const Scalar dc[3] = { 3.0 * coeff[0], 2.0 * coeff[1], coeff[2] };
+		Scalar crit[2];
+		const int numCrit = QuadraticRootsWithinInterval( dc[0], dc[1], dc[2], crit, min, max );
+
+		return RootsOfMonotonePieces<3>( coeff, crit, numCrit, min, max, sol );
+	}
+
+	template< int N >
+	bool AllFinite( const Scalar (&coeff)[ N ], const Scalar min, const Scalar max )
+	{
+		for( int i = 0; i < N; i++ ) {
+			if( !IsFiniteDouble( coeff[i] ) ) return false;
+		}
+		return IsFiniteDouble( min ) && IsFiniteDouble( max );
+	}
+
+	bool AllFinite( const Scalar* sol, const int num )
+	{
+		for( int i = 0; i < num; i++ ) {
+			if( !IsFiniteDouble( sol[i] ) ) return false;
+		}
+		return true;
+	}
+}
+
+int Polynomial::SolveCubicWithinInterval( const Scalar (&coeff)[ 4 ], Scalar (&sol)[ 3 ], const Scalar min, const Scalar max )
+{
+	if( !AllFinite( coeff, min, max ) ) {
+		return -1;
+	}
+	if( min > max ) {
+		return 0;
+	}
+
+	const int num = CubicRootsWithinInterval( coeff, sol, min, max );
+	return AllFinite( sol, num ) ? num : -1;
+}
+
+int Polynomial::SolveQuarticWithinInterval( const Scalar (&coeff)[ 5 ], Scalar (&sol)[ 4 ], const Scalar min, const Scalar max )
+{
+	if( !AllFinite( coeff, min, max ) ) {
+		return -1;
+	}
+	if( min > max ) {
+		return 0;
+	}
+
+	if( IsReallyZero( coeff[0] ) ) {
+		const Scalar coeffs[4] = { coeff[1], coeff[2], coeff[3], coeff[4] };
+		Scalar sols[3];
+		const int n = CubicRootsWithinInterval( coeffs, sols, min, max );
+		for( int i = 0; i < n; i++ ) sol[i] = sols[i];
+		return AllFinite( sol, n ) ? n : -1;
+	}
+
+	// The critical points are the roots of the derivative cubic in the
+	// same window
+	const Scalar dc[4] = { 4.0 * coeff[0], 3.0 * coeff[1], 2.0 * coeff[2], coeff[3] };
+	Scalar crit[3];
+	const int numCrit = CubicRootsWithinInterval( dc, crit, min, max );
+
+	const int num = RootsOfMonotonePieces<4>( coeff, crit, numCrit, min, max, sol );
+	return AllFinite( sol, num ) ? num : -1;
+}
+
 Scalar Polynomial::bessi0( Scalar x )
 {
 	const Scalar ax = fabs(x);
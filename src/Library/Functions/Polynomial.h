@@ -50,6 +50,33 @@ namespace RISE
 			Scalar (&sol)[ 4 ]						///< [out] Solutions
 			);
 
+		//! Solves a cubic function for the real roots within [min,max]
+		//! by splitting the interval at the critical points and running
+		//! a bracketed Newton search on each monotone piece.  Allocation
+		//! free; meant for intersection kernels that know where their
+		//! roots can lie.
+		/// \return Number of solutions in increasing order, or -1 if the
+		/// coefficients or the search went non-finite, in which case the
+		/// caller should fall back to SolveCubic
+		static int SolveCubicWithinInterval(
+			const Scalar (&coeff)[ 4 ],				///< [in] Coefficients
+			Scalar (&sol)[ 3 ],						///< [out] Solutions
+			const Scalar min,						///< [in] Minimum value
+			const Scalar max						///< [in] Maximum value
+			);
+
+		//! Solves a quartic function for the real roots within [min,max],
+		//! the same way as SolveCubicWithinInterval
+		/// \return Number of solutions in increasing order, or -1 if the
+		/// coefficients or the search went non-finite, in which case the
+		/// caller should fall back to SolveQuartic
+		static int SolveQuarticWithinInterval(
+			const Scalar (&coeff)[ 5 ],				///< [in] Coefficients
+			Scalar (&sol)[ 4 ],						///< [out] Solutions
+			const Scalar min,						///< [in] Minimum value
+			const Scalar max						///< [in] Maximum value
+			);
+
 		//! Finds the root of a given polynomial within a given range
 		/// \return TRUE if there is a solution, FALSE otherwise
 		static bool SolvePolynomialWithinRange( 
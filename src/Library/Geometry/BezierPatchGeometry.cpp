@@ -27,42 +27,41 @@ using namespace RISE::Implementation;
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////
 //
-// BezierPatch specialization required for the octree
+// BezierPatch specialization required for the BVH
 //
 /////////////////////////////////////////////////////////////////////////////////////////////////////
 
 bool BezierPatchGeometry::ElementBoxIntersection( const MYOBJ elem, const BoundingBox& bbox ) const
 {
-	return bbox.DoIntersect( elem.bbox );
+	return bbox.DoIntersect( elem->bbox );
 }
 
 BoundingBox BezierPatchGeometry::GetElementBoundingBox( const MYOBJ elem ) const
 {
-	return elem.bbox;
+	return elem->bbox;
 }
 
 char BezierPatchGeometry::WhichSideofPlaneIsElement( const MYOBJ elem, const Plane& plane ) const
 {
-	return GeometricUtilities::WhichSideOfPlane( plane, elem.bbox );
+	return GeometricUtilities::WhichSideOfPlane( plane, elem->bbox );
 }
 
 void BezierPatchGeometry::RayElementIntersection( RayIntersectionGeometric& ri, const MYOBJ elem, const bool bHitFrontFaces, const bool bHitBackFaces ) const
 {
 	BOX_HIT	h;
-	RayBoxIntersection( ri.ray, h, elem.bbox.ll, elem.bbox.ur );
+	RayBoxIntersection( ri.ray, h, elem->bbox.ll, elem->bbox.ur );
 
 	if( !h.bHit ) return;
 	// Per-element front-to-back pruning: if the bbox entry distance is already
-	// beyond the closest hit, skip.  Currently often dead because BSPTreeSAHNode
-	// creates a fresh RayIntersection per element (so ri.bHit is false on entry)
-	// — harmless as-is, becomes effective if that allocation is ever removed.
+	// beyond the closest hit, skip.  The BVH hands every leaf element the
+	// same running `ri`, so this prunes the patches behind the closest hit.
 	if( ri.bHit && h.dRange > ri.range ) return;
 
 	BEZIER_HIT bh;
 	// Seed hit.dRange with the current closest-hit distance so the analytic
 	// solver can reject far (u*,v*) roots immediately inside AccumulateRoot.
 	bh.dRange = ri.range;
-	RayBezierPatchIntersection( ri.ray, bh, *elem.pPatch );
+	RayBezierPatchIntersection( ri.ray, bh, *elem->pPatch );
 
 	if( !bh.bHit || bh.dRange >= ri.range ) return;
 
@@ -70,7 +69,7 @@ void BezierPatchGeometry::RayElementIntersection( RayIntersectionGeometric& ri,
 	// sign) is a parameterisation choice that varies patch-to-patch in the
 	// Utah teapot file — some patches are traversed CCW, others CW — so flip
 	// against the incoming ray to produce a consistent facing normal.
-	Vector3 N = GeometricUtilities::BezierPatchNormalAt( *elem.pPatch, bh.u, bh.v );
+	Vector3 N = GeometricUtilities::BezierPatchNormalAt( *elem->pPatch, bh.u, bh.v );
 	Scalar nLen = Vector3Ops::Magnitude( N );
 	if( nLen < 1e-20 ) return;                  // degenerate (coincident tangents)
 	N = N * ( 1.0 / nLen );
@@ -107,7 +106,7 @@ void BezierPatchGeometry::RayElementIntersection( RayIntersection& ri, const MYO
 bool BezierPatchGeometry::RayElementIntersection_IntersectionOnly( const Ray& ray, const Scalar dHowFar, const MYOBJ elem, const bool bHitFrontFaces, const bool bHitBackFaces ) const
 {
 	BOX_HIT	h;
-	RayBoxIntersection( ray, h, elem.bbox.ll, elem.bbox.ur );
+	RayBoxIntersection( ray, h, elem->bbox.ll, elem->bbox.ur );
 
 	if( !h.bHit ) return false;
 
@@ -116,7 +115,7 @@ bool BezierPatchGeometry::RayElementIntersection_IntersectionOnly( const Ray& ra
 	// Seeding hit.dRange = dHowFar lets AccumulateRoot reject any root
 	// beyond the light's distance without running Newton + patch-eval on it.
 	bh.dRange = dHowFar;
-	RayBezierPatchIntersection( ray, bh, *elem.pPatch );
+	RayBezierPatchIntersection( ray, bh, *elem->pPatch );
 	if( !bh.bHit ) return false;
 	// AccumulateRoot already applies the Bezier self-hit epsilon when
 	// populating bh.dRange, so no second NEARZERO gate is needed here.
@@ -124,7 +123,7 @@ bool BezierPatchGeometry::RayElementIntersection_IntersectionOnly( const Ray& ra
 
 	// Apply face culling on shadow rays too so self-shadowing respects
 	// the same sidedness policy as primary rays.
-	Vector3 N = GeometricUtilities::BezierPatchNormalAt( *elem.pPatch, bh.u, bh.v );
+	Vector3 N = GeometricUtilities::BezierPatchNormalAt( *elem->pPatch, bh.u, bh.v );
 	if( Vector3Ops::SquaredModulus( N ) < 1e-40 ) return false;
 	const Scalar dotND = Vector3Ops::Dot( N, ray.Dir() );
 	const bool bHitFront = ( dotND < 0.0 );
@@ -143,23 +142,14 @@ void BezierPatchGeometry::DeserializeElement( IReadBuffer& buffer, MYOBJ& ret )
 	//@ TODO : to be implemented
 }
 
-BezierPatchGeometry::BezierPatchGeometry(
-	const unsigned int max_patches_per_node,
-	const unsigned char max_recursion_level,
-	const bool bUseBSP_
-	) :
-  pBSPTree( 0 ),
-  pOctree( 0 ),
-  nMaxPerOctantNode( max_patches_per_node ),
-  nMaxRecursionLevel( max_recursion_level ),
-  bUseBSP( bUseBSP_ )
+BezierPatchGeometry::BezierPatchGeometry( ) :
+  pBVH( 0 )
 {
 }
 
 BezierPatchGeometry::~BezierPatchGeometry( )
 {
-	safe_release( pBSPTree );
-	safe_release( pOctree );
+	safe_release( pBVH );
 }
 
 void BezierPatchGeometry::AddPatch( const BezierPatch& patch )
@@ -167,49 +157,64 @@ void BezierPatchGeometry::AddPatch( const BezierPatch& patch )
 	patches.push_back( patch );
 }
 
-void BezierPatchGeometry::Prepare()
+void BezierPatchGeometry::BuildPatchElements()
 {
-	// Prepare for rendering
-	// Optimize the patch container
-	stl_utils::container_optimize< BezierPatchList >( patches );
+	patchptrs.clear();
+	patchptrs.reserve( patches.size() );
 
-	// First create the pointer patches list
-	BezierPatchPtrList		patchptrs;
-	patchptrs.reserve( patches.size() );		// Points to all the bezier patches
-
-	BoundingBox overall( Point3(RISE_INFINITY,RISE_INFINITY,RISE_INFINITY), Point3(-RISE_INFINITY,-RISE_INFINITY,-RISE_INFINITY) );
 	for( unsigned int i=0; i<patches.size(); i++ ) {
-		BezierPatch* b = &patches[i];
 		MYBEZIERPATCH m;
-		m.pPatch = b;
+		m.pPatch = &patches[i];
 		m.id = i;
-		m.bbox = GeometricUtilities::BezierPatchBoundingBox( *b );
-		// Bbox-grow for displacement is the wrapper's job (DisplacedGeometry
-		// owns its own internal TriangleMeshGeometryIndexed and generates
-		// its own bbox from the post-displacement vertices).
-		overall.Include( m.bbox );
+		// Two levels of subdivision (16 sub-hulls) shrink the convex-hull
+		// box to close to the surface's own extent on curved patches,
+		// which is what lets the BVH cull them.  Bbox-grow for
+		// displacement is the wrapper's job (DisplacedGeometry owns its
+		// own internal TriangleMeshGeometryIndexed and generates its own
+		// bbox from the post-displacement vertices).
+		m.bbox = GeometricUtilities::BezierPatchSubdividedBoundingBox( patches[i], 2 );
 		patchptrs.push_back( m );
 	}
+}
 
-	// We're done so stuff all the bezier patches into the bsp-tree
-	safe_release( pBSPTree );
-	safe_release( pOctree );
+// An analytic patch test costs far more than a box test, so the SAH is
+// told so and splits down to smaller leaves than a mesh's.  Sidedness is
+// decided per hit in RayElementIntersection.
+static AccelerationConfig PatchBVHConfig()
+{
+	AccelerationConfig cfg;
+	cfg.maxLeafSize            = 4;
+	cfg.binCount               = 32;
+	cfg.sahTraversalCost       = 1.0;
+	cfg.sahIntersectionCost    = 8.0;
+	cfg.doubleSided            = true;
+	return cfg;
+}
 
-	if( bUseBSP ) {
-		pBSPTree = new BSPTreeSAH<MYBEZIERPATCH>( *this, overall, nMaxPerOctantNode );
-		GlobalLog()->PrintNew( pBSPTree, __FILE__, __LINE__, "bezier patches bsptree" );
+void BezierPatchGeometry::BuildBVH()
+{
+	safe_release( pBVH );
 
-		pBSPTree->AddElements( patchptrs, nMaxRecursionLevel );
+	BoundingBox overall( Point3(RISE_INFINITY,RISE_INFINITY,RISE_INFINITY), Point3(-RISE_INFINITY,-RISE_INFINITY,-RISE_INFINITY) );
+	std::vector<const MYBEZIERPATCH*> temp;
+	temp.reserve( patchptrs.size() );
+	for( BezierPatchPtrList::const_iterator i=patchptrs.begin(); i!=patchptrs.end(); i++ ) {
+		overall.Include( i->bbox );
+		temp.push_back( &(*i) );
+	}
 
-//		pBSPTree->DumpStatistics( eLog_Info );
-	} else {
-		pOctree = new Octree<MYBEZIERPATCH>( *this, overall, nMaxPerOctantNode );
-		GlobalLog()->PrintNew( pOctree, __FILE__, __LINE__, "bezier patches octree" );
+	pBVH = new BVH<const MYBEZIERPATCH*>( *this, temp, overall, PatchBVHConfig() );
+	GlobalLog()->PrintNew( pBVH, __FILE__, __LINE__, "bezier patches BVH" );
+}
 
-		pOctree->AddElements( patchptrs, nMaxRecursionLevel );
+void BezierPatchGeometry::Prepare()
+{
+	// Prepare for rendering
+	// Optimize the patch container
+	stl_utils::container_optimize< BezierPatchList >( patches );
 
-//		pOctree->DumpStatistics( eLog_Info );
-	}
+	BuildPatchElements();
+	BuildBVH();
 }
 
 bool BezierPatchGeometry::TessellateToMesh(
@@ -263,19 +268,15 @@ bool BezierPatchGeometry::TessellateToMesh(
 
 void BezierPatchGeometry::IntersectRay( RayIntersectionGeometric& ri, const bool bHitFrontFaces, const bool bHitBackFaces, const bool bComputeExitInfo ) const
 {
-	if( pBSPTree ) {
-		pBSPTree->IntersectRay( ri, bHitFrontFaces, bHitBackFaces );
-	} else if( pOctree ) {
-		pOctree->IntersectRay( ri, bHitFrontFaces, bHitBackFaces );
+	if( pBVH ) {
+		pBVH->IntersectRay( ri, bHitFrontFaces, bHitBackFaces );
 	}
 }
 
 bool BezierPatchGeometry::IntersectRay_IntersectionOnly( const Ray& ray, const Scalar dHowFar, const bool bHitFrontFaces, const bool bHitBackFaces ) const
 {
-	if( pBSPTree ) {
-		return pBSPTree->IntersectRay_IntersectionOnly( ray, dHowFar, bHitFrontFaces, bHitBackFaces );
-	} else if( pOctree ) {
-		return pOctree->IntersectRay_IntersectionOnly( ray, dHowFar, bHitFrontFaces, bHitBackFaces );
+	if( pBVH ) {
+		return pBVH->IntersectRay_IntersectionOnly( ray, dHowFar, bHitFrontFaces, bHitBackFaces );
 	}
 
 	return false;
@@ -328,12 +329,10 @@ void BezierPatchGeometry::GenerateBoundingSphere( Point3& ptCenter, Scalar& radi
 
 BoundingBox BezierPatchGeometry::GenerateBoundingBox() const
 {
-	if( bUseBSP && pBSPTree ) {
-		return pBSPTree->GetBBox();
-	} else if( pOctree ) {
-		return pOctree->GetBBox();
+	if( pBVH ) {
+		return pBVH->GetBBox();
 	}
-	
+
 	return BoundingBox();
 }
 
@@ -429,3 +428,116 @@ Scalar BezierPatchGeometry::GetArea( ) const
 	}
 	return total > 0.0 ? total : 1.0;
 }
+
+static const char * szSignature = "RISEBZPG";
+static const unsigned int cur_version = 1;
+//
+// Layout: signature(8) + version(4) + numPatches(4) + 16 control
+// points per patch (48 doubles) + haveBVHCache(1) + (BVH bytes if
+// cached).  The cache flag and BVH are only written for a non-empty
+// patch list, the same symmetric gating as .risemesh v4.  The per-patch
+// bounds are not stored; they are recomputed on load, which is cheap
+// next to the SAH build the cache saves.
+
+void BezierPatchGeometry::Serialize( IWriteBuffer& buffer ) const
+{
+	buffer.setBytes( szSignature, 8 );
+	buffer.setUInt( cur_version );
+
+	buffer.ResizeForMore( static_cast<unsigned int>(sizeof(Scalar)*48*patches.size() + sizeof( unsigned int )) );
+	buffer.setUInt( static_cast<unsigned int>(patches.size()) );
+
+	for( BezierPatchList::const_iterator it = patches.begin(); it != patches.end(); ++it ) {
+		for( int j=0; j<4; j++ ) {
+			for( int k=0; k<4; k++ ) {
+				const Point3& pt = it->c[j].pts[k];
+				buffer.setDouble( pt.x );
+				buffer.setDouble( pt.y );
+				buffer.setDouble( pt.z );
+			}
+		}
+	}
+
+	if( !patches.empty() ) {
+		buffer.ResizeForMore( sizeof( char ) );
+		if( pBVH ) {
+			buffer.setChar( 1 );
+			const MYBEZIERPATCH* base = &patchptrs[0];
+			pBVH->Serialize( buffer,
+				[base]( const MYBEZIERPATCH* p ) -> unsigned int {
+					return (unsigned int)( p - base );
+				} );
+		} else {
+			buffer.setChar( 0 );
+		}
+	}
+}
+
+void BezierPatchGeometry::Deserialize( IReadBuffer& buffer )
+{
+	char sig[9] = {0};
+	buffer.getBytes( sig, 8 );
+
+	if( strcmp( sig, szSignature ) != 0 ) {
+		GlobalLog()->PrintEasyError( "BezierPatchGeometry::Deserialize:: Signature not found" );
+		return;
+	}
+
+	const unsigned int version = buffer.getUInt();
+	if( version < 1 || version > cur_version ) {
+		GlobalLog()->PrintEx( eLog_Error,
+			"BezierPatchGeometry::Deserialize:: Unsupported version %u (this build understands v1..v%u)",
+			version, cur_version );
+		return;
+	}
+
+	safe_release( pBVH );
+	patchptrs.clear();
+	patches.clear();
+
+	const unsigned int numpatches = buffer.getUInt();
+	patches.reserve( numpatches );
+	for( unsigned int i=0; i<numpatches; i++ ) {
+		BezierPatch patch;
+		for( int j=0; j<4; j++ ) {
+			for( int k=0; k<4; k++ ) {
+				patch.c[j].pts[k].x = buffer.getDouble();
+				patch.c[j].pts[k].y = buffer.getDouble();
+				patch.c[j].pts[k].z = buffer.getDouble();
+			}
+		}
+		patches.push_back( patch );
+	}
+
+	GlobalLog()->PrintEx( eLog_Info, "BezierPatchGeometry::Deserialize:: Read %u patches", numpatches );
+
+	BuildPatchElements();
+
+	if( patches.empty() ) {
+		return;
+	}
+
+	if( buffer.getChar() ) {
+		// Empty-input ctor: only the BVH<> shell is wanted, Deserialize
+		// then fills it in
+		std::vector<const MYBEZIERPATCH*> emptyTemp;
+		BoundingBox dummyBox( Point3(0,0,0), Point3(0,0,0) );
+		pBVH = new BVH<const MYBEZIERPATCH*>( *this, emptyTemp, dummyBox, PatchBVHConfig() );
+		GlobalLog()->PrintNew( pBVH, __FILE__, __LINE__, "bezier patches BVH (cache load)" );
+
+		const MYBEZIERPATCH* base = &patchptrs[0];
+		if( pBVH->Deserialize( buffer, (uint32_t)patchptrs.size(),
+				[base]( unsigned int idx ) -> const MYBEZIERPATCH* {
+					return base + idx;
+				} ) ) {
+			GlobalLog()->PrintEx( eLog_Info,
+				"BezierPatchGeometry::Deserialize:: Loaded BVH cache (%u nodes, %u prims)",
+				(unsigned)pBVH->numNodes(), (unsigned)pBVH->numPrims() );
+			return;
+		}
+
+		GlobalLog()->PrintEasyWarning( "BezierPatchGeometry::Deserialize:: BVH cache failed to load; rebuilding" );
+	}
+
+	BuildBVH();
+}
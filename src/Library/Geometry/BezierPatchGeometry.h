@@ -16,17 +16,15 @@
 
 #include "Geometry.h"
 #include "../Interfaces/IBezierPatchGeometry.h"
-#include "../Octree.h"
-#include "../BSPTreeSAH.h"
+#include "../Acceleration/BVH.h"
 #include "../Utilities/BoundingBox.h"
 
 namespace RISE
 {
-	// Element type stored in the per-geometry BSP tree / Octree.  Pairs a
-	// non-owning pointer to the underlying BezierPatch with its index and
-	// precomputed AABB (the Bezier convex-hull bound over 16 control
-	// points).  Equality is id-based so the accelerator's element set
-	// behaves correctly when the same patch lives in multiple BSP leaves.
+	// Element type stored in the per-geometry BVH.  Pairs a non-owning
+	// pointer to the underlying BezierPatch with its index and
+	// precomputed AABB (the union of the control hulls of the patch's
+	// subdivided pieces, see Prepare).
 	struct MYBEZIERPATCH
 	{
 		BezierPatch*				pPatch;
@@ -44,7 +42,7 @@ namespace RISE
 		class BezierPatchGeometry : 
 			public virtual IBezierPatchGeometry,
 			public virtual Geometry,
-			public virtual TreeElementProcessor<MYBEZIERPATCH>
+			public virtual TreeElementProcessor<const MYBEZIERPATCH*>
 		{
 		public:	
 
@@ -52,16 +50,18 @@ namespace RISE
 			typedef std::vector<MYBEZIERPATCH>			BezierPatchPtrList;
 
 		protected:
-			// BSP tree of bezier patches (one accelerator or the other).
-			BSPTreeSAH<MYBEZIERPATCH>*		pBSPTree;
-
-			// Octree of bezier patches (used when bUseBSP is false).
-			Octree<MYBEZIERPATCH>*			pOctree;
+			// BVH over the bezier patches, built by Prepare() or loaded
+			// by Deserialize()
+			BVH<const MYBEZIERPATCH*>*		pBVH;
 
 			BezierPatchList			patches;			// List of bezier patches
-			unsigned int			nMaxPerOctantNode;	// Max patches per accelerator leaf
-			unsigned char			nMaxRecursionLevel;	// Max accelerator recursion depth
-			bool					bUseBSP;			// BSP tree (true) or Octree (false)?
+			BezierPatchPtrList		patchptrs;			// One BVH element per patch; must not reallocate once the BVH exists
+
+			// Fills patchptrs with the tight per-patch bounds
+			void BuildPatchElements();
+
+			// Builds the BVH over patchptrs from scratch
+			void BuildBVH();
 
 			virtual ~BezierPatchGeometry( );
 
@@ -73,11 +73,9 @@ namespace RISE
 			// mesh wrap this geometry in a DisplacedGeometry (with
 			// disp_scale=0 / displacement=none for a pure-tessellation path).
 			// Displacement itself is also owned by DisplacedGeometry.
-			BezierPatchGeometry(
-				const unsigned int max_patches_per_node,
-				const unsigned char max_recursion_level,
-				const bool bUseBSP
-				);
+			// The BVH is the only patch accelerator, so the old BSP/octree
+			// leaf size, depth and choice parameters are gone too.
+			BezierPatchGeometry();
 
 			// Adds a new patch to the list
 			void AddPatch( const BezierPatch& patch );
@@ -86,6 +84,8 @@ namespace RISE
 			// we can prepare for rendering
 			void Prepare();
 
+			unsigned int numPatches() const { return static_cast<unsigned int>( patches.size() ); }
+
 			// Tessellates every stored Bezier patch into triangles and concatenates them.
 			// Per-patch grid is (detail+1) x (detail+1), using the shared patch tessellator.
 			// This override does NOT apply the geometry's own stored `displacement` — callers
@@ -106,8 +106,13 @@ namespace RISE
 
 			SurfaceDerivatives ComputeSurfaceDerivatives( const Point3& objSpacePoint, const Vector3& objSpaceNormal ) const;
 
+			// From ISerializable.  The stream holds the control points
+			// and the BVH, so loading skips the SAH build.
+			void Serialize( IWriteBuffer& buffer ) const;
+			void Deserialize( IReadBuffer& buffer );
+
 			// From TreeElementProcessor
-			typedef MYBEZIERPATCH		MYOBJ;
+			typedef const MYBEZIERPATCH*	MYOBJ;
 				void RayElementIntersection( RayIntersectionGeometric& ri, const MYOBJ elem, const bool bHitFrontFaces, const bool bHitBackFaces ) const;
 				void RayElementIntersection( RayIntersection& ri, const MYOBJ elem, const bool bHitFrontFaces, const bool bHitBackFaces, const bool bComputeExitInfo ) const;
 				bool RayElementIntersection_IntersectionOnly( const Ray& ray, const Scalar dHowFar, const MYOBJ elem, const bool bHitFrontFaces, const bool bHitBackFaces ) const;
@@ -18,8 +18,6 @@
 #include "../Utilities/GeometricUtilities.h"
 #include "../Utilities/OrthonormalBasis3D.h"
 #include "../Interfaces/ILog.h"
-#include "../Octree.h"
-#include "../BSPTreeSAH.h"
 #include "../Utilities/stl_utils.h"
 #include <algorithm>   // std::lower_bound for the area-CDF search
 
@@ -28,7 +26,7 @@ using namespace RISE::Implementation;
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////
 //
-// BilinearPatch specialization required for the octree
+// BilinearPatch specialization required for the BVH
 //
 /////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -55,7 +53,9 @@ void BilinearPatchGeometry::RayElementIntersection( RayIntersectionGeometric& ri
     BILINEAR_HIT	h;
 	RayBilinearPatchIntersection( ri.ray, h, patch );
 
-	if( h.bHit ) {
+	// The BVH hands every leaf element the same running `ri`, so only a
+	// strictly closer hit may overwrite it
+	if( h.bHit && h.dRange < ri.range ) {
 		// If there is an intersection, compute the point of intersection, the normal and the
 		// texture co-ordinates
 		ri.bHit = true;
@@ -97,24 +97,15 @@ void BilinearPatchGeometry::DeserializeElement( IReadBuffer& buffer, MYOBJ& ret
 	//@ TODO : to be implemented
 }
 
-BilinearPatchGeometry::BilinearPatchGeometry(
-	const unsigned int max_polys_per_node, 
-	const unsigned char max_recursion_level,
-	const bool bUseBSP_
-	) : 
-  pBSPTree( 0 ),
-  pOctree( 0 ),
-  nMaxPerOctantNode( max_polys_per_node ),
-  nMaxRecursionLevel( max_recursion_level ),
-  bUseBSP( bUseBSP_ ),
+BilinearPatchGeometry::BilinearPatchGeometry( ) :
+  pBVH( 0 ),
   dTotalArea( 0 )
 {
 }
 
 BilinearPatchGeometry::~BilinearPatchGeometry( )
 {
-	safe_release( pBSPTree );
-	safe_release( pOctree );
+	safe_release( pBVH );
 }
 
 void BilinearPatchGeometry::AddPatch( const BilinearPatch& patch )
@@ -122,46 +113,40 @@ void BilinearPatchGeometry::AddPatch( const BilinearPatch& patch )
 	patches.push_back( patch );
 }
 
-void BilinearPatchGeometry::Prepare()
+// A bilinear patch test (a quadratic solve) costs a few box tests, so
+// the SAH is told so.  The corner boxes the BVH is built from are
+// already tight: each coordinate is bilinear in (u, v), so its extremes
+// are at the corners.
+static AccelerationConfig PatchBVHConfig()
 {
-	// Prepare for rendering
-	// Optimize the patch container
-	stl_utils::container_optimize< BilinearPatchList >( patches );
-
-	// First create the pointer patches list
-	BilinearPatchPtrList		patchptrs;
-	patchptrs.reserve( patches.size() );		// Points to all the bilinear patches
-
-	for( unsigned int i=0; i<patches.size(); i++ ) {
-		const BilinearPatch* b = &patches[i];
-		patchptrs.push_back( b );
-	}
+	AccelerationConfig cfg;
+	cfg.maxLeafSize            = 4;
+	cfg.binCount               = 32;
+	cfg.sahTraversalCost       = 1.0;
+	cfg.sahIntersectionCost    = 4.0;
+	cfg.doubleSided            = true;
+	return cfg;
+}
 
-	// We're done so stuff all the bilinear patches into the bsp-tree
+void BilinearPatchGeometry::BuildBVH()
+{
+	safe_release( pBVH );
 
-	// Compute the bounding box
 	BoundingBox overall( Point3(RISE_INFINITY,RISE_INFINITY,RISE_INFINITY), Point3(-RISE_INFINITY,-RISE_INFINITY,-RISE_INFINITY) );
-	BilinearPatchList::const_iterator		m, n;
-	for( m=patches.begin(), n=patches.end(); m!=n; m++ ) {
+	BilinearPatchPtrList patchptrs;
+	patchptrs.reserve( patches.size() );
+	for( BilinearPatchList::const_iterator m=patches.begin(); m!=patches.end(); m++ ) {
 		overall.Include( GeometricUtilities::BilinearPatchBoundingBox( *m ) );
+		patchptrs.push_back( &(*m) );
 	}
 
-	safe_release( pBSPTree );
-	safe_release( pOctree );
-
-	if( bUseBSP ) {
-		pBSPTree = new BSPTreeSAH<const BilinearPatch*>( *this, overall, nMaxPerOctantNode );
-		GlobalLog()->PrintNew( pBSPTree, __FILE__, __LINE__, "bilinear patches bsptree" );
-
-		pBSPTree->AddElements( patchptrs, nMaxRecursionLevel );
-	} else {
-		pOctree = new Octree<const BilinearPatch*>( *this, overall, nMaxPerOctantNode );
-		GlobalLog()->PrintNew( pOctree, __FILE__, __LINE__, "bilinear patches octree" );
-
-		pOctree->AddElements( patchptrs, nMaxRecursionLevel );
-	}
+	pBVH = new BVH<const BilinearPatch*>( *this, patchptrs, overall, PatchBVHConfig() );
+	GlobalLog()->PrintNew( pBVH, __FILE__, __LINE__, "bilinear patches BVH" );
+}
 
-	// Build the area-light sampling tables.  Done ONCE here rather than per
+void BilinearPatchGeometry::BuildAreaCDF()
+{
+	// Build the area-light sampling tables.  Done ONCE at load rather than per
 	// UniformRandomPoint call: the table is O(patches * nAreaCells^2) to
 	// build, and NEE calls the sampler once per shadow ray.
 	vAreaCDF.clear();
@@ -183,6 +168,16 @@ void BilinearPatchGeometry::Prepare()
 	}
 }
 
+void BilinearPatchGeometry::Prepare()
+{
+	// Prepare for rendering
+	// Optimize the patch container
+	stl_utils::container_optimize< BilinearPatchList >( patches );
+
+	BuildBVH();
+	BuildAreaCDF();
+}
+
 bool BilinearPatchGeometry::TessellateToMesh(
 	IndexTriangleListType& tris,
 	VerticesListType&      vertices,
@@ -257,19 +252,15 @@ bool BilinearPatchGeometry::TessellateToMesh(
 
 void BilinearPatchGeometry::IntersectRay( RayIntersectionGeometric& ri, const bool bHitFrontFaces, const bool bHitBackFaces, const bool bComputeExitInfo ) const
 {
-	if( pBSPTree ) {
-		pBSPTree->IntersectRay( ri, bHitFrontFaces, bHitBackFaces );
-	} else if( pOctree ) {
-		pOctree->IntersectRay( ri, bHitFrontFaces, bHitBackFaces );
+	if( pBVH ) {
+		pBVH->IntersectRay( ri, bHitFrontFaces, bHitBackFaces );
 	}
 }
 
 bool BilinearPatchGeometry::IntersectRay_IntersectionOnly( const Ray& ray, const Scalar dHowFar, const bool bHitFrontFaces, const bool bHitBackFaces ) const
 {
-	if( pBSPTree ) {
-		return pBSPTree->IntersectRay_IntersectionOnly( ray, dHowFar, bHitFrontFaces, bHitBackFaces );
-	} else if( pOctree ) {
-		return pOctree->IntersectRay_IntersectionOnly( ray, dHowFar, bHitFrontFaces, bHitBackFaces );
+	if( pBVH ) {
+		return pBVH->IntersectRay_IntersectionOnly( ray, dHowFar, bHitFrontFaces, bHitBackFaces );
 	}
 
 	return false;
@@ -318,12 +309,10 @@ void BilinearPatchGeometry::GenerateBoundingSphere( Point3& ptCenter, Scalar& ra
 
 BoundingBox BilinearPatchGeometry::GenerateBoundingBox() const
 {
-	if( bUseBSP && pBSPTree ) {
-		return pBSPTree->GetBBox();
-	} else if( pOctree ) {
-		return pOctree->GetBBox();
+	if( pBVH ) {
+		return pBVH->GetBBox();
 	}
-	
+
 	return BoundingBox();
 }
 
@@ -420,3 +409,109 @@ Scalar BilinearPatchGeometry::GetArea( ) const
 	// every estimator built on this geometry).
 	return dTotalArea;
 }
+
+static const char * szSignature = "RISEBLPG";
+static const unsigned int cur_version = 1;
+//
+// Layout: signature(8) + version(4) + numPatches(4) + 4 corner points
+// per patch (12 doubles) + haveBVHCache(1) + (BVH bytes if cached).
+// The cache flag and BVH are only written for a non-empty patch list,
+// the same symmetric gating as .risemesh v4.  The area-light tables are
+// rebuilt on load.
+
+void BilinearPatchGeometry::Serialize( IWriteBuffer& buffer ) const
+{
+	buffer.setBytes( szSignature, 8 );
+	buffer.setUInt( cur_version );
+
+	buffer.ResizeForMore( static_cast<unsigned int>(sizeof(Scalar)*12*patches.size() + sizeof( unsigned int )) );
+	buffer.setUInt( static_cast<unsigned int>(patches.size()) );
+
+	for( BilinearPatchList::const_iterator it = patches.begin(); it != patches.end(); ++it ) {
+		for( int j=0; j<4; j++ ) {
+			buffer.setDouble( it->pts[j].x );
+			buffer.setDouble( it->pts[j].y );
+			buffer.setDouble( it->pts[j].z );
+		}
+	}
+
+	if( !patches.empty() ) {
+		buffer.ResizeForMore( sizeof( char ) );
+		if( pBVH ) {
+			buffer.setChar( 1 );
+			const BilinearPatch* base = &patches[0];
+			pBVH->Serialize( buffer,
+				[base]( const BilinearPatch* p ) -> unsigned int {
+					return (unsigned int)( p - base );
+				} );
+		} else {
+			buffer.setChar( 0 );
+		}
+	}
+}
+
+void BilinearPatchGeometry::Deserialize( IReadBuffer& buffer )
+{
+	char sig[9] = {0};
+	buffer.getBytes( sig, 8 );
+
+	if( strcmp( sig, szSignature ) != 0 ) {
+		GlobalLog()->PrintEasyError( "BilinearPatchGeometry::Deserialize:: Signature not found" );
+		return;
+	}
+
+	const unsigned int version = buffer.getUInt();
+	if( version < 1 || version > cur_version ) {
+		GlobalLog()->PrintEx( eLog_Error,
+			"BilinearPatchGeometry::Deserialize:: Unsupported version %u (this build understands v1..v%u)",
+			version, cur_version );
+		return;
+	}
+
+	safe_release( pBVH );
+	patches.clear();
+
+	const unsigned int numpatches = buffer.getUInt();
+	patches.reserve( numpatches );
+	for( unsigned int i=0; i<numpatches; i++ ) {
+		BilinearPatch patch;
+		for( int j=0; j<4; j++ ) {
+			patch.pts[j].x = buffer.getDouble();
+			patch.pts[j].y = buffer.getDouble();
+			patch.pts[j].z = buffer.getDouble();
+		}
+		patches.push_back( patch );
+	}
+
+	GlobalLog()->PrintEx( eLog_Info, "BilinearPatchGeometry::Deserialize:: Read %u patches", numpatches );
+
+	BuildAreaCDF();
+
+	if( patches.empty() ) {
+		return;
+	}
+
+	if( buffer.getChar() ) {
+		// Empty-input ctor: only the BVH<> shell is wanted, Deserialize
+		// then fills it in
+		BilinearPatchPtrList emptyTemp;
+		BoundingBox dummyBox( Point3(0,0,0), Point3(0,0,0) );
+		pBVH = new BVH<const BilinearPatch*>( *this, emptyTemp, dummyBox, PatchBVHConfig() );
+		GlobalLog()->PrintNew( pBVH, __FILE__, __LINE__, "bilinear patches BVH (cache load)" );
+
+		const BilinearPatch* base = &patches[0];
+		if( pBVH->Deserialize( buffer, (uint32_t)patches.size(),
+				[base]( unsigned int idx ) -> const BilinearPatch* {
+					return base + idx;
+				} ) ) {
+			GlobalLog()->PrintEx( eLog_Info,
+				"BilinearPatchGeometry::Deserialize:: Loaded BVH cache (%u nodes, %u prims)",
+				(unsigned)pBVH->numNodes(), (unsigned)pBVH->numPrims() );
+			return;
+		}
+
+		GlobalLog()->PrintEasyWarning( "BilinearPatchGeometry::Deserialize:: BVH cache failed to load; rebuilding" );
+	}
+
+	BuildBVH();
+}
@@ -16,8 +16,7 @@
 
 #include "Geometry.h"
 #include "../Interfaces/IBilinearPatchGeometry.h"
-#include "../Octree.h"
-#include "../BSPTreeSAH.h"
+#include "../Acceleration/BVH.h"
 
 namespace RISE
 {
@@ -34,16 +33,11 @@ namespace RISE
 
 
 		protected:
-			// The BSP tree of bezier patches
-				BSPTreeSAH<const BilinearPatch*>*	pBSPTree;
+			// BVH over the bilinear patches, built by Prepare() or loaded
+			// by Deserialize()
+			BVH<const BilinearPatch*>*	pBVH;
 
-			// The Octree tree of bezier patches
-			Octree<const BilinearPatch*>*		pOctree;
-
-			BilinearPatchList		patches;			// List of bezier patches
-			unsigned int			nMaxPerOctantNode;	// Maximum number of patches per octant node
-			unsigned char			nMaxRecursionLevel;	// Maximum recursion level when generating the tree
-			bool					bUseBSP;			// Are we using BSP trees ?
+			BilinearPatchList		patches;			// List of bilinear patches; must not reallocate once the BVH exists
 
 			//! Area-light sampling tables, built once in Prepare().
 			//! `vAreaCDF` is ONE global cumulative table over every (patch,
@@ -58,14 +52,18 @@ namespace RISE
 			std::vector<Scalar>		vAreaCDF;
 			Scalar					dTotalArea;
 
+			// Builds the BVH over the patches from scratch
+			void BuildBVH();
+
+			// Builds vAreaCDF and dTotalArea
+			void BuildAreaCDF();
+
 			virtual ~BilinearPatchGeometry( );
 
 		public:
-			BilinearPatchGeometry(
-				const unsigned int max_polys_per_node, 
-				const unsigned char max_recursion_level,
-				const bool bUseBSP
-				);
+			// The BVH is the only patch accelerator; it has no scene-tunable
+			// build parameters
+			BilinearPatchGeometry();
 
 			// Adds a new patch to the list
 			void AddPatch( const BilinearPatch& patch );
@@ -74,6 +72,8 @@ namespace RISE
 			// we can prepare for rendering
 			void Prepare();
 
+			unsigned int numPatches() const { return static_cast<unsigned int>( patches.size() ); }
+
 			// Tessellates every stored bilinear patch as a (detail+1) x (detail+1) bilinear grid,
 			// concatenated.  Per-patch corner mapping is the CANONICAL RISE convention:
 			// pts[0]->UV(0,0), pts[1]->UV(0,1), pts[2]->UV(1,0), pts[3]->UV(1,1) -- NOT
@@ -104,6 +104,11 @@ namespace RISE
 
 			SurfaceDerivatives ComputeSurfaceDerivatives( const Point3& objSpacePoint, const Vector3& objSpaceNormal ) const;
 
+			// From ISerializable.  The stream holds the corner points and
+			// the BVH, so loading skips the SAH build.
+			void Serialize( IWriteBuffer& buffer ) const;
+			void Deserialize( IReadBuffer& buffer );
+
 			// From TreeElementProcessor
 			typedef const BilinearPatch*		MYOBJ;
 				void RayElementIntersection( RayIntersectionGeometric& ri, const MYOBJ elem, const bool bHitFrontFaces, const bool bHitBackFaces ) const;
@@ -251,6 +251,13 @@ BoundingBox BoxGeometry::GenerateBoundingBox() const
 	
 }
 
+bool BoxGeometry::GetAnalyticShape( AnalyticShape& shape ) const
+{
+	shape.bounds = GenerateBoundingBox();
+	shape.bQuadric = false;
+	return true;
+}
+
 void BoxGeometry::UniformRandomPoint( Point3* point, Vector3* normal, Point2* coord, const Point3& prand ) const
 {
 	// The caller uses GetArea() as the reciprocal position PDF, so face
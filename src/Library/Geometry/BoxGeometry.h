@@ -54,6 +54,7 @@ namespace RISE
 
 			void GenerateBoundingSphere( Point3& ptCenter, Scalar& radius ) const; 
 			BoundingBox GenerateBoundingBox() const;
+			bool GetAnalyticShape( AnalyticShape& shape ) const;
 			inline bool DoPreHitTest( ) const { return false; };
 
 			void UniformRandomPoint( Point3* point, Vector3* normal, Point2* coord, const Point3& prand ) const;
@@ -560,6 +560,16 @@ void CylinderGeometry::GenerateBoundingSphere( Point3& ptCenter, Scalar& radius
 	radius = m_dRadius > m_dHeight ? m_dRadius : m_dHeight;
 }
 
+bool CylinderGeometry::GetAnalyticShape( AnalyticShape& shape ) const
+{
+	// The box clips the axis, the quadric is the infinite tube around it
+	shape.bounds = GenerateBoundingBox();
+	shape.q = Vector3( m_chAxis == 'x' ? 0 : 1, m_chAxis == 'y' ? 0 : 1, m_chAxis == 'z' ? 0 : 1 );
+	shape.radius2 = m_dRadius * m_dRadius;
+	shape.bQuadric = true;
+	return true;
+}
+
 BoundingBox CylinderGeometry::GenerateBoundingBox() const
 {
 	// Bounding box will depend on the axis of the cylinder
@@ -47,7 +47,10 @@ DisplacedGeometry::DisplacedGeometry(
 	const Scalar        disp_scale,
 	const bool          bDoubleSided,
 	const bool          bUseFaceNormals,
-	const bool          bSeamFold
+	const bool          bSeamFold,
+	const bool          bLazy,
+	const unsigned int  patchSubdivision,
+	const unsigned int  lazyCacheTriangles
 	) :
   m_pBase( pBase ),
   m_pDisplacement( displacement ),
@@ -56,7 +59,11 @@ DisplacedGeometry::DisplacedGeometry(
   m_bDoubleSided( bDoubleSided ),
   m_bUseFaceNormals( bUseFaceNormals ),
   m_bSeamFold( bSeamFold ),
+  m_bLazy( bLazy ),
+  m_patchSubdivision( patchSubdivision > 0 ? patchSubdivision : 1 ),
+  m_lazyCacheTriangles( lazyCacheTriangles ),
   m_pMesh( 0 ),
+  m_pLazy( 0 ),
   m_bRealized( false ),
   m_displacementSubscription()
 {
@@ -203,6 +210,16 @@ void DisplacedGeometry::BuildMesh() const
 		return;
 	}
 
+	if( m_bLazy ) {
+		// The coarse tessellation is all that is kept; displacement and the
+		// micro-meshes happen per patch, on demand
+		m_pLazy = new LazyDisplacedMesh( tris, vertices, normals, coords,
+			m_pDisplacement, m_dispScale, m_bSeamFold, m_patchSubdivision,
+			m_lazyCacheTriangles, m_bDoubleSided, m_bUseFaceNormals );
+		GlobalLog()->PrintNew( m_pLazy, __FILE__, __LINE__, "lazy displaced mesh" );
+		return;
+	}
+
 	// Did we actually move any vertex positions?  With disp_scale==0 (or a null
 	// displacement painter) ApplyDisplacementMapToObject is a no-op and the
 	// analytical per-vertex normals coming out of TessellateToMesh are still
@@ -251,7 +268,9 @@ void DisplacedGeometry::BuildMesh() const
 
 void DisplacedGeometry::RefreshMeshVertices()
 {
-	// Tier 1 §3: refit-not-rebuild observer path.  See header.
+	// Tier 1 §3: refit-not-rebuild observer path.  See header.  Lazy mode
+	// has no resident vertices to refit: rebuilding re-derives the patch
+	// bounds and starts from an empty micro-mesh cache.
 	if( !m_pBase || !m_pMesh ) {
 		// No current mesh — fall back to full build.
 		DestroyMesh();
@@ -304,6 +323,8 @@ void DisplacedGeometry::DestroyMesh() const
 {
 	safe_release( m_pMesh );
 	m_pMesh = 0;
+	safe_release( m_pLazy );
+	m_pLazy = 0;
 }
 
 bool DisplacedGeometry::TessellateToMesh(
@@ -316,6 +337,9 @@ bool DisplacedGeometry::TessellateToMesh(
 	// Re-emit the internal mesh so a DisplacedGeometry can itself be the base of another
 	// DisplacedGeometry.  The detail parameter is ignored — the internal mesh was built at
 	// this DisplacedGeometry's own construction-time detail.
+	if( m_pLazy ) {
+		return m_pLazy->TessellateToMesh( tris, vertices, normals, coords );
+	}
 	if( !m_pMesh ) {
 		return false;
 	}
@@ -327,6 +351,10 @@ bool DisplacedGeometry::TessellateToMesh(
 
 void DisplacedGeometry::IntersectRay( RayIntersectionGeometric& ri, const bool bHitFrontFaces, const bool bHitBackFaces, const bool bComputeExitInfo ) const
 {
+	if( m_pLazy ) {
+		m_pLazy->IntersectRay( ri, bHitFrontFaces, bHitBackFaces, bComputeExitInfo );
+		return;
+	}
 	if( !m_pMesh ) {
 		ri.bHit = false;
 		return;
@@ -336,6 +364,9 @@ void DisplacedGeometry::IntersectRay( RayIntersectionGeometric& ri, const bool b
 
 bool DisplacedGeometry::IntersectRay_IntersectionOnly( const Ray& ray, const Scalar dHowFar, const bool bHitFrontFaces, const bool bHitBackFaces ) const
 {
+	if( m_pLazy ) {
+		return m_pLazy->IntersectRay_IntersectionOnly( ray, dHowFar, bHitFrontFaces, bHitBackFaces );
+	}
 	if( !m_pMesh ) {
 		return false;
 	}
@@ -344,6 +375,12 @@ bool DisplacedGeometry::IntersectRay_IntersectionOnly( const Ray& ray, const Sca
 
 void DisplacedGeometry::GenerateBoundingSphere( Point3& ptCenter, Scalar& radius ) const
 {
+	if( m_pLazy ) {
+		const BoundingBox bbox = m_pLazy->GetBoundingBox();
+		ptCenter = bbox.GetCenter();
+		radius   = Vector3Ops::Magnitude( bbox.GetExtents() ) * 0.5;
+		return;
+	}
 	if( !m_pMesh ) {
 		ptCenter = Point3( 0.0, 0.0, 0.0 );
 		radius   = 0.0;
@@ -354,6 +391,9 @@ void DisplacedGeometry::GenerateBoundingSphere( Point3& ptCenter, Scalar& radius
 
 BoundingBox DisplacedGeometry::GenerateBoundingBox() const
 {
+	if( m_pLazy ) {
+		return m_pLazy->GetBoundingBox();
+	}
 	if( !m_pMesh ) {
 		return BoundingBox( Point3( 0.0, 0.0, 0.0 ), Point3( 0.0, 0.0, 0.0 ) );
 	}
@@ -362,6 +402,10 @@ BoundingBox DisplacedGeometry::GenerateBoundingBox() const
 
 void DisplacedGeometry::UniformRandomPoint( Point3* point, Vector3* normal, Point2* coord, const Point3& prand ) const
 {
+	if( m_pLazy ) {
+		m_pLazy->UniformRandomPoint( point, normal, coord, prand );
+		return;
+	}
 	if( !m_pMesh ) {
 		if( point )  *point  = Point3( 0.0, 0.0, 0.0 );
 		if( normal ) *normal = Vector3( 0.0, 0.0, 0.0 );
@@ -373,6 +417,9 @@ void DisplacedGeometry::UniformRandomPoint( Point3* point, Vector3* normal, Poin
 
 Scalar DisplacedGeometry::GetArea() const
 {
+	if( m_pLazy ) {
+		return m_pLazy->GetArea();
+	}
 	if( !m_pMesh ) {
 		return 0.0;
 	}
@@ -381,29 +428,15 @@ Scalar DisplacedGeometry::GetArea() const
 
 SurfaceDerivatives DisplacedGeometry::ComputeSurfaceDerivatives( const Point3& objSpacePoint, const Vector3& objSpaceNormal ) const
 {
+	if( m_pLazy ) {
+		return m_pLazy->ComputeSurfaceDerivatives( objSpacePoint, objSpaceNormal );
+	}
 	if( !m_pMesh ) {
 		return SurfaceDerivatives();
 	}
 	return m_pMesh->ComputeSurfaceDerivatives( objSpacePoint, objSpaceNormal );
 }
 
-#include "../Interfaces/IFunction2D.h"
-
-namespace {
-	// Tent-fold of [0, 1] -> [0, 1] centred on 0.5; matches the
-	// destination-side mapping in GeometryUtilities::RemapTextureCoords
-	// that the tessellator uses when evaluating the displacement painter
-	// at mesh-build time.  Equivalent to |2u - 1| with the same
-	// exact-on-0.5 handling.  Keeping the analytical query consistent
-	// with on-mesh values requires the same tent-fold here.
-	inline RISE::Scalar TentFold( RISE::Scalar u )
-	{
-		if( u > 0.5 ) return ( u - 0.5 ) * 2.0;
-		if( u < 0.5 ) return 1.0 - ( u * 2.0 );
-		return 0.0;
-	}
-}
-
 bool DisplacedGeometry::ComputeAnalyticalDerivatives(
 	const Point2& uv,
 	Scalar        smoothing,
@@ -22,6 +22,7 @@
 #include "../Utilities/Observable.h"
 #include <atomic>
 #include <mutex>
+#include "LazyDisplacedMesh.h"
 
 namespace RISE
 {
@@ -45,6 +46,14 @@ namespace RISE
 		// Realize() logs an error and leaves the internal mesh null; all IGeometry query
 		// methods then degrade to "miss" / empty behavior (the release-mode guard-and-fail).
 		// IsValid() reports RECIPE validity (base non-null), known at construction.
+		//
+		// LAZY TESSELLATION (optional): with bLazy the base is tessellated only at
+		// `detail` and each of those coarse triangles becomes a patch of
+		// patchSubdivision^2 micro-triangles that is displaced on demand, when a ray
+		// first reaches the patch's bounds, into a bounded LRU cache (see
+		// LazyDisplacedMesh).  Resident memory then follows what rays touch instead
+		// of the full displaced surface.  The effective resolution is roughly
+		// detail * patchSubdivision.
 		class DisplacedGeometry : public Geometry
 		{
 		protected:
@@ -55,6 +64,9 @@ namespace RISE
 			bool                             m_bDoubleSided;
 			bool                             m_bUseFaceNormals;
 			bool                             m_bSeamFold;	//!< tent-fold the UV before evaluating displacement (closed wrap-seam surfaces); FALSE = raw UV (open Cartesian fields)
+			bool                             m_bLazy;				//!< patches displaced on demand instead of one eager bake
+			unsigned int                     m_patchSubdivision;	//!< lazy mode: micro-mesh subdivisions per patch edge
+			unsigned int                     m_lazyCacheTriangles;	//!< lazy mode: resident micro-mesh triangle budget
 
 			// The baked mesh and the realized flag are the deferred-realization
 			// state.  They are `mutable` because Realize() is a const method
@@ -66,6 +78,7 @@ namespace RISE
 			// dtor).  Realization is single-threaded (the freeze guard asserts
 			// this in debug), so the unlocked mutable write is safe.
 			mutable ITriangleMeshGeometryIndexed*    m_pMesh;
+			mutable LazyDisplacedMesh*               m_pLazy;		//!< lazy mode's patch structure; null in eager mode
 			mutable std::atomic<bool>                m_bRealized;
 			// Serializes the actual bake so a GUI viewport render's AttachScene
 			// cannot race a UI-thread PrepareForRendering/picking into a double
@@ -114,7 +127,10 @@ namespace RISE
 				const Scalar        disp_scale,
 				const bool          bDoubleSided,
 				const bool          bUseFaceNormals,
-				const bool          bSeamFold = true );	//!< FALSE for open Cartesian displacement fields (no UV mirror)
+				const bool          bSeamFold = true,	//!< FALSE for open Cartesian displacement fields (no UV mirror)
+				const bool          bLazy = false,		//!< displace patches on demand into a bounded cache
+				const unsigned int  patchSubdivision = 8,
+				const unsigned int  lazyCacheTriangles = 1u<<20 );
 
 			DisplacedGeometry( const DisplacedGeometry& ) = delete;
 			DisplacedGeometry& operator=( const DisplacedGeometry& ) = delete;
@@ -149,6 +165,10 @@ namespace RISE
 			static unsigned int GetBuildMeshCount();
 			static void         ResetBuildMeshCount();
 
+			// Lazy mode's patch structure (for its cache statistics); null in
+			// eager mode or before Realize().
+			const LazyDisplacedMesh* GetLazyMesh() const { return m_pLazy; }
+
 			// IGeometry
 			bool TessellateToMesh( IndexTriangleListType& tris, VerticesListType& vertices, NormalsListType& normals, TexCoordsListType& coords, const unsigned int detail ) const override;
 			void IntersectRay( RayIntersectionGeometric& ri, const bool bHitFrontFaces, const bool bHitBackFaces, const bool bComputeExitInfo ) const override;
@@ -195,6 +195,20 @@ BoundingBox EllipsoidGeometry::GenerateBoundingBox() const
 		Point3( m_vRadius.x, m_vRadius.y, m_vRadius.z ) );
 }
 
+bool EllipsoidGeometry::GetAnalyticShape( AnalyticShape& shape ) const
+{
+	if( m_vRadius.x <= 0 || m_vRadius.y <= 0 || m_vRadius.z <= 0 ) {
+		return false;
+	}
+
+	// (x/a)^2 + (y/b)^2 + (z/c)^2 <= 1
+	shape.bounds = GenerateBoundingBox();
+	shape.q = Vector3( 1.0/(m_vRadius.x*m_vRadius.x), 1.0/(m_vRadius.y*m_vRadius.y), 1.0/(m_vRadius.z*m_vRadius.z) );
+	shape.radius2 = 1.0;
+	shape.bQuadric = true;
+	return true;
+}
+
 void EllipsoidGeometry::UniformRandomPoint( Point3* point, Vector3* normal, Point2* coord, const Point3& prand ) const
 {
 	// Semi-axes = m_vRadius (per-axis radii)
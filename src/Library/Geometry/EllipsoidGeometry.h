@@ -56,6 +56,7 @@ namespace RISE
 
 			void GenerateBoundingSphere( Point3& ptCenter, Scalar& radius ) const override;
 			BoundingBox GenerateBoundingBox() const override;
+			bool GetAnalyticShape( AnalyticShape& shape ) const override;
 			inline bool DoPreHitTest( ) const override { return true; };
 
 			void UniformRandomPoint( Point3* point, Vector3* normal, Point2* coord, const Point3& prand ) const override;
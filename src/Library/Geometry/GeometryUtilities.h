@@ -64,6 +64,16 @@ namespace RISE
 		TexCoordsListType& vCoords 
 		);
 
+	// The single-coordinate form of RemapTextureCoords' tent fold: |2u-1|,
+	// with u == 0.5 mapping to exactly 0.  Used wherever a displacement is
+	// evaluated one point at a time and has to agree with the remapped list.
+	inline Scalar TentFold( const Scalar u )
+	{
+		if( u > 0.5 ) return ( u - 0.5 ) * 2.0;
+		if( u < 0.5 ) return 1.0 - ( u * 2.0 );
+		return 0.0;
+	}
+
 	// Inverts a given object
 	extern bool InvertObject( 
 		IndexTriangleListType& vFaces, 
@@ -0,0 +1,372 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  InstanceArrayGeometry.cpp - Implementation of InstanceArrayGeometry.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//  Comments:
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "InstanceArrayGeometry.h"
+#include "../Interfaces/ILog.h"
+#include "../Utilities/GeometricUtilities.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace RISE;
+using namespace RISE::Implementation;
+
+void InstanceArrayGeometry::InstanceTransform::Set( const Matrix4& mx )
+{
+	// RISE matrices are indexed _<column><row>
+	m[ 0] = float( mx._00 ); m[ 1] = float( mx._10 ); m[ 2] = float( mx._20 ); m[ 3] = float( mx._30 );
+	m[ 4] = float( mx._01 ); m[ 5] = float( mx._11 ); m[ 6] = float( mx._21 ); m[ 7] = float( mx._31 );
+	m[ 8] = float( mx._02 ); m[ 9] = float( mx._12 ); m[10] = float( mx._22 ); m[11] = float( mx._32 );
+}
+
+Matrix4 InstanceArrayGeometry::InstanceTransform::Get() const
+{
+	Matrix4 mx;
+	mx._00 = m[ 0]; mx._10 = m[ 1]; mx._20 = m[ 2]; mx._30 = m[ 3];
+	mx._01 = m[ 4]; mx._11 = m[ 5]; mx._21 = m[ 6]; mx._31 = m[ 7];
+	mx._02 = m[ 8]; mx._12 = m[ 9]; mx._22 = m[10]; mx._32 = m[11];
+	mx._03 = 0;     mx._13 = 0;     mx._23 = 0;     mx._33 = 1;
+	return mx;
+}
+
+InstanceArrayGeometry::InstanceArrayGeometry(
+	const IGeometry& child,
+	const unsigned int numInstances,
+	const Scalar* matrices
+	) :
+  m_pChild( &child ),
+  m_instances( numInstances ),
+  m_areaCDF( numInstances ),
+  m_pBVH( 0 ),
+  m_bRealized( false )
+{
+	m_pChild->addref();
+
+	Scalar areaScaleSum = 0;
+	for( unsigned int i = 0; i < numInstances; i++ ) {
+		const Scalar* c = &matrices[i*16];
+		Matrix4 mx;
+		mx._00 = c[ 0]; mx._01 = c[ 1]; mx._02 = c[ 2]; mx._03 = c[ 3];
+		mx._10 = c[ 4]; mx._11 = c[ 5]; mx._12 = c[ 6]; mx._13 = c[ 7];
+		mx._20 = c[ 8]; mx._21 = c[ 9]; mx._22 = c[10]; mx._23 = c[11];
+		mx._30 = c[12]; mx._31 = c[13]; mx._32 = c[14]; mx._33 = c[15];
+		m_instances[i].Set( mx );
+
+		// Boxes and areas come from the stored float transform, so they
+		// agree exactly with what intersection will use.  The running
+		// area sums are what UniformRandomPoint picks an instance by.
+		areaScaleSum += pow( fabs( Matrix4Ops::Determinant( m_instances[i].Get() ) ), 2.0/3.0 );
+		m_areaCDF[i] = areaScaleSum;
+	}
+
+	ComputeBounds();
+}
+
+InstanceArrayGeometry::~InstanceArrayGeometry()
+{
+	safe_release( m_pBVH );
+	safe_release( m_pChild );
+}
+
+void InstanceArrayGeometry::ComputeBounds() const
+{
+	m_childBox = m_pChild->GenerateBoundingBox();
+	m_bbox = BoundingBox( Point3( RISE_INFINITY, RISE_INFINITY, RISE_INFINITY ), Point3( -RISE_INFINITY, -RISE_INFINITY, -RISE_INFINITY ) );
+	for( unsigned int i = 0; i < m_instances.size(); i++ ) {
+		m_bbox.Include( InstanceBox( i ) );
+	}
+
+	if( m_instances.empty() ) {
+		m_bbox = BoundingBox( Point3( 0, 0, 0 ), Point3( 0, 0, 0 ) );
+	}
+}
+
+BoundingBox InstanceArrayGeometry::InstanceBox( const unsigned int idx ) const
+{
+	// All 8 corners, see Object::getBoundingBox
+	const Matrix4 mx = m_instances[idx].Get();
+	const BoundingBox& b = m_childBox;
+	BoundingBox box( Point3( RISE_INFINITY, RISE_INFINITY, RISE_INFINITY ), Point3( -RISE_INFINITY, -RISE_INFINITY, -RISE_INFINITY ) );
+	for( int i = 0; i < 8; i++ ) {
+		const Point3 corner( (i&1) ? b.ur.x : b.ll.x, (i&2) ? b.ur.y : b.ll.y, (i&4) ? b.ur.z : b.ll.z );
+		box.Include( Point3Ops::Transform( mx, corner ) );
+	}
+	return box;
+}
+
+void InstanceArrayGeometry::Realize() const
+{
+	// Same double-checked realize as DisplacedGeometry::Realize
+	if( m_bRealized.load( std::memory_order_acquire ) ) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> realizeLock( m_realizeMutex );
+	if( m_bRealized.load( std::memory_order_relaxed ) ) {
+		return;
+	}
+
+	// A deferred child, such as a DisplacedGeometry, only has its real
+	// bounds once realized, and the instance BVH is built from them
+	m_pChild->Realize();
+	ComputeBounds();
+
+	if( dynamic_cast<const InstanceArrayGeometry*>( m_pChild ) ) {
+		GlobalLog()->PrintEasyError( "InstanceArrayGeometry:: The child geometry is itself an instance array, which is not supported, the array will not be hit" );
+		m_bRealized.store( true, std::memory_order_release );
+		return;
+	}
+
+	if( !m_instances.empty() ) {
+		std::vector<unsigned int> elements( m_instances.size() );
+		for( unsigned int i = 0; i < elements.size(); i++ ) {
+			elements[i] = i;
+		}
+
+		// Same costs as the top level BVH: a leaf test descends into
+		// the child's own acceleration structure
+		AccelerationConfig cfg{};
+		cfg.maxLeafSize          = 4;
+		cfg.binCount             = 32;
+		cfg.sahTraversalCost     = 1.0;
+		cfg.sahIntersectionCost  = 8.0;
+		cfg.doubleSided          = true;
+
+		m_pBVH = new BVH<unsigned int>( *this, elements, m_bbox, cfg );
+		GlobalLog()->PrintNew( m_pBVH, __FILE__, __LINE__, "instance array bvh" );
+
+		GlobalLog()->PrintEx( eLog_Event, "InstanceArrayGeometry:: Built the BVH over %u instances", NumInstances() );
+	}
+
+	m_bRealized.store( true, std::memory_order_release );
+}
+
+void InstanceArrayGeometry::IntersectInstance(
+	RayIntersectionGeometric& ri,
+	const unsigned int idx,
+	const bool bHitFrontFaces,
+	const bool bHitBackFaces,
+	const bool bComputeExitInfo
+	) const
+{
+	const Matrix4 mxTrans = m_instances[idx].Get();
+	const Matrix4 mxInvTrans = Matrix4Ops::Inverse( mxTrans );
+
+	// Bring the ray into the instance's frame, see Object::IntersectRay
+	const Vector3 dirLocalUnnorm = Vector3Ops::Transform( mxInvTrans, ri.ray.Dir() );
+	const Scalar dirLocalMag = Vector3Ops::Magnitude( dirLocalUnnorm );
+	if( dirLocalMag < NEARZERO ) {
+		return;
+	}
+
+	RayIntersectionGeometric local( ri.ray, ri.rast );
+	local.PropagateCastInputs( ri );
+	local.ray.origin = Point3Ops::Transform( mxInvTrans, ri.ray.origin );
+	local.ray.SetDir( dirLocalUnnorm * (1.0/dirLocalMag) );
+
+	if( ri.ray.hasDifferentials ) {
+		local.ray.diffs.rxOrigin = Vector3Ops::Transform( mxInvTrans, ri.ray.diffs.rxOrigin );
+		local.ray.diffs.ryOrigin = Vector3Ops::Transform( mxInvTrans, ri.ray.diffs.ryOrigin );
+
+		const Vector3 d = ri.ray.Dir();
+		const Vector3 aux_x = Vector3Ops::Normalize( Vector3Ops::Transform( mxInvTrans, Vector3( d.x + ri.ray.diffs.rxDir.x, d.y + ri.ray.diffs.rxDir.y, d.z + ri.ray.diffs.rxDir.z ) ) );
+		const Vector3 aux_y = Vector3Ops::Normalize( Vector3Ops::Transform( mxInvTrans, Vector3( d.x + ri.ray.diffs.ryDir.x, d.y + ri.ray.diffs.ryDir.y, d.z + ri.ray.diffs.ryDir.z ) ) );
+		const Vector3 d_local = local.ray.Dir();
+		local.ray.diffs.rxDir = Vector3( aux_x.x - d_local.x, aux_x.y - d_local.y, aux_x.z - d_local.z );
+		local.ray.diffs.ryDir = Vector3( aux_y.x - d_local.x, aux_y.y - d_local.y, aux_y.z - d_local.z );
+		local.ray.hasDifferentials = true;
+	}
+
+	m_pChild->IntersectRay( local, bHitFrontFaces, bHitBackFaces, bComputeExitInfo );
+	if( !local.bHit ) {
+		return;
+	}
+
+	// Distances along a normalized direction scale by dirLocalMag
+	// between the two frames
+	const Scalar range = local.range / dirLocalMag;
+	if( range >= ri.range ) {
+		return;
+	}
+
+	const Matrix4 mxInvTranspose = Matrix4Ops::Transpose( mxInvTrans );
+
+	local.vNormal = Vector3Ops::Normalize( Vector3Ops::Transform( mxInvTranspose, local.vNormal ) );
+	local.vGeomNormal = Vector3Ops::Normalize( Vector3Ops::Transform( mxInvTranspose, local.vGeomNormal ) );
+
+	if( local.bHasTangent ) {
+		local.vTangent = Vector3Ops::Normalize( Vector3Ops::Transform( mxTrans, local.vTangent ) );
+		if( Matrix4Ops::Determinant( mxTrans ) < 0 ) {
+			local.bitangentSign = -local.bitangentSign;
+		}
+	}
+
+	if( local.derivatives.valid ) {
+		local.derivatives.dpdu = Vector3Ops::Transform( mxTrans, local.derivatives.dpdu );
+		local.derivatives.dpdv = Vector3Ops::Transform( mxTrans, local.derivatives.dpdv );
+		local.derivatives.dndu = Vector3Ops::Transform( mxInvTranspose, local.derivatives.dndu );
+		local.derivatives.dndv = Vector3Ops::Transform( mxInvTranspose, local.derivatives.dndv );
+	}
+
+	if( local.bHasWireEdgeInfo ) {
+		local.ptWireNearestEdge = Point3Ops::Transform( mxTrans, local.ptWireNearestEdge );
+	}
+
+	if( bComputeExitInfo ) {
+		local.vNormal2 = Vector3Ops::Normalize( Vector3Ops::Transform( mxInvTranspose, local.vNormal2 ) );
+		local.vGeomNormal2 = Vector3Ops::Normalize( Vector3Ops::Transform( mxInvTranspose, local.vGeomNormal2 ) );
+		local.range2 = local.range2 / dirLocalMag;
+	}
+
+	// The owning Object works out the hit points from the ray and range
+	local.range = range;
+	local.ray = ri.ray;
+	ri = local;
+}
+
+void InstanceArrayGeometry::IntersectRay( RayIntersectionGeometric& ri, const bool bHitFrontFaces, const bool bHitBackFaces, const bool bComputeExitInfo ) const
+{
+	if( !m_pBVH ) {
+		ri.bHit = false;
+		return;
+	}
+
+	ri.bHit = false;
+	ri.range = RISE_INFINITY;
+
+	if( bComputeExitInfo ) {
+		RayIntersection full( ri.ray, ri.rast );
+		full.geometric.PropagateCastInputs( ri );
+		m_pBVH->IntersectRay( full, bHitFrontFaces, bHitBackFaces, true );
+		if( full.geometric.bHit ) {
+			ri = full.geometric;
+		}
+		return;
+	}
+
+	m_pBVH->IntersectRay( ri, bHitFrontFaces, bHitBackFaces );
+}
+
+bool InstanceArrayGeometry::IntersectRay_IntersectionOnly( const Ray& ray, const Scalar dHowFar, const bool bHitFrontFaces, const bool bHitBackFaces ) const
+{
+	if( !m_pBVH ) {
+		return false;
+	}
+	return m_pBVH->IntersectRay_IntersectionOnly( ray, dHowFar, bHitFrontFaces, bHitBackFaces );
+}
+
+void InstanceArrayGeometry::GenerateBoundingSphere( Point3& ptCenter, Scalar& radius ) const
+{
+	ptCenter = m_bbox.GetCenter();
+	radius = Vector3Ops::Magnitude( m_bbox.GetExtents() ) * 0.5;
+}
+
+BoundingBox InstanceArrayGeometry::GenerateBoundingBox() const
+{
+	return m_bbox;
+}
+
+void InstanceArrayGeometry::UniformRandomPoint( Point3* point, Vector3* normal, Point2* coord, const Point3& prand ) const
+{
+	if( m_areaCDF.empty() || m_areaCDF.back() <= 0 ) {
+		if( point )  *point  = Point3( 0.0, 0.0, 0.0 );
+		if( normal ) *normal = Vector3( 0.0, 0.0, 0.0 );
+		if( coord )  *coord  = Point2( 0.0, 0.0 );
+		return;
+	}
+
+	// Pick the instance, then reuse the rest of prand.x inside it
+	const Scalar total = m_areaCDF.back();
+	const Scalar x = prand.x * total;
+	const size_t idx = std::min<size_t>(
+		std::upper_bound( m_areaCDF.begin(), m_areaCDF.end(), x ) - m_areaCDF.begin(),
+		m_areaCDF.size() - 1 );
+	const Scalar lo = idx ? m_areaCDF[idx-1] : 0;
+	const Scalar width = m_areaCDF[idx] - lo;
+	const Scalar xInside = width > 0 ? std::min( std::max( (x - lo) / width, Scalar( 0 ) ), Scalar( 1 ) ) : Scalar( 0.5 );
+
+	Point3 p;
+	Vector3 n;
+	m_pChild->UniformRandomPoint( &p, &n, coord, Point3( xInside, prand.y, prand.z ) );
+
+	const Matrix4 mxTrans = m_instances[idx].Get();
+	if( point ) {
+		*point = Point3Ops::Transform( mxTrans, p );
+	}
+	if( normal ) {
+		*normal = Vector3Ops::Normalize( Vector3Ops::Transform( Matrix4Ops::Transpose( Matrix4Ops::Inverse( mxTrans ) ), n ) );
+	}
+}
+
+Scalar InstanceArrayGeometry::GetArea() const
+{
+	return m_areaCDF.empty() ? 0 : m_pChild->GetArea() * m_areaCDF.back();
+}
+
+void InstanceArrayGeometry::RayElementIntersection( RayIntersectionGeometric& ri, const unsigned int elem, const bool bHitFrontFaces, const bool bHitBackFaces ) const
+{
+	IntersectInstance( ri, elem, bHitFrontFaces, bHitBackFaces, false );
+}
+
+void InstanceArrayGeometry::RayElementIntersection( RayIntersection& ri, const unsigned int elem, const bool bHitFrontFaces, const bool bHitBackFaces, const bool bComputeExitInfo ) const
+{
+	IntersectInstance( ri.geometric, elem, bHitFrontFaces, bHitBackFaces, bComputeExitInfo );
+}
+
+bool InstanceArrayGeometry::RayElementIntersection_IntersectionOnly( const Ray& ray, const Scalar dHowFar, const unsigned int elem, const bool bHitFrontFaces, const bool bHitBackFaces ) const
+{
+	const Matrix4 mxInvTrans = Matrix4Ops::Inverse( m_instances[elem].Get() );
+
+	const Vector3 dirLocalUnnorm = Vector3Ops::Transform( mxInvTrans, ray.Dir() );
+	const Scalar dirLocalMag = Vector3Ops::Magnitude( dirLocalUnnorm );
+	if( dirLocalMag < NEARZERO ) {
+		return false;
+	}
+
+	Ray local( ray );
+	local.origin = Point3Ops::Transform( mxInvTrans, ray.origin );
+	local.SetDir( dirLocalUnnorm * (1.0/dirLocalMag) );
+
+	// Only ever shrink the RISE_INFINITY sentinel, see Object::IntersectRay
+	Scalar dHowFar2 = dHowFar;
+	if( (dHowFar != RISE_INFINITY) || (dirLocalMag < 1.0) ) {
+		dHowFar2 = dirLocalMag*dHowFar;
+	}
+
+	return m_pChild->IntersectRay_IntersectionOnly( local, dHowFar2, bHitFrontFaces, bHitBackFaces );
+}
+
+BoundingBox InstanceArrayGeometry::GetElementBoundingBox( const unsigned int elem ) const
+{
+	return InstanceBox( elem );
+}
+
+bool InstanceArrayGeometry::ElementBoxIntersection( const unsigned int elem, const BoundingBox& bbox ) const
+{
+	return bbox.DoIntersect( InstanceBox( elem ) );
+}
+
+char InstanceArrayGeometry::WhichSideofPlaneIsElement( const unsigned int elem, const Plane& plane ) const
+{
+	return GeometricUtilities::WhichSideOfPlane( plane, InstanceBox( elem ) );
+}
+
+void InstanceArrayGeometry::SerializeElement( IWriteBuffer& buffer, const unsigned int elem ) const
+{
+	buffer.setUInt( elem );
+}
+
+void InstanceArrayGeometry::DeserializeElement( IReadBuffer& buffer, unsigned int& ret ) const
+{
+	ret = buffer.getUInt();
+}
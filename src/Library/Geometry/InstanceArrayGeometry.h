@@ -0,0 +1,143 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  InstanceArrayGeometry.h - A geometry made of many placed copies of
+//  one shared child geometry.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//  Comments:
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#ifndef INSTANCE_ARRAY_GEOMETRY_
+#define INSTANCE_ARRAY_GEOMETRY_
+
+#include "Geometry.h"
+#include "../Acceleration/BVH.h"
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace RISE
+{
+	namespace Implementation
+	{
+		// Every instance is only a packed float 3x4 transform (48 bytes)
+		// into the shared child, so scattering millions of copies of a
+		// mesh costs a few tens of bytes each instead of a whole Object
+		// apiece.  The instances get their own BVH over their placed
+		// boxes; an ordinary Object places the whole array in the scene,
+		// which puts that BVH under the top-level one as a second level
+		// and gives every instance the object's material, shader and
+		// modifier.
+		//
+		// Intersection brings the ray into the frame of each candidate
+		// instance the same way Object brings it into the frame of its
+		// geometry, then hands the hit back in the array's frame, where
+		// the owning Object takes it the rest of the way to world space.
+		//
+		// The instance BVH is built by Realize(), which the render
+		// pipeline calls once before rendering (see DisplacedGeometry);
+		// until then intersection reports a miss.  The child's own BVH is
+		// traversed from inside this one's leaves; every BVH over the
+		// same element type shares one node vector per thread, and each
+		// traversal only pushes and pops above where it found it, so a
+		// mesh child (also a BVH<unsigned int>) nests safely.  The child
+		// must still not be another InstanceArrayGeometry: arrays of
+		// arrays are refused, nest them by placing objects instead.
+		class InstanceArrayGeometry : public Geometry, public virtual TreeElementProcessor<unsigned int>
+		{
+		public:
+			//! Row-major 3x4 of the instance-to-array transform
+			struct InstanceTransform
+			{
+				float	m[12];
+
+				void Set( const Matrix4& mx );
+				Matrix4 Get() const;
+			};
+
+		protected:
+			const IGeometry*					m_pChild;
+			std::vector<InstanceTransform>		m_instances;
+			std::vector<Scalar>					m_areaCDF;			///< Running sums over instances of the child's area scale
+
+			// Built once by Realize(); same mutable lazy-cache pattern
+			// as DisplacedGeometry's baked mesh.  The boxes are first
+			// taken at construction, then again once the child has been
+			// realized and knows its real bounds.
+			mutable BoundingBox					m_bbox;
+			mutable BoundingBox					m_childBox;
+			mutable BVH<unsigned int>*			m_pBVH;
+			mutable std::atomic<bool>			m_bRealized;
+			mutable std::mutex					m_realizeMutex;
+
+			virtual ~InstanceArrayGeometry();
+
+			BoundingBox InstanceBox( const unsigned int idx ) const;
+			void ComputeBounds() const;
+
+			void IntersectInstance(
+				RayIntersectionGeometric& ri,
+				const unsigned int idx,
+				const bool bHitFrontFaces,
+				const bool bHitBackFaces,
+				const bool bComputeExitInfo
+				) const;
+
+		public:
+			InstanceArrayGeometry(
+				const IGeometry& child,					///< [in] Shared geometry every instance places
+				const unsigned int numInstances,		///< [in] Number of instances
+				const Scalar* matrices					///< [in] numInstances column-major 4x4 instance-to-array transforms
+				);
+
+			InstanceArrayGeometry( const InstanceArrayGeometry& ) = delete;
+			InstanceArrayGeometry& operator=( const InstanceArrayGeometry& ) = delete;
+
+			unsigned int NumInstances() const { return static_cast<unsigned int>( m_instances.size() ); }
+			const IGeometry* GetChild() const { return m_pChild; }
+			const InstanceTransform& GetInstance( const unsigned int idx ) const { return m_instances[idx]; }
+			bool IsRealized() const { return m_bRealized.load( std::memory_order_acquire ); }
+
+			void Realize() const override;
+
+			// An instance array is never tessellated or displaced as a whole
+			bool CanTessellate() const override { return false; }
+
+			void IntersectRay( RayIntersectionGeometric& ri, const bool bHitFrontFaces, const bool bHitBackFaces, const bool bComputeExitInfo ) const override;
+			bool IntersectRay_IntersectionOnly( const Ray& ray, const Scalar dHowFar, const bool bHitFrontFaces, const bool bHitBackFaces ) const override;
+
+			void GenerateBoundingSphere( Point3& ptCenter, Scalar& radius ) const override;
+			BoundingBox GenerateBoundingBox() const override;
+			inline bool DoPreHitTest() const override { return true; }
+
+			//! Picks an instance in proportion to its area, then a point
+			//! on it.  Instance areas are the child's area times
+			//! |det|^(2/3) of the instance transform, which is exact for
+			//! rotations with uniform scale and an estimate otherwise.
+			void UniformRandomPoint( Point3* point, Vector3* normal, Point2* coord, const Point3& prand ) const override;
+			Scalar GetArea() const override;
+
+			// From TreeElementProcessor
+			void RayElementIntersection( RayIntersectionGeometric& ri, const unsigned int elem, const bool bHitFrontFaces, const bool bHitBackFaces ) const override;
+			void RayElementIntersection( RayIntersection& ri, const unsigned int elem, const bool bHitFrontFaces, const bool bHitBackFaces, const bool bComputeExitInfo ) const override;
+			bool RayElementIntersection_IntersectionOnly( const Ray& ray, const Scalar dHowFar, const unsigned int elem, const bool bHitFrontFaces, const bool bHitBackFaces ) const override;
+			BoundingBox GetElementBoundingBox( const unsigned int elem ) const override;
+			bool ElementBoxIntersection( const unsigned int elem, const BoundingBox& bbox ) const override;
+			char WhichSideofPlaneIsElement( const unsigned int elem, const Plane& plane ) const override;
+			void SerializeElement( IWriteBuffer& buffer, const unsigned int elem ) const override;
+			void DeserializeElement( IReadBuffer& buffer, unsigned int& ret ) const override;
+
+			// Keyframable — static after construction; no keyframeable parameters.
+			IKeyframeParameter* KeyframeFromParameters( const String& /*name*/, const String& /*value*/ ) override { return 0; }
+			void SetIntermediateValue( const IKeyframeParameter& /*val*/ ) override {}
+			void RegenerateData() override {}
+		};
+	}
+}
+
+#endif
@@ -0,0 +1,639 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  LazyDisplacedMesh.cpp - Implementation of LazyDisplacedMesh.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//  Comments:
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "LazyDisplacedMesh.h"
+#include "TriangleMeshGeometryIndexed.h"
+#include "GeometryUtilities.h"
+#include "../Intersection/RayPrimitiveIntersections.h"
+#include "../Utilities/GeometricUtilities.h"
+#include "../Interfaces/ILog.h"
+#include <algorithm>
+
+using namespace RISE;
+using namespace RISE::Implementation;
+
+namespace
+{
+	//! Total order on the coarse corners, so every patch sharing a corner
+	//! sums its terms in the same sequence.  By position first, which
+	//! also orders seam-duplicated vertices (same point, different
+	//! index and uv) consistently on both sides of the seam.
+	inline bool CornerLess( const Point3& a, const unsigned int ia, const Point3& b, const unsigned int ib )
+	{
+		if( a.x != b.x ) return a.x < b.x;
+		if( a.y != b.y ) return a.y < b.y;
+		if( a.z != b.z ) return a.z < b.z;
+		return ia < ib;
+	}
+
+	inline unsigned int LatticeIndex( const unsigned int N, const unsigned int i, const unsigned int j )
+	{
+		// Row j holds N+1-j vertices
+		return j*(N+1) - (j*(j-1))/2 + i;
+	}
+
+	void PadBox( BoundingBox& bbox )
+	{
+		// Patch boxes are tested in double before the micro-mesh's own
+		// float BVH sees the ray; a small pad keeps a grazing hit on the
+		// box boundary from being rejected early, and gives flat patches
+		// some thickness.
+		const Vector3 ext = bbox.GetExtents();
+		const Scalar pad = 1e-6 * std::max( ext.x, std::max( ext.y, ext.z ) ) + NEARZERO;
+		bbox.ll = Point3( bbox.ll.x - pad, bbox.ll.y - pad, bbox.ll.z - pad );
+		bbox.ur = Point3( bbox.ur.x + pad, bbox.ur.y + pad, bbox.ur.z + pad );
+	}
+
+	//! Distance at which the ray enters the box, or RISE_INFINITY if it misses
+	inline Scalar BoxEntry( const Ray& ray, const BoundingBox& bbox )
+	{
+		BOX_HIT	h;
+		RayBoxIntersection( ray, h, bbox.ll, bbox.ur );
+		if( !h.bHit ) {
+			return RISE_INFINITY;
+		}
+		// From inside the box dRange is the exit and dRange2 the
+		// (negative) entry
+		return std::min( h.dRange, h.dRange2 );
+	}
+}
+
+LazyDisplacedMesh::LazyDisplacedMesh(
+	IndexTriangleListType&	tris,
+	VerticesListType&		vertices,
+	NormalsListType&		normals,
+	TexCoordsListType&		coords,
+	const IFunction2D*		displacement,
+	const Scalar			dispScale,
+	const bool				bSeamFold,
+	const unsigned int		subdivision,
+	const unsigned int		cacheTriangles,
+	const bool				bDoubleSided,
+	const bool				bUseFaceNormals
+	) :
+  m_pDisplacement( displacement ),
+  m_dispScale( dispScale ),
+  m_bSeamFold( bSeamFold ),
+  m_N( subdivision > 0 ? subdivision : 1 ),
+  m_bDoubleSided( bDoubleSided ),
+  m_bUseFaceNormals( bUseFaceNormals ),
+  m_totalArea( 0 ),
+  m_bbox( Point3( RISE_INFINITY, RISE_INFINITY, RISE_INFINITY ), Point3( -RISE_INFINITY, -RISE_INFINITY, -RISE_INFINITY ) ),
+  m_pBVH( 0 ),
+  m_shardBudget( 0 ),
+  m_builds( 0 ),
+  m_hits( 0 ),
+  m_cachedTriangles( 0 ),
+  m_peakCachedTriangles( 0 )
+{
+	if( m_pDisplacement ) {
+		m_pDisplacement->addref();
+	}
+
+	m_tris.swap( tris );
+	m_vertices.swap( vertices );
+	m_normals.swap( normals );
+	m_coords.swap( coords );
+
+	// Each shard keeps at least one patch so a ray can always make
+	// progress, even with a budget smaller than a single micro-mesh
+	m_shardBudget = std::max( cacheTriangles / kCacheShards, m_N*m_N );
+
+	// Displace each patch's full micro lattice once, for its exact box
+	// and area.  A micro-mesh is flat between its lattice points, so the
+	// box of the points holds all of it whatever the displacement does
+	// between them.  Only the positions are kept, and only while the
+	// patch is being bounded; normals, triangles and the micro BVH wait
+	// until a ray reaches the patch.
+	const unsigned int numPatches = static_cast<unsigned int>( m_tris.size() );
+	const unsigned int N = m_N;
+	m_patches.resize( numPatches );
+
+	std::vector<Scalar> areas( numPatches, 0 );
+	std::vector<Point3> grid( (N+1)*(N+2)/2 );
+
+	for( unsigned int p=0; p<numPatches; p++ )
+	{
+		Corners c;
+		GetCorners( p, c );
+
+		for( unsigned int j=0; j<=N; j++ ) {
+			for( unsigned int i=0; i<=N-j; i++ ) {
+				grid[LatticeIndex( N, i, j )] = LatticePoint( c, N, i, j, 0, 0 );
+			}
+		}
+
+		BoundingBox bbox( grid[0], grid[0] );
+		for( size_t k=1; k<grid.size(); k++ ) {
+			bbox.Include( grid[k] );
+		}
+
+		Scalar area = 0;
+		for( unsigned int j=0; j<N; j++ ) {
+			for( unsigned int i=0; i<N-j; i++ ) {
+				const Point3& a = grid[LatticeIndex( N, i, j )];
+				const Point3& b = grid[LatticeIndex( N, i+1, j )];
+				const Point3& d = grid[LatticeIndex( N, i, j+1 )];
+				area += 0.5 * Vector3Ops::Magnitude( Vector3Ops::Cross( Vector3Ops::mkVector3( b, a ), Vector3Ops::mkVector3( d, a ) ) );
+				if( i+j < N-1 ) {
+					const Point3& e = grid[LatticeIndex( N, i+1, j+1 )];
+					area += 0.5 * Vector3Ops::Magnitude( Vector3Ops::Cross( Vector3Ops::mkVector3( e, b ), Vector3Ops::mkVector3( d, b ) ) );
+				}
+			}
+		}
+
+		PadBox( bbox );
+		m_patches[p].id = p;
+		m_patches[p].bbox = bbox;
+		m_bbox.Include( bbox );
+
+		areas[p] = area;
+		m_totalArea += area;
+	}
+
+	if( m_totalArea > 0 ) {
+		const Scalar invArea = 1.0 / m_totalArea;
+		Scalar sum = 0;
+		m_areasCDF.reserve( numPatches );
+		for( unsigned int p=0; p<numPatches; p++ ) {
+			sum += areas[p] * invArea;
+			m_areasCDF.push_back( sum );
+		}
+	}
+
+	std::vector<const DisplacedPatch*> prims( numPatches );
+	for( unsigned int p=0; p<numPatches; p++ ) {
+		prims[p] = &m_patches[p];
+	}
+
+	// Small leaves: every patch visited may mean a micro-mesh build
+	AccelerationConfig cfg;
+	cfg.maxLeafSize            = 2;
+	cfg.binCount               = 32;
+	cfg.sahTraversalCost       = 1.0;
+	cfg.sahIntersectionCost    = 1.0;
+	cfg.doubleSided            = m_bDoubleSided;
+
+	if( numPatches ) {
+		m_pBVH = new BVH<const DisplacedPatch*>( *this, prims, m_bbox, cfg );
+		GlobalLog()->PrintNew( m_pBVH, __FILE__, __LINE__, "lazy displaced patches BVH" );
+	}
+
+	GlobalLog()->PrintEx( eLog_Info, "LazyDisplacedMesh:: %u patches of %u triangles, cache budget %u triangles", numPatches, m_N*m_N, m_shardBudget*kCacheShards );
+}
+
+LazyDisplacedMesh::~LazyDisplacedMesh()
+{
+	FlushCache();
+	safe_release( m_pBVH );
+
+	if( m_pDisplacement ) {
+		m_pDisplacement->release();
+		m_pDisplacement = 0;
+	}
+}
+
+void LazyDisplacedMesh::GetCorners( const unsigned int patch, Corners& c ) const
+{
+	const IndexedTriangle& tri = m_tris[patch];
+
+	unsigned int order[3] = { 0, 1, 2 };
+	for( int a=0; a<2; a++ ) {
+		for( int b=a+1; b<3; b++ ) {
+			if( CornerLess( m_vertices[tri.iVertices[order[b]]], tri.iVertices[order[b]],
+							m_vertices[tri.iVertices[order[a]]], tri.iVertices[order[a]] ) ) {
+				std::swap( order[a], order[b] );
+			}
+		}
+	}
+
+	for( int m=0; m<3; m++ ) {
+		const unsigned int s = order[m];
+		c.slot[m] = s;
+		c.p[m] = m_vertices[tri.iVertices[s]];
+		c.n[m] = m_normals.size() ? m_normals[tri.iNormals[s]] : Vector3( 0, 0, 0 );
+		c.uv[m] = m_coords.size() ? m_coords[tri.iCoords[s]] : Point2( 0, 0 );
+	}
+}
+
+Point3 LazyDisplacedMesh::LatticePoint( const Corners& c, const unsigned int n, const int i, const int j, Vector3* baseNormal, Point2* uv ) const
+{
+	// Grid counts per triangle corner: i towards corner 1, j towards corner 2
+	const int count[3] = { int(n) - i - j, i, j };
+	const Scalar invN = 1.0 / Scalar( n );
+
+	Point3 pos( 0, 0, 0 );
+	Vector3 nrm( 0, 0, 0 );
+	Point2 tex( 0, 0 );
+	for( int m=0; m<3; m++ ) {
+		const int k = count[c.slot[m]];
+		if( k == 0 ) {
+			continue;
+		}
+		const Scalar w = Scalar( k ) * invN;
+		pos = Point3( pos.x + c.p[m].x*w, pos.y + c.p[m].y*w, pos.z + c.p[m].z*w );
+		nrm = Vector3( nrm.x + c.n[m].x*w, nrm.y + c.n[m].y*w, nrm.z + c.n[m].z*w );
+		tex = Point2( tex.x + c.uv[m].x*w, tex.y + c.uv[m].y*w );
+	}
+
+	// Displace along the unit interpolated normal.  A base that emits
+	// zero normals (BezierPatchGeometry) is not displaced at all, as in
+	// the eager bake, and shades with the coarse face normal.
+	const Scalar len = Vector3Ops::Magnitude( nrm );
+	const bool bHaveNormal = ( len > NEARZERO );
+	if( bHaveNormal ) {
+		nrm = nrm * ( 1.0 / len );
+	}
+
+	if( baseNormal ) {
+		if( bHaveNormal ) {
+			*baseNormal = nrm;
+		} else {
+			Point3 tri[3];
+			for( int m=0; m<3; m++ ) {
+				tri[c.slot[m]] = c.p[m];
+			}
+			*baseNormal = Vector3Ops::Normalize( Vector3Ops::Cross(
+				Vector3Ops::mkVector3( tri[1], tri[0] ),
+				Vector3Ops::mkVector3( tri[2], tri[0] ) ) );
+		}
+	}
+	if( uv ) *uv = tex;
+
+	if( bHaveNormal && m_pDisplacement && m_dispScale != 0.0 ) {
+		const Scalar u = m_bSeamFold ? TentFold( tex.x ) : tex.x;
+		const Scalar v = m_bSeamFold ? TentFold( tex.y ) : tex.y;
+		const Scalar d = m_pDisplacement->Evaluate( u, v ) * m_dispScale;
+		pos = Point3Ops::mkPoint3( pos, nrm * d );
+	}
+
+	return pos;
+}
+
+void LazyDisplacedMesh::EmitPatch(
+	const unsigned int		patch,
+	IndexTriangleListType&	tris,
+	VerticesListType&		vertices,
+	NormalsListType&		normals,
+	TexCoordsListType&		coords
+	) const
+{
+	Corners c;
+	GetCorners( patch, c );
+
+	const unsigned int N = m_N;
+	const unsigned int base = static_cast<unsigned int>( vertices.size() );
+
+	// With displacement and smooth shading the normals come from central
+	// differences on the displaced lattice, which needs a one-point apron
+	// outside the triangle (i,j >= -1, i+j <= N+1).  The lattice extends
+	// the coarse triangle's own linear interpolation, so the differences
+	// match the eager bake's topology normals on flat and smooth bases.
+	const bool bDisplaced = ( m_pDisplacement && m_dispScale != 0.0 );
+	const bool bApron = bDisplaced && !m_bUseFaceNormals;
+
+	const int W = int(N) + 3;
+	std::vector<Point3> apron;
+	if( bApron ) {
+		apron.resize( W*W );
+		for( int j=-1; j<=int(N)+1; j++ ) {
+			for( int i=-1; i<=int(N)+1-j; i++ ) {
+				apron[(j+1)*W + (i+1)] = LatticePoint( c, N, i, j, 0, 0 );
+			}
+		}
+	}
+
+	for( unsigned int j=0; j<=N; j++ ) {
+		for( unsigned int i=0; i<=N-j; i++ ) {
+			Vector3 nrm;
+			Point2 uv;
+			const Point3 pt = LatticePoint( c, N, i, j, &nrm, &uv );
+
+			if( bApron ) {
+				const int ai = int(i) + 1;
+				const int aj = int(j) + 1;
+				const Vector3 dPdi = Vector3Ops::mkVector3( apron[aj*W + ai+1], apron[aj*W + ai-1] );
+				const Vector3 dPdj = Vector3Ops::mkVector3( apron[(aj+1)*W + ai], apron[(aj-1)*W + ai] );
+				const Vector3 cross = Vector3Ops::Cross( dPdi, dPdj );
+				const Scalar len = Vector3Ops::Magnitude( cross );
+				if( len > NEARZERO ) {
+					nrm = cross * ( 1.0 / len );
+				}
+			}
+
+			vertices.push_back( pt );
+			normals.push_back( nrm );
+			coords.push_back( uv );
+		}
+	}
+
+	for( unsigned int j=0; j<N; j++ ) {
+		for( unsigned int i=0; i<N-j; i++ ) {
+			const unsigned int a = base + LatticeIndex( N, i, j );
+			const unsigned int b = base + LatticeIndex( N, i+1, j );
+			const unsigned int d = base + LatticeIndex( N, i, j+1 );
+			tris.push_back( MakeIndexedTriangleSameIdx( a, b, d ) );
+			if( i+j < N-1 ) {
+				const unsigned int e = base + LatticeIndex( N, i+1, j+1 );
+				tris.push_back( MakeIndexedTriangleSameIdx( b, e, d ) );
+			}
+		}
+	}
+}
+
+ITriangleMeshGeometryIndexed* LazyDisplacedMesh::BuildMicroMesh( const unsigned int patch ) const
+{
+	IndexTriangleListType tris;
+	VerticesListType      vertices;
+	NormalsListType       normals;
+	TexCoordsListType     coords;
+	EmitPatch( patch, tris, vertices, normals, coords );
+
+	ITriangleMeshGeometryIndexed* pMesh = new TriangleMeshGeometryIndexed( m_bDoubleSided, m_bUseFaceNormals );
+	GlobalLog()->PrintNew( pMesh, __FILE__, __LINE__, "lazy displaced micro-mesh" );
+
+	pMesh->BeginIndexedTriangles();
+	pMesh->AddVertices( vertices );
+	pMesh->AddNormals( normals );
+	pMesh->AddTexCoords( coords );
+	pMesh->AddIndexedTriangles( tris );
+	pMesh->DoneIndexedTriangles();
+
+	m_builds.fetch_add( 1, std::memory_order_relaxed );
+	return pMesh;
+}
+
+const ITriangleMeshGeometryIndexed* LazyDisplacedMesh::AcquireMicroMesh( const unsigned int patch ) const
+{
+	CacheShard& shard = m_shards[patch % kCacheShards];
+
+	{
+		std::lock_guard<std::mutex> lock( shard.mutex );
+		std::unordered_map<unsigned int, CacheList::iterator>::iterator it = shard.index.find( patch );
+		if( it != shard.index.end() ) {
+			shard.lru.splice( shard.lru.begin(), shard.lru, it->second );
+			ITriangleMeshGeometryIndexed* pMesh = it->second->pMesh;
+			pMesh->addref();
+			m_hits.fetch_add( 1, std::memory_order_relaxed );
+			return pMesh;
+		}
+	}
+
+	// Build outside the lock so other patches of this shard stay
+	// available.  Two threads missing the same patch both build; the
+	// loser throws its copy away below.
+	ITriangleMeshGeometryIndexed* pMesh = BuildMicroMesh( patch );
+	const unsigned int triangles = m_N*m_N;
+
+	std::vector<ITriangleMeshGeometryIndexed*> evicted;
+	{
+		std::lock_guard<std::mutex> lock( shard.mutex );
+		std::unordered_map<unsigned int, CacheList::iterator>::iterator it = shard.index.find( patch );
+		if( it != shard.index.end() ) {
+			evicted.push_back( pMesh );
+			shard.lru.splice( shard.lru.begin(), shard.lru, it->second );
+			pMesh = it->second->pMesh;
+		} else {
+			// Make room first, from the cold end, so the shard never holds
+			// more than its budget even for a moment
+			while( shard.triangles + triangles > m_shardBudget && !shard.lru.empty() ) {
+				const CacheEntry& cold = shard.lru.back();
+				evicted.push_back( cold.pMesh );
+				shard.index.erase( cold.patch );
+				shard.lru.pop_back();
+				shard.triangles -= triangles;
+				m_cachedTriangles.fetch_sub( triangles, std::memory_order_relaxed );
+			}
+
+			CacheEntry entry;
+			entry.patch = patch;
+			entry.pMesh = pMesh;
+			shard.lru.push_front( entry );
+			shard.index[patch] = shard.lru.begin();
+			shard.triangles += triangles;
+
+			const unsigned int now = m_cachedTriangles.fetch_add( triangles, std::memory_order_relaxed ) + triangles;
+			unsigned int peak = m_peakCachedTriangles.load( std::memory_order_relaxed );
+			while( now > peak && !m_peakCachedTriangles.compare_exchange_weak( peak, now, std::memory_order_relaxed ) ) {
+			}
+		}
+		pMesh->addref();
+	}
+
+	// Rays still using an evicted mesh hold their own reference
+	for( size_t i=0; i<evicted.size(); i++ ) {
+		evicted[i]->release();
+	}
+
+	return pMesh;
+}
+
+void LazyDisplacedMesh::FlushCache() const
+{
+	for( unsigned int s=0; s<kCacheShards; s++ ) {
+		CacheShard& shard = m_shards[s];
+		std::lock_guard<std::mutex> lock( shard.mutex );
+		for( CacheList::iterator it=shard.lru.begin(); it!=shard.lru.end(); it++ ) {
+			it->pMesh->release();
+		}
+		m_cachedTriangles.fetch_sub( shard.triangles, std::memory_order_relaxed );
+		shard.lru.clear();
+		shard.index.clear();
+		shard.triangles = 0;
+	}
+}
+
+LazyDisplacedMesh::Stats LazyDisplacedMesh::GetStats() const
+{
+	Stats s;
+	s.patches = static_cast<unsigned int>( m_patches.size() );
+	s.trianglesPerPatch = m_N*m_N;
+	s.builds = m_builds.load( std::memory_order_relaxed );
+	s.hits = m_hits.load( std::memory_order_relaxed );
+	s.cachedTriangles = m_cachedTriangles.load( std::memory_order_relaxed );
+	s.peakCachedTriangles = m_peakCachedTriangles.load( std::memory_order_relaxed );
+	return s;
+}
+
+void LazyDisplacedMesh::IntersectRay( RayIntersectionGeometric& ri, const bool bHitFrontFaces, const bool bHitBackFaces, const bool bComputeExitInfo ) const
+{
+	if( !m_pBVH ) {
+		return;
+	}
+
+	if( !bComputeExitInfo ) {
+		m_pBVH->IntersectRay( ri, bHitFrontFaces, bHitBackFaces );
+		return;
+	}
+
+	// Only the full traversal hands the exit flag down to the patches
+	RayIntersection rif( ri );
+	m_pBVH->IntersectRay( rif, bHitFrontFaces, bHitBackFaces, true );
+	ri = rif.geometric;
+}
+
+bool LazyDisplacedMesh::IntersectRay_IntersectionOnly( const Ray& ray, const Scalar dHowFar, const bool bHitFrontFaces, const bool bHitBackFaces ) const
+{
+	if( m_pBVH ) {
+		return m_pBVH->IntersectRay_IntersectionOnly( ray, dHowFar, bHitFrontFaces, bHitBackFaces );
+	}
+	return false;
+}
+
+void LazyDisplacedMesh::UniformRandomPoint( Point3* point, Vector3* normal, Point2* coord, const Point3& prand ) const
+{
+	if( m_areasCDF.empty() ) {
+		if( point )  *point  = Point3( 0.0, 0.0, 0.0 );
+		if( normal ) *normal = Vector3( 0.0, 0.0, 0.0 );
+		if( coord )  *coord  = Point2( 0.0, 0.0 );
+		return;
+	}
+
+	std::vector<Scalar>::const_iterator it = std::lower_bound( m_areasCDF.begin(), m_areasCDF.end(), prand.z );
+	unsigned int idx = static_cast<unsigned int>( m_areasCDF.size() ) - 1;
+	if( it != m_areasCDF.end() ) {
+		idx = static_cast<unsigned int>( std::distance( m_areasCDF.begin(), it ) );
+	}
+
+	// Stretch the part of prand.z that fell in this patch back over [0,1]
+	// for the micro-mesh's own triangle choice
+	const Scalar lo = idx > 0 ? m_areasCDF[idx-1] : 0;
+	const Scalar width = m_areasCDF[idx] - lo;
+	Scalar z = width > 0 ? ( prand.z - lo ) / width : 0;
+	z = z < 0 ? 0 : ( z > 1 ? 1 : z );
+
+	const ITriangleMeshGeometryIndexed* pMesh = AcquireMicroMesh( idx );
+	pMesh->UniformRandomPoint( point, normal, coord, Point3( prand.x, prand.y, z ) );
+	pMesh->release();
+}
+
+SurfaceDerivatives LazyDisplacedMesh::ComputeSurfaceDerivatives( const Point3& objSpacePoint, const Vector3& objSpaceNormal ) const
+{
+	// Linear walk over the patch boxes, like the mesh's own walk over
+	// its triangles; only the patches whose box holds the point are
+	// tessellated.
+	SurfaceDerivatives fallback;
+	bool bHaveFallback = false;
+
+	for( unsigned int p=0; p<m_patches.size(); p++ ) {
+		const BoundingBox& b = m_patches[p].bbox;
+		if( objSpacePoint.x < b.ll.x || objSpacePoint.x > b.ur.x ||
+			objSpacePoint.y < b.ll.y || objSpacePoint.y > b.ur.y ||
+			objSpacePoint.z < b.ll.z || objSpacePoint.z > b.ur.z ) {
+			continue;
+		}
+
+		const ITriangleMeshGeometryIndexed* pMesh = AcquireMicroMesh( p );
+		const SurfaceDerivatives sd = pMesh->ComputeSurfaceDerivatives( objSpacePoint, objSpaceNormal );
+		pMesh->release();
+
+		if( sd.valid ) {
+			return sd;
+		}
+		if( !bHaveFallback ) {
+			fallback = sd;
+			bHaveFallback = true;
+		}
+	}
+
+	if( !bHaveFallback && m_patches.size() ) {
+		const ITriangleMeshGeometryIndexed* pMesh = AcquireMicroMesh( 0 );
+		fallback = pMesh->ComputeSurfaceDerivatives( objSpacePoint, objSpaceNormal );
+		pMesh->release();
+	}
+
+	return fallback;
+}
+
+bool LazyDisplacedMesh::TessellateToMesh(
+	IndexTriangleListType&	tris,
+	VerticesListType&		vertices,
+	NormalsListType&		normals,
+	TexCoordsListType&		coords
+	) const
+{
+	// Emitted per patch, so vertices along coarse edges are duplicated
+	// (bit-identical positions).  Fine for rendering and nesting; a
+	// consumer that needs a welded mesh welds it.
+	const size_t perPatch = (m_N+1)*(m_N+2)/2;
+	vertices.reserve( vertices.size() + perPatch*m_patches.size() );
+	normals.reserve( normals.size() + perPatch*m_patches.size() );
+	coords.reserve( coords.size() + perPatch*m_patches.size() );
+	tris.reserve( tris.size() + size_t(m_N)*m_N*m_patches.size() );
+
+	for( unsigned int p=0; p<m_patches.size(); p++ ) {
+		EmitPatch( p, tris, vertices, normals, coords );
+	}
+	return true;
+}
+
+void LazyDisplacedMesh::IntersectPatch( RayIntersectionGeometric& ri, const MYOBJ elem, const bool bHitFrontFaces, const bool bHitBackFaces, const bool bComputeExitInfo ) const
+{
+	// Only tessellate patches the ray really reaches before its current
+	// closest hit; the BVH leaf may hold patches the ray misses
+	if( BoxEntry( ri.ray, elem->bbox ) > ri.range ) {
+		return;
+	}
+
+	const ITriangleMeshGeometryIndexed* pMesh = AcquireMicroMesh( elem->id );
+	pMesh->IntersectRay( ri, bHitFrontFaces, bHitBackFaces, bComputeExitInfo );
+	pMesh->release();
+}
+
+void LazyDisplacedMesh::RayElementIntersection( RayIntersectionGeometric& ri, const MYOBJ elem, const bool bHitFrontFaces, const bool bHitBackFaces ) const
+{
+	IntersectPatch( ri, elem, bHitFrontFaces, bHitBackFaces, false );
+}
+
+void LazyDisplacedMesh::RayElementIntersection( RayIntersection& ri, const MYOBJ elem, const bool bHitFrontFaces, const bool bHitBackFaces, const bool bComputeExitInfo ) const
+{
+	IntersectPatch( ri.geometric, elem, bHitFrontFaces, bHitBackFaces, bComputeExitInfo );
+}
+
+bool LazyDisplacedMesh::RayElementIntersection_IntersectionOnly( const Ray& ray, const Scalar dHowFar, const MYOBJ elem, const bool bHitFrontFaces, const bool bHitBackFaces ) const
+{
+	if( BoxEntry( ray, elem->bbox ) > dHowFar ) {
+		return false;
+	}
+
+	const ITriangleMeshGeometryIndexed* pMesh = AcquireMicroMesh( elem->id );
+	const bool bHit = pMesh->IntersectRay_IntersectionOnly( ray, dHowFar, bHitFrontFaces, bHitBackFaces );
+	pMesh->release();
+	return bHit;
+}
+
+BoundingBox LazyDisplacedMesh::GetElementBoundingBox( const MYOBJ elem ) const
+{
+	return elem->bbox;
+}
+
+bool LazyDisplacedMesh::ElementBoxIntersection( const MYOBJ elem, const BoundingBox& bbox ) const
+{
+	return bbox.DoIntersect( elem->bbox );
+}
+
+char LazyDisplacedMesh::WhichSideofPlaneIsElement( const MYOBJ elem, const Plane& plane ) const
+{
+	return GeometricUtilities::WhichSideOfPlane( plane, elem->bbox );
+}
+
+void LazyDisplacedMesh::SerializeElement( IWriteBuffer& /*buffer*/, const MYOBJ /*elem*/ ) const
+{
+	// Patches are rebuilt from the recipe at realize time, never serialized
+}
+
+void LazyDisplacedMesh::DeserializeElement( IReadBuffer& /*buffer*/, MYOBJ& ret ) const
+{
+	ret = 0;
+}
@@ -0,0 +1,212 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  LazyDisplacedMesh.h - On-demand displaced micro-meshes for
+//  DisplacedGeometry's lazy tessellation mode.
+//
+//  The eager DisplacedGeometry bake keeps every displaced vertex and
+//  its BVH resident for the life of the scene, which is what makes
+//  high-detail terrain or engraved dials run out of memory.  Here the
+//  base is tessellated only coarsely; every coarse triangle becomes a
+//  PATCH that is subdivided N x N and displaced into a micro-mesh the
+//  first time a ray actually reaches the patch's bounds.  Micro-meshes
+//  live in a shared, sharded LRU cache bounded by a triangle budget, so
+//  resident memory is proportional to what rays touch rather than to
+//  the full displaced surface.
+//
+//  Bounds are exact from the start.  Construction displaces every
+//  patch's full micro lattice once and keeps only the box and area of
+//  the result, so a patch box holds its micro-mesh however sharply the
+//  displacement peaks.  Realizing therefore evaluates the displacement
+//  about as often as the eager bake does; what it saves is the memory (and
+//  the normals, triangles and BVHs) of the micro-meshes.
+//
+//  Crack-freedom: a micro vertex is a weighted blend of the patch's
+//  three coarse corners.  The weights are integer grid counts over N
+//  and the terms are always summed in one global corner order with
+//  zero-weight terms dropped, so the two patches sharing a coarse edge
+//  compute bit-identical positions for every vertex along it.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//  Comments:
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#ifndef LAZY_DISPLACED_MESH_
+#define LAZY_DISPLACED_MESH_
+
+#include "../Interfaces/IFunction2D.h"
+#include "../Interfaces/IGeometry.h"
+#include "../Interfaces/ITriangleMeshGeometry.h"
+#include "../Acceleration/BVH.h"
+#include "../Utilities/Reference.h"
+#include "../Utilities/BoundingBox.h"
+#include "../Polygon.h"
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace RISE
+{
+	//! One coarse base triangle of a LazyDisplacedMesh.  The patch BVH
+	//! stores pointers to these; the micro-mesh is looked up by id.
+	struct DisplacedPatch
+	{
+		unsigned int		id;
+		BoundingBox			bbox;		///< Box of the displaced micro-mesh (padded)
+	};
+
+	namespace Implementation
+	{
+		class LazyDisplacedMesh :
+			public virtual Reference,
+			public virtual TreeElementProcessor<const DisplacedPatch*>
+		{
+		public:
+			//! Cache counters, for logs and tests
+			struct Stats
+			{
+				unsigned int		patches;				///< Coarse patches in the BVH
+				unsigned int		trianglesPerPatch;		///< N*N
+				unsigned long long	builds;					///< Micro-meshes built (incl. rebuilds after eviction)
+				unsigned long long	hits;					///< Lookups served from the cache
+				unsigned int		cachedTriangles;		///< Triangles resident right now
+				unsigned int		peakCachedTriangles;	///< High-water mark of cachedTriangles
+			};
+
+			//! Takes the coarse base tessellation.  The lists are swapped
+			//! out of the arguments.  All the one-off work (patch bounds,
+			//! areas, patch BVH) happens here.
+			LazyDisplacedMesh(
+				IndexTriangleListType&	tris,				///< [in/out] Coarse triangles (emptied)
+				VerticesListType&		vertices,			///< [in/out] Coarse vertices (emptied)
+				NormalsListType&		normals,			///< [in/out] Coarse vertex normals (emptied)
+				TexCoordsListType&		coords,				///< [in/out] Coarse texture coordinates (emptied)
+				const IFunction2D*		displacement,		///< [in] Displacement, may be null
+				const Scalar			dispScale,			///< [in] Displacement scale
+				const bool				bSeamFold,			///< [in] Tent-fold the uv before evaluating the displacement
+				const unsigned int		subdivision,		///< [in] N, micro-mesh subdivisions per patch edge
+				const unsigned int		cacheTriangles,		///< [in] Budget of resident micro-mesh triangles
+				const bool				bDoubleSided,
+				const bool				bUseFaceNormals
+				);
+
+			void IntersectRay( RayIntersectionGeometric& ri, const bool bHitFrontFaces, const bool bHitBackFaces, const bool bComputeExitInfo ) const;
+			bool IntersectRay_IntersectionOnly( const Ray& ray, const Scalar dHowFar, const bool bHitFrontFaces, const bool bHitBackFaces ) const;
+
+			BoundingBox GetBoundingBox() const { return m_bbox; }
+			Scalar GetArea() const { return m_totalArea; }
+
+			void UniformRandomPoint( Point3* point, Vector3* normal, Point2* coord, const Point3& prand ) const;
+			SurfaceDerivatives ComputeSurfaceDerivatives( const Point3& objSpacePoint, const Vector3& objSpaceNormal ) const;
+
+			//! Emits every patch's micro-mesh, fully resident.  For nesting
+			//! and export; bypasses the cache.
+			bool TessellateToMesh( IndexTriangleListType& tris, VerticesListType& vertices, NormalsListType& normals, TexCoordsListType& coords ) const;
+
+			Stats GetStats() const;
+
+			//! Drops every cached micro-mesh (painter changed, tests)
+			void FlushCache() const;
+
+			// From TreeElementProcessor
+			typedef const DisplacedPatch*	MYOBJ;
+				void RayElementIntersection( RayIntersectionGeometric& ri, const MYOBJ elem, const bool bHitFrontFaces, const bool bHitBackFaces ) const;
+				void RayElementIntersection( RayIntersection& ri, const MYOBJ elem, const bool bHitFrontFaces, const bool bHitBackFaces, const bool bComputeExitInfo ) const;
+				bool RayElementIntersection_IntersectionOnly( const Ray& ray, const Scalar dHowFar, const MYOBJ elem, const bool bHitFrontFaces, const bool bHitBackFaces ) const;
+				BoundingBox GetElementBoundingBox( const MYOBJ elem ) const;
+				bool ElementBoxIntersection( const MYOBJ elem, const BoundingBox& bbox ) const;
+				char WhichSideofPlaneIsElement( const MYOBJ elem, const Plane& plane ) const;
+
+			void SerializeElement( IWriteBuffer& buffer, const MYOBJ elem ) const;
+			void DeserializeElement( IReadBuffer& buffer, MYOBJ& ret ) const;
+
+		protected:
+			virtual ~LazyDisplacedMesh();
+
+			//! Coarse corner data of one patch, ordered canonically
+			struct Corners
+			{
+				Point3			p[3];
+				Vector3			n[3];
+				Point2			uv[3];
+				unsigned int	slot[3];		///< which of the triangle's corners each entry is
+			};
+
+			void GetCorners( const unsigned int patch, Corners& c ) const;
+
+			//! Displaced position of point (i,j) of the patch's n x n
+			//! lattice, with i counting towards corner 1 and j towards
+			//! corner 2 of the coarse triangle.  Valid slightly outside the
+			//! triangle too (the normal apron).
+			Point3 LatticePoint( const Corners& c, const unsigned int n, const int i, const int j, Vector3* baseNormal, Point2* uv ) const;
+
+			//! Builds the micro-mesh of one patch into the given lists
+			void EmitPatch( const unsigned int patch, IndexTriangleListType& tris, VerticesListType& vertices, NormalsListType& normals, TexCoordsListType& coords ) const;
+
+			//! Returns the patch's micro-mesh with a reference held for the
+			//! caller, building it if it is not cached
+			const ITriangleMeshGeometryIndexed* AcquireMicroMesh( const unsigned int patch ) const;
+
+			ITriangleMeshGeometryIndexed* BuildMicroMesh( const unsigned int patch ) const;
+
+			//! Intersects the patch's micro-mesh if the ray reaches its box
+			//! before the current closest hit
+			void IntersectPatch( RayIntersectionGeometric& ri, const MYOBJ elem, const bool bHitFrontFaces, const bool bHitBackFaces, const bool bComputeExitInfo ) const;
+
+			//! One shard of the micro-mesh LRU.  Each holds a reference on
+			//! its meshes; a mesh evicted while a ray is using it stays
+			//! alive until that ray releases it.
+			struct CacheEntry
+			{
+				unsigned int							patch;
+				ITriangleMeshGeometryIndexed*			pMesh;
+			};
+			typedef std::list<CacheEntry>				CacheList;
+
+			struct CacheShard
+			{
+				std::mutex														mutex;
+				CacheList														lru;		///< most recently used first
+				std::unordered_map<unsigned int, CacheList::iterator>			index;
+				unsigned int													triangles;
+			};
+
+			static const unsigned int kCacheShards = 16;
+
+			IndexTriangleListType			m_tris;
+			VerticesListType				m_vertices;
+			NormalsListType					m_normals;
+			TexCoordsListType				m_coords;
+
+			const IFunction2D*				m_pDisplacement;
+			const Scalar					m_dispScale;
+			const bool						m_bSeamFold;
+			const unsigned int				m_N;
+			const bool						m_bDoubleSided;
+			const bool						m_bUseFaceNormals;
+
+			std::vector<DisplacedPatch>		m_patches;
+			std::vector<Scalar>				m_areasCDF;
+			Scalar							m_totalArea;
+			BoundingBox						m_bbox;
+
+			BVH<const DisplacedPatch*>*		m_pBVH;
+
+			unsigned int					m_shardBudget;		///< triangles per shard
+			mutable CacheShard				m_shards[kCacheShards];
+
+			mutable std::atomic<unsigned long long>	m_builds;
+			mutable std::atomic<unsigned long long>	m_hits;
+			mutable std::atomic<unsigned int>		m_cachedTriangles;
+			mutable std::atomic<unsigned int>		m_peakCachedTriangles;
+		};
+	}
+}
+
+#endif
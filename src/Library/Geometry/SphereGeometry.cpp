@@ -177,6 +177,15 @@ BoundingBox SphereGeometry::GenerateBoundingBox() const
 		Point3( m_dRadius, m_dRadius, m_dRadius ) );
 }
 
+bool SphereGeometry::GetAnalyticShape( AnalyticShape& shape ) const
+{
+	shape.bounds = GenerateBoundingBox();
+	shape.q = Vector3( 1, 1, 1 );
+	shape.radius2 = m_dSqrRadius;
+	shape.bQuadric = true;
+	return true;
+}
+
 void SphereGeometry::UniformRandomPoint( Point3* point, Vector3* normal, Point2* coord, const Point3& prand ) const
 {
 	Point3 pt = GeometricUtilities::PointOnSphere( Point3(0,0,0), m_dRadius, Point2( prand.x, prand.y ) );
@@ -180,6 +180,21 @@ BoundingBox TorusGeometry::GenerateBoundingBox() const
 		Point3( m_dMajorRadius+m_dMinorRadius, m_dMajorRadius+m_dMinorRadius, m_dMajorRadius+m_dMinorRadius ) );
 }
 
+bool TorusGeometry::GetAnalyticShape( AnalyticShape& shape ) const
+{
+	// The ring lies in the xz plane, so it is much flatter than the cube
+	// GenerateBoundingBox reports, and a tube of radius R+r about y holds
+	// it.  The quartic roots can land a hair off the surface, so both
+	// are widened a little.
+	const Scalar outer = (m_dMajorRadius + m_dMinorRadius) * (1.0 + 1e-4);
+	const Scalar height = m_dMinorRadius * (1.0 + 1e-4) + outer * 1e-6;
+	shape.bounds = BoundingBox( Point3( -outer, -height, -outer ), Point3( outer, height, outer ) );
+	shape.q = Vector3( 1, 0, 1 );
+	shape.radius2 = outer * outer;
+	shape.bQuadric = true;
+	return true;
+}
+
 void TorusGeometry::UniformRandomPoint( Point3* point, Vector3* normal, Point2* coord, const Point3& prand ) const
 {
 	// R = m_p0 (center of tube ring), r = m_p1 (tube radius)
@@ -0,0 +1,298 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  TriangleMeshCache.cpp - Implementation of the on-disk triangle
+//  mesh cache
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//  Comments:
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "TriangleMeshCache.h"
+#include "../Interfaces/ILog.h"
+#include "../Interfaces/IOptions.h"
+#include "../Utilities/MediaPathLocator.h"
+#include "../Utilities/MemoryBuffer.h"
+#include "../Utilities/DiskFileWriteBuffer.h"
+#include <atomic>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <vector>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+using namespace RISE;
+using namespace RISE::Implementation;
+
+namespace
+{
+	const std::uint64_t kFnvBasis = 14695981039346656037ull;
+	const std::uint64_t kFnvPrime = 1099511628211ull;
+
+	// Entry layout: header, .risemesh payload, trailer
+	const char kEntryMagic[4] = { 'R', 'M', 'C', 'E' };
+	const unsigned int kHeaderSize = sizeof( kEntryMagic ) + 4 * sizeof( unsigned int );
+
+	struct EntryTrailer
+	{
+		std::uint64_t	length;			///< Bytes before the trailer
+		std::uint64_t	checksum;		///< FNV-1a of those bytes, then of the length
+	};
+
+	// Tells apart the temporaries of concurrent stores in one process
+	std::atomic<unsigned int> s_storeSerial( 0 );
+
+	inline void HashBytes( std::uint64_t& h, const void* data, const size_t size )
+	{
+		const unsigned char* p = static_cast<const unsigned char*>( data );
+		for( size_t i=0; i<size; i++ ) {
+			h ^= p[i];
+			h *= kFnvPrime;
+		}
+	}
+
+	inline void HashString( std::uint64_t& h, const std::string& s )
+	{
+		// Length first so ("ab","c") and ("a","bc") differ
+		const std::uint64_t len = s.size();
+		HashBytes( h, &len, sizeof( len ) );
+		HashBytes( h, s.data(), s.size() );
+	}
+
+	//! Folds the whole file into h
+	/// \return FALSE if the file can't be read
+	bool HashFile( std::uint64_t& h, const char* szPath )
+	{
+		FILE* f = fopen( szPath, "rb" );
+		if( !f ) {
+			return false;
+		}
+
+		std::vector<unsigned char> chunk( 1 << 20 );
+		std::uint64_t total = 0;
+		size_t got = 0;
+		while( (got = fread( &chunk[0], 1, chunk.size(), f )) > 0 ) {
+			HashBytes( h, &chunk[0], got );
+			total += got;
+		}
+		const bool bError = ferror( f ) != 0;
+		fclose( f );
+
+		HashBytes( h, &total, sizeof( total ) );
+		return !bError;
+	}
+
+	std::uint64_t Checksum( const char* data, const std::uint64_t length )
+	{
+		std::uint64_t h = kFnvBasis;
+		HashBytes( h, data, static_cast<size_t>( length ) );
+		HashBytes( h, &length, sizeof( length ) );
+		return h;
+	}
+
+	bool IsDirectory( const char* szPath )
+	{
+		struct stat st;
+		return stat( szPath, &st ) == 0 && (st.st_mode & S_IFDIR);
+	}
+}
+
+TriangleMeshCache::TriangleMeshCache(
+	const char* loaderTag,
+	const char* szFileName,
+	const std::string& params
+	)
+{
+	const String dir = GlobalOptions().ReadString( "mesh_cache_directory", "" );
+	Init( dir.c_str(), loaderTag, szFileName, params );
+}
+
+TriangleMeshCache::TriangleMeshCache(
+	const char* cacheDirectory,
+	const char* loaderTag,
+	const char* szFileName,
+	const std::string& params
+	)
+{
+	Init( cacheDirectory, loaderTag, szFileName, params );
+}
+
+void TriangleMeshCache::Init(
+	const char* cacheDirectory,
+	const char* loaderTag,
+	const char* szFileName,
+	const std::string& params
+	)
+{
+	if( !cacheDirectory || !cacheDirectory[0] || !loaderTag || !szFileName ) {
+		return;
+	}
+
+	if( !IsDirectory( cacheDirectory ) ) {
+		GlobalLog()->PrintEx( eLog_Warning, "TriangleMeshCache:: mesh_cache_directory `%s` is not a directory, mesh cache disabled", cacheDirectory );
+		return;
+	}
+
+	std::uint64_t h = kFnvBasis;
+	const unsigned int version = kKeyVersion;
+	HashBytes( h, &version, sizeof( version ) );
+	HashString( h, loaderTag );
+	HashString( h, params );
+
+	const String resolved = GlobalMediaPathLocator().Find( szFileName );
+	if( !HashFile( h, resolved.c_str() ) ) {
+		return;
+	}
+
+	char name[64];
+	snprintf( name, sizeof( name ), "%016llx", static_cast<unsigned long long>( h ) );
+
+	m_path = cacheDirectory;
+	const char last = m_path[m_path.size()-1];
+	if( last != '/' && last != '\\' ) {
+		m_path += '/';
+	}
+	m_path += loaderTag;
+	m_path += '-';
+	m_path += name;
+	m_path += ".risemesh";
+}
+
+bool TriangleMeshCache::Load( ITriangleMeshGeometryIndexed& geom ) const
+{
+	if( !IsEnabled() ) {
+		return false;
+	}
+
+	struct stat st;
+	if( stat( m_path.c_str(), &st ) != 0 || st.st_size <= 0 ) {
+		return false;
+	}
+
+	MemoryBuffer* pBuffer = new MemoryBuffer( m_path.c_str() );
+	GlobalLog()->PrintNew( pBuffer, __FILE__, __LINE__, "mesh cache buffer" );
+
+	const char* reason = 0;
+	const unsigned int size = pBuffer->Size();
+	EntryTrailer trailer;
+	char magic[4];
+	unsigned int numPoints = 0, numNormals = 0, numCoords = 0;
+
+	if( size < kHeaderSize + sizeof( trailer ) ) {
+		reason = "truncated";
+	} else {
+		memcpy( &trailer, pBuffer->Pointer() + size - sizeof( trailer ), sizeof( trailer ) );
+		if( trailer.length != size - sizeof( trailer ) ) {
+			reason = "truncated";
+		} else if( trailer.checksum != Checksum( pBuffer->Pointer(), trailer.length ) ) {
+			reason = "checksum mismatch";
+		} else {
+			pBuffer->getBytes( magic, sizeof( magic ) );
+			const unsigned int version = pBuffer->getUInt();
+			numPoints = pBuffer->getUInt();
+			numNormals = pBuffer->getUInt();
+			numCoords = pBuffer->getUInt();
+			if( memcmp( magic, kEntryMagic, sizeof( magic ) ) != 0 || version != kFormatVersion ) {
+				reason = "unknown format";
+			} else if( numPoints == 0 ) {
+				reason = "empty mesh";
+			}
+		}
+	}
+
+	if( !reason ) {
+		geom.Deserialize( *pBuffer );
+		if( pBuffer->getCurPos() != trailer.length ) {
+			reason = "payload size mismatch";
+		} else if( geom.numPoints() != numPoints || geom.numNormals() != numNormals || geom.numCoords() != numCoords ) {
+			reason = "count mismatch";
+		}
+	}
+	safe_release( pBuffer );
+
+	if( reason ) {
+		GlobalLog()->PrintEx( eLog_Warning, "TriangleMeshCache:: Ignoring cache entry `%s` (%s)", m_path.c_str(), reason );
+		return false;
+	}
+
+	GlobalLog()->PrintEx( eLog_Event, "TriangleMeshCache:: Loaded `%s` from the mesh cache", m_path.c_str() );
+	return true;
+}
+
+bool TriangleMeshCache::Store( const ITriangleMeshGeometryIndexed& geom ) const
+{
+	if( !IsEnabled() ) {
+		return false;
+	}
+
+	// Two threads of one process can store the same entry (two
+	// geometries built from one file), so the pid alone won't do
+	char suffix[80];
+	snprintf( suffix, sizeof( suffix ), ".%d.%llx.%u.tmp",
+		static_cast<int>( getpid() ),
+		static_cast<unsigned long long>( std::hash<std::thread::id>()( std::this_thread::get_id() ) ),
+		s_storeSerial.fetch_add( 1 ) );
+	const std::string temp = m_path + suffix;
+
+	DiskFileWriteBuffer* pBuffer = new DiskFileWriteBuffer( temp.c_str() );
+	GlobalLog()->PrintNew( pBuffer, __FILE__, __LINE__, "mesh cache write buffer" );
+	const bool bOpen = pBuffer->ReadyToWrite();
+	if( bOpen ) {
+		pBuffer->setBytes( kEntryMagic, sizeof( kEntryMagic ) );
+		pBuffer->setUInt( kFormatVersion );
+		pBuffer->setUInt( geom.numPoints() );
+		pBuffer->setUInt( geom.numNormals() );
+		pBuffer->setUInt( geom.numCoords() );
+		geom.Serialize( *pBuffer );
+	}
+	safe_release( pBuffer );		// closes the file
+
+	// The trailer checksums what actually reached the disk, folded the
+	// same way as Checksum
+	bool bWritten = false;
+	struct stat st;
+	EntryTrailer trailer;
+	trailer.checksum = kFnvBasis;
+	if( bOpen && stat( temp.c_str(), &st ) == 0 && HashFile( trailer.checksum, temp.c_str() ) ) {
+		trailer.length = static_cast<std::uint64_t>( st.st_size );
+		FILE* f = trailer.length > kHeaderSize ? fopen( temp.c_str(), "ab" ) : 0;
+		if( f ) {
+			bWritten = fwrite( &trailer, sizeof( trailer ), 1, f ) == 1;
+			bWritten = (fclose( f ) == 0) && bWritten;
+		}
+	}
+
+	if( !bWritten ) {
+		remove( temp.c_str() );
+		if( bOpen ) {
+			GlobalLog()->PrintEx( eLog_Warning, "TriangleMeshCache:: Failed to write cache entry `%s`", temp.c_str() );
+		}
+		return false;
+	}
+
+	// rename() won't replace an existing file on Windows; another
+	// process may have published the same entry first, which is fine
+	remove( m_path.c_str() );
+	if( rename( temp.c_str(), m_path.c_str() ) != 0 ) {
+		remove( temp.c_str() );
+		GlobalLog()->PrintEx( eLog_Warning, "TriangleMeshCache:: Failed to publish cache entry `%s`", m_path.c_str() );
+		return false;
+	}
+
+	GlobalLog()->PrintEx( eLog_Event, "TriangleMeshCache:: Stored `%s` in the mesh cache", m_path.c_str() );
+	return true;
+}
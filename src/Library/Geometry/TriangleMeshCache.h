@@ -0,0 +1,95 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  TriangleMeshCache.h - Opt-in on-disk cache of realized triangle
+//  meshes, so re-loading an unchanged scene skips the mesh parse and
+//  the BVH build.
+//
+//  A cache entry is the .risemesh serialization of the mesh (which
+//  already carries the BVH) between a small header and trailer, named
+//  by a 64-bit FNV-1a digest of everything the realized mesh depends
+//  on: the loader, the loader's parameters and the full contents of
+//  the source file.  Editing the source in any way changes the name,
+//  so entries never go stale -- they are just no longer found.
+//
+//  The header holds a magic, the entry format version and the vertex,
+//  normal and texture coordinate counts; the trailer holds the length
+//  of everything before it and an FNV-1a checksum of those bytes.  An
+//  entry that fails any of these checks, or whose mesh deserializes to
+//  other counts or to other than exactly its payload, is a miss.
+//  Entries are written to a temporary name unique to the process,
+//  thread and call, then renamed into place.
+//
+//  Enabled by pointing the `mesh_cache_directory` global option at an
+//  existing directory.  With the option unset every call is a no-op.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//  Comments:
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#ifndef TRIANGLE_MESH_CACHE_
+#define TRIANGLE_MESH_CACHE_
+
+#include "../Interfaces/ITriangleMeshGeometry.h"
+#include <string>
+
+namespace RISE
+{
+	namespace Implementation
+	{
+		class TriangleMeshCache
+		{
+		public:
+			//! Bump when the realized mesh for the same inputs would change
+			//! (loader fixes, BVH build changes), to orphan old entries
+			static const unsigned int kKeyVersion = 2;
+
+			//! Bump when the layout of an entry changes
+			static const unsigned int kFormatVersion = 1;
+
+			//! Uses the `mesh_cache_directory` global option
+			TriangleMeshCache(
+				const char* loaderTag,				///< [in] Which loader built the mesh ("ply", "3ds", ...)
+				const char* szFileName,				///< [in] Source file, resolved through the media path
+				const std::string& params			///< [in] Every loader/geometry parameter that affects the result
+				);
+
+			//! Explicit cache directory (tests, tools).  An empty
+			//! directory disables the cache.
+			TriangleMeshCache(
+				const char* cacheDirectory,
+				const char* loaderTag,
+				const char* szFileName,
+				const std::string& params
+				);
+
+			//! False when the cache is off or the source can't be read
+			bool IsEnabled() const { return !m_path.empty(); }
+
+			//! Fills geom from the cache entry if there is one and it
+			//! checks out.  An entry that fails after its mesh has been
+			//! read may leave geom partly filled, so on FALSE the caller
+			//! builds a fresh geometry rather than reusing this one.
+			/// \return TRUE on a hit, FALSE otherwise
+			bool Load( ITriangleMeshGeometryIndexed& geom ) const;
+
+			//! Writes geom as the cache entry.  Failures are logged and
+			//! otherwise ignored; the cache is only ever an accelerator.
+			bool Store( const ITriangleMeshGeometryIndexed& geom ) const;
+
+			//! Full path of the entry ("" when disabled)
+			const std::string& EntryPath() const { return m_path; }
+
+		protected:
+			void Init( const char* cacheDirectory, const char* loaderTag, const char* szFileName, const std::string& params );
+
+			std::string		m_path;
+		};
+	}
+}
+
+#endif
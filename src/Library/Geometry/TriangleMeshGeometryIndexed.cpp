@@ -28,9 +28,10 @@
 #include "../Octree.h"
 #include "../BSPTreeSAH.h"
 #include <cmath>
+#include <algorithm>
+#include <unordered_map>
 #ifdef RISE_ENABLE_MAILBOXING
 #include <atomic>
-#include <unordered_map>
 #endif
 
 inline unsigned int VoidPtrToUInt( const void* v )
@@ -64,6 +65,94 @@ namespace {
 }
 #endif
 
+namespace {
+	//
+	// Compact layout encodings
+	//
+
+	// Octahedral (u, v) in [-1,1] -> snorm16 pair (low half u, high half v)
+	inline uint32_t PackOctahedral( const Scalar u, const Scalar v )
+	{
+		const int16_t su = (int16_t)std::lround( std::min( std::max( u, Scalar(-1) ), Scalar(1) ) * 32767.0 );
+		const int16_t sv = (int16_t)std::lround( std::min( std::max( v, Scalar(-1) ), Scalar(1) ) * 32767.0 );
+		return uint32_t( uint16_t( su ) ) | ( uint32_t( uint16_t( sv ) ) << 16 );
+	}
+
+	inline Vector3 DecodeOctahedral( const uint32_t e )
+	{
+		Scalar u = Scalar( int16_t( e & 0xFFFF ) ) / 32767.0;
+		Scalar v = Scalar( int16_t( e >> 16 ) ) / 32767.0;
+		const Scalar z = 1.0 - fabs( u ) - fabs( v );
+		if( z < 0 ) {
+			const Scalar fu = ( 1.0 - fabs( v ) ) * ( u >= 0 ? 1.0 : -1.0 );
+			const Scalar fv = ( 1.0 - fabs( u ) ) * ( v >= 0 ? 1.0 : -1.0 );
+			u = fu;
+			v = fv;
+		}
+		return Vector3Ops::Normalize( Vector3( u, v, z ) );
+	}
+
+	// Projects onto the octahedron, then keeps whichever of the four
+	// neighbouring snorm16 pairs decodes closest to the input
+	inline uint32_t EncodeOctahedral( const Vector3& n )
+	{
+		const Scalar l1 = fabs( n.x ) + fabs( n.y ) + fabs( n.z );
+		if( !( l1 > 0 ) ) {
+			return PackOctahedral( 0, 0 );
+		}
+		Scalar u = n.x / l1, v = n.y / l1;
+		if( n.z < 0 ) {
+			const Scalar fu = ( 1.0 - fabs( v ) ) * ( u >= 0 ? 1.0 : -1.0 );
+			const Scalar fv = ( 1.0 - fabs( u ) ) * ( v >= 0 ? 1.0 : -1.0 );
+			u = fu;
+			v = fv;
+		}
+		const Vector3 unit = Vector3Ops::Normalize( n );
+		const Scalar fu = floor( u * 32767.0 ), fv = floor( v * 32767.0 );
+		uint32_t best = PackOctahedral( u, v );
+		Scalar bestDot = Vector3Ops::Dot( DecodeOctahedral( best ), unit );
+		for( int i = 0; i < 4; i++ ) {
+			const uint32_t e = PackOctahedral( ( fu + ( i & 1 ) ) / 32767.0, ( fv + ( i >> 1 ) ) / 32767.0 );
+			const Scalar d = Vector3Ops::Dot( DecodeOctahedral( e ), unit );
+			if( d > bestDot ) {
+				best = e;
+				bestDot = d;
+			}
+		}
+		return best;
+	}
+
+	inline TexCoord DecodeUnorm16Pair( const uint32_t e, const Scalar mn[2], const Scalar scale[2] )
+	{
+		return TexCoord( mn[0] + Scalar( e & 0xFFFF ) * scale[0], mn[1] + Scalar( e >> 16 ) * scale[1] );
+	}
+
+	// Spreads the low 10 bits of x out to every third bit
+	inline uint32_t MortonSpread3( uint32_t x )
+	{
+		x &= 0x3FF;
+		x = ( x | ( x << 16 ) ) & 0x030000FF;
+		x = ( x | ( x <<  8 ) ) & 0x0300F00F;
+		x = ( x | ( x <<  4 ) ) & 0x030C30C3;
+		x = ( x | ( x <<  2 ) ) & 0x09249249;
+		return x;
+	}
+
+	struct CornerKey
+	{
+		unsigned int v, n, c;
+		bool operator==( const CornerKey& o ) const { return v == o.v && n == o.n && c == o.c; }
+	};
+
+	struct CornerKeyHash
+	{
+		size_t operator()( const CornerKey& k ) const
+		{
+			return ( size_t( k.v ) * 73856093u ) ^ ( size_t( k.n ) * 19349663u ) ^ ( size_t( k.c ) * 83492791u );
+		}
+	};
+}
+
 #include "../Intersection/TextureFootprintCompute.h"
 #include "TriangleMeshGeometryIndexedSpecializations.h"
 
@@ -73,11 +162,16 @@ TriangleMeshGeometryIndexed::TriangleMeshGeometryIndexed(
 	) :
   bDoubleSided( bDoubleSided_ ),
   bUseFaceNormals( bUseFaceNormals_ ),
+  bCompact( false ),
+  nCompactVertices( 0 ),
+  nCompactTriangles( 0 ),
   pPtrBVH( 0 )
 #ifdef RISE_ENABLE_MAILBOXING
   , geometryId( s_nextGeometryId.fetch_add(1) )
 #endif
 {
+	cCoordMin[0] = cCoordMin[1] = 0;
+	cCoordScale[0] = cCoordScale[1] = 0;
 }
 
 TriangleMeshGeometryIndexed::~TriangleMeshGeometryIndexed()
@@ -103,15 +197,17 @@ bool TriangleMeshGeometryIndexed::TessellateToMesh(
 	// overwrite.
 	//
 	// DoneIndexedTriangles() clears indexedtris after converting to pointer-triangle
-	// form, so ptr_polygons is the authoritative source.
-	if( ptr_polygons.empty() ) {
+	// (or compact) form, so the resolved triangles are the authoritative source.
+	const unsigned int nTris = static_cast<unsigned int>( numTriangles() );
+	if( nTris == 0 ) {
 		return false;
 	}
 
 	const unsigned int baseIdx = static_cast<unsigned int>( vertices.size() );
 
-	for( MyPointerTriangleList::const_iterator it = ptr_polygons.begin(); it != ptr_polygons.end(); ++it ) {
-		const PointerTriangle& src = *it;
+	for( unsigned int ti = 0; ti < nTris; ti++ ) {
+		TriangleCorners corners;
+		const PointerTriangle& src = ResolveTriangle( ti, corners );
 
 		// For face-normals source meshes, pNormals is empty and every src.pNormals[k]
 		// is null.  We can't emit a constant placeholder like +Z — downstream code
@@ -155,7 +251,7 @@ void TriangleMeshGeometryIndexed::IntersectRay( RayIntersectionGeometric& ri, co
 	// Bump the mailbox ray ID so duplicate triangles in multiple BSP leaves are skipped
 #ifdef RISE_ENABLE_MAILBOXING
 	{
-		MailboxState& mb = GetMailbox(geometryId, ptr_polygons.size());
+		MailboxState& mb = GetMailbox(geometryId, numTriangles());
 		++mb.rayId;
 	}
 #endif
@@ -192,7 +288,7 @@ bool TriangleMeshGeometryIndexed::IntersectRay_IntersectionOnly( const Ray& ray,
 {
 #ifdef RISE_ENABLE_MAILBOXING
 	{
-		MailboxState& mb = GetMailbox(geometryId, ptr_polygons.size());
+		MailboxState& mb = GetMailbox(geometryId, numTriangles());
 		++mb.rayId;
 	}
 #endif
@@ -214,7 +310,8 @@ void TriangleMeshGeometryIndexed::UniformRandomPoint( Point3* point, Vector3* no
 		idx = static_cast<int>(std::distance( areasCDF.begin(), it ));
 	}
 
-	GeometricUtilities::PointOnTriangle( point, normal, coord, ptr_polygons[idx], prand.x, prand.y );
+	TriangleCorners corners;
+	GeometricUtilities::PointOnTriangle( point, normal, coord, ResolveTriangle( idx, corners ), prand.x, prand.y );
 }
 
 Scalar TriangleMeshGeometryIndexed::GetArea( ) const
@@ -320,6 +417,11 @@ unsigned int TriangleMeshGeometryIndexed::UpdateVertices(
 	// DisplacedGeometry.  Topology (ptr_polygons indices) is preserved;
 	// only vertex positions and normals change.
 
+	if( bCompact ) {
+		GlobalLog()->PrintEasyError(
+			"TriangleMeshGeometryIndexed::UpdateVertices:: a compact mesh cannot be refit" );
+		return 0;
+	}
 	if( !pPtrBVH ) {
 		GlobalLog()->PrintEasyWarning(
 			"TriangleMeshGeometryIndexed::UpdateVertices:: no BVH yet — call DoneIndexedTriangles first" );
@@ -375,27 +477,7 @@ unsigned int TriangleMeshGeometryIndexed::UpdateVertices(
 			"rebuilding BVH from polygon data instead of refit",
 			(double)pPtrBVH->SAHDegradationRatio() );
 
-		safe_release( pPtrBVH );
-
-		BoundingBox bbox( Point3( RISE_INFINITY, RISE_INFINITY, RISE_INFINITY ),
-		                  Point3(-RISE_INFINITY,-RISE_INFINITY,-RISE_INFINITY ) );
-		std::vector<const PointerTriangle*> temp;
-		for( MyPointerTriangleList::iterator pi = ptr_polygons.begin(); pi != ptr_polygons.end(); ++pi ) {
-			temp.push_back( &(*pi) );
-		}
-		for( MyPointsList::const_iterator mi = pPoints.begin(); mi != pPoints.end(); ++mi ) {
-			bbox.Include( *mi );
-		}
-
-		AccelerationConfig cfg;
-		cfg.maxLeafSize         = 4;
-		cfg.binCount            = 32;
-		cfg.sahTraversalCost    = 1.0;
-		cfg.sahIntersectionCost = 1.0;
-		cfg.doubleSided         = bDoubleSided;
-
-		pPtrBVH = new BVH<const PointerTriangle*>( *this, temp, bbox, cfg );
-		GlobalLog()->PrintNew( pPtrBVH, __FILE__, __LINE__, "pointers BVH (rebuilt after SAH-degradation)" );
+		BuildPolygonBVH( "pointers BVH (rebuilt after SAH-degradation)" );
 	}
 
 	return refitMs;
@@ -417,11 +499,13 @@ void TriangleMeshGeometryIndexed::ComputeAreas()
 
 	// Compute triangle areas
 	{
-		MyPointerTriangleList::const_iterator i, e;
-		for( i=ptr_polygons.begin(), e=ptr_polygons.end(); i!=e; i++ ) {
-			const PointerTriangle&	thisTri = (*i);
-			Vector3 vEdgeA = Vector3Ops::mkVector3( *thisTri.pVertices[1], *thisTri.pVertices[0] );
-			Vector3 vEdgeB = Vector3Ops::mkVector3( *thisTri.pVertices[2], *thisTri.pVertices[0] );
+		const unsigned int nTris = static_cast<unsigned int>( numTriangles() );
+		areas.reserve( nTris );
+		for( unsigned int i=0; i<nTris; i++ ) {
+			Point3 p0, p1, p2;
+			TrianglePositions( i, p0, p1, p2 );
+			Vector3 vEdgeA = Vector3Ops::mkVector3( p1, p0 );
+			Vector3 vEdgeB = Vector3Ops::mkVector3( p2, p0 );
 			const Scalar thisArea = (Vector3Ops::Magnitude(Vector3Ops::Cross(vEdgeA,vEdgeB))) * 0.5;
 			totalArea += thisArea;
 			areas.push_back( thisArea );
@@ -456,8 +540,17 @@ void TriangleMeshGeometryIndexed::DoneIndexedTriangles( )
 		stl_utils::container_optimize< TexCoordsListType >( pCoords );
 	}
 
+	if( bCompact ) {
+		if( BuildCompactStorage( indexedtris, true ) ) {
+			stl_utils::container_erase_all< IndexTriangleListType >( indexedtris );
+		} else {
+			GlobalLog()->PrintEasyWarning( "TriangleMeshGeometryIndexed:: Keeping the default layout" );
+			bCompact = false;
+		}
+	}
+
 	// Convert that indexed triangle into a pointer triangle
-	{
+	if( !bCompact ) {
 		IndexTriangleListType::const_iterator	i, e;
 		
 		for( i=indexedtris.begin(), e=indexedtris.end(); i!=e; i++ )
@@ -498,32 +591,37 @@ void TriangleMeshGeometryIndexed::DoneIndexedTriangles( )
 
 	}
 
-	// We're done with all the triangles so stuff it all into an octree
-	// First compute the bounds of the octree
-	BoundingBox bbox( Point3( RISE_INFINITY, RISE_INFINITY, RISE_INFINITY ), Point3( -RISE_INFINITY, -RISE_INFINITY, -RISE_INFINITY ) );
+	// Phase 1: BVH replaces BSP/octree as the active acceleration structure.
+	// Build SAH-binned BVH2 over the triangle list.
+	//
+	// Cleanup §3+§4: BVH-only.  Legacy BSP/octree fallback removed
+	// (members preserved for v1/v2 .risemesh deserialize compat).
+	// SBVH off by default per Tier 1 §1 (regression on big meshes).
+	BuildPolygonBVH( "pointers BVH" );
 
-	std::vector<const PointerTriangle*>	temp;
+	ComputeAreas();
+}
 
-	{
-		MyPointerTriangleList::iterator i, e;
-		for( i=ptr_polygons.begin(), e=ptr_polygons.end(); i!=e; i++ ) {
-			PointerTriangle&	mytri = (*i);
-			temp.push_back( &mytri );
+void TriangleMeshGeometryIndexed::BuildPolygonBVH( const char* szWhat )
+{
+	// The bounds cover every vertex, referenced or not
+	BoundingBox bbox( Point3( RISE_INFINITY, RISE_INFINITY, RISE_INFINITY ), Point3( -RISE_INFINITY, -RISE_INFINITY, -RISE_INFINITY ) );
+	if( bCompact ) {
+		for( unsigned int i=0; i<nCompactVertices; i++ ) {
+			bbox.Include( CompactPosition( i ) );
 		}
-
+	} else {
 		MyPointsList::const_iterator		m, n;
 		for( m=pPoints.begin(), n=pPoints.end(); m!=n; m++ ) {
 			bbox.Include( *m );
 		}
 	}
 
-	// Phase 1: BVH replaces BSP/octree as the active acceleration structure.
-	// Build SAH-binned BVH2 over the pointer-triangle list.
-	//
-	// Env-var escape hatch for adversarial review and A/B regression
-	// Cleanup §3+§4: BVH-only.  Legacy BSP/octree fallback removed
-	// (members preserved for v1/v2 .risemesh deserialize compat).
-	// SBVH off by default per Tier 1 §1 (regression on big meshes).
+	std::vector<unsigned int> temp( numTriangles() );
+	for( unsigned int i=0; i<temp.size(); i++ ) {
+		temp[i] = i;
+	}
+
 	safe_release( pPtrBVH );
 
 	AccelerationConfig cfg;
@@ -533,10 +631,239 @@ void TriangleMeshGeometryIndexed::DoneIndexedTriangles( )
 	cfg.sahIntersectionCost    = 1.0;
 	cfg.doubleSided            = bDoubleSided;
 
-	pPtrBVH = new BVH<const PointerTriangle*>( *this, temp, bbox, cfg );
-	GlobalLog()->PrintNew( pPtrBVH, __FILE__, __LINE__, "pointers BVH" );
+	pPtrBVH = new BVH<unsigned int>( *this, temp, bbox, cfg );
+	GlobalLog()->PrintNew( pPtrBVH, __FILE__, __LINE__, szWhat );
+}
 
-	ComputeAreas();
+const PointerTriangle& TriangleMeshGeometryIndexed::ResolveTriangle( const unsigned int t, TriangleCorners& s ) const
+{
+	if( !bCompact ) {
+		const PointerTriangle& p = ptr_polygons[t];
+		for( int k=0; k<3; k++ ) {
+			s.iv[k] = static_cast<unsigned int>( p.pVertices[k] - &pPoints[0] );
+			s.ic[k] = pCoords.empty() ? 0 : static_cast<unsigned int>( p.pCoords[k] - &pCoords[0] );
+		}
+		return p;
+	}
+
+	for( int k=0; k<3; k++ ) {
+		const unsigned int i = CompactIndex( t, k );
+		s.iv[k] = s.ic[k] = i;
+		s.v[k] = CompactPosition( i );
+		s.c[k] = DecodeUnorm16Pair( cCoords[i], cCoordMin, cCoordScale );
+		s.tri.pVertices[k] = &s.v[k];
+		s.tri.pCoords[k] = &s.c[k];
+		if( cNormals.empty() ) {
+			s.tri.pNormals[k] = 0;
+		} else {
+			s.n[k] = DecodeOctahedral( cNormals[i] );
+			s.tri.pNormals[k] = &s.n[k];
+		}
+	}
+	return s.tri;
+}
+
+bool TriangleMeshGeometryIndexed::BuildCompactStorage( const IndexTriangleListType& tris, const bool bReorderTriangles )
+{
+	const size_t nTris = tris.size();
+	const bool bNormals = !bUseFaceNormals && !pNormals.empty();
+	const bool bCoords = !pCoords.empty();
+
+	// Most meshes index positions, normals and coords alike; the rest get
+	// one vertex per distinct corner
+	bool bSameIndices = true;
+	for( size_t t=0; t<nTris; t++ ) {
+		const IndexedTriangle& tri = tris[t];
+		for( int k=0; k<3; k++ ) {
+			if( tri.iVertices[k] >= pPoints.size() ||
+				(bNormals && tri.iNormals[k] >= pNormals.size()) ||
+				(bCoords && tri.iCoords[k] >= pCoords.size()) )
+			{
+				GlobalLog()->PrintEasyError( "TriangleMeshGeometryIndexed::BuildCompactStorage:: Bad index on IndexedTriangle" );
+				return false;
+			}
+			if( (bNormals && tri.iNormals[k] != tri.iVertices[k]) ||
+				(bCoords && tri.iCoords[k] != tri.iVertices[k]) )
+			{
+				bSameIndices = false;
+			}
+		}
+	}
+
+	std::vector<CornerKey>		unified;
+	std::vector<unsigned int>	cornerOf( nTris*3 );
+	if( bSameIndices ) {
+		unified.resize( pPoints.size() );
+		for( unsigned int i=0; i<unified.size(); i++ ) {
+			unified[i].v = i;
+			unified[i].n = bNormals ? i : 0;
+			unified[i].c = bCoords ? i : 0;
+		}
+		for( size_t t=0; t<nTris; t++ ) {
+			for( int k=0; k<3; k++ ) {
+				cornerOf[t*3+k] = tris[t].iVertices[k];
+			}
+		}
+	} else {
+		std::unordered_map<CornerKey, unsigned int, CornerKeyHash> ids;
+		ids.reserve( nTris*2 );
+		for( size_t t=0; t<nTris; t++ ) {
+			for( int k=0; k<3; k++ ) {
+				CornerKey key;
+				key.v = tris[t].iVertices[k];
+				key.n = bNormals ? tris[t].iNormals[k] : 0;
+				key.c = bCoords ? tris[t].iCoords[k] : 0;
+				const std::pair<std::unordered_map<CornerKey, unsigned int, CornerKeyHash>::iterator, bool> ins =
+					ids.insert( std::make_pair( key, static_cast<unsigned int>( unified.size() ) ) );
+				if( ins.second ) {
+					unified.push_back( key );
+				}
+				cornerOf[t*3+k] = ins.first->second;
+			}
+		}
+	}
+
+	// Triangles in Morton order of their centroids
+	std::vector<unsigned int> order( nTris );
+	for( size_t t=0; t<nTris; t++ ) {
+		order[t] = static_cast<unsigned int>( t );
+	}
+	if( bReorderTriangles && nTris > 1 ) {
+		BoundingBox bbox( Point3( RISE_INFINITY, RISE_INFINITY, RISE_INFINITY ), Point3( -RISE_INFINITY, -RISE_INFINITY, -RISE_INFINITY ) );
+		std::vector<Point3> centroids( nTris );
+		for( size_t t=0; t<nTris; t++ ) {
+			const IndexedTriangle& tri = tris[t];
+			centroids[t] = Point3Ops::WeightedAverage3( pPoints[tri.iVertices[0]], pPoints[tri.iVertices[1]], pPoints[tri.iVertices[2]], 1.0/3.0, 1.0/3.0 );
+			bbox.Include( centroids[t] );
+		}
+		const Vector3 extent = Vector3Ops::mkVector3( bbox.ur, bbox.ll );
+		const Scalar sx = extent.x > 0 ? 1023.0 / extent.x : 0;
+		const Scalar sy = extent.y > 0 ? 1023.0 / extent.y : 0;
+		const Scalar sz = extent.z > 0 ? 1023.0 / extent.z : 0;
+		std::vector<uint32_t> codes( nTris );
+		for( size_t t=0; t<nTris; t++ ) {
+			codes[t] =
+				MortonSpread3( uint32_t( (centroids[t].x - bbox.ll.x) * sx ) ) |
+				( MortonSpread3( uint32_t( (centroids[t].y - bbox.ll.y) * sy ) ) << 1 ) |
+				( MortonSpread3( uint32_t( (centroids[t].z - bbox.ll.z) * sz ) ) << 2 );
+		}
+		std::stable_sort( order.begin(), order.end(),
+			[&codes]( const unsigned int a, const unsigned int b ) { return codes[a] < codes[b]; } );
+	}
+
+	// Vertices in order of first use; unreferenced ones are dropped
+	std::vector<unsigned int> remap( unified.size(), ~0u );
+	std::vector<unsigned int> source;
+	std::vector<uint32_t> indices( nTris*3 );
+	for( size_t j=0; j<nTris; j++ ) {
+		for( int k=0; k<3; k++ ) {
+			const unsigned int u = cornerOf[size_t(order[j])*3+k];
+			if( remap[u] == ~0u ) {
+				remap[u] = static_cast<unsigned int>( source.size() );
+				source.push_back( u );
+			}
+			indices[j*3+k] = remap[u];
+		}
+	}
+	const size_t nv = source.size();
+
+	// Per-vertex attributes that follow the position (colors, tangents)
+	// or the coord (TEXCOORD_1) carry over only if every corner has one
+	bool bColors = !pColors.empty(), bTangents = !pTangents.empty(), bTexCoords1 = !pTexCoords1.empty();
+	for( size_t i=0; i<nv; i++ ) {
+		const CornerKey& src = unified[source[i]];
+		bColors = bColors && src.v < pColors.size();
+		bTangents = bTangents && src.v < pTangents.size();
+		bTexCoords1 = bTexCoords1 && src.c < pTexCoords1.size();
+	}
+	if( !pColors.empty() && !bColors ) {
+		GlobalLog()->PrintEasyWarning( "TriangleMeshGeometryIndexed::BuildCompactStorage:: Fewer colors than vertices, dropping the colors" );
+	}
+	if( !pTangents.empty() && !bTangents ) {
+		GlobalLog()->PrintEasyWarning( "TriangleMeshGeometryIndexed::BuildCompactStorage:: Fewer tangents than vertices, dropping the tangents" );
+	}
+	if( !pTexCoords1.empty() && !bTexCoords1 ) {
+		GlobalLog()->PrintEasyWarning( "TriangleMeshGeometryIndexed::BuildCompactStorage:: Fewer secondary texture co-ordinates than vertices, dropping them" );
+	}
+
+	const size_t bytesBefore =
+		pPoints.size()*sizeof(Vertex) + pNormals.size()*sizeof(Normal) + pCoords.size()*sizeof(TexCoord) +
+		nTris*sizeof(PointerTriangle);
+
+	cPositions.resize( nv*3 );
+	cNormals.assign( bNormals ? nv : 0, 0 );
+	cCoords.resize( nv );
+
+	cCoordMin[0] = cCoordMin[1] = 0;
+	cCoordScale[0] = cCoordScale[1] = 0;
+	if( bCoords && nv > 0 ) {
+		Scalar mx[2] = { -RISE_INFINITY, -RISE_INFINITY };
+		cCoordMin[0] = cCoordMin[1] = RISE_INFINITY;
+		for( size_t i=0; i<nv; i++ ) {
+			const TexCoord& c = pCoords[unified[source[i]].c];
+			cCoordMin[0] = std::min( cCoordMin[0], c.x );
+			cCoordMin[1] = std::min( cCoordMin[1], c.y );
+			mx[0] = std::max( mx[0], c.x );
+			mx[1] = std::max( mx[1], c.y );
+		}
+		cCoordScale[0] = (mx[0] - cCoordMin[0]) / 65535.0;
+		cCoordScale[1] = (mx[1] - cCoordMin[1]) / 65535.0;
+	}
+	const Scalar inv[2] = {
+		cCoordScale[0] > 0 ? 1.0 / cCoordScale[0] : 0,
+		cCoordScale[1] > 0 ? 1.0 / cCoordScale[1] : 0 };
+
+	VertexColorsListType	colors( bColors ? nv : 0 );
+	Tangent4ListType		tangents( bTangents ? nv : 0 );
+	TexCoordsListType		coords1( bTexCoords1 ? nv : 0 );
+	for( size_t i=0; i<nv; i++ ) {
+		const CornerKey& src = unified[source[i]];
+		const Vertex& v = pPoints[src.v];
+		cPositions[i*3+0] = (float)v.x;
+		cPositions[i*3+1] = (float)v.y;
+		cPositions[i*3+2] = (float)v.z;
+		if( bNormals ) {
+			cNormals[i] = EncodeOctahedral( pNormals[src.n] );
+		}
+		if( bCoords ) {
+			const TexCoord& c = pCoords[src.c];
+			const uint32_t qu = (uint32_t)std::min( std::lround( (c.x - cCoordMin[0]) * inv[0] ), 65535L );
+			const uint32_t qv = (uint32_t)std::min( std::lround( (c.y - cCoordMin[1]) * inv[1] ), 65535L );
+			cCoords[i] = qu | (qv << 16);
+		} else {
+			cCoords[i] = 0;
+		}
+		if( bColors )		colors[i] = pColors[src.v];
+		if( bTangents )		tangents[i] = pTangents[src.v];
+		if( bTexCoords1 )	coords1[i] = pTexCoords1[src.c];
+	}
+	pColors.swap( colors );
+	pTangents.swap( tangents );
+	pTexCoords1.swap( coords1 );
+
+	cIndices16.clear();
+	cIndices32.clear();
+	if( nv <= 65536 ) {
+		cIndices16.assign( indices.begin(), indices.end() );
+	} else {
+		cIndices32.swap( indices );
+	}
+
+	nCompactVertices = static_cast<unsigned int>( nv );
+	nCompactTriangles = static_cast<unsigned int>( nTris );
+	bCompact = true;
+
+	stl_utils::container_erase_all< VerticesListType >( pPoints );
+	stl_utils::container_erase_all< NormalsListType >( pNormals );
+	stl_utils::container_erase_all< TexCoordsListType >( pCoords );
+	stl_utils::container_erase_all< PointerTriangleListType >( ptr_polygons );
+
+	const size_t bytesAfter =
+		cPositions.size()*sizeof(float) + cNormals.size()*sizeof(uint32_t) + cCoords.size()*sizeof(uint32_t) +
+		cIndices16.size()*sizeof(uint16_t) + cIndices32.size()*sizeof(uint32_t);
+	GlobalLog()->PrintEx( eLog_Info, "TriangleMeshGeometryIndexed:: Compact layout: %u vertices, %u triangles, %u KB of vertex and triangle data (was %u KB)",
+		nCompactVertices, nCompactTriangles, (unsigned int)(bytesAfter/1024), (unsigned int)(bytesBefore/1024) );
+	return true;
 }
 
 void TriangleMeshGeometryIndexed::GenerateBoundingSphere( Point3& ptCenter, Scalar& radius ) const
@@ -546,10 +873,10 @@ void TriangleMeshGeometryIndexed::GenerateBoundingSphere( Point3& ptCenter, Scal
 
 	// Go through all the points and calculate the minimum and maximum values from the
 	// entire set.
-	MyPointsList::const_iterator m, n;
-	for( m=pPoints.begin(), n=pPoints.end(); m!=n; m++ )
+	const unsigned int nPoints = numPoints();
+	for( unsigned int i=0; i<nPoints; i++ )
 	{
-		const Point3&	pt = *m;
+		const Point3	pt = bCompact ? CompactPosition( i ) : pPoints[i];
 		if( pt.x < ptMin.x ) ptMin.x = pt.x;
 		if( pt.y < ptMin.y ) ptMin.y = pt.y;
 		if( pt.z < ptMin.z ) ptMin.z = pt.z;
@@ -563,8 +890,8 @@ void TriangleMeshGeometryIndexed::GenerateBoundingSphere( Point3& ptCenter, Scal
 	radius = 0;
 
 	// Go through all the points again and calculate the radius of the sphere
-	for( m=pPoints.begin(), n=pPoints.end(); m!=n; m++ ) {
-		Vector3			r = Vector3Ops::mkVector3( *m, ptCenter );
+	for( unsigned int i=0; i<nPoints; i++ ) {
+		Vector3			r = Vector3Ops::mkVector3( bCompact ? CompactPosition( i ) : pPoints[i], ptCenter );
 		const Scalar	d = Vector3Ops::Magnitude(r);
 
 		if( d > radius ) {
@@ -583,7 +910,7 @@ BoundingBox TriangleMeshGeometryIndexed::GenerateBoundingBox( ) const
 }
 
 static const char * szSignature = "RISETMGI";
-static const unsigned int cur_version = 5;
+static const unsigned int cur_version = 6;
 //
 // Version history:
 //   1 — original (legacy)
@@ -611,6 +938,13 @@ static const unsigned int cur_version = 5;
 //       per-triangle color index is written.  v1..v4 readers cannot
 //       load v5 files; v5 readers handle every prior version via the
 //       per-version Deserialize branches below.
+//   6 — Persisted BVH precompute: same layout as v5, but the BVH
+//       cache is written as BVH cache version 2, which adds the BVH4
+//       node array, the float-filter triangle block and the build-time
+//       SAH after the BVH2 data, so a load does no re-derivation.  The
+//       BVH block is self-versioned, so v6 readers take v5's v1 cache
+//       as before; v6 is bumped so v5 readers refuse the file up front
+//       instead of failing mid-stream on the newer cache.
 
 void TriangleMeshGeometryIndexed::Serialize( IWriteBuffer& buffer ) const
 {
@@ -624,92 +958,97 @@ void TriangleMeshGeometryIndexed::Serialize( IWriteBuffer& buffer ) const
 	buffer.ResizeForMore( sizeof( char ) );
 	buffer.setChar( bUseFaceNormals ? 1 : 0 );
 
-	// Now put geometry data
-
-	// List of points
-	{
-		buffer.ResizeForMore( static_cast<unsigned int>(sizeof(Vertex)*pPoints.size() + sizeof( unsigned int )) );
+	// Now put geometry data.  A compact mesh writes its decoded vertices
+	// and one shared index per corner, so the file is the same format
+	// whichever layout wrote it.
+	if( bCompact ) {
+		SerializeCompactGeometry( buffer );
+	} else {
+		// List of points
+		{
+			buffer.ResizeForMore( static_cast<unsigned int>(sizeof(Vertex)*pPoints.size() + sizeof( unsigned int )) );
 
-		buffer.setUInt( static_cast<unsigned int>(pPoints.size()) );
+			buffer.setUInt( static_cast<unsigned int>(pPoints.size()) );
 
-		MyPointsList::const_iterator	it;
-		for( it=pPoints.begin(); it!=pPoints.end(); it++ ) {
-			const Vertex&	v = *it;
-			buffer.setDouble( v.x );
-			buffer.setDouble( v.y );
-			buffer.setDouble( v.z );
+			MyPointsList::const_iterator	it;
+			for( it=pPoints.begin(); it!=pPoints.end(); it++ ) {
+				const Vertex&	v = *it;
+				buffer.setDouble( v.x );
+				buffer.setDouble( v.y );
+				buffer.setDouble( v.z );
+			}
 		}
-	}
 
-	// List of normals
-	{
-		buffer.ResizeForMore( static_cast<unsigned int>(sizeof(Normal)*pNormals.size() + sizeof( unsigned int )) );
+		// List of normals
+		{
+			buffer.ResizeForMore( static_cast<unsigned int>(sizeof(Normal)*pNormals.size() + sizeof( unsigned int )) );
 
-		buffer.setUInt( static_cast<unsigned int>(pNormals.size()) );
+			buffer.setUInt( static_cast<unsigned int>(pNormals.size()) );
 
-		MyNormalsList::const_iterator	it;
-		for( it=pNormals.begin(); it!=pNormals.end(); it++ ) {
-			const Normal&	n = *it;
-			buffer.setDouble( n.x );
-			buffer.setDouble( n.y );
-			buffer.setDouble( n.z );
+			MyNormalsList::const_iterator	it;
+			for( it=pNormals.begin(); it!=pNormals.end(); it++ ) {
+				const Normal&	n = *it;
+				buffer.setDouble( n.x );
+				buffer.setDouble( n.y );
+				buffer.setDouble( n.z );
+			}
 		}
-	}
 
-	// List of texture co-ordinates
-	{
-		buffer.ResizeForMore( static_cast<unsigned int>(sizeof(Normal)*pCoords.size() + sizeof( unsigned int )) );
+		// List of texture co-ordinates
+		{
+			buffer.ResizeForMore( static_cast<unsigned int>(sizeof(Normal)*pCoords.size() + sizeof( unsigned int )) );
 
-		buffer.setUInt( static_cast<unsigned int>(pCoords.size()) );
+			buffer.setUInt( static_cast<unsigned int>(pCoords.size()) );
 
-		MyCoordsList::const_iterator	it;
-		for( it=pCoords.begin(); it!=pCoords.end(); it++ ) {
-			const TexCoord&	c = *it;
-			buffer.setDouble( c.x );
-			buffer.setDouble( c.y );
+			MyCoordsList::const_iterator	it;
+			for( it=pCoords.begin(); it!=pCoords.end(); it++ ) {
+				const TexCoord&	c = *it;
+				buffer.setDouble( c.x );
+				buffer.setDouble( c.y );
+			}
 		}
-	}
 
-	// v5: optional list of per-vertex colors.  numColors == 0 when the
-	// mesh has no color data.  Each color is three doubles in the
-	// engine's working color space (linear ROMM RGB; see RISEPel).
-	{
-		buffer.ResizeForMore( static_cast<unsigned int>(sizeof(double) * 3 * pColors.size() + sizeof( unsigned int )) );
+		// v5: optional list of per-vertex colors.  numColors == 0 when the
+		// mesh has no color data.  Each color is three doubles in the
+		// engine's working color space (linear ROMM RGB; see RISEPel).
+		{
+			buffer.ResizeForMore( static_cast<unsigned int>(sizeof(double) * 3 * pColors.size() + sizeof( unsigned int )) );
 
-		buffer.setUInt( static_cast<unsigned int>(pColors.size()) );
+			buffer.setUInt( static_cast<unsigned int>(pColors.size()) );
 
-		MyColorsList::const_iterator it;
-		for( it = pColors.begin(); it != pColors.end(); ++it ) {
-			const VertexColor& c = *it;
-			buffer.setDouble( c.r );
-			buffer.setDouble( c.g );
-			buffer.setDouble( c.b );
+			MyColorsList::const_iterator it;
+			for( it = pColors.begin(); it != pColors.end(); ++it ) {
+				const VertexColor& c = *it;
+				buffer.setDouble( c.r );
+				buffer.setDouble( c.g );
+				buffer.setDouble( c.b );
+			}
 		}
-	}
 
-	// List of pointer polygons (convert them to indexed polygons!)
-	{
-		buffer.ResizeForMore( static_cast<unsigned int>(sizeof( IndexedTriangle ) * ptr_polygons.size() + sizeof( unsigned int )) );
-
-		buffer.setUInt( static_cast<unsigned int>(ptr_polygons.size()) );
-
-		// Do pointer arithmetic to do the conversion
-		// NOTE: this only works if the points, normals and coords list
-		//  are all vectors
-		unsigned int vertex_ptr_begin = VoidPtrToUInt( (void*)&(*(pPoints.begin())) );
-		unsigned int normal_ptr_begin = VoidPtrToUInt( (void*)&(*(pNormals.begin())) );
-		unsigned int coord_ptr_begin = VoidPtrToUInt( (void*)&(*(pCoords.begin())) );
-
-		MyPointerTriangleList::const_iterator it;
-		for( it=ptr_polygons.begin(); it != ptr_polygons.end(); it++ ) {
-			const PointerTriangle& ptrtri = *it;
-
-			for( int i=0; i<3; i++ ) {
-				// For each of the vertices take the pointer off set, subtract by
-				// begining and divide by the size of the type
-				buffer.setUInt( ((VoidPtrToUInt(ptrtri.pVertices[i]))-vertex_ptr_begin) / sizeof( Vertex ) );
-				buffer.setUInt( ((VoidPtrToUInt(ptrtri.pNormals[i]))-normal_ptr_begin) / sizeof( Normal ) );
-				buffer.setUInt( ((VoidPtrToUInt(ptrtri.pCoords[i]))-coord_ptr_begin) / sizeof( TexCoord ) );
+		// List of pointer polygons (convert them to indexed polygons!)
+		{
+			buffer.ResizeForMore( static_cast<unsigned int>(sizeof( IndexedTriangle ) * ptr_polygons.size() + sizeof( unsigned int )) );
+
+			buffer.setUInt( static_cast<unsigned int>(ptr_polygons.size()) );
+
+			// Do pointer arithmetic to do the conversion
+			// NOTE: this only works if the points, normals and coords list
+			//  are all vectors
+			unsigned int vertex_ptr_begin = VoidPtrToUInt( (void*)&(*(pPoints.begin())) );
+			unsigned int normal_ptr_begin = VoidPtrToUInt( (void*)&(*(pNormals.begin())) );
+			unsigned int coord_ptr_begin = VoidPtrToUInt( (void*)&(*(pCoords.begin())) );
+
+			MyPointerTriangleList::const_iterator it;
+			for( it=ptr_polygons.begin(); it != ptr_polygons.end(); it++ ) {
+				const PointerTriangle& ptrtri = *it;
+
+				for( int i=0; i<3; i++ ) {
+					// For each of the vertices take the pointer off set, subtract by
+					// begining and divide by the size of the type
+					buffer.setUInt( ((VoidPtrToUInt(ptrtri.pVertices[i]))-vertex_ptr_begin) / sizeof( Vertex ) );
+					buffer.setUInt( ((VoidPtrToUInt(ptrtri.pNormals[i]))-normal_ptr_begin) / sizeof( Normal ) );
+					buffer.setUInt( ((VoidPtrToUInt(ptrtri.pCoords[i]))-coord_ptr_begin) / sizeof( TexCoord ) );
+				}
 			}
 		}
 	}
@@ -722,21 +1061,19 @@ void TriangleMeshGeometryIndexed::Serialize( IWriteBuffer& buffer ) const
 	//
 	// Symmetric-gating: only emit the cache flag when we actually have
 	// polygon data.  Deserialize gates the read on the same condition
-	// (`ptr_polygons.size() > 0`), so an empty-mesh round-trip stays
+	// (`numTriangles() > 0`), so an empty-mesh round-trip stays
 	// byte-symmetric across Serialize/Deserialize.  Empty meshes occur
 	// in test fixtures (mesh-not-yet-fed-via-Begin/Done) and would
 	// otherwise leave a trailing flag byte unconsumed in composite
 	// streams.  See Tier A2 review notes, 2026-04-27.
-	if( !ptr_polygons.empty() ) {
+	if( numTriangles() > 0 ) {
 		buffer.ResizeForMore( sizeof( char ) );
 		if( pPtrBVH ) {
 			buffer.setChar( 1 );
-			// Index function: each prim is a (const PointerTriangle*) into
-			// our ptr_polygons array; subtract base pointer to get the index.
-			const PointerTriangle* base = &ptr_polygons[0];
-			pPtrBVH->Serialize( buffer,
-				[base]( const PointerTriangle* p ) -> unsigned int {
-					return (unsigned int)( p - base );
+			// Each prim already is its triangle's index
+			pPtrBVH->SerializeWithPrecompute( buffer,
+				[]( const unsigned int p ) -> unsigned int {
+					return p;
 				} );
 		} else {
 			buffer.setChar( 0 );
@@ -744,6 +1081,54 @@ void TriangleMeshGeometryIndexed::Serialize( IWriteBuffer& buffer ) const
 	}
 }
 
+void TriangleMeshGeometryIndexed::SerializeCompactGeometry( IWriteBuffer& buffer ) const
+{
+	buffer.ResizeForMore( static_cast<unsigned int>(sizeof(Vertex)*nCompactVertices + sizeof( unsigned int )) );
+	buffer.setUInt( nCompactVertices );
+	for( unsigned int i=0; i<nCompactVertices; i++ ) {
+		const Vertex v = CompactPosition( i );
+		buffer.setDouble( v.x );
+		buffer.setDouble( v.y );
+		buffer.setDouble( v.z );
+	}
+
+	buffer.ResizeForMore( static_cast<unsigned int>(sizeof(Normal)*cNormals.size() + sizeof( unsigned int )) );
+	buffer.setUInt( static_cast<unsigned int>(cNormals.size()) );
+	for( size_t i=0; i<cNormals.size(); i++ ) {
+		const Normal n = DecodeOctahedral( cNormals[i] );
+		buffer.setDouble( n.x );
+		buffer.setDouble( n.y );
+		buffer.setDouble( n.z );
+	}
+
+	buffer.ResizeForMore( static_cast<unsigned int>(sizeof(TexCoord)*nCompactVertices + sizeof( unsigned int )) );
+	buffer.setUInt( nCompactVertices );
+	for( unsigned int i=0; i<nCompactVertices; i++ ) {
+		const TexCoord c = DecodeUnorm16Pair( cCoords[i], cCoordMin, cCoordScale );
+		buffer.setDouble( c.x );
+		buffer.setDouble( c.y );
+	}
+
+	buffer.ResizeForMore( static_cast<unsigned int>(sizeof(double) * 3 * pColors.size() + sizeof( unsigned int )) );
+	buffer.setUInt( static_cast<unsigned int>(pColors.size()) );
+	for( MyColorsList::const_iterator it = pColors.begin(); it != pColors.end(); ++it ) {
+		buffer.setDouble( it->r );
+		buffer.setDouble( it->g );
+		buffer.setDouble( it->b );
+	}
+
+	buffer.ResizeForMore( static_cast<unsigned int>(sizeof( IndexedTriangle ) * nCompactTriangles + sizeof( unsigned int )) );
+	buffer.setUInt( nCompactTriangles );
+	for( unsigned int t=0; t<nCompactTriangles; t++ ) {
+		for( int k=0; k<3; k++ ) {
+			const unsigned int i = CompactIndex( t, k );
+			buffer.setUInt( i );
+			buffer.setUInt( cNormals.empty() ? 0 : i );
+			buffer.setUInt( i );
+		}
+	}
+}
+
 void TriangleMeshGeometryIndexed::Deserialize( IReadBuffer& buffer )
 {
 	GlobalLog()->PrintEx( eLog_Info, "TriangleMeshGeometryIndexed::Deserialize:: Begining deserialization process" );
@@ -784,6 +1169,13 @@ void TriangleMeshGeometryIndexed::Deserialize( IReadBuffer& buffer )
 	pNormals.clear();
 	pCoords.clear();
 	ptr_polygons.clear();
+	cPositions.clear();
+	cNormals.clear();
+	cCoords.clear();
+	cIndices16.clear();
+	cIndices32.clear();
+	nCompactVertices = 0;
+	nCompactTriangles = 0;
 
 	// Now get the list of points
 	{
@@ -892,6 +1284,33 @@ void TriangleMeshGeometryIndexed::Deserialize( IReadBuffer& buffer )
 		GlobalLog()->PrintEx( eLog_Info, "  TriangleMeshGeometryIndexed::Deserialize:: Read %d pointer polygons", numptrpolys );
 	}
 
+	// A compact mesh keeps the file's triangle order, so a cached BVH
+	// still indexes the right triangles.  Its bounds only hold for the
+	// float positions if the file's positions were float already (as
+	// they are when a compact mesh wrote it).
+	bool bPositionsFloatExact = true;
+	if( bCompact ) {
+		for( MyPointsList::const_iterator mi = pPoints.begin(); mi != pPoints.end() && bPositionsFloatExact; ++mi ) {
+			bPositionsFloatExact =
+				(double)(float)mi->x == mi->x &&
+				(double)(float)mi->y == mi->y &&
+				(double)(float)mi->z == mi->z;
+		}
+
+		IndexTriangleListType tris( ptr_polygons.size() );
+		for( size_t j=0; j<ptr_polygons.size(); j++ ) {
+			for( int i=0; i<3; i++ ) {
+				tris[j].iVertices[i] = static_cast<unsigned int>( ptr_polygons[j].pVertices[i] - &pPoints[0] );
+				tris[j].iNormals[i] = ptr_polygons[j].pNormals[i] ? static_cast<unsigned int>( ptr_polygons[j].pNormals[i] - &pNormals[0] ) : 0;
+				tris[j].iCoords[i] = pCoords.empty() ? 0 : static_cast<unsigned int>( ptr_polygons[j].pCoords[i] - &pCoords[0] );
+			}
+		}
+		if( !BuildCompactStorage( tris, false ) ) {
+			GlobalLog()->PrintEasyWarning( "TriangleMeshGeometryIndexed::Deserialize:: Keeping the default layout" );
+			bCompact = false;
+		}
+	}
+
 	char bdoublesided = buffer.getChar();
 	bDoubleSided = !!bdoublesided;
 	GlobalLog()->PrintEx( eLog_Info, "  TriangleMeshGeometryIndexed::Deserialize:: Polygons are double sided? [%s]", bDoubleSided?"YES":"NO" );
@@ -913,15 +1332,15 @@ void TriangleMeshGeometryIndexed::Deserialize( IReadBuffer& buffer )
 			// and fall through (rebuild from polygon data below).
 			if( version >= 2 ) {
 				if( legacyUseBSP ) {
-					BSPTreeSAH<const PointerTriangle*>* pLegacyBSP =
-						new BSPTreeSAH<const PointerTriangle*>(
+					BSPTreeSAH<MYOBJ>* pLegacyBSP =
+						new BSPTreeSAH<MYOBJ>(
 							*this, BoundingBox(Point3(0,0,0), Point3(0,0,0)), 1 );
 					GlobalLog()->PrintNew( pLegacyBSP, __FILE__, __LINE__, "legacy BSP (read+discard)" );
 					pLegacyBSP->Deserialize( buffer );
 					safe_release( pLegacyBSP );
 				} else {
-					Octree<const PointerTriangle*>* pLegacyOct =
-						new Octree<const PointerTriangle*>(
+					Octree<MYOBJ>* pLegacyOct =
+						new Octree<MYOBJ>(
 							*this, BoundingBox(Point3(0,0,0), Point3(0,0,0)), 1 );
 					GlobalLog()->PrintNew( pLegacyOct, __FILE__, __LINE__, "legacy Octree (read+discard)" );
 					pLegacyOct->Deserialize( buffer );
@@ -941,7 +1360,7 @@ void TriangleMeshGeometryIndexed::Deserialize( IReadBuffer& buffer )
 	bool bvhCacheLoaded = false;
 	safe_release( pPtrBVH );
 
-	if( version >= 3 && ptr_polygons.size() > 0 ) {
+	if( version >= 3 && numTriangles() > 0 ) {
 		const char haveBVHCache = buffer.getChar();
 		if( haveBVHCache ) {
 			AccelerationConfig cfg;
@@ -955,19 +1374,22 @@ void TriangleMeshGeometryIndexed::Deserialize( IReadBuffer& buffer )
 			// call Deserialize.  Pass an empty input vector + a dummy
 			// bbox.  Build() returns early on empty input;
 			// Deserialize then overwrites the empty state.
-			std::vector<const PointerTriangle*> emptyTemp;
+			std::vector<unsigned int> emptyTemp;
 			BoundingBox dummyBox( Point3(0,0,0), Point3(0,0,0) );
-			pPtrBVH = new BVH<const PointerTriangle*>( *this, emptyTemp, dummyBox, cfg );
+			pPtrBVH = new BVH<unsigned int>( *this, emptyTemp, dummyBox, cfg );
 			GlobalLog()->PrintNew( pPtrBVH, __FILE__, __LINE__, "pointers BVH (cache load)" );
 
-			const PointerTriangle* base = ptr_polygons.empty() ? nullptr : &ptr_polygons[0];
 			const bool ok = pPtrBVH->Deserialize( buffer,
-				(uint32_t)ptr_polygons.size(),
-				[base]( unsigned int idx ) -> const PointerTriangle* {
-					return base + idx;
+				(uint32_t)numTriangles(),
+				[]( unsigned int idx ) -> unsigned int {
+					return idx;
 				} );
 
-			if( ok ) {
+			if( ok && !bPositionsFloatExact ) {
+				GlobalLog()->PrintEx( eLog_Info,
+					"TriangleMeshGeometryIndexed::Deserialize:: BVH cache bounds double positions; rebuilding for the compact layout" );
+				safe_release( pPtrBVH );
+			} else if( ok ) {
 				bvhCacheLoaded = true;
 				GlobalLog()->PrintEx( eLog_Info,
 					"TriangleMeshGeometryIndexed::Deserialize:: Loaded BVH cache "
@@ -984,34 +1406,10 @@ void TriangleMeshGeometryIndexed::Deserialize( IReadBuffer& buffer )
 
 	// If we don't have a usable BVH yet (legacy file, missing cache, or
 	// cache deserialize failed), rebuild from the loaded polygon data.
-	if( !bvhCacheLoaded && ptr_polygons.size() > 0 ) {
-		GlobalLog()->PrintEx( eLog_Info, "TriangleMeshGeometryIndexed::Deserialize:: Rebuilding BVH from %u polygons", ptr_polygons.size() );
-
-		// Compute bounding box from vertex data
-		BoundingBox bbox( Point3( RISE_INFINITY, RISE_INFINITY, RISE_INFINITY ), Point3( -RISE_INFINITY, -RISE_INFINITY, -RISE_INFINITY ) );
-		std::vector<const PointerTriangle*> temp;
-
-		MyPointerTriangleList::iterator pi, pe;
-		for( pi=ptr_polygons.begin(), pe=ptr_polygons.end(); pi!=pe; pi++ ) {
-			temp.push_back( &(*pi) );
-		}
-
-		MyPointsList::const_iterator mi, mn;
-		for( mi=pPoints.begin(), mn=pPoints.end(); mi!=mn; mi++ ) {
-			bbox.Include( *mi );
-		}
-
-		safe_release( pPtrBVH );
-
-		AccelerationConfig cfg;
-		cfg.maxLeafSize            = 4;
-		cfg.binCount               = 32;
-		cfg.sahTraversalCost       = 1.0;
-		cfg.sahIntersectionCost    = 1.0;
-		cfg.doubleSided            = bDoubleSided;
+	if( !bvhCacheLoaded && numTriangles() > 0 ) {
+		GlobalLog()->PrintEx( eLog_Info, "TriangleMeshGeometryIndexed::Deserialize:: Rebuilding BVH from %u polygons", (unsigned int)numTriangles() );
 
-		pPtrBVH = new BVH<const PointerTriangle*>( *this, temp, bbox, cfg );
-		GlobalLog()->PrintNew( pPtrBVH, __FILE__, __LINE__, "pointers BVH (rebuilt from .risemesh polygon data)" );
+		BuildPolygonBVH( "pointers BVH (rebuilt from .risemesh polygon data)" );
 		GlobalLog()->PrintEx( eLog_Info, "TriangleMeshGeometryIndexed::Deserialize:: BVH rebuilt successfully" );
 	}
 
@@ -1229,39 +1627,41 @@ SurfaceDerivatives TriangleMeshGeometryIndexed::ComputeSurfaceDerivatives( const
 	// IntersectRay (stage 1.1 of the SMS work), avoiding this walk.
 	const Scalar epsTol = 1e-3;
 
-	const PointerTriangle* bestTri = 0;
+	bool bFound = false;
+	unsigned int bestTri = 0;
 	Scalar bestU = 0, bestV = 0;
 	Scalar bestOutOfPlane = RISE_INFINITY;
 
-	for( MyPointerTriangleList::const_iterator it = ptr_polygons.begin();
-		it != ptr_polygons.end(); ++it )
+	const unsigned int nTris = static_cast<unsigned int>( numTriangles() );
+	for( unsigned int ti = 0; ti < nTris; ti++ )
 	{
-		const PointerTriangle& tri = *it;
+		Point3 p0, p1, p2;
+		TrianglePositions( ti, p0, p1, p2 );
 		Scalar u = 0, v = 0;
 		bool inside = false;
-		BarycentricCoords( *tri.pVertices[0], *tri.pVertices[1], *tri.pVertices[2],
-			objSpacePoint, u, v, inside, epsTol );
+		BarycentricCoords( p0, p1, p2, objSpacePoint, u, v, inside, epsTol );
 		if( !inside ) continue;
 
 		// Verify the point is actually on the triangle's plane (not just
 		// inside its prism).
-		const Vector3 e1 = Vector3Ops::mkVector3( *tri.pVertices[1], *tri.pVertices[0] );
-		const Vector3 e2 = Vector3Ops::mkVector3( *tri.pVertices[2], *tri.pVertices[0] );
+		const Vector3 e1 = Vector3Ops::mkVector3( p1, p0 );
+		const Vector3 e2 = Vector3Ops::mkVector3( p2, p0 );
 		Vector3 faceN = Vector3Ops::Cross( e1, e2 );
 		const Scalar faceNLen = Vector3Ops::Magnitude( faceN );
 		if( faceNLen < NEARZERO ) continue;
 		faceN = faceN * (1.0 / faceNLen);
-		const Vector3 delta = Vector3Ops::mkVector3( objSpacePoint, *tri.pVertices[0] );
+		const Vector3 delta = Vector3Ops::mkVector3( objSpacePoint, p0 );
 		const Scalar oop = std::fabs( Vector3Ops::Dot( faceN, delta ) );
 		if( oop < bestOutOfPlane ) {
-			bestTri = &tri;
+			bFound = true;
+			bestTri = ti;
 			bestU = u;
 			bestV = v;
 			bestOutOfPlane = oop;
 		}
 	}
 
-	if( !bestTri ) {
+	if( !bFound ) {
 		// Fallback: no triangle found containing the point.  Return a
 		// reasonable tangent frame from the normal so callers don't NaN.
 		SurfaceDerivatives sd;
@@ -1276,6 +1676,7 @@ SurfaceDerivatives TriangleMeshGeometryIndexed::ComputeSurfaceDerivatives( const
 		return sd;
 	}
 
-	return ComputeTriangleDerivatives( *bestTri, objSpaceNormal, objSpacePoint,
+	TriangleCorners corners;
+	return ComputeTriangleDerivatives( ResolveTriangle( bestTri, corners ), objSpaceNormal, objSpacePoint,
 		bestU, bestV, !bUseFaceNormals );
 }
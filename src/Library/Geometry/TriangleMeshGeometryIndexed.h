@@ -20,6 +20,7 @@
 #include "../Acceleration/BVH.h"
 #include "../Acceleration/AccelerationConfig.h"
 #include <vector>
+#include <stdint.h>
 
 namespace RISE
 {
@@ -28,7 +29,7 @@ namespace RISE
 		class TriangleMeshGeometryIndexed :
 			public virtual ITriangleMeshGeometryIndexed3,
 			public virtual Geometry,
-			public virtual TreeElementProcessor<const PointerTriangle*>
+			public virtual TreeElementProcessor<unsigned int>
 		{
 		protected:
 			virtual ~TriangleMeshGeometryIndexed();
@@ -72,13 +73,39 @@ namespace RISE
 			bool					bDoubleSided;		// Are the polygons all double sided?
 			bool					bUseFaceNormals;	// Are we going to use computed face normals rather than interpolated vertex normals?
 
+			// Compact layout (SetCompactStorage).  Replaces pPoints,
+			// pNormals, pCoords and ptr_polygons once the triangles are
+			// done: one unified vertex per distinct (position, normal,
+			// coord) corner, float positions, octahedral normals, UVs
+			// quantized to 16 bits over the mesh's UV bounds, and 16-bit
+			// indices when the mesh has at most 65536 vertices.  Triangles
+			// are in Morton order and vertices in order of first use, so
+			// a BVH leaf's corners sit close together in memory.  Colors,
+			// tangents and TEXCOORD_1 stay in full precision, re-indexed
+			// to the unified vertices.
+			bool					bCompact;
+			unsigned int			nCompactVertices;
+			unsigned int			nCompactTriangles;
+			std::vector<float>		cPositions;			// xyz per vertex
+			std::vector<uint32_t>	cNormals;			// snorm16 octahedral pair per vertex, empty with face normals
+			std::vector<uint32_t>	cCoords;			// unorm16 pair per vertex
+			Scalar					cCoordMin[2];		// UV bounds the coords are quantized over
+			Scalar					cCoordScale[2];
+			std::vector<uint16_t>	cIndices16;			// 3 per triangle, <= 65536 vertices
+			std::vector<uint32_t>	cIndices32;			// 3 per triangle otherwise
+
 			// BVH is the sole active acceleration structure (Tier A2 cleanup,
 			// 2026-04-27).  Legacy BSP/octree members were dropped along with
 			// the on-disk v4 format that stops emitting BSP/octree bytes.
 			// Pre-A2 v1/v2/v3 .risemesh files still load — the legacy bytes
 			// are read into Deserialize-local temporaries, validated, and
 			// discarded, never reaching this class as state.
-			BVH<const PointerTriangle*>*		pPtrBVH;
+			//
+			// Elements are triangle indices, into ptr_polygons or the
+			// compact index arrays.  The default layout is not free of
+			// this: each element test looks its triangle up through the
+			// index and takes the (always predicted) bCompact branch.
+			BVH<unsigned int>*		pPtrBVH;
 
 			TriangleAreasList		areas;				// Areas of the triangles
 			TriangleAreasList		areasCDF;			// Cumulative density function of the triangle areas
@@ -89,9 +116,65 @@ namespace RISE
 			// triangle appears in multiple BSP leaves.
 #ifdef RISE_ENABLE_MAILBOXING
 			const unsigned int					geometryId;
-			size_t numTriangles() const { return ptr_polygons.size(); }
 #endif
 
+			//! One triangle's corners, resolved for shading.  In the default
+			//! layout ResolveTriangle returns the ptr_polygons entry itself;
+			//! in the compact layout it decodes the corners into v/n/c here
+			//! and returns `tri`, which points at them.
+			struct TriangleCorners
+			{
+				PointerTriangle		tri;
+				Vertex				v[3];
+				Normal				n[3];
+				TexCoord			c[3];
+				unsigned int		iv[3];		// position index per corner (colors, tangents)
+				unsigned int		ic[3];		// coord index per corner (TEXCOORD_1)
+			};
+
+			size_t numTriangles() const { return bCompact ? nCompactTriangles : ptr_polygons.size(); }
+
+			inline unsigned int CompactIndex( const size_t t, const int k ) const
+			{
+				return cIndices32.empty() ? cIndices16[t*3+k] : cIndices32[t*3+k];
+			}
+
+			inline Point3 CompactPosition( const unsigned int i ) const
+			{
+				const float* p = &cPositions[size_t(i)*3];
+				return Point3( p[0], p[1], p[2] );
+			}
+
+			//! The triangle's three positions, exact in both layouts
+			inline void TrianglePositions( const unsigned int t, Point3& a, Point3& b, Point3& c ) const
+			{
+				if( bCompact ) {
+					a = CompactPosition( CompactIndex( t, 0 ) );
+					b = CompactPosition( CompactIndex( t, 1 ) );
+					c = CompactPosition( CompactIndex( t, 2 ) );
+				} else {
+					const PointerTriangle& p = ptr_polygons[t];
+					a = *p.pVertices[0];
+					b = *p.pVertices[1];
+					c = *p.pVertices[2];
+				}
+			}
+
+			const PointerTriangle& ResolveTriangle( const unsigned int t, TriangleCorners& s ) const;
+
+			//! Builds the compact layout from the given triangles and the
+			//! attribute lists, then releases those lists.  Returns false,
+			//! leaving everything untouched, if a triangle indexes past
+			//! its lists.
+			bool BuildCompactStorage( const IndexTriangleListType& tris, const bool bReorderTriangles );
+
+			//! Writes a compact mesh's points, normals, coords, colors and
+			//! triangles as the regular .risemesh blocks
+			void SerializeCompactGeometry( IWriteBuffer& buffer ) const;
+
+			//! (Re)builds the BVH over every triangle
+			void BuildPolygonBVH( const char* szWhat );
+
 			//! Computes the triangle areas and the CDF
 			void ComputeAreas();
 
@@ -133,14 +216,24 @@ namespace RISE
 			void AddTexCoords( const TexCoordsListType& coords ) override;
 			void AddIndexedTriangle( const IndexedTriangle& tri ) override;
 			void AddIndexedTriangles( const IndexTriangleListType& tris ) override;
-			unsigned int numPoints( ) const	override	{ return static_cast<unsigned int>(pPoints.size()); }
-			unsigned int numNormals( ) const override	{ return static_cast<unsigned int>(pNormals.size()); }
-			unsigned int numCoords( ) const	override	{ return static_cast<unsigned int>(pCoords.size()); }
+			unsigned int numPoints( ) const	override	{ return bCompact ? nCompactVertices : static_cast<unsigned int>(pPoints.size()); }
+			unsigned int numNormals( ) const override	{ return bCompact ? static_cast<unsigned int>(cNormals.size()) : static_cast<unsigned int>(pNormals.size()); }
+			unsigned int numCoords( ) const	override	{ return bCompact ? nCompactVertices : static_cast<unsigned int>(pCoords.size()); }
 			MyPointsList const& getVertices() const { return pPoints; }
 			MyNormalsList const& getNormals() const { return pNormals; }
 			MyCoordsList const& getCoords() const { return pCoords; }
 			MyPointerTriangleList const& getFaces() const { return ptr_polygons; }
 
+			//! Opt-in compact layout (the `mesh_compact_storage` option for
+			//! meshes the scene creates).  Must be set before
+			//! DoneIndexedTriangles or Deserialize.  A compact mesh renders
+			//! the same triangles to float position precision; its
+			//! getVertices / getNormals / getCoords / getFaces lists are
+			//! empty, it serializes in the regular .risemesh format, and it
+			//! cannot be refit with UpdateVertices.
+			void SetCompactStorage( const bool bCompact_ ) { bCompact = bCompact_; }
+			bool IsCompactStorage() const { return bCompact; }
+
 			// ITriangleMeshGeometryIndexed2 — per-vertex color support.
 			void AddColor( const VertexColor& color ) override;
 			void AddColors( const VertexColorsListType& colors ) override;
@@ -167,7 +260,7 @@ namespace RISE
 			//! Returns the BVH refit duration in milliseconds for
 			//! caller bench reporting.  Returns 0 if there is no
 			//! current BVH (caller should call DoneIndexedTriangles
-			//! first) or on size mismatch.
+			//! first), on size mismatch, or for a compact mesh.
 			//!
 			//! Thread-safety: must be called between frames, never
 			//! concurrent with intersection.  See docs/BVH_ACCELERATION_PLAN.md
@@ -178,7 +271,7 @@ namespace RISE
 			void ComputeVertexNormals() override;
 
 			// From TreeElementProcessor
-			typedef const PointerTriangle*	MYOBJ;
+			typedef unsigned int			MYOBJ;
 				void RayElementIntersection( RayIntersectionGeometric& ri, const MYOBJ elem, const bool bHitFrontFaces, const bool bHitBackFaces ) const override;
 				void RayElementIntersection( RayIntersection& ri, const MYOBJ elem, const bool bHitFrontFaces, const bool bHitBackFaces, const bool bComputeExitInfo ) const override;
 				bool RayElementIntersection_IntersectionOnly( const Ray& ray, const Scalar dHowFar, const MYOBJ elem, const bool bHitFrontFaces, const bool bHitBackFaces ) const override;
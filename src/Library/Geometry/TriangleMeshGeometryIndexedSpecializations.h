@@ -22,9 +22,10 @@ namespace RISE
 	BoundingBox TriangleMeshGeometryIndexed::GetElementBoundingBox( const MYOBJ elem ) const
 	{
 		BoundingBox bbTri( Point3(RISE_INFINITY,RISE_INFINITY,RISE_INFINITY), Point3(-RISE_INFINITY,-RISE_INFINITY,-RISE_INFINITY) );
-		const PointerTriangle& p = *elem;
+		Point3 p[3];
+		TrianglePositions( elem, p[0], p[1], p[2] );
 		for( int j=0; j<3; j++ ) {
-			bbTri.Include( *p.pVertices[j] );
+			bbTri.Include( p[j] );
 		}
 		return bbTri;
 	}
@@ -39,7 +40,17 @@ namespace RISE
 		// is handled inside the BVH float Möller-Trumbore via an
 		// epsilon-padded barycentric check — the filter never wrong-
 		// rejects a hit the double-precision certifier would catch.
-		const PointerTriangle& tri = *elem;
+		// Compact meshes already hold float positions; copy them.
+		if( bCompact ) {
+			const float* p0 = &cPositions[size_t(CompactIndex( elem, 0 ))*3];
+			const float* p1 = &cPositions[size_t(CompactIndex( elem, 1 ))*3];
+			const float* p2 = &cPositions[size_t(CompactIndex( elem, 2 ))*3];
+			v0[0] = p0[0]; v0[1] = p0[1]; v0[2] = p0[2];
+			v1[0] = p1[0]; v1[1] = p1[1]; v1[2] = p1[2];
+			v2[0] = p2[0]; v2[1] = p2[1]; v2[2] = p2[2];
+			return true;
+		}
+		const PointerTriangle& tri = ptr_polygons[elem];
 		v0[0] = (float)tri.pVertices[0]->x; v0[1] = (float)tri.pVertices[0]->y; v0[2] = (float)tri.pVertices[0]->z;
 		v1[0] = (float)tri.pVertices[1]->x; v1[1] = (float)tri.pVertices[1]->y; v1[2] = (float)tri.pVertices[1]->z;
 		v2[0] = (float)tri.pVertices[2]->x; v2[1] = (float)tri.pVertices[2]->y; v2[2] = (float)tri.pVertices[2]->z;
@@ -48,13 +59,14 @@ namespace RISE
 
 	bool TriangleMeshGeometryIndexed::ElementBoxIntersection( const MYOBJ elem, const BoundingBox& bbox ) const
 	{
-		const PointerTriangle&	p = *elem;
+		Point3 pv[3];
+		TrianglePositions( elem, pv[0], pv[1], pv[2] );
 
 		//
 		// Trivial acception, any of the points are inside the box
 		//
 		for( int j=0; j<3; j++ ) {
-			if( GeometricUtilities::IsPointInsideBox( *p.pVertices[j], bbox.ll, bbox.ur ) ) {
+			if( GeometricUtilities::IsPointInsideBox( pv[j], bbox.ll, bbox.ur ) ) {
 				// Then this polygon qualifies
 				return true;
 			}
@@ -69,8 +81,8 @@ namespace RISE
 		Ray		ray;
 		Scalar fEdgeLength;
 
-		ray.origin = *p.pVertices[0];
-		{ Vector3 d = Vector3Ops::mkVector3( *p.pVertices[1], *p.pVertices[0] ); fEdgeLength = Vector3Ops::NormalizeMag(d); ray.SetDir(d); }
+		ray.origin = pv[0];
+		{ Vector3 d = Vector3Ops::mkVector3( pv[1], pv[0] ); fEdgeLength = Vector3Ops::NormalizeMag(d); ray.SetDir(d); }
 
 		RayBoxIntersection( ray, h, bbox.ll, bbox.ur );
 		if( h.bHit && h.dRange <= fEdgeLength ) {
@@ -78,8 +90,8 @@ namespace RISE
 		}
 
 		// Edge 2
-		ray.origin = *p.pVertices[1];
-		{ Vector3 d = Vector3Ops::mkVector3( *p.pVertices[2], *p.pVertices[1] ); fEdgeLength = Vector3Ops::NormalizeMag(d); ray.SetDir(d); }
+		ray.origin = pv[1];
+		{ Vector3 d = Vector3Ops::mkVector3( pv[2], pv[1] ); fEdgeLength = Vector3Ops::NormalizeMag(d); ray.SetDir(d); }
 
 		RayBoxIntersection( ray, h, bbox.ll, bbox.ur );
 		if( h.bHit && h.dRange <= fEdgeLength ) {
@@ -88,8 +100,8 @@ namespace RISE
 		
 
 		// Edge 3
-		ray.origin = *p.pVertices[2];
-		{ Vector3 d = Vector3Ops::mkVector3( *p.pVertices[0], *p.pVertices[2] ); fEdgeLength = Vector3Ops::NormalizeMag(d); ray.SetDir(d); }
+		ray.origin = pv[2];
+		{ Vector3 d = Vector3Ops::mkVector3( pv[0], pv[2] ); fEdgeLength = Vector3Ops::NormalizeMag(d); ray.SetDir(d); }
 
 		RayBoxIntersection( ray, h, bbox.ll, bbox.ur );
 		if( h.bHit && h.dRange <= fEdgeLength ) {
@@ -110,7 +122,8 @@ namespace RISE
 
 	char TriangleMeshGeometryIndexed::WhichSideofPlaneIsElement( const MYOBJ elem, const Plane& plane ) const
 	{
-		return GeometricUtilities::WhichSideOfPlane( plane, *elem );
+		TriangleCorners corners;
+		return GeometricUtilities::WhichSideOfPlane( plane, ResolveTriangle( elem, corners ) );
 	}
 
 	void TriangleMeshGeometryIndexed::RayElementIntersection( RayIntersectionGeometric& ri, const MYOBJ elem, const bool bHitFrontFaces, const bool bHitBackFaces ) const
@@ -118,8 +131,8 @@ namespace RISE
 		// Mailboxing: skip triangles already tested for this ray
 #ifdef RISE_ENABLE_MAILBOXING
 		{
-			MailboxState& mb = GetMailbox(geometryId, ptr_polygons.size());
-			const unsigned int triIdx = static_cast<unsigned int>( elem - &ptr_polygons[0] );
+			MailboxState& mb = GetMailbox(geometryId, numTriangles());
+			const unsigned int triIdx = elem;
 			if( mb.stamps[triIdx] == mb.rayId ) {
 				return;
 			}
@@ -135,12 +148,13 @@ namespace RISE
 		// We can omit triangles that aren't facing us (dot product is > 0) since they
 		// can't possibly hit
 
-		const PointerTriangle&	thisTri = *elem;
+		Point3 p0, p1, p2;
+		TrianglePositions( elem, p0, p1, p2 );
 
 		// Early rejection is based on whether we are to consider front facing triangles or 
 		// back facing triangles and so on...
-		const Vector3 vEdgeA = Vector3Ops::mkVector3( *thisTri.pVertices[1], *thisTri.pVertices[0] );
-		const Vector3 vEdgeB = Vector3Ops::mkVector3( *thisTri.pVertices[2], *thisTri.pVertices[0] );
+		const Vector3 vEdgeA = Vector3Ops::mkVector3( p1, p0 );
+		const Vector3 vEdgeB = Vector3Ops::mkVector3( p2, p0 );
 		const Vector3 vFaceNormal = Vector3Ops::Cross( vEdgeA, vEdgeB );
 
 		// If we are not to hit front faces and we are front facing, then beat it!
@@ -158,7 +172,7 @@ namespace RISE
 		}
 
 		{
-			RayTriangleIntersection( ri.ray, h, *thisTri.pVertices[0], vEdgeA, vEdgeB );
+			RayTriangleIntersection( ri.ray, h, p0, vEdgeA, vEdgeB );
 
 			// Cleanup §1: native closest-hit check.  Previously this
 			// unconditionally overwrote ri.range on hit; BSP traversal
@@ -170,6 +184,11 @@ namespace RISE
 			// to preserve the closest-hit invariant.  Recovers the
 			// per-element-copy overhead Phase 1 §6.2 documented.
 			if( h.bHit && h.dRange < ri.range ) {
+				// Normals, coords and attribute indices are only needed
+				// once the triangle is hit; a compact mesh decodes them here
+				TriangleCorners corners;
+				const PointerTriangle& thisTri = ResolveTriangle( elem, corners );
+
 				ri.bHit = true;
 				ri.range = h.dRange;
 
@@ -182,9 +201,7 @@ namespace RISE
 				if( ri.bWantsWireEdgeInfo ) {
 					ri.ptWireNearestEdge = WireClosestPointOnTriangleEdges(
 						ri.ray.PointAtLength( h.dRange ),
-						*thisTri.pVertices[0],
-						*thisTri.pVertices[1],
-						*thisTri.pVertices[2] );
+						p0, p1, p2 );
 					ri.bHasWireEdgeInfo = true;
 				}
 
@@ -220,18 +237,17 @@ namespace RISE
 				// indexed parallel to pCoords (same iCoords[k] from the
 				// IndexedTriangle stage — glTF assets that ship both
 				// TEXCOORD_0 and TEXCOORD_1 use the same vertex indices
-				// for both).  Recover the index by pointer arithmetic
-				// against pCoords[0]'s base, the same trick the per-
+				// for both).  ResolveTriangle hands back each corner's
+				// coord index, as it does the position index the per-
 				// vertex color block below uses for pColors.  Falls back
 				// to pCoord (UV0) when TEXCOORD_1 is absent so painters
 				// wrapped to sample UV1 on assets without it degrade to
 				// sampling UV0 — matches how the importer warns when an
 				// asset declares texcoord=1 but provides no UV1.
-				if( !pTexCoords1.empty() && !pCoords.empty() ) {
-					const Point2* pCoordsBase = &pCoords[0];
-					const size_t i0 = (size_t)( thisTri.pCoords[0] - pCoordsBase );
-					const size_t i1 = (size_t)( thisTri.pCoords[1] - pCoordsBase );
-					const size_t i2 = (size_t)( thisTri.pCoords[2] - pCoordsBase );
+				if( !pTexCoords1.empty() ) {
+					const size_t i0 = corners.ic[0];
+					const size_t i1 = corners.ic[1];
+					const size_t i2 = corners.ic[2];
 					if( i0 < pTexCoords1.size() && i1 < pTexCoords1.size() && i2 < pTexCoords1.size() ) {
 						ri.ptCoord1 = Point2Ops::mkPoint2( pTexCoords1[i0],
 							Vector2Ops::mkVector2( pTexCoords1[i1], pTexCoords1[i0] ) * a +
@@ -250,13 +266,11 @@ namespace RISE
 				// vertex *position* index (the convention every common
 				// exporter produces — see the comment on
 				// ITriangleMeshGeometryIndexed2 for why we don't carry a
-				// fourth iColors[3]).  Recover the position index from
-				// the PointerTriangle by pointer arithmetic into pPoints.
-				if( !pColors.empty() && !pPoints.empty() ) {
-					const Vertex* pBase = &pPoints[0];
-					const size_t i0 = (size_t)( thisTri.pVertices[0] - pBase );
-					const size_t i1 = (size_t)( thisTri.pVertices[1] - pBase );
-					const size_t i2 = (size_t)( thisTri.pVertices[2] - pBase );
+				// fourth iColors[3]).
+				if( !pColors.empty() ) {
+					const size_t i0 = corners.iv[0];
+					const size_t i1 = corners.iv[1];
+					const size_t i2 = corners.iv[2];
 					if( i0 < pColors.size() && i1 < pColors.size() && i2 < pColors.size() ) {
 						const VertexColor& c0 = pColors[i0];
 						ri.vColor = c0 + (pColors[i1] - c0) * a + (pColors[i2] - c0) * b;
@@ -280,11 +294,10 @@ namespace RISE
 				//
 				// Tangent vector is interpolated linearly without renormalising;
 				// caller (NormalMap) normalises after world-space transform.
-				if( !pTangents.empty() && !pPoints.empty() ) {
-					const Vertex* pBase = &pPoints[0];
-					const size_t i0 = (size_t)( thisTri.pVertices[0] - pBase );
-					const size_t i1 = (size_t)( thisTri.pVertices[1] - pBase );
-					const size_t i2 = (size_t)( thisTri.pVertices[2] - pBase );
+				if( !pTangents.empty() ) {
+					const size_t i0 = corners.iv[0];
+					const size_t i1 = corners.iv[1];
+					const size_t i2 = corners.iv[2];
 					if( i0 < pTangents.size() && i1 < pTangents.size() && i2 < pTangents.size() ) {
 						const Vector3& t0 = pTangents[i0].dir;
 						ri.vTangent = t0
@@ -338,8 +351,8 @@ namespace RISE
 				//   - pCoords[i] null on any vertex: no UV data; same
 				//     fall-back.
 				const Vector3 shadingNormal = Vector3Ops::Normalize( ri.vNormal );
-				const Vector3 e1 = Vector3Ops::mkVector3( *thisTri.pVertices[1], *thisTri.pVertices[0] );
-				const Vector3 e2 = Vector3Ops::mkVector3( *thisTri.pVertices[2], *thisTri.pVertices[0] );
+				const Vector3& e1 = vEdgeA;
+				const Vector3& e2 = vEdgeB;
 
 				// UV deltas (if vertex UVs are available).
 				bool useUVJacobian = false;
@@ -480,8 +493,8 @@ namespace RISE
 		// Mailboxing: skip triangles already tested for this ray
 #ifdef RISE_ENABLE_MAILBOXING
 		{
-			MailboxState& mb = GetMailbox(geometryId, ptr_polygons.size());
-			const unsigned int triIdx = static_cast<unsigned int>( elem - &ptr_polygons[0] );
+			MailboxState& mb = GetMailbox(geometryId, numTriangles());
+			const unsigned int triIdx = elem;
 			if( mb.stamps[triIdx] == mb.rayId ) {
 				return false;
 			}
@@ -489,13 +502,14 @@ namespace RISE
 		}
 #endif
 
-		const PointerTriangle&	thisTri = *elem;
+		Point3 p0, p1, p2;
+		TrianglePositions( elem, p0, p1, p2 );
 
 		// Early rejection is based on whether we are to consider front facing triangles or 
 		// back facing triangles and so on...
 
-		const Vector3 vEdgeA = Vector3Ops::mkVector3( *thisTri.pVertices[1], *thisTri.pVertices[0] );
-		const Vector3 vEdgeB = Vector3Ops::mkVector3( *thisTri.pVertices[2], *thisTri.pVertices[0] );
+		const Vector3 vEdgeA = Vector3Ops::mkVector3( p1, p0 );
+		const Vector3 vEdgeB = Vector3Ops::mkVector3( p2, p0 );
 		Vector3 vFaceNormal = Vector3Ops::Cross( vEdgeA, vEdgeB );
 
 		// If we are not to hit front faces and we are front facing, then beat it!
@@ -514,7 +528,7 @@ namespace RISE
 
 		{
 			TRIANGLE_HIT h;
-			RayTriangleIntersection( ray, h, *thisTri.pVertices[0], vEdgeA, vEdgeB );
+			RayTriangleIntersection( ray, h, p0, vEdgeA, vEdgeB );
 
 			if( h.bHit && (h.dRange > NEARZERO && h.dRange < dHowFar) ) {
 				return true;
@@ -526,25 +540,13 @@ namespace RISE
 
 	void TriangleMeshGeometryIndexed::SerializeElement( IWriteBuffer& buffer, const MYOBJ elem ) const
 	{
-		// Convert, assume the void* is the pointer to the begining
-		unsigned int begining = VoidPtrToUInt( (void*)&(*ptr_polygons.begin()) );
-		unsigned int ours = VoidPtrToUInt( (void*)(elem) );
-
-		unsigned int idx = (ours-begining) / sizeof( PointerTriangle );
-		buffer.setUInt( idx );
+		// Elements are already triangle indices
+		buffer.setUInt( elem );
 	}
 
 	void TriangleMeshGeometryIndexed::DeserializeElement( IReadBuffer& buffer, MYOBJ& ret ) const
 	{
-		// we assume the pCustom is a pointer to the begining of a MyTriangle* we just do pointer 
-		// arithmetic.  NO!  Pointer arithmetic does NOT work on some platforms (the SGI Origin 3800 for example)
-		// Instead resort to using array tricks.
-
-		unsigned int idx = buffer.getUInt();
-		const char* pch = (const char*)(void*)&(*ptr_polygons.begin());
-		ret = (MYOBJ)&pch[idx*sizeof(PointerTriangle)];
-	//	unsigned int ptr = (VoidPtrToUInt( pCustom )) + (idx*sizeof(PointerTriangle));
-	//	ret = (MYOBJ)ptr;
+		ret = buffer.getUInt();
 	}
 }
 
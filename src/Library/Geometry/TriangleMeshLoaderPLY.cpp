@@ -16,6 +16,10 @@
 //  is read per schema — extra properties advance the file pointer
 //  correctly even when this loader has no use for them.
 //
+//  Binary elements whose records have a fixed size (scalars only, or a
+//  face list of 3) are bulk-read and converted on the thread pool; see
+//  LoadBinaryElementBulk.
+//
 //  License Information: Please see the attached LICENSE.TXT file
 //
 //////////////////////////////////////////////////////////////////////
@@ -25,8 +29,11 @@
 #include "GeometryUtilities.h"
 #include "../Interfaces/ILog.h"
 #include "../Utilities/MediaPathLocator.h"
+#include "../Utilities/ThreadPool.h"
 #include <stdio.h>
+#include <string.h>
 #include <ctype.h>
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -35,6 +42,26 @@ using namespace RISE::Implementation;
 
 namespace
 {
+	// 64-bit file positions, so meshes over 2 GB load where long is
+	// 32 bits (Windows)
+	inline long long FileTell64( FILE* f )
+	{
+#if defined(_MSC_VER)
+		return _ftelli64( f );
+#else
+		return (long long)ftello( f );
+#endif
+	}
+
+	inline bool FileSeek64( FILE* f, const long long offset, const int whence )
+	{
+#if defined(_MSC_VER)
+		return _fseeki64( f, offset, whence ) == 0;
+#else
+		return fseeko( f, (off_t)offset, whence ) == 0;
+#endif
+	}
+
 	enum PlyType {
 		PLY_INVALID = 0,
 		PLY_INT8,
@@ -175,7 +202,7 @@ namespace
 	{
 		const unsigned int n = PlyTypeSize( t );
 		if( n == 0 ) return false;
-		return fseek( f, (long)n, SEEK_CUR ) == 0;
+		return FileSeek64( f, n, SEEK_CUR );
 	}
 
 	// Tokenize a whitespace-separated line in place.  Modifies `line`
@@ -641,6 +668,217 @@ static bool LoadAsciiBodyImpl(
 	return true;
 }
 
+// Bulk path for binary elements with a fixed record size.  Scanned and
+// exported meshes almost always store a vertex as a run of scalars
+// (float x y z, maybe normals / uv / colors) and a face as a single
+// "list uchar int vertex_indices" of 3.  Such an element is read a slab of
+// records at a time with one fread, and the slab is converted on the
+// thread pool straight into the lists handed to AddVertices /
+// AddIndexedTriangles, instead of one fread + double conversion per value.
+// The values produced are exactly those of the per-value path.
+enum PlyBulkResult
+{
+	PLY_BULK_DECLINED,		// not a fixed layout; the file position is unchanged
+	PLY_BULK_LOADED,
+	PLY_BULK_FAILED
+};
+
+static const unsigned int kPlyBulkSlabRecords = 1u << 18;	// records per fread
+static const unsigned int kPlyBulkBlockRecords = 1u << 12;	// records per pool task
+
+// Value of one scalar of the given type at p, as ReadBinaryScalar reads it
+static inline double LoadBinaryScalar( const unsigned char* p, PlyType t, bool flip )
+{
+	switch( t ) {
+		case PLY_INT8:    { signed char v;    memcpy( &v, p, 1 ); return (double)v; }
+		case PLY_UINT8:   { unsigned char v;  memcpy( &v, p, 1 ); return (double)v; }
+		case PLY_INT16:   { short v;          memcpy( &v, p, 2 ); if( flip ) FlipBytes16( &v ); return (double)v; }
+		case PLY_UINT16:  { unsigned short v; memcpy( &v, p, 2 ); if( flip ) FlipBytes16( &v ); return (double)v; }
+		case PLY_INT32:   { int v;            memcpy( &v, p, 4 ); if( flip ) FlipBytes32( &v ); return (double)v; }
+		case PLY_UINT32:  { unsigned int v;   memcpy( &v, p, 4 ); if( flip ) FlipBytes32( &v ); return (double)v; }
+		case PLY_FLOAT32: { float v;          memcpy( &v, p, 4 ); if( flip ) FlipBytes32( &v ); return (double)v; }
+		case PLY_FLOAT64: { double v;         memcpy( &v, p, 8 ); if( flip ) FlipBytes64( &v ); return v; }
+		default:          return 0;
+	}
+}
+
+// Byte offset of every property within a record and the record size, if
+// the element has no list properties.  For the face element the index
+// list is allowed too, sized as a list of 3 (checked per record).
+static bool FixedRecordLayout(
+	const PlyElement& el,
+	const size_t listProperty,
+	std::vector<unsigned int>& offsets,
+	unsigned int& stride )
+{
+	offsets.clear();
+	stride = 0;
+	for( size_t pi = 0; pi < el.properties.size(); ++pi ) {
+		const PlyProperty& p = el.properties[pi];
+		offsets.push_back( stride );
+		if( !p.isList() ) {
+			stride += PlyTypeSize( p.type );
+		} else if( pi == listProperty && p.type != PLY_FLOAT32 && p.type != PLY_FLOAT64 ) {
+			stride += PlyTypeSize( p.countType ) + 3 * PlyTypeSize( p.type );
+		} else {
+			return false;
+		}
+	}
+	return stride > 0;
+}
+
+// Reads `count` records of `stride` bytes a slab at a time and hands each
+// slab to convert( slab, first record, record count ) on the thread pool,
+// one block of records per task.  convert returns false to reject a block.
+template< class Convert >
+static PlyBulkResult ReadRecordSlabs( FILE* inputFile, const unsigned int count, const unsigned int stride, Convert convert )
+{
+	std::vector<unsigned char> slab;
+	for( unsigned int base = 0; base < count; base += kPlyBulkSlabRecords ) {
+		const unsigned int n = std::min( count - base, kPlyBulkSlabRecords );
+		slab.resize( (size_t)n * stride );
+		if( fread( &slab[0], stride, n, inputFile ) != n ) {
+			return PLY_BULK_FAILED;
+		}
+
+		const unsigned int numBlocks = ( n + kPlyBulkBlockRecords - 1 ) / kPlyBulkBlockRecords;
+		std::vector<char> blockOk( numBlocks, 0 );
+		GlobalThreadPool().ParallelFor( numBlocks, [&]( unsigned int b )
+		{
+			const unsigned int first = b * kPlyBulkBlockRecords;
+			const unsigned int last = std::min( first + kPlyBulkBlockRecords, n );
+			blockOk[b] = convert( &slab[(size_t)first * stride], base + first, last - first ) ? 1 : 0;
+		} );
+		for( unsigned int b = 0; b < numBlocks; ++b ) {
+			if( !blockOk[b] ) {
+				return PLY_BULK_DECLINED;
+			}
+		}
+	}
+	return PLY_BULK_LOADED;
+}
+
+static PlyBulkResult LoadBinaryElementBulk(
+	ITriangleMeshGeometryIndexed* pGeom,
+	ITriangleMeshGeometryIndexed2* pGeom2,
+	FILE* inputFile,
+	const PlyElement& el,
+	const bool isVertex,
+	const bool isFace,
+	const PlyVertexLayout& vlay,
+	const PlyFaceLayout& flay,
+	const bool bFlipEndianess,
+	const bool bInvertFaces )
+{
+	std::vector<unsigned int> offsets;
+	unsigned int stride = 0;
+	if( !FixedRecordLayout( el, isFace ? flay.iIndices : kPlyMissing, offsets, stride ) ) {
+		return PLY_BULK_DECLINED;
+	}
+
+	if( !isVertex && !isFace ) {
+		// Nothing in it is used; step over the whole element
+		for( unsigned int left = el.count; left > 0; ) {
+			const unsigned int n = std::min( left, kPlyBulkSlabRecords );
+			if( !FileSeek64( inputFile, (long long)n * stride, SEEK_CUR ) ) {
+				return PLY_BULK_FAILED;
+			}
+			left -= n;
+		}
+		return PLY_BULK_LOADED;
+	}
+
+	if( isVertex ) {
+		const PlyType tx = el.properties[vlay.ix].type, ty = el.properties[vlay.iy].type, tz = el.properties[vlay.iz].type;
+		const unsigned int ox = offsets[vlay.ix], oy = offsets[vlay.iy], oz = offsets[vlay.iz];
+		const bool packedFloats = !bFlipEndianess && tx == PLY_FLOAT32 && ty == PLY_FLOAT32 && tz == PLY_FLOAT32 && oy == ox + 4 && oz == ox + 8;
+		const bool wantColors = pGeom2 && vlay.hasColor();
+
+		VerticesListType verts( el.count );
+		VertexColorsListType colors( wantColors ? el.count : 0 );
+		const PlyBulkResult res = ReadRecordSlabs( inputFile, el.count, stride,
+			[&]( const unsigned char* rec, unsigned int first, unsigned int n )
+		{
+			if( packedFloats ) {
+				// The common case: a native-order float triple
+				for( unsigned int i = 0; i < n; ++i ) {
+					float xyz[3];
+					memcpy( xyz, rec + (size_t)i * stride + ox, sizeof( xyz ) );
+					verts[first + i] = Vertex( xyz[0], xyz[1], xyz[2] );
+				}
+			} else {
+				for( unsigned int i = 0; i < n; ++i ) {
+					const unsigned char* r = rec + (size_t)i * stride;
+					verts[first + i] = Vertex(
+						LoadBinaryScalar( r + ox, tx, bFlipEndianess ),
+						LoadBinaryScalar( r + oy, ty, bFlipEndianess ),
+						LoadBinaryScalar( r + oz, tz, bFlipEndianess ) );
+				}
+			}
+			if( wantColors ) {
+				const PlyType tr = el.properties[vlay.ir].type, tg = el.properties[vlay.ig].type, tb = el.properties[vlay.ib].type;
+				for( unsigned int i = 0; i < n; ++i ) {
+					const unsigned char* r = rec + (size_t)i * stride;
+					colors[first + i] = ConvertPlyVertexColor(
+						LoadBinaryScalar( r + offsets[vlay.ir], tr, bFlipEndianess ), tr,
+						LoadBinaryScalar( r + offsets[vlay.ig], tg, bFlipEndianess ), tg,
+						LoadBinaryScalar( r + offsets[vlay.ib], tb, bFlipEndianess ), tb );
+				}
+			}
+			return true;
+		} );
+		if( res != PLY_BULK_LOADED ) {
+			return PLY_BULK_FAILED;		// a vertex record can't be rejected; this is a short read
+		}
+
+		pGeom->AddVertices( verts );
+		if( wantColors ) {
+			pGeom2->AddColors( colors );
+		}
+		return PLY_BULK_LOADED;
+	}
+
+	// Face element.  A record whose list isn't 3 long (a quad, say) means the
+	// layout isn't fixed after all: rewind and let the per-value path take
+	// the whole element.
+	const long long elementStart = FileTell64( inputFile );
+	const PlyProperty& list = el.properties[flay.iIndices];
+	const unsigned int oc = offsets[flay.iIndices];
+	const unsigned int oi = oc + PlyTypeSize( list.countType );
+	const unsigned int is = PlyTypeSize( list.type );
+
+	IndexTriangleListType tris( el.count );
+	const PlyBulkResult res = ReadRecordSlabs( inputFile, el.count, stride,
+		[&]( const unsigned char* rec, unsigned int first, unsigned int n )
+	{
+		for( unsigned int i = 0; i < n; ++i ) {
+			const unsigned char* r = rec + (size_t)i * stride;
+			if( (unsigned int)LoadBinaryScalar( r + oc, list.countType, bFlipEndianess ) != 3 ) {
+				return false;
+			}
+			const unsigned int a = (unsigned int)LoadBinaryScalar( r + oi, list.type, bFlipEndianess );
+			const unsigned int b = (unsigned int)LoadBinaryScalar( r + oi + is, list.type, bFlipEndianess );
+			const unsigned int c = (unsigned int)LoadBinaryScalar( r + oi + 2*is, list.type, bFlipEndianess );
+
+			// As EmitFace
+			IndexedTriangle& tri = tris[first + i];
+			tri.iVertices[0] = tri.iNormals[0] = a;
+			tri.iVertices[1] = tri.iNormals[1] = bInvertFaces ? c : b;
+			tri.iVertices[2] = tri.iNormals[2] = bInvertFaces ? b : c;
+			tri.iCoords[0] = tri.iCoords[1] = tri.iCoords[2] = 0;
+		}
+		return true;
+	} );
+
+	if( res == PLY_BULK_DECLINED ) {
+		return FileSeek64( inputFile, elementStart, SEEK_SET ) ? PLY_BULK_DECLINED : PLY_BULK_FAILED;
+	}
+	if( res == PLY_BULK_LOADED ) {
+		pGeom->AddIndexedTriangles( tris );
+	}
+	return res;
+}
+
 static bool LoadBinaryBodyImpl(
 	ITriangleMeshGeometryIndexed* pGeom,
 	ITriangleMeshGeometryIndexed2* pGeom2,
@@ -657,6 +895,14 @@ static bool LoadBinaryBodyImpl(
 		const bool isVertex = (ei == vlay.elementIndex);
 		const bool isFace   = (ei == flay.elementIndex);
 
+		const PlyBulkResult bulk = LoadBinaryElementBulk( pGeom, pGeom2, inputFile, el, isVertex, isFace, vlay, flay, bFlipEndianess, bInvertFaces );
+		if( bulk == PLY_BULK_FAILED ) {
+			return false;
+		}
+		if( bulk == PLY_BULK_LOADED ) {
+			continue;
+		}
+
 		for( unsigned int i = 0; i < el.count; ++i ) {
 
 			if( isVertex ) {
@@ -17,7 +17,13 @@
 #include "../Interfaces/ILog.h"
 #include "../Interfaces/ITriangleMeshGeometry.h"
 #include "../Utilities/MediaPathLocator.h"
+#include "../Utilities/ThreadPool.h"
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <algorithm>
 
 using namespace RISE;
 using namespace RISE::Implementation;
@@ -31,69 +37,216 @@ TriangleMeshLoaderRAW2::~TriangleMeshLoaderRAW2( )
 {
 }
 
+namespace
+{
+	// 64-bit file positions, so meshes over 2 GB load where long is
+	// 32 bits (Windows)
+	inline long long FileTell64( FILE* f )
+	{
+#if defined(_MSC_VER)
+		return _ftelli64( f );
+#else
+		return (long long)ftello( f );
+#endif
+	}
+
+	inline bool FileSeek64( FILE* f, const long long offset, const int whence )
+	{
+#if defined(_MSC_VER)
+		return _fseeki64( f, offset, whence ) == 0;
+#else
+		return fseeko( f, (off_t)offset, whence ) == 0;
+#endif
+	}
+
+	static const unsigned int kRaw2BlockLines = 1u << 12;	// lines per pool task
+
+	// Starts of the lines of `text`, as fgets would return them: every '\n'
+	// ends one, and a last line without one still counts
+	void SplitLines( const std::string& text, std::vector<size_t>& starts )
+	{
+		size_t pos = 0;
+		while( pos < text.size() ) {
+			starts.push_back( pos );
+			const size_t nl = text.find( '\n', pos );
+			pos = ( nl == std::string::npos ) ? text.size() : nl + 1;
+		}
+		starts.push_back( text.size() );
+	}
+
+	// Copies line `i` into a NUL-terminated buffer the size of the fgets
+	// buffer this loader used to read with, so number parsing can't run on
+	// into the next line
+	void CopyLine( const std::string& text, const std::vector<size_t>& starts, size_t i, char (&line)[4096] )
+	{
+		const size_t len = std::min( starts[i+1] - starts[i], sizeof( line ) - 1 );
+		memcpy( line, text.data() + starts[i], len );
+		line[len] = 0;
+	}
+
+	// The leading type character, then up to `max` numbers, as
+	// sscanf( "%c %lf %lf ..." ) reads them.  Returns the fields read.
+	int ScanRecord( const char* line, char& type, double* values, const int max )
+	{
+		if( !*line ) {
+			return 0;
+		}
+		type = *line++;
+		int n = 1;
+		for( int k = 0; k < max; ++k ) {
+			char* end = 0;
+			const double v = strtod( line, &end );
+			if( end == line ) {
+				break;
+			}
+			values[k] = v;
+			line = end;
+			++n;
+		}
+		return n;
+	}
+}
+
+// The file is read with one fread and its lines are parsed on the thread
+// pool straight into the lists handed to AddVertices / AddNormals /
+// AddTexCoords / AddIndexedTriangles, instead of a sscanf and an Add call
+// per line.
 bool TriangleMeshLoaderRAW2::LoadTriangleMesh( ITriangleMeshGeometryIndexed* pGeom )
 {
-	FILE* inputFile = fopen( szFilename, "r" );
+	FILE* inputFile = fopen( szFilename, "rb" );
 
 	if( !inputFile || !pGeom ) {
 		GlobalLog()->Print( eLog_Error, "TriangleMeshLoaderRAW2:: Failed to open file or bad geometry object" );
+		if( inputFile ) fclose( inputFile );
 		return false;
 	}
 
+	std::string text;
+	if( FileSeek64( inputFile, 0, SEEK_END ) ) {
+		const long long size = FileTell64( inputFile );
+		if( size > 0 && FileSeek64( inputFile, 0, SEEK_SET ) ) {
+			text.resize( (size_t)size );
+			text.resize( fread( &text[0], 1, text.size(), inputFile ) );
+		}
+	}
+	fclose( inputFile );
+
 	pGeom->BeginIndexedTriangles();
 
 	// RAW2 vertex line is "v vX vY vZ nX nY nZ cX cY [r g b]".
 	// The trailing R G B triple is optional and added 2026-04-28.
 	// Older files (no colors) parse with 9 sscanf fields; new files
-	// parse with 12.  Colors are buffered locally and attached to the
-	// geometry after the loop iff every vertex supplied them — partial
-	// coverage gets dropped with a warning to keep the color array
-	// aligned with pPoints.
+	// parse with 12.  Colors are attached to the geometry iff every
+	// vertex supplied them — partial coverage gets dropped with a
+	// warning to keep the color array aligned with pPoints.
 	ITriangleMeshGeometryIndexed2* pGeom2 = dynamic_cast<ITriangleMeshGeometryIndexed2*>( pGeom );
-	std::vector<RISEPel> pendingColors;
 
-	char line[4096];
+	std::vector<size_t> starts;
+	SplitLines( text, starts );
+	const size_t numLines = starts.size() - 1;
 
 	// First read how many vertices we have and how many polygons we have
-	fgets( (char*)&line, 4096, inputFile );
+	unsigned int numVerts = 0, numTris = 0;
+	if( numLines > 0 ) {
+		char line[4096];
+		CopyLine( text, starts, 0, line );
+		sscanf( line, "%u %u", &numVerts, &numTris );
+	}
 
-	unsigned int numVerts, numTris;
-	sscanf( line, "%u %u", &numVerts, &numTris );
+	if( numLines < 1 + (size_t)numVerts + (size_t)numTris ) {
+		GlobalLog()->Print( eLog_Error, "TriangleMeshLoaderRAW2:: Failed to read a line from the file" );
+		return false;
+	}
 
-	unsigned int i=0;
-	// Read through all the vertices
-	for( i=0; i<numVerts; i++ ) {
-		if( !fgets( (char*)&line, 4096, inputFile ) ) {
-			GlobalLog()->Print( eLog_Error, "TriangleMeshLoaderRAW2:: Failed to read a line from the file" );
-			return false;
-		}
+	VerticesListType		points( numVerts );
+	NormalsListType			normals( numVerts );
+	TexCoordsListType		coords( numVerts );
+	std::vector<RISEPel>	colors( numVerts );
+	IndexTriangleListType	tris( numTris );
 
-		char type;
-		double vX, vY, vZ, nX, nY, nZ, cX, cY;
-		double r = 0, g = 0, b = 0;
-		const int n = sscanf( line, "%c %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf",
-			&type, &vX, &vY, &vZ, &nX, &nY, &nZ, &cX, &cY, &r, &g, &b );
+	// Per block: how many of its vertices carried a color, and whether a line was rejected
+	const unsigned int numVertBlocks = ( numVerts + kRaw2BlockLines - 1 ) / kRaw2BlockLines;
+	const unsigned int numTriBlocks = ( numTris + kRaw2BlockLines - 1 ) / kRaw2BlockLines;
+	std::vector<unsigned int> coloredCount( numVertBlocks, 0 );
+	std::vector<char> badBlock( numVertBlocks + numTriBlocks, 0 );
 
-		if( type != 'v' || (n != 9 && n != 12) ) {
-			GlobalLog()->Print( eLog_Error, "TriangleMeshLoaderRAW2:: Expected a vertex but didn't get one" );
-			return false;
-		}
+	GlobalThreadPool().ParallelFor( numVertBlocks + numTriBlocks, [&]( unsigned int b )
+	{
+		char line[4096];
+		if( b < numVertBlocks ) {
+			const unsigned int first = b * kRaw2BlockLines;
+			const unsigned int last = std::min( first + kRaw2BlockLines, numVerts );
+			for( unsigned int i = first; i < last; ++i ) {
+				CopyLine( text, starts, 1 + i, line );
+				char type = 0;
+				double v[11] = {0};
+				const int n = ScanRecord( line, type, v, 11 );
+				if( type != 'v' || (n != 9 && n != 12) ) {
+					badBlock[b] = 1;
+					return;
+				}
+				points[i] = Vertex( v[0], v[1], v[2] );
+				normals[i] = Normal( v[3], v[4], v[5] );
+				coords[i] = TexCoord( v[6], v[7] );
+
+				if( n == 12 ) {
+					// RAW2 colors are conventionally sRGB-encoded floats in
+					// [0, 1] (matches the PLY uchar interpretation).
+					colors[i] = RISEPel( sRGBPel( v[8], v[9], v[10] ) );
+					coloredCount[b]++;
+				}
+			}
+		} else {
+			const unsigned int first = ( b - numVertBlocks ) * kRaw2BlockLines;
+			const unsigned int last = std::min( first + kRaw2BlockLines, numTris );
+			for( unsigned int i = first; i < last; ++i ) {
+				CopyLine( text, starts, 1 + numVerts + i, line );
+				const char type = line[0];
+				if( type != 't' ) {
+					badBlock[b] = 1;
+					return;
+				}
 
-		pGeom->AddVertex( Vertex( vX, vY, vZ ) );
-		pGeom->AddNormal( Normal( nX, nY, nZ ) );
-		pGeom->AddTexCoord( TexCoord( cX, cY ) );
+				unsigned int idx[3] = { 0, 0, 0 };
+				const char* p = line + 1;
+				for( int k = 0; k < 3; ++k ) {
+					char* end = 0;
+					idx[k] = (unsigned int)strtoul( p, &end, 10 );
+					if( end == p ) {
+						break;
+					}
+					p = end;
+				}
 
-		if( n == 12 ) {
-			// RAW2 colors are conventionally sRGB-encoded floats in
-			// [0, 1] (matches the PLY uchar interpretation).
-			pendingColors.push_back( RISEPel( sRGBPel( r, g, b ) ) );
+				IndexedTriangle& tri = tris[i];
+				tri.iVertices[0] = tri.iNormals[0] = tri.iCoords[0] = idx[0];
+				tri.iVertices[1] = tri.iNormals[1] = tri.iCoords[1] = idx[1];
+				tri.iVertices[2] = tri.iNormals[2] = tri.iCoords[2] = idx[2];
+			}
+		}
+	} );
+
+	for( unsigned int b = 0; b < numVertBlocks + numTriBlocks; ++b ) {
+		if( badBlock[b] ) {
+			GlobalLog()->Print( eLog_Error, b < numVertBlocks ?
+				"TriangleMeshLoaderRAW2:: Expected a vertex but didn't get one" :
+				"TriangleMeshLoaderRAW2:: Expected a triangle but didn't get one" );
+			return false;
 		}
 	}
 
-	if( !pendingColors.empty() ) {
-		if( pendingColors.size() == numVerts && pGeom2 ) {
-			pGeom2->AddColors( pendingColors );
-		} else if( pendingColors.size() != numVerts ) {
+	pGeom->AddVertices( points );
+	pGeom->AddNormals( normals );
+	pGeom->AddTexCoords( coords );
+
+	unsigned int numColored = 0;
+	for( unsigned int b = 0; b < numVertBlocks; ++b ) {
+		numColored += coloredCount[b];
+	}
+	if( numColored > 0 ) {
+		if( numColored == numVerts && pGeom2 ) {
+			pGeom2->AddColors( colors );
+		} else if( numColored != numVerts ) {
 			GlobalLog()->PrintEasyWarning(
 				"TriangleMeshLoaderRAW2:: file mixes colored and uncolored vertex lines — colors dropped" );
 		} else if( !pGeom2 ) {
@@ -102,34 +255,9 @@ bool TriangleMeshLoaderRAW2::LoadTriangleMesh( ITriangleMeshGeometryIndexed* pGe
 		}
 	}
 
-	// Read the triangles
-	for( i=0; i<numTris; i++ ){
-		if( !fgets( (char*)&line, 4096, inputFile ) ) {
-			GlobalLog()->Print( eLog_Error, "TriangleMeshLoaderRAW2:: Failed to read a line from the file" );
-			return false;
-		}
-
-		char type;
-		unsigned int a, b, c;
-		sscanf( line, "%c %u %u %u", &type, &a, &b, &c );
-
-		if( type != 't' ) {
-			GlobalLog()->Print( eLog_Error, "TriangleMeshLoaderRAW2:: Expected a triangle but didn't get one" );
-			return false;
-		}
-
-		IndexedTriangle tri;
-		tri.iVertices[0] = tri.iNormals[0] = tri.iCoords[0] = a;
-		tri.iVertices[1] = tri.iNormals[1] = tri.iCoords[1] = b;
-		tri.iVertices[2] = tri.iNormals[2] = tri.iCoords[2] = c;
-
-		pGeom->AddIndexedTriangle( tri );
-	}
+	pGeom->AddIndexedTriangles( tris );
 
 	pGeom->DoneIndexedTriangles();
 
-	fclose( inputFile );
-
 	return true;
 }
-
@@ -77,6 +77,7 @@
 #include <cstdio>
 #include <cstring>
 #include <memory>
+#include <map>
 #include <set>
 #include <sstream>
 #include <string>
@@ -268,6 +269,15 @@ namespace
 	std::string ObjectName   ( const std::string& prefix, size_t nodeIdx, size_t prim ) {
 		std::ostringstream oss; oss << prefix << ".obj.n" << nodeIdx << ".p" << prim; return oss.str();
 	}
+	// An instance array is keyed by mesh+prim (it replaces every node's
+	// object for that primitive), so both its geometry and its one
+	// placing object are named after the primitive, not a node.
+	std::string InstancesGeomName  ( const std::string& prefix, size_t mesh, size_t prim ) {
+		return GeomName( prefix, mesh, prim ) + ".instances";
+	}
+	std::string InstancesObjectName( const std::string& prefix, size_t mesh, size_t prim ) {
+		std::ostringstream oss; oss << prefix << ".obj.m" << mesh << ".p" << prim << ".instances"; return oss.str();
+	}
 	// LightName is keyed on the GLTF NODE index (not the light-DEFINITION
 	// index in `data->lights`), because KHR_lights_punctual is shared by
 	// reference: a single light definition can be instanced across many
@@ -1991,6 +2001,36 @@ bool GLTFSceneImporter::ImportScene( IJob& job, const GLTFImportOptions& opts )
 		return false;
 	}
 
+	// How many nodes of this scene place each mesh, to decide up front
+	// which primitives become instance arrays
+	std::vector<unsigned int> meshUses( data->meshes_count, 0 );
+	{
+		std::vector<const cgltf_node*> stack( scene->nodes, scene->nodes + scene->nodes_count );
+		while( !stack.empty() ) {
+			const cgltf_node* node = stack.back();
+			stack.pop_back();
+			if( node->mesh ) {
+				meshUses[ (size_t)( node->mesh - data->meshes ) ]++;
+			}
+			stack.insert( stack.end(), node->children, node->children + node->children_count );
+		}
+	}
+
+	// A primitive placed at least opts.instanceArrayThreshold times: the
+	// walk only collects its node matrices, and it is placed after the
+	// walk as one instance array
+	struct InstancedPrim
+	{
+		size_t              meshIdx;
+		size_t              primIdx;
+		std::string         geom;
+		std::string         matName;
+		std::string         modName;
+		std::string         shaderName;
+		std::string         medName;
+		std::vector<double> matrices;		// column-major 4x4 per node
+	};
+
 	// Recursive node walk (column-major matrix accumulation).
 	std::string firstCameraName;	// captured during the walk (first camera-bearing node in DFS order); used post-walk to designate the active camera
 
@@ -2004,6 +2044,8 @@ bool GLTFSceneImporter::ImportScene( IJob& job, const GLTFImportOptions& opts )
 		std::string&             firstCameraName;	// in/out: first successful camera registration captures its name here so ImportScene can SetActiveCamera to it post-walk (so authoring intent — first camera = primary — beats RISE's last-added-wins auto-promote)
 		GLTFSceneImporter&       importer;	// for ImportPrimitive — bypasses the public IJob entry point so the cgltf parse is not redone per primitive
 		std::set<std::string>&   registeredGeoms;	// memoizes which (meshIdx,primIdx) geometries we've already built so multi-node instancing of a shared mesh registers ONCE and AddObjectMatrix runs N times
+		const std::vector<unsigned int>&              meshUses;			// nodes placing each mesh in this scene
+		std::map<std::string, InstancedPrim>&         instancedPrims;	// out: primitives to place as instance arrays, keyed by geometry name
 		bool&                    anyRegistrationFailure;	// out: set TRUE on a genuine entity-NAME COLLISION (geometry or object registration) so ImportScene fails the whole import loudly instead of silently masking it (see ImportScene's material-loop doc for the belt-and-suspenders rationale). NOT set for a merely malformed/unsupported primitive (BuildGeometryFromPrimitive's existing tolerant warn-and-skip behaviour is unchanged).
 
 		void Walk( const cgltf_node* node, const cgltf_float parentWorld[16] )
@@ -2115,6 +2157,26 @@ bool GLTFSceneImporter::ImportScene( IJob& job, const GLTFImportOptions& opts )
 						}
 					}
 
+					if( opts.instanceArrayThreshold && meshUses[meshIdx] >= opts.instanceArrayThreshold ) {
+						InstancedPrim& ip = instancedPrims[ geom ];
+						if( ip.matrices.empty() ) {
+							ip.meshIdx = meshIdx;
+							ip.primIdx = pi;
+							ip.geom = geom;
+							ip.matName = matName;
+							ip.modName = modName;
+							ip.shaderName = shaderName;
+							if( opts.importMaterials && prim.material &&
+							    prim.material->has_volume &&
+							    prim.material->volume.attenuation_distance > 0 &&
+							    prim.material->volume.thickness_factor > 0 ) {
+								ip.medName = MediumName( prefix, (size_t)( prim.material - data->materials ) );
+							}
+						}
+						ip.matrices.insert( ip.matrices.end(), matD, matD + 16 );
+						continue;
+					}
+
 					RadianceMapConfig rmc;
 					const std::string objName = ObjectName( prefix, nodeIdx, pi );
 					if( !job.AddObjectMatrix(
@@ -2339,11 +2401,49 @@ bool GLTFSceneImporter::ImportScene( IJob& job, const GLTFImportOptions& opts )
 
 	cgltf_float identity[16]; Mat4Identity( identity );
 	std::set<std::string> registeredGeoms;	// see Walker struct + the dedup site for rationale
-	Walker w = { job, prefix, data, szFilename, opts, firstCameraName, *this, registeredGeoms, anyRegistrationFailure };
+	std::map<std::string, InstancedPrim> instancedPrims;
+	Walker w = { job, prefix, data, szFilename, opts, firstCameraName, *this, registeredGeoms, meshUses, instancedPrims, anyRegistrationFailure };
 	for( size_t r = 0; r < scene->nodes_count; ++r ) {
 		w.Walk( scene->nodes[r], identity );
 	}
 
+	// Place the heavily-instanced primitives: one instance array over
+	// the shared geometry, placed by one identity-transform object
+	for( std::map<std::string, InstancedPrim>::const_iterator it = instancedPrims.begin(); it != instancedPrims.end(); ++it ) {
+		const InstancedPrim& ip = it->second;
+		const unsigned int count = (unsigned int)( ip.matrices.size() / 16 );
+		const std::string arrGeom = InstancesGeomName( prefix, ip.meshIdx, ip.primIdx );
+		const std::string objName = InstancesObjectName( prefix, ip.meshIdx, ip.primIdx );
+
+		if( !job.AddInstanceArrayGeometry( arrGeom.c_str(), ip.geom.c_str(), count, &ip.matrices[0] ) ) {
+			anyRegistrationFailure = true;
+			continue;
+		}
+
+		double identityD[16];
+		for( int i = 0; i < 16; ++i ) identityD[i] = (double)identity[i];
+
+		RadianceMapConfig rmc;
+		if( !job.AddObjectMatrix(
+			objName.c_str(), arrGeom.c_str(),
+			ip.matName == "none" ? NULL : ip.matName.c_str(),
+			ip.modName == "none" ? NULL : ip.modName.c_str(),
+			ip.shaderName == "none" ? NULL : ip.shaderName.c_str(),
+			rmc, identityD,
+			/*casts*/ true, /*receives*/ true ) ) {
+			anyRegistrationFailure = true;
+			continue;
+		}
+
+		if( !ip.medName.empty() ) {
+			job.SetObjectInteriorMedium( objName.c_str(), ip.medName.c_str() );
+		}
+
+		GlobalLog()->PrintEx( eLog_Event,
+			"GLTFSceneImporter:: `%s` placed %u times, imported as instance array `%s`",
+			ip.geom.c_str(), count, objName.c_str() );
+	}
+
 	// Active-camera policy:
 	//   - If a camera was active BEFORE the walk (user authored a
 	//     `pinhole_camera` chunk above this `gltf_import`), restore it.
@@ -15,6 +15,7 @@
 #define IBILINEAR_PATCH_GEOMETRY_
 
 #include "IGeometry.h"
+#include "ISerializable.h"
 #include "../Polygon.h"
 
 namespace RISE
@@ -22,7 +23,8 @@ namespace RISE
 	//! A geometry class made up of bilinear patches
 	/// \sa IGeometry
 	class IBilinearPatchGeometry : 
-		public virtual IGeometry
+		public virtual IGeometry,
+		public virtual ISerializable
 	{
 	protected:
 		IBilinearPatchGeometry(){};
@@ -41,6 +43,9 @@ namespace RISE
 		//! Instructs that addition of new patches is complete and that
 		//! we can prepare for rendering
 		virtual void Prepare() = 0;
+
+		//! \return The number of patches
+		virtual unsigned int numPatches() const = 0;
 	};
 }
 
@@ -0,0 +1,56 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  IBrickedVolume.h - Interface to a volume stored as fixed-size
+//  bricks, which exposes its per-brick value bounds so majorant
+//  grids and empty-space skipping don't have to scan every voxel
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//  Comments:
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#ifndef IBRICKED_VOLUME_
+#define IBRICKED_VOLUME_
+
+#include "IVolume.h"
+
+namespace RISE
+{
+	class IBrickedVolume :
+		public virtual IVolume
+	{
+	protected:
+		virtual ~IBrickedVolume( ){};
+
+	public:
+		IBrickedVolume( ){};
+
+		//! Edge length of a brick in voxels
+		virtual unsigned int BrickEdge( ) const = 0;
+
+		//! Number of bricks along each axis.  Brick (bx,by,bz) covers the
+		//! voxels whose 0-based (uncentered) indices lie in
+		//! [bx*BrickEdge(), (bx+1)*BrickEdge()) and likewise for y and z.
+		virtual unsigned int BricksX( ) const = 0;
+		virtual unsigned int BricksY( ) const = 0;
+		virtual unsigned int BricksZ( ) const = 0;
+
+		//! Largest GetValue() of any voxel in the brick, 0 for an empty brick
+		virtual Scalar BrickMaxValue( const unsigned int bx, const unsigned int by, const unsigned int bz ) const = 0;
+
+		//! Smallest GetValue() of any voxel in the brick
+		virtual Scalar BrickMinValue( const unsigned int bx, const unsigned int by, const unsigned int bz ) const = 0;
+
+		//! Fetches the 8 voxels of the cell whose low corner is (x,y,z),
+		//! in centered coordinates like GetValue, in the order
+		//! (x,y,z) (x+1,y,z) (x,y+1,z) (x+1,y+1,z) then the same at z+1.
+		//! Equal to 8 GetValue calls, but resolves the brick once.
+		virtual void GetCellValues( const int x, const int y, const int z, Scalar values[8] ) const = 0;
+	};
+}
+
+#endif
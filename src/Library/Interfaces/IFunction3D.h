@@ -37,6 +37,39 @@ namespace RISE
 			const Scalar y,						///< [in] Y value to evaluate the function at
 			const Scalar z						///< [in] Z value to evaluate the function at
 			) const = 0;
+
+		//! Evaluates the function at a batch of points given as separate
+		//! coordinate arrays.  The default loops over Evaluate; generators
+		//! with a batched kernel override it and must return exactly what
+		//! Evaluate would for every point.
+		virtual void EvaluateBatch(
+			const Scalar* x,					///< [in] X values, one per point
+			const Scalar* y,					///< [in] Y values, one per point
+			const Scalar* z,					///< [in] Z values, one per point
+			Scalar* out,						///< [out] Results, one per point
+			const unsigned int count			///< [in] Number of points
+			) const
+		{
+			for( unsigned int i=0; i<count; i++ ) {
+				out[i] = Evaluate( x[i], y[i], z[i] );
+			}
+		}
+
+		//! Single precision variant of EvaluateBatch for bakes that only
+		//! need float results.  Overrides may compute in float, so results
+		//! agree with Evaluate to float precision rather than exactly.
+		virtual void EvaluateBatchFloat(
+			const float* x,						///< [in] X values, one per point
+			const float* y,						///< [in] Y values, one per point
+			const float* z,						///< [in] Z values, one per point
+			float* out,							///< [out] Results, one per point
+			const unsigned int count			///< [in] Number of points
+			) const
+		{
+			for( unsigned int i=0; i<count; i++ ) {
+				out[i] = float( Evaluate( x[i], y[i], z[i] ) );
+			}
+		}
 	};
 }
 
@@ -42,6 +42,25 @@ namespace RISE
 		}
 	};
 
+	//! A conservative, closed-form stand-in for an analytic geometry,
+	//! in the geometry's own (object) space.  Every hit the geometry
+	//! reports lies inside `bounds` and, when bQuadric is set, inside
+	//! the axis-aligned quadric  q.x*x^2 + q.y*y^2 + q.z*z^2 <= radius2.
+	//! The object manager's TLAS leaves test a ray against four of
+	//! these at once in float and skip the objects the ray cannot hit.
+	struct AnalyticShape
+	{
+		BoundingBox bounds;		///< Box around the surface
+		Vector3     q;			///< Per-axis quadric weights (>= 0)
+		Scalar      radius2;	///< Quadric threshold
+		bool        bQuadric;	///< Is the quadric bound meaningful?
+
+		AnalyticShape() :
+		q( Vector3(0,0,0) ), radius2( 0 ), bQuadric( false )
+		{
+		}
+	};
+
 	//! Geometry represents the basic geometry of a scene object
 	//! It needs only to provide basic geometric intersection details
 	class IGeometry :
@@ -235,6 +254,14 @@ namespace RISE
 		//! vtable slot ABI-stable (the mid-vtable insert this replaces would have
 		//! shifted IntersectRay and every later slot for stale implementers).
 		virtual bool CanTessellate() const { return true; }
+
+		//! Describes this geometry by the conservative AnalyticShape above so
+		//! the TLAS can cull it in batches before calling IntersectRay.
+		//! Default false: the geometry is always intersected for real.  Only
+		//! the closed-form primitives (sphere, ellipsoid, cylinder, box,
+		//! torus) override.  Declared last + defaulted to keep every existing
+		//! vtable slot ABI-stable.
+		virtual bool GetAnalyticShape( AnalyticShape& /*shape*/ ) const { return false; }
 	};
 }
 
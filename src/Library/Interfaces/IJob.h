@@ -1360,7 +1360,8 @@ namespace RISE
 							const double emissive_intensity_scale = 1.0,	///< [in] Multiplier applied AFTER each material's authored `KHR_materials_emissive_strength` (or default 1.0).  Default 1.0 (no change).  Use to brighten ALL emissive surfaces in the import uniformly without editing the asset (e.g. a deep-dusk candle scene whose flame meshes are authored at daytime-balanced strength can multiply by 50–200 to make the candles dominate).  Unlike `lights_intensity_override` this is a SCALE (composes with authored values) — emissive materials typically ship with meaningful chromatic / relative values whose ratios should be preserved.  Values ≤ 0 kill all emissive in the import.  Folded in once at import time, no per-sample cost.
 							const double emissive_tint_r = 1.0,		///< [in] Per-channel R multiplier applied to every material's `emissiveFactor`.  Default 1.0 (no tint).  Use to recolour emissive surfaces uniformly across the import without editing the asset.  The tint multiplies the FACTOR componentwise, so an authored 0.0 channel can't be lifted (multiplying by a non-zero tint stays 0.0).  Folded in once at import time.
 							const double emissive_tint_g = 1.0,		///< [in] Per-channel G multiplier (see `emissive_tint_r`).  Example: (1.0, 0.5, 0.1) tints a pure-yellow flame (1,1,0) to warm orange (1, 0.5, 0).
-							const double emissive_tint_b = 1.0		///< [in] Per-channel B multiplier (see `emissive_tint_r`).
+							const double emissive_tint_b = 1.0,		///< [in] Per-channel B multiplier (see `emissive_tint_r`).
+							const unsigned int instance_array_threshold = 256	///< [in] A primitive placed by at least this many nodes becomes ONE instance array (shared geometry, a packed transform per node, its own BVH) placed by ONE object, instead of one object per node.  The per-node objects then do not exist by name.  0 disables.
 							) = 0;
 
 		//! Creates a triangle mesh geometry from a glTF 2.0 file (.gltf or .glb).
@@ -1394,24 +1395,24 @@ namespace RISE
 		//! Displacement is NOT a parameter either — wrap this geometry in a
 		//! `displaced_geometry` chunk for displacement, and for bulk-tessellated
 		//! rendering use `displaced_geometry { displacement none disp_scale 0 }`.
+		//! The patches are accelerated by a BVH; the legacy `max_patches`,
+		//! `max_recur`, `use_bsp` parameters are gone.  A file written by
+		//! IBezierPatchGeometry::Serialize is recognised by its signature
+		//! and loaded with its saved BVH instead of being parsed as text.
 		/// \return TRUE if successful, FALSE otherwise
 		virtual bool AddBezierPatchGeometry(
 							const char* name,						///< [in] Name of the geometry
-							const char* szFileName,					///< [in] Name of the file to load from
-							const unsigned int max_patches,			///< [in] Maximum number of patches per accelerator leaf
-							const unsigned char max_recur,			///< [in] Maximum accelerator recursion depth
-							const bool use_bsp,						///< [in] Use BSP tree (true) or Octree (false) for the patch accelerator
+							const char* szFileName,					///< [in] Name of the file to load from (text or binary patch file)
 							const bool bCenterObject				///< [in] Recenter all patch control points around the object-space origin
 							) = 0;
 
-		//! Creates a bilinear patch geometry
+		//! Creates a bilinear patch geometry, accelerated by a BVH.  Like
+		//! AddBezierPatchGeometry, a binary file written by Serialize is
+		//! loaded along with its saved BVH.
 		/// \return TRUE if successful, FALSE otherwise
 		virtual bool AddBilinearPatchGeometry(
 							const char* name,						///< [in] Name of the geometry
-							const char* szFileName,					///< [in] Name of the file to load from
-							const unsigned int max_polys,			///< [in] Maximum number of polygons in one octant node
-							const unsigned char max_recur,			///< [in] Maximum depth of the octree or bsp tree
-							const bool use_bsp						///< [in] Use a BSP tree rather than an Octree
+							const char* szFileName					///< [in] Name of the file to load from (text or binary patch file)
 							) = 0;
 
 		//! Creates a displaced geometry wrapping a previously-registered base geometry,
@@ -1429,7 +1430,10 @@ namespace RISE
 							const Scalar        disp_scale,			///< [in] Displacement scale factor
 							const bool          double_sided,		///< [in] Are the displaced triangles double sided?
 							const bool          face_normals,
-			const bool          seam_fold = true		///< [in] Use face normals instead of topologically re-averaged vertex normals
+			const bool          seam_fold = true,		///< [in] Use face normals instead of topologically re-averaged vertex normals
+							const bool          lazy = false,					///< [in] Displace coarse patches on demand into a bounded cache
+							const unsigned int  patch_subdivision = 8,			///< [in] Lazy mode: micro-mesh subdivisions per coarse patch edge
+							const unsigned int  lazy_cache_triangles = 1u<<20	///< [in] Lazy mode: resident micro-mesh triangle budget
 							) = 0;
 
 
@@ -1527,7 +1531,8 @@ namespace RISE
 			const unsigned int volEndZ,								///< [in] Ending z slice index
 			const char accessor,									///< [in] Volume accessor type: 'n', 't', or 'c'
 			const double bboxMin[3],								///< [in] World-space AABB minimum corner
-			const double bboxMax[3]									///< [in] World-space AABB maximum corner
+			const double bboxMax[3],								///< [in] World-space AABB maximum corner
+			const bool sparse = false								///< [in] Store the volume as sparse 8^3 bricks
 			) = 0;
 
 		//! Adds a heterogeneous participating medium driven by a painter
@@ -3753,6 +3758,21 @@ namespace RISE
 				orientation, targetOrientation );
 		}
 
+		//! Creates an instance array: numInstances placed copies of a
+		//! previously-registered child geometry, each stored as a packed
+		//! 3x4 transform under a BVH of its own.  Place the array with an
+		//! ordinary object; every instance takes that object's material,
+		//! shader and modifier.  The child must not itself be an
+		//! instance array.  Default returns false; only Job overrides.
+		//! NB: appended at the IJob tail (append-only ABI convention).
+		/// \return TRUE if successful, FALSE otherwise
+		virtual bool AddInstanceArrayGeometry(
+			const char*         /*name*/,					///< [in] Name of the geometry to register
+			const char*         /*child_geometry_name*/,	///< [in] Name of a previously-registered IGeometry to place
+			const unsigned int  /*numInstances*/,			///< [in] Number of instances
+			const double*       /*matrices*/				///< [in] numInstances column-major 4x4 instance transforms
+			) { return false; }
+
 	};
 
 
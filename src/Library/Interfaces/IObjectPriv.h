@@ -16,6 +16,7 @@
 #define IOBJECTPRIV_
 
 #include "IObject.h"
+#include "IGeometry.h"
 #include "IUVGenerator.h"
 #include "ITransformable.h"
 #include "IMaterial.h"
@@ -130,6 +131,19 @@ namespace RISE
 		virtual void ClearModifier() = 0;
 		virtual void ClearShader() = 0;
 		virtual void ClearRadianceMap() = 0;
+
+		//! The geometry's AnalyticShape plus the matrix taking world space
+		//! into the shape's space, for the TLAS's batched leaf cull.  False
+		//! when the object is not a single static analytic geometry, in
+		//! which case the TLAS always intersects it for real.  Defaulted and
+		//! added at the END for the same vtable reason as the Clear* above.
+		virtual bool GetAnalyticShape(
+			AnalyticShape& /*shape*/,									///< [out] Conservative shape in object space
+			Matrix4& /*mxWorldToObject*/								///< [out] World to object space
+			) const
+		{
+			return false;
+		}
 	};
 }
 
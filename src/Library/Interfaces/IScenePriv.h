@@ -195,6 +195,8 @@ namespace RISE
 
 		//! Builds any queued photon maps.  Safe to call when nothing is queued
 		//! (returns true, no-op).  Single-threaded; called once per RasterizeScene.
+		//! Returns false if `pProgress` cancelled a shoot; that shoot installs no
+		//! map and stays queued for the next call.
 		virtual bool BuildPendingPhotonMaps( IProgressCallback* pProgress ) = 0;
 
 		// ----- Methods appended below this line (vtable-stable) -----
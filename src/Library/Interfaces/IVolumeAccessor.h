@@ -30,6 +30,18 @@ namespace RISE
 		virtual Scalar GetValue( Scalar x, Scalar y, Scalar z ) const = 0;
 		virtual Scalar GetValue( int x, int y, int z ) const = 0;
 		virtual void BindVolume( const IVolume* pVol ) = 0;
+
+		//! Fetches `count` consecutive voxels along +x starting at (x,y,z),
+		//! i.e. values[i] = GetValue( x+i, y, z ).  Accessors with a batched
+		//! evaluation path (painter-driven volumes) override this; the
+		//! default just loops.  Last in the vtable so existing slots keep
+		//! their offsets.
+		virtual void GetValueRow( int x, int y, int z, unsigned int count, Scalar* values ) const
+		{
+			for( unsigned int i = 0; i < count; i++ ) {
+				values[i] = GetValue( x + int(i), y, z );
+			}
+		}
 	};
 }
 
@@ -24,10 +24,10 @@
 //       intervals; subdivision isolates roots.
 //
 //    5. For each candidate u, the bicubic F1(u, .) reduces to a cubic in v.
-//       We upgrade this to a (degenerate) quartic and hand it to the new
-//       OQS quartic solver — which auto-dispatches to the OQS-stabilised
-//       cubic path when the leading coefficient vanishes.  This keeps the
-//       same numerics and Newton-Raphson polishing that the torus uses.
+//       Its roots near [0,1] are found by Polynomial::SolveCubicWithin-
+//       Interval, which brackets each root between the cubic's critical
+//       points with no allocation and no division by the leading
+//       coefficient.
 //
 //    6. For each v candidate, we run a 2D Newton-Raphson polish on the
 //       full system (F1,F2) = 0 starting from (u, v_seed) and then gate
@@ -75,7 +75,7 @@
 //    [Orellana 2020] A.G. Orellana, C. De Michele, "Algorithm 1010:
 //                   Boosting efficiency in solving quartic equations with
 //                   no compromise in accuracy", ACM TOMS 46(2), 2020.
-//                   The RISE quartic solver (used in step 5) — high-precision
+//                   The RISE quartic solver (step 5 falls back to it) — high-precision
 //                   even for near-tangent coefficients.
 //
 //  License Information: Please see the attached LICENSE.TXT file
@@ -505,13 +505,12 @@ void Intersect_Resultant(
 		// F1(u,v) as a cubic in v.
 		const SmallPolynomial fV = F1( u );
 
-		// Pack as a monic-ready quartic (RISE coefficient convention:
-		// coeff[0] leading, coeff[4] constant).  With coeff[0]=0 the OQS
-		// SolveQuartic dispatches to the OQS-stabilised cubic path,
-		// which shares the numerics (Vieta-stable quadratic, Newton polish)
-		// that made the torus rewrite worthwhile.
-		const Scalar quartCoeff[5] = {
-			0.0,
+		// Only the v roots near [0,1] are used as seeds, so solve for
+		// just those by bracketing (RISE coefficient convention: coeff[0]
+		// leading, coeff[3] constant).  This never divides by the cubic
+		// coefficient, so a patch that is nearly quadratic in v for this
+		// u needs no special case.
+		const Scalar cubicCoeff[4] = {
 			fV.coef[3],
 			fV.coef[2],
 			fV.coef[1],
@@ -519,16 +518,18 @@ void Intersect_Resultant(
 		};
 
 		Scalar vRoots[4];
-		int nv = Polynomial::SolveQuartic( quartCoeff, vRoots );
-
-		// Fallback: if the cubic coefficient also vanished (patch degenerate
-		// in v for this u) and SolveQuartic returned no roots, try the
-		// quadratic directly.  Rare, but keeps us correct.
-		if( nv == 0 && fabs( fV.coef[3] ) < 1e-14 ) {
-			const Scalar quadCoeff[3] = { fV.coef[2], fV.coef[1], fV.coef[0] };
-			Scalar vq[2];
-			nv = Polynomial::SolveQuadric( quadCoeff, vq );
-			for( int k = 0; k < nv; k++ ) vRoots[k] = vq[k];
+		int nv;
+		{
+			Scalar vc[3];
+			nv = Polynomial::SolveCubicWithinInterval( cubicCoeff, vc, -1e-3, 1.0 + 1e-3 );
+			for( int k = 0; k < nv; k++ ) vRoots[k] = vc[k];
+		}
+
+		// Non-finite coefficients: hand the cubic to OQS as a quartic
+		// with a zero leading term, as this path did before
+		if( nv < 0 ) {
+			const Scalar quartCoeff[5] = { 0.0, cubicCoeff[0], cubicCoeff[1], cubicCoeff[2], cubicCoeff[3] };
+			nv = Polynomial::SolveQuartic( quartCoeff, vRoots );
 		}
 
 		// Natural v seeds are the v roots of F1(u,.) in [0,1].  A fallback
@@ -20,6 +20,76 @@
 namespace RISE
 {
 
+	namespace
+	{
+		// Quartic in t for the torus along o + t*d, leading coefficient
+		// first.  quartScale is the size of the two terms that cancel in
+		// the constant term when o sits on the surface.
+		inline void TorusQuartic( const Point3& o, const Vector3& d, const Scalar a0, const Scalar b0, Scalar (&C)[5], Scalar& quartScale )
+		{
+			// Compute some terms for building the co-efficients
+			const Scalar sqr_rayDirY = d.y*d.y;
+
+			const Scalar f = 1.0 - sqr_rayDirY;
+			const Scalar l = 2.0 * (o.x*d.x + o.z*d.z);
+			const Scalar t = o.x*o.x + o.z*o.z;
+			const Scalar g = f + sqr_rayDirY;
+			const Scalar q = a0 / (g*g);
+			const Scalar m = (l + 2.0*d.y*o.y) / g;
+			const Scalar u = (t +  o.y*o.y + b0) / g;
+
+			C[0] = 1.0;
+			C[1] = 2.0 * m;
+			C[2] = m*m + 2.0*u - q*f;
+			C[3] = 2.0*m*u - q*l;
+			C[4] = u*u - q*t;
+
+			quartScale = fabs(u*u) + fabs(q*t);
+		}
+
+		// Horner value of the quartic at x, and the same sum taken over
+		// the magnitudes of its terms, which bounds the rounding in it
+		inline Scalar QuarticAt( const Scalar (&C)[5], const Scalar x, Scalar& scale )
+		{
+			const Scalar ax = fabs(x);
+			Scalar p = C[0];
+			scale = fabs(C[0]);
+			for( int i = 1; i < 5; i++ ) {
+				p = p*x + C[i];
+				scale = scale*ax + fabs(C[i]);
+			}
+			return p;
+		}
+
+		// Whether the closed form's roots of the shifted quartic can be
+		// trusted.  Every real root of the torus lies in [sMin,sMax], so a
+		// root outside it, a root the quartic is not small at, or a count
+		// whose parity disagrees with the signs at the two ends all mean
+		// the closed form lost its conditioning (near double roots,
+		// mostly grazing rays).
+		inline bool ClosedFormRootsHold( const Scalar (&C)[5], const Scalar (&s)[4], const int n, const Scalar sMin, const Scalar sMax )
+		{
+			for( int i = 0; i < n; i++ ) {
+				if( !(s[i] >= sMin && s[i] <= sMax) ) {
+					return false;
+				}
+				Scalar scale;
+				if( fabs( QuarticAt( C, s[i], scale ) ) > 1e-9 * scale ) {
+					return false;
+				}
+			}
+
+			Scalar scaleMin, scaleMax;
+			const Scalar pMin = QuarticAt( C, sMin, scaleMin );
+			const Scalar pMax = QuarticAt( C, sMax, scaleMax );
+			if( fabs(pMin) <= 1e-12 * scaleMin || fabs(pMax) <= 1e-12 * scaleMax ) {
+				// A root sits on the end of the window; the signs say nothing
+				return true;
+			}
+			return ( (pMin < 0) != (pMax < 0) ) == ( (n & 1) == 1 );
+		}
+	}
+
 	void RayTorusIntersection( const Ray& ray, HIT& hit, const Scalar majorRadius, const Scalar minorRadius, const Scalar sqrP0 )
 	{
 		hit.bHit = false;
@@ -29,28 +99,30 @@ namespace RISE
 		const Vector3& rayDirNorm = ray.Dir();
 
 		// Compute torus constants
-		Scalar a0  = 4.0 * sqrP0;
-		Scalar b0  = sqrP0 - minorRadius*minorRadius;
-
-		// Compute some terms for building the co-efficients
-		Scalar	sqr_rayDirY = rayDirNorm.y*rayDirNorm.y;
-
-		Scalar f = 1.0 - sqr_rayDirY;
-		Scalar l = 2.0 * (ray.origin.x*rayDirNorm.x + ray.origin.z*rayDirNorm.z);
-		Scalar t = ray.origin.x*ray.origin.x + ray.origin.z*ray.origin.z;
-		Scalar g = f + sqr_rayDirY;
-		Scalar q = a0 / (g*g);
-		Scalar m = (l + 2.0*rayDirNorm.y*ray.origin.y) / g;
-		Scalar u = (t +  ray.origin.y*ray.origin.y + b0) / g;
+		const Scalar a0  = 4.0 * sqrP0;
+		const Scalar b0  = sqrP0 - minorRadius*minorRadius;
+
+		// Every root lies inside the bounding sphere of radius R+r, so a
+		// line that passes it by is a miss without forming the quartic,
+		// and the span the line spends inside it is where the roots are.
+		// The quartic is solved about the point of the line closest to
+		// the centre: its roots are then no larger than the torus,
+		// however far away the ray starts, where in t a ray from far off
+		// loses most of its digits to the cancellation between terms of
+		// size t^4.
+		const Scalar tShift = -(ray.origin.x*rayDirNorm.x + ray.origin.y*rayDirNorm.y + ray.origin.z*rayDirNorm.z);
+		const Point3 closest = ray.PointAtLength( tShift );
+		const Scalar outer = majorRadius + minorRadius;
+		const Scalar sqrOuter = outer*outer*(1.0 + 1e-9);
+		const Scalar sqrClosest = closest.x*closest.x + closest.y*closest.y + closest.z*closest.z;
+		if( sqrClosest > sqrOuter ) {
+			return;
+		}
 
 		// Form a quartic with the torus co-efficients
 		Scalar C[5];
-
-		C[0] = 1.0;
-		C[1] = 2.0 * m;
-		C[2] = m*m + 2.0*u - q*f;
-		C[3] = 2.0*m*u - q*l;
-		C[4] = u*u - q*t;
+		Scalar quartScale;
+		TorusQuartic( ray.origin, rayDirNorm, a0, b0, C, quartScale );
 
 		// Self-intersection deflation.
 		//
@@ -77,7 +149,6 @@ namespace RISE
 		// rays that pass close to the surface) on the quartic path.
 		Scalar s[4];
 		int n;
-		const Scalar quartScale = fabs(u*u) + fabs(q*t);
 		if( fabs(C[4]) <= quartScale * 1e-10 ) {
 			// Root at t = 0 is the self-intersection — drop it and solve
 			// the deflated cubic for the remaining real roots.
@@ -86,7 +157,42 @@ namespace RISE
 			n = Polynomial::SolveCubic( cubicC, cubicSol );
 			for( int i = 0; i < n; i++ ) s[i] = cubicSol[i];
 		} else {
-			n = Polynomial::SolveQuartic( C, s );
+			// Roots in the shifted variable lie within the half chord
+			// of the bounding sphere, trimmed to the slab |y| <= r the
+			// tube occupies, widened a little for the solver's rounding
+			const Scalar halfChord = sqrt( fmax( sqrOuter - sqrClosest, 0.0 ) );
+			const Scalar pad = 1e-9 * outer;
+			Scalar sMin = -halfChord - pad;
+			Scalar sMax = halfChord + pad;
+			if( fabs(rayDirNorm.y) > 1e-12 ) {
+				const Scalar slabA = (-minorRadius - pad - closest.y) / rayDirNorm.y;
+				const Scalar slabB = ( minorRadius + pad - closest.y) / rayDirNorm.y;
+				sMin = fmax( sMin, fmin( slabA, slabB ) );
+				sMax = fmin( sMax, fmax( slabA, slabB ) );
+			} else if( fabs(closest.y) > minorRadius + pad ) {
+				return;
+			}
+			if( sMin > sMax ) {
+				return;
+			}
+
+			// The closed form is the fast path.  Only when its roots fail
+			// the checks above does the ray pay for the interval solver,
+			// and only non-finite input (a degenerate ray or torus) makes
+			// that one give up, leaving the closed form's answer
+			Scalar CS[5];
+			Scalar shiftedScale;
+			TorusQuartic( closest, rayDirNorm, a0, b0, CS, shiftedScale );
+			n = Polynomial::SolveQuartic( CS, s );
+			if( !ClosedFormRootsHold( CS, s, n, sMin, sMax ) ) {
+				Scalar sInterval[4];
+				const int nInterval = Polynomial::SolveQuarticWithinInterval( CS, sInterval, sMin, sMax );
+				if( nInterval >= 0 ) {
+					n = nInterval;
+					for( int i = 0; i < n; i++ ) s[i] = sInterval[i];
+				}
+			}
+			for( int i = 0; i < n; i++ ) s[i] += tShift;
 		}
 
 		if( n > 0 )
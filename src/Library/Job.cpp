@@ -19,13 +19,13 @@
 #include "Managers/GenericManager.h" // D35 record-during-derive sinks (media bypass the GenericManager chokepoint, so hook mediaMap here)
 #include "Objects/CSGObject.h"     // workstream #3: CSG re-point (dynamic_cast<CSGObject*> + SetOperation/CsgOpFromChar)
 #include "Geometry/SDFGeometry.h"
+#include "Geometry/TriangleMeshCache.h"
 #include <cstring>
 #include <cstdint>
 #define _USE_MATH_DEFINES
 #include "Job.h"
 #include "Cst/Cst.h"   // P5 (save-as-CST): ParseToCst / DeriveToJob / Document
 #include <fstream>
-#include <sstream>
 #include <sys/stat.h>   // P5 Slice 4: capture the loaded file's mtime/size for the CST-save external-mod guard
 #include "RISE_API.h"
 #include "Rendering/Film.h"		// kDefaultFilm* / kMaxFilm* constants
@@ -43,6 +43,7 @@
 #include "Shaders/DistributionTracingShaderOp.h"
 #include "Shaders/FinalGatherShaderOp.h"
 #include "Rendering/FrameStore.h"
+#include "Rendering/FrameEncodeQueue.h"
 #include "Rendering/Rasterizer.h"
 #include "Rendering/RayCaster.h"		// concrete RayCaster — dynamic_cast target for SetTransparentShadows (PT only)
 #include "Rendering/PixelBasedRasterizerHelper.h"	// GetRayCaster() — reach the active rasterizer's caster for radiance_scale
@@ -4878,21 +4879,36 @@ bool Job::Add3DSTriangleMeshGeometry(
 	ITriangleMeshGeometryIndexed* pGeometry = 0;
 	RISE_API_CreateTriangleMeshGeometryIndexed( &pGeometry, double_sided, face_normals );
 
-	IReadBuffer* pBuffer = 0;
-	RISE_API_CreateDiskFileReadBuffer( &pBuffer, filename );
+	char params[64];
+	snprintf( params, sizeof( params ), "ds=%d fn=%d", double_sided, face_normals );
+	const TriangleMeshCache cache( "3ds", filename, params );
+
+	bool bRet = cache.Load( *pGeometry );
+	if( !bRet && cache.IsEnabled() ) {
+		// A rejected entry may have filled part of the geometry
+		safe_release( pGeometry );
+		RISE_API_CreateTriangleMeshGeometryIndexed( &pGeometry, double_sided, face_normals );
+	}
+	if( !bRet ) {
+		IReadBuffer* pBuffer = 0;
+		RISE_API_CreateDiskFileReadBuffer( &pBuffer, filename );
 
-	ITriangleMeshLoaderIndexed* pLoader = 0;
-	RISE_API_Create3DSTriangleMeshLoader( &pLoader, pBuffer );
+		ITriangleMeshLoaderIndexed* pLoader = 0;
+		RISE_API_Create3DSTriangleMeshLoader( &pLoader, pBuffer );
+		bRet = pLoader->LoadTriangleMesh( pGeometry );
+		safe_release( pLoader );
+		safe_release( pBuffer );
+
+		if( bRet ) {
+			cache.Store( *pGeometry );
+		}
+	}
 
-	bool bRet = pLoader->LoadTriangleMesh( pGeometry );
 	if( bRet ) {
 		bRet = RegisterOrDiag( pGeomManager, pGeometry, name, "geometry" );
 	}
 
 	safe_release( pGeometry );
-
-	safe_release( pLoader );
-	safe_release( pBuffer );
 	return bRet;
 }
 
@@ -4935,17 +4951,32 @@ bool Job::AddRAW2TriangleMeshGeometry(
 	ITriangleMeshGeometryIndexed* pGeometry = 0;
 	RISE_API_CreateTriangleMeshGeometryIndexed( &pGeometry, double_sided, face_normals );
 
-	ITriangleMeshLoaderIndexed* pLoader = 0;
-	RISE_API_CreateRAW2TriangleMeshLoader( &pLoader, szFileName );
+	char params[64];
+	snprintf( params, sizeof( params ), "ds=%d fn=%d", double_sided, face_normals );
+	const TriangleMeshCache cache( "raw2", szFileName, params );
+
+	bool bRet = cache.Load( *pGeometry );
+	if( !bRet && cache.IsEnabled() ) {
+		// A rejected entry may have filled part of the geometry
+		safe_release( pGeometry );
+		RISE_API_CreateTriangleMeshGeometryIndexed( &pGeometry, double_sided, face_normals );
+	}
+	if( !bRet ) {
+		ITriangleMeshLoaderIndexed* pLoader = 0;
+		RISE_API_CreateRAW2TriangleMeshLoader( &pLoader, szFileName );
+		bRet = pLoader->LoadTriangleMesh( pGeometry );
+		safe_release( pLoader );
+
+		if( bRet ) {
+			cache.Store( *pGeometry );
+		}
+	}
 
-	bool bRet = pLoader->LoadTriangleMesh( pGeometry );
 	if( bRet ) {
 		bRet = RegisterOrDiag( pGeomManager, pGeometry, name, "geometry" );
 	}
 
 	safe_release( pGeometry );
-
-	safe_release( pLoader );
 	return bRet;
 }
 
@@ -4963,17 +4994,32 @@ bool Job::AddPLYTriangleMeshGeometry(
 	ITriangleMeshGeometryIndexed* pGeometry = 0;
 	RISE_API_CreateTriangleMeshGeometryIndexed( &pGeometry, double_sided, face_normals );
 
-	ITriangleMeshLoaderIndexed* pLoader = 0;
-	RISE_API_CreatePLYTriangleMeshLoader( &pLoader, szFileName, bInvertFaces );
+	char params[64];
+	snprintf( params, sizeof( params ), "ds=%d inv=%d fn=%d", double_sided, bInvertFaces, face_normals );
+	const TriangleMeshCache cache( "ply", szFileName, params );
+
+	bool bRet = cache.Load( *pGeometry );
+	if( !bRet && cache.IsEnabled() ) {
+		// A rejected entry may have filled part of the geometry
+		safe_release( pGeometry );
+		RISE_API_CreateTriangleMeshGeometryIndexed( &pGeometry, double_sided, face_normals );
+	}
+	if( !bRet ) {
+		ITriangleMeshLoaderIndexed* pLoader = 0;
+		RISE_API_CreatePLYTriangleMeshLoader( &pLoader, szFileName, bInvertFaces );
+		bRet = pLoader->LoadTriangleMesh( pGeometry );
+		safe_release( pLoader );
+
+		if( bRet ) {
+			cache.Store( *pGeometry );
+		}
+	}
 
-	bool bRet = pLoader->LoadTriangleMesh( pGeometry );
 	if( bRet ) {
 		bRet = RegisterOrDiag( pGeomManager, pGeometry, name, "geometry" );
 	}
 
 	safe_release( pGeometry );
-
-	safe_release( pLoader );
 	return bRet;
 }
 
@@ -5000,7 +5046,8 @@ bool Job::ImportGLTFScene(
 					const double emissive_intensity_scale,
 					const double emissive_tint_r,
 					const double emissive_tint_g,
-					const double emissive_tint_b
+					const double emissive_tint_b,
+					const unsigned int instance_array_threshold
 					)
 {
 	// Prefix-collision guard (the "clean named diagnostic" layer -- see Job.h's
@@ -5048,6 +5095,7 @@ bool Job::ImportGLTFScene(
 	opts.emissiveTint[0]               = emissive_tint_r;
 	opts.emissiveTint[1]               = emissive_tint_g;
 	opts.emissiveTint[2]               = emissive_tint_b;
+	opts.instanceArrayThreshold        = instance_array_threshold;
 	return importer.ImportScene( *this, opts );
 }
 
@@ -5155,29 +5203,84 @@ bool Job::AddRISEMeshTriangleMeshGeometry(
 	return bRet;
 }
 
+//! True if the file starts with the given 8 byte binary signature
+//! (the one a patch geometry's Serialize writes), false if it is a
+//! text patch file or cannot be read
+static bool FileHasPatchSignature( const String& path, const char* szSignature )
+{
+	FILE* f = fopen( path.c_str(), "rb" );
+	if( !f ) {
+		return false;
+	}
+
+	char sig[8] = {0};
+	const bool bMatch = fread( sig, 1, 8, f ) == 8 && memcmp( sig, szSignature, 8 ) == 0;
+	fclose( f );
+	return bMatch;
+}
+
+//! Loads a patch geometry saved by its Serialize (patches plus the BVH).
+//! Returns false and logs if nothing usable was read.
+template< class T >
+static bool DeserializePatchGeometry( T* pGeometry, const String& path, const char* szCaller )
+{
+	IReadBuffer* pBuffer = 0;
+	RISE_API_CreateDiskFileReadBuffer( &pBuffer, path.c_str() );
+
+	bool bLoaded = false;
+	if( pBuffer && pBuffer->Size() > 0 ) {
+		pGeometry->Deserialize( *pBuffer );
+		bLoaded = pGeometry->numPatches() > 0;
+		if( !bLoaded ) {
+			GlobalLog()->PrintEx( eLog_Error, "%s:: Failed to deserialize valid geometry from `%s`", szCaller, path.c_str() );
+		}
+	} else {
+		GlobalLog()->PrintEx( eLog_Error, "%s:: Failed to open or read `%s`", szCaller, path.c_str() );
+	}
+
+	safe_release( pBuffer );
+	return bLoaded;
+}
+
 //! Creates a bezier patch geometry (analytic rendering always).
 /// \return TRUE if successful, FALSE otherwise
 bool Job::AddBezierPatchGeometry(
 					const char* name,						///< [in] Name of the geometry
 					const char* szFileName,					///< [in] Name of the file to load from
-					const unsigned int max_patches,			///< [in] Maximum number of patches per accelerator leaf
-					const unsigned char max_recur,			///< [in] Maximum accelerator recursion depth
-					const bool use_bsp,						///< [in] Use BSP tree (true) or Octree (false) for the patch accelerator
 					const bool bCenterObject				///< [in] Recenter all patch control points around the object-space origin
 					)
 {
-	FILE* inputFile = fopen( GlobalMediaPathLocator().Find(szFileName).c_str(), "r" );
+	const String path = GlobalMediaPathLocator().Find(szFileName);
+
+	IBezierPatchGeometry* pGeometry = 0;
+	RISE_API_CreateBezierPatchGeometry( &pGeometry );
+
+	// A binary patch file already holds its BVH; its control points are
+	// used exactly as they were saved, so centering does not apply
+	if( FileHasPatchSignature( path, "RISEBZPG" ) ) {
+		if( bCenterObject ) {
+			GlobalLog()->PrintEx( eLog_Warning, "Job::AddBezierPatchGeometry:: `%s` is a binary patch file, center_object is ignored", szFileName );
+		}
+		if( !DeserializePatchGeometry( pGeometry, path, "Job::AddBezierPatchGeometry" ) ) {
+			safe_release( pGeometry );
+			return false;
+		}
+
+		const bool ok = RegisterOrDiag( pGeomManager, pGeometry, name, "geometry" );
+		safe_release( pGeometry );
+		return ok;
+	}
+
+	FILE* inputFile = fopen( path.c_str(), "r" );
 
 	if( !inputFile ) {
 		GlobalLog()->Print( eLog_Error, "Job::AddBezierPatchGeometry:: Failed to open file" );
+		safe_release( pGeometry );
 		return false;
 	}
 
-	IBezierPatchGeometry* pGeometry = 0;
-	RISE_API_CreateBezierPatchGeometry( &pGeometry, max_patches, max_recur, use_bsp );
-
 	// Load all patches first so we can optionally recenter them before
-	// handing them to the geometry's BSP/Octree build in Prepare().
+	// handing them to the geometry's BVH build in Prepare().
 	BezierPatchesListType loadedPatches;
 
 	char line[4096] = {0};
@@ -5261,22 +5364,33 @@ bool Job::AddBezierPatchGeometry(
 /// \return TRUE if successful, FALSE otherwise
 bool Job::AddBilinearPatchGeometry(
 					const char* name,						///< [in] Name of the geometry
-					const char* szFileName,					///< [in] Name of the file to load from
-					const unsigned int max_polys,			///< [in] Maximum number of polygons in one octant node
-					const unsigned char max_recur,			///< [in] Maximum depth of the octree or bsp tree
-					const bool use_bsp						///< [in] Use a BSP tree rather than an Octree
+					const char* szFileName					///< [in] Name of the file to load from
 					)
 {
-	FILE* inputFile = fopen( GlobalMediaPathLocator().Find(szFileName).c_str(), "r" );
+	const String path = GlobalMediaPathLocator().Find(szFileName);
+
+	IBilinearPatchGeometry* pGeometry = 0;
+	RISE_API_CreateBilinearPatchGeometry( &pGeometry );
+
+	if( FileHasPatchSignature( path, "RISEBLPG" ) ) {
+		if( !DeserializePatchGeometry( pGeometry, path, "Job::AddBilinearPatchGeometry" ) ) {
+			safe_release( pGeometry );
+			return false;
+		}
+
+		const bool ok = RegisterOrDiag( pGeomManager, pGeometry, name, "geometry" );
+		safe_release( pGeometry );
+		return ok;
+	}
+
+	FILE* inputFile = fopen( path.c_str(), "r" );
 
 	if( !inputFile ) {
 		GlobalLog()->Print( eLog_Error, "Job::AddBilinearPatchGeometry:: Failed to open file" );
+		safe_release( pGeometry );
 		return false;
 	}
 
-	IBilinearPatchGeometry* pGeometry = 0;
-	RISE_API_CreateBilinearPatchGeometry( &pGeometry, max_polys, max_recur, use_bsp );
-
 	char line[1024] = {0};
 
 	if( fgets( (char*)&line, 1024, inputFile ) != NULL ) {
@@ -5294,6 +5408,8 @@ bool Job::AddBilinearPatchGeometry(
 				// Each line is a control point
 				if( fgets( (char*)&line, 1024, inputFile ) == NULL ) {
 					GlobalLog()->PrintSourceError( "Job::AddBilinearPatchGeometry:: Fatal error while reading file.  Nothing will be loaded", __FILE__, __LINE__ );
+					fclose( inputFile );
+					safe_release( pGeometry );
 					return false;
 				}
 
@@ -5308,6 +5424,8 @@ bool Job::AddBilinearPatchGeometry(
 		pGeometry->Prepare();
 	}
 
+	fclose( inputFile );
+
 	const bool ok = RegisterOrDiag( pGeomManager, pGeometry, name, "geometry" );
 	safe_release( pGeometry );
 	return ok;
@@ -5321,7 +5439,10 @@ bool Job::AddDisplacedGeometry(
 	const Scalar        disp_scale,
 	const bool          double_sided,
 	const bool          face_normals,
-	const bool          seam_fold
+	const bool          seam_fold,
+	const bool          lazy,
+	const unsigned int  patch_subdivision,
+	const unsigned int  lazy_cache_triangles
 	)
 {
 	if( !name || !base_geometry_name ) {
@@ -5347,7 +5468,8 @@ bool Job::AddDisplacedGeometry(
 	IGeometry* pGeometry = 0;
 	const bool bOK = RISE_API_CreateDisplacedGeometry(
 		&pGeometry, pBase, detail, pFunc, disp_scale,
-		double_sided, face_normals, seam_fold );
+		double_sided, face_normals, seam_fold,
+		lazy, patch_subdivision, lazy_cache_triangles );
 
 	if( !bOK || !pGeometry ) {
 		GlobalLog()->PrintEx( eLog_Error, "Job::AddDisplacedGeometry:: failed to create displaced geometry `%s` (base `%s` may not support tessellation)", name, base_geometry_name );
@@ -5359,6 +5481,35 @@ bool Job::AddDisplacedGeometry(
 	return ok;
 }
 
+bool Job::AddInstanceArrayGeometry(
+	const char*         name,
+	const char*         child_geometry_name,
+	const unsigned int  numInstances,
+	const double*       matrices
+	)
+{
+	if( !name || !child_geometry_name ) {
+		GlobalLog()->Print( eLog_Error, "Job::AddInstanceArrayGeometry:: name and child geometry are required" );
+		return false;
+	}
+
+	const IGeometry* pChild = pGeomManager->GetItem( child_geometry_name );
+	if( !pChild ) {
+		GlobalLog()->PrintEx( eLog_Error, "Job::AddInstanceArrayGeometry:: child geometry `%s` not found", child_geometry_name );
+		return false;
+	}
+
+	IGeometry* pGeometry = 0;
+	if( !RISE_API_CreateInstanceArrayGeometry( &pGeometry, pChild, numInstances, matrices ) || !pGeometry ) {
+		GlobalLog()->PrintEx( eLog_Error, "Job::AddInstanceArrayGeometry:: failed to create instance array `%s` of `%s`", name, child_geometry_name );
+		return false;
+	}
+
+	const bool ok = RegisterOrDiag( pGeomManager, pGeometry, name, "geometry" );
+	safe_release( pGeometry );
+	return ok;
+}
+
 //
 //  Adds lights
 //
@@ -5888,7 +6039,8 @@ bool Job::AddHeterogeneousMedium(
 	const unsigned int volEndZ,
 	const char accessor,
 	const double bboxMin[3],
-	const double bboxMax[3]
+	const double bboxMax[3],
+	const bool sparse
 	)
 {
 	// Create the phase function
@@ -5915,7 +6067,7 @@ bool Job::AddHeterogeneousMedium(
 			szVolumeFilePattern, volWidth, volHeight, volStartZ, volEndZ,
 			accessor,
 			Point3( bboxMin[0], bboxMin[1], bboxMin[2] ),
-			Point3( bboxMax[0], bboxMax[1], bboxMax[2] ) );
+			Point3( bboxMax[0], bboxMax[1], bboxMax[2] ), sparse );
 	} else {
 		RISE_API_CreateHeterogeneousMedium( &pMedium,
 			RISEPel( max_sigma_a[0], max_sigma_a[1], max_sigma_a[2] ),
@@ -5924,7 +6076,7 @@ bool Job::AddHeterogeneousMedium(
 			szVolumeFilePattern, volWidth, volHeight, volStartZ, volEndZ,
 			accessor,
 			Point3( bboxMin[0], bboxMin[1], bboxMin[2] ),
-			Point3( bboxMax[0], bboxMax[1], bboxMax[2] ) );
+			Point3( bboxMax[0], bboxMax[1], bboxMax[2] ), sparse );
 	}
 
 	safe_release( pPhase );
@@ -9346,6 +9498,10 @@ bool Job::RasterizeAnimation(
 
 	pRasterizer->RasterizeSceneAnimation( *pScene, time_start, time_end, num_frames, do_fields, invert_fields, 0, 0, pSeq );
 
+	// Frames still being encoded in the background must be on disk
+	// before we report the animation done
+	FrameEncodeQueue::FlushGlobal();
+
 	return true;
 }
 
@@ -9889,7 +10045,7 @@ bool Job::ClearAll(
 {
 	// A deliberate ClearAll is a FULL scene reset -- it must include the retained canonical CST Document so a
 	// subsequent reopen (the GUIs reuse ONE persistent Job: clearAll() THEN load) starts fresh.  Without this,
-	// LoadAsciiSceneViaCst's load-once guard (a non-null pCstDocument) would falsely refuse the second native-v7
+	// LoadParsedCstDocument_'s load-once guard (a non-null pCstDocument) would falsely refuse the second native-v7
 	// open.  The variant/edit re-derive paths (RederiveCstWithVariant, DeriveEditedCstDocument_) do NOT rely on the
 	// member surviving ClearAll -- each std::move's the Document into a LOCAL before ClearAll and re-retains from
 	// that local after, so this reset is a no-op for them.  mCstLoadFileIdentity SURVIVES ClearAll because
@@ -9908,6 +10064,24 @@ bool Job::ClearAll(
 }
 
 
+// Read a whole scene file into `bytes` with one read sized from the file's length, rather than streaming it
+// through a stringstream (which grows and copies its buffer as it goes, then copies it again into the result).
+// Returns false on an unopenable or unreadable file.
+static bool ReadSceneFileBytes( const char* filename, std::string& bytes )
+{
+	std::ifstream in( filename, std::ios::binary | std::ios::ate );
+	if( !in ) {
+		return false;
+	}
+	const std::streamoff size = in.tellg();
+	if( size < 0 ) {
+		return false;
+	}
+	bytes.resize( static_cast<size_t>( size ) );
+	in.seekg( 0, std::ios::beg );
+	return size == 0 || in.read( &bytes[0], size ).gcount() == size;
+}
+
 // P5 (Model-B, Slice 6c-3a): the DEFAULT scene-load entry point -- CST-ONLY.  Routes every USER scene through
 // the canonical CST path (so scene_variant switching + all CST edit/save features are always available).  This
 // is the ONE place the load-path decision lives; every front-end (CLI, Mac/Windows/Android GUI, Blender bridge)
@@ -9916,17 +10090,14 @@ bool Job::ClearAll(
 //
 // Decision (NOT a silent error-masking fallback):
 //   1. Cheaply classify the file: ParseToCst(bytes) -> IsNativeV7Document(doc).
-//   2. NATIVE-v7  -> LoadAsciiSceneViaCst (which re-parses + re-checks + DERIVES).  A derive ERROR there is a
-//      REAL, visible failure (returns false) -- we do NOT mask a genuine problem in a migrated scene.
+//   2. NATIVE-v7  -> LoadParsedCstDocument_ on that SAME Document (the tail LoadAsciiSceneViaCst shares), so
+//      the file is read + parsed once.  A derive ERROR there is a REAL, visible failure (returns false) -- we
+//      do NOT mask a genuine problem in a migrated scene.
 //   3. NOT native-v7 (un-migrated FOR/ENDFOR, > run/> load, render-affecting > directive, or no header) ->
 //      HARD-FAIL with an actionable diagnostic pointing at the offline migrator.  The legacy streaming loader
 //      was DELETED in Slice 6c-3c -- there is no legacy path to fall back to.
 //
 // There is NO env escape hatch (the former RISE_FORCE_LEGACY_LOAD is gone) -- there's no legacy path to force.
-//
-// Double-parse note: the native-v7 classify here re-parses, and LoadAsciiSceneViaCst re-parses again on the
-// native branch.  That's a single extra ParseToCst on a one-time load -- acceptable; keeping the classify in
-// Job (where Cst is already included + the Document is retained) is cleaner than duplicating it per front-end.
 bool Job::LoadAsciiSceneAuto(
 	const char* filename							///< [in] Name of the file containing the scene
 	)
@@ -9938,24 +10109,21 @@ bool Job::LoadAsciiSceneAuto(
 	// Classify the file: only a NATIVE-v7 document is accepted by the CST-only loader.  Read the bytes, parse to
 	// a CST, and ask IsNativeV7Document.  An unreadable/empty file is NOT native-v7 and falls into the hard-fail
 	// branch below with the same actionable diagnostic.
-	bool bNativeV7 = false;
+	std::unique_ptr<RISE::Cst::Document> doc;
 	{
-		std::ifstream in( filename, std::ios::binary );
-		if( in ) {
-			std::stringstream ss;
-			ss << in.rdbuf();
-			const std::string text = ss.str();
-			if( !text.empty() ) {
-				RISE::Cst::Document classifyDoc = RISE::Cst::ParseToCst( text );
-				bNativeV7 = RISE::Cst::IsNativeV7Document( classifyDoc );
+		std::string text;
+		if( ReadSceneFileBytes( filename, text ) && !text.empty() ) {
+			doc.reset( new RISE::Cst::Document( RISE::Cst::ParseToCst( text ) ) );
+			if( !RISE::Cst::IsNativeV7Document( *doc ) ) {
+				doc.reset();
 			}
 		}
 	}
 
 	// eLog_Event (not Info) so the resolved load path is visible on the console + in the log.
-	if( bNativeV7 ) {
+	if( doc ) {
 		GlobalLog()->PrintEx( eLog_Event, "Job::LoadAsciiSceneAuto:: '%s' is native v7-form -- loading via the canonical CST path (retains the CST Document for edit/save/variant)", filename );
-		return LoadAsciiSceneViaCst( filename );   // a derive error here is a REAL failure -- NO legacy fallback
+		return LoadParsedCstDocument_( filename, std::move( doc ) );   // a derive error here is a REAL failure -- NO legacy fallback
 	}
 
 	// Hard fail: the legacy streaming loader has been retired (Slice 6c) -- there is NO fallback.  Name the file
@@ -9969,7 +10137,7 @@ bool Job::LoadAsciiSceneAuto(
 
 // P5 (Model-B, Slice 1): load a scene by building the canonical CST and deriving the Scene from it,
 // RETAINING the Document for edit/save.  Since Slice 6c-3c this is the ONLY scene-load path (the legacy
-// streaming loader was deleted); LoadAsciiSceneAuto routes every native-v7 scene here.
+// streaming loader was deleted); LoadAsciiSceneAuto shares its derive-and-retain tail (LoadParsedCstDocument_).
 // P5 Slice 4 (reviewer P1 + follow-up): capture/refresh the CST-loaded file's identity (path + mtime + size).
 // Slice 6a/6d: stored ONLY in the Job member (mCstLoadFileIdentity, a FileIdentity from SceneEditor/FileIdentity.h);
 // the SaveEngine CST-save external-mod guard reads it directly via Job::GetCstLoadFileIdentity (IJobPriv).  The
@@ -10017,39 +10185,40 @@ bool Job::LoadAsciiSceneViaCst( const char* filename )
 		return false;
 	}
 
-	// Load-once guard: a load WITHOUT a prior ClearAll would desync the retained Document from the accumulated
-	// Scene (DeriveToJob does not reset the managers), so refuse it.  A GUI REOPEN is supported: the front-ends
-	// call ClearAll() (which now resets pCstDocument -- see Job::ClearAll) THEN load, so the reopen reaches here
-	// with a null Document and proceeds.
-	if( pCstDocument ) {
-		GlobalLog()->PrintEx( eLog_Error, "Job::LoadAsciiSceneViaCst:: this Job already loaded a scene; re-load is not supported (use a fresh Job)" );
-		return false;
-	}
-
 	// Read the scene file as-given (same as the legacy loader's top-level open; inner media resolves via the
 	// ambient GlobalMediaPathLocator during DeriveToJob).  Input must be NATIVE v7-form -- the v6 corpus is
 	// converted OFFLINE (migrator, plan Slice 2); the runtime does NOT Migrate.
-	std::ifstream in( filename, std::ios::binary );
-	if( !in ) {
+	std::string text;
+	if( !ReadSceneFileBytes( filename, text ) ) {
 		GlobalLog()->PrintEx( eLog_Error, "Job::LoadAsciiSceneViaCst:: cannot open scene file '%s'", filename );
 		return false;
 	}
-	std::stringstream ss;
-	ss << in.rdbuf();
-	const std::string text = ss.str();
 	if( text.empty() ) {
 		return false;
 	}
 
 	// Model-B: the canonical CST is the source; the Scene is derive(CST).
 	std::unique_ptr<RISE::Cst::Document> doc( new RISE::Cst::Document( RISE::Cst::ParseToCst( text ) ) );
+	return LoadParsedCstDocument_( filename, std::move( doc ) );
+}
+
+bool Job::LoadParsedCstDocument_( const char* filename, std::unique_ptr<RISE::Cst::Document> doc )
+{
+	// Load-once guard: a load WITHOUT a prior ClearAll would desync the retained Document from the accumulated
+	// Scene (DeriveToJob does not reset the managers), so refuse it.  A GUI REOPEN is supported: the front-ends
+	// call ClearAll() (which now resets pCstDocument -- see Job::ClearAll) THEN load, so the reopen reaches here
+	// with a null Document and proceeds.  Checked here so both LoadAsciiSceneViaCst and LoadAsciiSceneAuto get it.
+	if( pCstDocument ) {
+		GlobalLog()->PrintEx( eLog_Error, "Job::LoadParsedCstDocument_:: this Job already loaded a scene; re-load is not supported (use a fresh Job)" );
+		return false;
+	}
 
 	// Enforce the NATIVE-v7 contract (Cst::IsNativeV7Document): refuse a scene carrying an UN-migrated top-level
 	// construct DeriveToJob would SILENTLY skip + mis-derive -- a FOR/ENDFOR loop, a > run/> load include, or a
 	// render-AFFECTING > directive (> modify, > set <other>) -- or a missing header.  (Render-neutral > echo /
 	// > set accelerator are accepted.)  Convert offline first (the migrator, plan Slice 2).
 	if( !RISE::Cst::IsNativeV7Document( *doc ) ) {
-		GlobalLog()->PrintEx( eLog_Error, "Job::LoadAsciiSceneViaCst:: '%s' is not native v7-form (an un-migrated construct -- FOR/ENDFOR, > run/> load, or a render-affecting > directive -- or a missing 'RISE ASCII SCENE' header); convert it offline first (the migrator)", filename );
+		GlobalLog()->PrintEx( eLog_Error, "Job::LoadParsedCstDocument_:: '%s' is not native v7-form (an un-migrated construct -- FOR/ENDFOR, > run/> load, or a render-affecting > directive -- or a missing 'RISE ASCII SCENE' header); convert it offline first (the migrator)", filename );
 		return false;
 	}
 
@@ -10057,7 +10226,7 @@ bool Job::LoadAsciiSceneViaCst( const char* filename )
 	RISE::Cst::DeriveToJob( *doc, *this, &diags );
 	if( !diags.empty() ) {
 		for( size_t i = 0; i < diags.size() && i < 8u; ++i ) {
-			GlobalLog()->PrintEx( eLog_Error, "Job::LoadAsciiSceneViaCst:: derive diagnostic: %s", diags[i].c_str() );
+			GlobalLog()->PrintEx( eLog_Error, "Job::LoadParsedCstDocument_:: derive diagnostic: %s", diags[i].c_str() );
 		}
 		return false;   // refuse-all: a malformed / unsupported (v6-construct) scene applies nothing
 	}
@@ -10068,7 +10237,7 @@ bool Job::LoadAsciiSceneViaCst( const char* filename )
 	// head -- {fresh uuid, revision 1}.  NextCstHeadUuid() (file-static atomic, fetch_add) is minted per LOAD,
 	// so a reload of the SAME file gets a DIFFERENT uuid: a stale patch built against the previous load's head
 	// can never match even if the revision numbers coincide (the reload-collision guard).  ClearAll resets this
-	// to {0,0} (no head).  This is the ONLY mint site (LoadAsciiSceneViaCst is the sole head-retain path).
+	// to {0,0} (no head).  This is the ONLY mint site (LoadParsedCstDocument_ is the sole head-retain path).
 	mCstHeadVersion = RISE::Cst::CstHeadVersion{ NextCstHeadUuid(), 1 };
 
 	// Reviewer P1 (Slice 4 follow-up): capture the loaded file's identity (path + mtime + size) so the CST save
@@ -11898,6 +12067,7 @@ bool Job::RasterizeAnimationUsingOptions(
 
 	pRasterizer->RasterizeSceneAnimation( *pScene,
 		aTs, aTe, aNf, aDf, aInvf, 0, 0, pSeq );
+	FrameEncodeQueue::FlushGlobal();
 
 	return true;
 }
@@ -11934,6 +12104,7 @@ bool Job::RasterizeAnimationUsingOptions(
 
 	pRasterizer->RasterizeSceneAnimation( *pScene,
 		aTs, aTe, aNf, aDf, aInvf, 0, &frame, pSeq );
+	FrameEncodeQueue::FlushGlobal();
 
 	return true;
 }
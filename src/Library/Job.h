@@ -1501,7 +1501,8 @@ namespace RISE
 							const double emissive_intensity_scale = 1.0,
 							const double emissive_tint_r = 1.0,
 							const double emissive_tint_g = 1.0,
-							const double emissive_tint_b = 1.0
+							const double emissive_tint_b = 1.0,
+							const unsigned int instance_array_threshold = 256
 							);
 
 		//! Creates a triangle mesh geometry from a glTF 2.0 file.  See IJob.h
@@ -1530,10 +1531,7 @@ namespace RISE
 		/// \return TRUE if successful, FALSE otherwise
 		bool AddBezierPatchGeometry(
 							const char* name,						///< [in] Name of the geometry
-							const char* szFileName,					///< [in] Name of the file to load from
-							const unsigned int max_patches,			///< [in] Maximum number of patches per accelerator leaf
-							const unsigned char max_recur,			///< [in] Maximum accelerator recursion depth
-							const bool use_bsp,						///< [in] Use BSP tree (true) or Octree (false) for the patch accelerator
+							const char* szFileName,					///< [in] Name of the file to load from (text or binary patch file)
 							const bool bCenterObject				///< [in] Recenter all patch control points around the object-space origin
 							);
 
@@ -1592,10 +1590,7 @@ namespace RISE
 		/// \return TRUE if successful, FALSE otherwise
 		bool AddBilinearPatchGeometry(
 							const char* name,						///< [in] Name of the geometry
-							const char* szFileName,					///< [in] Name of the file to load from
-							const unsigned int max_polys,			///< [in] Maximum number of polygons in one octant node
-							const unsigned char max_recur,			///< [in] Maximum depth of the octree or bsp tree
-							const bool use_bsp						///< [in] Use a BSP tree rather than an Octree
+							const char* szFileName					///< [in] Name of the file to load from (text or binary patch file)
 							);
 
 		//! Creates a displaced geometry wrapping a previously-registered base geometry.
@@ -1607,7 +1602,17 @@ namespace RISE
 							const Scalar        disp_scale,
 							const bool          double_sided,
 							const bool          face_normals,
-					const bool          seam_fold = true );
+					const bool          seam_fold = true,
+							const bool          lazy = false,
+							const unsigned int  patch_subdivision = 8,
+							const unsigned int  lazy_cache_triangles = 1u<<20 );
+
+		//! Creates an instance array of a previously-registered child geometry
+		bool AddInstanceArrayGeometry(
+							const char*         name,
+							const char*         child_geometry_name,
+							const unsigned int  numInstances,
+							const double*       matrices );
 
 		//
 		// Adds lights
@@ -1698,7 +1703,8 @@ namespace RISE
 			const unsigned int volEndZ,								///< [in] Ending z slice index
 			const char accessor,									///< [in] Volume accessor type: 'n', 't', or 'c'
 			const double bboxMin[3],								///< [in] World-space AABB minimum corner
-			const double bboxMax[3]									///< [in] World-space AABB maximum corner
+			const double bboxMax[3],								///< [in] World-space AABB maximum corner
+			const bool sparse = false								///< [in] Store the volume as sparse 8^3 bricks
 			);
 
 		//! Adds a heterogeneous participating medium driven by a painter
@@ -3147,6 +3153,11 @@ namespace RISE
 									);
 
 	private:
+		//! Shared tail of LoadAsciiSceneViaCst / LoadAsciiSceneAuto: enforce the native-v7 contract on an
+		//! already-parsed `doc`, derive it, and on success RETAIN it as the head.  Lets the Auto path hand over the
+		//! Document it parsed to classify the file instead of reading + parsing the file a second time.
+		bool LoadParsedCstDocument_( const char* filename, std::unique_ptr<RISE::Cst::Document> doc );
+
 		//! P5 Slice 3 expansion: shared incremental + D2 re-derive tail for an already-edited CST Document
 		//! (closure anchored at `closureAnchorId`).  Activation-preserving D2 fallback.  Returns the 0/1/2/3
 		//! contract.  `entityName`/`role` are diagnostic-only.  Used by ApplyCstParamEdit + ApplyCstObjectMatrixEdit.
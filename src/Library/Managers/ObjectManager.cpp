@@ -24,6 +24,10 @@ using namespace RISE::Implementation;
 
 namespace {
 
+// Diagnostic counter: top-level trees built lazily from a ray query.  See
+// GetLazyTreeBuildCount() in the header.
+std::atomic<unsigned int> s_lazyTreeBuildCount( 0 );
+
 // Process-wide monotonic source for spatial-structure generation values.
 // Each ObjectManager seeds its generation here at construction and draws
 // every InvalidateSpatialStructure advance from the same counter, so a
@@ -124,6 +128,11 @@ bool ObjectManager::RayElementIntersection_IntersectionOnly( const Ray& ray, con
 	return false;
 }
 
+bool ObjectManager::GetAnalyticElementShape( const MYOBJ elem, AnalyticShape& shape, Matrix4& mxWorldToLocal ) const
+{
+	return elem->GetAnalyticShape( shape, mxWorldToLocal );
+}
+
 void ObjectManager::SerializeElement( IWriteBuffer& buffer, const MYOBJ elem ) const
 {
 }
@@ -170,7 +179,17 @@ ObjectManager::~ObjectManager( )
 	delete [] shadowCache;
 }
 
-void ObjectManager::RealizeAllObjects() const
+unsigned int ObjectManager::GetLazyTreeBuildCount()
+{
+	return s_lazyTreeBuildCount.load( std::memory_order_relaxed );
+}
+
+void ObjectManager::ResetLazyTreeBuildCount()
+{
+	s_lazyTreeBuildCount.store( 0, std::memory_order_relaxed );
+}
+
+bool ObjectManager::RealizeAllObjects( const CancellationToken& cancel ) const
 {
 	// Realize deferred geometry (e.g. DisplacedGeometry's mesh bake) BEFORE any
 	// bbox / acceleration-structure query.  Called from PrepareForRendering AND
@@ -178,10 +197,18 @@ void ObjectManager::RealizeAllObjects() const
 	// which bypasses PrepareForRendering -- builds from realized, non-zero
 	// bounds.  Object::Realize() is const, idempotent, and mutex-serialized for
 	// the deferred geometries, so repeated/concurrent calls are safe no-ops.
+	//
+	// A single bake can take seconds on a heavy displaced mesh, so a render
+	// restart polls `cancel` between objects; the bakes already done are kept
+	// and the next pass picks up where this one stopped.
 	GenericManager<IObjectPriv>::ItemListType::const_iterator i, e;
 	for( i=items.begin(), e=items.end(); i!=e; ++i ) {
+		if( cancel.IsCancelled() ) {
+			return false;
+		}
 		i->second.first->Realize();
 	}
+	return true;
 }
 
 void ObjectManager::CreateBVH() const
@@ -196,7 +223,9 @@ void ObjectManager::CreateBVH() const
 
 	// Realize deferred geometry first, so the BVH is built from real bounds
 	// even on the lazy IntersectRay path that skipped PrepareForRendering.
-	RealizeAllObjects();
+	// Never cancellable: a tree built over half-realized objects would be
+	// kept by the `pBVH` guard above.
+	RealizeAllObjects( CancellationToken() );
 
 	// Construct the overall bounding box
 	BoundingBox bbox( Point3(RISE_INFINITY,RISE_INFINITY,RISE_INFINITY), Point3(-RISE_INFINITY,-RISE_INFINITY,-RISE_INFINITY) );
@@ -244,7 +273,7 @@ void ObjectManager::CreateOctree() const
 	}
 
 	// Realize deferred geometry first (see CreateBVH).
-	RealizeAllObjects();
+	RealizeAllObjects( CancellationToken() );
 
 	// Construct the overall bounding box
 	BoundingBox bbox( Point3(RISE_INFINITY,RISE_INFINITY,RISE_INFINITY), Point3(-RISE_INFINITY,-RISE_INFINITY,-RISE_INFINITY) );
@@ -275,6 +304,7 @@ void ObjectManager::IntersectRay( RayIntersection& ri, const bool bHitFrontFaces
 	if( bUseBSPtree && (items.size() > nMaxObjectsPerNode) ) {
 		if( !pBVH ) {
 			GlobalLog()->PrintEasyWarning( "ObjectManager: BVH built lazily during IntersectRay; call PrepareForRendering() before rendering" );
+			s_lazyTreeBuildCount.fetch_add( 1, std::memory_order_relaxed );
 			CreateBVH();
 		}
 
@@ -288,6 +318,7 @@ void ObjectManager::IntersectRay( RayIntersection& ri, const bool bHitFrontFaces
 	} else if( bUseOctree && (items.size() > nMaxObjectsPerNode) ) {
 		if( !pOctree ) {
 			GlobalLog()->PrintEasyWarning( "ObjectManager: Octree built lazily during IntersectRay; call PrepareForRendering() before rendering" );
+			s_lazyTreeBuildCount.fetch_add( 1, std::memory_order_relaxed );
 			CreateOctree();
 		}
 
@@ -324,11 +355,13 @@ bool ObjectManager::IntersectShadowRay( const Ray& ray, const Scalar dHowFar, co
 
 	if( bUseBSPtree && (items.size() > nMaxObjectsPerNode) ) {
 		if( !pBVH ) {
+			s_lazyTreeBuildCount.fetch_add( 1, std::memory_order_relaxed );
 			CreateBVH();
 		}
 		return pBVH->IntersectRay_IntersectionOnly( ray, dHowFar, bHitFrontFaces, bHitBackFaces );
 	} else if( bUseOctree && (items.size() > nMaxObjectsPerNode) ) {
 		if( !pOctree ) {
+			s_lazyTreeBuildCount.fetch_add( 1, std::memory_order_relaxed );
 			CreateOctree();
 		}
 
@@ -411,12 +444,19 @@ void ObjectManager::PrepareForRendering() const
 	// vanish / become unpickable).  Direct callers (the GUI production-render +
 	// picking paths) reach PrepareForRendering before RayCaster::AttachScene's
 	// realize pass, and this is the funnel they share.  Idempotent.
-	RealizeAllObjects();
-
-	if( bUseBSPtree && (items.size() > nMaxObjectsPerNode) && !pBVH ) {
-		CreateBVH();
-	} else if( bUseOctree && (items.size() > nMaxObjectsPerNode) && !pOctree ) {
-		CreateOctree();
+	//
+	// Cancellable through the caller's ambient token (the rasterizers install
+	// their progress callback's).  A cancelled prepare skips the TLAS build as
+	// well rather than build it from unrealized bounds; the `!pBVH` guard then
+	// builds it on the next pass.
+	if( RealizeAllObjects( CancellationToken::Current() ) ) {
+		if( bUseBSPtree && (items.size() > nMaxObjectsPerNode) && !pBVH ) {
+			CreateBVH();
+		} else if( bUseOctree && (items.size() > nMaxObjectsPerNode) && !pOctree ) {
+			CreateOctree();
+		}
+	} else {
+		GlobalLog()->PrintEasyEvent( "ObjectManager::PrepareForRendering:: Cancelled before the acceleration structure build" );
 	}
 
 	if( !shadowCache ) {
@@ -21,6 +21,7 @@
 
 #include "../Interfaces/IObjectManager.h"
 #include "../Utilities/Threads/Threads.h"
+#include "../Utilities/CancellationToken.h"
 #include "GenericManager.h"
 #include "../Acceleration/BVH.h"
 #include "../Octree.h"
@@ -63,7 +64,9 @@ namespace RISE
 
 			// Realize all objects' deferred geometry (idempotent) before any bbox/
 			// TLAS query.  Called from PrepareForRendering AND CreateBVH/CreateOctree.
-			void RealizeAllObjects() const;
+			// Stops between objects once `cancel` fires and returns false; the
+			// objects it did not reach stay unrealized until the next call.
+			bool RealizeAllObjects( const CancellationToken& cancel ) const;
 			void CreateBVH() const;
 			void CreateOctree() const;
 
@@ -97,6 +100,7 @@ namespace RISE
 				void RayElementIntersection( RayIntersectionGeometric& ri, const MYOBJ elem, const bool bHitFrontFaces, const bool bHitBackFaces ) const;
 				void RayElementIntersection( RayIntersection& ri, const MYOBJ elem, const bool bHitFrontFaces, const bool bHitBackFaces, const bool bComputeExitInfo ) const;
 				bool RayElementIntersection_IntersectionOnly( const Ray& ray, const Scalar dHowFar, const MYOBJ elem, const bool bHitFrontFaces, const bool bHitBackFaces ) const;
+				bool GetAnalyticElementShape( const MYOBJ elem, AnalyticShape& shape, Matrix4& mxWorldToLocal ) const;
 				BoundingBox GetElementBoundingBox( const MYOBJ elem ) const;
 				bool ElementBoxIntersection( const MYOBJ elem, const BoundingBox& bbox ) const;
 				char WhichSideofPlaneIsElement( const MYOBJ elem, const Plane& plane ) const;
@@ -110,6 +114,14 @@ namespace RISE
 			void PrepareForRendering() const;
 			void InvalidateSpatialStructure() const;
 			unsigned long long GetSpatialStructureGeneration() const { return mSpatialGen; }
+
+			// Diagnostic: number of top-level trees built lazily from
+			// IntersectRay or IntersectShadowRay, process-wide.  A
+			// render that PrepareForRendering set up never takes that path,
+			// including one restarted mid-realize.  Same static-counter
+			// pattern as DisplacedGeometry::GetBuildMeshCount.
+			static unsigned int GetLazyTreeBuildCount();
+			static void         ResetLazyTreeBuildCount();
 		};
 	}
 }
@@ -33,7 +33,8 @@ HeterogeneousMedium::HeterogeneousMedium(
 	const unsigned int volHeight,
 	const unsigned int volDepth,
 	const Point3& bboxMin,
-	const Point3& bboxMax
+	const Point3& bboxMax,
+	const IBrickedVolume* pBricks
 	) :
   m_max_sigma_a( max_sigma_a ),
   m_max_sigma_s( max_sigma_s ),
@@ -56,10 +57,18 @@ HeterogeneousMedium::HeterogeneousMedium(
 	unsigned int gridX, gridY, gridZ;
 	MajorantGrid::DefaultGridResolution( volWidth, volHeight, volDepth,
 		gridX, gridY, gridZ );
-	m_pMajorantGrid = new MajorantGrid(
-		accessor, volWidth, volHeight, volDepth,
-		bboxMin, bboxMax, m_sigma_t_majorant,
-		gridX, gridY, gridZ );
+	// A bricked volume already knows each brick's maximum, so the grid
+	// is built without a pass over every voxel
+	if( pBricks ) {
+		m_pMajorantGrid = new MajorantGrid(
+			*pBricks, bboxMin, bboxMax, m_sigma_t_majorant,
+			gridX, gridY, gridZ );
+	} else {
+		m_pMajorantGrid = new MajorantGrid(
+			accessor, volWidth, volHeight, volDepth,
+			bboxMin, bboxMax, m_sigma_t_majorant,
+			gridX, gridY, gridZ );
+	}
 }
 
 HeterogeneousMedium::HeterogeneousMedium(
@@ -72,7 +81,8 @@ HeterogeneousMedium::HeterogeneousMedium(
 	const unsigned int volHeight,
 	const unsigned int volDepth,
 	const Point3& bboxMin,
-	const Point3& bboxMax
+	const Point3& bboxMax,
+	const IBrickedVolume* pBricks
 	) :
   m_max_sigma_a( max_sigma_a ),
   m_max_sigma_s( max_sigma_s ),
@@ -95,10 +105,18 @@ HeterogeneousMedium::HeterogeneousMedium(
 	unsigned int gridX, gridY, gridZ;
 	MajorantGrid::DefaultGridResolution( volWidth, volHeight, volDepth,
 		gridX, gridY, gridZ );
-	m_pMajorantGrid = new MajorantGrid(
-		accessor, volWidth, volHeight, volDepth,
-		bboxMin, bboxMax, m_sigma_t_majorant,
-		gridX, gridY, gridZ );
+	// A bricked volume already knows each brick's maximum, so the grid
+	// is built without a pass over every voxel
+	if( pBricks ) {
+		m_pMajorantGrid = new MajorantGrid(
+			*pBricks, bboxMin, bboxMax, m_sigma_t_majorant,
+			gridX, gridY, gridZ );
+	} else {
+		m_pMajorantGrid = new MajorantGrid(
+			accessor, volWidth, volHeight, volDepth,
+			bboxMin, bboxMax, m_sigma_t_majorant,
+			gridX, gridY, gridZ );
+	}
 }
 
 HeterogeneousMedium::~HeterogeneousMedium()
@@ -141,7 +141,8 @@ namespace RISE
 			const unsigned int volHeight,		///< [in] Volume height in voxels
 			const unsigned int volDepth,		///< [in] Volume depth in voxels
 			const Point3& bboxMin,				///< [in] World-space AABB minimum corner
-			const Point3& bboxMax				///< [in] World-space AABB maximum corner
+			const Point3& bboxMax,				///< [in] World-space AABB maximum corner
+			const IBrickedVolume* pBricks = 0	///< [in] When the accessor reads a bricked volume, builds the majorant grid from its brick maxima
 			);
 
 		/// Construct with emission
@@ -155,7 +156,8 @@ namespace RISE
 			const unsigned int volHeight,		///< [in] Volume height in voxels
 			const unsigned int volDepth,		///< [in] Volume depth in voxels
 			const Point3& bboxMin,				///< [in] World-space AABB minimum corner
-			const Point3& bboxMax				///< [in] World-space AABB maximum corner
+			const Point3& bboxMax,				///< [in] World-space AABB maximum corner
+			const IBrickedVolume* pBricks = 0	///< [in] When the accessor reads a bricked volume, builds the majorant grid from its brick maxima
 			);
 
 		MediumCoefficients GetCoefficients(
@@ -15,6 +15,7 @@
 
 #include "pch.h"
 #include "InterpolatedNoise.h"
+#include "NoiseBatch.h"
 
 //
 // 1D noise
@@ -156,3 +157,71 @@ Scalar InterpolatedNoise3D::Evaluate( const Scalar x, const Scalar y, const Scal
 	return interp.InterpolateValues( j1, j2, fracZ );
 }
 
+namespace
+{
+	//! The batched body shared by the double and float paths.  T is the
+	//! precision of the lattice values; the interpolator always runs in
+	//! Scalar.
+	template< class T >
+	void InterpolatedBatch3D(
+		const RealSimpleInterpolator& interp,
+		const T* x, const T* y, const T* z,
+		T* out,
+		const unsigned int count
+		)
+	{
+		T		block[64];
+		Scalar	v[8];
+		bool	haveCell = false;
+		int		cX = 0, cY = 0, cZ = 0;
+
+		for( unsigned int i=0; i<count; i++ )
+		{
+			const double	fX = floor( Scalar(x[i]) );
+			const double	fracX = Scalar(x[i]) - fX;
+			const int		X = int(fX);
+
+			const double	fY = floor( Scalar(y[i]) );
+			const double	fracY = Scalar(y[i]) - fY;
+			const int		Y = int(fY);
+
+			const double	fZ = floor( Scalar(z[i]) );
+			const double	fracZ = Scalar(z[i]) - fZ;
+			const int		Z = int(fZ);
+
+			if( !haveCell || X != cX || Y != cY || Z != cZ ) {
+				NoiseBatch::HashBlock3D( X, Y, Z, block );
+				v[0] = NoiseBatch::SmoothedFromBlock( block, 1, 1, 1 );
+				v[1] = NoiseBatch::SmoothedFromBlock( block, 2, 1, 1 );
+				v[2] = NoiseBatch::SmoothedFromBlock( block, 1, 2, 1 );
+				v[3] = NoiseBatch::SmoothedFromBlock( block, 2, 2, 1 );
+				v[4] = NoiseBatch::SmoothedFromBlock( block, 1, 1, 2 );
+				v[5] = NoiseBatch::SmoothedFromBlock( block, 2, 1, 2 );
+				v[6] = NoiseBatch::SmoothedFromBlock( block, 1, 2, 2 );
+				v[7] = NoiseBatch::SmoothedFromBlock( block, 2, 2, 2 );
+				cX = X; cY = Y; cZ = Z;
+				haveCell = true;
+			}
+
+			const Scalar	i1 = interp.InterpolateValues( v[0], v[1], fracX );
+			const Scalar	i2 = interp.InterpolateValues( v[2], v[3], fracX );
+			const Scalar	i3 = interp.InterpolateValues( v[4], v[5], fracX );
+			const Scalar	i4 = interp.InterpolateValues( v[6], v[7], fracX );
+
+			const Scalar	j1 = interp.InterpolateValues( i1, i2, fracY );
+			const Scalar	j2 = interp.InterpolateValues( i3, i4, fracY );
+
+			out[i] = T( interp.InterpolateValues( j1, j2, fracZ ) );
+		}
+	}
+}
+
+void InterpolatedNoise3D::EvaluateBatch( const Scalar* x, const Scalar* y, const Scalar* z, Scalar* out, const unsigned int count ) const
+{
+	InterpolatedBatch3D<Scalar>( interp, x, y, z, out, count );
+}
+
+void InterpolatedNoise3D::EvaluateBatchFloat( const float* x, const float* y, const float* z, float* out, const unsigned int count ) const
+{
+	InterpolatedBatch3D<float>( interp, x, y, z, out, count );
+}
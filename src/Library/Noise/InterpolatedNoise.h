@@ -62,6 +62,13 @@ namespace RISE
 		public:
 			InterpolatedNoise3D( const RealSimpleInterpolator& interp_ );
 			virtual Scalar Evaluate( const Scalar x, const Scalar y, const Scalar z ) const;
+
+			//! Hashes each lattice cell's 4x4x4 neighbourhood once (see
+			//! NoiseBatch.h) instead of making 216 virtual Noise3D calls, and
+			//! reuses the cell while consecutive points stay in it.
+			//! Bit-identical to Evaluate.
+			virtual void EvaluateBatch( const Scalar* x, const Scalar* y, const Scalar* z, Scalar* out, const unsigned int count ) const;
+			virtual void EvaluateBatchFloat( const float* x, const float* y, const float* z, float* out, const unsigned int count ) const;
 		};
 	}
 }
@@ -0,0 +1,180 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  NoiseBatch.cpp - SIMD lattice hash kernels for the batched noise
+//  paths.  See NoiseBatch.h.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//  Comments:
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "NoiseBatch.h"
+
+// Same selection scheme as BVH.h: NEON on arm64, SSE2 (with the
+// SSE4.1 multiply when available) or AVX2 on x86_64, scalar otherwise.
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#  include <arm_neon.h>
+#  define RISE_NOISE_HAVE_NEON 1
+#elif defined(__AVX2__)
+#  include <immintrin.h>
+#  define RISE_NOISE_HAVE_AVX2 1
+#elif defined(__SSE2__) || defined(_M_AMD64) || defined(_M_X64)
+#  include <emmintrin.h>
+#  if defined(__SSE4_1__)
+#    include <smmintrin.h>
+#  endif
+#  define RISE_NOISE_HAVE_SSE 1
+#endif
+
+using namespace RISE;
+using namespace RISE::Implementation;
+
+namespace
+{
+	// Lattice offsets of the 4x4x4 block relative to its first point,
+	// in the Noise3D hash basis (x + 57y + 113z)
+	inline unsigned int RowOffset( const unsigned int dy, const unsigned int dz )
+	{
+		return dy*57u + dz*113u;
+	}
+
+#if !defined(RISE_NOISE_HAVE_AVX2) && !defined(RISE_NOISE_HAVE_SSE) && !defined(RISE_NOISE_HAVE_NEON)
+	// The Noise3D hash chain on an already-combined lattice index,
+	// masked to the 31-bit value Noise3D divides by 2^30
+	inline unsigned int HashScalar( unsigned int n )
+	{
+		n = (n<<13) ^ n;
+		return (n * (n * n * 15731u + 789221u) + 1376312589u) & 0x7fffffffu;
+	}
+#endif
+
+#if defined(RISE_NOISE_HAVE_SSE)
+	inline __m128i MulLo32( const __m128i a, const __m128i b )
+	{
+#if defined(__SSE4_1__)
+		return _mm_mullo_epi32( a, b );
+#else
+		// SSE2 has no 32-bit low multiply: do the even and odd lanes as
+		// 32x32->64 products and pack the low halves back together
+		const __m128i even = _mm_mul_epu32( a, b );
+		const __m128i odd = _mm_mul_epu32( _mm_srli_epi64( a, 32 ), _mm_srli_epi64( b, 32 ) );
+		return _mm_unpacklo_epi32(
+			_mm_shuffle_epi32( even, _MM_SHUFFLE(0,0,2,0) ),
+			_mm_shuffle_epi32( odd, _MM_SHUFFLE(0,0,2,0) ) );
+#endif
+	}
+#endif
+
+	//! Hashes all 64 lattice points of the block into h[]
+	void HashBlockInt( const int X, const int Y, const int Z, unsigned int* h )
+	{
+		// Unsigned wrap-around throughout, exactly as Noise3D::Evaluate
+		const unsigned int base = ((unsigned int)X - 1u) + ((unsigned int)Y - 1u) * 57u + ((unsigned int)Z - 1u) * 113u;
+
+#if defined(RISE_NOISE_HAVE_AVX2)
+		// Two rows (dy, dy+1) per 8-wide vector
+		const __m256i lane = _mm256_setr_epi32( 0, 1, 2, 3, 57, 58, 59, 60 );
+		const __m256i k15731 = _mm256_set1_epi32( 15731 );
+		const __m256i k789221 = _mm256_set1_epi32( 789221 );
+		const __m256i k1376312589 = _mm256_set1_epi32( 1376312589 );
+		const __m256i kMask = _mm256_set1_epi32( 0x7fffffff );
+		for( unsigned int dz=0; dz<4; dz++ ) {
+			for( unsigned int dy=0; dy<4; dy+=2 ) {
+				__m256i n = _mm256_add_epi32( _mm256_set1_epi32( int(base + RowOffset(dy,dz)) ), lane );
+				n = _mm256_xor_si256( _mm256_slli_epi32( n, 13 ), n );
+				__m256i t = _mm256_mullo_epi32( n, n );
+				t = _mm256_add_epi32( _mm256_mullo_epi32( t, k15731 ), k789221 );
+				t = _mm256_add_epi32( _mm256_mullo_epi32( n, t ), k1376312589 );
+				t = _mm256_and_si256( t, kMask );
+				_mm256_storeu_si256( reinterpret_cast<__m256i*>( h + dz*16 + dy*4 ), t );
+			}
+		}
+#elif defined(RISE_NOISE_HAVE_SSE)
+		const __m128i lane = _mm_setr_epi32( 0, 1, 2, 3 );
+		const __m128i k15731 = _mm_set1_epi32( 15731 );
+		const __m128i k789221 = _mm_set1_epi32( 789221 );
+		const __m128i k1376312589 = _mm_set1_epi32( 1376312589 );
+		const __m128i kMask = _mm_set1_epi32( 0x7fffffff );
+		for( unsigned int dz=0; dz<4; dz++ ) {
+			for( unsigned int dy=0; dy<4; dy++ ) {
+				__m128i n = _mm_add_epi32( _mm_set1_epi32( int(base + RowOffset(dy,dz)) ), lane );
+				n = _mm_xor_si128( _mm_slli_epi32( n, 13 ), n );
+				__m128i t = MulLo32( n, n );
+				t = _mm_add_epi32( MulLo32( t, k15731 ), k789221 );
+				t = _mm_add_epi32( MulLo32( n, t ), k1376312589 );
+				t = _mm_and_si128( t, kMask );
+				_mm_storeu_si128( reinterpret_cast<__m128i*>( h + dz*16 + dy*4 ), t );
+			}
+		}
+#elif defined(RISE_NOISE_HAVE_NEON)
+		static const unsigned int laneInit[4] = { 0, 1, 2, 3 };
+		const uint32x4_t lane = vld1q_u32( laneInit );
+		const uint32x4_t k15731 = vdupq_n_u32( 15731u );
+		const uint32x4_t k789221 = vdupq_n_u32( 789221u );
+		const uint32x4_t k1376312589 = vdupq_n_u32( 1376312589u );
+		const uint32x4_t kMask = vdupq_n_u32( 0x7fffffffu );
+		for( unsigned int dz=0; dz<4; dz++ ) {
+			for( unsigned int dy=0; dy<4; dy++ ) {
+				uint32x4_t n = vaddq_u32( vdupq_n_u32( base + RowOffset(dy,dz) ), lane );
+				n = veorq_u32( vshlq_n_u32( n, 13 ), n );
+				uint32x4_t t = vmulq_u32( n, n );
+				t = vaddq_u32( vmulq_u32( t, k15731 ), k789221 );
+				t = vaddq_u32( vmulq_u32( n, t ), k1376312589 );
+				t = vandq_u32( t, kMask );
+				vst1q_u32( h + dz*16 + dy*4, t );
+			}
+		}
+#else
+		for( unsigned int dz=0; dz<4; dz++ ) {
+			for( unsigned int dy=0; dy<4; dy++ ) {
+				const unsigned int row = base + RowOffset(dy,dz);
+				for( unsigned int dx=0; dx<4; dx++ ) {
+					h[dz*16 + dy*4 + dx] = HashScalar( row + dx );
+				}
+			}
+		}
+#endif
+	}
+}
+
+void NoiseBatch::HashBlock3D( const int X, const int Y, const int Z, Scalar* block )
+{
+	unsigned int h[64];
+	HashBlockInt( X, Y, Z, h );
+
+	// 1 - h/2^30: the division by a power of two is exact, so this is
+	// bit-identical to Noise3D::Evaluate
+	for( unsigned int i=0; i<64; i++ ) {
+		block[i] = 1.0 - Scalar( int(h[i]) ) / 1073741824.;
+	}
+}
+
+void NoiseBatch::HashBlock3D( const int X, const int Y, const int Z, float* block )
+{
+	unsigned int h[64];
+	HashBlockInt( X, Y, Z, h );
+
+	for( unsigned int i=0; i<64; i++ ) {
+		block[i] = 1.0f - float( int(h[i]) ) * (1.0f / 1073741824.f);
+	}
+}
+
+const char* NoiseBatch::KernelName()
+{
+#if defined(RISE_NOISE_HAVE_AVX2)
+	return "AVX2";
+#elif defined(RISE_NOISE_HAVE_SSE) && defined(__SSE4_1__)
+	return "SSE4.1";
+#elif defined(RISE_NOISE_HAVE_SSE)
+	return "SSE2";
+#elif defined(RISE_NOISE_HAVE_NEON)
+	return "NEON";
+#else
+	return "scalar";
+#endif
+}
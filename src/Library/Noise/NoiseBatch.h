@@ -0,0 +1,85 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  NoiseBatch.h - Kernels shared by the batched (EvaluateBatch)
+//  paths of the lattice noise functions.
+//
+//  InterpolatedNoise3D blends the SmoothedNoise3D value at the 8
+//  corners of the lattice cell containing a point, and each smoothed
+//  value is a weighted sum of Noise3D over the 27 lattice points
+//  around that corner.  The scalar path therefore hashes 216 lattice
+//  points per octave through three levels of virtual calls, even
+//  though the 8 neighbourhoods together only cover a 4x4x4 block.
+//
+//  HashBlock3D hashes that 4x4x4 block once, with SIMD integer
+//  multiplies where the target has them (AVX2 8-wide, SSE2/SSE4.1 and
+//  NEON 4-wide), and SmoothedFromBlock rebuilds the smoothed value of
+//  any corner from the block using exactly the summation order of
+//  SmoothedNoise3D::Evaluate, so the double path is bit-identical to
+//  the scalar one.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//  Comments:
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#ifndef NOISE_BATCH_
+#define NOISE_BATCH_
+
+#include "../Interfaces/IFunction3D.h"
+
+namespace RISE
+{
+	namespace Implementation
+	{
+		namespace NoiseBatch
+		{
+			//! Points processed per inner sweep by the batched octave loops
+			static const unsigned int kChunk = 64;
+
+			//! Fills block[dz*16+dy*4+dx] with Noise3D::Evaluate at lattice
+			//! point (X-1+dx, Y-1+dy, Z-1+dz), for dx,dy,dz in [0,3]
+			void HashBlock3D( const int X, const int Y, const int Z, Scalar* block );
+
+			//! Single precision HashBlock3D.  Within one float ulp of the
+			//! double block.
+			void HashBlock3D( const int X, const int Y, const int Z, float* block );
+
+			//! Name of the kernel compiled into this build ("AVX2", "SSE4.1",
+			//! "SSE2", "NEON" or "scalar"), for logs and tests
+			const char* KernelName();
+
+			//! Picks EvaluateBatch or EvaluateBatchFloat by precision, so the
+			//! octave loops can be written once as templates
+			inline void Evaluate( const IFunction3D& f, const Scalar* x, const Scalar* y, const Scalar* z, Scalar* out, const unsigned int count )
+			{
+				f.EvaluateBatch( x, y, z, out, count );
+			}
+
+			inline void Evaluate( const IFunction3D& f, const float* x, const float* y, const float* z, float* out, const unsigned int count )
+			{
+				f.EvaluateBatchFloat( x, y, z, out, count );
+			}
+
+			//! SmoothedNoise3D at lattice point (X-1+i, Y-1+j, Z-1+k) of the
+			//! block, i,j,k in [1,2].  Same terms, same order as
+			//! SmoothedNoise3D::Evaluate.
+			template< class T >
+			inline T SmoothedFromBlock( const T* b, const int i, const int j, const int k )
+			{
+				#define RISE_NB( dx, dy, dz ) b[ (k+(dz))*16 + (j+(dy))*4 + (i+(dx)) ]
+				const T corners = ( RISE_NB(-1,-1,-1)+RISE_NB(1,-1,-1)+RISE_NB(-1,1,-1)+RISE_NB(1,1,-1) + RISE_NB(-1,-1,1)+RISE_NB(1,-1,1)+RISE_NB(-1,1,1)+RISE_NB(1,1,1) ) / T(64.0);
+				const T edges = ( RISE_NB(0,1,1)+ RISE_NB(0,1,-1)+ RISE_NB(0,-1,1)+ RISE_NB(0,-1,-1)+ RISE_NB(1,0,1)+ RISE_NB(1,0,-1) + RISE_NB(-1,0,1) +  RISE_NB(-1,0,-1)+ RISE_NB(1,1,0)+ RISE_NB(1,-1,0)+ RISE_NB(-1,1,0)+ RISE_NB(-1,-1,0) ) / T(48.0);
+				const T adjacent = ( RISE_NB(-1,0,0)+RISE_NB(1,0,0)+RISE_NB(0,-1,0)+RISE_NB(0,1,0) + RISE_NB(0,0,-1) + RISE_NB(0,0,1) ) / T(12.0);
+				const T center = RISE_NB(0,0,0) / T(8.0);
+				#undef RISE_NB
+				return( corners + edges + adjacent + center );
+			}
+		}
+	}
+}
+
+#endif
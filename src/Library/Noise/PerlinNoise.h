@@ -107,6 +107,12 @@ namespace RISE
 			PerlinNoise3D( const RealSimpleInterpolator& interp, const Scalar persistence_, const int numOctaves_ );
 
 			virtual Scalar Evaluate( const Scalar x, const Scalar y, const Scalar z ) const;
+
+			//! Runs the octave loop outermost, handing each octave's scaled
+			//! points to InterpolatedNoise3D::EvaluateBatch in chunks.
+			//! Bit-identical to Evaluate.
+			virtual void EvaluateBatch( const Scalar* x, const Scalar* y, const Scalar* z, Scalar* out, const unsigned int count ) const;
+			virtual void EvaluateBatchFloat( const float* x, const float* y, const float* z, float* out, const unsigned int count ) const;
 		};
 	}
 }
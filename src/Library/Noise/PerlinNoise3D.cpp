@@ -13,6 +13,7 @@
 
 #include "pch.h"
 #include "PerlinNoise.h"
+#include "NoiseBatch.h"
 
 using namespace RISE;
 using namespace RISE::Implementation;
@@ -51,3 +52,58 @@ Scalar PerlinNoise3D::Evaluate( const Scalar x, const Scalar y, const Scalar z )
 
 	return total;
 }
+
+namespace
+{
+	template< class T >
+	void PerlinBatch3D(
+		const IFunction3D& noise,
+		const int n,
+		const Scalar* pAmplitudesLUT,
+		const T* x, const T* y, const T* z,
+		T* out,
+		const unsigned int count
+		)
+	{
+		T	px[NoiseBatch::kChunk];
+		T	py[NoiseBatch::kChunk];
+		T	pz[NoiseBatch::kChunk];
+		T	v[NoiseBatch::kChunk];
+
+		for( unsigned int start=0; start<count; start+=NoiseBatch::kChunk )
+		{
+			const unsigned int m = (count-start) < NoiseBatch::kChunk ? (count-start) : NoiseBatch::kChunk;
+			T* total = out + start;
+
+			for( unsigned int k=0; k<m; k++ ) {
+				total[k] = 0;
+			}
+
+			for( int i=0; i<n; i++ ) {
+				const T freq = T(frequency_lut[i]);
+				for( unsigned int k=0; k<m; k++ ) {
+					px[k] = x[start+k] * freq;
+					py[k] = y[start+k] * freq;
+					pz[k] = z[start+k] * freq;
+				}
+
+				NoiseBatch::Evaluate( noise, px, py, pz, v, m );
+
+				const T amp = T(pAmplitudesLUT[i]);
+				for( unsigned int k=0; k<m; k++ ) {
+					total[k] += v[k] * amp;
+				}
+			}
+		}
+	}
+}
+
+void PerlinNoise3D::EvaluateBatch( const Scalar* x, const Scalar* y, const Scalar* z, Scalar* out, const unsigned int count ) const
+{
+	PerlinBatch3D<Scalar>( *noise, n, pAmplitudesLUT, x, y, z, out, count );
+}
+
+void PerlinNoise3D::EvaluateBatchFloat( const float* x, const float* y, const float* z, float* out, const unsigned int count ) const
+{
+	PerlinBatch3D<float>( *noise, n, pAmplitudesLUT, x, y, z, out, count );
+}
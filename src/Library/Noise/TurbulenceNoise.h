@@ -45,6 +45,12 @@ namespace RISE
 			/// Evaluates turbulence: sum of |noise| at each octave,
 			/// normalized to [0, 1] by dividing by the sum of amplitudes.
 			virtual Scalar Evaluate( const Scalar x, const Scalar y, const Scalar z ) const;
+
+			//! Runs the octave loop outermost, handing each octave's scaled
+			//! points to InterpolatedNoise3D::EvaluateBatch in chunks.
+			//! Bit-identical to Evaluate.
+			virtual void EvaluateBatch( const Scalar* x, const Scalar* y, const Scalar* z, Scalar* out, const unsigned int count ) const;
+			virtual void EvaluateBatchFloat( const float* x, const float* y, const float* z, float* out, const unsigned int count ) const;
 		};
 	}
 }
@@ -19,6 +19,7 @@
 #include "pch.h"
 #include "TurbulenceNoise.h"
 #include "PerlinNoise.h"
+#include "NoiseBatch.h"
 #include <math.h>
 
 using namespace RISE;
@@ -65,3 +66,65 @@ Scalar TurbulenceNoise3D::Evaluate( const Scalar x, const Scalar y, const Scalar
 	// Normalize to [0, 1] range
 	return total / dNormFactor;
 }
+
+namespace
+{
+	template< class T >
+	void TurbulenceBatch3D(
+		const IFunction3D& noise,
+		const int n,
+		const Scalar* pAmplitudesLUT,
+		const Scalar dNormFactor,
+		const T* x, const T* y, const T* z,
+		T* out,
+		const unsigned int count
+		)
+	{
+		T	px[NoiseBatch::kChunk];
+		T	py[NoiseBatch::kChunk];
+		T	pz[NoiseBatch::kChunk];
+		T	v[NoiseBatch::kChunk];
+
+		for( unsigned int start=0; start<count; start+=NoiseBatch::kChunk )
+		{
+			const unsigned int m = (count-start) < NoiseBatch::kChunk ? (count-start) : NoiseBatch::kChunk;
+			T* total = out + start;
+
+			for( unsigned int k=0; k<m; k++ ) {
+				total[k] = 0;
+			}
+
+			for( int i=0; i<n; i++ ) {
+				const T freq = T(frequency_lut[i]);
+				for( unsigned int k=0; k<m; k++ ) {
+					px[k] = x[start+k] * freq;
+					py[k] = y[start+k] * freq;
+					pz[k] = z[start+k] * freq;
+				}
+
+				NoiseBatch::Evaluate( noise, px, py, pz, v, m );
+
+				const T amp = T(pAmplitudesLUT[i]);
+				for( unsigned int k=0; k<m; k++ ) {
+					total[k] += fabs( v[k] ) * amp;
+				}
+			}
+
+			// Normalize to [0, 1] range
+			const T norm = T(dNormFactor);
+			for( unsigned int k=0; k<m; k++ ) {
+				total[k] = total[k] / norm;
+			}
+		}
+	}
+}
+
+void TurbulenceNoise3D::EvaluateBatch( const Scalar* x, const Scalar* y, const Scalar* z, Scalar* out, const unsigned int count ) const
+{
+	TurbulenceBatch3D<Scalar>( *noise, n, pAmplitudesLUT, dNormFactor, x, y, z, out, count );
+}
+
+void TurbulenceNoise3D::EvaluateBatchFloat( const float* x, const float* y, const float* z, float* out, const unsigned int count ) const
+{
+	TurbulenceBatch3D<float>( *noise, n, pAmplitudesLUT, dNormFactor, x, y, z, out, count );
+}
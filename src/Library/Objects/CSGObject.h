@@ -67,8 +67,8 @@ namespace RISE
 			IObjectPriv* GetOperandA() const { return pObjectA; }
 			IObjectPriv* GetOperandB() const { return pObjectB; }
 
-			IObjectPriv* CloneFull();
-			IObjectPriv* CloneGeometric();
+			IObjectPriv* CloneFull() override;
+			IObjectPriv* CloneGeometric() override;
 
 			//! feature/gui-snapshot-prototype: snapshot-clone AS a CSGObject.
 			//! The base Object::CloneSnapshot would slice a CSGObject to a
@@ -76,22 +76,23 @@ namespace RISE
 			//! overrides it to snapshot-clone the operation + BOTH operands
 			//! (recursively, via each operand's virtual CloneSnapshot) and
 			//! then copy the shared mutable state via CopySnapshotStateInto.
-			//! NOTE: deliberately NOT marked `override` to match this class's
-			//! existing no-`override` style — adding the keyword to one method
-			//! wakes -Winconsistent-missing-override on the 7 sibling virtuals.
-			Object* CloneSnapshot() const;
+			Object* CloneSnapshot() const override;
 
-			const BoundingBox getBoundingBox() const;
-			void IntersectRay( RayIntersection& ri, const Scalar dHowFar, const bool bHitFrontFaces, const bool bHitBackFaces, const bool bComputeExitInfo ) const;
-			bool IntersectRay_IntersectionOnly( const Ray& ray, const Scalar dHowFar, const bool bHitFrontFaces, const bool bHitBackFaces ) const;
+			const BoundingBox getBoundingBox() const override;
+			void IntersectRay( RayIntersection& ri, const Scalar dHowFar, const bool bHitFrontFaces, const bool bHitBackFaces, const bool bComputeExitInfo ) const override;
+			bool IntersectRay_IntersectionOnly( const Ray& ray, const Scalar dHowFar, const bool bHitFrontFaces, const bool bHitBackFaces ) const override;
 
-			void ResetRuntimeData() const;
+			void ResetRuntimeData() const override;
 
 			// Deferred-realization (IObject): the realize pass enumerates only
 			// world-VISIBLE objects, but AssignObjects() hides our two operands,
 			// so they are never reached directly.  Cascade into them here so a
 			// deferred geometry (e.g. displaced) used as a CSG operand is baked.
-			void Realize() const;
+			void Realize() const override;
+
+			// IntersectRay above works in the static frame only, so a
+			// moving CSG object is left to the single threaded path
+			bool SetMotion( const Scalar, const Scalar, const std::vector<Matrix4>& ) override { return false; }
 		};
 	}
 }
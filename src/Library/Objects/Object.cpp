@@ -34,7 +34,8 @@ Object::Object( ) :
   bCastsShadows( true ),
   bReceivesShadows( true ),
   SURFACE_INTERSEC_ERROR( 1e-12 ),
-  m_tangentFrameSign( 1.0 )
+  m_tangentFrameSign( 1.0 ),
+  m_pMotion( 0 )
 {
 }
 
@@ -51,7 +52,8 @@ Object::Object( const IGeometry* pGeometry_ ) :
   bCastsShadows( true ),
   bReceivesShadows( true ),
   SURFACE_INTERSEC_ERROR( 1e-12 ),
-  m_tangentFrameSign( 1.0 )
+  m_tangentFrameSign( 1.0 ),
+  m_pMotion( 0 )
 {
 	if( pGeometry ) {
 		pGeometry->addref();
@@ -69,6 +71,7 @@ Object::~Object( )
 	safe_release( pUVGenerator );
 	safe_release( pRadianceMap );
 	safe_release( pInteriorMedium );
+	ClearMotion();
 }
 
 IObjectPriv* Object::CloneFull()
@@ -352,6 +355,12 @@ const BoundingBox Object::getBoundingBox() const
 		return BoundingBox( Point3( 0, 0, 0 ), Point3( 0, 0, 0 ) );
 	}
 
+	// A moving object is placed in the top level BVH by the box of
+	// its whole motion
+	if( m_pMotion ) {
+		return m_pMotion->Bounds();
+	}
+
 	const BoundingBox bbox = pGeometry->GenerateBoundingBox();
 
 	// Transform all 8 corners of the local bbox and take the AABB of the
@@ -389,6 +398,22 @@ const BoundingBox Object::getBoundingBox() const
 	return BoundingBox( wll, wur );
 }
 
+bool Object::GetAnalyticShape( AnalyticShape& shape, Matrix4& mxWorldToObject ) const
+{
+	// A moving object's world-to-object matrix depends on the ray's
+	// time, so it has no single matrix to hand out
+	if( !pGeometry || m_pMotion ) {
+		return false;
+	}
+
+	if( !pGeometry->GetAnalyticShape( shape ) ) {
+		return false;
+	}
+
+	mxWorldToObject = m_mxInvFinalTrans;
+	return true;
+}
+
 void Object::IntersectRay( RayIntersection& ri, const Scalar dHowFar, const bool bHitFrontFaces, const bool bHitBackFaces, const bool bComputeExitInfo ) const
 {
 	// NULL-GEOMETRY GUARD (2026-07-31 fix round 2, audit pass): see
@@ -411,16 +436,48 @@ void Object::IntersectRay( RayIntersection& ri, const Scalar dHowFar, const bool
 		return;
 	}
 
+	// A moving object is intersected where it is at the ray's time,
+	// built from its motion keys, so the shared transforms are never
+	// touched by the render threads.  The frame is only built on this
+	// branch; static objects go straight to their own matrices
+	if( m_pMotion ) {
+		if( !m_pMotion->MayHit( ri.geometric.ray, dHowFar ) ) {
+			ri.geometric.bHit = false;
+			return;
+		}
+		ObjectMotion::Frame motionFrame;
+		m_pMotion->Evaluate( ri.geometric.ray.time, motionFrame );
+		IntersectRayWith( ri, dHowFar, bHitFrontFaces, bHitBackFaces, bComputeExitInfo,
+			motionFrame.mxFinalTrans, motionFrame.mxInvFinalTrans, motionFrame.mxInvTranspose, motionFrame.tangentFrameSign );
+		return;
+	}
+
+	IntersectRayWith( ri, dHowFar, bHitFrontFaces, bHitBackFaces, bComputeExitInfo,
+		m_mxFinalTrans, m_mxInvFinalTrans, m_mxInvTranspose, m_tangentFrameSign );
+}
+
+void Object::IntersectRayWith(
+	RayIntersection& ri,
+	const Scalar dHowFar,
+	const bool bHitFrontFaces,
+	const bool bHitBackFaces,
+	const bool bComputeExitInfo,
+	const Matrix4& mxFinalTrans,
+	const Matrix4& mxInvFinalTrans,
+	const Matrix4& mxInvTranspose,
+	const Scalar tangentFrameSign
+	) const
+{
 	// Bring the ray into our frame, first tuck away the original ray value
 	const Ray orig = ri.geometric.ray;
 
-	ri.geometric.ray.origin = Point3Ops::Transform( m_mxInvFinalTrans, orig.origin );
+	ri.geometric.ray.origin = Point3Ops::Transform( mxInvFinalTrans, orig.origin );
 
 	// Capture the UNNORMALIZED transformed direction's magnitude before
 	// normalizing it into the local-frame ray -- this is the direction-true
 	// world-to-local distance factor used below (P1 fix: was a +X-axis
 	// probe, see the `factor` comment further down).
-	const Vector3 dirLocalUnnorm = Vector3Ops::Transform( m_mxInvFinalTrans, orig.Dir() );
+	const Vector3 dirLocalUnnorm = Vector3Ops::Transform( mxInvFinalTrans, orig.Dir() );
 	const Scalar dirLocalMag = Vector3Ops::Magnitude( dirLocalUnnorm );
 	ri.geometric.ray.SetDir( Vector3Ops::Normalize( dirLocalUnnorm ) );
 
@@ -448,8 +505,8 @@ void Object::IntersectRay( RayIntersection& ri, const Scalar dHowFar, const bool
 	// SetDir() on the central ray cleared hasDifferentials, so re-set
 	// it after we've finished writing.
 	if( orig.hasDifferentials ) {
-		ri.geometric.ray.diffs.rxOrigin = Vector3Ops::Transform( m_mxInvFinalTrans, orig.diffs.rxOrigin );
-		ri.geometric.ray.diffs.ryOrigin = Vector3Ops::Transform( m_mxInvFinalTrans, orig.diffs.ryOrigin );
+		ri.geometric.ray.diffs.rxOrigin = Vector3Ops::Transform( mxInvFinalTrans, orig.diffs.rxOrigin );
+		ri.geometric.ray.diffs.ryOrigin = Vector3Ops::Transform( mxInvFinalTrans, orig.diffs.ryOrigin );
 
 		const Vector3 d_world = orig.Dir();
 		const Vector3 aux_x_world( d_world.x + orig.diffs.rxDir.x,
@@ -458,8 +515,8 @@ void Object::IntersectRay( RayIntersection& ri, const Scalar dHowFar, const bool
 		const Vector3 aux_y_world( d_world.x + orig.diffs.ryDir.x,
 		                           d_world.y + orig.diffs.ryDir.y,
 		                           d_world.z + orig.diffs.ryDir.z );
-		const Vector3 aux_x_obj = Vector3Ops::Normalize( Vector3Ops::Transform( m_mxInvFinalTrans, aux_x_world ) );
-		const Vector3 aux_y_obj = Vector3Ops::Normalize( Vector3Ops::Transform( m_mxInvFinalTrans, aux_y_world ) );
+		const Vector3 aux_x_obj = Vector3Ops::Normalize( Vector3Ops::Transform( mxInvFinalTrans, aux_x_world ) );
+		const Vector3 aux_y_obj = Vector3Ops::Normalize( Vector3Ops::Transform( mxInvFinalTrans, aux_y_world ) );
 		const Vector3 d_obj     = ri.geometric.ray.Dir();
 		ri.geometric.ray.diffs.rxDir = Vector3( aux_x_obj.x - d_obj.x, aux_x_obj.y - d_obj.y, aux_x_obj.z - d_obj.z );
 		ri.geometric.ray.diffs.ryDir = Vector3( aux_y_obj.x - d_obj.x, aux_y_obj.y - d_obj.y, aux_y_obj.z - d_obj.z );
@@ -540,12 +597,12 @@ void Object::IntersectRay( RayIntersection& ri, const Scalar dHowFar, const bool
 		}
 
 		// Transform the normals back
-		ri.geometric.vNormal = Vector3Ops::Normalize( Vector3Ops::Transform( m_mxInvTranspose, ri.geometric.vNormal ));
+		ri.geometric.vNormal = Vector3Ops::Normalize( Vector3Ops::Transform( mxInvTranspose, ri.geometric.vNormal ));
 		// Geometric normal transforms identically (it's also a normal vector,
 		// just describing the actual face orientation rather than the shading
 		// approximation).  Renormalize because non-uniform scales can otherwise
 		// leave it un-unit.
-		ri.geometric.vGeomNormal = Vector3Ops::Normalize( Vector3Ops::Transform( m_mxInvTranspose, ri.geometric.vGeomNormal ));
+		ri.geometric.vGeomNormal = Vector3Ops::Normalize( Vector3Ops::Transform( mxInvTranspose, ri.geometric.vGeomNormal ));
 		// Shading ONB.  By default the tangent (u-axis) is whatever
 		// CreateFromW picks from a canonical axis -- fine for isotropic
 		// materials, but an arbitrary base for anisotropic GGX.  A
@@ -587,8 +644,8 @@ void Object::IntersectRay( RayIntersection& ri, const Scalar dHowFar, const bool
 		// mesh shades correctly under mirrored instancing.
 		if( ri.geometric.bHasTangent ) {
 			ri.geometric.vTangent = Vector3Ops::Normalize(
-				Vector3Ops::Transform( m_mxFinalTrans, ri.geometric.vTangent ) );
-			ri.geometric.bitangentSign *= m_tangentFrameSign;
+				Vector3Ops::Transform( mxFinalTrans, ri.geometric.vTangent ) );
+			ri.geometric.bitangentSign *= tangentFrameSign;
 		}
 
 		// Transform surface derivatives from object space to world space.
@@ -598,27 +655,27 @@ void Object::IntersectRay( RayIntersection& ri, const Scalar dHowFar, const bool
 		// order) — transform like normals (inverse-transpose).
 		if( ri.geometric.derivatives.valid ) {
 			ri.geometric.derivatives.dpdu = Vector3Ops::Transform(
-				m_mxFinalTrans, ri.geometric.derivatives.dpdu );
+				mxFinalTrans, ri.geometric.derivatives.dpdu );
 			ri.geometric.derivatives.dpdv = Vector3Ops::Transform(
-				m_mxFinalTrans, ri.geometric.derivatives.dpdv );
+				mxFinalTrans, ri.geometric.derivatives.dpdv );
 			ri.geometric.derivatives.dndu = Vector3Ops::Transform(
-				m_mxInvTranspose, ri.geometric.derivatives.dndu );
+				mxInvTranspose, ri.geometric.derivatives.dndu );
 			ri.geometric.derivatives.dndv = Vector3Ops::Transform(
-				m_mxInvTranspose, ri.geometric.derivatives.dndv );
+				mxInvTranspose, ri.geometric.derivatives.dndv );
 		}
 
 		// Wireframe view-mode closest-edge point transforms like a
 		// position (forward transform) -- exactly as ptIntersection.
 		if( ri.geometric.bHasWireEdgeInfo ) {
 			ri.geometric.ptWireNearestEdge = Point3Ops::Transform(
-				m_mxFinalTrans, ri.geometric.ptWireNearestEdge );
+				mxFinalTrans, ri.geometric.ptWireNearestEdge );
 		}
 
 		if( bComputeExitInfo ) {
-			ri.geometric.vNormal2 = Vector3Ops::Normalize( Vector3Ops::Transform( m_mxInvTranspose, ri.geometric.vNormal2 ) );
-			ri.geometric.vGeomNormal2 = Vector3Ops::Normalize( Vector3Ops::Transform( m_mxInvTranspose, ri.geometric.vGeomNormal2 ) );
+			ri.geometric.vNormal2 = Vector3Ops::Normalize( Vector3Ops::Transform( mxInvTranspose, ri.geometric.vNormal2 ) );
+			ri.geometric.vGeomNormal2 = Vector3Ops::Normalize( Vector3Ops::Transform( mxInvTranspose, ri.geometric.vGeomNormal2 ) );
 			ri.geometric.ptObjExit = ri.geometric.ray.PointAtLength( ri.geometric.range2 + SURFACE_INTERSEC_ERROR );
-			ri.geometric.ptExit = Point3Ops::Transform( m_mxFinalTrans, ri.geometric.ptObjExit );
+			ri.geometric.ptExit = Point3Ops::Transform( mxFinalTrans, ri.geometric.ptObjExit );
 
 			if( ri.geometric.range2 != 0 ) {
 				ri.geometric.range2 = Vector3Ops::Magnitude( Vector3Ops::mkVector3( ri.geometric.ptExit, orig.origin ) );
@@ -639,7 +696,7 @@ void Object::IntersectRay( RayIntersection& ri, const Scalar dHowFar, const bool
 
 		// Compute the intersection in world space
 		ri.geometric.ptObjIntersec = ri.geometric.ray.PointAtLength( ri.geometric.range - SURFACE_INTERSEC_ERROR );
-		ri.geometric.ptIntersection = Point3Ops::Transform( m_mxFinalTrans, ri.geometric.ptObjIntersec );
+		ri.geometric.ptIntersection = Point3Ops::Transform( mxFinalTrans, ri.geometric.ptObjIntersec );
 		ri.geometric.range = Vector3Ops::Magnitude( Vector3Ops::mkVector3( ri.geometric.ptIntersection, orig.origin ) );
 
 		ri.pObject = this;
@@ -661,16 +718,37 @@ bool Object::IntersectRay_IntersectionOnly( const Ray& ray, const Scalar dHowFar
 		return false;
 	}
 
+	// At the ray's time for a moving object, see IntersectRay
+	if( m_pMotion ) {
+		if( !m_pMotion->MayHit( ray, dHowFar ) ) {
+			return false;
+		}
+		ObjectMotion::Frame motionFrame;
+		m_pMotion->Evaluate( ray.time, motionFrame );
+		return IntersectRayWith_IntersectionOnly( ray, dHowFar, bHitFrontFaces, bHitBackFaces, motionFrame.mxInvFinalTrans );
+	}
+
+	return IntersectRayWith_IntersectionOnly( ray, dHowFar, bHitFrontFaces, bHitBackFaces, m_mxInvFinalTrans );
+}
+
+bool Object::IntersectRayWith_IntersectionOnly(
+	const Ray& ray,
+	const Scalar dHowFar,
+	const bool bHitFrontFaces,
+	const bool bHitBackFaces,
+	const Matrix4& mxInvFinalTrans
+	) const
+{
 	// Bring the ray into our frame, but use our own copy
 	Ray		orig = ray;
 
-	orig.origin = Point3Ops::Transform( m_mxInvFinalTrans, ray.origin );
+	orig.origin = Point3Ops::Transform( mxInvFinalTrans, ray.origin );
 
 	// Capture the UNNORMALIZED transformed direction's magnitude before
 	// normalizing it into the local-frame ray -- the direction-true
 	// world-to-local distance factor used below (P1 fix, mirrors
 	// Object::IntersectRay above).
-	const Vector3 dirLocalUnnorm = Vector3Ops::Transform( m_mxInvFinalTrans, ray.Dir() );
+	const Vector3 dirLocalUnnorm = Vector3Ops::Transform( mxInvFinalTrans, ray.Dir() );
 	const Scalar dirLocalMag = Vector3Ops::Magnitude( dirLocalUnnorm );
 	orig.SetDir( Vector3Ops::Normalize( dirLocalUnnorm ) );
 
@@ -821,6 +899,31 @@ void Object::ResetRuntimeData() const
 	}
 }
 
+bool Object::SetMotion(
+	const Scalar timeOpen,
+	const Scalar timeClose,
+	const std::vector<Matrix4>& keys
+	)
+{
+	if( !pGeometry || keys.empty() ) {
+		return false;
+	}
+
+	ClearMotion();
+	m_pMotion = new ObjectMotion( timeOpen, timeClose, keys, pGeometry->GenerateBoundingBox() );
+	GlobalLog()->PrintNew( m_pMotion, __FILE__, __LINE__, "object motion" );
+	return true;
+}
+
+void Object::ClearMotion()
+{
+	if( m_pMotion ) {
+		GlobalLog()->PrintDelete( m_pMotion, __FILE__, __LINE__ );
+		delete m_pMotion;
+		m_pMotion = 0;
+	}
+}
+
 void Object::FinalizeTransformations( )
 {
 	Transformable::FinalizeTransformations();
@@ -21,6 +21,7 @@
 #include "../Interfaces/IMaterial.h"
 #include "../Interfaces/IRayIntersectionModifier.h"
 #include "../Utilities/Transformable.h"
+#include "ObjectMotion.h"
 #include "../Utilities/RString.h"
 #include "../Utilities/Reference.h"
 
@@ -60,6 +61,35 @@ namespace RISE
 			//! mirrored object instances of the same source mesh.
 			Scalar											m_tangentFrameSign;
 
+			//! Transform keys over the shutter of the frame being
+			//! rendered, or null when the object is static.  Set and
+			//! cleared by the rasterizer around a motion blurred frame;
+			//! never cloned.
+			ObjectMotion*									m_pMotion;
+
+			//! Body of IntersectRay with the transforms to place the
+			//! object by, either the static ones or a motion frame
+			void IntersectRayWith(
+				RayIntersection& ri,
+				const Scalar dHowFar,
+				const bool bHitFrontFaces,
+				const bool bHitBackFaces,
+				const bool bComputeExitInfo,
+				const Matrix4& mxFinalTrans,
+				const Matrix4& mxInvFinalTrans,
+				const Matrix4& mxInvTranspose,
+				const Scalar tangentFrameSign
+				) const;
+
+			//! Body of IntersectRay_IntersectionOnly, see IntersectRayWith
+			bool IntersectRayWith_IntersectionOnly(
+				const Ray& ray,
+				const Scalar dHowFar,
+				const bool bHitFrontFaces,
+				const bool bHitBackFaces,
+				const Matrix4& mxInvFinalTrans
+				) const;
+
 			virtual ~Object( );
 
 			//! Copies this object's mutable snapshot state into `dst` (a
@@ -130,6 +160,8 @@ namespace RISE
 			virtual void ClearModifier() override;
 			virtual void ClearRadianceMap() override;
 
+			virtual bool GetAnalyticShape( AnalyticShape& shape, Matrix4& mxWorldToObject ) const override;
+
 			virtual void IntersectRay( RayIntersection& ri, const Scalar dHowFar, const bool bHitFrontFaces, const bool bHitBackFaces, const bool bComputeExitInfo ) const override;
 			virtual bool IntersectRay_IntersectionOnly( const Ray& ray, const Scalar dHowFar, const bool bHitFrontFaces, const bool bHitBackFaces ) const override;
 
@@ -172,6 +204,22 @@ namespace RISE
 			virtual void ResetRuntimeData() const override;
 
 			void FinalizeTransformations( ) override;
+
+			//! Makes the object move over [timeOpen, timeClose]: rays are
+			//! intersected against the keys at their own Ray::time and
+			//! getBoundingBox covers the whole motion.  The caller must
+			//! rebuild the object manager's spatial structure after.
+			//! Returns false if this kind of object cannot move this way.
+			virtual bool SetMotion(
+				const Scalar timeOpen,
+				const Scalar timeClose,
+				const std::vector<Matrix4>& keys				///< [in] Final transforms at evenly spaced times, first at timeOpen, last at timeClose
+				);
+
+			//! Back to the static transform
+			void ClearMotion();
+
+			bool HasMotion() const { return m_pMotion != 0; }
 		};
 	}
 }
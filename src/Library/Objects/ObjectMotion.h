@@ -0,0 +1,182 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  ObjectMotion.h - Transform keys of an object across a camera
+//    shutter interval, so a motion blurred frame can be traced by many
+//    threads at once without re-evaluating the animator per sample.
+//
+//    The keys are the object's final transform sampled by the animator
+//    at evenly spaced times over [timeOpen, timeClose].  Between two
+//    keys the matrix is interpolated linearly, the same linear motion
+//    model Embree uses for its matrix motion.  Enough keys keep a
+//    rotation close to its keyframed path; the rasterizer picks the
+//    count.
+//
+//    Each key also carries the world box of the object at that key.
+//    Every corner of the local box moves linearly between two keys,
+//    so the lerp of the two key boxes bounds the object at any time
+//    in between, and the union of all key boxes bounds the whole
+//    motion.  The first is used to reject a ray before its transform
+//    is built, the second is what the top level BVH is built from.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//  Comments:
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#ifndef OBJECT_MOTION_
+#define OBJECT_MOTION_
+
+#include "../Utilities/Math3D/Math3D.h"
+#include "../Utilities/BoundingBox.h"
+#include "../Utilities/Ray.h"
+#include <vector>
+
+namespace RISE
+{
+	namespace Implementation
+	{
+		class ObjectMotion
+		{
+		public:
+			//! Transforms of the object at one instant
+			struct Frame
+			{
+				Matrix4		mxFinalTrans;
+				Matrix4		mxInvFinalTrans;
+				Matrix4		mxInvTranspose;
+				Scalar		tangentFrameSign;	///< As Object::m_tangentFrameSign
+			};
+
+		protected:
+			Scalar						timeOpen;
+			Scalar						timeClose;
+			std::vector<Matrix4>		keys;
+			std::vector<BoundingBox>	boxes;
+			BoundingBox					bounds;
+
+			//! Finds the segment holding time t and the blend weight within it
+			void Locate( const Scalar t, unsigned int& seg, Scalar& w ) const
+			{
+				const unsigned int segments = static_cast<unsigned int>( keys.size() ) - 1;
+				const Scalar span = timeClose - timeOpen;
+				Scalar u = span > 0 ? (t - timeOpen) / span * Scalar( segments ) : 0;
+				if( u < 0 ) u = 0;
+				if( u > Scalar( segments ) ) u = Scalar( segments );
+
+				seg = static_cast<unsigned int>( u );
+				if( seg >= segments ) {
+					seg = segments - 1;
+				}
+				w = u - Scalar( seg );
+			}
+
+			static Scalar Lerp( const Scalar a, const Scalar b, const Scalar w )
+			{
+				return a + (b - a) * w;
+			}
+
+		public:
+			//! \param keys_ Final transforms at evenly spaced times from
+			//! timeOpen to timeClose, at least two
+			//! \param localBox The object's box in its own frame
+			ObjectMotion(
+				const Scalar timeOpen_,
+				const Scalar timeClose_,
+				const std::vector<Matrix4>& keys_,
+				const BoundingBox& localBox
+				) :
+			timeOpen( timeOpen_ ),
+			timeClose( timeClose_ ),
+			keys( keys_ ),
+			bounds( Point3( RISE_INFINITY, RISE_INFINITY, RISE_INFINITY ), Point3( -RISE_INFINITY, -RISE_INFINITY, -RISE_INFINITY ) )
+			{
+				if( keys.size() == 1 ) {
+					keys.push_back( keys[0] );
+				}
+
+				const Point3 corners[8] = {
+					Point3( localBox.ll.x, localBox.ll.y, localBox.ll.z ),
+					Point3( localBox.ur.x, localBox.ll.y, localBox.ll.z ),
+					Point3( localBox.ll.x, localBox.ur.y, localBox.ll.z ),
+					Point3( localBox.ur.x, localBox.ur.y, localBox.ll.z ),
+					Point3( localBox.ll.x, localBox.ll.y, localBox.ur.z ),
+					Point3( localBox.ur.x, localBox.ll.y, localBox.ur.z ),
+					Point3( localBox.ll.x, localBox.ur.y, localBox.ur.z ),
+					Point3( localBox.ur.x, localBox.ur.y, localBox.ur.z )
+				};
+
+				boxes.reserve( keys.size() );
+				for( size_t k = 0; k < keys.size(); k++ ) {
+					const Point3 first = Point3Ops::Transform( keys[k], corners[0] );
+					BoundingBox box( first, first );
+					for( unsigned int i = 1; i < 8; i++ ) {
+						box.Include( Point3Ops::Transform( keys[k], corners[i] ) );
+					}
+					boxes.push_back( box );
+					bounds.Include( box );
+				}
+			}
+
+			Scalar TimeOpen() const { return timeOpen; }
+			Scalar TimeClose() const { return timeClose; }
+			unsigned int NumKeys() const { return static_cast<unsigned int>( keys.size() ); }
+
+			//! Box holding the object at every time in the interval
+			const BoundingBox& Bounds() const { return bounds; }
+
+			//! Box holding the object at time t
+			BoundingBox BoundsAt( const Scalar t ) const
+			{
+				unsigned int seg;
+				Scalar w;
+				Locate( t, seg, w );
+				const BoundingBox& a = boxes[seg];
+				const BoundingBox& b = boxes[seg+1];
+				return BoundingBox(
+					Point3( Lerp( a.ll.x, b.ll.x, w ), Lerp( a.ll.y, b.ll.y, w ), Lerp( a.ll.z, b.ll.z, w ) ),
+					Point3( Lerp( a.ur.x, b.ur.x, w ), Lerp( a.ur.y, b.ur.y, w ), Lerp( a.ur.z, b.ur.z, w ) ) );
+			}
+
+			//! Slab test of the ray against the box at the ray's time,
+			//! within [0, dHowFar]
+			bool MayHit( const Ray& ray, const Scalar dHowFar ) const
+			{
+				const BoundingBox box = BoundsAt( ray.time );
+				Scalar t0 = 0, t1 = dHowFar;
+				for( unsigned int a = 0; a < 3; a++ ) {
+					const Scalar tNear = (box.ll[a] - ray.origin[a]) * ray.invDir[a];
+					const Scalar tFar  = (box.ur[a] - ray.origin[a]) * ray.invDir[a];
+					t0 = r_max( t0, r_min( tNear, tFar ) );
+					t1 = r_min( t1, r_max( tNear, tFar ) );
+				}
+				return t0 <= t1;
+			}
+
+			//! Builds the object's transforms at time t
+			void Evaluate( const Scalar t, Frame& f ) const
+			{
+				unsigned int seg;
+				Scalar w;
+				Locate( t, seg, w );
+				const Matrix4& a = keys[seg];
+				const Matrix4& b = keys[seg+1];
+
+				Matrix4& m = f.mxFinalTrans;
+				m._00 = Lerp( a._00, b._00, w );	m._01 = Lerp( a._01, b._01, w );	m._02 = Lerp( a._02, b._02, w );	m._03 = Lerp( a._03, b._03, w );
+				m._10 = Lerp( a._10, b._10, w );	m._11 = Lerp( a._11, b._11, w );	m._12 = Lerp( a._12, b._12, w );	m._13 = Lerp( a._13, b._13, w );
+				m._20 = Lerp( a._20, b._20, w );	m._21 = Lerp( a._21, b._21, w );	m._22 = Lerp( a._22, b._22, w );	m._23 = Lerp( a._23, b._23, w );
+				m._30 = Lerp( a._30, b._30, w );	m._31 = Lerp( a._31, b._31, w );	m._32 = Lerp( a._32, b._32, w );	m._33 = Lerp( a._33, b._33, w );
+
+				f.mxInvFinalTrans = Matrix4Ops::Inverse( m );
+				f.mxInvTranspose = Matrix4Ops::Transpose( f.mxInvFinalTrans );
+				f.tangentFrameSign = Matrix4Ops::Determinant( m ) < 0 ? Scalar( -1 ) : Scalar( 1 );
+			}
+		};
+	}
+}
+
+#endif
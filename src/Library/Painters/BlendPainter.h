@@ -16,6 +16,7 @@
 #define BLEND_PAINTER_
 
 #include "Painter.h"
+#include "PainterProgram.h"
 
 namespace RISE
 {
@@ -66,6 +67,14 @@ namespace RISE
 				return (a.GetColorNM(ri,nm)*dmask + b.GetColorNM(ri,nm)*(1.0-dmask));
 			}
 
+			int				CompileNode( PainterCompiler& compiler, const int coordSet ) const
+			{
+				const int ra = compiler.CompileChild( a, coordSet );
+				const int rb = compiler.CompileChild( b, coordSet );
+				const int rmask = compiler.CompileChild( mask, coordSet );
+				return compiler.EmitBlend( ra, rb, rmask );
+			}
+
 			// Keyframable interface
 			IKeyframeParameter* KeyframeFromParameters( const String& name, const String& value ){ return 0;};
 			void SetIntermediateValue( const IKeyframeParameter& val ){};
@@ -38,6 +38,7 @@
 #define CHANNEL_PAINTER_
 
 #include "Painter.h"
+#include "PainterProgram.h"
 
 namespace RISE
 {
@@ -134,6 +135,15 @@ namespace RISE
 				return out;
 			}
 
+			int CompileNode( PainterCompiler& compiler, const int coordSet ) const
+			{
+				// CHAN_A reads GetAlpha, which the program does not carry;
+				// leave it on the virtual path
+				if( channel == CHAN_A ) return -1;
+				const int rsrc = compiler.CompileChild( source, coordSet );
+				return compiler.EmitChannel( rsrc, int( channel ), scale, bias );
+			}
+
 			// Keyframable interface
 			IKeyframeParameter* KeyframeFromParameters( const String& name, const String& value ) { (void)name; (void)value; return 0; };
 			void SetIntermediateValue( const IKeyframeParameter& val ) { (void)val; };
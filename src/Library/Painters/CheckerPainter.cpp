@@ -13,6 +13,7 @@
 
 #include "pch.h"
 #include "CheckerPainter.h"
+#include "PainterProgram.h"
 #include "../Animation/KeyframableHelper.h"
 
 using namespace RISE;
@@ -71,6 +72,13 @@ Scalar CheckerPainter::GetColorNM( const RayIntersectionGeometric& ri, const Sca
 	return ComputeWhich(ri).GetColorNM(ri, nm);
 }
 
+int CheckerPainter::CompileNode( PainterCompiler& compiler, const int coordSet ) const
+{
+	const int ra = compiler.CompileChild( a, coordSet );
+	const int rb = compiler.CompileChild( b, coordSet );
+	return compiler.EmitChecker( ra, rb, dSize, coordSet );
+}
+
 static const unsigned int SIZE_ID = 100;
 
 IKeyframeParameter* CheckerPainter::KeyframeFromParameters( const String& name, const String& value )
@@ -14,6 +14,7 @@
 
 #include "pch.h"
 #include "DomainWarp3DPainter.h"
+#include "PainterProgram.h"
 #include "../Utilities/SimpleInterpolators.h"
 #include "../Animation/KeyframableHelper.h"
 
@@ -75,6 +76,13 @@ Scalar DomainWarp3DPainter::GetColorNM( const RayIntersectionGeometric& ri, cons
 	return pInterp->InterpolateValues( a.GetColorNM(ri,nm), b.GetColorNM(ri,nm), d );
 }
 
+int DomainWarp3DPainter::CompileNode( PainterCompiler& compiler, const int coordSet ) const
+{
+	const int ra = compiler.CompileChild( a, coordSet );
+	const int rb = compiler.CompileChild( b, coordSet );
+	return compiler.EmitNoiseBlend( *pFunc, vScale, vShift, PainterProgram::eRemap_None, ra, rb );
+}
+
 
 static const unsigned int SCALE_ID = 100;
 static const unsigned int SHIFT_ID = 101;
@@ -12,6 +12,7 @@
 
 #include "pch.h"
 #include "Gabor3DPainter.h"
+#include "PainterProgram.h"
 #include "../Utilities/SimpleInterpolators.h"
 #include "../Animation/KeyframableHelper.h"
 
@@ -73,6 +74,13 @@ Scalar Gabor3DPainter::GetColorNM( const RayIntersectionGeometric& ri, const Sca
 	return pInterp->InterpolateValues( a.GetColorNM(ri,nm), b.GetColorNM(ri,nm), d );
 }
 
+int Gabor3DPainter::CompileNode( PainterCompiler& compiler, const int coordSet ) const
+{
+	const int ra = compiler.CompileChild( a, coordSet );
+	const int rb = compiler.CompileChild( b, coordSet );
+	return compiler.EmitNoiseBlend( *pFunc, vScale, vShift, PainterProgram::eRemap_None, ra, rb );
+}
+
 
 static const unsigned int SCALE_ID = 100;
 static const unsigned int SHIFT_ID = 101;
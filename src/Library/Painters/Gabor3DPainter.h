@@ -56,6 +56,7 @@ namespace RISE
 
 			RISEPel							GetColor( const RayIntersectionGeometric& ri  ) const;
 			Scalar							GetColorNM( const RayIntersectionGeometric& ri, const Scalar nm ) const;
+			int								CompileNode( PainterCompiler& compiler, const int coordSet ) const;
 
 			IKeyframeParameter* KeyframeFromParameters( const String& name, const String& value );
 			void SetIntermediateValue( const IKeyframeParameter& val );
@@ -47,3 +47,8 @@ Scalar Painter::Evaluate( const Scalar x, const Scalar y ) const
 
 	return c[0];
 }
+
+int Painter::CompileNode( PainterCompiler&, const int ) const
+{
+	return -1;
+}
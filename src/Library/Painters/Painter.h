@@ -22,6 +22,8 @@ namespace RISE
 {
 	namespace Implementation
 	{
+		class PainterCompiler;
+
 		// Painter is the concrete base for in-tree painters.  It also acts as
 		// an Observable subject — painters whose state changes per keyframe
 		// (e.g. GerstnerWavePainter's `time`) call NotifyObservers() so that
@@ -43,6 +45,12 @@ namespace RISE
 
 			// For the Function2D interface
 			virtual Scalar			Evaluate( const Scalar x, const Scalar y ) const;
+
+			// Emits this painter into a flattened PainterProgram (see
+			// PainterProgram.h) and returns its register, compiling children
+			// through compiler.CompileChild.  The default returns -1: no
+			// compiled form, so the compiler falls back to calling GetColor.
+			virtual int				CompileNode( PainterCompiler& compiler, const int coordSet ) const;
 		};
 	}
 }
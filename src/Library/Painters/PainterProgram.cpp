@@ -0,0 +1,392 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  PainterProgram.cpp - Implementation of the painter DAG compiler
+//  and its batched evaluator
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//  Comments:
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "PainterProgram.h"
+#include "Painter.h"
+#include <math.h>
+
+using namespace RISE;
+using namespace RISE::Implementation;
+
+PainterProgram::PainterProgram() :
+  m_numRegs( 0 ),
+  m_numCoordSets( 1 ),
+  m_root( -1 )
+{
+}
+
+PainterProgram::~PainterProgram()
+{
+	Clear();
+}
+
+void PainterProgram::Clear()
+{
+	for( size_t i = 0; i < m_refs.size(); i++ ) {
+		m_refs[i]->release();
+	}
+	m_refs.clear();
+	m_code.clear();
+	m_numRegs = 0;
+	m_numCoordSets = 1;
+	m_root = -1;
+}
+
+unsigned int PainterProgram::NumVirtualFallbacks() const
+{
+	unsigned int n = 0;
+	for( size_t i = 0; i < m_code.size(); i++ ) {
+		if( m_code[i].op == kVirtual ) {
+			n++;
+		}
+	}
+	return n;
+}
+
+void PainterProgram::EvaluateBatch(
+	const RayIntersectionGeometric* ri,
+	const unsigned int count,
+	RISEPel* out
+	) const
+{
+	Workspace ws;
+	EvaluateBatch( ri, count, out, ws );
+}
+
+void PainterProgram::EvaluateBatch(
+	const RayIntersectionGeometric* ri,
+	const unsigned int count,
+	RISEPel* out,
+	Workspace& ws
+	) const
+{
+	if( m_root < 0 ) {
+		for( unsigned int i = 0; i < count; i++ ) {
+			out[i] = RISEPel( 0, 0, 0 );
+		}
+		return;
+	}
+
+	ws.regs.resize( size_t(m_numRegs) * kBatchSize );
+	ws.coords.resize( size_t(m_numCoordSets) * kBatchSize );
+	ws.values.resize( kBatchSize );
+	ws.px.resize( kBatchSize );
+	ws.py.resize( kBatchSize );
+	ws.pz.resize( kBatchSize );
+
+	for( unsigned int start = 0; start < count; start += kBatchSize )
+	{
+		const unsigned int n = (count - start) < kBatchSize ? (count - start) : kBatchSize;
+		const RayIntersectionGeometric* chunk = ri + start;
+
+		// Coordinate set 0 is the hit's own texture coordinate
+		for( unsigned int i = 0; i < n; i++ ) {
+			ws.coords[i] = chunk[i].ptCoord;
+		}
+
+		for( size_t k = 0; k < m_code.size(); k++ ) {
+			Run( m_code[k], chunk, n, ws );
+		}
+
+		const RISEPel* root = &ws.regs[ size_t(m_root) * kBatchSize ];
+		for( unsigned int i = 0; i < n; i++ ) {
+			out[start + i] = root[i];
+		}
+	}
+}
+
+void PainterProgram::Run(
+	const Instr& in,
+	const RayIntersectionGeometric* ri,
+	const unsigned int n,
+	Workspace& ws
+	) const
+{
+	RISEPel* dst = (in.op == kUVTransform) ? 0 : &ws.regs[ size_t(in.dst) * kBatchSize ];
+	const RISEPel* A = in.a >= 0 ? &ws.regs[ size_t(in.a) * kBatchSize ] : 0;
+	const RISEPel* B = in.b >= 0 ? &ws.regs[ size_t(in.b) * kBatchSize ] : 0;
+	const RISEPel* C = in.c >= 0 ? &ws.regs[ size_t(in.c) * kBatchSize ] : 0;
+	const Point2* uv = &ws.coords[ size_t(in.coord) * kBatchSize ];
+
+	switch( in.op )
+	{
+	case kConst:
+		for( unsigned int i = 0; i < n; i++ ) {
+			dst[i] = in.constant;
+		}
+		break;
+
+	case kVirtual:
+		if( in.coord == 0 ) {
+			for( unsigned int i = 0; i < n; i++ ) {
+				dst[i] = in.painter->GetColor( ri[i] );
+			}
+		} else {
+			// The painter sits under a uv transform: hand it a copy of the
+			// hit with the transformed coordinate, as UVTransformPainter does
+			for( unsigned int i = 0; i < n; i++ ) {
+				RayIntersectionGeometric ri2 = ri[i];
+				ri2.ptCoord = uv[i];
+				dst[i] = in.painter->GetColor( ri2 );
+			}
+		}
+		break;
+
+	case kBlend:
+		for( unsigned int i = 0; i < n; i++ ) {
+			dst[i] = A[i]*C[i] + B[i]*(RISEPel(1.0,1.0,1.0)-C[i]);
+		}
+		break;
+
+	case kChecker:
+		{
+			const Scalar dSize = in.param[0];
+			for( unsigned int i = 0; i < n; i++ ) {
+				// Same parity rule as CheckerPainter::ComputeWhich
+				const int xquot = int( ceil( uv[i].x / dSize ) );
+				const int yquot = int( ceil( uv[i].y / dSize ) );
+				const bool bXIsEven = ((xquot & 1) == 0);
+				const bool bYIsEven = ((yquot & 1) == 0);
+				dst[i] = (bXIsEven == bYIsEven) ? A[i] : B[i];
+			}
+		}
+		break;
+
+	case kNoiseBlend:
+		{
+			// Noise first, for the whole batch, then the blend -- the noise
+			// function gets every point at once through its batched path
+			Scalar* d = &ws.values[0];
+			for( unsigned int i = 0; i < n; i++ ) {
+				const Point3& p = ri[i].ptIntersection;
+				ws.px[i] = p.x*in.param[0]+in.param[3];
+				ws.py[i] = p.y*in.param[1]+in.param[4];
+				ws.pz[i] = p.z*in.param[2]+in.param[5];
+			}
+			in.noise->EvaluateBatch( &ws.px[0], &ws.py[0], &ws.pz[0], d, n );
+
+			switch( in.mode ) {
+			case eRemap_SignedToUnit:
+				for( unsigned int i = 0; i < n; i++ ) {
+					d[i] = (d[i]+1.0)/2.0;
+				}
+				break;
+			case eRemap_Clamp01:
+				for( unsigned int i = 0; i < n; i++ ) {
+					if( d[i] < 0.0 ) d[i] = 0.0;
+					if( d[i] > 1.0 ) d[i] = 1.0;
+				}
+				break;
+			default:
+				break;
+			}
+
+			// CosineInterpolator<RISEPel>, which every noise painter uses
+			for( unsigned int i = 0; i < n; i++ ) {
+				const Scalar ft = d[i] * PI;
+				const Scalar f = (1.0 - cos(ft)) * 0.5;
+				dst[i] = A[i]*(1.0-f) + B[i]*f;
+			}
+		}
+		break;
+
+	case kUVTransform:
+		{
+			Point2* uvOut = &ws.coords[ size_t(in.dst) * kBatchSize ];
+			for( unsigned int i = 0; i < n; i++ ) {
+				// Same operation order as UVTransformPainter::ApplyTransform
+				const Scalar su = in.param[0] * uv[i].x;
+				const Scalar sv = in.param[1] * uv[i].y;
+				uvOut[i] = Point2(
+					 in.param[2] * su + in.param[3] * sv + in.param[4],
+					-in.param[3] * su + in.param[2] * sv + in.param[5] );
+			}
+		}
+		break;
+
+	case kChannel:
+		{
+			const int chan = in.mode;
+			for( unsigned int i = 0; i < n; i++ ) {
+				const Scalar v = in.param[0] * A[i][chan] + in.param[1];
+				dst[i] = RISEPel( v, v, v );
+			}
+		}
+		break;
+	}
+}
+
+//////////////////////////////////////////////////////////
+// PainterCompiler
+//////////////////////////////////////////////////////////
+
+PainterCompiler::PainterCompiler() :
+  m_pOut( 0 )
+{
+}
+
+bool PainterCompiler::Compile( const IPainter& root, PainterProgram& out )
+{
+	out.Clear();
+	m_pOut = &out;
+	m_memo.clear();
+
+	out.m_root = CompileChild( root, 0 );
+
+	m_pOut = 0;
+	m_memo.clear();
+	return out.IsValid();
+}
+
+int PainterCompiler::CompileChild( const IPainter& painter, const int coordSet )
+{
+	const std::pair<const IPainter*,int> key( &painter, coordSet );
+	std::map< std::pair<const IPainter*,int>, int >::const_iterator it = m_memo.find( key );
+	if( it != m_memo.end() ) {
+		return it->second;
+	}
+
+	int reg = -1;
+	const Painter* pImpl = dynamic_cast<const Painter*>( &painter );
+	if( pImpl ) {
+		reg = pImpl->CompileNode( *this, coordSet );
+	}
+	if( reg < 0 ) {
+		reg = EmitVirtual( painter, coordSet );
+	}
+
+	m_memo[key] = reg;
+	return reg;
+}
+
+void PainterCompiler::Hold( const IReference& ref )
+{
+	ref.addref();
+	m_pOut->m_refs.push_back( &ref );
+}
+
+int PainterCompiler::Push( PainterProgram::Instr& in )
+{
+	if( in.op != PainterProgram::kUVTransform ) {
+		in.dst = m_pOut->m_numRegs++;
+	}
+	m_pOut->m_code.push_back( in );
+	return in.dst;
+}
+
+static PainterProgram::Instr BlankInstr( const PainterProgram::Op op )
+{
+	PainterProgram::Instr in;
+	in.op = op;
+	in.dst = -1;
+	in.a = in.b = in.c = -1;
+	in.coord = 0;
+	in.mode = 0;
+	in.constant = RISEPel( 0, 0, 0 );
+	for( int i = 0; i < 6; i++ ) {
+		in.param[i] = 0;
+	}
+	in.painter = 0;
+	in.noise = 0;
+	return in;
+}
+
+int PainterCompiler::EmitConst( const RISEPel& c )
+{
+	PainterProgram::Instr in = BlankInstr( PainterProgram::kConst );
+	in.constant = c;
+	return Push( in );
+}
+
+int PainterCompiler::EmitVirtual( const IPainter& painter, const int coordSet )
+{
+	Hold( painter );
+	PainterProgram::Instr in = BlankInstr( PainterProgram::kVirtual );
+	in.painter = &painter;
+	in.coord = coordSet;
+	return Push( in );
+}
+
+int PainterCompiler::EmitBlend( const int a, const int b, const int mask )
+{
+	PainterProgram::Instr in = BlankInstr( PainterProgram::kBlend );
+	in.a = a;
+	in.b = b;
+	in.c = mask;
+	return Push( in );
+}
+
+int PainterCompiler::EmitChecker( const int a, const int b, const Scalar size, const int coordSet )
+{
+	PainterProgram::Instr in = BlankInstr( PainterProgram::kChecker );
+	in.a = a;
+	in.b = b;
+	in.coord = coordSet;
+	in.param[0] = size;
+	return Push( in );
+}
+
+int PainterCompiler::EmitNoiseBlend(
+	const IFunction3D& noise,
+	const Vector3& scale,
+	const Vector3& shift,
+	const PainterProgram::NoiseRemap remap,
+	const int a,
+	const int b
+	)
+{
+	Hold( noise );
+	PainterProgram::Instr in = BlankInstr( PainterProgram::kNoiseBlend );
+	in.noise = &noise;
+	in.mode = remap;
+	in.a = a;
+	in.b = b;
+	in.param[0] = scale.x;
+	in.param[1] = scale.y;
+	in.param[2] = scale.z;
+	in.param[3] = shift.x;
+	in.param[4] = shift.y;
+	in.param[5] = shift.z;
+	return Push( in );
+}
+
+int PainterCompiler::EmitChannel( const int src, const int channel, const Scalar scale, const Scalar bias )
+{
+	PainterProgram::Instr in = BlankInstr( PainterProgram::kChannel );
+	in.a = src;
+	in.mode = channel;
+	in.param[0] = scale;
+	in.param[1] = bias;
+	return Push( in );
+}
+
+int PainterCompiler::EmitUVTransform(
+	const int coordSet,
+	const Scalar scaleU, const Scalar scaleV,
+	const Scalar cosR, const Scalar sinR,
+	const Scalar offsetU, const Scalar offsetV
+	)
+{
+	PainterProgram::Instr in = BlankInstr( PainterProgram::kUVTransform );
+	in.coord = coordSet;
+	in.dst = m_pOut->m_numCoordSets++;
+	in.param[0] = scaleU;
+	in.param[1] = scaleV;
+	in.param[2] = cosR;
+	in.param[3] = sinR;
+	in.param[4] = offsetU;
+	in.param[5] = offsetV;
+	return Push( in );
+}
@@ -14,6 +14,7 @@
 
 #include "pch.h"
 #include "Perlin3DPainter.h"
+#include "PainterProgram.h"
 #include "../Utilities/SimpleInterpolators.h"
 #include "../Animation/KeyframableHelper.h"
 
@@ -73,6 +74,13 @@ Scalar Perlin3DPainter::GetColorNM( const RayIntersectionGeometric& ri, const Sc
 	return pInterp->InterpolateValues( a.GetColorNM(ri,nm), b.GetColorNM(ri,nm), d );
 }
 
+int Perlin3DPainter::CompileNode( PainterCompiler& compiler, const int coordSet ) const
+{
+	const int ra = compiler.CompileChild( a, coordSet );
+	const int rb = compiler.CompileChild( b, coordSet );
+	return compiler.EmitNoiseBlend( *pFunc, vScale, vShift, PainterProgram::eRemap_SignedToUnit, ra, rb );
+}
+
 
 static const unsigned int SCALE_ID = 100;
 static const unsigned int SHIFT_ID = 101;
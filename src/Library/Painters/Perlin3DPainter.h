@@ -47,6 +47,7 @@ namespace RISE
 
 			RISEPel							GetColor( const RayIntersectionGeometric& ri  ) const;
 			Scalar							GetColorNM( const RayIntersectionGeometric& ri, const Scalar nm ) const;
+			int								CompileNode( PainterCompiler& compiler, const int coordSet ) const;
 
 			// Keyframable interface
 			IKeyframeParameter* KeyframeFromParameters( const String& name, const String& value );
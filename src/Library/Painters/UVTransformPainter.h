@@ -37,6 +37,7 @@
 #define UV_TRANSFORM_PAINTER_
 
 #include "Painter.h"
+#include "PainterProgram.h"
 #include <cmath>
 
 namespace RISE
@@ -135,6 +136,14 @@ namespace RISE
 				return source.GetAlpha( ri2 );
 			}
 
+			int CompileNode( PainterCompiler& compiler, const int coordSet ) const
+			{
+				if( isIdentity ) return compiler.CompileChild( source, coordSet );
+				const int uvSet = compiler.EmitUVTransform(
+					coordSet, scaleU, scaleV, cosR, sinR, offsetU, offsetV );
+				return compiler.CompileChild( source, uvSet );
+			}
+
 			// Keyframable interface
 			IKeyframeParameter* KeyframeFromParameters( const String& name, const String& value ) { (void)name; (void)value; return 0; };
 			void SetIntermediateValue( const IKeyframeParameter& val ) { (void)val; };
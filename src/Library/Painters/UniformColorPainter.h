@@ -19,6 +19,7 @@
 #define UNIFORM_COLOR_PAINTER_
 
 #include "Painter.h"
+#include "PainterProgram.h"
 #include "../Animation/KeyframableHelper.h"
 #include "../Utilities/Color/RGBSpectra.h"
 
@@ -99,6 +100,11 @@ namespace RISE
 				return sp;
 			}
 
+			int CompileNode( PainterCompiler& compiler, const int ) const
+			{
+				return compiler.EmitConst( C );
+			}
+
 			// Keyframable interface
 			IKeyframeParameter* KeyframeFromParameters( const String& name, const String& value )
 			{
@@ -710,6 +710,10 @@ bool AsciiCommandParser::ParseRasterize( String* tokens, unsigned int num_tokens
 
 	GlobalLog()->Print( eLog_Benign, buf );
 
+	// Same interval in one fixed-format line for tools/perf_ab.py and other
+	// scripts, which should not have to parse the human-readable form above
+	GlobalLog()->PrintEx( eLog_Benign, "RISE_PERF {\"phase\":\"rasterize\",\"ms\":%u}\n", t.getInterval() );
+
 	return bRet;
 }
 
@@ -798,6 +802,9 @@ bool AsciiCommandParser::ParseRasterizeAnimation( String* tokens, unsigned int n
 
 	GlobalLog()->Print( eLog_Benign, buf );
 
+	// Machine-readable twin of the line above, see ParseRasterize
+	GlobalLog()->PrintEx( eLog_Benign, "RISE_PERF {\"phase\":\"rasterize_animation\",\"ms\":%u}\n", t.getInterval() );
+
 	return bRet;
 }
 
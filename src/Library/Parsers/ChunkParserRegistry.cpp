@@ -5219,6 +5219,7 @@ namespace RISE
 					double emissive_intensity_scale        = bag.GetDouble( "emissive_intensity_scale",         1.0 );
 					double emissive_tint[3] = { 1.0, 1.0, 1.0 };
 					bag.GetVec3( "emissive_tint", emissive_tint );
+					unsigned int instance_array_threshold  = bag.GetUInt(   "instance_array_threshold",         256u );
 					if( lights_intensity_override > 0.0 ) {
 						GlobalLog()->PrintEx( eLog_Warning,
 							"gltf_import:: `lights_intensity_override` is unit-blind (it conflates lux for "
@@ -5242,7 +5243,8 @@ namespace RISE
 						emissive_intensity_scale,
 						emissive_tint[0],
 						emissive_tint[1],
-						emissive_tint[2] );
+						emissive_tint[2],
+						instance_array_threshold );
 				}
 
 				const ChunkDescriptor& Describe() const override {
@@ -5305,6 +5307,7 @@ namespace RISE
 						{ auto& p = P(); p.name = "respect_baked_occlusion";       p.kind = ValueKind::Bool;   p.description = "Landing 13: when TRUE (default), import glTF `occlusionTexture` as a multiplier on the material's diffuse baseColor (× R-channel × occlusionStrength).  Recovers high-frequency baked AO that geometry can't reach (column flutes, brick mortar, fabric folds) but slightly double-counts the path tracer's own occlusion on direct light.  Set FALSE for strict-PB workflows where you want only the integrator's computed occlusion."; p.defaultValueHint = "TRUE"; }
 						{ auto& p = P(); p.name = "emissive_intensity_scale";      p.kind = ValueKind::Double; p.description = "Multiplier applied AFTER each material's authored `KHR_materials_emissive_strength` (or default 1.0).  Default 1.0 (no change).  Use to brighten ALL emissive surfaces in the import uniformly without editing the asset (e.g. a deep-dusk candle scene whose flame meshes are authored at daytime-balanced strength can multiply by 50-200 to make the candles dominate).  Unlike `lights_intensity_override` this is a SCALE (composes with authored values) -- emissive materials typically ship with meaningful chromatic / relative values whose ratios should be preserved.  Values <= 0 kill all emissive in the import.  Folded in once at import time, no per-sample cost."; p.defaultValueHint = "1.0"; }
 						{ auto& p = P(); p.name = "emissive_tint";                 p.kind = ValueKind::DoubleVec3; p.description = "Per-channel R G B multiplier applied componentwise to every material's `emissiveFactor`.  Default (1, 1, 1) -- no tint.  Use to recolour emissive surfaces uniformly across the import without editing the asset, e.g. tint a pure-yellow flame `(1, 1, 0)` to warm orange via `emissive_tint 1.0 0.5 0.1` (final emissive becomes `(1, 0.5, 0)`).  Composes with `emissive_intensity_scale` (independent brightness vs chroma knobs).  Multiplies the FACTOR not the painted texture, so an authored 0.0 channel stays 0.0 (the tint can attenuate channels but cannot add a colour the asset never authored)."; p.defaultValueHint = "1 1 1"; }
+						{ auto& p = P(); p.name = "instance_array_threshold";      p.kind = ValueKind::UInt;       p.description = "A mesh primitive placed by at least this many glTF nodes is imported as ONE instance array -- the shared geometry plus a packed transform per node under its own BVH -- placed by ONE object `<prefix>.obj.m<mesh>.p<prim>.instances`, instead of one object per node.  Cuts memory and load time on scatter-heavy assets (forests, crowds, candle packs).  The per-node objects then do not exist by name.  0 disables."; p.defaultValueHint = "256"; }
 						return cd;
 					}();
 					return d;
@@ -5430,12 +5433,11 @@ namespace RISE
 
 					std::string name = bag.GetString( "name",          "noname" );
 					std::string file = bag.GetString( "file",          "none" );
-					unsigned int maxPatches = bag.GetUInt( "maxpatches",    2 );
-					unsigned int maxRecur   = bag.GetUInt( "maxdepth",      8 );
-					bool bsp                = bag.GetBool( "bsp",           false );
 					bool center_object      = bag.GetBool( "center_object", false );
+					// Legacy maxpatches/maxdepth/bsp keys accepted but ignored —
+					// the patches are accelerated by a BVH now.
 
-					return pJob.AddBezierPatchGeometry( name.c_str(), file.c_str(), maxPatches, maxRecur, bsp, center_object );
+					return pJob.AddBezierPatchGeometry( name.c_str(), file.c_str(), center_object );
 				}
 
 				const ChunkDescriptor& Describe() const override {
@@ -5445,10 +5447,10 @@ namespace RISE
 						cd.description = "Bézier patch surface from file.";
 						auto P = [&cd]() -> ParameterDescriptor& { cd.parameters.emplace_back(); return cd.parameters.back(); };
 						{ auto& p = P(); p.name = "name";          p.kind = ValueKind::String;   p.description = "Unique name"; p.defaultValueHint = "noname"; }
-						{ auto& p = P(); p.name = "file";          p.kind = ValueKind::Filename; p.description = "Patch file"; }
-						{ auto& p = P(); p.name = "maxpatches";    p.kind = ValueKind::UInt;     p.description = "Max patches per BSP leaf"; p.defaultValueHint = "2"; }
-						{ auto& p = P(); p.name = "maxdepth";      p.kind = ValueKind::UInt;     p.description = "Max BSP depth"; p.defaultValueHint = "8"; }
-						{ auto& p = P(); p.name = "bsp";           p.kind = ValueKind::Bool;     p.description = "Build BSP"; p.defaultValueHint = "FALSE"; }
+						{ auto& p = P(); p.name = "file";          p.kind = ValueKind::Filename; p.description = "Patch file (text, or binary saved by the geometry)"; }
+						{ auto& p = P(); p.name = "maxpatches";    p.kind = ValueKind::UInt;     p.description = "Retired (BVH is sole accelerator)"; }
+						{ auto& p = P(); p.name = "maxdepth";      p.kind = ValueKind::UInt;     p.description = "Retired (BVH is sole accelerator)"; }
+						{ auto& p = P(); p.name = "bsp";           p.kind = ValueKind::Bool;     p.description = "Retired (BVH is sole accelerator)"; }
 						{ auto& p = P(); p.name = "center_object"; p.kind = ValueKind::Bool;     p.description = "Auto-center the mesh"; p.defaultValueHint = "FALSE"; }
 						// Retired parameters — accepted by the descriptor so we can
 						// emit a specific error in Finalize, then rejected.
@@ -5883,10 +5885,9 @@ namespace RISE
 				{
 					std::string name = bag.GetString( "name",        "noname" );
 					std::string file = bag.GetString( "file",        "none" );
-					unsigned int maxPoly  = bag.GetUInt( "maxpolygons", 10 );
-					unsigned int maxRecur = bag.GetUInt( "maxdepth",    8 );
-					bool bsp              = bag.GetBool( "bsp",         false );
-					return pJob.AddBilinearPatchGeometry( name.c_str(), file.c_str(), maxPoly, maxRecur, bsp );
+					// Legacy maxpolygons/maxdepth/bsp keys accepted but ignored —
+					// the patches are accelerated by a BVH now.
+					return pJob.AddBilinearPatchGeometry( name.c_str(), file.c_str() );
 				}
 
 				const ChunkDescriptor& Describe() const override {
@@ -5896,10 +5897,10 @@ namespace RISE
 						cd.description = "Bilinear patch surface from file.";
 						auto P = [&cd]() -> ParameterDescriptor& { cd.parameters.emplace_back(); return cd.parameters.back(); };
 						{ auto& p = P(); p.name = "name";        p.kind = ValueKind::String;   p.description = "Unique name"; p.defaultValueHint = "noname"; }
-						{ auto& p = P(); p.name = "file";        p.kind = ValueKind::Filename; p.description = "Patch file"; }
-						{ auto& p = P(); p.name = "maxpolygons"; p.kind = ValueKind::UInt;     p.description = "Max polygons per BSP leaf"; p.defaultValueHint = "10"; }
-						{ auto& p = P(); p.name = "maxdepth";    p.kind = ValueKind::UInt;     p.description = "Max BSP depth"; p.defaultValueHint = "8"; }
-						{ auto& p = P(); p.name = "bsp";         p.kind = ValueKind::Bool;     p.description = "Build BSP"; p.defaultValueHint = "FALSE"; }
+						{ auto& p = P(); p.name = "file";        p.kind = ValueKind::Filename; p.description = "Patch file (text, or binary saved by the geometry)"; }
+						{ auto& p = P(); p.name = "maxpolygons"; p.kind = ValueKind::UInt;     p.description = "Retired (BVH is sole accelerator)"; }
+						{ auto& p = P(); p.name = "maxdepth";    p.kind = ValueKind::UInt;     p.description = "Retired (BVH is sole accelerator)"; }
+						{ auto& p = P(); p.name = "bsp";         p.kind = ValueKind::Bool;     p.description = "Retired (BVH is sole accelerator)"; }
 						return cd;
 					}();
 					return d;
@@ -5918,6 +5919,9 @@ namespace RISE
 					bool double_sided         = bag.GetBool(   "double_sided",  false );
 					bool face_normals         = bag.GetBool(   "face_normals",  false );
 					bool seam_fold            = bag.GetBool(   "uv_seam_fold",  true );
+					bool lazy                 = bag.GetBool(   "lazy_tessellation", false );
+					unsigned int patch_subdivision = bag.GetUInt( "patch_subdivision", 8 );
+					unsigned int lazy_cache_triangles = bag.GetUInt( "lazy_cache_triangles", 1u<<20 );
 					// Legacy maxpolygons/maxdepth/bsp keys accepted but ignored (Tier A2).
 
 					if( base_geometry.empty() ) {
@@ -5933,7 +5937,10 @@ namespace RISE
 						disp_scale,
 						double_sided,
 						face_normals,
-						seam_fold );
+						seam_fold,
+						lazy,
+						patch_subdivision,
+						lazy_cache_triangles );
 				}
 
 				const ChunkDescriptor& Describe() const override {
@@ -5950,6 +5957,9 @@ namespace RISE
 						{ auto& p = P(); p.name = "double_sided";  p.kind = ValueKind::Bool;      p.description = "Render both sides"; p.defaultValueHint = "FALSE"; }
 						{ auto& p = P(); p.name = "face_normals";  p.kind = ValueKind::Bool;      p.description = "Flat per-face normals"; p.defaultValueHint = "FALSE"; }
 						{ auto& p = P(); p.name = "uv_seam_fold";  p.kind = ValueKind::Bool;     p.description = "Tent-fold UV before displacement -- keeps a wrapped field continuous across the u=0/u=1 seam of CLOSED surfaces (sphere/torus/cylinder).  FALSE for an OPEN field on a non-wrapping Cartesian UV (e.g. a guilloché expression on a flat disk)"; p.defaultValueHint = "TRUE"; }
+						{ auto& p = P(); p.name = "lazy_tessellation";    p.kind = ValueKind::Bool; p.description = "Tessellate the base only at `detail` and displace each coarse triangle into a micro-mesh on demand, when a ray first reaches it, keeping a bounded LRU of micro-meshes -- for displacement too detailed to bake whole (terrain, engraved dials)"; p.defaultValueHint = "FALSE"; }
+						{ auto& p = P(); p.name = "patch_subdivision";    p.kind = ValueKind::UInt; p.description = "Lazy mode: subdivisions per coarse patch edge (patch_subdivision^2 micro-triangles per patch)"; p.defaultValueHint = "8"; }
+						{ auto& p = P(); p.name = "lazy_cache_triangles"; p.kind = ValueKind::UInt; p.description = "Lazy mode: budget of resident micro-mesh triangles, shared by all render threads"; p.defaultValueHint = "1048576"; }
 						// Retired: accepted for backward compat with pre-A2 scene files; ignored.
 						{ auto& p = P(); p.name = "maxpolygons";   p.kind = ValueKind::UInt;      p.description = "Retired (BVH is sole accelerator)"; }
 						{ auto& p = P(); p.name = "maxdepth";      p.kind = ValueKind::UInt;      p.description = "Retired (BVH is sole accelerator)"; }
@@ -6276,6 +6286,8 @@ namespace RISE
 					bag.GetVec3( "bbox_min", bbox_min );
 					bag.GetVec3( "bbox_max", bbox_max );
 
+					const bool sparse = bag.GetBool( "sparse_volume", false );
+
 					if( volume_pattern.empty() || vol_width == 0 || vol_height == 0 ) {
 						GlobalLog()->PrintEasyError( "HeterogeneousMedium:: volume_pattern, volume_width, and volume_height are required" );
 						return false;
@@ -6289,7 +6301,7 @@ namespace RISE
 					return pJob.AddHeterogeneousMedium( name.c_str(),
 						max_sigma_a, max_sigma_s, emission, phase_type.c_str(), phase_g,
 						volume_pattern.c_str(), vol_width, vol_height, vol_startz, vol_endz,
-						accessor, bbox_min, bbox_max );
+						accessor, bbox_min, bbox_max, sparse );
 				}
 
 				const ChunkDescriptor& Describe() const override {
@@ -6311,6 +6323,7 @@ namespace RISE
 						{ auto& p = P(); p.name = "accessor";       p.kind = ValueKind::String;     p.description = "Voxel accessor type (first character: 'n', 't', or 'c')"; p.defaultValueHint = "t"; }
 						{ auto& p = P(); p.name = "bbox_min";       p.kind = ValueKind::DoubleVec3; p.description = "World-space bbox min"; }
 						{ auto& p = P(); p.name = "bbox_max";       p.kind = ValueKind::DoubleVec3; p.description = "World-space bbox max"; }
+						{ auto& p = P(); p.name = "sparse_volume";  p.kind = ValueKind::Bool;       p.description = "Store the volume as sparse 8^3 bricks: empty bricks take no memory and the majorant grid is built from brick maxima"; p.defaultValueHint = "false"; }
 						return cd;
 					}();
 					return d;
@@ -22,15 +22,16 @@ using namespace RISE::Implementation;
 		inline bool IsCompatibleWithQuery(
 			const Point3& ptPosition,
 			const Vector3& vNormal,
-			const RISE::IIrradianceCache::CacheElement& elem,
+			const Point3& elemPosition,
+			const Vector3& elemNormal,
 			const Scalar maxSpacing
 			)
 		{
-			if( Vector3Ops::Dot( vNormal, elem.vNormal ) < 0 ) {
+			if( Vector3Ops::Dot( vNormal, elemNormal ) < 0 ) {
 				const Scalar plane_epsilon = r_max( NEARZERO, maxSpacing * 1e-6 );
 				const Scalar behind_test_criteria = Vector3Ops::Dot(
-					Vector3Ops::mkVector3( elem.ptPosition, ptPosition ),
-					elem.vNormal
+					Vector3Ops::mkVector3( elemPosition, ptPosition ),
+					elemNormal
 					);
 
 				if( behind_test_criteria < -plane_epsilon ) {
@@ -41,6 +42,64 @@ using namespace RISE::Implementation;
 			return true;
 		}
 
+		inline bool IsCompatibleWithQuery(
+			const Point3& ptPosition,
+			const Vector3& vNormal,
+			const RISE::IIrradianceCache::CacheElement& elem,
+			const Scalar maxSpacing
+			)
+		{
+			return IsCompatibleWithQuery( ptPosition, vNormal, elem.ptPosition, elem.vNormal, maxSpacing );
+		}
+
+		//! Ward's weight of a record at elemPosition/elemNormal with radius
+		//! r0 for a query at pos/norm.  Shared by CacheElement and the flat
+		//! snapshot so both paths weigh records identically.
+		inline Scalar RecordWeight(
+			const Point3& elemPosition,
+			const Vector3& elemNormal,
+			const Scalar r0,
+			const Point3& pos,
+			const Vector3& norm
+			)
+		{
+			Scalar ndot = Vector3Ops::Dot( norm, elemNormal );
+			ndot = r_min( 1.0, r_max( -1.0, ndot ) );
+
+			Scalar om_ndot = 1.0 - ndot;
+			if( om_ndot < 0 ) {
+				om_ndot = 0;
+			}
+
+			if( r0 <= NEARZERO ) {
+				// Degenerate cache radius is only valid for the exact same point and normal.
+				if( Point3Ops::Distance(pos, elemPosition) <= NEARZERO && om_ndot <= NEARZERO ) {
+					return 1e10;
+				}
+				return 0.0;
+			}
+
+			const Scalar denom = Point3Ops::Distance(pos, elemPosition)/r0 + sqrt( om_ndot );
+			if (denom > 0) {
+				return 1.0 / denom;
+			}
+			// This means the point is right at a sample point so weight it highly
+			return 1e10;
+		}
+
+		inline bool ChildOverlapsQuery(
+			const Point3& ptCenter,
+			const Scalar dHalfSize,
+			const Point3& ptPosition,
+			const Scalar maxSpacing
+			)
+		{
+			return
+				(ptCenter.x - dHalfSize - maxSpacing <= ptPosition.x && ptPosition.x <= ptCenter.x + dHalfSize + maxSpacing ) &&
+				(ptCenter.y - dHalfSize - maxSpacing <= ptPosition.y && ptPosition.y <= ptCenter.y + dHalfSize + maxSpacing ) &&
+				(ptCenter.z - dHalfSize - maxSpacing <= ptPosition.z && ptPosition.z <= ptCenter.z + dHalfSize + maxSpacing );
+		}
+
 		inline Scalar MinDistanceToNodeBounds(
 			const Point3& ptPosition,
 			const Point3& ptCenter,
@@ -156,28 +215,7 @@ IrradianceCache::CacheElement::~CacheElement( )
 
 Scalar IrradianceCache::CacheElement::ComputeWeight( const Point3& pos, const Vector3& norm ) const
 {
-	Scalar ndot = Vector3Ops::Dot( norm, vNormal );
-	ndot = r_min( 1.0, r_max( -1.0, ndot ) );
-
-	Scalar om_ndot = 1.0 - ndot;
-	if( om_ndot < 0 ) {
-		om_ndot = 0;
-	}
-
-	if( r0 <= NEARZERO ) {
-		// Degenerate cache radius is only valid for the exact same point and normal.
-		if( Point3Ops::Distance(pos, ptPosition) <= NEARZERO && om_ndot <= NEARZERO ) {
-			return 1e10;
-		}
-		return 0.0;
-	}
-
-	const Scalar denom = Point3Ops::Distance(pos, ptPosition)/r0 + sqrt( om_ndot );
-	if (denom > 0) {
-		return 1.0 / denom;
-	}
-	// This means the point is right at a sample point so weight it highly
-	return 1e10;
+	return RecordWeight( ptPosition, vNormal, r0, pos, norm );
 }
 
 /////////////////////////////////////////////////////////////////
@@ -185,10 +223,11 @@ Scalar IrradianceCache::CacheElement::ComputeWeight( const Point3& pos, const Ve
 /////////////////////////////////////////////////////////////////
 
 IrradianceCache::CacheNode::CacheNode( const Scalar size, const Point3& center ) :
-  ptCenter( center ), dSize( size ), dHalfSize( size * 0.5 )
+  ptCenter( center ), dSize( size ), dHalfSize( size * 0.5 ),
+  pFirstBlock( 0 ), pLastBlock( 0 )
 {
 	for( int i=0; i<8; i++ ) {
-		pChildren[i] = 0;
+		pChildren[i].store( 0, std::memory_order_relaxed );
 	}
 }
 
@@ -200,12 +239,83 @@ IrradianceCache::CacheNode::~CacheNode( )
 void IrradianceCache::CacheNode::Clear()
 {
 	for( int i=0; i<8; i++ ) {
-		if( pChildren[i] ) {
-			GlobalLog()->PrintDelete( pChildren[i], __FILE__, __LINE__ );
-			delete pChildren[i];
-			pChildren[i] = 0;
+		CacheNode* pChild = pChildren[i].load( std::memory_order_relaxed );
+		if( pChild ) {
+			GlobalLog()->PrintDelete( pChild, __FILE__, __LINE__ );
+			delete pChild;
+			pChildren[i].store( 0, std::memory_order_relaxed );
 		}
 	}
+
+	ElementBlock* pBlock = pFirstBlock.load( std::memory_order_relaxed );
+	while( pBlock ) {
+		ElementBlock* pNext = pBlock->pNext.load( std::memory_order_relaxed );
+		const unsigned int n = pBlock->count.load( std::memory_order_relaxed );
+		for( unsigned int i=0; i<n; i++ ) {
+			pBlock->Slot( i )->~CacheElement();
+		}
+		GlobalLog()->PrintDelete( pBlock, __FILE__, __LINE__ );
+		delete pBlock;
+		pBlock = pNext;
+	}
+	pFirstBlock.store( 0, std::memory_order_relaxed );
+	pLastBlock = 0;
+}
+
+void IrradianceCache::CacheNode::AppendElement( const CacheElement& elem )
+{
+	std::lock_guard<std::mutex> lock( appendMutex );
+
+	ElementBlock* pBlock = pLastBlock;
+	if( !pBlock || pBlock->count.load( std::memory_order_relaxed ) == ElementBlock::kCapacity ) {
+		ElementBlock* pNew = new ElementBlock();
+		GlobalLog()->PrintNew( pNew, __FILE__, __LINE__, "element block" );
+
+		// An empty block is safe to publish before it is filled; readers
+		// see its count of zero
+		if( pBlock ) {
+			pBlock->pNext.store( pNew, std::memory_order_release );
+		} else {
+			pFirstBlock.store( pNew, std::memory_order_release );
+		}
+		pLastBlock = pBlock = pNew;
+	}
+
+	const unsigned int n = pBlock->count.load( std::memory_order_relaxed );
+	new( pBlock->Slot( n ) ) CacheElement( elem );
+	pBlock->count.store( n+1, std::memory_order_release );
+}
+
+IrradianceCache::CacheNode* IrradianceCache::CacheNode::GetOrCreateChild( const unsigned char idx )
+{
+	static const Scalar size_error = NEARZERO;
+
+	CacheNode* pChild = pChildren[idx].load( std::memory_order_acquire );
+	if( pChild ) {
+		return pChild;
+	}
+
+	const Scalar dChildSize = dHalfSize + size_error;
+	const Scalar dChildHalfSize = dHalfSize * 0.5 + size_error;
+
+	// Octants 0-3 are on the +x side, 0,1,4,5 on +y and the even ones on +z
+	// (see WhichNode)
+	const Vector3 offset(
+		idx < 4 ? dChildHalfSize : -dChildHalfSize,
+		(idx & 2) ? -dChildHalfSize : dChildHalfSize,
+		(idx & 1) ? -dChildHalfSize : dChildHalfSize );
+
+	CacheNode* pNew = new CacheNode( dChildSize, Point3Ops::mkPoint3( ptCenter, offset ) );
+
+	// Another thread may have created the same child meanwhile; whoever
+	// loses the race throws its node away and uses the winner's
+	if( pChildren[idx].compare_exchange_strong( pChild, pNew, std::memory_order_acq_rel, std::memory_order_acquire ) ) {
+		GlobalLog()->PrintNew( pNew, __FILE__, __LINE__, "child node" );
+		return pNew;
+	}
+
+	delete pNew;
+	return pChild;
 }
 
 unsigned char IrradianceCache::CacheNode::WhichNode( const Point3& pos )
@@ -276,7 +386,6 @@ void IrradianceCache::CacheNode::InsertElement(
 	const Scalar tolerance
 	)
 {
-	static const Scalar size_error = NEARZERO;
 	const Scalar insert_threshold = elem.r0 * tolerance * 4.0;
 
 	//
@@ -286,50 +395,14 @@ void IrradianceCache::CacheNode::InsertElement(
 
 	// The 4.0 is there as a fudge to make sure that we don't have to insert this cache point into
 	// multiple children.  Should probably fix this to be more robust.
-	if( dSize < insert_threshold ) {
-		values.push_back( elem );
-	} else {
+	CacheNode* pNode = this;
+	while( pNode->dSize >= insert_threshold ) {
 		// Create children if we have to
 		// First find out which child this value will be inserted into
-		const unsigned char idx = WhichNode( elem.ptPosition );
-		const Scalar dChildSize = dHalfSize + size_error;
-		const Scalar dChildHalfSize = dHalfSize * 0.5 + size_error;
-
-		if( pChildren[idx] == 0 )
-		{
-			switch( idx )
-			{
-			case 0:
-				pChildren[idx] = new CacheNode( dChildSize, Point3Ops::mkPoint3( ptCenter, Vector3( dChildHalfSize, dChildHalfSize, dChildHalfSize ) ) );
-				break;
-			case 1:
-				pChildren[idx] = new CacheNode( dChildSize, Point3Ops::mkPoint3( ptCenter, Vector3( dChildHalfSize, dChildHalfSize, -dChildHalfSize ) ) );
-				break;
-			case 2:
-				pChildren[idx] = new CacheNode( dChildSize, Point3Ops::mkPoint3( ptCenter, Vector3( dChildHalfSize, -dChildHalfSize, dChildHalfSize ) ) );
-				break;
-			case 3:
-				pChildren[idx] = new CacheNode( dChildSize, Point3Ops::mkPoint3( ptCenter, Vector3( dChildHalfSize, -dChildHalfSize, -dChildHalfSize ) ) );
-				break;
-			case 4:
-				pChildren[idx] = new CacheNode( dChildSize, Point3Ops::mkPoint3( ptCenter, Vector3( -dChildHalfSize, dChildHalfSize, dChildHalfSize ) ) );
-				break;
-			case 5:
-				pChildren[idx] = new CacheNode( dChildSize, Point3Ops::mkPoint3( ptCenter, Vector3( -dChildHalfSize, dChildHalfSize, -dChildHalfSize ) ) );
-				break;
-			case 6:
-				pChildren[idx] = new CacheNode( dChildSize, Point3Ops::mkPoint3( ptCenter, Vector3( -dChildHalfSize, -dChildHalfSize, dChildHalfSize ) ) );
-				break;
-			case 7:
-				pChildren[idx] = new CacheNode( dChildSize, Point3Ops::mkPoint3( ptCenter, Vector3( -dChildHalfSize, -dChildHalfSize, -dChildHalfSize ) ) );
-				break;
-			}
-
-			GlobalLog()->PrintNew( pChildren[idx], __FILE__, __LINE__, "child node" );
-		}
-
-		pChildren[idx]->InsertElement( elem, tolerance );
+		pNode = pNode->GetOrCreateChild( pNode->WhichNode( elem.ptPosition ) );
 	}
+
+	pNode->AppendElement( elem );
 }
 
 Scalar IrradianceCache::CacheNode::Query(
@@ -341,40 +414,41 @@ Scalar IrradianceCache::CacheNode::Query(
 	const Scalar query_threshold_scale
 	) const
 {
-	std::vector<CacheElement>::const_iterator		i, e;
 	Scalar		accruedWeights = 0;
 
-	for( i=values.begin(), e=values.end(); i!=e; i++ )
+	// Use the configured query threshold scale so scene files can tune how
+	// aggressively interpolation reuses nearby cache records.
+	const Scalar query_min_weight = r_max( Scalar(NEARZERO), invTolerance * query_threshold_scale );
+
+	for( const ElementBlock* pBlock = pFirstBlock.load( std::memory_order_acquire ); pBlock; pBlock = pBlock->pNext.load( std::memory_order_acquire ) )
 	{
-		const CacheElement& elem = *i;
+		const unsigned int n = pBlock->count.load( std::memory_order_acquire );
+		for( unsigned int i=0; i<n; i++ )
+		{
+			const CacheElement& elem = pBlock->At( i );
 
-		// Only enforce the side-of-plane rejection when normals are opposing.
-		// For similarly-oriented records, this can incorrectly reject valid same-surface
-		// cache points due to tiny geometric offsets and create interpolation holes.
-		if( !IsCompatibleWithQuery( ptPosition, vNormal, elem, maxSpacing ) ) {
-			continue;
-		}
+			// Only enforce the side-of-plane rejection when normals are opposing.
+			// For similarly-oriented records, this can incorrectly reject valid same-surface
+			// cache points due to tiny geometric offsets and create interpolation holes.
+			if( !IsCompatibleWithQuery( ptPosition, vNormal, elem, maxSpacing ) ) {
+				continue;
+			}
 
-		Scalar	thisWeight = r_min( 1e10, elem.ComputeWeight( ptPosition, vNormal ) );
-			// Use the configured query threshold scale so scene files can tune how
-			// aggressively interpolation reuses nearby cache records.
-			const Scalar query_min_weight = r_max( Scalar(NEARZERO), invTolerance * query_threshold_scale );
+			Scalar	thisWeight = r_min( 1e10, elem.ComputeWeight( ptPosition, vNormal ) );
 
-		if( thisWeight > query_min_weight ) {
-			CacheElement newelem( elem, thisWeight );
-			results.push_back( newelem );
-			accruedWeights += thisWeight;
+			if( thisWeight > query_min_weight ) {
+				CacheElement newelem( elem, thisWeight );
+				results.push_back( newelem );
+				accruedWeights += thisWeight;
+			}
 		}
 	}
 
 	for( int x = 0; x<8; x++ )
 	{
-		if( (pChildren[x]) &&
-			(pChildren[x]->ptCenter.x - pChildren[x]->dHalfSize - maxSpacing <= ptPosition.x && ptPosition.x <= pChildren[x]->ptCenter.x + pChildren[x]->dHalfSize + maxSpacing ) &&
-			(pChildren[x]->ptCenter.y - pChildren[x]->dHalfSize - maxSpacing <= ptPosition.y && ptPosition.y <= pChildren[x]->ptCenter.y + pChildren[x]->dHalfSize + maxSpacing ) &&
-			(pChildren[x]->ptCenter.z - pChildren[x]->dHalfSize - maxSpacing <= ptPosition.z && ptPosition.z <= pChildren[x]->ptCenter.z + pChildren[x]->dHalfSize + maxSpacing ) )
-		{
-				accruedWeights += pChildren[x]->Query( ptPosition, vNormal, results, invTolerance, maxSpacing, query_threshold_scale );
+		const CacheNode* pChild = pChildren[x].load( std::memory_order_acquire );
+		if( pChild && ChildOverlapsQuery( pChild->ptCenter, pChild->dHalfSize, ptPosition, maxSpacing ) ) {
+			accruedWeights += pChild->Query( ptPosition, vNormal, results, invTolerance, maxSpacing, query_threshold_scale );
 		}
 	}
 
@@ -388,34 +462,33 @@ bool IrradianceCache::CacheNode::IsSampleNeeded(
 	const Scalar maxSpacing
 	) const
 {
-	std::vector<CacheElement>::const_iterator		i, e;
-
 	// Base case
 	// Check the values at this node first and see if any will do, if they suffice, we're ok and we say no
-	for( i=values.begin(), e=values.end(); i!=e; i++ ) {
-		const CacheElement& elem = *i;
+	for( const ElementBlock* pBlock = pFirstBlock.load( std::memory_order_acquire ); pBlock; pBlock = pBlock->pNext.load( std::memory_order_acquire ) )
+	{
+		const unsigned int n = pBlock->count.load( std::memory_order_acquire );
+		for( unsigned int i=0; i<n; i++ )
+		{
+			const CacheElement& elem = pBlock->At( i );
 
-		if( !IsCompatibleWithQuery( ptPosition, vNormal, elem, maxSpacing ) ) {
-			continue;
-		}
+			if( !IsCompatibleWithQuery( ptPosition, vNormal, elem, maxSpacing ) ) {
+				continue;
+			}
 
-		Scalar	thisWeight = r_min( 1e10, elem.ComputeWeight( ptPosition, vNormal ) );
+			Scalar	thisWeight = r_min( 1e10, elem.ComputeWeight( ptPosition, vNormal ) );
 
-		if( thisWeight > invTolerance ) {
-			return false;
+			if( thisWeight > invTolerance ) {
+				return false;
+			}
 		}
 	}
 
 	// Otherwise check children
 	for( int x = 0; x<8; x++ )
 	{
-		if( (pChildren[x]) &&
-			(pChildren[x]->ptCenter.x - pChildren[x]->dHalfSize - maxSpacing <= ptPosition.x && ptPosition.x <= pChildren[x]->ptCenter.x + pChildren[x]->dHalfSize + maxSpacing ) &&
-			(pChildren[x]->ptCenter.y - pChildren[x]->dHalfSize - maxSpacing <= ptPosition.y && ptPosition.y <= pChildren[x]->ptCenter.y + pChildren[x]->dHalfSize + maxSpacing ) &&
-			(pChildren[x]->ptCenter.z - pChildren[x]->dHalfSize - maxSpacing <= ptPosition.z && ptPosition.z <= pChildren[x]->ptCenter.z + pChildren[x]->dHalfSize + maxSpacing ) )
-		{
-			bool bChildSampleCheck = pChildren[x]->IsSampleNeeded( ptPosition, vNormal, invTolerance, maxSpacing );
-			if( !bChildSampleCheck ) {
+		const CacheNode* pChild = pChildren[x].load( std::memory_order_acquire );
+		if( pChild && ChildOverlapsQuery( pChild->ptCenter, pChild->dHalfSize, ptPosition, maxSpacing ) ) {
+			if( !pChild->IsSampleNeeded( ptPosition, vNormal, invTolerance, maxSpacing ) ) {
 				return false;
 			}
 		}
@@ -431,34 +504,162 @@ void IrradianceCache::CacheNode::FindNearestCompatibleDistance(
 	Scalar& nearestDistance
 	) const
 {
-	std::vector<CacheElement>::const_iterator i, e;
-
-	for( i=values.begin(), e=values.end(); i!=e; i++ ) {
-		const CacheElement& elem = *i;
+	for( const ElementBlock* pBlock = pFirstBlock.load( std::memory_order_acquire ); pBlock; pBlock = pBlock->pNext.load( std::memory_order_acquire ) )
+	{
+		const unsigned int n = pBlock->count.load( std::memory_order_acquire );
+		for( unsigned int i=0; i<n; i++ )
+		{
+			const CacheElement& elem = pBlock->At( i );
 
-		if( !IsCompatibleWithQuery( ptPosition, vNormal, elem, maxSpacing ) ) {
-			continue;
-		}
+			if( !IsCompatibleWithQuery( ptPosition, vNormal, elem, maxSpacing ) ) {
+				continue;
+			}
 
-		const Scalar distance = Point3Ops::Distance( ptPosition, elem.ptPosition );
-		if( distance > NEARZERO && distance < nearestDistance ) {
-			nearestDistance = distance;
+			const Scalar distance = Point3Ops::Distance( ptPosition, elem.ptPosition );
+			if( distance > NEARZERO && distance < nearestDistance ) {
+				nearestDistance = distance;
+			}
 		}
 	}
 
 	for( int x = 0; x<8; x++ ) {
-		if( pChildren[x] ) {
+		const CacheNode* pChild = pChildren[x].load( std::memory_order_acquire );
+		if( pChild ) {
 			const Scalar minNodeDistance = MinDistanceToNodeBounds(
 				ptPosition,
-				pChildren[x]->ptCenter,
-				pChildren[x]->dHalfSize
+				pChild->ptCenter,
+				pChild->dHalfSize
 				);
 
 			if( minNodeDistance <= nearestDistance ) {
-				pChildren[x]->FindNearestCompatibleDistance( ptPosition, vNormal, maxSpacing, nearestDistance );
+				pChild->FindNearestCompatibleDistance( ptPosition, vNormal, maxSpacing, nearestDistance );
+			}
+		}
+	}
+}
+
+void IrradianceCache::CacheNode::Flatten(
+	const unsigned int self,
+	std::vector<FlatNode>& nodes,
+	std::vector<FlatKey>& keys,
+	std::vector<CacheElement>& records
+	) const
+{
+	nodes[self].ptCenter = ptCenter;
+	nodes[self].dHalfSize = dHalfSize;
+	nodes[self].firstRecord = static_cast<unsigned int>( records.size() );
+
+	for( const ElementBlock* pBlock = pFirstBlock.load( std::memory_order_acquire ); pBlock; pBlock = pBlock->pNext.load( std::memory_order_acquire ) )
+	{
+		const unsigned int n = pBlock->count.load( std::memory_order_acquire );
+		for( unsigned int i=0; i<n; i++ )
+		{
+			const CacheElement& elem = pBlock->At( i );
+			FlatKey key;
+			key.ptPosition = elem.ptPosition;
+			key.vNormal = elem.vNormal;
+			key.r0 = elem.r0;
+			keys.push_back( key );
+			records.push_back( elem );
+		}
+	}
+
+	nodes[self].numRecords = static_cast<unsigned int>( records.size() ) - nodes[self].firstRecord;
+
+	// Reserve all the children first so siblings are contiguous, then
+	// fill them in octant order -- the same order Query visits them in
+	const CacheNode* kids[8];
+	unsigned int numKids = 0;
+	for( int x = 0; x<8; x++ ) {
+		const CacheNode* pChild = pChildren[x].load( std::memory_order_acquire );
+		if( pChild ) {
+			kids[numKids++] = pChild;
+		}
+	}
+
+	const unsigned int firstChild = static_cast<unsigned int>( nodes.size() );
+	nodes[self].firstChild = firstChild;
+	nodes[self].numChildren = numKids;
+	nodes.resize( nodes.size() + numKids );
+
+	for( unsigned int k=0; k<numKids; k++ ) {
+		kids[k]->Flatten( firstChild + k, nodes, keys, records );
+	}
+}
+
+Scalar IrradianceCache::FlatQuery(
+	const unsigned int node,
+	const Point3& ptPosition,
+	const Vector3& vNormal,
+	std::vector<CacheElement>& results
+	) const
+{
+	const FlatNode& fn = flatNodes[node];
+	Scalar accruedWeights = 0;
+
+	const Scalar query_min_weight = r_max( Scalar(NEARZERO), invTolerance * query_threshold_scale );
+
+	const unsigned int end = fn.firstRecord + fn.numRecords;
+	for( unsigned int i=fn.firstRecord; i<end; i++ )
+	{
+		const FlatKey& key = flatKeys[i];
+
+		if( !IsCompatibleWithQuery( ptPosition, vNormal, key.ptPosition, key.vNormal, max_spacing ) ) {
+			continue;
+		}
+
+		const Scalar thisWeight = r_min( 1e10, RecordWeight( key.ptPosition, key.vNormal, key.r0, ptPosition, vNormal ) );
+
+		if( thisWeight > query_min_weight ) {
+			results.push_back( CacheElement( flatRecords[i], thisWeight ) );
+			accruedWeights += thisWeight;
+		}
+	}
+
+	const unsigned int childEnd = fn.firstChild + fn.numChildren;
+	for( unsigned int c=fn.firstChild; c<childEnd; c++ ) {
+		const FlatNode& child = flatNodes[c];
+		if( ChildOverlapsQuery( child.ptCenter, child.dHalfSize, ptPosition, max_spacing ) ) {
+			accruedWeights += FlatQuery( c, ptPosition, vNormal, results );
+		}
+	}
+
+	return accruedWeights;
+}
+
+bool IrradianceCache::FlatIsSampleNeeded(
+	const unsigned int node,
+	const Point3& ptPosition,
+	const Vector3& vNormal
+	) const
+{
+	const FlatNode& fn = flatNodes[node];
+
+	const unsigned int end = fn.firstRecord + fn.numRecords;
+	for( unsigned int i=fn.firstRecord; i<end; i++ )
+	{
+		const FlatKey& key = flatKeys[i];
+
+		if( !IsCompatibleWithQuery( ptPosition, vNormal, key.ptPosition, key.vNormal, max_spacing ) ) {
+			continue;
+		}
+
+		if( r_min( 1e10, RecordWeight( key.ptPosition, key.vNormal, key.r0, ptPosition, vNormal ) ) > invTolerance ) {
+			return false;
+		}
+	}
+
+	const unsigned int childEnd = fn.firstChild + fn.numChildren;
+	for( unsigned int c=fn.firstChild; c<childEnd; c++ ) {
+		const FlatNode& child = flatNodes[c];
+		if( ChildOverlapsQuery( child.ptCenter, child.dHalfSize, ptPosition, max_spacing ) ) {
+			if( !FlatIsSampleNeeded( c, ptPosition, vNormal ) ) {
+				return false;
 			}
 		}
 	}
+
+	return true;
 }
 
 bool IrradianceCache::WouldInterpolate(
@@ -469,9 +670,11 @@ bool IrradianceCache::WouldInterpolate(
 {
 	std::vector<CacheElement> results;
 
-	mutex.read_lock();
-	root.Query( ptPosition, vNormal, results, invTolerance, max_spacing, query_threshold_scale );
-	mutex.read_unlock();
+	if( bPreComputed ) {
+		FlatQuery( 0, ptPosition, vNormal, results );
+	} else {
+		root.Query( ptPosition, vNormal, results, invTolerance, max_spacing, query_threshold_scale );
+	}
 
 	const Scalar effectiveContributors = ComputeEffectiveContributors( results );
 	return effectiveContributors >= Scalar(minEffectiveContributors);
@@ -489,7 +692,7 @@ IrradianceCache::IrradianceCache(
 	const Scalar query_threshold_scale_,
 	const Scalar neighbor_spacing_scale_
 	) :
-  root( CacheNode( size, Point3( 0, 0, 0 ) ) ),
+  root( size, Point3( 0, 0, 0 ) ),
   tolerance( tol ),
   invTolerance( 1.0/tol ),
 	min_spacing( min ),
@@ -508,11 +711,41 @@ IrradianceCache::~IrradianceCache( )
 {
 }
 
+void IrradianceCache::Clear() const
+{
+	root.Clear();
+	flatNodes.clear();
+	flatKeys.clear();
+	flatRecords.clear();
+	bPreComputed = false;
+}
+
 void IrradianceCache::FinishedPrecomputation() const
 {
 	#ifdef _DEBUG
 	assert( !bPreComputed );
 	#endif
 
+	// Every inserting thread has finished with the pass, so the tree is
+	// quiescent; freeze it into the flat arrays the normal pass reads
+	flatNodes.clear();
+	flatKeys.clear();
+	flatRecords.clear();
+	flatNodes.resize( 1 );
+	root.Flatten( 0, flatNodes, flatKeys, flatRecords );
+
 	bPreComputed = true;
 }
+
+unsigned int IrradianceCache::NumRecords() const
+{
+	if( bPreComputed ) {
+		return static_cast<unsigned int>( flatRecords.size() );
+	}
+
+	std::vector<FlatNode> nodes( 1 );
+	std::vector<FlatKey> keys;
+	std::vector<CacheElement> records;
+	root.Flatten( 0, nodes, keys, records );
+	return static_cast<unsigned int>( records.size() );
+}
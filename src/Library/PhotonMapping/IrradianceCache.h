@@ -8,6 +8,15 @@
 //  the paper by Gregory J. Ward et al.  titled
 //  "A Ray Tracing Solution for Diffuse Interreflection"
 //
+//  Concurrency: the octree is filled by every render thread at once
+//  during PASS_IRRADIANCE_CACHE.  Readers never lock.  Children are
+//  published with a compare-and-swap and each node keeps its records
+//  in append-only blocks whose counts are published with release
+//  stores, so only two writers appending to the SAME node ever wait
+//  on each other (per-node lock).  FinishedPrecomputation then flattens
+//  the tree into contiguous node and record arrays that the normal
+//  pass queries without chasing pointers.
+//
 //  Author: Aravind Krishnaswamy
 //  Date of Birth: May 28, 2002
 //  Tabs: 4
@@ -25,7 +34,8 @@
 #include "../Utilities/Math3D/Math3D.h"
 #include "../Utilities/BoundingBox.h"
 #include "../Utilities/Color/Color.h"
-#include "../Utilities/Threads/Threads.h"
+#include <atomic>
+#include <mutex>
 #include <vector>
 
 #ifdef _DEBUG
@@ -42,6 +52,28 @@ namespace RISE
 			public virtual Implementation::Reference
 		{
 		protected:
+			//! Flat octree node of the post-precomputation snapshot
+			class FlatNode
+			{
+			public:
+				Point3			ptCenter;
+				Scalar			dHalfSize;
+				unsigned int	firstRecord;
+				unsigned int	numRecords;
+				unsigned int	firstChild;
+				unsigned int	numChildren;
+			};
+
+			//! Just what the weight test reads, packed apart from the
+			//! (much larger) record so the scan stays in cache
+			class FlatKey
+			{
+			public:
+				Point3			ptPosition;
+				Vector3			vNormal;
+				Scalar			r0;
+			};
+
 			//
 			// This represents a cache node which is the internal octree
 			// for the irradiance cache
@@ -49,17 +81,45 @@ namespace RISE
 			class CacheNode
 			{
 			protected:
+				//! Append-only storage for a node's records.  Slots below
+				//! count are fully constructed and never move, so readers
+				//! can walk them while other threads append.
+				struct ElementBlock
+				{
+					static const unsigned int kCapacity = 16;
+
+					std::atomic<unsigned int>		count;
+					std::atomic<ElementBlock*>		pNext;
+					alignas(CacheElement) unsigned char	storage[kCapacity*sizeof(CacheElement)];
+
+					ElementBlock() : count( 0 ), pNext( 0 ) {}
+
+					CacheElement* Slot( const unsigned int i ) { return reinterpret_cast<CacheElement*>( storage ) + i; }
+					const CacheElement& At( const unsigned int i ) const { return reinterpret_cast<const CacheElement*>( storage )[i]; }
+				};
+
 				Point3		ptCenter;					// The absolute center of the node in world space
 				Scalar		dSize;						// The size of the node (from edge to an edge)
 				Scalar		dHalfSize;					// The size of the node from center to edge
 
-				std::vector<CacheElement>	values;		// The irradiance values for this node
+				std::atomic<ElementBlock*>	pFirstBlock;	// The irradiance values for this node
+				ElementBlock*				pLastBlock;		// Append target, guarded by appendMutex
+				std::mutex					appendMutex;
 
-				CacheNode*	pChildren[8];				// The eight children of this node
+				std::atomic<CacheNode*>	pChildren[8];	// The eight children of this node
 
 				// This function given a point will locate the child node that contains that point
 				unsigned char WhichNode( const Point3& ptPosition );
 
+				//! Returns child idx, creating it if no other thread has yet
+				CacheNode* GetOrCreateChild( const unsigned char idx );
+
+				//! Appends a record to this node's blocks
+				void AppendElement( const CacheElement& elem );
+
+				CacheNode( const CacheNode& );
+				CacheNode& operator=( const CacheNode& );
+
 			public:
 				CacheNode( const Scalar size, const Point3& center );
 				virtual ~CacheNode( );
@@ -96,6 +156,17 @@ namespace RISE
 					Scalar& nearestDistance
 					) const;
 
+				//! Appends this subtree to the flat snapshot, children of a
+				//! node contiguous and in octant order
+				void Flatten(
+					const unsigned int self,
+					std::vector<FlatNode>& nodes,
+					std::vector<FlatKey>& keys,
+					std::vector<CacheElement>& records
+					) const;
+
+				//! Removes every record and child.  Not safe against
+				//! concurrent inserts or queries.
 				void Clear();
 			};
 
@@ -107,15 +178,25 @@ namespace RISE
 			Scalar			query_threshold_scale;
 			Scalar			neighbor_spacing_scale;
 
-			mutable RMutexReadWrite	mutex;				// Mutex to control access
+			mutable std::vector<FlatNode>		flatNodes;		// Snapshot built by FinishedPrecomputation
+			mutable std::vector<FlatKey>		flatKeys;
+			mutable std::vector<CacheElement>	flatRecords;
 
 			mutable bool			bPreComputed;				// Has the cache been pre-computed?
 
 			virtual ~IrradianceCache( );
 
+			Scalar FlatQuery( const unsigned int node, const Point3& ptPosition, const Vector3& vNormal, std::vector<CacheElement>& results ) const;
+			bool FlatIsSampleNeeded( const unsigned int node, const Point3& ptPosition, const Vector3& vNormal ) const;
+
 		public:
 			IrradianceCache( const Scalar size, const Scalar tol, const Scalar min, const Scalar max, const Scalar query_threshold_scale_, const Scalar neighbor_spacing_scale_ );
 
+			//! Safe to call from many threads at once.  The neighbour
+			//! spacing clamp sees every record published before the call;
+			//! two records inserted at the same instant may not see each
+			//! other, exactly as if they had been inserted in either order
+			//! by threads that had not yet checked IsSampleNeeded.
 			void InsertElement(
 				const Point3&		ptPosition,
 				const Vector3&		vNormal,
@@ -139,7 +220,6 @@ namespace RISE
 					r0 = max_spacing/tolerance;
 				}
 
-				mutex.write_lock();
 				if( neighbor_spacing_scale > 0 ) {
 					Scalar finalReuseRadius = r0 * tolerance;
 					Scalar nearestCompatibleDistance = finalReuseRadius;
@@ -150,7 +230,6 @@ namespace RISE
 					}
 				}
 				root.InsertElement( CacheElement(ptPosition, vNormal, cIRad, r0, 0, rot, trans), tolerance );
-				mutex.write_unlock();
 			}
 
 			// Queries don't require the lock because we query only, there will be insertions (that is done in a prepass)
@@ -159,16 +238,18 @@ namespace RISE
 				#ifdef _DEBUG
 				assert( bPreComputed );
 				#endif
+				if( bPreComputed ) {
+					return FlatQuery( 0, ptPosition, vNormal, results );
+				}
 				return root.Query( ptPosition, vNormal, results, invTolerance, max_spacing, query_threshold_scale );
 			}
 
 			bool IsSampleNeeded( const Point3& ptPosition, const Vector3& vNormal ) const
 			{
-				mutex.read_lock();
-				bool bSampleNeeded = root.IsSampleNeeded( ptPosition, vNormal, invTolerance, max_spacing );
-				mutex.read_unlock();
-
-				return bSampleNeeded;
+				if( bPreComputed ) {
+					return FlatIsSampleNeeded( 0, ptPosition, vNormal );
+				}
+				return root.IsSampleNeeded( ptPosition, vNormal, invTolerance, max_spacing );
 			}
 
 			bool WouldInterpolate(
@@ -178,18 +259,18 @@ namespace RISE
 				) const;
 
 			inline Scalar GetTolerance() const { return tolerance; };
-			inline void Clear() const
-			{
-				root.Clear();
-				bPreComputed = false;
-			};
+			void Clear() const;
 
+			//! Freezes the cache and builds the flat query snapshot
 			void FinishedPrecomputation() const;
 
 			bool Precomputed() const
 			{
 				return bPreComputed;
 			}
+
+			//! Number of records in the cache
+			unsigned int NumRecords() const;
 		};
 
 	}
@@ -17,6 +17,7 @@
 #include "../Interfaces/IPhotonTracer.h"
 #include "../Utilities/Reference.h"
 #include "../Rendering/LuminaryManager.h"
+#include "../Utilities/CancellationToken.h"
 
 namespace RISE
 {
@@ -131,11 +132,17 @@ namespace RISE
 				PhotonMapType* pPhotonMap
 				) const = 0;
 
-			void TraceNPhotons(
+			//! How many photons are shot between polls of the cancellation token
+			static const unsigned int kCancelPollInterval = 1024;
+
+			//! \return false if `cancel` fired part way through, in which case
+			//! the map holds a partial, unusable shoot
+			bool TraceNPhotons(
 				const unsigned int numPhotons,
 				PhotonMapType*	pPhotonMap, 
 				const Scalar total_exitance,
-				int& numshot
+				int& numshot,
+				const CancellationToken& cancel
 				) const
 			{
 				const LuminaryManager::LuminariesList& lum = pLumManager->getLuminaries();
@@ -196,6 +203,9 @@ namespace RISE
 						TraceSinglePhoton( r, power, *pPhotonMap, ior_stack );
 
 						numshot_thislum++;
+						if( (numshot_thislum % kCancelPollInterval) == 0 && cancel.IsCancelled() ) {
+							return false;
+						}
 					}
 
 					numshot += numshot_thislum;
@@ -246,12 +256,17 @@ namespace RISE
 								TraceSinglePhoton( r, power, *pPhotonMap, ior_stack );
 
 								numshot_thislum++;
+								if( (numshot_thislum % kCancelPollInterval) == 0 && cancel.IsCancelled() ) {
+									return false;
+								}
 							}
 
 							numshot += numshot_thislum;
 						}
 					}
 				}
+
+				return true;
 			}
 
 		public:
@@ -333,6 +348,11 @@ namespace RISE
 
 				int numshot = 0;
 
+				// Polled inside the shoot as well as at each Progress() call, so a
+				// render restart does not wait out a whole slice of the shoot
+				const CancellationToken cancel( pFunc );
+				bool bCancelled = false;
+
 				const Scalar exposure = pScene->GetCamera()->GetExposureTime();
 
 				if( bAtTime && exposure > 0 && nNumTemporalSamples>1 ) {
@@ -345,11 +365,15 @@ namespace RISE
 							pScene->GetAnimator()->EvaluateAtTime( base_cur_time + (random.CanonicalRandom()*time_step) );
 						}
 
-						TraceNPhotons( numPhotons/nNumTemporalSamples, pPhotonMap, total_exitance, numshot );
+						if( !TraceNPhotons( numPhotons/nNumTemporalSamples, pPhotonMap, total_exitance, numshot, cancel ) ) {
+							bCancelled = true;
+							break;
+						}
 
 						if( pFunc ) {
 							const unsigned int cnt = pPhotonMap->NumStored();
 							if( !pFunc->Progress(static_cast<Scalar>(cnt), static_cast<Scalar>(numPhotons)) ) {
+								bCancelled = true;
 								break;		// abort
 							}
 						}
@@ -357,14 +381,18 @@ namespace RISE
 				} else {
 					if( pFunc && numPhotons > 100 ) {
 						for( int i=0; i<100; i++ ) {
-							TraceNPhotons( numPhotons/100, pPhotonMap, total_exitance, numshot );
+							if( !TraceNPhotons( numPhotons/100, pPhotonMap, total_exitance, numshot, cancel ) ) {
+								bCancelled = true;
+								break;
+							}
 							const unsigned int cnt = pPhotonMap->NumStored();
 							if( !pFunc->Progress(static_cast<Scalar>(cnt), static_cast<Scalar>(numPhotons)) ) {
+								bCancelled = true;
 								break;		// abort
 							}
 						}
 					} else {
-						TraceNPhotons( numPhotons, pPhotonMap, total_exitance, numshot );
+						bCancelled = !TraceNPhotons( numPhotons, pPhotonMap, total_exitance, numshot, cancel );
 					}
 				}
 
@@ -372,6 +400,15 @@ namespace RISE
 					pFunc->Progress(0,0);
 				}
 
+				// An aborted shoot is discarded rather than installed: a partial map
+				// would be kept by the scene and quietly bias every later render.
+				// The caller keeps its request pending and shoots again next time.
+				if( bCancelled ) {
+					GlobalLog()->PrintEx( eLog_Event, "TracePhotons:: Cancelled after storing %d of %d requested photons", pPhotonMap->NumStored(), numPhotons );
+					safe_release( pPhotonMap );
+					return false;
+				}
+
 				// After shooting, scale the values in the photon map
 				GlobalLog()->PrintEx( eLog_Event, "TracePhotons:: Stored %d of %d requested photons (%d shot)", pPhotonMap->NumStored(), numPhotons, numshot );
 				pPhotonMap->ScalePhotonPower( 1.0/Scalar(numshot) );
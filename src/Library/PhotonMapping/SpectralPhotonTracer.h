@@ -18,6 +18,7 @@
 #include "../Interfaces/IPhotonTracer.h"
 #include "../Utilities/Reference.h"
 #include "../Rendering/LuminaryManager.h"
+#include "../Utilities/CancellationToken.h"
 
 namespace RISE
 {
@@ -83,11 +84,17 @@ namespace RISE
 				PhotonMapType* pPhotonMap
 				) const = 0;
 
-			void TraceNPhotons(
+			//! How many photons are shot between polls of the cancellation token
+			static const unsigned int kCancelPollInterval = 1024;
+
+			//! \return false if `cancel` fired part way through, in which case
+			//! the map holds a partial, unusable shoot
+			bool TraceNPhotons(
 				const unsigned int numPhotons,
 				PhotonMapType*	pPhotonMap, 
 				const Scalar total_exitance,
-				int& numshot
+				int& numshot,
+				const CancellationToken& cancel
 				) const
 			{
 				const LuminaryManager::LuminariesList& lum = pLumManager->getLuminaries();
@@ -153,8 +160,13 @@ namespace RISE
 						TraceSinglePhoton( r, power, nm, *pPhotonMap, ior_stack );
 
 						numshot++;
+						if( (static_cast<unsigned int>(numshot) % kCancelPollInterval) == 0 && cancel.IsCancelled() ) {
+							return false;
+						}
 					}
 				}
+
+				return true;
 			}
 
 		public:
@@ -223,6 +235,11 @@ namespace RISE
 
 				int numshot = 0;
 
+				// Polled inside the shoot as well as at each Progress() call; see
+				// PhotonTracer::TracePhotons
+				const CancellationToken cancel( pFunc );
+				bool bCancelled = false;
+
 				const Scalar exposure = pScene->GetCamera()->GetExposureTime();
 
 				if( bAtTime && exposure > 0 && nNumTemporalSamples>1 ) {
@@ -235,11 +252,15 @@ namespace RISE
 							pScene->GetAnimator()->EvaluateAtTime( base_cur_time + (random.CanonicalRandom()*time_step) );
 						}
 
-						TraceNPhotons( numPhotons/nNumTemporalSamples, pPhotonMap, total_exitance, numshot );
+						if( !TraceNPhotons( numPhotons/nNumTemporalSamples, pPhotonMap, total_exitance, numshot, cancel ) ) {
+							bCancelled = true;
+							break;
+						}
 
 						if( pFunc ) {
 							const unsigned int cnt = pPhotonMap->NumStored();
 							if( !pFunc->Progress(static_cast<double>(cnt), static_cast<double>(numPhotons)) ) {
+								bCancelled = true;
 								break;		// abort
 							}
 						}
@@ -247,20 +268,32 @@ namespace RISE
 				} else {
 					if( pFunc && numPhotons > 100 ) {
 						for( int i=0; i<100; i++ ) {
-							TraceNPhotons( numPhotons/100, pPhotonMap, total_exitance, numshot );
+							if( !TraceNPhotons( numPhotons/100, pPhotonMap, total_exitance, numshot, cancel ) ) {
+								bCancelled = true;
+								break;
+							}
 							const unsigned int cnt = pPhotonMap->NumStored();
 							if( !pFunc->Progress(static_cast<double>(cnt), static_cast<double>(numPhotons)) ) {
+								bCancelled = true;
 								break;		// abort
 							}
 						}
 					} else {
-						TraceNPhotons( numPhotons, pPhotonMap, total_exitance, numshot );
+						bCancelled = !TraceNPhotons( numPhotons, pPhotonMap, total_exitance, numshot, cancel );
 					}
 				}
 				if( pFunc && pPhotonMap->NumStored() != numPhotons ) {
 					pFunc->Progress(1.0,1.0);
 				}
 
+				// An aborted shoot is discarded rather than installed; see
+				// PhotonTracer::TracePhotons
+				if( bCancelled ) {
+					GlobalLog()->PrintEx( eLog_Event, "TracePhotons:: Cancelled after storing %d of %d requested photons", pPhotonMap->NumStored(), numPhotons );
+					safe_release( pPhotonMap );
+					return false;
+				}
+
 				// After shooting, scale the values in the photon map
 				pPhotonMap->ScalePhotonPower( 1.0/Scalar(numshot) ); 
 
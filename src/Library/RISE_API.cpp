@@ -26,6 +26,7 @@
 
 #include "Utilities/stl_utils.h"
 #include "Interfaces/ILog.h"
+#include "Interfaces/IOptions.h"
 
 //////////////////////////////////////////////////////////
 // Library versioning information
@@ -389,6 +390,7 @@ namespace RISE
 #include "Geometry/BezierPatchGeometry.h"
 #include "Geometry/BilinearPatchGeometry.h"
 #include "Geometry/DisplacedGeometry.h"
+#include "Geometry/InstanceArrayGeometry.h"
 #include "Geometry/SDFGeometry.h"
 #include "Interfaces/ProceduralDescriptors.h"	// SweepDescriptor / PathInstancesDescriptor for the procedural mesh factories
 #include "Geometry/GeometryUtilities.h"		// MakeIndexedTriangleSameIdx for the procedural mesh factories
@@ -568,8 +570,10 @@ namespace RISE
 			return false;
 		}
 
-		(*ppi) = new TriangleMeshGeometryIndexed( double_sided, face_normals );
-		GlobalLog()->PrintNew( *ppi, __FILE__, __LINE__, "triangle mesh indexed" );
+		TriangleMeshGeometryIndexed* pGeom = new TriangleMeshGeometryIndexed( double_sided, face_normals );
+		GlobalLog()->PrintNew( pGeom, __FILE__, __LINE__, "triangle mesh indexed" );
+		pGeom->SetCompactStorage( GlobalOptions().ReadBool( "mesh_compact_storage", false ) );
+		(*ppi) = pGeom;
 		return true;
 	}
 
@@ -653,17 +657,14 @@ namespace RISE
 	//! Creates a bezier-patch geometry (analytic intersection).
 	/// \return TRUE if successful, FALSE otherwise
 	bool RISE_API_CreateBezierPatchGeometry(
-						IBezierPatchGeometry** ppi,				///< [out] Pointer to recieve the geometry
-						const unsigned int max_patches,			///< [in] Maximum number of patches per accelerator leaf
-						const unsigned char max_recur,			///< [in] Maximum accelerator recursion depth
-						const bool use_bsp						///< [in] Use BSP tree (true) or Octree (false)
+						IBezierPatchGeometry** ppi				///< [out] Pointer to recieve the geometry
 						)
 	{
 		if( !ppi ) {
 			return false;
 		}
 
-		(*ppi) = new BezierPatchGeometry( max_patches, max_recur, use_bsp );
+		(*ppi) = new BezierPatchGeometry();
 		GlobalLog()->PrintNew( *ppi, __FILE__, __LINE__, "bezier patch geometry" );
 
 		return true;
@@ -672,17 +673,14 @@ namespace RISE
 	//! Creates a geometry object made up of a series of bilinear patches
 	/// \return TRUE if successful, FALSE otherwise
 	bool RISE_API_CreateBilinearPatchGeometry(
-						IBilinearPatchGeometry** ppi,			///< [out] Pointer to recieve the geometry
-						const unsigned int max_patches,			///< [in] Maximum number of polygons / octant node
-						const unsigned char max_recur,			///< [in] Maximum depth of the octree or bsp tree
-						const bool use_bsp						///< [in] Use a BSP tree rather than an Octree
+						IBilinearPatchGeometry** ppi			///< [out] Pointer to recieve the geometry
 						)
 	{
 		if( !ppi ) {
 			return false;
 		}
 
-		(*ppi) = new BilinearPatchGeometry( max_patches, max_recur, use_bsp );
+		(*ppi) = new BilinearPatchGeometry();
 		GlobalLog()->PrintNew( *ppi, __FILE__, __LINE__, "bilinear patch geometry" );
 
 		return true;
@@ -696,14 +694,17 @@ namespace RISE
 						const Scalar        disp_scale,
 						const bool          double_sided,
 						const bool          face_normals,
-						const bool          seam_fold
+						const bool          seam_fold,
+						const bool          lazy,
+						const unsigned int  patch_subdivision,
+						const unsigned int  lazy_cache_triangles
 						)
 	{
 		if( !ppi || !pBase ) {
 			return false;
 		}
 
-		if( detail > 256 ) {
+		if( detail > 256 && !lazy ) {
 			GlobalLog()->PrintEx( eLog_Warning,
 				"RISE_API_CreateDisplacedGeometry: detail=%u is high; expect many triangles (grid is (detail+1)^2 per base axis or per face)",
 				detail );
@@ -711,7 +712,8 @@ namespace RISE
 
 		DisplacedGeometry* pGeom = new DisplacedGeometry(
 			pBase, detail, displacement, disp_scale,
-			double_sided, face_normals, seam_fold );
+			double_sided, face_normals, seam_fold,
+			lazy, patch_subdivision, lazy_cache_triangles );
 		GlobalLog()->PrintNew( pGeom, __FILE__, __LINE__, "displaced geometry" );
 
 		if( !pGeom->IsValid() ) {
@@ -734,6 +736,29 @@ namespace RISE
 		return true;
 	}
 
+	bool RISE_API_CreateInstanceArrayGeometry(
+						IGeometry**         ppi,
+						const IGeometry*    pChild,
+						const unsigned int  numInstances,
+						const double*       matrices
+						)
+	{
+		if( !ppi || !pChild || (numInstances && !matrices) ) {
+			return false;
+		}
+
+		if( dynamic_cast<const InstanceArrayGeometry*>( pChild ) ) {
+			GlobalLog()->Print( eLog_Error, "RISE_API_CreateInstanceArrayGeometry: the child geometry is itself an instance array; nest arrays by placing objects instead" );
+			*ppi = 0;
+			return false;
+		}
+
+		(*ppi) = new InstanceArrayGeometry( *pChild, numInstances, matrices );
+		GlobalLog()->PrintNew( *ppi, __FILE__, __LINE__, "instance array geometry" );
+
+		return true;
+	}
+
 	bool RISE_API_CreateSDFGeometry(
 						IGeometry**          ppi,
 						const char*          szFileName,
@@ -7085,8 +7110,10 @@ namespace RISE
 #include "Materials/HomogeneousMedium.h"
 #include "Materials/HeterogeneousMedium.h"
 #include "Volume/Volume.h"
+#include "Volume/SparseVolume.h"
 #include "Volume/VolumeAccessor_NNB.h"
 #include "Volume/VolumeAccessor_TRI.h"
+#include "Volume/VolumeAccessor_BrickedTRI.h"
 #include "Volume/VolumeAccessor_TriCubic.h"
 #include "Volume/VolumeAccessor_Painter.h"
 #include "Utilities/CubicInterpolator.h"
@@ -7193,6 +7220,45 @@ namespace RISE
 		}
 	}
 
+	/// Loads the slices either densely or as sparse bricks and binds an
+	/// accessor to them.  For sparse volumes the brick interface is
+	/// returned too, so the medium can build its majorant grid from the
+	/// brick maxima; the accessor's reference keeps it alive.
+	static IVolumeAccessor* MediumVolumeFromSlices(
+		const char* szVolumeFilePattern,
+		const unsigned int volWidth,
+		const unsigned int volHeight,
+		const unsigned int volStartZ,
+		const unsigned int volEndZ,
+		const char accessor,
+		const bool sparse,
+		const IBrickedVolume** ppBricks
+		)
+	{
+		*ppBricks = 0;
+
+		if( !sparse ) {
+			Volume<unsigned char>* pVol = new Volume<unsigned char>(
+				szVolumeFilePattern, volWidth, volHeight, volStartZ, volEndZ );
+
+			IVolumeAccessor* pAccessor = MediumVolumeAccessorFromChar( accessor );
+			pAccessor->BindVolume( pVol );
+			safe_release( pVol );
+			return pAccessor;
+		}
+
+		SparseVolume<unsigned char>* pVol = new SparseVolume<unsigned char>(
+			szVolumeFilePattern, volWidth, volHeight, volStartZ, volEndZ );
+
+		// Trilinear lookups fetch their stencil a brick at a time
+		IVolumeAccessor* pAccessor = (accessor == 't') ?
+			new VolumeAccessor_BrickedTRI() : MediumVolumeAccessorFromChar( accessor );
+		pAccessor->BindVolume( pVol );
+		*ppBricks = pVol;
+		safe_release( pVol );
+		return pAccessor;
+	}
+
 	bool RISE_API_CreateHeterogeneousMedium(
 								IMedium** ppi,
 								const RISEPel& max_sigma_a,
@@ -7205,27 +7271,25 @@ namespace RISE
 								const unsigned int volEndZ,
 								const char accessor,
 								const Point3& bboxMin,
-								const Point3& bboxMax
+								const Point3& bboxMax,
+								const bool sparse
 								)
 	{
 		if( !ppi ) {
 			return false;
 		}
 
-		// Load the volume data
-		Volume<unsigned char>* pVol = new Volume<unsigned char>(
-			szVolumeFilePattern, volWidth, volHeight, volStartZ, volEndZ );
-
-		// Create the volume accessor
-		IVolumeAccessor* pAccessor = MediumVolumeAccessorFromChar( accessor );
-		pAccessor->BindVolume( pVol );
-		safe_release( pVol );
+		// Load the volume data and create the volume accessor
+		const IBrickedVolume* pBricks = 0;
+		IVolumeAccessor* pAccessor = MediumVolumeFromSlices(
+			szVolumeFilePattern, volWidth, volHeight, volStartZ, volEndZ,
+			accessor, sparse, &pBricks );
 
 		const unsigned int volDepth = volEndZ - volStartZ + 1;
 
 		(*ppi) = new HeterogeneousMedium(
 			max_sigma_a, max_sigma_s, phase, *pAccessor,
-			volWidth, volHeight, volDepth, bboxMin, bboxMax );
+			volWidth, volHeight, volDepth, bboxMin, bboxMax, pBricks );
 		safe_release( pAccessor );
 
 		GlobalLog()->PrintNew( *ppi, __FILE__, __LINE__, "heterogeneous medium" );
@@ -7245,25 +7309,24 @@ namespace RISE
 								const unsigned int volEndZ,
 								const char accessor,
 								const Point3& bboxMin,
-								const Point3& bboxMax
+								const Point3& bboxMax,
+								const bool sparse
 								)
 	{
 		if( !ppi ) {
 			return false;
 		}
 
-		Volume<unsigned char>* pVol = new Volume<unsigned char>(
-			szVolumeFilePattern, volWidth, volHeight, volStartZ, volEndZ );
-
-		IVolumeAccessor* pAccessor = MediumVolumeAccessorFromChar( accessor );
-		pAccessor->BindVolume( pVol );
-		safe_release( pVol );
+		const IBrickedVolume* pBricks = 0;
+		IVolumeAccessor* pAccessor = MediumVolumeFromSlices(
+			szVolumeFilePattern, volWidth, volHeight, volStartZ, volEndZ,
+			accessor, sparse, &pBricks );
 
 		const unsigned int volDepth = volEndZ - volStartZ + 1;
 
 		(*ppi) = new HeterogeneousMedium(
 			max_sigma_a, max_sigma_s, emission, phase, *pAccessor,
-			volWidth, volHeight, volDepth, bboxMin, bboxMax );
+			volWidth, volHeight, volDepth, bboxMin, bboxMax, pBricks );
 		safe_release( pAccessor );
 
 		GlobalLog()->PrintNew( *ppi, __FILE__, __LINE__, "heterogeneous medium with emission" );
@@ -435,21 +435,18 @@ namespace RISE
 	//! Creates a bezier-patch geometry with analytic ray intersection.
 	//! Displacement / bulk tessellation are handled by wrapping this in a
 	//! DisplacedGeometry (or `displaced_geometry` in the scene file).
+	//! The patches are accelerated by a BVH; the legacy `max_patches`,
+	//! `max_recur`, `use_bsp` parameters are gone.
 	/// \return TRUE if successful, FALSE otherwise
 	bool RISE_API_CreateBezierPatchGeometry(
-						IBezierPatchGeometry** ppi,				///< [out] Pointer to recieve the geometry
-						const unsigned int max_patches,			///< [in] Maximum number of patches per accelerator leaf
-						const unsigned char max_recur,			///< [in] Maximum accelerator recursion depth
-						const bool use_bsp						///< [in] Use BSP tree (true) or Octree (false)
+						IBezierPatchGeometry** ppi				///< [out] Pointer to recieve the geometry
 						);
 
-	//! Creates a geometry object made up of a series of bilinear patches
+	//! Creates a geometry object made up of a series of bilinear patches,
+	//! accelerated by a BVH
 	/// \return TRUE if successful, FALSE otherwise
 	bool RISE_API_CreateBilinearPatchGeometry(
-						IBilinearPatchGeometry** ppi,			///< [out] Pointer to recieve the geometry
-						const unsigned int max_patches,			///< [in] Maximum number of patches / octant node
-						const unsigned char max_recur,			///< [in] Maximum depth of the octree or bsp tree
-						const bool use_bsp						///< [in] Use a BSP tree rather than an Octree
+						IBilinearPatchGeometry** ppi			///< [out] Pointer to recieve the geometry
 						);
 
 	//! Creates a displaced geometry that wraps any existing IGeometry, tessellates it, and
@@ -466,7 +463,22 @@ namespace RISE
 						const Scalar        disp_scale,			///< [in] Displacement scale factor
 						const bool          double_sided,		///< [in] Are generated polygons double-sided?
 						const bool          face_normals,		///< [in] Use face normals rather than topologically re-averaged vertex normals
-						const bool          seam_fold = true	///< [in] Tent-fold UV before displacement (closed wrap-seam surfaces); FALSE for open Cartesian fields
+						const bool          seam_fold = true,	///< [in] Tent-fold UV before displacement (closed wrap-seam surfaces); FALSE for open Cartesian fields
+						const bool          lazy = false,		///< [in] Displace coarse patches on demand into a bounded cache instead of baking the whole mesh
+						const unsigned int  patch_subdivision = 8,	///< [in] Lazy mode: micro-mesh subdivisions per coarse patch edge
+						const unsigned int  lazy_cache_triangles = 1u<<20	///< [in] Lazy mode: resident micro-mesh triangle budget
+						);
+
+	//! Creates an instance array: many placed copies of one shared child
+	//! geometry, each stored as a packed 3x4 transform, with its own BVH
+	//! over the instances.  Place the array in the scene with an ordinary
+	//! object.  The child must not itself be an instance array.
+	/// \return TRUE if successful, FALSE otherwise
+	bool RISE_API_CreateInstanceArrayGeometry(
+						IGeometry**         ppi,				///< [out] Pointer to receive the geometry
+						const IGeometry*    pChild,				///< [in] Shared geometry (AddRef'd internally)
+						const unsigned int  numInstances,		///< [in] Number of instances
+						const double*       matrices			///< [in] numInstances column-major 4x4 instance transforms
 						);
 
 	//! Creates a signed-distance-field (implicit) geometry: transformed
@@ -3338,7 +3350,8 @@ bool RISE_API_CreateFinalGatherShaderOp(
 								const unsigned int volEndZ,			///< [in] Ending z slice index
 								const char accessor,				///< [in] Volume accessor type: 'n'=NNB, 't'=trilinear
 								const Point3& bboxMin,				///< [in] World-space AABB minimum corner
-								const Point3& bboxMax				///< [in] World-space AABB maximum corner
+								const Point3& bboxMax,				///< [in] World-space AABB maximum corner
+								const bool sparse = false			///< [in] Store the volume as sparse 8^3 bricks (empty bricks take no memory)
 								);
 
 	//! Creates a heterogeneous participating medium with emission
@@ -3356,7 +3369,8 @@ bool RISE_API_CreateFinalGatherShaderOp(
 								const unsigned int volEndZ,			///< [in] Ending z slice index
 								const char accessor,				///< [in] Volume accessor type: 'n'=NNB, 't'=trilinear
 								const Point3& bboxMin,				///< [in] World-space AABB minimum corner
-								const Point3& bboxMax				///< [in] World-space AABB maximum corner
+								const Point3& bboxMax,				///< [in] World-space AABB maximum corner
+								const bool sparse = false			///< [in] Store the volume as sparse 8^3 bricks (empty bricks take no memory)
 								);
 
 
@@ -25,12 +25,17 @@
 
 #include "EXRWriter.h"
 #include "../Interfaces/ILog.h"
+#include "../Interfaces/IOptions.h"
+#include "../Utilities/ThreadPool.h"
 #include "../Version.h"
+#include <cstddef>
+#include <mutex>
 
 #ifndef NO_EXR_SUPPORT
 #include <ImfChromaticitiesAttribute.h>
 #include <ImfStringAttribute.h>
 #include <ImfFloatAttribute.h>
+#include <ImfThreading.h>
 #endif
 
 using namespace RISE;
@@ -46,15 +51,25 @@ EXRWriter::EXRWriter(
   out( buffer_ ),
   exrout( 0 ),
   exrout_float( 0 ),
+  tiled_header( 0 ),
   buffer( buffer_ ),
   color_space( color_space_ ),
   compression( compression_ ),
   with_alpha( with_alpha_ ),
   write_float( write_float_ ),
+  tiled( false ),
+  tile_size( 64 ),
   horzpixels( 0 ),
   scanlines( 0 )
 {
 	buffer.addref();
+
+	IOptions& options = GlobalOptions();
+	tiled = options.ReadBool( "exr_tiled", false );
+	const int size = options.ReadInt( "exr_tile_size", 64 );
+	tile_size = size >= 8 ? static_cast<unsigned int>( size ) : 8;
+
+	ConfigureThreading();
 }
 #else
 EXRWriter::EXRWriter(
@@ -68,6 +83,8 @@ EXRWriter::EXRWriter(
   compression( compression_ ),
   with_alpha( with_alpha_ ),
   write_float( write_float_ ),
+  tiled( false ),
+  tile_size( 64 ),
   horzpixels( 0 ),
   scanlines( 0 )
 {
@@ -79,36 +96,35 @@ EXRWriter::~EXRWriter( )
 #ifndef NO_EXR_SUPPORT
 	delete exrout_float;
 	exrout_float = 0;
+	delete tiled_header;
+	tiled_header = 0;
 #endif
 	buffer.release();
 }
 
-void EXRWriter::BeginWrite( const unsigned int width, const unsigned int height )
+void EXRWriter::ConfigureThreading()
 {
 #ifndef NO_EXR_SUPPORT
-	// OpenEXR's RgbaOutputFile constructor accepts (1, 1) and larger
-	// but rejects 0 dimensions inconsistently across versions.  Reject
-	// here so we don't drag the OpenEXR error into the writer's call
-	// site; a zero-size image is meaningless anyway.
-	if( width == 0 || height == 0 ) {
-		GlobalLog()->PrintEx( eLog_Error,
-			"EXRWriter::BeginWrite:: refusing zero-size image (%ux%u)",
-			width, height );
-		// Leave exrout / horzpixels / scanlines at their defaults (0 / NULL);
-		// WriteColor will be a no-op because exrbuffer is empty, and EndWrite
-		// will skip the write because exrout is null.
-		return;
-	}
-
-	if( exrout ) {
-		// this would be bad
-		GlobalLog()->PrintEasyError( "exrout object already exists!" );
-		delete exrout;
-		exrout = 0;	// reset before re-construction so a throwing
-					// RgbaOutputFile ctor doesn't leave us with a
-					// dangling pointer the next call would re-delete
-	}
+	static std::once_flag once;
+	std::call_once( once, []()
+	{
+		int threads = GlobalOptions().ReadInt( "exr_threads", -1 );
+		if( threads < 0 ) {
+			threads = static_cast<int>( GlobalThreadPool().NumWorkers() );
+		}
+		Imf::setGlobalThreadCount( threads );
+		GlobalLog()->PrintEx( eLog_Info, "EXRWriter:: OpenEXR compresses with %d thread(s)", threads );
+	} );
+#endif
+}
 
+#ifndef NO_EXR_SUPPORT
+Imf::Header EXRWriter::MakeHeader(
+	const unsigned int    width,
+	const unsigned int    height,
+	const COLOR_SPACE     color_space,
+	const EXR_COMPRESSION compression )
+{
 	// Map our compression enum to OpenEXR's.  Anything outside the
 	// supported set falls back to PIZ (the v0 default) with a warning.
 	Imf::Compression imfCompression = Imf::PIZ_COMPRESSION;
@@ -189,12 +205,67 @@ void EXRWriter::BeginWrite( const unsigned int width, const unsigned int height
 	// use this to scale HDR display output appropriately.
 	header.insert( "whiteLuminance", Imf::FloatAttribute( 1.0f ) );
 
+	return header;
+}
+#endif
+
+void EXRWriter::BeginWrite( const unsigned int width, const unsigned int height )
+{
+#ifndef NO_EXR_SUPPORT
+	// OpenEXR's RgbaOutputFile constructor accepts (1, 1) and larger
+	// but rejects 0 dimensions inconsistently across versions.  Reject
+	// here so we don't drag the OpenEXR error into the writer's call
+	// site; a zero-size image is meaningless anyway.
+	if( width == 0 || height == 0 ) {
+		GlobalLog()->PrintEx( eLog_Error,
+			"EXRWriter::BeginWrite:: refusing zero-size image (%ux%u)",
+			width, height );
+		// Leave exrout / horzpixels / scanlines at their defaults (0 / NULL);
+		// WriteColor will be a no-op because exrbuffer is empty, and EndWrite
+		// will skip the write because exrout is null.
+		return;
+	}
+
+	if( exrout ) {
+		// this would be bad
+		GlobalLog()->PrintEasyError( "exrout object already exists!" );
+		delete exrout;
+		exrout = 0;	// reset before re-construction so a throwing
+					// RgbaOutputFile ctor doesn't leave us with a
+					// dangling pointer the next call would re-delete
+	}
+
+	Imf::Header header = MakeHeader( width, height, color_space, compression );
+
 	// with_alpha controls the channel set: RGBA vs RGB only (smaller
 	// files; appropriate for outputs where alpha carries no meaningful
 	// information).
 	horzpixels = width;
 	scanlines = height;
 
+	if( tiled ) {
+		// Tiled: the pixels are buffered exactly as below, and the file
+		// is created in EndWrite once they are all present, so that
+		// one writeTiles call can compress every tile in parallel.
+		delete tiled_header;
+		tiled_header = 0;
+		header.setTileDescription( Imf::TileDescription( tile_size, tile_size, Imf::ONE_LEVEL ) );
+		const Imf::PixelType type = write_float ? Imf::FLOAT : Imf::HALF;
+		header.channels().insert( "R", Imf::Channel( type ) );
+		header.channels().insert( "G", Imf::Channel( type ) );
+		header.channels().insert( "B", Imf::Channel( type ) );
+		if( with_alpha ) {
+			header.channels().insert( "A", Imf::Channel( type ) );
+		}
+		tiled_header = new Imf::Header( header );
+		if( write_float ) {
+			floatbuffer.assign( static_cast<std::size_t>( width ) * height * 4u, 0.0f );
+		} else {
+			exrbuffer.resizeErase( height, width );
+		}
+		return;
+	}
+
 	if( write_float ) {
 		// 32-bit FLOAT path.  `Imf::Rgba` is half-only (FP16, max 65504),
 		// which silently clamps legitimate bright HDR pixels to +Inf on
@@ -253,6 +324,43 @@ void EXRWriter::EndWrite( )
 	// Write out the data to the memory buffer.  Skip when BeginWrite
 	// rejected a zero-size image (both output files left null) or when
 	// the caller never called BeginWrite at all.
+	if( tiled ) {
+		if( !tiled_header ) {
+			return;
+		}
+		Imf::FrameBuffer fb;
+		if( write_float ) {
+			char* const base = reinterpret_cast<char*>( floatbuffer.data() );
+			const std::size_t xstride = 4u * sizeof( float );
+			const std::size_t ystride =
+				static_cast<std::size_t>( horzpixels ) * 4u * sizeof( float );
+			fb.insert( "R", Imf::Slice( Imf::FLOAT, base + 0u * sizeof( float ), xstride, ystride ) );
+			fb.insert( "G", Imf::Slice( Imf::FLOAT, base + 1u * sizeof( float ), xstride, ystride ) );
+			fb.insert( "B", Imf::Slice( Imf::FLOAT, base + 2u * sizeof( float ), xstride, ystride ) );
+			if( with_alpha ) {
+				fb.insert( "A", Imf::Slice( Imf::FLOAT, base + 3u * sizeof( float ), xstride, ystride ) );
+			}
+		} else {
+			char* const base = reinterpret_cast<char*>( &exrbuffer[0][0] );
+			const std::size_t xstride = sizeof( Imf::Rgba );
+			const std::size_t ystride = static_cast<std::size_t>( horzpixels ) * sizeof( Imf::Rgba );
+			fb.insert( "R", Imf::Slice( Imf::HALF, base + offsetof( Imf::Rgba, r ), xstride, ystride ) );
+			fb.insert( "G", Imf::Slice( Imf::HALF, base + offsetof( Imf::Rgba, g ), xstride, ystride ) );
+			fb.insert( "B", Imf::Slice( Imf::HALF, base + offsetof( Imf::Rgba, b ), xstride, ystride ) );
+			if( with_alpha ) {
+				fb.insert( "A", Imf::Slice( Imf::HALF, base + offsetof( Imf::Rgba, a ), xstride, ystride ) );
+			}
+		}
+
+		Imf::TiledOutputFile file( out, *tiled_header );
+		file.setFrameBuffer( fb );
+		file.writeTiles( 0, file.numXTiles() - 1, 0, file.numYTiles() - 1 );
+
+		delete tiled_header;
+		tiled_header = 0;
+		return;
+	}
+
 	if( write_float ) {
 		if( !exrout_float ) {
 			return;
@@ -2,8 +2,13 @@
 //
 //  EXRWriter.h - Definition of a class that can write raster images
 //  to an OpenEXR file.
-//                
 //
+//  Compression runs on OpenEXR's own thread pool, sized once per
+//  process from the exr_threads option: every line buffer (scanline
+//  files) or tile (exr_tiled TRUE) of the frame is handed to
+//  OpenEXR in a single write call, so the blocks compress in
+//  parallel.
+////
 //  Author: Aravind Krishnaswamy
 //  Date of Birth: March 10, 2006
 //  Tabs: 4
@@ -26,6 +31,8 @@
 	// OpenEXR includes
 	#include <ImfRgbaFile.h>
 	#include <ImfOutputFile.h>
+	#include <ImfTiledOutputFile.h>
+	#include <ImfHeader.h>
 	#include <ImfChannelList.h>
 	#include <ImfFrameBuffer.h>
 	#include <ImfIO.h>
@@ -77,6 +84,7 @@ namespace RISE
 			Imf::OutputFile*		exrout_float;	///< 32-bit FLOAT path; NULL unless write_float
 			Imf::Array2D<Imf::Rgba>	exrbuffer;		///< half scanline buffer
 			std::vector<float>		floatbuffer;	///< interleaved R,G,B,A float scanline buffer (write_float)
+			Imf::Header*			tiled_header;	///< header for the tiled file, created in EndWrite; NULL unless tiled
 		#endif
 
 			IWriteBuffer&			buffer;
@@ -84,6 +92,8 @@ namespace RISE
 			EXR_COMPRESSION			compression;
 			bool					with_alpha;
 			bool					write_float;	///< true => 32-bit FLOAT channels (no FP16 65504 clamp); false => half
+			bool					tiled;			///< true => tiled file (exr_tiled option)
+			unsigned int			tile_size;		///< tile edge in pixels when tiled
 			unsigned int			horzpixels;
 			unsigned int			scanlines;
 
@@ -147,6 +157,22 @@ namespace RISE
 			void	BeginWrite( const unsigned int width, const unsigned int height );
 			void	WriteColor( const RISEColor& c, const unsigned int x, const unsigned int y );
 			void	EndWrite( );
+
+		#ifndef NO_EXR_SUPPORT
+			//! The header every RISE EXR starts from: size, compression,
+			//! software stamp, chromaticities for `color_space` and
+			//! whiteLuminance.  No channels.
+			static Imf::Header MakeHeader(
+				const unsigned int    width,
+				const unsigned int    height,
+				const COLOR_SPACE     color_space,
+				const EXR_COMPRESSION compression );
+		#endif
+
+			//! Sizes OpenEXR's global compression thread pool from the
+			//! exr_threads option (default: one per render worker).
+			//! Only the first call does anything.
+			static void ConfigureThreading();
 		};
 	}
 }
@@ -15,9 +15,13 @@
 #include "pch.h"
 #include "PNGWriter.h"
 #include "../Interfaces/ILog.h"
+#include "../Interfaces/IOptions.h"
 #ifndef NO_PNG_SUPPORT
 	#include <png.h>
 	#include <zlib.h>
+	#include <cstring>
+	#include <vector>
+	#include "../Utilities/ThreadPool.h"
 #endif
 
 using namespace RISE;
@@ -27,7 +31,8 @@ PNGWriter::PNGWriter( IWriteBuffer& buffer, const unsigned char bpp_, const COLO
   pWriteBuffer( buffer ),
   pBuffer( 0 ),
   bpp( bpp_ ),
-  color_space( color_space_ )
+  color_space( color_space_ ),
+  bParallelDeflate( GlobalOptions().ReadBool( "png_parallel_deflate", true ) )
 {
 	pWriteBuffer.addref();
 
@@ -174,8 +179,285 @@ png_flush(png_structp /*png_ptr*/)
 	// No flush action required!
 }
 
+namespace
+{
+	// Target uncompressed bytes per parallel deflate slab
+	const unsigned int kDeflateSlabBytes = 256*1024;
+
+	// Largest IDAT chunk written by the parallel path
+	const size_t kMaxIDATBytes = 1024*1024;
+
+	void PutU32( std::vector<unsigned char>& v, const unsigned int n )
+	{
+		v.push_back( static_cast<unsigned char>( (n>>24)&0xFF ) );
+		v.push_back( static_cast<unsigned char>( (n>>16)&0xFF ) );
+		v.push_back( static_cast<unsigned char>( (n>>8)&0xFF ) );
+		v.push_back( static_cast<unsigned char>( n&0xFF ) );
+	}
+
+	void WriteChunk( IWriteBuffer& buffer, const char* type, const unsigned char* data, const size_t length )
+	{
+		std::vector<unsigned char> head;
+		PutU32( head, static_cast<unsigned int>( length ) );
+		head.insert( head.end(), type, type+4 );
+
+		uLong crc = crc32( 0L, Z_NULL, 0 );
+		crc = crc32( crc, &head[4], 4 );
+		if( length ) {
+			crc = crc32( crc, data, static_cast<uInt>( length ) );
+		}
+
+		std::vector<unsigned char> tail;
+		PutU32( tail, static_cast<unsigned int>( crc ) );
+
+		buffer.ResizeForMore( static_cast<unsigned int>( head.size() + length + tail.size() ) );
+		buffer.setBytes( &head[0], static_cast<unsigned int>( head.size() ) );
+		if( length ) {
+			buffer.setBytes( data, static_cast<unsigned int>( length ) );
+		}
+		buffer.setBytes( &tail[0], static_cast<unsigned int>( tail.size() ) );
+	}
+
+	// Paeth predictor, PNG spec 9.4
+	inline unsigned char Paeth( const int a, const int b, const int c )
+	{
+		const int p = a + b - c;
+		const int pa = p > a ? p - a : a - p;
+		const int pb = p > b ? p - b : b - p;
+		const int pc = p > c ? p - c : c - p;
+		if( pa <= pb && pa <= pc ) return static_cast<unsigned char>( a );
+		if( pb <= pc ) return static_cast<unsigned char>( b );
+		return static_cast<unsigned char>( c );
+	}
+
+	// Filters one row the way libpng's adaptive filtering does with
+	// PNG_ALL_FILTERS, as the libpng path asks for: every filter type
+	// is tried and the one whose output has the smallest sum of
+	// absolute (signed byte) values wins, earliest type on ties.  `out`
+	// receives the filter type byte and the row.
+	void FilterRow(
+		const unsigned char* row,
+		const unsigned char* prior,			// NULL for the first row
+		const size_t length,
+		const unsigned int bpp,
+		unsigned char* out,
+		unsigned char* scratch
+		)
+	{
+		unsigned long best = ~0UL;
+		for( unsigned char type = 0; type < 5; type++ ) {
+			unsigned char* dst = type == 0 ? out + 1 : scratch + 1;
+			unsigned long sum = 0;
+			for( size_t i = 0; i < length; i++ ) {
+				const int x = row[i];
+				const int a = i >= bpp ? row[i-bpp] : 0;
+				const int b = prior ? prior[i] : 0;
+				const int c = (prior && i >= bpp) ? prior[i-bpp] : 0;
+				unsigned char v = 0;
+				switch( type ) {
+				case 0: v = static_cast<unsigned char>( x ); break;
+				case 1: v = static_cast<unsigned char>( x - a ); break;
+				case 2: v = static_cast<unsigned char>( x - b ); break;
+				case 3: v = static_cast<unsigned char>( x - ((a + b) >> 1) ); break;
+				case 4: v = static_cast<unsigned char>( x - Paeth( a, b, c ) ); break;
+				}
+				dst[i] = v;
+				sum += v < 128 ? v : 256 - v;
+			}
+			if( sum < best ) {
+				best = sum;
+				if( type != 0 ) {
+					memcpy( out + 1, scratch + 1, length );
+				}
+				out[0] = type;
+			}
+		}
+	}
+
+	// Raw-deflates one slab.  Every slab but the last ends on a byte
+	// aligned sync flush with no final block, so the slabs concatenate
+	// into one valid deflate stream.
+	bool DeflateSlab(
+		const unsigned char* dict,
+		const unsigned int dictLength,
+		const unsigned char* in,
+		const unsigned int inLength,
+		const bool last,
+		std::vector<unsigned char>& out
+		)
+	{
+		z_stream strm;
+		memset( &strm, 0, sizeof( strm ) );
+		if( deflateInit2( &strm, Z_BEST_COMPRESSION, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY ) != Z_OK ) {
+			return false;
+		}
+
+		if( dictLength ) {
+			deflateSetDictionary( &strm, dict, dictLength );
+		}
+
+		out.resize( deflateBound( &strm, inLength ) + 16 );
+		strm.next_in = const_cast<Bytef*>( in );
+		strm.avail_in = inLength;
+
+		const int flush = last ? Z_FINISH : Z_SYNC_FLUSH;
+		int ret = Z_OK;
+		for(;;) {
+			const size_t done = strm.total_out;
+			strm.next_out = &out[done];
+			strm.avail_out = static_cast<uInt>( out.size() - done );
+			ret = deflate( &strm, flush );
+			if( ret == Z_STREAM_ERROR || strm.avail_out != 0 ) {
+				break;
+			}
+			out.resize( out.size() * 2 );
+		}
+
+		out.resize( strm.total_out );
+		deflateEnd( &strm );
+		return ret != Z_STREAM_ERROR && ( !last || ret == Z_STREAM_END );
+	}
+}
+
+void PNGWriter::WriteParallelDeflate( )
+{
+	const unsigned int bytesPerPixel = 4*(bpp>>3);
+	const unsigned int rowBytes = bufW*bytesPerPixel + 1;		// filter byte + RGBA
+	const unsigned int slabRows = (kDeflateSlabBytes + rowBytes - 1) / rowBytes;
+	const unsigned int slabs = (bufH + slabRows - 1) / slabRows;
+
+	// Pixels in file (RGBA) order, then the filtered scanlines that
+	// get compressed; pBuffer is BGRA
+	const size_t pixelRowBytes = static_cast<size_t>( bufW ) * bytesPerPixel;
+	std::vector<unsigned char> rgba( pixelRowBytes * bufH );
+	std::vector<unsigned char> raw( static_cast<size_t>( rowBytes ) * bufH );
+	std::vector< std::vector<unsigned char> > packed( slabs );
+	std::vector<uLong> adlers( slabs );
+	std::vector<char> ok( slabs, 0 );
+
+	ThreadPool& pool = GlobalThreadPool();
+	pool.ParallelFor( slabs, [&]( unsigned int slab )
+	{
+		const unsigned int y0 = slab*slabRows;
+		const unsigned int y1 = (y0 + slabRows < bufH) ? y0 + slabRows : bufH;
+		const unsigned int channelBytes = bpp>>3;
+
+		for( unsigned int y = y0; y < y1; y++ ) {
+			const unsigned char* src = &pBuffer[ y * pixelRowBytes ];
+			unsigned char* dst = &rgba[ y * pixelRowBytes ];
+			for( unsigned int x = 0; x < bufW; x++, src += bytesPerPixel, dst += bytesPerPixel ) {
+				for( unsigned int b = 0; b < channelBytes; b++ ) {
+					dst[b] = src[2*channelBytes + b];
+					dst[channelBytes + b] = src[channelBytes + b];
+					dst[2*channelBytes + b] = src[b];
+					dst[3*channelBytes + b] = src[3*channelBytes + b];
+				}
+			}
+		}
+	} );
+
+	pool.ParallelFor( slabs, [&]( unsigned int slab )
+	{
+		const unsigned int y0 = slab*slabRows;
+		const unsigned int y1 = (y0 + slabRows < bufH) ? y0 + slabRows : bufH;
+		std::vector<unsigned char> scratch( rowBytes );
+
+		for( unsigned int y = y0; y < y1; y++ ) {
+			FilterRow( &rgba[ y * pixelRowBytes ], y ? &rgba[ (y-1) * pixelRowBytes ] : 0,
+				pixelRowBytes, bytesPerPixel, &raw[ static_cast<size_t>( y ) * rowBytes ], &scratch[0] );
+		}
+	} );
+	std::vector<unsigned char>().swap( rgba );
+
+	pool.ParallelFor( slabs, [&]( unsigned int slab )
+	{
+		const size_t begin = static_cast<size_t>( slab ) * slabRows * rowBytes;
+		const size_t end = (slab+1 == slabs) ? raw.size() : begin + static_cast<size_t>( slabRows ) * rowBytes;
+		const unsigned int dictLength = static_cast<unsigned int>( begin < 32768 ? begin : 32768 );
+
+		ok[slab] = DeflateSlab( &raw[begin - dictLength], dictLength, &raw[begin],
+			static_cast<unsigned int>( end - begin ), slab+1 == slabs, packed[slab] );
+		adlers[slab] = adler32( adler32( 0L, Z_NULL, 0 ), &raw[begin], static_cast<uInt>( end - begin ) );
+	} );
+
+	for( unsigned int i = 0; i < slabs; i++ ) {
+		if( !ok[i] ) {
+			GlobalLog()->PrintSourceError( "PNGWriter:: Parallel deflate failed", __FILE__, __LINE__ );
+			return;
+		}
+	}
+
+	// zlib wrapper: CMF/FLG for deflate with a 32K window at maximum
+	// compression, the concatenated slabs, then the Adler-32 of all
+	// the scanlines combined from the per-slab sums
+	std::vector<unsigned char> zstream;
+	zstream.push_back( 0x78 );
+	zstream.push_back( 0xDA );
+	uLong adler = adlers[0];
+	for( unsigned int i = 0; i < slabs; i++ ) {
+		zstream.insert( zstream.end(), packed[i].begin(), packed[i].end() );
+		std::vector<unsigned char>().swap( packed[i] );
+		if( i > 0 ) {
+			const size_t length = (i+1 == slabs) ? raw.size() - static_cast<size_t>( i ) * slabRows * rowBytes :
+				static_cast<size_t>( slabRows ) * rowBytes;
+			adler = adler32_combine( adler, adlers[i], static_cast<z_off_t>( length ) );
+		}
+	}
+	PutU32( zstream, static_cast<unsigned int>( adler ) );
+
+	// Same chunks the libpng path writes: IHDR, gAMA, IDAT..., IEND
+	static const unsigned char signature[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+	pWriteBuffer.ResizeForMore( sizeof( signature ) );
+	pWriteBuffer.setBytes( signature, sizeof( signature ) );
+
+	std::vector<unsigned char> ihdr;
+	PutU32( ihdr, bufW );
+	PutU32( ihdr, bufH );
+	ihdr.push_back( bpp );
+	ihdr.push_back( 6 );		// PNG_COLOR_TYPE_RGB_ALPHA
+	ihdr.push_back( 0 );		// compression
+	ihdr.push_back( 0 );		// filter
+	ihdr.push_back( 0 );		// interlace
+	WriteChunk( pWriteBuffer, "IHDR", &ihdr[0], ihdr.size() );
+
+	double gamma = 1.0;
+	if( bpp == 8 ) {
+		switch( color_space )
+		{
+		case eColorSpace_ROMMRGB_Linear:
+		case eColorSpace_Rec709RGB_Linear:
+			gamma = 1.0;
+			break;
+		case eColorSpace_sRGB:
+			gamma = 1.0/2.2;
+			break;
+		case eColorSpace_ProPhotoRGB:
+			gamma = 1.0/1.8;
+			break;
+		}
+	}
+	std::vector<unsigned char> gama;
+	PutU32( gama, static_cast<unsigned int>( gamma*100000.0 + 0.5 ) );
+	WriteChunk( pWriteBuffer, "gAMA", &gama[0], gama.size() );
+
+	for( size_t offset = 0; offset < zstream.size(); offset += kMaxIDATBytes ) {
+		const size_t length = (zstream.size() - offset < kMaxIDATBytes) ? zstream.size() - offset : kMaxIDATBytes;
+		WriteChunk( pWriteBuffer, "IDAT", &zstream[offset], length );
+	}
+
+	WriteChunk( pWriteBuffer, "IEND", 0, 0 );
+}
+
 void PNGWriter::EndWrite( )
 {
+	// Worth splitting only when there are at least two slabs
+	if( pBuffer && bParallelDeflate &&
+		static_cast<size_t>( bufW*4*(bpp>>3) + 1 ) * bufH >= 2*kDeflateSlabBytes )
+	{
+		WriteParallelDeflate();
+		return;
+	}
+
 	if( pBuffer )
 	{
 		// Setup the png structure info
@@ -201,7 +483,10 @@ void PNGWriter::EndWrite( )
 		// Set a write function to write to our buffer rather than a file
 		png_set_write_fn( png_ptr, (void*)&pWriteBuffer, png_write_data, png_flush );
 
-		png_set_filter(png_ptr, 0, PNG_NO_FILTERS);
+		// Adaptive filtering over all five types.  This is what libpng
+		// has always done here (it reads an empty mask as "default"),
+		// spelled out so WriteParallelDeflate's FilterRow can match it.
+		png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE, PNG_ALL_FILTERS);
 		png_set_compression_level(png_ptr, Z_BEST_COMPRESSION);
 		png_set_bgr(png_ptr);
 
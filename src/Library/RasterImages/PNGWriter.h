@@ -2,8 +2,14 @@
 //
 //  PNGWriter.h - Definition of a class that can write raster images
 //  to a PNG MemoryBuffer.
-//                
 //
+//  Large images are deflated in parallel (option png_parallel_deflate):
+//  the scanlines are cut into fixed-height slabs, each slab is
+//  compressed on the global thread pool as its own raw deflate block
+//  sequence primed with the previous slab's last 32KB, and the pieces
+//  are stitched into a single zlib stream.  Slab height depends only
+//  on the image size, so the file is the same for any thread count.
+////
 //  Author: Aravind Krishnaswamy
 //  Date of Birth: August 13, 2001
 //  Tabs: 4
@@ -34,6 +40,9 @@ namespace RISE
 			unsigned char		bpp;
 
 			COLOR_SPACE			color_space;
+			bool				bParallelDeflate;
+
+			void	WriteParallelDeflate( );
 
 		public:
 			PNGWriter( IWriteBuffer& buffer, const unsigned char bpp, const COLOR_SPACE color_space_ );
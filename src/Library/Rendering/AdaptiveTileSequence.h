@@ -0,0 +1,132 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  AdaptiveTileSequence.h - Rasterize sequence for the passes of an
+//    adaptive progressive render.  Returns only the tiles that still
+//    have unfinished pixels, largest remaining error first.
+//
+//    Tiles are cut exactly as MortonRasterizeSequence cuts them, then
+//    scored with ProgressiveFilm::TileRemainingError.  Finished tiles
+//    are dropped, so late passes over a mostly converged image pay no
+//    dispatch or setup for them.  The rest go out in descending error
+//    order, so the tiles that will take longest start first and do
+//    not hold up the end of the pass.  Ties keep Morton order.
+//
+//    Rank can be called before the pass to learn how many tiles are
+//    left; Begin then reuses that ranking if the bounds match.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//  Comments:
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#ifndef ADAPTIVE_TILE_SEQUENCE_
+#define ADAPTIVE_TILE_SEQUENCE_
+
+#include "MortonRasterizeSequence.h"
+#include "ProgressiveFilm.h"
+
+namespace RISE
+{
+	namespace Implementation
+	{
+		class AdaptiveTileSequence : public MortonRasterizeSequence
+		{
+		protected:
+			virtual ~AdaptiveTileSequence()
+			{
+			}
+
+			const ProgressiveFilm&	film;
+			const unsigned int		targetSamples;
+
+			bool			ranked;
+			unsigned int	rankedBounds[4];
+			Scalar			remainingError;
+
+		public:
+			AdaptiveTileSequence(
+				const unsigned int tileSize_,
+				const ProgressiveFilm& film_,
+				const unsigned int targetSamples_			///< [in] Progressive sample budget, as for IsTileDone
+				) :
+			MortonRasterizeSequence( tileSize_ ),
+			film( film_ ),
+			targetSamples( targetSamples_ ),
+			ranked( false ),
+			remainingError( 0 )
+			{
+				rankedBounds[0] = rankedBounds[1] = rankedBounds[2] = rankedBounds[3] = 0;
+			}
+
+			//! Builds and ranks the tile list, returning how many tiles
+			//! still have work
+			unsigned int Rank( const unsigned int startx, const unsigned int endx, const unsigned int starty, const unsigned int endy )
+			{
+				MortonRasterizeSequence::Begin( startx, endx, starty, endy );
+
+				struct ScoredTile {
+					Scalar		error;
+					Rect		rect;
+				};
+				std::vector<ScoredTile> scored;
+				scored.reserve( tiles.size() );
+				remainingError = 0;
+				for( size_t i = 0; i < tiles.size(); i++ ) {
+					const Scalar error = film.TileRemainingError( tiles[i], targetSamples );
+					if( error > 0 ) {
+						ScoredTile st = { error, tiles[i] };
+						scored.push_back( st );
+						remainingError += error;
+					}
+				}
+
+				std::stable_sort( scored.begin(), scored.end(),
+					[]( const ScoredTile& a, const ScoredTile& b ) {
+						return a.error > b.error;
+					}
+				);
+
+				tiles.clear();
+				for( size_t i = 0; i < scored.size(); i++ ) {
+					tiles.push_back( scored[i].rect );
+				}
+
+				ranked = true;
+				rankedBounds[0] = startx;
+				rankedBounds[1] = endx;
+				rankedBounds[2] = starty;
+				rankedBounds[3] = endy;
+				cur = 0;
+				return static_cast<unsigned int>( tiles.size() );
+			}
+
+			//! Sum of the remaining error over all tiles at the last Rank
+			Scalar RemainingError() const
+			{
+				return remainingError;
+			}
+
+			void Begin( const unsigned int startx, const unsigned int endx, const unsigned int starty, const unsigned int endy )
+			{
+				if( ranked && rankedBounds[0] == startx && rankedBounds[1] == endx &&
+					rankedBounds[2] == starty && rankedBounds[3] == endy ) {
+					cur = 0;
+					return;
+				}
+				Rank( startx, endx, starty, endy );
+			}
+
+			void End()
+			{
+				MortonRasterizeSequence::End();
+				ranked = false;
+			}
+		};
+	}
+}
+
+#endif
@@ -27,12 +27,14 @@
 
 #include "pch.h"
 #include "../Utilities/RenderParallelScope.h"
+#include "../Utilities/CancellationToken.h"
 #include "../Utilities/FiniteMath.h"
 #include "BDPTRasterizerBase.h"
 #include "../Lights/LightSampler.h"
 #include "../RasterImages/RasterImage.h"
 #include "BlockRasterizeSequence.h"
 #include "MortonRasterizeSequence.h"
+#include "AdaptiveTileSequence.h"
 #include "RasterizeDispatchers.h"
 #include "ThreadLocalSplatBuffer.h"
 #include "../Utilities/ThreadPool.h"
@@ -313,6 +315,9 @@ void BDPTRasterizerBase::RasterizeScene(
 	IRasterizeSequence* pRasterSequence
 	) const
 {
+	// Ambient cancellation token; see PixelBasedRasterizerHelper::RasterizeScene.
+	CancellationScope cancelScope( pProgressFunc );
+
 	// Snapshot the active camera once at entry; structural camera
 	// changes (Add/Remove/SetActive) are required to serialize
 	// against rendering — see IScenePriv.h.
@@ -347,11 +352,23 @@ void BDPTRasterizerBase::RasterizeScene(
 	pCaster->AttachScene( &pScene );
 	pScene.GetObjects()->PrepareForRendering();
 
+	// A cancelled realize pass leaves the TLAS unbuilt; return before
+	// anything traces a ray (see PixelBasedRasterizerHelper::RasterizeScene).
+	if( CancellationToken::Current().IsCancelled() ) {
+		GlobalLog()->PrintEasyEvent( "BDPTRasterizerBase::RasterizeScene:: Cancelled before the main pass" );
+		return;
+	}
+
 	// Per-rasterizer pre-render hook.  BDPT inherits the empty no-op
 	// default from PixelBasedRasterizerHelper; PT/VCM use their own
 	// overrides (e.g. SMS photon-map build, path-guide warmup).
 	PreRenderSetup( pScene, pRect );
 
+	if( CancellationToken::Current().IsCancelled() ) {
+		GlobalLog()->PrintEasyEvent( "BDPTRasterizerBase::RasterizeScene:: Cancelled before the main pass" );
+		return;
+	}
+
 	// Share the RayCaster's prepared LightSampler with the integrator
 	const LightSampler* pLS = pCaster->GetLightSampler();
 	pIntegrator->SetLightSampler( pLS );
@@ -978,6 +995,13 @@ void BDPTRasterizerBase::RasterizeScene(
 			static_cast<double>( totalSPP );
 		double accumulatedProgress = 0;
 
+		// With adaptive sampling on, each pass after the first gets
+		// only the tiles that still have unfinished pixels, worst
+		// first.  They are ranked at the end of the previous pass,
+		// which also tells us when nothing is left to do.
+		const bool bAdaptiveTiles = GetAdaptiveTargetSamples() > 0;
+		AdaptiveTileSequence* pNextSeq = 0;
+
 		for( unsigned int passIdx = 0; passIdx < numPasses; passIdx++ )
 		{
 			const unsigned int passSPP = r_min( spp, totalSPP - passIdx * spp );
@@ -1000,7 +1024,11 @@ void BDPTRasterizerBase::RasterizeScene(
 			mProgressWeight = static_cast<double>( passSPP );
 			mProgressTotal  = totalProgressUnits;
 
-			MortonRasterizeSequence* pPassSeq = new MortonRasterizeSequence( bdptTileEdge );
+			MortonRasterizeSequence* pPassSeq = pNextSeq;
+			if( !pPassSeq ) {
+				pPassSeq = new MortonRasterizeSequence( bdptTileEdge );
+			}
+			pNextSeq = 0;
 			const bool passCompleted = RasterizeBlocksForPass( RuntimeContext::PASS_NORMAL, pScene, *pImage, pRect, *pPassSeq );
 			safe_release( pPassSeq );
 
@@ -1018,7 +1046,16 @@ void BDPTRasterizerBase::RasterizeScene(
 			}
 
 			const bool isFinalPass = ( passIdx == numPasses - 1 );
-			const bool runPreview  = isFinalPass || previewScheduler.ShouldRunPreview();
+
+			bool allTilesDone = false;
+			if( bAdaptiveTiles && !isFinalPass ) {
+				pNextSeq = new AdaptiveTileSequence( bdptTileEdge, progFilm, totalSPP );
+				allTilesDone = pNextSeq->Rank( renderStartX, renderEndX, renderStartY, renderEndY ) == 0;
+			}
+
+			// Resolve right away once everything has converged, so the
+			// convergence check below ends the render
+			const bool runPreview  = isFinalPass || allTilesDone || previewScheduler.ShouldRunPreview();
 
 			if( runPreview ) {
 				// Intermediate preview: rebuild the primary image from the
@@ -1054,6 +1091,8 @@ void BDPTRasterizerBase::RasterizeScene(
 			}
 		}
 
+		safe_release( pNextSeq );
+
 		if( pAOVBuffers ) {
 			for( unsigned int y=0; y<height; y++ ) {
 				for( unsigned int x=0; x<width; x++ ) {
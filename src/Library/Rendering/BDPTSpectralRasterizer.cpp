@@ -619,7 +619,7 @@ void BDPTSpectralRasterizer::IntegratePixel(
 			weights += weight;
 
 			if( temporal_samples ) {
-				pScene.GetAnimator()->EvaluateAtTime( temporal_start + (rc.random.CanonicalRandom()*temporal_exposure) );
+				SetTemporalSampleTime( pScene, temporal_start + (rc.random.CanonicalRandom()*temporal_exposure) );
 			}
 
 			// The Morton remapping is done inside IntegratePixelSpectral per
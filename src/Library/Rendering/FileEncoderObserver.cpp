@@ -3,19 +3,22 @@
 //  FileEncoderObserver.cpp - Implementation.  Each callback opens
 //  a fresh DiskFileWriteBuffer (matching the legacy per-frame open
 //  pattern from FileRasterizerOutput::WriteImageToFile), runs the
-//  encoder, releases the buffer.
+//  encoder, releases the buffer -- inline, or on a FrameEncodeQueue
+//  thread for animation frames.
 //
 //////////////////////////////////////////////////////////////////////
 
 #include "pch.h"
 #include "FileEncoderObserver.h"
 #include "FrameStore.h"
+#include "FrameEncodeQueue.h"
 
 #include "../Utilities/DiskFileWriteBuffer.h"
 #include "../Interfaces/ILog.h"
 
 #include <cstdio>
 #include <cstring>
+#include <memory>
 
 using namespace RISE;
 using namespace RISE::Implementation;
@@ -37,6 +40,10 @@ FileEncoderObserver::FileEncoderObserver(
 
 FileEncoderObserver::~FileEncoderObserver()
 {
+	// Frames handed to the background queue hold their own snapshot,
+	// but whoever is tearing us down expects the files to exist
+	FrameEncodeQueue::FlushGlobal();
+
 	if ( store_ ) store_->release();
 }
 
@@ -63,6 +70,50 @@ void FileEncoderObserver::OnDenoiseComplete( unsigned int frame, uint64_t /*gene
 	WriteFile( frame, "_denoised" );
 }
 
+namespace
+{
+	// Opens `filename` (falling back to `emergency` if it can't be
+	// opened, mirroring the legacy "fro_temp_…" behaviour from
+	// FileRasterizerOutput.cpp:167-186 -- we don't want to lose the
+	// rendered data when a path is unwritable) and runs the encoder.
+	void EncodeToFile(
+		const FrameStore&   store,
+		IFrameEncoder*      encoder,
+		const EncodeOpts&   opts,
+		const std::string&  filename,
+		const std::string&  emergency )
+	{
+		std::string written = filename;
+		DiskFileWriteBuffer* buf = new DiskFileWriteBuffer( filename.c_str() );
+
+		if ( !buf->ReadyToWrite() ) {
+			safe_release( buf );
+
+			buf = new DiskFileWriteBuffer( emergency.c_str() );
+			if ( !buf->ReadyToWrite() ) {
+				GlobalLog()->PrintEasyError(
+					"FileEncoderObserver:: Fatal error trying to write image, "
+					"couldn't even write the emergency file!" );
+				safe_release( buf );
+				return;
+			}
+			GlobalLog()->PrintEx( eLog_Warning,
+				"Failed to open specified file '%s', rendered scene written "
+				"to emergency file '%s' instead!", filename.c_str(), emergency.c_str() );
+			written = emergency;
+		}
+
+		GlobalLog()->PrintNew( buf, __FILE__, __LINE__, "DiskFileWriteBuffer" );
+
+		encoder->Encode( store, *buf, opts );
+
+		safe_release( buf );
+
+		GlobalLog()->PrintEx( eLog_Event,
+			"FileEncoderObserver:: Written to '%s'", written.c_str() );
+	}
+}
+
 void FileEncoderObserver::WriteFile( unsigned int frame, const char* suffix )
 {
 	if ( !store_ || !encoder_ ) return;
@@ -87,52 +138,39 @@ void FileEncoderObserver::WriteFile( unsigned int frame, const char* suffix )
 			pattern_.c_str(), suffix, ext.c_str() );
 	}
 
-	// Open the disk file.  If the open fails, mirror the legacy
-	// "fall back to fro_temp_…" emergency-file behaviour from
-	// FileRasterizerOutput.cpp:167-186 — we don't want to lose
-	// the rendered data when a path is unwritable.
-	DiskFileWriteBuffer* buf = new DiskFileWriteBuffer( filename );
-
-	if ( !buf->ReadyToWrite() ) {
-		safe_release( buf );
-
-		const FileEncoderObserver* pMe = this;
-		char emergency[MAX_BUFFER_SIZE];
-		if ( bMultiple_ ) {
-			snprintf( emergency, MAX_BUFFER_SIZE,
-				"fro_temp_%lu%s_%.4u.%s",
-				static_cast<unsigned long>( reinterpret_cast<uintptr_t>( pMe ) ),
-				suffix, frame, ext.c_str() );
-		} else {
-			snprintf( emergency, MAX_BUFFER_SIZE,
-				"fro_temp_%lu%s.%s",
-				static_cast<unsigned long>( reinterpret_cast<uintptr_t>( pMe ) ),
-				suffix, ext.c_str() );
-		}
-
-		buf = new DiskFileWriteBuffer( emergency );
-		if ( !buf->ReadyToWrite() ) {
-			GlobalLog()->PrintEasyError(
-				"FileEncoderObserver:: Fatal error trying to write image, "
-				"couldn't even write the emergency file!" );
-			safe_release( buf );
-			return;
-		}
-		GlobalLog()->PrintEx( eLog_Warning,
-			"Failed to open specified file '%s', rendered scene written "
-			"to emergency file '%s' instead!", filename, emergency );
-		// Use the emergency filename as the effective filename for
-		// the success log message below.
-		std::strncpy( filename, emergency, MAX_BUFFER_SIZE );
-		filename[ MAX_BUFFER_SIZE - 1 ] = '\0';
+	const FileEncoderObserver* pMe = this;
+	char emergency[MAX_BUFFER_SIZE];
+	if ( bMultiple_ ) {
+		snprintf( emergency, MAX_BUFFER_SIZE,
+			"fro_temp_%lu%s_%.4u.%s",
+			static_cast<unsigned long>( reinterpret_cast<uintptr_t>( pMe ) ),
+			suffix, frame, ext.c_str() );
+	} else {
+		snprintf( emergency, MAX_BUFFER_SIZE,
+			"fro_temp_%lu%s.%s",
+			static_cast<unsigned long>( reinterpret_cast<uintptr_t>( pMe ) ),
+			suffix, ext.c_str() );
 	}
 
-	GlobalLog()->PrintNew( buf, __FILE__, __LINE__, "DiskFileWriteBuffer" );
-
-	encoder_->Encode( *store_, *buf, opts_ );
-
-	safe_release( buf );
+	// Animation frames go to the background queue: the store is
+	// snapshotted now, because the rasterizer starts overwriting it
+	// with the next frame as soon as this callback returns.  Single
+	// frames stay inline -- there is no next frame to overlap with.
+	FrameEncodeQueue* queue = bMultiple_ ? FrameEncodeQueue::Global() : 0;
+	if ( queue ) {
+		std::shared_ptr<FrameStore> snapshot(
+			store_->CreateSnapshot(),
+			[]( FrameStore* p ) { p->release(); } );
+		IFrameEncoder* const encoder = encoder_;
+		const EncodeOpts opts = opts_;
+		const std::string file( filename );
+		const std::string emergencyFile( emergency );
+
+		queue->Submit( file, [snapshot, encoder, opts, file, emergencyFile]() {
+			EncodeToFile( *snapshot, encoder, opts, file, emergencyFile );
+		} );
+		return;
+	}
 
-	GlobalLog()->PrintEx( eLog_Event,
-		"FileEncoderObserver:: Written to '%s'", filename );
+	EncodeToFile( *store_, encoder_, opts_, filename, emergency );
 }
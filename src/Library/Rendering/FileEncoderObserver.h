@@ -15,6 +15,12 @@
 //    bMultiple == true   →  "<pattern><suffix>NNNN.<ext>"
 //    bMultiple == false  →  "<pattern><suffix>.<ext>"
 //
+//  Animation frames (bMultiple == true) are not encoded inline: the
+//  observer snapshots the FrameStore and hands the encode to
+//  FrameEncodeQueue so the next frame can start rendering.  Single
+//  frames, and all frames when `async_frame_encoding` is off, are
+//  written before the callback returns.
+//
 //  The observer takes a non-owning IFrameEncoder pointer (typically
 //  from FrameEncoderRegistry::Get().ByFormatName(...) which returns
 //  a registry-lifetimed encoder).  It addrefs the FrameStore so
@@ -292,6 +292,11 @@ bool FileRasterizerOutput::BuildAndAttachObserver_( FrameStore* store )
 	opts.viewTransform.exposureEV = static_cast<float>( exposureEV );
 	opts.viewTransform.toneCurve  = display_transform;
 
+	// Multi-part EXR with every AOV the store carries (albedo,
+	// normal, ... in their own parts) instead of beauty alone
+	opts.includeAOVs = ( type == EXR ) &&
+		GlobalOptions().ReadBool( "exr_multipart_aovs", false );
+
 	encoderObserver_ = new FileEncoderObserver(
 		store, encoder, opts,
 		std::string( szPattern ), bMultiple );
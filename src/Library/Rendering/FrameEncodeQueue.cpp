@@ -0,0 +1,187 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  FrameEncodeQueue.cpp - Implementation of the background frame
+//    encode queue
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//  Comments:
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "FrameEncodeQueue.h"
+#include "../Interfaces/IOptions.h"
+#include "../Interfaces/ILog.h"
+
+#include <algorithm>
+#include <memory>
+
+using namespace RISE;
+using namespace RISE::Implementation;
+
+namespace
+{
+	std::mutex& GlobalQueueMutex()
+	{
+		static std::mutex m;
+		return m;
+	}
+
+	// Function-local so the queue is destroyed (flushed and joined) at
+	// exit without depending on static initialization order
+	std::unique_ptr<FrameEncodeQueue>& GlobalQueueSlot()
+	{
+		static std::unique_ptr<FrameEncodeQueue> q;
+		return q;
+	}
+
+	bool& GlobalQueueConfigured()
+	{
+		static bool configured = false;
+		return configured;
+	}
+}
+
+FrameEncodeQueue::FrameEncodeQueue(
+	const unsigned int numThreads,
+	const unsigned int maxPending
+	) :
+  m_maxPending( maxPending > 0 ? maxPending : 1 ),
+  m_stopping( false )
+{
+	const unsigned int n = numThreads > 0 ? numThreads : 1;
+	for( unsigned int i = 0; i < n; i++ ) {
+		m_workers.push_back( std::thread( &FrameEncodeQueue::WorkerLoop, this ) );
+	}
+}
+
+FrameEncodeQueue::~FrameEncodeQueue()
+{
+	Flush();
+
+	{
+		std::lock_guard<std::mutex> lock( m_mutex );
+		m_stopping = true;
+	}
+	m_cvWork.notify_all();
+
+	for( size_t i = 0; i < m_workers.size(); i++ ) {
+		m_workers[i].join();
+	}
+}
+
+FrameEncodeQueue* FrameEncodeQueue::Global()
+{
+	std::lock_guard<std::mutex> lock( GlobalQueueMutex() );
+
+	if( !GlobalQueueConfigured() ) {
+		GlobalQueueConfigured() = true;
+
+		IOptions& options = GlobalOptions();
+		if( options.ReadBool( "async_frame_encoding", true ) ) {
+			const int threads = options.ReadInt( "async_frame_encoding_threads", 1 );
+			const int depth = options.ReadInt( "async_frame_encoding_queue", 2 );
+			GlobalQueueSlot().reset( new FrameEncodeQueue(
+				threads > 0 ? static_cast<unsigned int>( threads ) : 1,
+				depth > 0 ? static_cast<unsigned int>( depth ) : 1 ) );
+
+			GlobalLog()->PrintEx( eLog_Info, "FrameEncodeQueue:: Animation frames are encoded in the background (%d thread(s), queue depth %d)",
+				threads > 0 ? threads : 1, depth > 0 ? depth : 1 );
+		}
+	}
+
+	return GlobalQueueSlot().get();
+}
+
+void FrameEncodeQueue::FlushGlobal()
+{
+	FrameEncodeQueue* q = 0;
+	{
+		std::lock_guard<std::mutex> lock( GlobalQueueMutex() );
+		q = GlobalQueueSlot().get();
+	}
+
+	if( q ) {
+		q->Flush();
+	}
+}
+
+bool FrameEncodeQueue::IsRunning( const std::string& key ) const
+{
+	return std::find( m_running.begin(), m_running.end(), key ) != m_running.end();
+}
+
+void FrameEncodeQueue::Submit( const std::string& key, const Task& task )
+{
+	std::unique_lock<std::mutex> lock( m_mutex );
+
+	for( std::deque<Entry>::iterator it = m_pending.begin(); it != m_pending.end(); ++it ) {
+		if( it->key == key ) {
+			it->task = task;
+			return;
+		}
+	}
+
+	m_cvSpace.wait( lock, [this]() { return m_pending.size() < m_maxPending; } );
+
+	Entry e;
+	e.key = key;
+	e.task = task;
+	m_pending.push_back( e );
+
+	lock.unlock();
+	m_cvWork.notify_one();
+}
+
+void FrameEncodeQueue::Flush()
+{
+	std::unique_lock<std::mutex> lock( m_mutex );
+	m_cvIdle.wait( lock, [this]() { return m_pending.empty() && m_running.empty(); } );
+}
+
+unsigned int FrameEncodeQueue::Outstanding() const
+{
+	std::lock_guard<std::mutex> lock( m_mutex );
+	return static_cast<unsigned int>( m_pending.size() + m_running.size() );
+}
+
+void FrameEncodeQueue::WorkerLoop()
+{
+	std::unique_lock<std::mutex> lock( m_mutex );
+
+	for(;;) {
+		// Oldest task whose file is not already being written
+		std::deque<Entry>::iterator it = m_pending.begin();
+		while( it != m_pending.end() && IsRunning( it->key ) ) {
+			++it;
+		}
+
+		if( it == m_pending.end() ) {
+			if( m_stopping && m_pending.empty() ) {
+				return;
+			}
+			m_cvWork.wait( lock );
+			continue;
+		}
+
+		Entry e = *it;
+		m_pending.erase( it );
+		m_running.push_back( e.key );
+		m_cvSpace.notify_one();
+
+		lock.unlock();
+		e.task();
+		e.task = Task();		// drop whatever the task holds before reporting idle
+		lock.lock();
+
+		m_running.erase( std::find( m_running.begin(), m_running.end(), e.key ) );
+
+		// A queued task for the same file may now run, and Flush may be done
+		m_cvWork.notify_all();
+		m_cvIdle.notify_all();
+	}
+}
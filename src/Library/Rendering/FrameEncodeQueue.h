@@ -0,0 +1,106 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  FrameEncodeQueue.h - Bounded background queue for writing
+//    finished animation frames to disk.
+//
+//    Encoding a frame (PNG deflate, EXR PIZ, TIFF) is single-threaded
+//    and, for 4K multi-AOV EXRs, takes seconds; done inline on the
+//    render thread it leaves every render worker idle.  With this
+//    queue FileEncoderObserver snapshots the FrameStore and submits
+//    the encode, and the next frame starts rendering straight away.
+//
+//    Back-pressure: Submit blocks while `maxPending` tasks are already
+//    waiting, so at most maxPending + numThreads frame snapshots are
+//    alive at once.  Tasks are keyed by output filename: a task whose
+//    file is already queued replaces the queued one (the later write
+//    would overwrite it anyway), and two tasks for the same file never
+//    run concurrently.  Flush blocks until everything submitted so far
+//    has been written; Job calls it when an animation finishes.
+//
+//    The process-wide queue is configured from the global options
+//    `async_frame_encoding`, `async_frame_encoding_threads` and
+//    `async_frame_encoding_queue`.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//  Comments:
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#ifndef FRAME_ENCODE_QUEUE_
+#define FRAME_ENCODE_QUEUE_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace RISE
+{
+	namespace Implementation
+	{
+		class FrameEncodeQueue
+		{
+		public:
+			typedef std::function<void()> Task;
+
+			FrameEncodeQueue(
+				const unsigned int numThreads,		///< [in] Encoder threads (at least 1)
+				const unsigned int maxPending		///< [in] Queued tasks before Submit blocks (at least 1)
+				);
+
+			//! Flushes, then joins the encoder threads
+			~FrameEncodeQueue();
+
+			//! The process-wide queue, or null when the
+			//! `async_frame_encoding` option is off
+			static FrameEncodeQueue* Global();
+
+			//! Flushes the process-wide queue if it has been created
+			static void FlushGlobal();
+
+			//! Queues `task` to write the file `key`.  Blocks while the
+			//! queue is full, unless a task for the same key is already
+			//! queued, in which case that task is replaced.
+			void Submit( const std::string& key, const Task& task );
+
+			//! Blocks until every submitted task has finished
+			void Flush();
+
+			//! Tasks queued or running
+			unsigned int Outstanding() const;
+
+		protected:
+			struct Entry
+			{
+				std::string		key;
+				Task			task;
+			};
+
+			void WorkerLoop();
+			bool IsRunning( const std::string& key ) const;
+
+			const unsigned int			m_maxPending;
+			mutable std::mutex			m_mutex;
+			std::condition_variable		m_cvWork;		///< signalled when a task may have become runnable
+			std::condition_variable		m_cvSpace;		///< signalled when a queued task is taken
+			std::condition_variable		m_cvIdle;		///< signalled when a task finishes
+			std::deque<Entry>			m_pending;
+			std::vector<std::string>	m_running;		///< keys of tasks being executed
+			std::vector<std::thread>	m_workers;
+			bool						m_stopping;
+
+		private:
+			FrameEncodeQueue( const FrameEncodeQueue& );
+			FrameEncodeQueue& operator=( const FrameEncodeQueue& );
+		};
+	}
+}
+
+#endif
@@ -18,6 +18,7 @@
 #include "FrameStore.h"
 
 #include "../Interfaces/ILog.h"
+#include "../Interfaces/IOptions.h"
 #include "../Interfaces/IWriteBuffer.h"
 #include "../RISE_API.h"
 
@@ -26,6 +27,16 @@
 #include <cstring>
 #include <vector>
 
+#ifndef NO_EXR_SUPPORT
+#include "../RasterImages/EXRWriter.h"
+#include "../Utilities/FiniteMath.h"
+#include <ImfMultiPartOutputFile.h>
+#include <ImfOutputPart.h>
+#include <ImfTiledOutputPart.h>
+#include <ImfPartType.h>
+#include <limits>
+#endif
+
 // L5c — libpng for HDR10 PNG encoder.
 #ifndef NO_PNG_SUPPORT
 #include <png.h>
@@ -134,6 +145,247 @@ namespace RISE
 			return w;
 		}
 
+#ifndef NO_EXR_SUPPORT
+		namespace
+		{
+			// One part of a multi-part EXR: planar channels, each a
+			// tightly packed width*height array
+			struct EXRPart
+			{
+				std::string					name;
+				std::vector<std::string>	channels;
+				Imf::PixelType				fileType;		///< type stored in the file
+				std::vector<float>			floats;			///< channel-major, for FLOAT/HALF parts
+				std::vector<unsigned int>	uints;			///< channel-major, for UINT parts
+			};
+
+			float ClampForEXR( const double v, const double limit )
+			{
+				if ( !RISE::IsFiniteDouble( v ) ) return 0.0f;
+				return static_cast<float>( v > limit ? limit : ( v < -limit ? -limit : v ) );
+			}
+
+			template< class PelType >
+			void FillBeautyPart( const FrameStore& store, EXRPart& part, const double limit )
+			{
+				const size_t w = store.Width(), h = store.Height(), n = w*h;
+				const auto* beauty = store.GetChannel<ChannelId::Beauty>();
+				const auto* alpha  = store.GetChannel<ChannelId::Alpha>();
+				const bool withAlpha = part.channels.size() == 4;
+				part.floats.assign( n * part.channels.size(), 0.0f );
+				for ( size_t y = 0; y < h; ++y ) {
+					for ( size_t x = 0; x < w; ++x ) {
+						// Premultiplied, like EXRWriter
+						const double a = alpha->At( x, y );
+						const PelType p( beauty->At( x, y ) );
+						const size_t i = y*w + x;
+						part.floats[i]       = ClampForEXR( p.r * a, limit );
+						part.floats[n + i]   = ClampForEXR( p.g * a, limit );
+						part.floats[2*n + i] = ClampForEXR( p.b * a, limit );
+						if ( withAlpha ) {
+							part.floats[3*n + i] = ClampForEXR( a, limit );
+						}
+					}
+				}
+			}
+
+			bool WantsAOV( const FrameStore& store, const EncodeOpts& opts, const ChannelId id )
+			{
+				if ( !store.HasChannel( id ) ) return false;
+				if ( opts.aovChannels.empty() ) return true;
+				return std::find( opts.aovChannels.begin(), opts.aovChannels.end(), id ) != opts.aovChannels.end();
+			}
+
+			void WriteMultiPartEXR( const FrameStore& store, IWriteBuffer& dst, const EncodeOpts& opts, std::vector<EXRPart>& parts )
+			{
+				const unsigned int w = static_cast<unsigned int>( store.Width() );
+				const unsigned int h = static_cast<unsigned int>( store.Height() );
+
+				IOptions& options = GlobalOptions();
+				const bool tiled = options.ReadBool( "exr_tiled", false );
+				const int size = options.ReadInt( "exr_tile_size", 64 );
+				const int tileSize = size >= 8 ? size : 8;
+
+				EXRWriter::ConfigureThreading();
+
+				const Imf::Header base = EXRWriter::MakeHeader( w, h, opts.colorSpace, opts.exrCompression );
+				std::vector<Imf::Header> headers( parts.size(), base );
+				for ( size_t p = 0; p < parts.size(); ++p ) {
+					headers[p].setName( parts[p].name );
+					if ( tiled ) {
+						headers[p].setType( Imf::TILEDIMAGE );
+						headers[p].setTileDescription( Imf::TileDescription( tileSize, tileSize, Imf::ONE_LEVEL ) );
+					} else {
+						headers[p].setType( Imf::SCANLINEIMAGE );
+					}
+					for ( const std::string& c : parts[p].channels ) {
+						headers[p].channels().insert( c, Imf::Channel( parts[p].fileType ) );
+					}
+				}
+
+				OStreamWrapper out( dst );
+				Imf::MultiPartOutputFile file( out, &headers[0], static_cast<int>( headers.size() ) );
+
+				for ( size_t p = 0; p < parts.size(); ++p ) {
+					EXRPart& part = parts[p];
+					const size_t n = static_cast<size_t>( w ) * h;
+					Imf::FrameBuffer fb;
+					for ( size_t c = 0; c < part.channels.size(); ++c ) {
+						if ( part.fileType == Imf::UINT ) {
+							fb.insert( part.channels[c], Imf::Slice( Imf::UINT,
+								reinterpret_cast<char*>( &part.uints[c*n] ),
+								sizeof( unsigned int ), sizeof( unsigned int ) * w ) );
+						} else {
+							fb.insert( part.channels[c], Imf::Slice( Imf::FLOAT,
+								reinterpret_cast<char*>( &part.floats[c*n] ),
+								sizeof( float ), sizeof( float ) * w ) );
+						}
+					}
+
+					// The whole part in one call, so OpenEXR compresses
+					// its blocks in parallel
+					if ( tiled ) {
+						Imf::TiledOutputPart out_part( file, static_cast<int>( p ) );
+						out_part.setFrameBuffer( fb );
+						out_part.writeTiles( 0, out_part.numXTiles() - 1, 0, out_part.numYTiles() - 1 );
+					} else {
+						Imf::OutputPart out_part( file, static_cast<int>( p ) );
+						out_part.setFrameBuffer( fb );
+						out_part.writePixels( static_cast<int>( h ) );
+					}
+				}
+			}
+		}
+
+		bool EXRFrameEncoder::SupportsAOVs() const
+		{
+			return true;
+		}
+
+		void EXRFrameEncoder::Encode(
+			const FrameStore& store,
+			IWriteBuffer&     dst,
+			const EncodeOpts& opts )
+		{
+			const bool anyAOV = opts.includeAOVs && (
+				WantsAOV( store, opts, ChannelId::Albedo ) ||
+				WantsAOV( store, opts, ChannelId::Normal ) ||
+				WantsAOV( store, opts, ChannelId::Depth ) ||
+				WantsAOV( store, opts, ChannelId::ObjectId ) ||
+				WantsAOV( store, opts, ChannelId::PrimitiveId ) );
+			if ( !anyAOV || store.Width() == 0 || store.Height() == 0 ) {
+				FrameEncoderBase::Encode( store, dst, opts );
+				return;
+			}
+
+			const size_t w = store.Width(), h = store.Height(), n = w*h;
+			const bool writeFloat = ( opts.bpp >= 32 );
+			const Imf::PixelType colorType = writeFloat ? Imf::FLOAT : Imf::HALF;
+			const double limit = writeFloat ? double( (std::numeric_limits<float>::max)() ) : 65504.0;
+
+			std::vector<EXRPart> parts;
+
+			// Beauty, in the output colour space exactly as EXRWriter
+			// writes it
+			{
+				EXRPart part;
+				part.name = "beauty";
+				part.channels = { "R", "G", "B" };
+				if ( opts.exrWithAlpha ) part.channels.push_back( "A" );
+				part.fileType = colorType;
+				switch ( opts.colorSpace )
+				{
+				case eColorSpace_Rec709RGB_Linear: FillBeautyPart<Rec709RGBPel>( store, part, limit ); break;
+				case eColorSpace_ROMMRGB_Linear:   FillBeautyPart<ROMMRGBPel>( store, part, limit ); break;
+				case eColorSpace_ProPhotoRGB:      FillBeautyPart<ProPhotoRGBPel>( store, part, limit ); break;
+				default:
+				case eColorSpace_sRGB:             FillBeautyPart<sRGBPel>( store, part, limit ); break;
+				}
+				parts.push_back( part );
+			}
+
+			// AOVs stay in their native, linear form
+			if ( WantsAOV( store, opts, ChannelId::Albedo ) ) {
+				const auto* ch = store.GetChannel<ChannelId::Albedo>();
+				EXRPart part;
+				part.name = "albedo";
+				part.channels = { "R", "G", "B" };
+				part.fileType = colorType;
+				part.floats.resize( 3*n );
+				for ( size_t i = 0; i < n; ++i ) {
+					const RISEPel& v = ch->Data()[i];
+					part.floats[i]       = ClampForEXR( v[0], limit );
+					part.floats[n + i]   = ClampForEXR( v[1], limit );
+					part.floats[2*n + i] = ClampForEXR( v[2], limit );
+				}
+				parts.push_back( part );
+			}
+			if ( WantsAOV( store, opts, ChannelId::Normal ) ) {
+				const auto* ch = store.GetChannel<ChannelId::Normal>();
+				const double fmax = (std::numeric_limits<float>::max)();
+				EXRPart part;
+				part.name = "normal";
+				part.channels = { "X", "Y", "Z" };
+				part.fileType = Imf::FLOAT;
+				part.floats.resize( 3*n );
+				for ( size_t i = 0; i < n; ++i ) {
+					const Vector3& v = ch->Data()[i];
+					part.floats[i]       = ClampForEXR( v.x, fmax );
+					part.floats[n + i]   = ClampForEXR( v.y, fmax );
+					part.floats[2*n + i] = ClampForEXR( v.z, fmax );
+				}
+				parts.push_back( part );
+			}
+			if ( WantsAOV( store, opts, ChannelId::Depth ) ) {
+				const auto* ch = store.GetChannel<ChannelId::Depth>();
+				EXRPart part;
+				part.name = "depth";
+				part.channels = { "Z" };
+				part.fileType = Imf::FLOAT;
+				part.floats.assign( ch->Data(), ch->Data() + n );
+				parts.push_back( part );
+			}
+			if ( WantsAOV( store, opts, ChannelId::ObjectId ) ) {
+				const auto* ch = store.GetChannel<ChannelId::ObjectId>();
+				EXRPart part;
+				part.name = "objectId";
+				part.channels = { "id" };
+				part.fileType = Imf::UINT;
+				part.uints.assign( ch->Data(), ch->Data() + n );
+				parts.push_back( part );
+			}
+			if ( WantsAOV( store, opts, ChannelId::PrimitiveId ) ) {
+				const auto* ch = store.GetChannel<ChannelId::PrimitiveId>();
+				EXRPart part;
+				part.name = "primitiveId";
+				part.channels = { "id" };
+				part.fileType = Imf::UINT;
+				part.uints.assign( ch->Data(), ch->Data() + n );
+				parts.push_back( part );
+			}
+
+			try {
+				WriteMultiPartEXR( store, dst, opts, parts );
+			} catch ( const std::exception& e ) {
+				GlobalLog()->PrintEx( eLog_Error,
+					"FrameEncoder[EXR]: multi-part write failed: %s", e.what() );
+			}
+		}
+#else
+		bool EXRFrameEncoder::SupportsAOVs() const
+		{
+			return false;
+		}
+
+		void EXRFrameEncoder::Encode(
+			const FrameStore& store,
+			IWriteBuffer&     dst,
+			const EncodeOpts& opts )
+		{
+			FrameEncoderBase::Encode( store, dst, opts );
+		}
+#endif
+
 		IRasterImageWriter* TIFFFrameEncoder::CreateWriter(
 			IWriteBuffer& dst, const EncodeOpts& opts ) const
 		{
@@ -288,8 +540,8 @@ namespace RISE
 
 			// Filtering + compression — match the legacy PNGWriter
 			// settings for byte-shape consistency with the SDR PNG
-			// path (PNG_NO_FILTERS + Z_BEST_COMPRESSION).
-			png_set_filter( png_ptr, 0, PNG_NO_FILTERS );
+			// path (PNG_ALL_FILTERS + Z_BEST_COMPRESSION).
+			png_set_filter( png_ptr, PNG_FILTER_TYPE_BASE, PNG_ALL_FILTERS );
 			png_set_compression_level( png_ptr, Z_BEST_COMPRESSION );
 
 			// PNG IHDR — 16-bit RGB (no alpha, matches RGB16_BT2020_PQ).
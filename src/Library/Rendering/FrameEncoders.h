@@ -100,7 +100,17 @@ namespace RISE
 			std::string FormatName() const override { return "EXR"; }
 			std::vector<std::string> Extensions() const override { return { "exr" }; }
 			bool SupportsHDR() const override  { return true; }
-			bool SupportsAOVs() const override { return false; }  // L7 will flip this
+			bool SupportsAOVs() const override;
+
+			//! With opts.includeAOVs, writes a multi-part EXR: a
+			//! "beauty" part plus one part per AOV channel present in
+			//! the store (all of them when opts.aovChannels is empty).
+			//! Otherwise, or with no AOVs present, the usual
+			//! single-part file.
+			void Encode(
+				const FrameStore&    store,
+				IWriteBuffer&        dst,
+				const EncodeOpts&    opts ) override;
 		protected:
 			virtual ~EXRFrameEncoder() {}
 			IRasterImageWriter* CreateWriter( IWriteBuffer& dst, const EncodeOpts& opts ) const override;
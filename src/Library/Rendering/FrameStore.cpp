@@ -341,6 +341,43 @@ namespace RISE
 			// to do.  beautyView_ is unique_ptr too.
 		}
 
+		FrameStore* FrameStore::CreateSnapshot() const
+		{
+			Spec spec;
+			spec.width    = width_;
+			spec.height   = height_;
+			spec.tileEdge = tileEdge_;
+			spec.meta     = meta_;
+			for ( uint32_t id = 0; id < static_cast<uint32_t>( ChannelId::COUNT ); ++id ) {
+				if ( presence_[ id ] ) {
+					spec.aovChannels.push_back( static_cast<ChannelId>( id ) );
+				}
+			}
+
+			FrameStore* snapshot = new FrameStore( spec );
+
+			// Every tile's shared lock, row-major like Render and
+			// DumpImage, so an in-progress writer finishes first and
+			// the copy is one coherent frame.
+			std::vector<std::shared_lock<std::shared_mutex>> tileLocks;
+			tileLocks.reserve( tileCountX_ * tileCountY_ );
+			for ( size_t ty = 0; ty < tileCountY_; ++ty ) {
+				for ( size_t tx = 0; tx < tileCountX_; ++tx ) {
+					tileLocks.emplace_back( TileLockAt( tx, ty ).mtx );
+				}
+			}
+
+			if ( beauty_ )      *snapshot->beauty_      = *beauty_;
+			if ( alpha_ )       *snapshot->alpha_       = *alpha_;
+			if ( albedo_ )      *snapshot->albedo_      = *albedo_;
+			if ( normal_ )      *snapshot->normal_      = *normal_;
+			if ( depth_ )       *snapshot->depth_       = *depth_;
+			if ( objectId_ )    *snapshot->objectId_    = *objectId_;
+			if ( primitiveId_ ) *snapshot->primitiveId_ = *primitiveId_;
+
+			return snapshot;
+		}
+
 		// ─────────────────────────────────────────────────────────────
 		// Write-side API
 		// ─────────────────────────────────────────────────────────────
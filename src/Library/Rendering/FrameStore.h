@@ -262,6 +262,16 @@ namespace RISE
 			//! at frame boundaries (before MarkFrameComplete).
 			Metadata& MutableMeta() { return meta_; }
 
+			// ── snapshot ──────────────────────────────────────────
+
+			//! Deep copy of every allocated channel plus the metadata,
+			//! taken under all tile shared locks so it is one coherent
+			//! frame.  No observers are copied.  Used to hand a finished
+			//! animation frame to a background encoder while the
+			//! rasterizer overwrites this store with the next frame.
+			//! Caller owns the returned reference.
+			FrameStore* CreateSnapshot() const;
+
 			// ── back-compat shim (Phase 1 only) ───────────────────
 
 			//! Returns the Beauty channel as an IRasterImage view,
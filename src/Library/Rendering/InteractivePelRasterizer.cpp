@@ -25,6 +25,7 @@
 #include "RayCaster.h"
 #include "MortonRasterizeSequence.h"
 #include "ScanlineRasterizeSequence.h"
+#include "../Cameras/PinholeCamera.h"
 #include "../Interfaces/IBSDF.h"
 #include "../Interfaces/IRasterImage.h"
 #include "../Interfaces/IRayCaster.h"
@@ -1882,6 +1883,9 @@ InteractivePelRasterizer::InteractivePelRasterizer( IRayCaster* pCaster, const C
 , mViewModeCasterAllowsDenoise( false )
 , mSavedPreviewCasterForViewMode( 0 )
 , mXrayView( false )
+, mPixelReuseArmed( false )
+, mReuseScene( 0 )
+, mReuseCamera( 0 )
 {
 }
 
@@ -2113,6 +2117,54 @@ void InteractivePelRasterizer::SetSampleCount( unsigned int n )
 	}
 }
 
+void InteractivePelRasterizer::InvalidatePixelReuse()
+{
+	mReuseCache.InvalidateAll();
+}
+
+void InteractivePelRasterizer::InvalidatePixelReuseForObjects( const std::vector<const IObject*>& objects )
+{
+	mReuseCache.InvalidateObjects( objects );
+}
+
+bool InteractivePelRasterizer::PreparePixelReuse_( const IScene& pScene ) const
+{
+	if( !mPixelReuseArmed || mViewModeCasterInstalled || mXrayView ) {
+		return false;
+	}
+
+	const ICamera* pCam = pScene.GetCamera();
+	const IFilm* pFilm = pScene.GetFilm();
+	if( !pCam || !pFilm ) {
+		return false;
+	}
+
+	// The controller reports every edit, but a camera moved or swapped
+	// behind its back must not bring back pixels seen from elsewhere.
+	// A pinhole camera that only moved carries its history over to the
+	// new pose; the pass confirms each carried pixel before using it.
+	const Matrix4 m = pCam->GetMatrix();
+	if( &pScene != mReuseScene || pCam != mReuseCamera ||
+		memcmp( &m, &mReuseCameraMatrix, sizeof( Matrix4 ) ) != 0 )
+	{
+		const bool bSameSize = mReuseCache.Width() == pFilm->GetWidth() &&
+			mReuseCache.Height() == pFilm->GetHeight();
+		if( bSameSize && &pScene == mReuseScene && pCam == mReuseCamera &&
+			dynamic_cast<const PinholeCamera*>( pCam ) )
+		{
+			mReuseCache.Reproject( m, pCam->GetLocation() );
+		} else {
+			mReuseCache.InvalidateAll();
+		}
+		mReuseScene = &pScene;
+		mReuseCamera = pCam;
+		mReuseCameraMatrix = m;
+	}
+
+	mReuseCache.Resize( pFilm->GetWidth(), pFilm->GetHeight() );
+	return true;
+}
+
 void InteractivePelRasterizer::PrepareImageForNewRender( IRasterImage& /*img*/, const Rect* /*pRect*/ ) const
 {
 	// Intentionally empty.  The default impl clears to a random
@@ -2127,7 +2179,9 @@ void InteractivePelRasterizer::PrepareImageForNewRender( IRasterImage& /*img*/,
 void InteractivePelRasterizer::RasterizeScene(
 	const IScene& pScene, const Rect* pRect, IRasterizeSequence* pRasterSequence ) const
 {
+	mPixelReuse = PreparePixelReuse_( pScene ) ? &mReuseCache : 0;
 	PixelBasedRasterizerHelper::RasterizeScene( pScene, pRect, pRasterSequence );
+	mPixelReuse = 0;
 
 	// Part B (docs/gui/RENDER_MODES.md "Depth axis" self-calibration): a
 	// Depth view-mode caster's auto-window arms from the PREVIOUS pass's
@@ -2163,6 +2217,10 @@ void InteractivePelRasterizer::RasterizeScene(
 	{
 		PixelBasedRasterizerHelper::RasterizeScene( pScene, pRect, pRasterSequence );
 	}
+
+	// SetLiveCheckerboard and SetPixelReuse arm a single call
+	mCheckerboardPass = false;
+	mPixelReuseArmed = false;
 }
 
 void InteractivePelRasterizer::PrepareRuntimeContext( RuntimeContext& rc ) const
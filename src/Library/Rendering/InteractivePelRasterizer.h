@@ -388,6 +388,22 @@ namespace RISE
 				//! Tile dispatch order.
 				TileOrder tileOrder;
 
+				//! True to honour SetLiveCheckerboard: live-drag
+				//! passes trace half the pixels in a checkerboard and
+				//! fill the rest from their neighbours.
+				bool liveCheckerboard;
+
+				//! True to honour SetPixelReuse: full-resolution
+				//! passes copy the pixels an edit or a camera move
+				//! could not have changed from the previous passes
+				//! instead of tracing them again.  Only sound for a
+				//! caster whose shading of a pixel depends on nothing
+				//! an edit can change other than the material at its
+				//! first hit, which holds for the preview and object
+				//! id casters; clear it for anything that shades
+				//! through secondary bounces.
+				bool reuseConvergedPixels;
+
 				//! True to refine progressively when the user is
 				//! idle (not dragging).
 				bool progressiveOnIdle;
@@ -396,6 +412,8 @@ namespace RISE
 				: liveSamplesPerPass( 1 )
 				, idleMaxPasses( 16 )
 				, tileOrder( TileOrder_CenterOut )
+				, liveCheckerboard( true )
+				, reuseConvergedPixels( true )
 				, progressiveOnIdle( true )
 				{}
 			};
@@ -443,6 +461,34 @@ namespace RISE
 			//! completes).
 			void SetSampleCount( unsigned int n );
 
+			//! Render the next RasterizeScene call as a checkerboard
+			//! pass: every other pixel is traced and the rest are
+			//! filled from their traced neighbours, halving the cost
+			//! of a live-drag frame on top of the controller's
+			//! resolution divisor.  One-shot -- RasterizeScene clears
+			//! it -- so an idle, polish or one-off render can never
+			//! inherit a half-traced frame.  No-op when
+			//! Config::liveCheckerboard is false.  AOV planes keep
+			//! their previous values at the untraced pixels, which is
+			//! harmless because live-drag passes never denoise.
+			void SetLiveCheckerboard( bool on ) { mCheckerboardPass = on && mCfg.liveCheckerboard; }
+
+			//! Let the next RasterizeScene call reuse converged pixels
+			//! (see Config::reuseConvergedPixels).  The controller arms
+			//! it for passes at the full resolution; the history is
+			//! resized to the film of the armed pass.  One-shot, like
+			//! SetLiveCheckerboard.  Ignored while a view-mode caster
+			//! or the x-ray view is active.
+			void SetPixelReuse( bool on ) { mPixelReuseArmed = on && mCfg.reuseConvergedPixels; }
+
+			//! Drops the whole pixel history.  Called for any edit that
+			//! is not known to touch only the shading of some objects.
+			void InvalidatePixelReuse();
+
+			//! Drops the pixels whose first hit is one of `objects`,
+			//! after an edit to their material or shader only
+			void InvalidatePixelReuseForObjects( const std::vector<const IObject*>& objects );
+
 			//! Install an optional secondary ray caster that
 			//! SetSampleCount(>1) swaps in for the duration of a
 			//! multi-SPP polish pass.  Refcounted; the rasterizer
@@ -621,6 +667,20 @@ namespace RISE
 			//! the current toggle.
 			void ApplyXrayViewToCaster_( IRayCaster* c ) const;
 
+			// Pixel history for SetPixelReuse, with the scene and camera
+			// it was rendered from.  A pass from a different scene or
+			// camera drops it, whatever the controller has reported; a
+			// new pose of the same pinhole camera reprojects it.
+			mutable PixelReuseCache	mReuseCache;
+			mutable bool			mPixelReuseArmed;
+			mutable const IScene*	mReuseScene;
+			mutable const ICamera*	mReuseCamera;
+			mutable Matrix4			mReuseCameraMatrix;
+
+			//! Installs the history for this pass if it is armed and
+			//! allowed, dropping it first if the view changed
+			bool PreparePixelReuse_( const IScene& pScene ) const;
+
 		};
 	}
 }
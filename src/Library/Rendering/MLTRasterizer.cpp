@@ -13,7 +13,9 @@
 //       normalization constant b, which represents the expected
 //       luminance of the image.  We also build a CDF over the
 //       bootstrap luminances so we can importance-sample initial
-//       states for the Markov chains.
+//       states for the Markov chains.  The samples are evaluated
+//       in parallel and the CDF is a blocked parallel prefix sum;
+//       both are bit-identical for any thread count.
 //
 //    2. Chain Initialization:
 //       Create all nChains Markov chains up front: each gets a
@@ -77,6 +79,7 @@
 
 #include "pch.h"
 #include "../Utilities/RenderParallelScope.h"
+#include "../Utilities/CancellationToken.h"
 #include "MLTRasterizer.h"
 #include "../RasterImages/RasterImage.h"
 #include "../Utilities/Profiling.h"
@@ -445,6 +448,184 @@ unsigned int MLTRasterizer::SelectFromCDF(
 	return lo;
 }
 
+//////////////////////////////////////////////////////////////////////
+// Bootstrap - seeds are evaluated in blocks of kBootstrapBlock and the
+// CDF is scanned in blocks of kBootstrapCDFBlock.  Both are fixed so
+// the results do not depend on the thread count.
+//////////////////////////////////////////////////////////////////////
+
+namespace
+{
+	const unsigned int kBootstrapBlock = 256;
+	const unsigned int kBootstrapCDFBlock = 16384;
+
+	// Runs body(block) for every block, on `threads` pool workers
+	// pulling blocks from an atomic counter, or inline for one thread
+	template<class Body>
+	void ForEachBlock( const unsigned int numBlocks, const unsigned int threads, const Body& body )
+	{
+		if( threads <= 1 || numBlocks <= 1 ) {
+			for( unsigned int blk = 0; blk < numBlocks; blk++ ) {
+				body( blk );
+			}
+			return;
+		}
+
+		std::atomic<unsigned int> nextBlock( 0 );
+		GlobalThreadPool().ParallelFor( threads < numBlocks ? threads : numBlocks,
+			[&]( unsigned int /*workerIdx*/ ) {
+				for( ;; ) {
+					const unsigned int blk = nextBlock.fetch_add( 1, std::memory_order_relaxed );
+					if( blk >= numBlocks ) {
+						break;
+					}
+					body( blk );
+				}
+			} );
+	}
+}
+
+Scalar MLTRasterizer::EvaluateBootstrapLuminance(
+	const IScene& scene,
+	const ICamera& camera,
+	ISampler& sampler,
+	const unsigned int width,
+	const unsigned int height
+	) const
+{
+	return EvaluateSample( scene, camera, sampler, width, height ).luminance;
+}
+
+bool MLTRasterizer::RunBootstrap(
+	const IScene& scene,
+	const ICamera& camera,
+	const unsigned int width,
+	const unsigned int height,
+	std::vector<BootstrapSample>& samples,
+	std::vector<Scalar>& cdf,
+	unsigned int& workersUsed
+	) const
+{
+	samples.assign( nBootstrap, BootstrapSample() );
+	cdf.assign( nBootstrap, 0 );
+
+	const unsigned int numBlocks = ( nBootstrap + kBootstrapBlock - 1 ) / kBootstrapBlock;
+	int threads = HowManyThreadsToSpawn();
+	if( threads < 1 ) {
+		threads = 1;
+	}
+	workersUsed = static_cast<unsigned int>( threads ) < numBlocks ? static_cast<unsigned int>( threads ) : numBlocks;
+	if( workersUsed < 1 ) {
+		workersUsed = 1;
+	}
+
+	// Progress is reported by whichever worker finishes a block,
+	// serialized the way RasterizeBlockDispatcher does it
+	std::atomic<bool> cancelled( false );
+	std::atomic<unsigned int> blocksDone( 0 );
+	RMutex progressMut;
+	unsigned int lastReported = 0;
+
+	// Progress() is only called between blocks, so a restart is also
+	// polled per sample through the render's ambient token
+	const CancellationToken& cancel = CancellationToken::Current();
+
+	// Freeze guard (RenderParallelScope.h): all geometry is realized single-threaded in
+	// RayCaster::AttachScene; assert (DEBUG) if a worker realizes mid-render.
+	RenderParallelScope renderParallelScope;
+	ForEachBlock( numBlocks, workersUsed,
+		[&]( const unsigned int blk ) {
+			if( cancelled.load( std::memory_order_relaxed ) ) {
+				return;
+			}
+
+			const unsigned int first = blk * kBootstrapBlock;
+			const unsigned int last = first + kBootstrapBlock < nBootstrap ? first + kBootstrapBlock : nBootstrap;
+			for( unsigned int i = first; i < last; i++ )
+			{
+				if( cancel.IsCancelled() ) {
+					cancelled.store( true, std::memory_order_relaxed );
+					return;
+				}
+
+				// Same seed as the chain init will use for sample i;
+				// see the RenderFrameOfMLT bootstrap comment
+				PSSMLTSampler* pBootSampler = new PSSMLTSampler( i, largeStepProb );
+				pBootSampler->StartIteration();
+
+				samples[i].luminance = EvaluateBootstrapLuminance( scene, camera, *pBootSampler, width, height );
+				samples[i].seed = i;
+				cdf[i] = samples[i].luminance;
+
+				safe_release( pBootSampler );
+			}
+
+			// The last block is not reported: the bootstrap never told
+			// the bar it was at 100 %, and the render phase that follows
+			// restarts it from 0
+			const unsigned int done = blocksDone.fetch_add( 1, std::memory_order_relaxed ) + 1;
+			if( pProgressFunc && done < numBlocks ) {
+				progressMut.lock();
+				if( done > lastReported && !cancelled.load( std::memory_order_relaxed ) ) {
+					lastReported = done;
+					const unsigned int samplesDone = done * kBootstrapBlock < nBootstrap ? done * kBootstrapBlock : nBootstrap;
+					if( !pProgressFunc->Progress( static_cast<double>(samplesDone), static_cast<double>(nBootstrap) ) ) {
+						cancelled.store( true, std::memory_order_relaxed );
+					}
+				}
+				progressMut.unlock();
+			}
+		} );
+
+	return !cancelled.load();
+}
+
+Scalar MLTRasterizer::BuildBootstrapCDF(
+	std::vector<Scalar>& cdf,
+	const unsigned int threads
+	)
+{
+	const std::size_t n = cdf.size();
+	if( n == 0 ) {
+		return 0;
+	}
+
+	const unsigned int numBlocks = static_cast<unsigned int>( ( n + kBootstrapCDFBlock - 1 ) / kBootstrapCDFBlock );
+	std::vector<Scalar> blockOffset( numBlocks, 0 );
+
+	// Pass 1: running sums within each block
+	ForEachBlock( numBlocks, threads,
+		[&]( const unsigned int blk ) {
+			const std::size_t first = std::size_t( blk ) * kBootstrapCDFBlock;
+			const std::size_t last = first + kBootstrapCDFBlock < n ? first + kBootstrapCDFBlock : n;
+			for( std::size_t i = first + 1; i < last; i++ ) {
+				cdf[i] += cdf[i-1];
+			}
+		} );
+
+	// Block offsets, in block order
+	Scalar total = 0;
+	for( unsigned int blk = 0; blk < numBlocks; blk++ ) {
+		blockOffset[blk] = total;
+		const std::size_t last = std::size_t( blk + 1 ) * kBootstrapCDFBlock < n ? std::size_t( blk + 1 ) * kBootstrapCDFBlock : n;
+		total += cdf[last-1];
+	}
+
+	// Pass 2: add the offsets and normalize
+	const Scalar invTotal = total > 0 ? 1.0 / total : 1.0;
+	ForEachBlock( numBlocks, threads,
+		[&]( const unsigned int blk ) {
+			const std::size_t first = std::size_t( blk ) * kBootstrapCDFBlock;
+			const std::size_t last = first + kBootstrapCDFBlock < n ? first + kBootstrapCDFBlock : n;
+			const Scalar offset = blockOffset[blk];
+			for( std::size_t i = first; i < last; i++ ) {
+				cdf[i] = ( cdf[i] + offset ) * invTotal;
+			}
+		} );
+
+	return total;
+}
+
 //////////////////////////////////////////////////////////////////////
 // InitChain - Initialize a single Markov chain.
 //
@@ -777,8 +958,9 @@ bool MLTRasterizer::RenderFrameOfMLT(
 		pProgressFunc->SetTitle( "MLT Bootstrap: " );
 	}
 
-	std::vector<BootstrapSample> bootstrapSamples( nBootstrap );
-	Scalar luminanceSum = 0;
+	std::vector<BootstrapSample> bootstrapSamples;
+	std::vector<Scalar> cdf;
+	unsigned int bootstrapWorkers = 1;
 
 	Timer bootstrapTimer;
 	bootstrapTimer.start();
@@ -798,25 +980,23 @@ bool MLTRasterizer::RenderFrameOfMLT(
 	// unbiased — it just samples a different concrete uniform sequence
 	// than IndependentSampler would for the same seed.  What matters is
 	// that bootstrap and chain-init agree on which sequence to use.
-	for( unsigned int i = 0; i < nBootstrap; i++ )
-	{
-		PSSMLTSampler* pBootSampler = new PSSMLTSampler( i, largeStepProb );
-		pBootSampler->StartIteration();
-
-		MLTSample sample = EvaluateSample( pScene, pCamera, *pBootSampler, width, height );
-
-		bootstrapSamples[i].luminance = sample.luminance;
-		bootstrapSamples[i].seed = i;
-		luminanceSum += sample.luminance;
+	//
+	// The samples are independent, so RunBootstrap spreads them across
+	// the thread pool; seed i is tied to index i, not to a worker.
+	if( !RunBootstrap( pScene, pCamera, width, height, bootstrapSamples, cdf, bootstrapWorkers ) ) {
+		return false;
+	}
 
-		safe_release( pBootSampler );
+	//////////////////////////////////////////////////////////////////
+	// Phase 1b: Build CDF for importance-sampling initial states
+	//
+	// The running total doubles as the luminance sum for b.  The
+	// blocked prefix sum gives the same bits for any thread count,
+	// so b, the CDF and therefore every chain's starting path are
+	// reproducible for a fixed seed.
+	//////////////////////////////////////////////////////////////////
 
-		if( pProgressFunc && (i % 1000 == 0) ) {
-			if( !pProgressFunc->Progress( static_cast<double>(i), static_cast<double>(nBootstrap) ) ) {
-				return false;
-			}
-		}
-	}
+	const Scalar luminanceSum = BuildBootstrapCDF( cdf, bootstrapWorkers );
 
 	bootstrapTimer.stop();
 
@@ -837,23 +1017,6 @@ bool MLTRasterizer::RenderFrameOfMLT(
 
 	GlobalLog()->PrintEx( eLog_Event, "MLTRasterizer:: Bootstrap complete. Mean luminance = %f, Normalization b = %f", b_mean, b );
 
-	//////////////////////////////////////////////////////////////////
-	// Phase 1b: Build CDF for importance-sampling initial states
-	//////////////////////////////////////////////////////////////////
-
-	std::vector<Scalar> cdf( nBootstrap );
-	cdf[0] = bootstrapSamples[0].luminance;
-	for( unsigned int i = 1; i < nBootstrap; i++ ) {
-		cdf[i] = cdf[i-1] + bootstrapSamples[i].luminance;
-	}
-
-	if( cdf[nBootstrap-1] > 0 ) {
-		const Scalar invTotal = 1.0 / cdf[nBootstrap-1];
-		for( unsigned int i = 0; i < nBootstrap; i++ ) {
-			cdf[i] *= invTotal;
-		}
-	}
-
 	//////////////////////////////////////////////////////////////////
 	// Phase 2: Initialize all chain states
 	//
@@ -869,9 +1032,10 @@ bool MLTRasterizer::RenderFrameOfMLT(
 	// Auto-calculate progressive rounds from bootstrap timing.
 	//
 	// Each bootstrap sample evaluates one full BDPT path — the same
-	// core operation as one mutation.  We time the bootstrap phase
-	// (single-threaded) and use it to estimate how long the rendering
-	// phase will take per mutation (multi-threaded).
+	// core operation as one mutation.  We time the bootstrap phase,
+	// scale it back to a per-sample cost on one thread, and use that
+	// to estimate how long the rendering phase will take per mutation
+	// (multi-threaded).
 	//
 	// Target: ~5 seconds per round, so the user gets frequent
 	// progressive updates without excessive snapshot overhead.
@@ -889,7 +1053,8 @@ bool MLTRasterizer::RenderFrameOfMLT(
 	if( bootstrapMs > 0 && nBootstrap > 0 )
 	{
 		// Time per single-threaded sample (milliseconds)
-		const double msPerSample = static_cast<double>( bootstrapMs ) / static_cast<double>( nBootstrap );
+		const double msPerSample = static_cast<double>( bootstrapMs ) * static_cast<double>( bootstrapWorkers ) /
+			static_cast<double>( nBootstrap );
 
 		// Estimated total render time in ms (divide by thread count for parallelism)
 		const int effectiveThreads = threads > 0 ? threads : 1;
@@ -1250,6 +1415,9 @@ void MLTRasterizer::RasterizeScene(
 	IRasterizeSequence* /*pRasterSequence*/
 	) const
 {
+	// Ambient cancellation token; see PixelBasedRasterizerHelper::RasterizeScene.
+	CancellationScope cancelScope( pProgressFunc );
+
 	// Snapshot once at entry — structural changes serialize against rendering.
 	const ICamera* pCamera = pScene.GetCamera();
 	if( !pCamera ) {
@@ -1271,6 +1439,13 @@ void MLTRasterizer::RasterizeScene(
 	pCaster->AttachScene( &pScene );
 	pScene.GetObjects()->PrepareForRendering();
 
+	// A cancelled realize pass leaves the TLAS unbuilt; return before
+	// anything traces a ray (see PixelBasedRasterizerHelper::RasterizeScene).
+	if( CancellationToken::Current().IsCancelled() ) {
+		GlobalLog()->PrintEasyEvent( "MLTRasterizer::RasterizeScene:: Cancelled before the bootstrap" );
+		return;
+	}
+
 	// Share the RayCaster's prepared LightSampler with the integrator
 	const LightSampler* pLS = pCaster->GetLightSampler();
 	pIntegrator->SetLightSampler( pLS );
@@ -1363,6 +1538,9 @@ void MLTRasterizer::RasterizeSceneAnimation(
 	IRasterizeSequence* /*pRasterSequence*/
 	) const
 {
+	// Ambient cancellation token; see PixelBasedRasterizerHelper::RasterizeScene.
+	CancellationScope cancelScope( pProgressFunc );
+
 	// Snapshot once at entry — structural changes serialize against rendering.
 	const ICamera* pCamera = pScene.GetCamera();
 	if( !pCamera ) {
@@ -1405,6 +1583,13 @@ void MLTRasterizer::RasterizeSceneAnimation(
 			pScene.GetObjects()->InvalidateSpatialStructure();
 		}
 		pScene.GetObjects()->PrepareForRendering();
+
+		// A cancelled realize pass leaves the TLAS unbuilt; stop before
+		// SetSceneTime or the bootstrap traces a ray
+		if( CancellationToken::Current().IsCancelled() ) {
+			cancelled = true;
+			break;
+		}
 		pScene.SetSceneTime( curtime );
 
 		GlobalLog()->PrintEx( eLog_Event,
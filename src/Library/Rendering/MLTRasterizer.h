@@ -299,7 +299,49 @@ namespace RISE
 				const Scalar u
 				) const;
 
+			/// Luminance of the bootstrap path for one seeded sampler.
+			/// The spectral rasterizer overrides this to evaluate with
+			/// EvaluateSampleSpectral.  Called concurrently from the
+			/// bootstrap workers.
+			virtual Scalar EvaluateBootstrapLuminance(
+				const IScene& scene,
+				const ICamera& camera,
+				ISampler& sampler,
+				const unsigned int width,
+				const unsigned int height
+				) const;
+
+			/// Phase 1 of a frame: evaluates all nBootstrap samples
+			/// across the global thread pool, in fixed blocks of seeds
+			/// handed out by an atomic counter.  Sample i always uses
+			/// seed i, so the results do not depend on which worker ran
+			/// them.  Fills `samples` and writes each luminance to
+			/// `cdf`, ready for BuildBootstrapCDF.  Returns false if
+			/// the user cancelled.  `workersUsed` is how many workers
+			/// ran, for turning the bootstrap time into a per-sample
+			/// cost.
+			bool RunBootstrap(
+				const IScene& scene,
+				const ICamera& camera,
+				const unsigned int width,
+				const unsigned int height,
+				std::vector<BootstrapSample>& samples,
+				std::vector<Scalar>& cdf,
+				unsigned int& workersUsed
+				) const;
+
 		public:
+			/// Turns the per-sample luminances in `cdf` into the
+			/// normalized bootstrap CDF, in place, with a blocked
+			/// parallel prefix sum, and returns the luminance total.
+			/// The blocks do not depend on `threads`, so the CDF and
+			/// the total are bit-identical for any thread count.  If
+			/// the total is zero the running sums are left as they are.
+			static Scalar BuildBootstrapCDF(
+				std::vector<Scalar>& cdf,
+				const unsigned int threads
+				);
+
 			MLTRasterizer(
 				IRayCaster* pCaster_,
 				const unsigned int maxEyeDepth,
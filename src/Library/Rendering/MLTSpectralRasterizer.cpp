@@ -48,6 +48,7 @@
 
 #include "pch.h"
 #include "../Utilities/RenderParallelScope.h"
+#include "../Utilities/CancellationToken.h"
 #include "MLTSpectralRasterizer.h"
 #include "../Utilities/Color/ColorUtils.h"
 #include "../RasterImages/RasterImage.h"
@@ -126,6 +127,22 @@ MLTSpectralRasterizer::~MLTSpectralRasterizer()
 {
 }
 
+//////////////////////////////////////////////////////////////////////
+// EvaluateBootstrapLuminance - bootstrap samples go through the
+// spectral evaluation so b matches what the chains splat.
+//////////////////////////////////////////////////////////////////////
+
+Scalar MLTSpectralRasterizer::EvaluateBootstrapLuminance(
+	const IScene& scene,
+	const ICamera& camera,
+	ISampler& sampler,
+	const unsigned int width,
+	const unsigned int height
+	) const
+{
+	return EvaluateSampleSpectral( scene, camera, sampler, width, height ).luminance;
+}
+
 //////////////////////////////////////////////////////////////////////
 // RunChainSegmentSpectral - Run a fixed number of spectral mutations
 // on an existing chain.  Mirrors RunChainSegment but calls
@@ -649,35 +666,27 @@ bool MLTSpectralRasterizer::RenderFrameOfMLTSpectral(
 		pProgressFunc->SetTitle( "MLT Spectral Bootstrap: " );
 	}
 
-	std::vector<BootstrapSample> bootstrapSamples( nBootstrap );
-	Scalar luminanceSum = 0;
+	std::vector<BootstrapSample> bootstrapSamples;
+	std::vector<Scalar> cdf;
+	unsigned int bootstrapWorkers = 1;
 
 	Timer bootstrapTimer;
 	bootstrapTimer.start();
 
 	// Bootstrap uses a PSSMLTSampler so the path generated for seed i
 	// can be EXACTLY reproduced later by the chain init creating a
-	// PSSMLTSampler with the same seed.  See MLTRasterizer::RasterizeScene
-	// bootstrap loop for the full rationale.
-	for( unsigned int i = 0; i < nBootstrap; i++ )
-	{
-		PSSMLTSampler* pBootSampler = new PSSMLTSampler( i, largeStepProb );
-		pBootSampler->StartIteration();
-
-		MLTSample sample = EvaluateSampleSpectral( pScene, pCamera, *pBootSampler, width, height );
-
-		bootstrapSamples[i].luminance = sample.luminance;
-		bootstrapSamples[i].seed = i;
-		luminanceSum += sample.luminance;
+	// PSSMLTSampler with the same seed.  See MLTRasterizer::RenderFrameOfMLT
+	// bootstrap for the full rationale.  RunBootstrap evaluates through
+	// our EvaluateBootstrapLuminance override.
+	if( !RunBootstrap( pScene, pCamera, width, height, bootstrapSamples, cdf, bootstrapWorkers ) ) {
+		return false;
+	}
 
-		safe_release( pBootSampler );
+	//////////////////////////////////////////////////////////////////
+	// Phase 1b: Build CDF
+	//////////////////////////////////////////////////////////////////
 
-		if( pProgressFunc && (i % 1000 == 0) ) {
-			if( !pProgressFunc->Progress( static_cast<double>(i), static_cast<double>(nBootstrap) ) ) {
-				return false;
-			}
-		}
-	}
+	const Scalar luminanceSum = BuildBootstrapCDF( cdf, bootstrapWorkers );
 
 	bootstrapTimer.stop();
 
@@ -693,23 +702,6 @@ bool MLTSpectralRasterizer::RenderFrameOfMLTSpectral(
 
 	GlobalLog()->PrintEx( eLog_Event, "MLTSpectralRasterizer:: Bootstrap complete. Mean luminance = %f, Normalization b = %f", b_mean, b );
 
-	//////////////////////////////////////////////////////////////////
-	// Phase 1b: Build CDF
-	//////////////////////////////////////////////////////////////////
-
-	std::vector<Scalar> cdf( nBootstrap );
-	cdf[0] = bootstrapSamples[0].luminance;
-	for( unsigned int i = 1; i < nBootstrap; i++ ) {
-		cdf[i] = cdf[i-1] + bootstrapSamples[i].luminance;
-	}
-
-	if( cdf[nBootstrap-1] > 0 ) {
-		const Scalar invTotal = 1.0 / cdf[nBootstrap-1];
-		for( unsigned int i = 0; i < nBootstrap; i++ ) {
-			cdf[i] *= invTotal;
-		}
-	}
-
 	//////////////////////////////////////////////////////////////////
 	// Phase 2: Initialize chain states (using spectral evaluation)
 	//////////////////////////////////////////////////////////////////
@@ -730,7 +722,8 @@ bool MLTSpectralRasterizer::RenderFrameOfMLTSpectral(
 
 	if( bootstrapMs > 0 && nBootstrap > 0 )
 	{
-		const double msPerSample = static_cast<double>( bootstrapMs ) / static_cast<double>( nBootstrap );
+		const double msPerSample = static_cast<double>( bootstrapMs ) * static_cast<double>( bootstrapWorkers ) /
+			static_cast<double>( nBootstrap );
 		const int effectiveThreads = threads > 0 ? threads : 1;
 		const double estTotalMs = msPerSample * static_cast<double>( totalMutations ) / static_cast<double>( effectiveThreads );
 		// Target 2500 ms per round (instead of 5000 ms) — see
@@ -1022,6 +1015,9 @@ void MLTSpectralRasterizer::RasterizeScene(
 	IRasterizeSequence* /*pRasterSequence*/
 	) const
 {
+	// Ambient cancellation token; see PixelBasedRasterizerHelper::RasterizeScene.
+	CancellationScope cancelScope( pProgressFunc );
+
 	// Snapshot once at entry — structural changes serialize against rendering.
 	const ICamera* pCamera = pScene.GetCamera();
 	if( !pCamera ) {
@@ -1039,6 +1035,13 @@ void MLTSpectralRasterizer::RasterizeScene(
 
 	pCaster->AttachScene( &pScene );
 	pScene.GetObjects()->PrepareForRendering();
+
+	// A cancelled realize pass leaves the TLAS unbuilt; return before
+	// anything traces a ray (see PixelBasedRasterizerHelper::RasterizeScene).
+	if( CancellationToken::Current().IsCancelled() ) {
+		GlobalLog()->PrintEasyEvent( "MLTSpectralRasterizer::RasterizeScene:: Cancelled before the bootstrap" );
+		return;
+	}
 	pIntegrator->SetLightSampler( pCaster->GetLightSampler() );
 
 	IRasterImage* pImage = 0;
@@ -1101,6 +1104,9 @@ void MLTSpectralRasterizer::RasterizeSceneAnimation(
 	IRasterizeSequence* /*pRasterSequence*/
 	) const
 {
+	// Ambient cancellation token; see PixelBasedRasterizerHelper::RasterizeScene.
+	CancellationScope cancelScope( pProgressFunc );
+
 	// Snapshot once at entry — structural changes serialize against rendering.
 	const ICamera* pCamera = pScene.GetCamera();
 	if( !pCamera ) {
@@ -1137,6 +1143,13 @@ void MLTSpectralRasterizer::RasterizeSceneAnimation(
 			pScene.GetObjects()->InvalidateSpatialStructure();
 		}
 		pScene.GetObjects()->PrepareForRendering();
+
+		// A cancelled realize pass leaves the TLAS unbuilt; stop before
+		// SetSceneTime or the bootstrap traces a ray
+		if( CancellationToken::Current().IsCancelled() ) {
+			cancelled = true;
+			break;
+		}
 		pScene.SetSceneTime( curtime );
 
 		GlobalLog()->PrintEx( eLog_Event,
@@ -85,6 +85,15 @@ namespace RISE
 				const unsigned int height
 				) const;
 
+			/// Bootstrap luminance through EvaluateSampleSpectral
+			Scalar EvaluateBootstrapLuminance(
+				const IScene& scene,
+				const ICamera& camera,
+				ISampler& sampler,
+				const unsigned int width,
+				const unsigned int height
+				) const;
+
 			/// Run a fixed number of spectral mutations on an existing chain.
 			/// Mirrors RunChainSegment but calls EvaluateSampleSpectral
 			/// instead of EvaluateSample.
@@ -206,7 +206,7 @@ void PathTracingPelRasterizer::PreRenderSetup(
 	if( !pSMSPhotonMap ) {
 		pSMSPhotonMap = new SMSPhotonMap();
 	}
-	const unsigned int stored = pSMSPhotonMap->Build( pScene, mSMSPhotonCount );
+	const unsigned int stored = pSMSPhotonMap->Build( pScene, mSMSPhotonCount, mMotionTimeOpen, mMotionExposure );
 	pSolver->SetPhotonMap( stored > 0 ? pSMSPhotonMap : 0 );
 }
 
@@ -406,7 +406,7 @@ void PathTracingPelRasterizer::IntegratePixel(
 			weights += weight;
 
 			if( temporal_samples ) {
-				pScene.GetAnimator()->EvaluateAtTime( temporal_start + (rc.random.CanonicalRandom()*temporal_exposure) );
+				SetTemporalSampleTime( pScene, temporal_start + (rc.random.CanonicalRandom()*temporal_exposure) );
 			}
 
 			// For ZSobol, remap the sample index via Morton code for
@@ -99,7 +99,7 @@ void PathTracingSpectralRasterizer::PreRenderSetup(
 	if( !pSMSPhotonMap ) {
 		pSMSPhotonMap = new SMSPhotonMap();
 	}
-	const unsigned int stored = pSMSPhotonMap->Build( pScene, mSMSPhotonCount );
+	const unsigned int stored = pSMSPhotonMap->Build( pScene, mSMSPhotonCount, mMotionTimeOpen, mMotionExposure );
 	pSolver->SetPhotonMap( stored > 0 ? pSMSPhotonMap : 0 );
 }
 
@@ -333,7 +333,7 @@ void PathTracingSpectralRasterizer::IntegratePixel(
 				weights += weight;
 
 				if( temporal_samples ) {
-					pScene.GetAnimator()->EvaluateAtTime( temporal_start + (rc.random.CanonicalRandom()*temporal_exposure) );
+					SetTemporalSampleTime( pScene, temporal_start + (rc.random.CanonicalRandom()*temporal_exposure) );
 				}
 
 				const uint32_t effectiveIndex = useZSobol
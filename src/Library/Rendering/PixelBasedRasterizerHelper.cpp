@@ -28,10 +28,13 @@
 #include "BlockRasterizeSequence.h"
 #include "HilbertRasterizeSequence.h"
 #include "MortonRasterizeSequence.h"
+#include "AdaptiveTileSequence.h"
 #include "ProgressiveFilm.h"
 #include "../RISE_API.h"
 #include "../Interfaces/IScenePriv.h"
+#include "../Animation/Animator.h"
 #include "../Utilities/RenderParallelScope.h"
+#include "../Utilities/CancellationToken.h"
 
 #include "FrameStore.h"  // L6c — needed unconditionally by AcquireRenderImage
 #include "AOVBuffers.h"
@@ -58,6 +61,11 @@ PixelBasedRasterizerHelper::PixelBasedRasterizerHelper(
   mPersistentH( 0 ),
   mProgressiveFilm( 0 ),
   mTotalProgressiveSPP( 0 ),
+  mCheckerboardPass( false ),
+  mPerRayMotion( false ),
+  mMotionTimeOpen( 0 ),
+  mMotionExposure( 0 ),
+  mPixelReuse( 0 ),
   mProgressBase( 0 ),
   mProgressWeight( 0 ),
   mProgressTotal( 0 ),
@@ -413,6 +421,74 @@ void* RasterizeBlockAnimation_ThreadProc( void* ptr )
 	return 0;
 }
 
+bool PixelBasedRasterizerHelper::SameFirstHit(
+	const RuntimeContext& rc,
+	const IScene& scene,
+	const unsigned int x,
+	const unsigned int y,
+	const unsigned int height,
+	const IObject* pObject,
+	const Point3& ptHit
+	) const
+{
+	// Same screen point as the single-ray branch of IntegratePixel
+	Ray ray;
+	if( !scene.GetCamera()->GenerateRay( rc, ray, Point2( x, height-y ) ) ) {
+		return false;
+	}
+
+	const RasterizerState rast = {x,y};
+	RayIntersection ri( ray, rast );
+	scene.GetObjects()->IntersectRay( ri, true, true, false );
+	if( !ri.geometric.bHit || ri.pObject != pObject ) {
+		return false;
+	}
+
+	// A point that slid along the same object by more than a sliver of
+	// the distance to it has moved onto a different part of the object
+	return Point3Ops::Distance( ri.geometric.ptIntersection, ptHit ) <= 0.02 * ri.geometric.range;
+}
+
+void PixelBasedRasterizerHelper::FillCheckerboardBlock( IRasterImage& image, const Rect& rect, const unsigned int lastRow ) const
+{
+	// Every 4-neighbour of an untraced pixel has the traced parity, so
+	// this only reads pixels the block itself just wrote.  Neighbours
+	// outside the block are left alone: another worker may own them.
+	for( unsigned int y=rect.top; y<=lastRow; y++ )
+	{
+		for( unsigned int x=rect.left + ((rect.left + y + 1) & 1); x<=rect.right; x+=2 )
+		{
+			RISEPel sum( 0, 0, 0 );
+			Scalar alpha = 0;
+			unsigned int n = 0;
+
+			if( x > rect.left ) {
+				const RISEColor c = image.GetPEL( x-1, y );
+				sum = sum + c.base; alpha += c.a; n++;
+			}
+			if( x < rect.right ) {
+				const RISEColor c = image.GetPEL( x+1, y );
+				sum = sum + c.base; alpha += c.a; n++;
+			}
+			if( y > rect.top ) {
+				const RISEColor c = image.GetPEL( x, y-1 );
+				sum = sum + c.base; alpha += c.a; n++;
+			}
+			if( y < lastRow ) {
+				const RISEColor c = image.GetPEL( x, y+1 );
+				sum = sum + c.base; alpha += c.a; n++;
+			}
+
+			// A one-pixel block has nothing to borrow from; it keeps
+			// whatever the previous pass left there
+			if( n ) {
+				const Scalar inv = 1.0 / Scalar( n );
+				image.SetPEL( x, y, RISEColor( sum * inv, alpha * inv ) );
+			}
+		}
+	}
+}
+
 void PixelBasedRasterizerHelper::SPRasterizeSingleBlock( const RuntimeContext& rc, IRasterImage& image, const IScene& scene, const Rect& rect, const unsigned int height ) const
 {
 	// Progressive tile-level early-out: skip if no pixel in the tile needs more samples.
@@ -615,16 +691,75 @@ void PixelBasedRasterizerHelper::SPRasterizeSingleBlock( const RuntimeContext& r
 	auto lastFlush = FlushClock::now();
 	bool earlyAbort = false;
 
+	// A checkerboard pass traces every other pixel (the parity is
+	// fixed in image space, so neighbouring blocks tile seamlessly)
+	// and fills the rest once the block's rows are done.
+	const bool checkerboard = mCheckerboardPass && !rc.pProgressiveFilm;
+	const unsigned int xStep = checkerboard ? 2 : 1;
+	unsigned int lastRow = rect.top;
+
+	// Interactive pixel reuse (see mPixelReuse).  Only passes that
+	// write each pixel once, straight to the image, can take a pixel
+	// from the history or add one to it.  A checkerboard pass does so
+	// for the pixels it traces; the filled ones are never recorded.
+	PixelReuseCache* const pReuse =
+		( mPixelReuse && !rc.pProgressiveFilm && !pFilteredFilm && !pAOVBuffers &&
+		  rc.pass == RuntimeContext::PASS_NORMAL &&
+		  mPixelReuse->Width() == image.GetWidth() && mPixelReuse->Height() == image.GetHeight() ) ?
+		mPixelReuse : 0;
+	const unsigned int reuseSpp = pSampling ? pSampling->GetNumSamples() : 1;
+
 	for( unsigned int y=rect.top; y<=rect.bottom; y++ )
 	{
-		for( unsigned int x=rect.left; x<=rect.right; x++ )
+		const unsigned int xStart = checkerboard ? rect.left + ((rect.left + y) & 1) : rect.left;
+		for( unsigned int x=xStart; x<=rect.right; x+=xStep )
 		{
 			RISEColor	c;
-			IntegratePixel( rc, x, y, height, scene, c );
+			if( pReuse ) {
+				// A pixel carried over from the last camera pose is only
+				// taken once one ray confirms it still sees the same point
+				const IObject* pObject = 0;
+				Point3 ptHit;
+				if( pReuse->NeedsConfirm( x, y, reuseSpp, pObject, ptHit ) ) {
+					pReuse->Confirm( x, y, SameFirstHit( rc, scene, x, y, height, pObject, ptHit ) );
+				}
+				if( pReuse->Fetch( x, y, reuseSpp, c ) ) {
+					image.SetPEL( x, y, c );
+					continue;
+				}
+			}
+
+			// The caster records its first hit here, so the history
+			// needs no ray of its own
+			PrimaryHit hit;
+			rc.pPrimaryHit = pReuse ? &hit : 0;
+			// Only the training passes of a per-ray motion frame (path
+			// guiding, optimal MIS) get here with a shutter; each of
+			// their samples then takes its own time
+			IntegratePixel( rc, x, y, height, scene, c, mMotionExposure > 0, mMotionTimeOpen, mMotionExposure );
+			rc.pPrimaryHit = 0;
 			ColorMath::EnsurePositve(c.base);
 			if( c.a < 0.0 ) c.a = 0.0;
 			if( c.a > 1.0 ) c.a = 1.0;
 			image.SetPEL( x, y, c );
+			if( pReuse && hit.captured ) {
+				pReuse->Record( x, y, reuseSpp, hit, c );
+			}
+
+			// Per-pixel cancellation poll.  A pixel at production sample
+			// counts can take tens of milliseconds on a heavy scene, so a
+			// row (let alone the 100 ms flush below) is too coarse for the
+			// interactive cancel-restart loop.  `IsCancelled()` is a pure
+			// query -- one virtual call and an atomic load -- so it costs
+			// nothing next to IntegratePixel.
+			if( pProgressFunc && pProgressFunc->IsCancelled() ) {
+				earlyAbort = true;
+				break;
+			}
+		}
+		lastRow = y;
+		if( earlyAbort ) {
+			break;
 		}
 
 		// Outer-loop time check so the cost is one steady_clock::now()
@@ -674,6 +809,10 @@ void PixelBasedRasterizerHelper::SPRasterizeSingleBlock( const RuntimeContext& r
 		}
 	}
 
+	if( checkerboard ) {
+		FillCheckerboardBlock( image, rect, lastRow );
+	}
+
 	(void)earlyAbort;  // The end-of-block EndTile loop below still runs
 	                   // regardless — releases the tile mutexes that
 	                   // were re-acquired by the last flush's BeginTile
@@ -825,8 +964,17 @@ void PixelBasedRasterizerHelper::SPRasterizeSingleBlockOfAnimation(
 				if( c.a < 0.0 ) c.a = 0.0;
 				if( c.a > 1.0 ) c.a = 1.0;
 				image.SetPEL( x, y, c );
+
+				// Per-pixel cancellation poll; see SPRasterizeSingleBlock
+				if( pProgressFunc && pProgressFunc->IsCancelled() ) {
+					earlyAbortAnim = true;
+					break;
+				}
 			}
 		}
+		if( earlyAbortAnim ) {
+			break;
+		}
 
 		if( fsBracket && !skipBlockOutput && y < rect.bottom ) {
 			const auto now = FlushClockAnim::now();
@@ -985,6 +1133,12 @@ void PixelBasedRasterizerHelper::RasterizeScene(
 	IRasterizeSequence* pRasterSequence
 	) const
 {
+	// Ambient cancellation token for the work below the block dispatcher
+	// that has no progress callback of its own -- the realize pass, the
+	// TLAS build and lazy SSS point-set builds.  ThreadPool::ParallelFor
+	// carries it onto the workers; see CancellationToken.h.
+	CancellationScope cancelScope( pProgressFunc );
+
 	// Snapshot once at entry — see PredictTimeToRasterizeScene.  Tier 2 §5.5:
 	// a free-fly ViewportPose supplies a viewport-private override camera the
 	// interactive still-frame renders THROUGH; the real scene still flows to the
@@ -1052,6 +1206,27 @@ void PixelBasedRasterizerHelper::RasterizeScene(
 	// world-space bounding boxes before any multi-threaded rendering begins.
 	pScene.GetObjects()->PrepareForRendering();
 
+	// A restart that lands in the realize pass leaves objects unrealized and
+	// the TLAS unbuilt, and nothing below may run then: the first ray would
+	// build the TLAS lazily, behind a realize pass that cannot be cancelled.
+	// Polled again after the pre-passes, which can be cancelled as well.  A
+	// render abandoned here publishes nothing.
+	const auto abandonBeforeDispatch = [&]() -> bool {
+		if( !CancellationToken::Current().IsCancelled() ) {
+			return false;
+		}
+		GlobalLog()->PrintEasyEvent( "PixelBasedRasterizerHelper::RasterizeScene:: Cancelled before the main pass" );
+		safe_release( pFilteredFilm );
+		pFilteredFilm = 0;
+		safe_release( pFilteredScratch );
+		pFilteredScratch = 0;
+		safe_release( pImage );
+		return true;
+	};
+	if( abandonBeforeDispatch() ) {
+		return;
+	}
+
 	// Build any pending photon maps (deferred from scene parse).  Safe window:
 	// after PrepareForRendering but before any worker thread spawns — matches
 	// the irradiance-cache pre-pass precedent below.  Idempotent: consumed
@@ -1067,6 +1242,11 @@ void PixelBasedRasterizerHelper::RasterizeScene(
 	// Pre-render hook (e.g. path guiding training)
 	PreRenderSetup( pScene, pRect );
 
+	if( abandonBeforeDispatch() ) {
+		PostRenderCleanup();
+		return;
+	}
+
 	// Compute tile size once — keeps tilesPerThread ≥ 8 across all
 	// image dimensions and thread counts.
 	unsigned int tileEdge = ComputeTileSize(
@@ -1200,6 +1380,13 @@ void PixelBasedRasterizerHelper::RasterizeScene(
 		// default; user can override via scene option in future.
 		PreviewScheduler previewScheduler( 7.5 );
 
+		// With adaptive sampling on, each pass after the first gets
+		// only the tiles that still have unfinished pixels, worst
+		// first.  They are ranked at the end of the previous pass,
+		// which also tells us when nothing is left to do.
+		const bool bAdaptiveTiles = GetAdaptiveTargetSamples() > 0;
+		AdaptiveTileSequence* pNextSeq = 0;
+
 		for( unsigned int passIdx = 0; passIdx < numPasses; passIdx++ )
 		{
 			const unsigned int passSPP = r_min( spp, totalSPP - passIdx * spp );
@@ -1221,7 +1408,11 @@ void PixelBasedRasterizerHelper::RasterizeScene(
 			mProgressWeight = static_cast<double>( passSPP );
 			mProgressTotal  = totalProgressUnits;
 
-			MortonRasterizeSequence* pPassSeq = new MortonRasterizeSequence( tileEdge );
+			MortonRasterizeSequence* pPassSeq = pNextSeq;
+			if( !pPassSeq ) {
+				pPassSeq = new MortonRasterizeSequence( tileEdge );
+			}
+			pNextSeq = 0;
 			const bool passCompleted = RasterizeScenePass( RuntimeContext::PASS_NORMAL, pScene, *pImage, pRect, *pPassSeq );
 			safe_release( pPassSeq );
 
@@ -1240,7 +1431,16 @@ void PixelBasedRasterizerHelper::RasterizeScene(
 			}
 
 			const bool isFinalPass = ( passIdx == numPasses - 1 );
-			const bool runPreview  = isFinalPass || previewScheduler.ShouldRunPreview();
+
+			bool allTilesDone = false;
+			if( bAdaptiveTiles && !isFinalPass ) {
+				pNextSeq = new AdaptiveTileSequence( tileEdge, progFilm, totalSPP );
+				allTilesDone = pNextSeq->Rank( renderStartX, renderEndX, renderStartY, renderEndY ) == 0;
+			}
+
+			// Resolve right away once everything has converged, so the
+			// convergence check below ends the render
+			const bool runPreview  = isFinalPass || allTilesDone || previewScheduler.ShouldRunPreview();
 
 			if( runPreview ) {
 				// Intermediate preview: rebuild the displayed image from the
@@ -1276,6 +1476,8 @@ void PixelBasedRasterizerHelper::RasterizeScene(
 			}
 		}
 
+		safe_release( pNextSeq );
+
 		if( pAOVBuffers ) {
 			for( unsigned int y=0; y<height; y++ ) {
 				for( unsigned int x=0; x<width; x++ ) {
@@ -1462,10 +1664,11 @@ bool PixelBasedRasterizerHelper::RenderFrameOfAnimationPass(
 
 	int threads = HowManyThreadsToSpawn();
 
-	// We can support multiprocessors if exposure is turned on, due to the way we do
-	// exposures.  For each pixel sample, the scene time is reset, this is bad for MP
+	// With exposure on, each pixel sample resets the scene time through
+	// the animator, which every thread shares, so only per-ray motion
+	// (see BeginPerRayMotion) lets such a frame go multithreaded
 
-	if( threads>1 && framedata.exposure==0 ) {
+	if( threads>1 && (framedata.exposure==0 || mPerRayMotion) ) {
 
 		// Start the raster sequence
 		seq.Begin( startx, endx, starty, endy );
@@ -1544,6 +1747,99 @@ bool PixelBasedRasterizerHelper::RenderFrameOfAnimationPass(
 	}
 }
 
+bool PixelBasedRasterizerHelper::BeginPerRayMotion(
+	const IScene& pScene,
+	const Scalar timeOpen,
+	const Scalar timeClose,
+	const Scalar timeNominal
+	) const
+{
+	Animator* pAnimator = dynamic_cast<Animator*>( pScene.GetAnimator() );
+	const IObjectManager* pObjects = pScene.GetObjects();
+	if( !pAnimator || !pObjects ) {
+		return false;
+	}
+
+	// Only object transforms can be carried by the keys.  Anything else
+	// the animation touches would still need EvaluateAtTime per sample.
+	std::vector<IKeyframable*> elements;
+	pAnimator->GetAnimatedElements( elements );
+
+	std::vector<Object*> moving;
+	for( size_t i=0; i<elements.size(); i++ ) {
+		Object* pObject = dynamic_cast<Object*>( elements[i] );
+		if( !pObject ) {
+			GlobalLog()->PrintEasyInfo( "PixelBasedRasterizerHelper:: Animation changes more than object transforms, motion blur stays single threaded" );
+			return false;
+		}
+		// Light sampling picks points on an emitter with its static
+		// transform, which would disagree with where its rays hit it
+		const IMaterial* pMaterial = pObject->GetMaterial();
+		if( pMaterial && pMaterial->GetEmitter() ) {
+			GlobalLog()->PrintEasyInfo( "PixelBasedRasterizerHelper:: A moving object is an emitter, motion blur stays single threaded" );
+			return false;
+		}
+		moving.push_back( pObject );
+	}
+
+	const int keysOpt = GlobalOptions().ReadInt( "motion_blur_keys", 9 );
+	const unsigned int numKeys = keysOpt > 2 ? static_cast<unsigned int>( keysOpt ) : 2;
+
+	std::vector< std::vector<Matrix4> > keys( moving.size() );
+	for( unsigned int k=0; k<numKeys; k++ ) {
+		pAnimator->EvaluateAtTime( timeOpen + (timeClose - timeOpen) * Scalar( k ) / Scalar( numKeys - 1 ) );
+		for( size_t i=0; i<moving.size(); i++ ) {
+			keys[i].push_back( moving[i]->GetFinalTransformMatrix() );
+		}
+	}
+	pAnimator->EvaluateAtTime( timeNominal );
+
+	for( size_t i=0; i<moving.size(); i++ ) {
+		if( !moving[i]->SetMotion( timeOpen, timeClose, keys[i] ) ) {
+			for( size_t j=0; j<i; j++ ) {
+				moving[j]->ClearMotion();
+			}
+			GlobalLog()->PrintEasyInfo( "PixelBasedRasterizerHelper:: A moving object cannot take motion keys, motion blur stays single threaded" );
+			return false;
+		}
+	}
+
+	// The top level BVH has to be built from the motion boxes, and
+	// before the workers start (see RenderParallelScope)
+	pObjects->InvalidateSpatialStructure();
+	pObjects->PrepareForRendering();
+
+	mMovingObjects = moving;
+	mPerRayMotion = true;
+	mMotionTimeOpen = timeOpen;
+	mMotionExposure = timeClose - timeOpen;
+
+	GlobalLog()->PrintEx( eLog_Event,
+		"PixelBasedRasterizerHelper:: Per-ray motion blur over [%f, %f], %u moving objects, %u keys",
+		timeOpen, timeClose, static_cast<unsigned int>( moving.size() ), numKeys );
+	return true;
+}
+
+void PixelBasedRasterizerHelper::EndPerRayMotion( const IScene& pScene ) const
+{
+	for( size_t i=0; i<mMovingObjects.size(); i++ ) {
+		mMovingObjects[i]->ClearMotion();
+	}
+	mMovingObjects.clear();
+	mPerRayMotion = false;
+	mMotionTimeOpen = 0;
+	mMotionExposure = 0;
+	// Pool workers already went back to the time they were handed
+	// (see ThreadPool::ParallelFor); this thread traced samples itself
+	Ray::ThreadTime() = 0;
+
+	const IObjectManager* pObjects = pScene.GetObjects();
+	if( pObjects ) {
+		pObjects->InvalidateSpatialStructure();
+		pObjects->PrepareForRendering();
+	}
+}
+
 void PixelBasedRasterizerHelper::RenderFrameOfAnimation(
 	const IScene& pScene,
 	const Rect* pRect,
@@ -1576,6 +1872,14 @@ void PixelBasedRasterizerHelper::RenderFrameOfAnimation(
 		return;
 	}
 
+	// A restart may have cut the caller's realize pass short, leaving the
+	// TLAS unbuilt (see RasterizeScene).  The caller's Progress() poll
+	// after this returns ends the animation.
+	const CancellationToken& cancel = CancellationToken::Current();
+	if( cancel.IsCancelled() ) {
+		return;
+	}
+
 	// Exposure time can change from frame to frame
 	const Scalar exposure = pCam->GetExposureTime();
 	const Scalar scanningRate = pCam->GetScanningRate();
@@ -1623,6 +1927,18 @@ void PixelBasedRasterizerHelper::RenderFrameOfAnimation(
 	framedata.pixelRate = pixelRate;
 	framedata.scanningRate = scanningRate;
 
+	// Motion blur: the temporal samples of this frame fall anywhere in
+	// [shutterOpen, shutterClose].  If the animation allows, move the
+	// objects per ray so the frame can use every thread.
+	bool bPerRayMotion = false;
+	if( exposure > 0 && HowManyThreadsToSpawn() > 1 ) {
+		const Scalar scanSpan = scanningRate * Scalar( image.GetHeight() - 1 );
+		const Scalar pixelSpan = pixelRate * Scalar( image.GetWidth() - 1 );
+		const Scalar shutterOpen = base_cur_time + r_min( scanSpan, Scalar( 0 ) ) + r_min( pixelSpan, Scalar( 0 ) );
+		const Scalar shutterClose = base_cur_time + r_max( scanSpan, Scalar( 0 ) ) + r_max( pixelSpan, Scalar( 0 ) ) + exposure;
+		bPerRayMotion = BeginPerRayMotion( pScene, shutterOpen, shutterClose, time );
+	}
+
 	// Pre-render hook: e.g. VCM traces light subpaths and populates its
 	// light vertex store here.  RasterizeScene calls this before the
 	// main render; the animation path historically skipped it, so the
@@ -1634,6 +1950,14 @@ void PixelBasedRasterizerHelper::RenderFrameOfAnimation(
 	// the per-iteration loop below honors that just like RasterizeScene.
 	PreRenderSetup( pScene, pRect );
 
+	if( cancel.IsCancelled() ) {
+		PostRenderCleanup();
+		if( bPerRayMotion ) {
+			EndPerRayMotion( pScene );
+		}
+		return;
+	}
+
 	// Capture the progress base the animation caller set for this
 	// frame — the per-pass loop below extends it; the caller advances
 	// it once we return.
@@ -1752,6 +2076,11 @@ void PixelBasedRasterizerHelper::RenderFrameOfAnimation(
 
 		PreviewScheduler previewScheduler( 7.5 );
 
+		// Converged tiles are dropped from later passes, as in
+		// RasterizeScene
+		const bool bAdaptiveTiles = GetAdaptiveTargetSamples() > 0;
+		AdaptiveTileSequence* pNextSeq = 0;
+
 		for( unsigned int passIdx = 0; passIdx < numPasses; passIdx++ )
 		{
 			const unsigned int passSPP = r_min( spp, totalSPP - passIdx * spp );
@@ -1778,7 +2107,11 @@ void PixelBasedRasterizerHelper::RenderFrameOfAnimation(
 			                * static_cast<double>( passSPP );
 			mProgressWeight = static_cast<double>( passSPP );
 
-			MortonRasterizeSequence* pPassSeq = new MortonRasterizeSequence( tileEdgeAnim );
+			MortonRasterizeSequence* pPassSeq = pNextSeq;
+			if( !pPassSeq ) {
+				pPassSeq = new MortonRasterizeSequence( tileEdgeAnim );
+			}
+			pNextSeq = 0;
 			RenderFrameOfAnimationPass( RuntimeContext::PASS_NORMAL, pScene, pRect, field, image, time, *pPassSeq, framedata );
 			safe_release( pPassSeq );
 
@@ -1808,6 +2141,17 @@ void PixelBasedRasterizerHelper::RenderFrameOfAnimation(
 			}
 
 			const bool isFinalPass = ( passIdx == numPasses - 1 );
+
+			if( bAdaptiveTiles && !isFinalPass ) {
+				pNextSeq = new AdaptiveTileSequence( tileEdgeAnim, progFilm, totalSPP );
+				if( pNextSeq->Rank( animStartX, animEndX, animStartY, animEndY ) == 0 ) {
+					GlobalLog()->PrintEx( eLog_Event,
+						"RenderFrameOfAnimation:: all pixels complete after pass %u/%u",
+						passIdx+1, numPasses );
+					break;
+				}
+			}
+
 			const bool runPreview  = isFinalPass || previewScheduler.ShouldRunPreview();
 
 			if( runPreview ) {
@@ -1828,6 +2172,8 @@ void PixelBasedRasterizerHelper::RenderFrameOfAnimation(
 			}
 		}
 
+		safe_release( pNextSeq );
+
 		// Ensure `image` carries the final progressive state even when
 		// the loop exited early (cancellation) without a final preview.
 		{
@@ -1875,6 +2221,10 @@ void PixelBasedRasterizerHelper::RenderFrameOfAnimation(
 	// Post-render hook (symmetric with RasterizeScene).
 	PostRenderCleanup();
 
+	if( bPerRayMotion ) {
+		EndPerRayMotion( pScene );
+	}
+
 	// Resolve filtered film for this frame.
 	// When OIDN denoising is active, skip the resolve: OIDN is trained
 	// on raw MC noise and the inline box-filtered estimate provides
@@ -1914,6 +2264,9 @@ void PixelBasedRasterizerHelper::RasterizeSceneAnimation(
 	IRasterizeSequence* pRasterSequence
 	) const
 {
+	// Ambient cancellation token; see PixelBasedRasterizerHelper::RasterizeScene.
+	CancellationScope cancelScope( pProgressFunc );
+
 	// Snapshot once at entry — see PredictTimeToRasterizeScene.
 	const ICamera* pCam = pScene.GetCamera();
 	if( !pCam ) {
@@ -22,6 +22,8 @@
 #include "Rasterizer.h"
 #include "FilteredFilm.h"
 #include "AOVBuffers.h"
+#include "PixelReuseCache.h"
+#include "../Objects/Object.h"
 #include "../Utilities/RuntimeContext.h"
 #include "../Utilities/ProgressiveConfig.h"
 #include <typeinfo>	// Model-B F2 S3 fix round: ForTest_SamplingKernelName's typeid
@@ -157,6 +159,24 @@ namespace RISE
 				IRasterizeSequence& seq 
 				) const;
 
+			//! Gives every object the animator moves transform keys over
+			//! [timeOpen, timeClose] and rebuilds the top level BVH from
+			//! their motion boxes, then puts the scene back at
+			//! timeNominal.  After this the temporal samples of a frame
+			//! only set their rays' time, so the frame can be traced by
+			//! all threads.  Returns false, changing nothing, when the
+			//! animation touches anything the keys cannot carry: a
+			//! camera, a light, a painter, a CSG object or an emitter.
+			bool BeginPerRayMotion(
+				const IScene& pScene,
+				const Scalar timeOpen,
+				const Scalar timeClose,
+				const Scalar timeNominal
+				) const;
+
+			//! Undoes BeginPerRayMotion
+			void EndPerRayMotion( const IScene& pScene ) const;
+
 			//! Returns false when the progress callback cancels before all blocks finish.
 			bool RenderFrameOfAnimationPass(
 				const RuntimeContext::PASS pass,
@@ -220,6 +240,57 @@ namespace RISE
 			mutable ProgressiveFilm*	mProgressiveFilm;	///< Per-pixel state for progressive multi-pass rendering
 			mutable unsigned int		mTotalProgressiveSPP;	///< Total SPP budget across all progressive passes
 
+			//! Checkerboard pass.  When set, SPRasterizeSingleBlock traces
+			//! only the pixels with (x+y) even and fills each of the others
+			//! from its traced neighbours inside the same block, so a pass
+			//! costs half the primary rays and still covers every pixel.
+			//! InteractivePelRasterizer sets it for live-drag passes; the
+			//! progressive and animation paths ignore it.
+			mutable bool				mCheckerboardPass;
+
+			//! Set between BeginPerRayMotion and EndPerRayMotion
+			mutable bool				mPerRayMotion;
+			mutable std::vector<Object*>	mMovingObjects;
+
+			//! Shutter of a per-ray motion frame.  Pre-passes that trace
+			//! outside the pixel loop (light subpaths, photons, training
+			//! passes) spread their paths over [open, open+exposure);
+			//! the exposure is zero whenever mPerRayMotion is not set
+			mutable Scalar				mMotionTimeOpen;
+			mutable Scalar				mMotionExposure;
+
+			//! Moves the scene to the time of one temporal sample.  Under
+			//! per-ray motion only the rays this thread builds change
+			//! time; otherwise the animator re-evaluates the whole scene,
+			//! which is why that case has to stay single threaded.
+			void SetTemporalSampleTime( const IScene& pScene, const Scalar t ) const
+			{
+				if( mPerRayMotion ) {
+					Ray::ThreadTime() = t;
+				} else {
+					pScene.GetAnimator()->EvaluateAtTime( t );
+				}
+			}
+
+			//! Fills the untraced half of a checkerboard block from the
+			//! traced 4-neighbours of each pixel, rows top..lastRow only
+			void FillCheckerboardBlock( IRasterImage& image, const Rect& rect, const unsigned int lastRow ) const;
+
+			//! Pixel history for the interactive preview.  Null unless a
+			//! subclass installs one.  When set and sized to the image,
+			//! SPRasterizeSingleBlock copies each pixel the history still
+			//! holds at no fewer samples than the pass asks for, and
+			//! records every pixel it traces along with the first hit the
+			//! caster reported (RuntimeContext::pPrimaryHit).  Progressive,
+			//! filtered-film and AOV passes bypass it.  Not owned.
+			mutable PixelReuseCache*	mPixelReuse;
+
+			//! Whether the centre ray of pixel (x,y) still hits pObject at
+			//! about ptHit.  Confirms pixels reprojected from another pose.
+			bool SameFirstHit( const RuntimeContext& rc, const IScene& scene,
+				const unsigned int x, const unsigned int y, const unsigned int height,
+				const IObject* pObject, const Point3& ptHit ) const;
+
 			// Weighted progress state.  The progressive loop fills
 			// these before each RasterizeScenePass call so the
 			// dispatcher can report a single 0..1 progress bar
@@ -0,0 +1,244 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  PixelReuseCache.cpp - Implementation of the interactive pixel
+//    history
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//  Comments:
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "PixelReuseCache.h"
+
+#include "../Utilities/Math3D/Math3D.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace RISE;
+using namespace RISE::Implementation;
+
+namespace
+{
+	// cos 2 degrees: how far the view of a hit point may turn before
+	// Reproject drops the pixel
+	const Scalar kMaxViewCos = 0.99939;
+}
+
+PixelReuseCache::PixelReuseCache() :
+  m_width( 0 ),
+  m_height( 0 )
+{
+}
+
+void PixelReuseCache::Resize( const unsigned int width, const unsigned int height )
+{
+	if( width == m_width && height == m_height ) {
+		return;
+	}
+
+	m_width = width;
+	m_height = height;
+	m_entries.assign( size_t( width ) * height, Entry() );
+}
+
+void PixelReuseCache::InvalidateAll()
+{
+	for( size_t i = 0; i < m_entries.size(); i++ ) {
+		m_entries[i].spp = 0;
+	}
+}
+
+void PixelReuseCache::InvalidateObjects( const std::vector<const IObject*>& objects )
+{
+	if( objects.empty() || m_entries.empty() ) {
+		return;
+	}
+
+	std::vector<const IObject*> sorted( objects );
+	std::sort( sorted.begin(), sorted.end() );
+
+	// Mark first, then drop, so a dropped pixel doesn't stop its own
+	// neighbours from being matched
+	std::vector<unsigned char> hit( m_entries.size(), 0 );
+	for( size_t i = 0; i < m_entries.size(); i++ ) {
+		const Entry& e = m_entries[i];
+		if( e.spp && e.pObject && std::binary_search( sorted.begin(), sorted.end(), e.pObject ) ) {
+			hit[i] = 1;
+		}
+	}
+
+	for( unsigned int y = 0; y < m_height; y++ ) {
+		const unsigned int y0 = y ? y-1 : 0;
+		const unsigned int y1 = std::min( y+1, m_height-1 );
+		for( unsigned int x = 0; x < m_width; x++ ) {
+			if( !hit[ size_t( y )*m_width + x ] ) {
+				continue;
+			}
+			const unsigned int x0 = x ? x-1 : 0;
+			const unsigned int x1 = std::min( x+1, m_width-1 );
+			for( unsigned int j = y0; j <= y1; j++ ) {
+				for( unsigned int i = x0; i <= x1; i++ ) {
+					m_entries[ size_t( j )*m_width + i ].spp = 0;
+				}
+			}
+		}
+	}
+}
+
+void PixelReuseCache::Reproject(
+	const Matrix4& mxScreenToWorld,
+	const Point3& ptEye
+	)
+{
+	if( m_entries.empty() ) {
+		return;
+	}
+
+	// The camera maps screen (sx,sy,0) affinely onto an image plane
+	// behind the eye and shoots from that point through the eye.  In
+	// screen space the image plane is z=0, so a world point projects to
+	// where the line from it through the eye carries on to z=0.
+	const Matrix4 mxWorldToScreen = Matrix4Ops::Inverse( mxScreenToWorld );
+	const Point3 eye = Point3Ops::Transform( mxWorldToScreen, ptEye );
+
+	std::vector<Entry> moved( m_entries.size(), Entry() );
+	std::vector<Scalar> depth( m_entries.size(), RISE_INFINITY );
+
+	for( size_t i = 0; i < m_entries.size(); i++ ) {
+		const Entry& e = m_entries[i];
+		if( !e.spp || !e.pObject ) {
+			continue;
+		}
+
+		// Along eye + t*(q - eye) the plane is at t, which is negative
+		// for a point in front of the camera
+		const Point3 q = Point3Ops::Transform( mxWorldToScreen, e.ptHit );
+		const Scalar t = eye.z / (eye.z - q.z);
+		if( !(t < 0) ) {
+			continue;		// Behind the eye
+		}
+
+		const Scalar sx = eye.x + t*(q.x - eye.x);
+		const Scalar sy = eye.y + t*(q.y - eye.y);
+		const Scalar fx = std::floor( sx + 0.5 );
+		const Scalar fy = Scalar( m_height ) - std::floor( sy + 0.5 );
+		if( !(fx >= 0 && fx < Scalar( m_width ) && fy >= 0 && fy < Scalar( m_height )) ) {
+			continue;
+		}
+
+		// Only carry a pixel a little way round its hit point, measured
+		// from the view it was traced from, so the view-dependent part
+		// of its shading can't drift far however long the camera moves
+		const Vector3 v = Vector3Ops::mkVector3( e.ptHit, ptEye );
+		const Scalar d = Vector3Ops::Magnitude( v );
+		if( d <= 0 || Vector3Ops::Dot( v, e.vDir ) < kMaxViewCos*d ) {
+			continue;
+		}
+
+		const size_t j = size_t( fy )*m_width + size_t( fx );
+		if( d < depth[j] ) {
+			depth[j] = d;
+			moved[j] = e;
+			moved[j].spp = 1;
+			moved[j].unconfirmed = true;
+		}
+	}
+
+	m_entries.swap( moved );
+}
+
+bool PixelReuseCache::NeedsConfirm(
+	const unsigned int x,
+	const unsigned int y,
+	const unsigned int spp,
+	const IObject*& pObject,
+	Point3& ptHit
+	) const
+{
+	if( x >= m_width || y >= m_height ) {
+		return false;
+	}
+
+	const Entry& e = m_entries[ size_t( y )*m_width + x ];
+	if( !e.unconfirmed || !e.spp || e.spp < spp ) {
+		return false;
+	}
+
+	pObject = e.pObject;
+	ptHit = e.ptHit;
+	return true;
+}
+
+void PixelReuseCache::Confirm(
+	const unsigned int x,
+	const unsigned int y,
+	const bool bSame
+	)
+{
+	if( x >= m_width || y >= m_height ) {
+		return;
+	}
+
+	Entry& e = m_entries[ size_t( y )*m_width + x ];
+	e.unconfirmed = false;
+	if( !bSame ) {
+		e.spp = 0;
+	}
+}
+
+bool PixelReuseCache::Fetch(
+	const unsigned int x,
+	const unsigned int y,
+	const unsigned int spp,
+	RISEColor& c
+	) const
+{
+	if( x >= m_width || y >= m_height ) {
+		return false;
+	}
+
+	const Entry& e = m_entries[ size_t( y )*m_width + x ];
+	if( !e.spp || e.spp < spp || e.unconfirmed ) {
+		return false;
+	}
+
+	c = e.c;
+	return true;
+}
+
+void PixelReuseCache::Record(
+	const unsigned int x,
+	const unsigned int y,
+	const unsigned int spp,
+	const PrimaryHit& hit,
+	const RISEColor& c
+	)
+{
+	if( x >= m_width || y >= m_height ) {
+		return;
+	}
+
+	Entry& e = m_entries[ size_t( y )*m_width + x ];
+	e.c = c;
+	e.pObject = hit.pObject;
+	e.ptHit = hit.ptHit;
+	e.vDir = hit.vDir;
+	e.spp = spp;
+	e.unconfirmed = false;
+}
+
+unsigned int PixelReuseCache::CountValid() const
+{
+	unsigned int n = 0;
+	for( size_t i = 0; i < m_entries.size(); i++ ) {
+		if( m_entries[i].spp && !m_entries[i].unconfirmed ) {
+			n++;
+		}
+	}
+	return n;
+}
@@ -0,0 +1,156 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  PixelReuseCache.h - Per-pixel history of the interactive preview,
+//    so a pass after an edit re-traces only the pixels the edit
+//    could have changed.
+//
+//    Each entry holds the colour a pixel was last traced to, the
+//    samples per pixel it was traced with and the object and point
+//    its camera ray hit first.  Fetch hands a pixel back only if it
+//    was traced with at least as many samples as the current pass
+//    asks for, so a 1 spp pass after a polish pass reuses the
+//    polished pixels and a polish pass after a 1 spp pass re-traces
+//    them.
+//
+//    InvalidateObjects drops every pixel whose first hit is one of the
+//    given objects, and also each of its 8 neighbours: the first hit
+//    is taken at the pixel centre, so a pixel the object only partly
+//    covers is caught through a neighbour whose centre it does cover.
+//    That is only sound while the shading of a pixel depends on the
+//    material at its first hit and on nothing else that an edit can
+//    change; the owner decides when that holds.
+//
+//    Reproject carries the history over a camera move: each hit point
+//    is projected into the new view and lands on the pixel it now
+//    covers, the nearest one winning, unless the view of it has turned
+//    more than a couple of degrees since it was traced.  Such a pixel is unconfirmed
+//    until the pass traces its camera ray again and finds the same
+//    object at the same point, which is cheaper than shading it, and
+//    it counts as a single sample whatever it was traced with, since
+//    the preview's shading depends a little on the view; the polish
+//    pass re-traces it.
+//
+//    Entries are written by the block workers of one pass, each pixel
+//    by one worker, so no locking is needed.  Resize, Invalidate*,
+//    Reproject and the pass itself must not overlap.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//  Comments:
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#ifndef PIXEL_REUSE_CACHE_
+#define PIXEL_REUSE_CACHE_
+
+#include "../Interfaces/IObject.h"
+#include "../Utilities/Color/Color.h"
+#include "../Utilities/Math3D/Math3D.h"
+#include <vector>
+
+namespace RISE
+{
+	//! The first surface a pixel's camera ray hit, as RayCaster saw it
+	//! (see RuntimeContext::pPrimaryHit)
+	struct PrimaryHit
+	{
+		const IObject*		pObject;		///< Null for a miss
+		Point3				ptHit;
+		Vector3				vDir;			///< Direction of the camera ray
+		bool				captured;		///< The first cast has filled this in
+
+		PrimaryHit() : pObject( 0 ), captured( false ) {}
+	};
+
+	namespace Implementation
+	{
+		class PixelReuseCache
+		{
+		public:
+			PixelReuseCache();
+
+			//! Matches the cache to the image size, invalidating every
+			//! pixel if the size changed
+			void Resize( const unsigned int width, const unsigned int height );
+
+			unsigned int Width() const { return m_width; }
+			unsigned int Height() const { return m_height; }
+
+			//! Drops every pixel
+			void InvalidateAll();
+
+			//! Drops the pixels whose first hit, or a neighbour's first
+			//! hit, is one of `objects`
+			void InvalidateObjects( const std::vector<const IObject*>& objects );
+
+			//! Carries the history over to a new pose of a pinhole camera.
+			//! Every hit point is projected through the camera's new
+			//! screen-to-world matrix (ICamera::GetMatrix) and eye point;
+			//! misses, and pixels nothing lands on, are dropped.
+			void Reproject(
+				const Matrix4& mxScreenToWorld,		///< [in] New pose: screen (x, height-y, 0) to the image plane
+				const Point3& ptEye					///< [in] New camera location
+				);
+
+			//! True if (x,y) holds a reprojected pixel that the current
+			//! pass, asking for `spp` samples, could use once confirmed
+			bool NeedsConfirm(
+				const unsigned int x,
+				const unsigned int y,
+				const unsigned int spp,
+				const IObject*& pObject,			///< [out] First hit the pixel was carried over with
+				Point3& ptHit						///< [out] Where it was hit
+				) const;
+
+			//! Accepts a pixel NeedsConfirm returned, or drops it
+			void Confirm(
+				const unsigned int x,
+				const unsigned int y,
+				const bool bSame					///< [in] The pixel's camera ray hit the same object at the same point
+				);
+
+			//! Returns the cached colour of (x,y) if it was traced with
+			//! at least `spp` samples and is not awaiting confirmation
+			bool Fetch(
+				const unsigned int x,
+				const unsigned int y,
+				const unsigned int spp,
+				RISEColor& c
+				) const;
+
+			//! Stores the colour (x,y) was just traced to
+			void Record(
+				const unsigned int x,
+				const unsigned int y,
+				const unsigned int spp,
+				const PrimaryHit& hit,				///< [in] First hit of the pixel's camera ray
+				const RISEColor& c
+				);
+
+			//! Pixels that Fetch could currently return
+			unsigned int CountValid() const;
+
+		protected:
+			struct Entry
+			{
+				RISEColor			c;
+				const IObject*		pObject;
+				Point3				ptHit;
+				Vector3				vDir;			///< Camera ray it was traced with
+				unsigned int		spp;			///< 0 when the entry is invalid
+				bool				unconfirmed;	///< Carried over by Reproject, not yet traced again
+
+				Entry() : pObject( 0 ), spp( 0 ), unconfirmed( false ) {}
+			};
+
+			unsigned int			m_width;
+			unsigned int			m_height;
+			std::vector<Entry>		m_entries;
+		};
+	}
+}
+
+#endif
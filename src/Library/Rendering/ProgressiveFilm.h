@@ -21,6 +21,7 @@
 #include "../Utilities/Color/ColorUtils.h"
 #include <vector>
 #include <cstdint>
+#include <cmath>
 
 namespace RISE
 {
@@ -203,6 +204,34 @@ namespace RISE
 				return true;
 			}
 
+			/// Estimated error still left in a rectangular region: the sum
+			/// over its unfinished pixels of the relative standard error
+			/// of the Welford luminance mean, each capped at 1.  A pixel
+			/// with too few samples for an estimate counts as 1.  Returns
+			/// 0 exactly when IsTileDone would return true.
+			Scalar TileRemainingError( const Rect& rect, const unsigned int targetSamples ) const
+			{
+				Scalar error = 0;
+				for( unsigned int y = rect.top; y <= rect.bottom; y++ ) {
+					for( unsigned int x = rect.left; x <= rect.right; x++ ) {
+						const ProgressivePixel& px = pixels[y * width + x];
+						if( IsPixelDone( px, targetSamples ) ) {
+							continue;
+						}
+						Scalar e = 1;
+						const Scalar meanAbs = fabs( px.wMean );
+						if( px.wN >= 2 && meanAbs > NEARZERO ) {
+							const Scalar variance = px.wM2 / Scalar( px.wN - 1 );
+							e = r_min( Scalar( sqrt( variance / Scalar( px.wN ) ) / meanAbs ), Scalar( 1 ) );
+						}
+						// An unfinished pixel never counts as zero, so the
+						// tile is not mistaken for a finished one
+						error += r_max( e, Scalar( NEARZERO ) );
+					}
+				}
+				return error;
+			}
+
 			void Clear()
 			{
 				for( size_t i = 0; i < pixels.size(); i++ ) {
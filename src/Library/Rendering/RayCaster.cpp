@@ -18,8 +18,10 @@
 #include "LuminaryManager.h"
 #include "EnvironmentSampler.h"
 #include "AOVBuffers.h"
+#include "PixelReuseCache.h"
 #include "../Lights/LightSampler.h"
 #include "../Utilities/RandomNumbers.h"
+#include "../Utilities/CancellationToken.h"
 #include "../Utilities/MediumTracking.h"
 #include "../Utilities/MediumTransport.h"
 #include "../Utilities/IndependentSampler.h"
@@ -87,6 +89,19 @@ namespace
 		rc.pAOV->valid = true;
 	}
 
+	// The interactive preview keys its pixel history off the camera ray's
+	// first hit; like the AOV depth above, only the first cast counts.
+	inline void CapturePrimaryHit(
+		const RuntimeContext& rc,
+		const RayIntersection& ri )
+	{
+		if( !rc.pPrimaryHit || rc.pPrimaryHit->captured ) return;
+		rc.pPrimaryHit->captured = true;
+		rc.pPrimaryHit->pObject = ri.geometric.bHit ? ri.pObject : 0;
+		rc.pPrimaryHit->ptHit = ri.geometric.ptIntersection;
+		rc.pPrimaryHit->vDir = ri.geometric.ray.Dir();
+	}
+
 	// Analog no-scatter survival weight (mirrors PathTracingIntegrator's
 	// PTSurvivalWeight).  SampleDistance{,NM} is an ANALOG estimator: reaching
 	// the surface / escaping WITHOUT a scatter event is a stochastic SURVIVAL
@@ -198,7 +213,12 @@ namespace {
 	public:
 		bool operator()( const RISE::IObject& obj )
 		{
-			obj.Realize();
+			// Skip the remaining bakes once a render restart cancels the
+			// caller's ambient token; PrepareForRendering sees the same
+			// token and leaves the TLAS unbuilt until the next pass.
+			if( !RISE::CancellationToken::Current().IsCancelled() ) {
+				obj.Realize();
+			}
 			return true;
 		}
 	};
@@ -712,6 +732,7 @@ bool RayCaster::CastRay(
 	ri.geometric.bWantsWireEdgeInfo = bWantsWireEdgeInfo;
 	pScene->GetObjects()->IntersectRay( ri, true, true, false );
 	CapturePrimaryAOV( rc, ri );
+	CapturePrimaryHit( rc, ri );
 
 	bool bHit = ri.geometric.bHit;
 
@@ -1428,6 +1449,7 @@ bool RayCaster::CastRayNM(
 	ri.geometric.bWantsWireEdgeInfo = bWantsWireEdgeInfo;
 	pScene->GetObjects()->IntersectRay( ri, true, true, false );
 	CapturePrimaryAOV( rc, ri );
+	CapturePrimaryHit( rc, ri );
 
 	bool bHit = ri.geometric.bHit;
 
@@ -2522,6 +2544,7 @@ bool RayCaster::CastRayHWSS(
 	ri.geometric.bWantsWireEdgeInfo = bWantsWireEdgeInfo;
 	pScene->GetObjects()->IntersectRay( ri, true, true, false );
 	CapturePrimaryAOV( rc, ri );
+	CapturePrimaryHit( rc, ri );
 
 	bool bHit = ri.geometric.bHit;
 
@@ -290,7 +290,7 @@ void VCMPelRasterizer::IntegratePixel(
 			weightsAccrued += weight;
 
 			if( temporal_samples ) {
-				pScene.GetAnimator()->EvaluateAtTime(
+				SetTemporalSampleTime( pScene,
 					temporal_start + ( rc.random.CanonicalRandom() * temporal_exposure ) );
 			}
 
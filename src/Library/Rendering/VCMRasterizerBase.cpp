@@ -46,6 +46,7 @@
 #include "../Utilities/SobolSampler.h"
 #include "../Utilities/Threads/Threads.h"
 #include "../Utilities/ThreadPool.h"
+#include "../Utilities/CancellationToken.h"
 #include "AdaptiveTileSizer.h"
 #include "FrameStore.h"  // L6d-2a — FrameStoreBulkBracket RAII guard
 #include "../Lights/LightSampler.h"
@@ -128,6 +129,13 @@ namespace
 	// LightVertex records into a thread-local buffer.  After all
 	// threads join, the main thread concatenates the per-thread
 	// buffers into the shared store in deterministic index order.
+	//
+	// Workers poll the render's cancellation token once per row and
+	// stop early; `cancelled` then reports a truncated pass.
+	//
+	// On a per-ray motion frame every subpath draws its own time over
+	// the shutter [timeOpen, timeOpen+timeExposure) from its sampler,
+	// so the store holds light vertices from across the exposure.
 	//////////////////////////////////////////////////////////////////////
 	struct LightPassDispatcher
 	{
@@ -140,13 +148,18 @@ namespace
 		const unsigned int		maxLightDepth;
 		const uint32_t			baseSampleIndex;	// Sobol index base (= passIdx × samplesPerSuperIter)
 		const unsigned int		samplesPerSuperIter;	// K — sub-samples within one super-iteration
+		const Scalar			timeOpen;			// Shutter open, per-ray motion only
+		const Scalar			timeExposure;		// Zero unless per-ray motion is on
+		const CancellationToken	cancel;				// Caller's ambient token, captured at construction
 
 		std::vector<Rect>		tiles;
 		std::atomic<unsigned int>	nextTile;
+		std::atomic<bool>		cancelled;
 
-		// Per-thread output buffers (one per worker).
-		std::vector<std::vector<LightVertex>>	perThreadOutput;
-		std::vector<unsigned long long>			perThreadPathsShot;
+		// Per-thread output buffers (one per worker), already packed
+		// for the store.
+		std::vector<std::vector<PackedLightVertex>>	perThreadOutput;
+		std::vector<unsigned long long>				perThreadPathsShot;
 
 		struct ThreadLocal {
 			std::vector<BDPTVertex>			tmpLightVerts;
@@ -166,6 +179,8 @@ namespace
 			const unsigned int maxLightDepth_,
 			const uint32_t baseSampleIndex_,
 			const unsigned int samplesPerSuperIter_,
+			const Scalar timeOpen_,
+			const Scalar timeExposure_,
 			const unsigned int numWorkers
 			) :
 			scene( scene_ ),
@@ -177,7 +192,11 @@ namespace
 			maxLightDepth( maxLightDepth_ ),
 			baseSampleIndex( baseSampleIndex_ ),
 			samplesPerSuperIter( std::max( 1u, samplesPerSuperIter_ ) ),
+			timeOpen( timeOpen_ ),
+			timeExposure( timeExposure_ ),
+			cancel( CancellationToken::Current() ),
 			nextTile( 0 ),
+			cancelled( false ),
 			perThreadOutput( numWorkers ),
 			perThreadPathsShot( numWorkers, 0 )
 		{
@@ -210,6 +229,7 @@ namespace
 		{
 			// Each worker has its own RNG (for RR) and scratch buffers.
 			RandomNumberGenerator localRng;
+			RayTimeScope rayTimeScope( Ray::ThreadTime() );
 			RuntimeContext rc( localRng, RuntimeContext::PASS_NORMAL, true );
 
 			ThreadLocal tl;
@@ -217,7 +237,7 @@ namespace
 			tl.tmpConverted.reserve( maxLightDepth + 1 );
 			tl.tmpLightMis.reserve( maxLightDepth + 1 );
 
-			std::vector<LightVertex>& out = perThreadOutput[workerIdx];
+			std::vector<PackedLightVertex>& out = perThreadOutput[workerIdx];
 			// Estimate: only a fraction of subpaths deposit a vertex
 			// (typically 1-2 non-delta surface hits per subpath), and
 			// the store gets at most ~one vertex per subpath on
@@ -232,10 +252,14 @@ namespace
 			out.reserve( estimatedPerWorker );
 
 			Rect rect( 0, 0, 0, 0 );
-			while( GetNextBlock( rect ) )
+			while( !cancelled.load( std::memory_order_relaxed ) && GetNextBlock( rect ) )
 			{
 				for( unsigned int y = rect.top; y <= rect.bottom; y++ )
 				{
+					if( cancel.IsCancelled() ) {
+						cancelled.store( true, std::memory_order_relaxed );
+						break;
+					}
 					for( unsigned int x = rect.left; x <= rect.right; x++ )
 					{
 						const uint32_t pixelSeed = y * width + x;
@@ -248,6 +272,9 @@ namespace
 						{
 							const uint32_t sampleIdx = baseSampleIndex + k;
 							SobolSampler sampler( sampleIdx, pixelSeed );
+							if( timeExposure > 0 ) {
+								Ray::ThreadTime() = timeOpen + sampler.Get1D() * timeExposure;
+							}
 
 							tl.tmpLightVerts.clear();
 							static thread_local std::vector<uint32_t> tmpLightSubpathStarts;
@@ -271,7 +298,7 @@ namespace
 							VCMIntegrator::ConvertLightSubpath(
 								tl.tmpLightVerts, norm, tl.tmpConverted, &tl.tmpLightMis );
 							for( std::size_t m = 0; m < tl.tmpConverted.size(); m++ ) {
-								out.push_back( tl.tmpConverted[m] );
+								out.push_back( PackedLightVertex( tl.tmpConverted[m] ) );
 								tl.storedCount++;
 							}
 						}
@@ -429,16 +456,27 @@ void VCMRasterizerBase::PreRenderSetup( const IScene& pScene, const Rect* pRect
 		                 static_cast<std::size_t>( height ) * 4 );
 
 		bool foundSpecular = false;
+		const CancellationToken& cancel = CancellationToken::Current();
+		RayTimeScope rayTimeScope( Ray::ThreadTime() );
 
 		for( unsigned int s = 0; s < lightSubpathsPerPixel; s++ )
 		{
 			for( unsigned int y = 0; y < height; y++ )
 			{
+				// A restart abandons the pass with an empty store; the
+				// caller polls the same token before dispatching
+				if( cancel.IsCancelled() ) {
+					GlobalLog()->PrintEasyEvent( "VCMRasterizerBase::PreRenderSetup:: Cancelled during the auto-radius pre-pass" );
+					return;
+				}
 				for( unsigned int x = 0; x < width; x++ )
 				{
 					const uint32_t pixelSeed = y * width + x;
 					const uint32_t sampleIndex = s;
 					SobolSampler sampler( sampleIndex, pixelSeed );
+					if( mMotionExposure > 0 ) {
+						Ray::ThreadTime() = mMotionTimeOpen + sampler.Get1D() * mMotionExposure;
+					}
 
 					tmpLightVerts.clear();
 					static thread_local std::vector<uint32_t> tmpLightSubpathStarts2;
@@ -564,12 +602,19 @@ void VCMRasterizerBase::PreRenderSetup( const IScene& pScene, const Rect* pRect
 			width, height, pIntegrator->GetMaxLightDepth(),
 			/*baseSampleIndex=*/ 0,
 			samplesPerSuperIter,
+			mMotionTimeOpen, mMotionExposure,
 			numWorkers );
 
 		pathsShot = RunLightPassParallel( dispatcher, numWorkers );
 
+		// A truncated store is never built or merged against
+		if( dispatcher.cancelled.load() ) {
+			GlobalLog()->PrintEasyEvent( "VCMRasterizerBase::PreRenderSetup:: Cancelled during the light pass" );
+			return;
+		}
+
 		for( unsigned int i = 0; i < numWorkers; i++ ) {
-			const std::vector<LightVertex>& localBuf = dispatcher.perThreadOutput[i];
+			const std::vector<PackedLightVertex>& localBuf = dispatcher.perThreadOutput[i];
 			totalStored += localBuf.size();
 			pLightVertexStore->Concat( std::move( dispatcher.perThreadOutput[i] ) );
 		}
@@ -600,8 +645,8 @@ void VCMRasterizerBase::PreRenderSetup( const IScene& pScene, const Rect* pRect
 			std::vector<Scalar> throughputLums;
 			throughputLums.reserve( storeSize );
 			for( std::size_t k = 0; k < storeSize; k++ ) {
-				const LightVertex& lv = pLightVertexStore->Get( k );
-				throughputLums.push_back( ColorMath::MaxValue( lv.throughput ) );
+				const PackedLightVertex& lv = pLightVertexStore->Get( k );
+				throughputLums.push_back( ColorMath::MaxValue( lv.Throughput() ) );
 			}
 			std::sort( throughputLums.begin(), throughputLums.end() );
 			const Scalar medianThroughput = throughputLums[storeSize / 2];
@@ -610,10 +655,11 @@ void VCMRasterizerBase::PreRenderSetup( const IScene& pScene, const Rect* pRect
 			unsigned long long clamped = 0;
 			if( clampThreshold > 0 ) {
 				for( std::size_t k = 0; k < storeSize; k++ ) {
-					LightVertex& lv = pLightVertexStore->GetMutable( k );
-					const Scalar maxC = ColorMath::MaxValue( lv.throughput );
+					PackedLightVertex& lv = pLightVertexStore->GetMutable( k );
+					const RISEPel throughput = lv.Throughput();
+					const Scalar maxC = ColorMath::MaxValue( throughput );
 					if( maxC > clampThreshold ) {
-						lv.throughput = lv.throughput * ( clampThreshold / maxC );
+						lv.SetThroughput( throughput * ( clampThreshold / maxC ) );
 						clamped++;
 					}
 				}
@@ -748,10 +794,16 @@ void VCMRasterizerBase::OnProgressivePassBegin(
 			width, height, pIntegrator->GetMaxLightDepth(),
 			baseSampleIndex,
 			samplesPerSuperIter,
+			mMotionTimeOpen, mMotionExposure,
 			numWorkers );
 
 		pathsShot = RunLightPassParallel( dispatcher, numWorkers );
 
+		// Leave the store empty; the pass that follows is cancelled too
+		if( dispatcher.cancelled.load() ) {
+			return;
+		}
+
 		for( unsigned int i = 0; i < numWorkers; i++ ) {
 			totalStored += dispatcher.perThreadOutput[i].size();
 			pLightVertexStore->Concat( std::move( dispatcher.perThreadOutput[i] ) );
@@ -280,7 +280,7 @@ void VCMSpectralRasterizer::IntegratePixel(
 			weightsAccrued += weight;
 
 			if( temporal_samples ) {
-				pScene.GetAnimator()->EvaluateAtTime(
+				SetTemporalSampleTime( pScene,
 					temporal_start + ( rc.random.CanonicalRandom() * temporal_exposure ) );
 			}
 
@@ -764,6 +764,14 @@ void         Scene::ResetPhotonShootCount() { s_photonShootCount = 0; }
 
 bool Scene::BuildPendingPhotonMaps( IProgressCallback* pProgress )
 {
+	// A render restart can cancel before, between or during the shoots.  A
+	// cancelled shoot installs nothing and stays pending (TracePhotons returns
+	// false), so the next RasterizeScene shoots it again; completed shoots
+	// are kept.
+	if( pProgress && pProgress->IsCancelled() ) {
+		return false;
+	}
+
 	// Count this as a real shoot pass iff something is actually pending (the
 	// caller gates the invocation on the rasterizer consuming photon maps).
 	if( mGlobalPelPending.pending || mCausticPelPending.pending || mTranslucentPelPending.pending ||
@@ -779,8 +787,11 @@ bool Scene::BuildPendingPhotonMaps( IProgressCallback* pProgress )
 			r.branch, r.shootFromNonMeshLights, r.powerScale, r.temporalSamples,
 			r.regenerate, r.shootFromMeshLights );
 		pTracer->AttachScene( this );
-		pTracer->TracePhotons( r.num, 1.0, false, pProgress );
+		const bool bTraced = pTracer->TracePhotons( r.num, 1.0, false, pProgress );
 		safe_release( pTracer );
+		if( !bTraced ) {
+			return false;
+		}
 		if( mGlobalPelGather.set && pGlobalMap ) {
 			pGlobalMap->SetGatherParams( mGlobalPelGather.radius, mGlobalPelGather.ellipseRatio,
 				mGlobalPelGather.minPhotons, mGlobalPelGather.maxPhotons, pProgress );
@@ -796,8 +807,11 @@ bool Scene::BuildPendingPhotonMaps( IProgressCallback* pProgress )
 			r.branch, r.reflect, r.refract, r.shootFromNonMeshLights, r.powerScale,
 			r.temporalSamples, r.regenerate, r.shootFromMeshLights );
 		pTracer->AttachScene( this );
-		pTracer->TracePhotons( r.num, 1.0, false, pProgress );
+		const bool bTraced = pTracer->TracePhotons( r.num, 1.0, false, pProgress );
 		safe_release( pTracer );
+		if( !bTraced ) {
+			return false;
+		}
 		if( mCausticPelGather.set && pCausticMap ) {
 			pCausticMap->SetGatherParams( mCausticPelGather.radius, mCausticPelGather.ellipseRatio,
 				mCausticPelGather.minPhotons, mCausticPelGather.maxPhotons, pProgress );
@@ -813,8 +827,11 @@ bool Scene::BuildPendingPhotonMaps( IProgressCallback* pProgress )
 			r.reflect, r.refract, r.directTranslucent, r.shootFromNonMeshLights,
 			r.powerScale, r.temporalSamples, r.regenerate, r.shootFromMeshLights );
 		pTracer->AttachScene( this );
-		pTracer->TracePhotons( r.num, 1.0, false, pProgress );
+		const bool bTraced = pTracer->TracePhotons( r.num, 1.0, false, pProgress );
 		safe_release( pTracer );
+		if( !bTraced ) {
+			return false;
+		}
 		if( mTranslucentPelGather.set && pTranslucentMap ) {
 			pTranslucentMap->SetGatherParams( mTranslucentPelGather.radius, mTranslucentPelGather.ellipseRatio,
 				mTranslucentPelGather.minPhotons, mTranslucentPelGather.maxPhotons, pProgress );
@@ -830,8 +847,11 @@ bool Scene::BuildPendingPhotonMaps( IProgressCallback* pProgress )
 			r.nmBegin, r.nmEnd, r.numWavelengths, r.branch, r.reflect, r.refract,
 			r.powerScale, r.temporalSamples, r.regenerate );
 		pTracer->AttachScene( this );
-		pTracer->TracePhotons( r.num, 1.0, false, pProgress );
+		const bool bTraced = pTracer->TracePhotons( r.num, 1.0, false, pProgress );
 		safe_release( pTracer );
+		if( !bTraced ) {
+			return false;
+		}
 		if( mCausticSpectralGather.set && pCausticSpectralMap ) {
 			pCausticSpectralMap->SetGatherParamsNM( mCausticSpectralGather.radius, mCausticSpectralGather.ellipseRatio,
 				mCausticSpectralGather.minPhotons, mCausticSpectralGather.maxPhotons,
@@ -848,8 +868,11 @@ bool Scene::BuildPendingPhotonMaps( IProgressCallback* pProgress )
 			r.nmBegin, r.nmEnd, r.numWavelengths, r.branch, r.powerScale,
 			r.temporalSamples, r.regenerate );
 		pTracer->AttachScene( this );
-		pTracer->TracePhotons( r.num, 1.0, false, pProgress );
+		const bool bTraced = pTracer->TracePhotons( r.num, 1.0, false, pProgress );
 		safe_release( pTracer );
+		if( !bTraced ) {
+			return false;
+		}
 		if( mGlobalSpectralGather.set && pGlobalSpectralMap ) {
 			pGlobalSpectralMap->SetGatherParamsNM( mGlobalSpectralGather.radius, mGlobalSpectralGather.ellipseRatio,
 				mGlobalSpectralGather.minPhotons, mGlobalSpectralGather.maxPhotons,
@@ -864,8 +887,11 @@ bool Scene::BuildPendingPhotonMaps( IProgressCallback* pProgress )
 		IPhotonTracer* pTracer = 0;
 		RISE_API_CreateShadowPhotonTracer( &pTracer, r.temporalSamples, r.regenerate );
 		pTracer->AttachScene( this );
-		pTracer->TracePhotons( r.num, 1.0, false, pProgress );
+		const bool bTraced = pTracer->TracePhotons( r.num, 1.0, false, pProgress );
 		safe_release( pTracer );
+		if( !bTraced ) {
+			return false;
+		}
 		if( mShadowGather.set && pShadowMap ) {
 			pShadowMap->SetGatherParams( mShadowGather.radius, mShadowGather.ellipseRatio,
 				mShadowGather.minPhotons, mShadowGather.maxPhotons, pProgress );
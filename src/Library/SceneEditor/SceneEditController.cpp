@@ -338,6 +338,7 @@ SceneEditController::SceneEditController( IJobPriv& job, IRasterizer* interactiv
 , mCV()
 , mRunning( false )
 , mEditPending( false )
+, mScopedEditPending( false )
 , mProposalMutex()
 , mSuppressInitialRender( false )
 , mRendering( false )
@@ -2940,7 +2941,7 @@ void SceneEditController::OnPointerMove( const Point2& px )
 		// Redo / SetProperty use.
 		//
 		// Stamps `mLastEditTimeMs` and clears `mPolishState` in
-		// addition to bumping `mEditPending` so the render loop's
+		// addition to raising the edit wake so the render loop's
 		// idle-refinement gate sees a fresh edit timestamp (without
 		// this it can decide the user has been idle since pointer-
 		// down and walk the preview scale back toward full-res mid-
@@ -2968,7 +2969,13 @@ void SceneEditController::OnPointerMove( const Point2& px )
 			mLastEditTimeMs.store( NowMs(), std::memory_order_release );
 			mPolishState.store( static_cast<int>( PolishState::None ),
 			                    std::memory_order_release );
-			mEditPending.store( true, std::memory_order_release );
+			// Moving the camera changes no object, so the preview keeps
+			// its pixel history and reprojects it to the new pose
+			if( IsCameraMotionTool( mTool ) ) {
+				MarkScopedEditLocked_( std::vector<const IObject*>() );
+			} else {
+				mEditPending.store( true, std::memory_order_release );
+			}
 			lk.unlock();
 			mCV.notify_one();
 		}
@@ -3000,8 +3007,9 @@ void SceneEditController::OnPointerUp( const Point2& px )
 		// during that interval refuse/retry instead of replacing the scene
 		// before the pending live transform/pose is captured into the CST.
 		std::unique_lock<std::mutex> lk( mMutex );
+		const bool hadObjectCommit = mEditor.HasPendingCstObjectTransforms();
 		const bool hasPending =
-			mEditor.HasPendingCstObjectTransforms()
+			hadObjectCommit
 			|| mEditor.HasPendingCstCameraPose();
 		if( hasPending ) {
 			if( mRendering.load( std::memory_order_acquire ) ) {
@@ -3059,7 +3067,13 @@ void SceneEditController::OnPointerUp( const Point2& px )
 			mPolishState.store( static_cast<int>( finalState ), std::memory_order_release );
 		mPointerDown.store( false, std::memory_order_release );
 		mPointerGestureStale.store( false, std::memory_order_release );   // round-8: gesture over
-		mEditPending.store( true, std::memory_order_release );
+		// Committing a camera pose leaves the objects alone (see the
+		// invariant above), so a camera gesture keeps the history too
+		if( IsCameraMotionTool( mTool ) && !hadObjectCommit ) {
+			MarkScopedEditLocked_( std::vector<const IObject*>() );
+		} else {
+			mEditPending.store( true, std::memory_order_release );
+		}
 		if( mRendering.load( std::memory_order_acquire ) )
 		{
 			mCancelProgress.RequestCancel();
@@ -7841,6 +7855,7 @@ void SceneEditController::RenderLoop()
 	while( mRunning.load( std::memory_order_acquire ) )
 	{
 		bool isExplicitEdit;
+		bool scopedEdit = false;   // isExplicitEdit came only from mScopedEditPending
 		bool rotationTick = false;   // P3a slice 2: consumed alongside mEditPending below
 		{
 			std::unique_lock<std::mutex> lk( mMutex );
@@ -7885,6 +7900,7 @@ void SceneEditController::RenderLoop()
 				// Same gating as mEditPending -- a rotation pass must not
 				// start while a save or agent render owns the window.
 				return ( ( mEditPending.load( std::memory_order_acquire )
+				        || mScopedEditPending.load( std::memory_order_acquire )
 				        || mPanePassPending.load( std::memory_order_acquire ) )
 				      && !mSaving.load( std::memory_order_acquire )
 				      && !mAgentRenderBlocksInteractive.load( std::memory_order_acquire ) )
@@ -7900,6 +7916,13 @@ void SceneEditController::RenderLoop()
 			}
 
 			isExplicitEdit = mEditPending.exchange( false, std::memory_order_acq_rel );
+			// A scoped edit is an explicit edit in every respect except
+			// how much of the preview's pixel history it drops
+			if( mScopedEditPending.exchange( false, std::memory_order_acq_rel ) && !isExplicitEdit )
+			{
+				isExplicitEdit = true;
+				scopedEdit = true;
+			}
 			// P3a slice 2: consume the rotation flag under the SAME lock
 			// hold, and mark every visible pane dirty on a real edit (the
 			// scene changed under all of them).  Both run while mMutex is
@@ -8198,7 +8221,7 @@ void SceneEditController::RenderLoop()
 			{
 				if( isExplicitEdit )
 				{
-					mEditPending.store( true, std::memory_order_release );
+					( scopedEdit ? mScopedEditPending : mEditPending ).store( true, std::memory_order_release );
 				}
 				// P3a slice 2: same conditional-restore treatment for the
 				// rotation flag (Fix-round-5's reasoning applies verbatim).
@@ -8338,6 +8361,19 @@ void SceneEditController::RenderLoop()
 			} else {
 				mSharedDirectTargets.clear();
 			}
+			// The preview's pixel history outlives variant passes, so it
+			// is kept in step with every edit whichever rasterizer runs.
+			// A scoped edit drops its objects' pixels (none for a camera
+			// move, which the preview reprojects); any other edit,
+			// including one that landed since the wake, drops all.
+			if( mInteractiveImpl ) {
+				if( ( isExplicitEdit && !scopedEdit ) || mEditPending.load( std::memory_order_acquire ) ) {
+					mInteractiveImpl->InvalidatePixelReuse();
+				} else if( !mScopedEditObjects.empty() ) {
+					mInteractiveImpl->InvalidatePixelReuseForObjects( mScopedEditObjects );
+				}
+			}
+			mScopedEditObjects.clear();
 			// The ordinary preview rasterizer retains its existing polish policy.
 			if( mInteractiveImpl && !mVariantRasterizer ) {
 				Implementation::InteractivePelRasterizer::PreviewDenoiseMode denoiseMode =
@@ -8350,6 +8386,21 @@ void SceneEditController::RenderLoop()
 				}
 				mInteractiveImpl->SetPreviewDenoiseMode( denoiseMode );
 				mInteractiveImpl->SetSampleCount( isPolishPass ? kPolishSampleCount : 1 );
+				// Passes driven by an active gesture also trace only half
+				// the pixels (checkerboard + neighbour fill).  That is a
+				// half step below every mPreviewScale level, so the
+				// during-motion adaptation settles on a finer divisor for
+				// the same frame budget.  Refinement and polish passes,
+				// and the pointer-up final pass, trace every pixel.
+				const bool livePass = !isPolishPass && !mInRefinementPass
+					&& ( ( mPointerDown.load( std::memory_order_acquire )
+					       && !mPointerGestureStale.load( std::memory_order_acquire ) )
+					  || mScrubInProgress.load( std::memory_order_acquire ) );
+				mInteractiveImpl->SetLiveCheckerboard( livePass );
+				// Only full-resolution passes read or extend the pixel
+				// history; a scaled pass leaves it for the next one.
+				mInteractiveImpl->SetPixelReuse(
+					mPreviewScale.load( std::memory_order_acquire ) <= kPreviewScaleMin );
 			}
 			mCancelProgress.Reset();
 			mRendering.store( true, std::memory_order_release );
@@ -11924,6 +11975,12 @@ bool SceneEditController::AnyVisiblePaneHasWorkLocked_() const
 }
 
 //! REQUIRES mMutex held.
+void SceneEditController::MarkScopedEditLocked_( const std::vector<const IObject*>& objects )
+{
+	mScopedEditObjects.insert( mScopedEditObjects.end(), objects.begin(), objects.end() );
+	mScopedEditPending.store( true, std::memory_order_release );
+}
+
 void SceneEditController::MarkAllVisiblePanesDirtyLocked_()
 {
 	const unsigned int visible = PaneCountForLayout( mViewportLayout );
@@ -13308,6 +13365,7 @@ bool SceneEditController::SetPropertyInner_(
 		// always run even if the object one fails -- short-circuiting would skip a pending camera-pose commit that
 		// has nothing to do with the object commit's outcome.
 		bool commitsOk = true;
+		const bool hadPendingCommits = mEditor.HasPendingCstObjectTransforms() || mEditor.HasPendingCstCameraPose();
 		if( mEditor.HasPendingCstObjectTransforms() ) commitsOk &= mEditor.CommitPendingCstObjectTransforms();
 		if( mEditor.HasPendingCstCameraPose() ) commitsOk &= mEditor.CommitPendingCstCameraPose();
 
@@ -13334,7 +13392,21 @@ bool SceneEditController::SetPropertyInner_(
 				: valueStr;
 		}
 
-		mEditPending.store( true, std::memory_order_release );
+		// A material or shader rebind applied in place changes only how
+		// this object shades; anything that re-derived the scene does not
+		// qualify.
+		const bool shadingOnly =
+			( edit.op == SceneEdit::SetObjectMaterial || edit.op == SceneEdit::SetObjectShader )
+			&& !mEditor.CstLiveSceneChangedInLastApply() && !hadPendingCommits;
+		const IScene* editedScene = shadingOnly ? mJob.GetScene() : nullptr;
+		const IObject* editedObj = ( editedScene && editedScene->GetObjects() )
+			? const_cast<IObjectManager*>( editedScene->GetObjects() )->GetItem( targetName.c_str() )
+			: nullptr;
+		if( editedObj ) {
+			MarkScopedEditLocked_( std::vector<const IObject*>( 1, editedObj ) );
+		} else {
+			mEditPending.store( true, std::memory_order_release );
+		}
 		lk.unlock();
 		mCV.notify_one();
 		// A2: report the commit follow-through's outcome too -- the auto-sync above already ran unconditionally
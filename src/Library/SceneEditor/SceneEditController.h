@@ -30,6 +30,7 @@
 #include "CancellableProgressCallback.h"
 #include "CameraIntrospection.h"
 #include "../Interfaces/IJobPriv.h"
+#include "../Interfaces/IObject.h"
 #include "../Interfaces/IRasterizer.h"
 #include "../Interfaces/IRasterizerOutput.h"
 #include "../Interfaces/IProgressCallback.h"
@@ -3685,6 +3686,17 @@ namespace RISE
 		std::atomic<bool>           mRunning;
 		std::atomic<bool>           mEditPending;
 
+		//! Wakes the render loop like mEditPending, for an edit that only
+		//! changed the material or shader of the objects queued in
+		//! mScopedEditObjects (guarded by mMutex), or only moved the
+		//! camera (no objects).  The next pass then re-traces only those
+		//! objects' pixels of the interactive preview's pixel history,
+		//! and the preview reprojects the rest itself after a camera
+		//! move; any mEditPending edit consumed with it drops the whole
+		//! history instead.
+		std::atomic<bool>           mScopedEditPending;
+		std::vector<const IObject*> mScopedEditObjects;
+
 		//! Secure-MCP slice 5a: proposal bookkeeping has its own leaf mutex
 		//! so an External proposal/list request never waits behind the
 		//! render-duration scene lock. ResolveProposal still holds render
@@ -4598,6 +4610,9 @@ namespace RISE
 		unsigned int PickNextVisiblePaneLocked_() const;
 		bool         AnyVisiblePaneHasWorkLocked_() const;
 		void         MarkAllVisiblePanesDirtyLocked_();
+		//! Queues a scoped edit of `objects`, or of the camera alone
+		//! when empty (see mScopedEditPending); mMutex must be held
+		void         MarkScopedEditLocked_( const std::vector<const IObject*>& objects );
 		bool         IsInteractivePaneLocked_( unsigned int pane ) const;
 		Implementation::ViewportRenderMode PaneModeLocked_( unsigned int pane ) const;
 		bool         PanesShareTransportViewLocked_( unsigned int a, unsigned int b ) const;
@@ -20,6 +20,7 @@
 #include "../../Utilities/HankelTransform.h"
 #include "../../Utilities/GeometricUtilities.h"
 #include "../../Utilities/stl_utils.h"
+#include "../../Utilities/CancellationToken.h"
 #include "../../Sampling/HaltonPoints.h"
 #include "../../RISE_API.h"
 #include "../../Interfaces/ILog.h"
@@ -830,8 +831,19 @@ void DonnerJensenSkinSSSShaderOp::PerformOperation(
 			RandomNumberGenerator buildRng( 0x9E3779B9u );	// fixed seed (golden ratio)
 			RuntimeContext buildRc( buildRng, rc.pass, rc.bThreaded );
 
+			// Abandon the build (caching nothing) once a render restart cancels
+			// the ambient token; see SubSurfaceScatteringShaderOp::PerformOperation.
+			const CancellationToken& cancel = CancellationToken::Current();
+			static const unsigned int kCancelPollInterval = 256;
+
 			for( unsigned int i = 0; i < numPoints; i++ )
 			{
+				if( (i % kCancelPollInterval) == 0 && cancel.IsCancelled() )
+				{
+					c = RISEPel( 0.0 );
+					return;
+				}
+
 				PointSetOctree::SamplePoint sp;
 				Vector3 normal;
 				Point2 sampleCoord;
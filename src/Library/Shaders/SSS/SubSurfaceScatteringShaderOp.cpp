@@ -18,6 +18,7 @@
 #include "../../Utilities/GeometricUtilities.h"
 #include "../../Interfaces/IGeometry.h"		// CanBeAreaLight(): SSS needs real surface sampling
 #include "../../Utilities/stl_utils.h"
+#include "../../Utilities/CancellationToken.h"
 #include "../../Sampling/HaltonPoints.h"
 #include "../../Utilities/Color/RGBSpectra.h"	// RGBUnboundedSpectrum (RGB->spectral uplift for PerformOperationNM)
 #include <mutex>									// std::lock_guard (exception-safe create_mutex)
@@ -200,7 +201,21 @@ void SubSurfaceScatteringShaderOp::PerformOperation(
 			RandomNumberGenerator buildRng( 0x9E3779B9u );	// fixed seed (golden ratio)
 			RuntimeContext buildRc( buildRng, rc.pass, rc.bThreaded );
 
+			// The build holds create_mutex for numPoints full Shade calls, so a
+			// render restart polls the ambient token every kCancelPollInterval
+			// points.  A cancelled build is abandoned WITHOUT caching anything in
+			// `pointsets` -- the next render builds it from scratch -- and every
+			// thread queued on the mutex behind it sees the same token and bails
+			// out the same way.
+			const CancellationToken& cancel = CancellationToken::Current();
+			static const unsigned int kCancelPollInterval = 256;
+
 			for( unsigned int i=0; i<numPoints; i++ ) {
+				if( (i % kCancelPollInterval) == 0 && cancel.IsCancelled() ) {
+					c = RISEPel( 0.0 );
+					return;
+				}
+
 				// Ask the object for a uniform random point
 				PointSetOctree::SamplePoint sp;
 				Vector3 normal;
@@ -264,18 +264,18 @@ namespace
 	/// documented at the EvaluateMergesNM comment block.
 	template<class Tag>
 	inline typename SpectralValueTraits<Tag>::value_type
-	LightVertexThroughput( const LightVertex& lv, const Tag& tag );
+	LightVertexThroughput( const PackedLightVertex& lv, const Tag& tag );
 
 	template<>
-	inline RISEPel LightVertexThroughput<PelTag>( const LightVertex& lv, const PelTag& )
+	inline RISEPel LightVertexThroughput<PelTag>( const PackedLightVertex& lv, const PelTag& )
 	{
-		return lv.throughput;
+		return lv.Throughput();
 	}
 
 	template<>
-	inline Scalar LightVertexThroughput<NMTag>( const LightVertex& lv, const NMTag& )
+	inline Scalar LightVertexThroughput<NMTag>( const PackedLightVertex& lv, const NMTag& )
 	{
-		return RISEPelToNMProxy( lv.throughput );
+		return RISEPelToNMProxy( lv.Throughput() );
 	}
 
 	/// Convert a contribution to an RGB splat value for writing to
@@ -2106,7 +2106,7 @@ namespace
 			return total;
 		}
 
-		static thread_local std::vector<LightVertex> candidates;
+		static thread_local std::vector<PackedLightVertex> candidates;
 		if( candidates.capacity() < 256 ) {
 			candidates.reserve( 256 );
 		}
@@ -2139,13 +2139,13 @@ namespace
 
 			for( std::size_t k = 0; k < candidates.size(); k++ )
 			{
-				const LightVertex& lv = candidates[k];
+				const PackedLightVertex& lv = candidates[k];
 
 				if( ( lv.flags & kLVF_IsConnectible ) == 0 ) {
 					continue;
 				}
 
-				const Vector3 wiAtEye = -lv.wi;
+				const Vector3 wiAtEye = -lv.Wi();
 
 				const typename Traits::value_type cameraBsdf =
 					RISE::PathValueOps::EvalBSDFAtVertex<Tag>( v, wiAtEye, woAtEye, tag );
@@ -2158,8 +2158,8 @@ namespace
 					RISE::PathValueOps::EvalPdfAtVertex<Tag>( v, wiAtEye, woAtEye, tag );
 
 				const Scalar wLight =
-					lv.mis.dVCM * norm.mMisVcWeightFactor
-					+ lv.mis.dVM * cameraBsdfDirPdfW;
+					lv.dVCM * norm.mMisVcWeightFactor
+					+ lv.dVM * cameraBsdfDirPdfW;
 				const Scalar wCamera =
 					eyeMis[i].dVCM * norm.mMisVcWeightFactor
 					+ eyeMis[i].dVM * cameraBsdfRevPdfW;
@@ -25,6 +25,16 @@
 //    and Step 4 begins writing to LightVertex during the light-pass
 //    post-walk.
 //
+//    LightVertex is still far larger than a merge needs, so the
+//    store keeps PackedLightVertex instead: float position,
+//    throughput and MIS partials, and octahedral-encoded unit
+//    vectors, 52 bytes against LightVertex's 192.  The light-pass
+//    post-walk keeps producing full-precision LightVertex records
+//    and the store packs them as they are deposited.  The material
+//    and object pointers and the vertex colour are not packed: the
+//    merge evaluates the BSDF at the EYE vertex only, and nothing
+//    reads them back from the store.
+//
 //  Author: Aravind Krishnaswamy
 //  Date of Birth: April 14, 2026
 //  Tabs: 4
@@ -40,6 +50,7 @@
 #include "../Utilities/Math3D/Math3D.h"
 #include "../Utilities/Color/Color.h"
 #include "VCMRecurrence.h"
+#include <cmath>
 
 namespace RISE
 {
@@ -104,6 +115,137 @@ namespace RISE
 			{}
 		};
 
+		/// Octahedral encoding of a unit vector into two 16-bit snorm
+		/// values (x in the low half).  Worst-case angular error is
+		/// about 1e-4 radians.  The zero vector is kept distinct by
+		/// the otherwise unused value -32768 in x.
+		inline unsigned int EncodeOctahedral( const Vector3& v )
+		{
+			const Scalar l1 = std::fabs( v.x ) + std::fabs( v.y ) + std::fabs( v.z );
+			if( l1 <= 0 ) {
+				return 0x8000u;
+			}
+
+			Scalar px = v.x / l1;
+			Scalar py = v.y / l1;
+			if( v.z < 0 ) {
+				const Scalar ox = ( 1 - std::fabs( py ) ) * ( px >= 0 ? 1 : -1 );
+				const Scalar oy = ( 1 - std::fabs( px ) ) * ( py >= 0 ? 1 : -1 );
+				px = ox;
+				py = oy;
+			}
+
+			const int ix = static_cast<int>( std::floor( px * 32767.0 + 0.5 ) );
+			const int iy = static_cast<int>( std::floor( py * 32767.0 + 0.5 ) );
+			return ( static_cast<unsigned int>( ix ) & 0xFFFFu ) |
+				( ( static_cast<unsigned int>( iy ) & 0xFFFFu ) << 16 );
+		}
+
+		inline Vector3 DecodeOctahedral( const unsigned int e )
+		{
+			if( ( e & 0xFFFFu ) == 0x8000u ) {
+				return Vector3( 0, 0, 0 );
+			}
+
+			const Scalar px = static_cast<short>( e & 0xFFFFu ) / 32767.0;
+			const Scalar py = static_cast<short>( e >> 16 ) / 32767.0;
+			Vector3 v( px, py, 1 - std::fabs( px ) - std::fabs( py ) );
+			if( v.z < 0 ) {
+				const Scalar ox = ( 1 - std::fabs( py ) ) * ( px >= 0 ? 1 : -1 );
+				const Scalar oy = ( 1 - std::fabs( px ) ) * ( py >= 0 ? 1 : -1 );
+				v.x = ox;
+				v.y = oy;
+			}
+			return Vector3Ops::Normalize( v );
+		}
+
+		/// Single-precision position with the Point3 accessors the
+		/// KD-tree reads
+		struct PackedPoint3
+		{
+			float				x, y, z;
+
+			PackedPoint3() : x( 0 ), y( 0 ), z( 0 ) {}
+			explicit PackedPoint3( const Point3& p ) :
+				x( static_cast<float>( p.x ) ),
+				y( static_cast<float>( p.y ) ),
+				z( static_cast<float>( p.z ) )
+			{}
+
+			Scalar operator[]( const int axis ) const { return axis == 0 ? x : ( axis == 1 ? y : z ); }
+			operator Point3() const { return Point3( x, y, z ); }
+		};
+
+		/// The LightVertex fields a merge reads, packed for the store
+		/// and its KD-tree.  Same leading layout contract as
+		/// LightVertex.
+		struct PackedLightVertex
+		{
+			PackedPoint3		ptPosition;		///< REQUIRED FIRST: KD-tree builder reads [axis]
+			unsigned char		plane;			///< REQUIRED SECOND: KD-tree builder writes this
+			unsigned char		flags;			///< LightVertexFlags bitmask
+			unsigned short		pathLength;		///< Light-subpath bounces to reach this vertex
+
+			unsigned int		wi;				///< Octahedral: direction from previous vertex to this one
+			unsigned int		normal;			///< Octahedral: shading normal
+			unsigned int		geomNormal;		///< Octahedral: geometric normal
+
+			float				throughput[3];	///< Cumulative alpha_i from light origin
+			float				dVCM;			///< MIS partials after the geometric update
+			float				dVC;
+			float				dVM;
+
+			PackedLightVertex() :
+				plane( 0 ),
+				flags( 0 ),
+				pathLength( 0 ),
+				wi( 0x8000u ),
+				normal( 0x8000u ),
+				geomNormal( 0x8000u ),
+				dVCM( 0 ),
+				dVC( 0 ),
+				dVM( 0 )
+			{
+				throughput[0] = throughput[1] = throughput[2] = 0;
+			}
+
+			explicit PackedLightVertex( const LightVertex& v ) :
+				ptPosition( v.ptPosition ),
+				plane( v.plane ),
+				flags( v.flags ),
+				pathLength( v.pathLength ),
+				wi( EncodeOctahedral( v.wi ) ),
+				normal( EncodeOctahedral( v.normal ) ),
+				geomNormal( EncodeOctahedral( v.geomNormal ) ),
+				dVCM( static_cast<float>( v.mis.dVCM ) ),
+				dVC( static_cast<float>( v.mis.dVC ) ),
+				dVM( static_cast<float>( v.mis.dVM ) )
+			{
+				SetThroughput( v.throughput );
+			}
+
+			Vector3 Wi() const { return DecodeOctahedral( wi ); }
+			Vector3 Normal() const { return DecodeOctahedral( normal ); }
+			Vector3 GeomNormal() const { return DecodeOctahedral( geomNormal ); }
+
+			RISEPel Throughput() const { return RISEPel( throughput[0], throughput[1], throughput[2] ); }
+			void SetThroughput( const RISEPel& t )
+			{
+				throughput[0] = static_cast<float>( t[0] );
+				throughput[1] = static_cast<float>( t[1] );
+				throughput[2] = static_cast<float>( t[2] );
+			}
+
+			VCMMisQuantities Mis() const
+			{
+				VCMMisQuantities m;
+				m.dVCM = dVCM;
+				m.dVC = dVC;
+				m.dVM = dVM;
+				return m;
+			}
+		};
+
 		/// Spectral (NM) variant stores single-wavelength throughput
 		/// and the wavelength itself so Step 10 can re-evaluate
 		/// companion wavelengths against the hero-traced path.
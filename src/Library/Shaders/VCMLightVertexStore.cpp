@@ -2,7 +2,7 @@
 //
 //  VCMLightVertexStore.cpp - Persistent light-vertex store for VCM.
 //
-//    Holds a flat array of LightVertex objects populated during the
+//    Holds a flat array of PackedLightVertex objects populated during the
 //    VCM light pass, balanced into a left-balanced KD-tree for
 //    fixed-radius queries during the eye pass.
 //
@@ -47,12 +47,12 @@ using namespace RISE::Implementation;
 namespace
 {
 	// Comparators for std::nth_element — mirror PhotonMapCore's
-	// less_than_X/Y/Z lambdas.  The stored LightVertex type exposes
+	// less_than_X/Y/Z lambdas.  The stored PackedLightVertex type exposes
 	// ptPosition as its first field (required so the balance
 	// algorithm can index by axis).
-	inline bool LessThanX( const LightVertex& a, const LightVertex& b ) { return a.ptPosition.x < b.ptPosition.x; }
-	inline bool LessThanY( const LightVertex& a, const LightVertex& b ) { return a.ptPosition.y < b.ptPosition.y; }
-	inline bool LessThanZ( const LightVertex& a, const LightVertex& b ) { return a.ptPosition.z < b.ptPosition.z; }
+	inline bool LessThanX( const PackedLightVertex& a, const PackedLightVertex& b ) { return a.ptPosition.x < b.ptPosition.x; }
+	inline bool LessThanY( const PackedLightVertex& a, const PackedLightVertex& b ) { return a.ptPosition.y < b.ptPosition.y; }
+	inline bool LessThanZ( const PackedLightVertex& a, const PackedLightVertex& b ) { return a.ptPosition.z < b.ptPosition.z; }
 
 	//
 	// Left-balanced KD-tree median computation.
@@ -81,7 +81,7 @@ namespace
 	// tmp-swap pattern.
 	//
 	void BalanceSegment(
-		std::vector<LightVertex>& verts,
+		std::vector<PackedLightVertex>& verts,
 		BoundingBox& bbox,
 		const int from,
 		const int to
@@ -149,10 +149,10 @@ namespace
 	// radius (matches the PhotonMap convention).
 	//
 	void LocateAllInRadiusSq(
-		const std::vector<LightVertex>& verts,
+		const std::vector<PackedLightVertex>& verts,
 		const Point3& loc,
 		const Scalar maxDistSq,
-		std::vector<LightVertex>& out,
+		std::vector<PackedLightVertex>& out,
 		const int from,
 		const int to
 		)
@@ -225,11 +225,11 @@ void LightVertexStore::Reserve( const std::size_t capacity )
 
 void LightVertexStore::Append( const LightVertex& v )
 {
-	mVertices.push_back( v );
+	mVertices.push_back( PackedLightVertex( v ) );
 	mBuilt = false;
 }
 
-void LightVertexStore::Concat( std::vector<LightVertex>&& localBuffer )
+void LightVertexStore::Concat( std::vector<PackedLightVertex>&& localBuffer )
 {
 	// Always insert — never move-assign the whole source over mVertices,
 	// even when mVertices.empty() is true.
@@ -247,7 +247,7 @@ void LightVertexStore::Concat( std::vector<LightVertex>&& localBuffer )
 	//
 	// insert() preserves the Reserve'd capacity (zero reallocation when
 	// the pre-reserved size is sufficient), does an element-wise move
-	// of the POD-ish LightVertex structs, and — crucially — never
+	// of the POD PackedLightVertex structs, and — crucially — never
 	// frees the destination's buffer.  That sidesteps the crash.
 	if( localBuffer.empty() ) {
 		mBuilt = false;
@@ -272,7 +272,7 @@ void LightVertexStore::BuildKDTree()
 	BoundingBox bbox(
 		Point3( RISE_INFINITY, RISE_INFINITY, RISE_INFINITY ),
 		Point3( -RISE_INFINITY, -RISE_INFINITY, -RISE_INFINITY ) );
-	for( std::vector<LightVertex>::const_iterator i = mVertices.begin(); i != mVertices.end(); ++i ) {
+	for( std::vector<PackedLightVertex>::const_iterator i = mVertices.begin(); i != mVertices.end(); ++i ) {
 		bbox.Include( i->ptPosition );
 	}
 
@@ -283,7 +283,7 @@ void LightVertexStore::BuildKDTree()
 void LightVertexStore::Query(
 	const Point3& center,
 	const Scalar radiusSq,
-	std::vector<LightVertex>& out
+	std::vector<PackedLightVertex>& out
 	) const
 {
 	if( !mBuilt || mVertices.empty() || radiusSq <= 0 ) {
@@ -386,7 +386,7 @@ namespace
 	// until they fall below the cutoff.  `sync->outstanding` tracks
 	// the number of pending subtree tasks so the driver can wait.
 	void BalanceSegmentParallel(
-		std::vector<LightVertex>& verts,
+		std::vector<PackedLightVertex>& verts,
 		BoundingBox bbox,               // by-value: each task has its own
 		const int from,
 		const int to,
@@ -481,7 +481,7 @@ void LightVertexStore::BuildKDTreeParallel()
 	BoundingBox bbox(
 		Point3( RISE_INFINITY, RISE_INFINITY, RISE_INFINITY ),
 		Point3( -RISE_INFINITY, -RISE_INFINITY, -RISE_INFINITY ) );
-	for( std::vector<LightVertex>::const_iterator i = mVertices.begin(); i != mVertices.end(); ++i ) {
+	for( std::vector<PackedLightVertex>::const_iterator i = mVertices.begin(); i != mVertices.end(); ++i ) {
 		bbox.Include( i->ptPosition );
 	}
 
@@ -562,7 +562,7 @@ Scalar LightVertexStore::ComputeBBoxDiagonal() const
 	Point3 mn = mVertices[0].ptPosition;
 	Point3 mx = mn;
 	for( std::size_t i = 1; i < mVertices.size(); i++ ) {
-		const Point3& p = mVertices[i].ptPosition;
+		const Point3 p = mVertices[i].ptPosition;
 		if( p.x < mn.x ) mn.x = p.x;  if( p.x > mx.x ) mx.x = p.x;
 		if( p.y < mn.y ) mn.y = p.y;  if( p.y > mx.y ) mx.y = p.y;
 		if( p.z < mn.z ) mn.z = p.z;  if( p.z > mx.z ) mx.z = p.z;
@@ -581,7 +581,7 @@ Scalar LightVertexStore::ComputeBBoxSurfaceArea() const
 	Point3 mn = mVertices[0].ptPosition;
 	Point3 mx = mn;
 	for( std::size_t i = 1; i < mVertices.size(); i++ ) {
-		const Point3& p = mVertices[i].ptPosition;
+		const Point3 p = mVertices[i].ptPosition;
 		if( p.x < mn.x ) mn.x = p.x;  if( p.x > mx.x ) mx.x = p.x;
 		if( p.y < mn.y ) mn.y = p.y;  if( p.y > mx.y ) mx.y = p.y;
 		if( p.z < mn.z ) mn.z = p.z;  if( p.z > mx.z ) mx.z = p.z;
@@ -626,7 +626,7 @@ void LightVertexStore::ClampOutlierThroughputs(
 	std::vector<Scalar> lums;
 	lums.reserve( n );
 	for( std::size_t i = 0; i < n; i++ ) {
-		lums.push_back( LightVertexLuminance( mVertices[i].throughput ) );
+		lums.push_back( LightVertexLuminance( mVertices[i].Throughput() ) );
 	}
 
 	// Find the percentile via nth_element (O(n) average).  Clamp the
@@ -648,10 +648,11 @@ void LightVertexStore::ClampOutlierThroughputs(
 	// scale) so chromaticity stays the same; only the magnitude is
 	// capped.  Vertices already at or below threshold are untouched.
 	for( std::size_t i = 0; i < n; i++ ) {
-		const Scalar lum = LightVertexLuminance( mVertices[i].throughput );
+		const RISEPel throughput = mVertices[i].Throughput();
+		const Scalar lum = LightVertexLuminance( throughput );
 		if( lum > threshold ) {
 			const Scalar scale = threshold / lum;
-			mVertices[i].throughput = mVertices[i].throughput * scale;
+			mVertices[i].SetThroughput( throughput * scale );
 		}
 	}
 }
@@ -28,6 +28,11 @@
 //    wiring compiles; Step 3 populates the KD-tree template and
 //    adds a unit test.
 //
+//    Vertices are stored as PackedLightVertex (see VCMLightVertex.h)
+//    so more of the tree fits in cache during the eye pass.  Append
+//    packs a full LightVertex; the rasterizer's per-thread buffers
+//    pack as they collect and hand packed records to Concat.
+//
 //  Author: Aravind Krishnaswamy
 //  Date of Birth: April 14, 2026
 //  Tabs: 4
@@ -61,14 +66,14 @@ namespace RISE
 			/// reallocation during the light pass.
 			void Reserve( const std::size_t capacity );
 
-			/// Append a single vertex.  NOT thread-safe; the
+			/// Pack and append a single vertex.  NOT thread-safe; the
 			/// rasterizer writes to per-thread buffers and then
 			/// calls Concat from a single thread after the barrier.
 			void Append( const LightVertex& v );
 
 			/// Move-concatenate a whole per-thread buffer.  Caller
 			/// is responsible for ordering across threads.
-			void Concat( std::vector<LightVertex>&& localBuffer );
+			void Concat( std::vector<PackedLightVertex>&& localBuffer );
 
 			/// Build a left-balanced KD-tree over the current
 			/// contents.  After this call the store is read-only;
@@ -89,20 +94,20 @@ namespace RISE
 			void Query(
 				const Point3& center,
 				const Scalar radiusSq,
-				std::vector<LightVertex>& out
+				std::vector<PackedLightVertex>& out
 				) const;
 
 			/// Return the number of vertices currently stored.
 			std::size_t Size() const { return mVertices.size(); }
 
 			/// Read-only access to a stored vertex by index.
-			const LightVertex& Get( std::size_t idx ) const { return mVertices[idx]; }
+			const PackedLightVertex& Get( std::size_t idx ) const { return mVertices[idx]; }
 
 			/// Mutable access to a stored vertex by index.
 			/// Only valid BEFORE BuildKDTree (the tree reorders
 			/// the array; accessing by pre-balance index after
 			/// the tree is built will give the wrong vertex).
-			LightVertex& GetMutable( std::size_t idx ) { return mVertices[idx]; }
+			PackedLightVertex& GetMutable( std::size_t idx ) { return mVertices[idx]; }
 
 			/// Has BuildKDTree() been called since the last
 			/// Clear/Append sequence?
@@ -149,8 +154,8 @@ namespace RISE
 				);
 
 		private:
-			std::vector<LightVertex>	mVertices;
-			bool						mBuilt;
+			std::vector<PackedLightVertex>	mVertices;
+			bool							mBuilt;
 		};
 	}
 }
@@ -16,6 +16,7 @@
 #define TREE_ELEMENT_PROCESSOR_
 
 #include "Interfaces/IReference.h"
+#include "Interfaces/IGeometry.h"
 #include "Intersection/RayIntersection.h"
 #include "Utilities/Plane.h"
 
@@ -54,6 +55,20 @@ namespace RISE
 		{
 			return false;
 		}
+
+		//! BVH analytic leaf cull: if this element is an analytic
+		//! primitive under an affine transform, fill its conservative
+		//! shape (object space) and the world-to-object matrix and return
+		//! true.  BVH packs up to four of these per SoA packet and tests a
+		//! ray against the whole packet in float, calling the
+		//! RayElementIntersection only for the survivors, nearest first.
+		//! Default false, same source-compatibility reasoning as above.
+		virtual bool GetAnalyticElementShape(
+			const T /*elem*/,
+			AnalyticShape& /*shape*/, Matrix4& /*mxWorldToLocal*/ ) const
+		{
+			return false;
+		}
 	};
 }
 
@@ -0,0 +1,51 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  CancellationToken.cpp - Thread-scoped storage for the ambient
+//    cancellation token.  See CancellationToken.h.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//  Comments:
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "CancellationToken.h"
+
+using namespace RISE;
+
+namespace
+{
+	const CancellationToken g_neverCancelled;
+
+	// Innermost live CancellationScope's token on this thread; null
+	// outside every scope.
+	thread_local const CancellationToken* g_pCurrentToken = 0;
+}
+
+const CancellationToken& CancellationToken::Current()
+{
+	return g_pCurrentToken ? *g_pCurrentToken : g_neverCancelled;
+}
+
+CancellationScope::CancellationScope( const CancellationToken& token_ ) :
+  token( token_ ),
+  pPrevious( g_pCurrentToken )
+{
+	g_pCurrentToken = &token;
+}
+
+CancellationScope::CancellationScope( const IProgressCallback* source ) :
+  token( source ),
+  pPrevious( g_pCurrentToken )
+{
+	g_pCurrentToken = &token;
+}
+
+CancellationScope::~CancellationScope()
+{
+	g_pCurrentToken = pPrevious;
+}
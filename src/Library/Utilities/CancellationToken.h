@@ -0,0 +1,86 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  CancellationToken.h - Cooperative cancellation for render work
+//    that runs below progress-callback granularity.
+//
+//    The interactive editor restarts a render on every edit by
+//    tripping a CancellableProgressCallback.  The rasterizers observe
+//    that between tiles, but a single tile, a photon shoot, an SSS
+//    point-set build or the realize pass ahead of the TLAS build can
+//    each run for seconds without ever reaching a Progress() call.
+//    A CancellationToken lets that inner work poll the same flag.
+//
+//    Tokens are ambient: a rasterizer installs one for the duration
+//    of a render with a CancellationScope, ThreadPool::ParallelFor
+//    carries the caller's token into every task it runs, and deep
+//    code (ObjectManager, the SSS shader ops) reads it back with
+//    CancellationToken::Current() instead of having an
+//    IProgressCallback threaded through every interface on the way.
+//
+//    A token is only a view of an IProgressCallback's IsCancelled();
+//    it owns nothing and must not outlive the callback it wraps.
+//    Polling costs one virtual call and, for
+//    CancellableProgressCallback, one atomic load.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//  Comments:
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#ifndef RISE_CANCELLATION_TOKEN_
+#define RISE_CANCELLATION_TOKEN_
+
+#include "../Interfaces/IProgressCallback.h"
+
+namespace RISE
+{
+	class CancellationToken
+	{
+	public:
+		//! A token that is never cancelled
+		CancellationToken() : pSource( 0 ) {}
+
+		//! A token that reports `source`'s IsCancelled().  `source` may
+		//! be null, which gives the never-cancelled token.
+		explicit CancellationToken( const IProgressCallback* source ) : pSource( source ) {}
+
+		//! True if this token can ever report cancellation.  Work that
+		//! must not be abandoned half-way (e.g. a lazily built TLAS)
+		//! passes a token for which this is false.
+		bool CanBeCancelled() const { return pSource != 0; }
+
+		//! Polls the source.  Safe to call from any thread.
+		bool IsCancelled() const { return pSource && pSource->IsCancelled(); }
+
+		//! The token installed on the calling thread by the innermost
+		//! live CancellationScope, or the never-cancelled token.
+		static const CancellationToken& Current();
+
+	private:
+		const IProgressCallback*	pSource;
+	};
+
+	//! Installs a token as the calling thread's current token for the
+	//! lifetime of the scope, restoring the previous one on exit.
+	//! Scopes nest; they must be destroyed on the thread that made them.
+	class CancellationScope
+	{
+	public:
+		explicit CancellationScope( const CancellationToken& token );
+		explicit CancellationScope( const IProgressCallback* source );
+		~CancellationScope();
+
+	private:
+		CancellationScope( const CancellationScope& );
+		CancellationScope& operator=( const CancellationScope& );
+
+		const CancellationToken			token;
+		const CancellationToken*		pPrevious;
+	};
+}
+
+#endif
@@ -591,6 +591,77 @@ BoundingBox GeometricUtilities::BezierPatchBoundingBox(
 	return BoundingBox( ll, ur );
 }
 
+// Splits the cubic a[0]..a[3] (stride apart) at t=1/2 into l and r
+static inline void HalveBezierCubic(
+	const Point3* a,
+	const int stride,
+	Point3* l,
+	Point3* r
+	)
+{
+	const Point3 p01 = Point3Ops::WeightedAverage2( a[0], a[stride], 0.5 );
+	const Point3 p12 = Point3Ops::WeightedAverage2( a[stride], a[2*stride], 0.5 );
+	const Point3 p23 = Point3Ops::WeightedAverage2( a[2*stride], a[3*stride], 0.5 );
+	const Point3 p012 = Point3Ops::WeightedAverage2( p01, p12, 0.5 );
+	const Point3 p123 = Point3Ops::WeightedAverage2( p12, p23, 0.5 );
+	const Point3 mid = Point3Ops::WeightedAverage2( p012, p123, 0.5 );
+
+	l[0] = a[0];		l[stride] = p01;	l[2*stride] = p012;	l[3*stride] = mid;
+	r[0] = mid;			r[stride] = p123;	r[2*stride] = p23;	r[3*stride] = a[3*stride];
+}
+
+static void IncludeSubdividedBezierHull(
+	const Point3 (&cp)[16],
+	const unsigned int levels,
+	BoundingBox& box
+	)
+{
+	if( levels == 0 ) {
+		for( int i=0; i<16; i++ ) {
+			box.Include( cp[i] );
+		}
+		return;
+	}
+
+	// Halve every row, then every column of both halves
+	Point3 lo[16], hi[16];
+	for( int j=0; j<4; j++ ) {
+		HalveBezierCubic( &cp[j*4], 1, &lo[j*4], &hi[j*4] );
+	}
+
+	Point3 q[16], r[16];
+	for( int k=0; k<4; k++ ) {
+		HalveBezierCubic( &lo[k], 4, &q[k], &r[k] );
+	}
+	IncludeSubdividedBezierHull( q, levels-1, box );
+	IncludeSubdividedBezierHull( r, levels-1, box );
+
+	for( int k=0; k<4; k++ ) {
+		HalveBezierCubic( &hi[k], 4, &q[k], &r[k] );
+	}
+	IncludeSubdividedBezierHull( q, levels-1, box );
+	IncludeSubdividedBezierHull( r, levels-1, box );
+}
+
+//! Generates a bounding box of the given bezier patch from the control
+//! hulls of its subdivided pieces
+BoundingBox GeometricUtilities::BezierPatchSubdividedBoundingBox(
+	const BezierPatch& patch,						///< [in] The bezier patch
+	const unsigned int levels						///< [in] Number of times to halve the patch in u and v
+	)
+{
+	Point3 cp[16];
+	for( int j=0; j<4; j++ ) {
+		for( int k=0; k<4; k++ ) {
+			cp[j*4+k] = patch.c[j].pts[k];
+		}
+	}
+
+	BoundingBox box( Point3( RISE_INFINITY, RISE_INFINITY, RISE_INFINITY ), Point3( -RISE_INFINITY, -RISE_INFINITY, -RISE_INFINITY ) );
+	IncludeSubdividedBezierHull( cp, levels, box );
+	return box;
+}
+
 //! Generates axis aligned bounding box of the given bilinear patch
 BoundingBox GeometricUtilities::BilinearPatchBoundingBox(
 	const BilinearPatch& patch						///< [in] The bilinear patch
@@ -242,6 +242,16 @@ namespace RISE
 					const BezierPatch& patch							///< [in] The bezier patch
 					);
 
+		//! Generates a tighter bounding box of the given bezier patch:
+		//! the union of the control-hull boxes of the 4^levels
+		//! sub-patches de Casteljau subdivision splits it into.  Every
+		//! sub-hull lies inside the parent hull, so the result is never
+		//! larger than BezierPatchBoundingBox and still bounds the surface
+		extern BoundingBox BezierPatchSubdividedBoundingBox(
+					const BezierPatch& patch,							///< [in] The bezier patch
+					const unsigned int levels							///< [in] Number of times to halve the patch in u and v
+					);
+
 		//! Generates the bounding box of the given bilinear patch
 		extern BoundingBox BilinearPatchBoundingBox(
 					const BilinearPatch& patch							///< [in] The bilinear patch
@@ -14,6 +14,7 @@
 #include "pch.h"
 #include "MajorantGrid.h"
 #include <math.h>
+#include <vector>
 
 using namespace RISE;
 
@@ -67,6 +68,11 @@ MajorantGrid::MajorantGrid(
 	const int halfH = (int)volHeight / 2;
 	const int halfD = (int)volDepth / 2;
 
+	// Densities are fetched a row at a time so accessors with a batched
+	// path (VolumeAccessor_Painter compiles its painter graph and shades
+	// the whole row at once) are not driven one virtual call per voxel.
+	std::vector<Scalar> row( volWidth );
+
 	for( int vz = -halfD; vz < (int)volDepth - halfD; vz++ )
 	{
 		// Normalized z: map centered coord back to [0,1]
@@ -78,13 +84,17 @@ MajorantGrid::MajorantGrid(
 			const Scalar ny = (Scalar(vy) / Scalar(volHeight)) + 0.5;
 			const unsigned int cy = (unsigned int)fmin( ny * Scalar(m_gridY), Scalar(m_gridY - 1) );
 
+			// Query densities for this row (centered coordinates)
+			if( volWidth > 0 ) {
+				accessor.GetValueRow( -halfW, vy, vz, volWidth, &row[0] );
+			}
+
 			for( int vx = -halfW; vx < (int)volWidth - halfW; vx++ )
 			{
 				const Scalar nx = (Scalar(vx) / Scalar(volWidth)) + 0.5;
 				const unsigned int cx = (unsigned int)fmin( nx * Scalar(m_gridX), Scalar(m_gridX - 1) );
 
-				// Query density at this voxel (centered coordinates)
-				const Scalar d = accessor.GetValue( vx, vy, vz );
+				const Scalar d = row[ vx + halfW ];
 				const unsigned int cellIdx = CellIndex( cx, cy, cz );
 				const Scalar cellMajorant = d * sigma_t_majorant;
 				if( cellMajorant > m_data[cellIdx] )
@@ -95,6 +105,100 @@ MajorantGrid::MajorantGrid(
 		}
 	}
 
+	DilateAndScale( volWidth, volHeight, volDepth );
+}
+
+
+MajorantGrid::MajorantGrid(
+	const IBrickedVolume& bricks,
+	const Point3& bboxMin,
+	const Point3& bboxMax,
+	const Scalar sigma_t_majorant,
+	unsigned int gridResX,
+	unsigned int gridResY,
+	unsigned int gridResZ
+	) :
+  m_data( 0 ),
+  m_gridX( gridResX ),
+  m_gridY( gridResY ),
+  m_gridZ( gridResZ ),
+  m_bboxMin( bboxMin ),
+  m_bboxExtent( Vector3Ops::mkVector3( bboxMax, bboxMin ) ),
+  m_cellSize( m_bboxExtent.x / Scalar(gridResX),
+              m_bboxExtent.y / Scalar(gridResY),
+              m_bboxExtent.z / Scalar(gridResZ) ),
+  m_invCellSize( Scalar(gridResX) / m_bboxExtent.x,
+                 Scalar(gridResY) / m_bboxExtent.y,
+                 Scalar(gridResZ) / m_bboxExtent.z )
+{
+	const unsigned int totalCells = m_gridX * m_gridY * m_gridZ;
+	m_data = new Scalar[totalCells];
+
+	for( unsigned int i = 0; i < totalCells; i++ )
+		m_data[i] = 0;
+
+	const unsigned int volDim[3] = { bricks.Width(), bricks.Height(), bricks.Depth() };
+	const unsigned int gridRes[3] = { m_gridX, m_gridY, m_gridZ };
+	const unsigned int nBricks[3] = { bricks.BricksX(), bricks.BricksY(), bricks.BricksZ() };
+	const unsigned int edge = bricks.BrickEdge();
+
+	// Cell range covered by each brick, per axis.  The voxel-to-cell
+	// map of the voxel constructor is monotonic, so mapping a brick's
+	// first and last voxel gives every cell any of its voxels lands
+	// in; stamping the brick maximum over that range bounds the
+	// per-voxel build from above (and matches it exactly when bricks
+	// nest inside cells).
+	std::vector<unsigned int> cellLo[3], cellHi[3];
+	for( unsigned int axis = 0; axis < 3; axis++ )
+	{
+		const int half = (int)volDim[axis] / 2;
+		cellLo[axis].resize( nBricks[axis] );
+		cellHi[axis].resize( nBricks[axis] );
+		for( unsigned int b = 0; b < nBricks[axis]; b++ )
+		{
+			const unsigned int first = b * edge;
+			unsigned int last = first + edge - 1;
+			if( last >= volDim[axis] ) last = volDim[axis] - 1;
+
+			const Scalar nLo = (Scalar( (int)first - half ) / Scalar(volDim[axis])) + 0.5;
+			const Scalar nHi = (Scalar( (int)last - half ) / Scalar(volDim[axis])) + 0.5;
+			cellLo[axis][b] = (unsigned int)fmin( nLo * Scalar(gridRes[axis]), Scalar(gridRes[axis] - 1) );
+			cellHi[axis][b] = (unsigned int)fmin( nHi * Scalar(gridRes[axis]), Scalar(gridRes[axis] - 1) );
+		}
+	}
+
+	for( unsigned int bz = 0; bz < nBricks[2]; bz++ )
+	{
+		for( unsigned int by = 0; by < nBricks[1]; by++ )
+		{
+			for( unsigned int bx = 0; bx < nBricks[0]; bx++ )
+			{
+				const Scalar brickMajorant = bricks.BrickMaxValue( bx, by, bz ) * sigma_t_majorant;
+				if( brickMajorant <= 0 )
+					continue;
+
+				for( unsigned int cz = cellLo[2][bz]; cz <= cellHi[2][bz]; cz++ )
+					for( unsigned int cy = cellLo[1][by]; cy <= cellHi[1][by]; cy++ )
+						for( unsigned int cx = cellLo[0][bx]; cx <= cellHi[0][bx]; cx++ )
+						{
+							const unsigned int cellIdx = CellIndex( cx, cy, cz );
+							if( brickMajorant > m_data[cellIdx] )
+								m_data[cellIdx] = brickMajorant;
+						}
+			}
+		}
+	}
+
+	DilateAndScale( volDim[0], volDim[1], volDim[2] );
+}
+
+
+void MajorantGrid::DilateAndScale(
+	unsigned int volWidth,
+	unsigned int volHeight,
+	unsigned int volDepth
+	)
+{
 	// Dilation passes: account for interpolation stencil overlap.
 	//
 	// Trilinear interpolation uses a 2^3 stencil centered on the
@@ -136,71 +240,69 @@ MajorantGrid::MajorantGrid(
 	// to M and the rest to 0.
 	//
 	// The cost of the dilation is negligible (one-time grid build).
-	{
-		const unsigned int nCells = m_gridX * m_gridY * m_gridZ;
+	const unsigned int nCells = m_gridX * m_gridY * m_gridZ;
 
-		// Per-axis dilation radius in cells (see comment above).
-		const unsigned int gridRes[3] = { m_gridX, m_gridY, m_gridZ };
-		const unsigned int volDim[3] = { volWidth, volHeight, volDepth };
-		unsigned int radius[3];
-		for( unsigned int axis = 0; axis < 3; axis++ )
-		{
-			// ceil(2*gridRes/dim) in integer arithmetic; guard a
-			// degenerate zero dimension
-			const unsigned int dim = (volDim[axis] > 0) ? volDim[axis] : 1;
-			unsigned int r = (2 * gridRes[axis] + dim - 1) / dim;
-			if( r < 2 ) r = 2;
-			// Dilating past the axis length is pointless
-			if( r > gridRes[axis] ) r = gridRes[axis];
-			radius[axis] = r;
-		}
+	// Per-axis dilation radius in cells (see comment above).
+	const unsigned int gridRes[3] = { m_gridX, m_gridY, m_gridZ };
+	const unsigned int volDim[3] = { volWidth, volHeight, volDepth };
+	unsigned int radius[3];
+	for( unsigned int axis = 0; axis < 3; axis++ )
+	{
+		// ceil(2*gridRes/dim) in integer arithmetic; guard a
+		// degenerate zero dimension
+		const unsigned int dim = (volDim[axis] > 0) ? volDim[axis] : 1;
+		unsigned int r = (2 * gridRes[axis] + dim - 1) / dim;
+		if( r < 2 ) r = 2;
+		// Dilating past the axis length is pointless
+		if( r > gridRes[axis] ) r = gridRes[axis];
+		radius[axis] = r;
+	}
 
-		const unsigned int stride[3] = { 1, m_gridX, m_gridX * m_gridY };
-		Scalar* scratch = new Scalar[nCells];
+	const unsigned int stride[3] = { 1, m_gridX, m_gridX * m_gridY };
+	Scalar* scratch = new Scalar[nCells];
 
-		for( unsigned int axis = 0; axis < 3; axis++ )
+	for( unsigned int axis = 0; axis < 3; axis++ )
+	{
+		for( unsigned int pass = 0; pass < radius[axis]; pass++ )
 		{
-			for( unsigned int pass = 0; pass < radius[axis]; pass++ )
+			for( unsigned int z = 0; z < m_gridZ; z++ )
 			{
-				for( unsigned int z = 0; z < m_gridZ; z++ )
+				for( unsigned int y = 0; y < m_gridY; y++ )
 				{
-					for( unsigned int y = 0; y < m_gridY; y++ )
+					for( unsigned int x = 0; x < m_gridX; x++ )
 					{
-						for( unsigned int x = 0; x < m_gridX; x++ )
+						const unsigned int cellPos[3] = { x, y, z };
+						const unsigned int idx = CellIndex( x, y, z );
+
+						Scalar maxVal = m_data[idx];
+						if( cellPos[axis] > 0 )
+						{
+							const Scalar v = m_data[idx - stride[axis]];
+							if( v > maxVal ) maxVal = v;
+						}
+						if( cellPos[axis] + 1 < gridRes[axis] )
 						{
-							const unsigned int cellPos[3] = { x, y, z };
-							const unsigned int idx = CellIndex( x, y, z );
-
-							Scalar maxVal = m_data[idx];
-							if( cellPos[axis] > 0 )
-							{
-								const Scalar v = m_data[idx - stride[axis]];
-								if( v > maxVal ) maxVal = v;
-							}
-							if( cellPos[axis] + 1 < gridRes[axis] )
-							{
-								const Scalar v = m_data[idx + stride[axis]];
-								if( v > maxVal ) maxVal = v;
-							}
-							scratch[idx] = maxVal;
+							const Scalar v = m_data[idx + stride[axis]];
+							if( v > maxVal ) maxVal = v;
 						}
+						scratch[idx] = maxVal;
 					}
 				}
-
-				Scalar* tmp = m_data;
-				m_data = scratch;
-				scratch = tmp;
 			}
+
+			Scalar* tmp = m_data;
+			m_data = scratch;
+			scratch = tmp;
 		}
+	}
 
-		delete[] scratch;
+	delete[] scratch;
 
-		// Safety factor for Catmull-Rom tricubic overshoot:
-		// P^3 + 3*P*N^2 = 756/512 ~= 1.4766 (see derivation above).
-		const Scalar kTricubicOvershootFactor = 756.0 / 512.0;
-		for( unsigned int i = 0; i < nCells; i++ )
-			m_data[i] *= kTricubicOvershootFactor;
-	}
+	// Safety factor for Catmull-Rom tricubic overshoot:
+	// P^3 + 3*P*N^2 = 756/512 ~= 1.4766 (see derivation above).
+	const Scalar kTricubicOvershootFactor = 756.0 / 512.0;
+	for( unsigned int i = 0; i < nCells; i++ )
+		m_data[i] *= kTricubicOvershootFactor;
 }
 
 
@@ -45,6 +45,7 @@
 #include "../Utilities/Color/Color.h"
 #include "../Utilities/Ray.h"
 #include "../Interfaces/IVolumeAccessor.h"
+#include "../Interfaces/IBrickedVolume.h"
 
 namespace RISE
 {
@@ -102,6 +103,22 @@ namespace RISE
 			unsigned int gridResZ				///< [in] Grid resolution Z
 			);
 
+		/// Build the majorant grid from a bricked volume's per-brick
+		/// maxima, without touching voxel data.  Each brick's maximum
+		/// is stamped over every cell its voxels fall in, then dilated
+		/// and scaled exactly like the voxel constructor, so the result
+		/// is never below the voxel-based grid (and equals it when the
+		/// bricks nest inside cells).
+		MajorantGrid(
+			const IBrickedVolume& bricks,		///< [in] Bricked density volume
+			const Point3& bboxMin,				///< [in] World-space AABB minimum
+			const Point3& bboxMax,				///< [in] World-space AABB maximum
+			const Scalar sigma_t_majorant,		///< [in] Global majorant (MaxValue(max_sigma_t))
+			unsigned int gridResX,				///< [in] Grid resolution X
+			unsigned int gridResY,				///< [in] Grid resolution Y
+			unsigned int gridResZ				///< [in] Grid resolution Z
+			);
+
 		~MajorantGrid();
 
 		/// Get majorant for a specific cell
@@ -277,6 +294,15 @@ namespace RISE
 		}
 
 	protected:
+		/// Dilates the raw per-cell maxima by the interpolation stencil's
+		/// reach and applies the tricubic overshoot factor.  Shared by
+		/// both constructors.
+		void DilateAndScale(
+			unsigned int volWidth,
+			unsigned int volHeight,
+			unsigned int volDepth
+			);
+
 		/// Ray-AABB intersection (slab method).
 		/// Same algorithm as HeterogeneousMedium::IntersectBBox.
 		bool IntersectBBox(
@@ -17,6 +17,7 @@
 #include "ManifoldSolver.h"
 #include "../Interfaces/IGeometry.h"		// CanBeAreaLight(): SMS surface seeding shares the sampling contract
 #include "SMSPhotonMap.h"
+#include "SMSChainCache.h"
 #include "Optics.h"
 #include "BDPTUtilities.h"
 
@@ -663,6 +664,7 @@ namespace {
 }
 #endif
 #include "../Interfaces/ILog.h"
+#include "../Interfaces/IOptions.h"
 #include "../Interfaces/IScene.h"
 #include "../Interfaces/IRayCaster.h"
 #include "../Interfaces/IObjectManager.h"
@@ -685,16 +687,143 @@ using namespace RISE::Implementation;
 ManifoldSolver::ManifoldSolver( const ManifoldSolverConfig& cfg ) :
 config( cfg ),
 pLightSampler( 0 ),
-pPhotonMap( 0 )
+pPhotonMap( 0 ),
+pChainCache( 0 ),
+mNewtonSolves( 0 ),
+mNewtonIterations( 0 ),
+mWarmStarts( 0 ),
+mWarmStartsConverged( 0 )
 {
 	pLightSampler = new LightSampler();
+
+	// The chain cache can also be switched on for every solver from the
+	// options file, without touching each rasterizer's SMS parameters
+	if( !config.chainCache ) {
+		config.chainCache = GlobalOptions().ReadBool( "sms_chain_cache", false );
+		if( config.chainCache && config.chainCacheCellSize <= 0 ) {
+			config.chainCacheCellSize = GlobalOptions().ReadDouble( "sms_chain_cache_cell", 0 );
+		}
+	}
+
+	// Warm starts change the seed distribution, which only the biased
+	// estimator tolerates; uniform seeding samples casters by design
+	if( config.chainCache && ( !config.biased || config.seedingMode != ManifoldSolverConfig::eSeedingSnell ) ) {
+		GlobalLog()->PrintEasyWarning( "ManifoldSolver:: The SMS chain cache needs biased Snell seeding, ignoring it" );
+		config.chainCache = false;
+	}
+
+	if( config.chainCache && config.chainCacheCellSize > 0 ) {
+		CreateChainCache( config.chainCacheCellSize );
+	}
 }
 
 ManifoldSolver::~ManifoldSolver()
 {
+	if( pChainCache ) {
+		const SolverStats st = GetSolverStats();
+		GlobalLog()->PrintEx( eLog_Event,
+			"ManifoldSolver:: chain cache hit rate %.1f%% (%llu of %llu), warm starts converged %llu of %llu, mean Newton iterations %.2f over %llu solves",
+			100.0 * st.HitRate(), st.cacheHits, st.cacheLookups,
+			st.warmStartsConverged, st.warmStarts,
+			st.MeanIterations(), st.newtonSolves );
+		delete pChainCache;
+		pChainCache = 0;
+	}
+
 	safe_release( pLightSampler );
 }
 
+void ManifoldSolver::CreateChainCache( const Scalar cellSize )
+{
+	delete pChainCache;
+
+	// Light samples are keyed by region rather than by point: any seed
+	// converged toward a nearby part of the emitter is a good start
+	pChainCache = new SMSChainCache( config.chainCacheEntries, cellSize, cellSize * 8.0 );
+	GlobalLog()->PrintNew( pChainCache, __FILE__, __LINE__, "SMS chain cache" );
+}
+
+void ManifoldSolver::SetSpecularCasters( std::vector<const IObject*> list )
+{
+	mSpecularCasters = std::move( list );
+
+	if( config.chainCache && config.chainCacheCellSize <= 0 && !mSpecularCasters.empty() )
+	{
+		BoundingBox bounds( Point3( RISE_INFINITY, RISE_INFINITY, RISE_INFINITY ),
+			Point3( -RISE_INFINITY, -RISE_INFINITY, -RISE_INFINITY ) );
+		for( const IObject* pObj : mSpecularCasters ) {
+			if( pObj ) {
+				bounds.Include( pObj->getBoundingBox() );
+			}
+		}
+
+		const Scalar diag = Vector3Ops::Magnitude( Vector3Ops::mkVector3( bounds.ur, bounds.ll ) );
+		if( diag > 0 && diag < RISE_INFINITY ) {
+			CreateChainCache( diag * 0.005 );
+		}
+	}
+}
+
+ManifoldSolver::SolverStats ManifoldSolver::GetSolverStats() const
+{
+	SolverStats st;
+	st.newtonSolves = mNewtonSolves.load( std::memory_order_relaxed );
+	st.newtonIterations = mNewtonIterations.load( std::memory_order_relaxed );
+	st.warmStarts = mWarmStarts.load( std::memory_order_relaxed );
+	st.warmStartsConverged = mWarmStartsConverged.load( std::memory_order_relaxed );
+	st.cacheLookups = 0;
+	st.cacheHits = 0;
+	if( pChainCache ) {
+		const SMSChainCache::Stats cs = pChainCache->GetStats();
+		st.cacheLookups = cs.lookups;
+		st.cacheHits = cs.hits;
+	}
+	return st;
+}
+
+ManifoldResult ManifoldSolver::SolveWithChainCache(
+	const Point3& shadingPoint,
+	const Vector3& shadingNormal,
+	const Point3& emitterPoint,
+	const Vector3& emitterNormal,
+	std::vector<ManifoldVertex>& seed,
+	ISampler& sampler
+	) const
+{
+	if( !pChainCache ) {
+		return Solve( shadingPoint, shadingNormal, emitterPoint, emitterNormal, seed, sampler );
+	}
+
+	std::vector<ManifoldVertex> warm;
+	if( pChainCache->Lookup( shadingPoint, emitterPoint, seed, warm ) )
+	{
+		// Keep the cached geometry (position, frame, uv) but the query's
+		// own optical data: eta and attenuation can be per-wavelength
+		for( size_t i = 0; i < warm.size(); i++ ) {
+			warm[i].eta = seed[i].eta;
+			warm[i].etaI = seed[i].etaI;
+			warm[i].etaT = seed[i].etaT;
+			warm[i].attenuation = seed[i].attenuation;
+			warm[i].pMaterial = seed[i].pMaterial;
+		}
+
+		mWarmStarts.fetch_add( 1, std::memory_order_relaxed );
+		ManifoldResult warmResult = Solve( shadingPoint, shadingNormal, emitterPoint, emitterNormal, warm, sampler );
+		if( warmResult.valid ) {
+			mWarmStartsConverged.fetch_add( 1, std::memory_order_relaxed );
+			pChainCache->Insert( shadingPoint, emitterPoint, warmResult.specularChain );
+			return warmResult;
+		}
+	}
+
+	// Miss, or the cached chain led Newton elsewhere: the query's own seed
+	ManifoldResult result = Solve( shadingPoint, shadingNormal, emitterPoint, emitterNormal, seed, sampler );
+	if( result.valid ) {
+		pChainCache->Insert( shadingPoint, emitterPoint, result.specularChain );
+	}
+	return result;
+}
+
 //////////////////////////////////////////////////////////////////////
 // ComputeSpecularDirection
 //
@@ -3077,6 +3206,21 @@ bool ManifoldSolver::NewtonSolve(
 		return false;
 	}
 
+	// Iteration tally for GetSolverStats, published once on every exit
+	// path so the shared counters are touched once per solve
+	struct IterationTally
+	{
+		std::atomic<unsigned long long>&	solves;
+		std::atomic<unsigned long long>&	total;
+		unsigned int						iterations;
+
+		~IterationTally()
+		{
+			solves.fetch_add( 1, std::memory_order_relaxed );
+			total.fetch_add( iterations, std::memory_order_relaxed );
+		}
+	} tally = { mNewtonSolves, mNewtonIterations, 0 };
+
 	// Levenberg-Marquardt damping factor.  Persists across iterations of
 	// THIS Solve call: shrunk on accepted line-search steps (toward pure
 	// Newton, which converges quadratically near a root), grown on
@@ -3093,6 +3237,7 @@ bool ManifoldSolver::NewtonSolve(
 
 	for( unsigned int iter = 0; iter < config.maxIterations; iter++ )
 	{
+		tally.iterations = iter + 1;
 #if SMS_SOLVE_DIAG
 		if( config.useLevenbergMarquardt ) {
 			g_solveDiag_lmTotalIters.fetch_add( 1, std::memory_order_relaxed );
@@ -6447,10 +6592,18 @@ ManifoldSolver::SMSContribution ManifoldSolver::EvaluateAtShadingPoint(
 			trialSeed.push_back( mv );
 		}
 
-		ManifoldResult mResult = Solve(
-			pos, shadingNormal,
-			lightSample.position, lightSample.normal,
-			trialSeed, loopSampler );
+		// The Snell-traced seed is the one neighbouring queries share, so
+		// it is the one warm-started from the chain cache.  Supplemental
+		// and photon seeds exist to find OTHER roots and solve as-is.
+		ManifoldResult mResult = ( trial == 0 && !useSurfaceSample ) ?
+			SolveWithChainCache(
+				pos, shadingNormal,
+				lightSample.position, lightSample.normal,
+				trialSeed, loopSampler ) :
+			Solve(
+				pos, shadingNormal,
+				lightSample.position, lightSample.normal,
+				trialSeed, loopSampler );
 
 #if SMS_TRACE_DIAGNOSTIC
 		if( traceHere ) {
@@ -7932,10 +8085,16 @@ ManifoldSolver::SMSContributionNM ManifoldSolver::EvaluateAtShadingPointNM(
 			trialSeed = newChain;
 		}
 
-		ManifoldResult mResult = Solve(
-			pos, shadingNormal,
-			lightSample.position, lightSample.normal,
-			trialSeed, loopSampler );
+		// Warm-start the Snell seed only; see the RGB variant
+		ManifoldResult mResult = ( trial == 0 ) ?
+			SolveWithChainCache(
+				pos, shadingNormal,
+				lightSample.position, lightSample.normal,
+				trialSeed, loopSampler ) :
+			Solve(
+				pos, shadingNormal,
+				lightSample.position, lightSample.normal,
+				trialSeed, loopSampler );
 
 		if( !mResult.valid ) continue;
 
@@ -50,6 +50,7 @@
 #include "../Utilities/RandomNumbers.h"
 #include "../Utilities/ISampler.h"
 #include "../Utilities/IORStack.h"
+#include <atomic>
 #include <vector>
 
 namespace RISE
@@ -238,6 +239,25 @@ namespace RISE
 			/// a glass shell).  See `SMSConfig::targetBounces`.
 			unsigned int	targetBounces;
 
+			/// Warm-start Newton from a spatial cache of converged chains
+			/// (see SMSChainCache).  Snell seeding in biased mode only: the
+			/// unbiased Bernoulli estimator needs every seed drawn from the
+			/// same distribution, which a cache hit would change.  A cached
+			/// chain is only ever a SEED -- Newton re-converges against the
+			/// query's own endpoints and the contribution is computed from
+			/// that solution.  Default false; also enabled by the global
+			/// option `sms_chain_cache`.
+			bool			chainCache;
+
+			/// World-space cell size of the shading-point hash.  0 derives
+			/// it from the specular casters' bounds (0.5% of the diagonal)
+			/// when SetSpecularCasters is called.
+			Scalar			chainCacheCellSize;
+
+			/// Slots in the chain cache (direct mapped; older chains are
+			/// overwritten)
+			unsigned int	chainCacheEntries;
+
 			ManifoldSolverConfig() :
 			enabled( false ),
 			maxIterations( 15 ),
@@ -254,7 +274,10 @@ namespace RISE
 			twoStage( false ),
 			useLevenbergMarquardt( false ),
 			seedingMode( eSeedingSnell ),
-			targetBounces( 0 )
+			targetBounces( 0 ),
+			chainCache( false ),
+			chainCacheCellSize( 0 ),
+			chainCacheEntries( 1u << 16 )
 			{
 			}
 		};
@@ -288,6 +311,7 @@ namespace RISE
 		struct LightSample;
 		class SMSPhotonMap;
 		struct SMSPhoton;
+		class SMSChainCache;
 
 		class ManifoldSolver :
 			public virtual IReference,
@@ -314,6 +338,30 @@ namespace RISE
 			/// rasterizer hasn't populated it.
 			std::vector<const IObject*> mSpecularCasters;
 
+			/// Converged-chain cache for Newton warm starts; null unless
+			/// `config.chainCache` is set and a cell size is known.
+			SMSChainCache* pChainCache;
+
+			/// Newton statistics, accumulated once per NewtonSolve call
+			mutable std::atomic<unsigned long long> mNewtonSolves;
+			mutable std::atomic<unsigned long long> mNewtonIterations;
+			mutable std::atomic<unsigned long long> mWarmStarts;			///< Trials seeded from the chain cache
+			mutable std::atomic<unsigned long long> mWarmStartsConverged;	///< ...of which Newton converged
+
+			void CreateChainCache( const Scalar cellSize );
+
+			/// Looks up a warm-start seed for `seed` and solves from it.
+			/// Falls back to solving from `seed` itself on a miss or when
+			/// the warm start does not converge; caches the converged chain.
+			ManifoldResult SolveWithChainCache(
+				const Point3& shadingPoint,
+				const Vector3& shadingNormal,
+				const Point3& emitterPoint,
+				const Vector3& emitterNormal,
+				std::vector<ManifoldVertex>& seed,
+				ISampler& sampler
+				) const;
+
 			virtual ~ManifoldSolver();
 
 		public:
@@ -329,9 +377,10 @@ namespace RISE
 			/// Attach the cached specular-caster list.  Call once at
 			/// scene-prep (after EnumerateSpecularCasters).  Pass an
 			/// empty vector to clear.
-			void SetSpecularCasters( std::vector<const IObject*> list ) {
-				mSpecularCasters = std::move( list );
-			}
+			///
+			/// Also sizes the chain cache from the casters' bounds when the
+			/// config leaves the cell size to be derived.
+			void SetSpecularCasters( std::vector<const IObject*> list );
 			const std::vector<const IObject*>& GetSpecularCasters() const {
 				return mSpecularCasters;
 			}
@@ -505,6 +554,24 @@ namespace RISE
 
 			const ManifoldSolverConfig& GetConfig() const { return config; }
 
+			/// Newton and chain-cache counters, for logs and tests
+			struct SolverStats
+			{
+				unsigned long long	newtonSolves;			///< NewtonSolve calls
+				unsigned long long	newtonIterations;		///< Iterations over all of them
+				unsigned long long	cacheLookups;			///< Chain-cache lookups
+				unsigned long long	cacheHits;				///< Lookups that found a matching chain
+				unsigned long long	warmStarts;				///< Solves seeded from the cache
+				unsigned long long	warmStartsConverged;	///< ...that converged
+
+				Scalar MeanIterations() const { return newtonSolves ? Scalar( newtonIterations ) / Scalar( newtonSolves ) : 0; }
+				Scalar HitRate() const { return cacheLookups ? Scalar( cacheHits ) / Scalar( cacheLookups ) : 0; }
+			};
+
+			SolverStats GetSolverStats() const;
+
+			const SMSChainCache* GetChainCache() const { return pChainCache; }
+
 			/// Result of a single SMS evaluation at a shading point.
 			struct SMSContribution
 			{
@@ -61,17 +61,35 @@ namespace RISE
 		RayDifferentials	diffs;
 		bool				hasDifferentials;
 
-		Ray( ) : hasDifferentials( false ) {}
+		// Scene time the ray samples, read only by objects that carry
+		// motion keys (Object::SetMotion).  A new ray takes the time of
+		// the sample its thread is tracing, see ThreadTime(), so the
+		// camera ray and every secondary ray of one path agree without
+		// each spawn site having to pass the time along.
+		Scalar				time;
+
+		//! Time given to rays built on the calling thread.  Set once per
+		//! temporal sample by the rasterizer, and once per path by the
+		//! pre-passes that trace outside the pixel loop.  Pool tasks
+		//! start from the time of the thread that dispatched them, see
+		//! RayTimeScope
+		static inline Scalar& ThreadTime()
+		{
+			static thread_local Scalar t = 0;
+			return t;
+		}
+
+		Ray( ) : hasDifferentials( false ), time( ThreadTime() ) {}
 
 		Ray( const Point3& p, const Vector3& d ) :
-		m_dir( d ), origin( p ), hasDifferentials( false )
+		m_dir( d ), origin( p ), hasDifferentials( false ), time( ThreadTime() )
 		{
 			RecomputeInvDir();
 		}
 
 		Ray( const Ray& r ) :
 		m_dir( r.m_dir ), origin( r.origin ), invDir( r.invDir ),
-		diffs( r.diffs ), hasDifferentials( r.hasDifferentials )
+		diffs( r.diffs ), hasDifferentials( r.hasDifferentials ), time( r.time )
 		{
 			sign[0] = r.sign[0];
 			sign[1] = r.sign[1];
@@ -128,6 +146,7 @@ namespace RISE
 			sign[2] = r.sign[2];
 			diffs = r.diffs;
 			hasDifferentials = r.hasDifferentials;
+			time = r.time;
 
 			return *this;
 		}
@@ -138,6 +157,29 @@ namespace RISE
 				Vector3Ops::AreEqual(a.m_dir, b.m_dir, epsilon );
 		}
 	};
+
+	//! Installs a ray time on the calling thread for the lifetime of
+	//! the scope and puts the previous one back after, so a time set
+	//! while tracing one task never leaks into the next
+	class RayTimeScope
+	{
+		const Scalar saved;
+
+	public:
+		explicit RayTimeScope( const Scalar t ) : saved( Ray::ThreadTime() )
+		{
+			Ray::ThreadTime() = t;
+		}
+
+		~RayTimeScope()
+		{
+			Ray::ThreadTime() = saved;
+		}
+
+	private:
+		RayTimeScope( const RayTimeScope& );
+		RayTimeScope& operator=( const RayTimeScope& );
+	};
 }
 
 #endif
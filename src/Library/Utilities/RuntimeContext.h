@@ -38,6 +38,7 @@ namespace RISE { namespace Implementation { class PathGuidingField; } }
 namespace RISE
 {
 	struct PixelAOV;	// First-hit albedo/normal AOV side-data (AOVBuffers.h)
+	struct PrimaryHit;	// First surface hit by a pixel's camera ray (PixelReuseCache.h)
 
 	// Per-thread rendering state, allocated and owned by each rasterizer thread.
 	// Not part of the shared scene graph — mutable fields here are correct because
@@ -164,6 +165,14 @@ namespace RISE
 		/// explicitly), so it never perturbs them.
 		mutable PixelAOV*										pAOV;
 
+		/// Per-pixel sink for the first surface the pixel's camera ray
+		/// hit, filled by RayCaster on the first cast like pAOV's depth.
+		/// The interactive preview parks one here while it records its
+		/// pixel history (PixelReuseCache), so the history is keyed off
+		/// the ray already traced rather than a second one.  NULL
+		/// everywhere else.
+		mutable PrimaryHit*										pPrimaryHit;
+
 #ifdef RISE_ENABLE_OPENPGL
 		/// Path guiding field for guided directional sampling.
 		/// Set by the rasterizer before rendering.  NULL when guiding
@@ -213,7 +222,8 @@ namespace RISE
 		  pProgressiveFilm( 0 ),
 		  totalProgressiveSPP( 0 ),
 		  aovPrefilterMode( OidnPrefilter::Fast ),
-		  pAOV( 0 )
+		  pAOV( 0 ),
+		  pPrimaryHit( 0 )
 #ifdef RISE_ENABLE_OPENPGL
 		  ,pGuidingField( 0 )
 		  ,guidingAlpha( 0 )
@@ -0,0 +1,173 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  SMSChainCache.cpp - Implementation of the converged-chain cache
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//  Comments:
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "pch.h"
+#include "SMSChainCache.h"
+#include <cmath>
+
+using namespace RISE;
+using namespace RISE::Implementation;
+
+namespace
+{
+	// FNV-1a, as in TriangleMeshCache
+	inline void HashBytes( unsigned long long& h, const void* p, const size_t n )
+	{
+		const unsigned char* b = static_cast<const unsigned char*>( p );
+		for( size_t i = 0; i < n; i++ ) {
+			h ^= b[i];
+			h *= 1099511628211ULL;
+		}
+	}
+
+	inline void HashCell( unsigned long long& h, const Point3& p, const Scalar invCell )
+	{
+		const long long c[3] = {
+			static_cast<long long>( std::floor( p.x * invCell ) ),
+			static_cast<long long>( std::floor( p.y * invCell ) ),
+			static_cast<long long>( std::floor( p.z * invCell ) ) };
+		HashBytes( h, c, sizeof( c ) );
+	}
+
+	inline unsigned char VertexFlags( const ManifoldVertex& v )
+	{
+		return static_cast<unsigned char>(
+			( v.isReflection ? 1 : 0 ) | ( v.isExiting ? 2 : 0 ) | ( v.canRefract ? 4 : 0 ) );
+	}
+}
+
+SMSChainCache::SMSChainCache(
+	const unsigned int entries,
+	const Scalar cellSize,
+	const Scalar lightCellSize
+	) :
+  m_cellSize( cellSize ),
+  m_lightCellSize( lightCellSize ),
+  m_slotsPerShard( 1 ),
+  m_lookups( 0 ),
+  m_hits( 0 ),
+  m_inserts( 0 )
+{
+	const unsigned int perShard = ( entries + kShards - 1 ) / kShards;
+	while( m_slotsPerShard < perShard && m_slotsPerShard < 0x40000000u ) {
+		m_slotsPerShard <<= 1;
+	}
+
+	for( unsigned int i = 0; i < kShards; i++ ) {
+		m_shards[i].slots.resize( m_slotsPerShard );
+	}
+}
+
+SMSChainCache::~SMSChainCache()
+{
+}
+
+bool SMSChainCache::SameTopology(
+	const std::vector<ManifoldVertex>& a,
+	const std::vector<ManifoldVertex>& b
+	)
+{
+	if( a.size() != b.size() ) {
+		return false;
+	}
+
+	for( size_t i = 0; i < a.size(); i++ ) {
+		if( a[i].pObject != b[i].pObject || VertexFlags( a[i] ) != VertexFlags( b[i] ) ) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+unsigned long long SMSChainCache::Key(
+	const Point3& shadingPoint,
+	const Point3& lightPoint,
+	const std::vector<ManifoldVertex>& topology
+	) const
+{
+	unsigned long long h = 14695981039346656037ULL;
+	HashCell( h, shadingPoint, 1.0 / m_cellSize );
+	HashCell( h, lightPoint, 1.0 / m_lightCellSize );
+
+	const unsigned int k = static_cast<unsigned int>( topology.size() );
+	HashBytes( h, &k, sizeof( k ) );
+	for( unsigned int i = 0; i < k; i++ ) {
+		const IObject* pObj = topology[i].pObject;
+		const unsigned char flags = VertexFlags( topology[i] );
+		HashBytes( h, &pObj, sizeof( pObj ) );
+		HashBytes( h, &flags, sizeof( flags ) );
+	}
+
+	return h;
+}
+
+bool SMSChainCache::Lookup(
+	const Point3& shadingPoint,
+	const Point3& lightPoint,
+	const std::vector<ManifoldVertex>& topology,
+	std::vector<ManifoldVertex>& chain
+	) const
+{
+	m_lookups.fetch_add( 1, std::memory_order_relaxed );
+
+	if( topology.empty() ) {
+		return false;
+	}
+
+	const unsigned long long key = Key( shadingPoint, lightPoint, topology );
+	Shard& shard = m_shards[ key % kShards ];
+	const Slot& slot = shard.slots[ (key / kShards) & (m_slotsPerShard - 1) ];
+
+	{
+		std::lock_guard<std::mutex> lock( shard.mutex );
+		if( !slot.used || slot.key != key || !SameTopology( slot.chain, topology ) ) {
+			return false;
+		}
+		chain = slot.chain;
+	}
+
+	m_hits.fetch_add( 1, std::memory_order_relaxed );
+	return true;
+}
+
+void SMSChainCache::Insert(
+	const Point3& shadingPoint,
+	const Point3& lightPoint,
+	const std::vector<ManifoldVertex>& chain
+	)
+{
+	if( chain.empty() ) {
+		return;
+	}
+
+	m_inserts.fetch_add( 1, std::memory_order_relaxed );
+
+	const unsigned long long key = Key( shadingPoint, lightPoint, chain );
+	Shard& shard = m_shards[ key % kShards ];
+	Slot& slot = shard.slots[ (key / kShards) & (m_slotsPerShard - 1) ];
+
+	std::lock_guard<std::mutex> lock( shard.mutex );
+	slot.key = key;
+	slot.used = true;
+	slot.chain = chain;
+}
+
+SMSChainCache::Stats SMSChainCache::GetStats() const
+{
+	Stats s;
+	s.lookups = m_lookups.load( std::memory_order_relaxed );
+	s.hits = m_hits.load( std::memory_order_relaxed );
+	s.inserts = m_inserts.load( std::memory_order_relaxed );
+	return s;
+}
@@ -0,0 +1,129 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  SMSChainCache.h - Spatial cache of converged specular manifold
+//    chains, used to warm-start the SMS Newton solve.
+//
+//    Neighbouring pixels and successive passes ask ManifoldSolver for
+//    nearly the same caustic chain, yet every query starts Newton from
+//    a fresh Snell-traced seed.  This cache remembers the last chain
+//    that converged for a (shading-point cell, light-sample region,
+//    chain topology) key; a later query landing in the same key uses
+//    it as its Newton SEED.  Newton always re-converges against the
+//    query's own endpoints, and the contribution is computed from that
+//    fresh solution, so a stale entry can cost iterations but can never
+//    leak into the estimate.
+//
+//    Storage is a fixed-size, direct-mapped table split into shards
+//    with one mutex each: an insert simply overwrites whatever chain
+//    hashed to its slot, so memory is bounded and there is no eviction
+//    bookkeeping.  The full key is stored and checked on lookup.
+//
+//    Thread-safety: Lookup and Insert may be called from every render
+//    worker concurrently.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//  Comments:
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#ifndef SMS_CHAIN_CACHE_
+#define SMS_CHAIN_CACHE_
+
+#include "ManifoldSolver.h"
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace RISE
+{
+	namespace Implementation
+	{
+		class SMSChainCache
+		{
+		public:
+			struct Stats
+			{
+				unsigned long long	lookups;		///< Lookup calls
+				unsigned long long	hits;			///< Lookups that returned a chain
+				unsigned long long	inserts;		///< Insert calls
+			};
+
+			SMSChainCache(
+				const unsigned int entries,			///< [in] Total slots (rounded up to a power of two)
+				const Scalar cellSize,				///< [in] World-space size of a shading-point cell
+				const Scalar lightCellSize			///< [in] World-space size of a light-sample region
+				);
+			~SMSChainCache();
+
+			/// Copies the cached chain for this query into `chain`.  The
+			/// topology (length, per-vertex object, reflect/refract and
+			/// exit flags) must match `topology`, normally the query's own
+			/// Snell-traced seed.  Returns false on a miss.
+			bool Lookup(
+				const Point3& shadingPoint,
+				const Point3& lightPoint,
+				const std::vector<ManifoldVertex>& topology,
+				std::vector<ManifoldVertex>& chain
+				) const;
+
+			/// Stores a converged chain for this query, replacing whatever
+			/// shared its slot.
+			void Insert(
+				const Point3& shadingPoint,
+				const Point3& lightPoint,
+				const std::vector<ManifoldVertex>& chain
+				);
+
+			Stats GetStats() const;
+
+			Scalar GetCellSize() const { return m_cellSize; }
+			Scalar GetLightCellSize() const { return m_lightCellSize; }
+
+			/// True if two chains have the same length and, vertex by
+			/// vertex, the same object and the same scattering flags
+			static bool SameTopology(
+				const std::vector<ManifoldVertex>& a,
+				const std::vector<ManifoldVertex>& b
+				);
+
+		protected:
+			struct Slot
+			{
+				unsigned long long				key;
+				bool							used;
+				std::vector<ManifoldVertex>		chain;
+
+				Slot() : key( 0 ), used( false ) {}
+			};
+
+			struct Shard
+			{
+				std::mutex						mutex;
+				std::vector<Slot>				slots;
+			};
+
+			static const unsigned int kShards = 16;
+
+			unsigned long long Key(
+				const Point3& shadingPoint,
+				const Point3& lightPoint,
+				const std::vector<ManifoldVertex>& topology
+				) const;
+
+			const Scalar					m_cellSize;
+			const Scalar					m_lightCellSize;
+			unsigned int					m_slotsPerShard;		///< power of two
+			mutable Shard					m_shards[kShards];
+
+			mutable std::atomic<unsigned long long>	m_lookups;
+			mutable std::atomic<unsigned long long>	m_hits;
+			std::atomic<unsigned long long>			m_inserts;
+		};
+	}
+}
+
+#endif
@@ -382,7 +382,9 @@ namespace
 
 unsigned int SMSPhotonMap::Build(
 	const IScene& scene,
-	const unsigned int numPhotons
+	const unsigned int numPhotons,
+	const Scalar timeOpen,
+	const Scalar timeExposure
 	)
 {
 	Clear();
@@ -431,6 +433,10 @@ unsigned int SMSPhotonMap::Build(
 	RandomNumberGenerator rng;
 	RandomNumberGenerator geomRng;
 
+	// Photons shot on a motion blurred frame each pick a time across
+	// the shutter; the caller's own ray time is put back afterwards
+	RayTimeScope rayTimeScope( Ray::ThreadTime() );
+
 	// Shoot photons proportional to each emitter's exitance.
 	//
 	// Known limitation: this is a single-threaded fixed-length loop.  For
@@ -455,6 +461,9 @@ unsigned int SMSPhotonMap::Build(
 
 		unsigned int shotThisEmitter = 0;
 		while( shotThisEmitter < target ) {
+			if( timeExposure > 0 ) {
+				Ray::ThreadTime() = timeOpen + rng.CanonicalRandom() * timeExposure;
+			}
 			Ray r;
 			Vector3 normal;
 			Point2 coord;
@@ -509,6 +518,9 @@ unsigned int SMSPhotonMap::Build(
 
 		unsigned int shotThisLight = 0;
 		while( shotThisLight < target ) {
+			if( timeExposure > 0 ) {
+				Ray::ThreadTime() = timeOpen + rng.CanonicalRandom() * timeExposure;
+			}
 			Ray r = l->generateRandomPhoton(
 				Point3( geomRng.CanonicalRandom(), geomRng.CanonicalRandom(), geomRng.CanonicalRandom() ) );
 
@@ -68,10 +68,14 @@ namespace RISE
 			///
 			/// \param scene          Scene with its acceleration structure already built.
 			/// \param numPhotons     Requested emission budget; actual stored count depends on how many photons land on diffuse after a specular bounce.
+			/// \param timeOpen       Shutter open of a per-ray motion blurred frame.
+			/// \param timeExposure   Shutter length; each photon then traces at its own time in [timeOpen, timeOpen+timeExposure).  Zero leaves ray time alone.
 			/// \return               Number of photons actually stored (== queryable seeds).
 			unsigned int Build(
 				const IScene& scene,
-				const unsigned int numPhotons
+				const unsigned int numPhotons,
+				const Scalar timeOpen = 0,
+				const Scalar timeExposure = 0
 				);
 
 			/// Fixed-radius query: appends every stored photon whose
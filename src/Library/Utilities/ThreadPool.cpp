@@ -10,6 +10,7 @@
 #include "ThreadPool.h"
 #include "CPU.h"
 #include "CPUTopology.h"
+#include "Ray.h"
 #include "../Interfaces/IOptions.h"
 #include <algorithm>
 #include <chrono>
@@ -198,6 +199,16 @@ void ThreadPool::ParallelFor( unsigned int n, std::function<void( unsigned int )
 		return;
 	}
 
+	// Tasks may run on any pool thread, or on a thread that is itself
+	// waiting in another ParallelFor; each installs the caller's token
+	// for its own duration so the body polls the right render.
+	const CancellationToken ambient = CancellationToken::Current();
+
+	// Likewise the caller's ray time (Ray::ThreadTime).  The scope also
+	// puts a worker's own time back after the body, so a time set per
+	// sample or per path on a pool thread never outlives the task.
+	const Scalar rayTime = Ray::ThreadTime();
+
 	// Latch — atomic counter + mutex/cv for completion signalling.
 	// Heap-allocated and shared (see ParallelForLatchState comment for
 	// the lifetime-race rationale).
@@ -206,7 +217,9 @@ void ThreadPool::ParallelFor( unsigned int n, std::function<void( unsigned int )
 	{
 		std::lock_guard<std::mutex> lk( tasksMut );
 		for( unsigned int i = 0; i < n; i++ ) {
-			tasks.push_back( [i, &body, sync] {
+			tasks.push_back( [i, &body, sync, ambient, rayTime] {
+				CancellationScope cancelScope( ambient );
+				RayTimeScope rayTimeScope( rayTime );
 				// The decrement below MUST run on every exit from this task
 				// (success OR throw), otherwise the latch never reaches zero
 				// and the ParallelFor caller hangs forever.  Catch the
@@ -286,6 +299,20 @@ void ThreadPool::ParallelFor( unsigned int n, std::function<void( unsigned int )
 	}
 }
 
+bool ThreadPool::ParallelFor( unsigned int n, std::function<void( unsigned int )> body, const CancellationToken& cancel )
+{
+	std::atomic<bool> skipped( false );
+	CancellationScope cancelScope( cancel );
+	ParallelFor( n, [&body, &cancel, &skipped]( unsigned int i ) {
+		if( cancel.IsCancelled() ) {
+			skipped.store( true, std::memory_order_relaxed );
+			return;
+		}
+		body( i );
+	} );
+	return !skipped.load( std::memory_order_relaxed );
+}
+
 ThreadPool& RISE::Implementation::GlobalThreadPool()
 {
 	// Meyers' singleton — thread-safe init since C++11.
@@ -27,6 +27,7 @@
 #define RISE_THREAD_POOL_
 
 #include "Threads/Threads.h"
+#include "CancellationToken.h"
 #include <atomic>
 #include <condition_variable>
 #include <deque>
@@ -87,8 +88,24 @@ namespace RISE
 			//! this is a contract restriction rather than a live bug;
 			//! any future caller that wants to recurse must first
 			//! check the legacy-mode option and route around the pool.
+			//!
+			//! Cancellation: the calling thread's ambient
+			//! CancellationToken (see CancellationToken.h) is installed
+			//! on whichever thread runs each body(i), so code below the
+			//! body sees the same CancellationToken::Current() as the
+			//! caller.  The caller's Ray::ThreadTime() travels the same
+			//! way and is put back on the worker once body(i) returns.
 			void ParallelFor( unsigned int n, std::function<void( unsigned int )> body );
 
+			//! As above, but once `cancel` reports cancellation every
+			//! body(i) that has not yet started is skipped.  Bodies
+			//! already running are not interrupted; they see `cancel`
+			//! as their ambient token and may poll it themselves.
+			//! Still blocks until every started body has returned.
+			//! \return true if body(i) ran for every i, false if any
+			//! were skipped
+			bool ParallelFor( unsigned int n, std::function<void( unsigned int )> body, const CancellationToken& cancel );
+
 			//! Number of worker threads in the pool.
 			unsigned int NumWorkers() const { return static_cast<unsigned int>( workers.size() ); }
 
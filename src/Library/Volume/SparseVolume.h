@@ -0,0 +1,400 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  SparseVolume.h - A 3D matrix of volume data stored as sparse
+//    8x8x8 bricks
+//
+//  Volume<T> keeps one dense array, so a mostly-empty smoke or cloud
+//  asset costs its full bounding box in memory and is capped at
+//  2 GiB.  SparseVolume<T> splits the grid into 8^3 bricks and only
+//  keeps the bricks that hold a non-zero voxel: a table points every
+//  brick at its voxels (or at nothing, when empty), and each brick
+//  records the min and max of its voxels so majorant grids can be
+//  built without touching voxel data.
+//
+//  Voxels inside a brick are stored in Morton (Z-order) order, so the
+//  2x2x2 stencil of a trilinear lookup usually lands in one or two
+//  cache lines.  The resident bricks of each 8-slice slab share one
+//  block, in Morton order of their brick x and y, so neighbouring
+//  bricks of a slab are near in memory.
+//
+//  Slices are loaded in parallel, one slab per task: a task reads its
+//  slab densely, counts its non-empty bricks, and copies them into a
+//  block of exactly that size, which the volume then keeps as it is.
+//  Nothing is assembled or copied afterwards, so peak memory is the
+//  resident bricks plus one dense slab per worker.
+//
+//  Values, coordinates and the [0,1] normalisation match Volume<T>
+//  exactly, so it can stand in for a dense volume anywhere.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//  Comments:
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#ifndef SPARSE_VOLUME_
+#define SPARSE_VOLUME_
+
+#include "../Interfaces/IBrickedVolume.h"
+#include "../Interfaces/ILog.h"
+#include "../Utilities/Reference.h"
+#include "../Utilities/MediaPathLocator.h"
+#include "../Utilities/ThreadPool.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace RISE
+{
+	template <class T>
+	class SparseVolume :
+		public virtual IBrickedVolume,
+		public virtual Implementation::Reference
+	{
+	public:
+		enum : unsigned int
+		{
+			kBrickShift = 3,
+			kBrickEdge = 1u << kBrickShift,
+			kBrickMask = kBrickEdge - 1,
+			kBrickVoxels = kBrickEdge*kBrickEdge*kBrickEdge,
+			kMaxBricks = 0xFFFFFFFFu			///< brick indices are unsigned ints
+		};
+
+	protected:
+		unsigned int	m_nWidth;
+		unsigned int	m_nHeight;
+		unsigned int	m_nDepth;
+
+		int				m_nWidthOV2;
+		int				m_nHeightOV2;
+		int				m_nDepthOV2;
+
+		unsigned int	m_nBricksX;
+		unsigned int	m_nBricksY;
+		unsigned int	m_nBricksZ;
+
+		std::vector<const T*>		m_brickData;	///< Per brick, its kBrickVoxels voxels, or null if empty
+		std::vector<T>				m_brickMin;		///< Per brick voxel minimum
+		std::vector<T>				m_brickMax;		///< Per brick voxel maximum
+		std::vector< std::vector<T> >	m_slabBricks;	///< Per slab, its resident bricks
+		unsigned int				m_nResident;
+
+		Scalar			m_OVMaxValue;
+
+		virtual ~SparseVolume( )
+		{
+		}
+
+		//! Spreads the low 3 bits of v to bits 0, 3 and 6
+		static inline unsigned int Spread3( const unsigned int v )
+		{
+			return (v & 1) | ((v & 2) << 2) | ((v & 4) << 4);
+		}
+
+		//! Morton index of a voxel inside its brick
+		static inline unsigned int LocalIndex( const unsigned int lx, const unsigned int ly, const unsigned int lz )
+		{
+			return Spread3( lx ) | (Spread3( ly ) << 1) | (Spread3( lz ) << 2);
+		}
+
+		//! Morton key of a brick's x and y, for the order within a slab
+		static inline unsigned long long BrickKey( unsigned int bx, unsigned int by )
+		{
+			unsigned long long key = 0;
+			for( unsigned int bit=0; bit<32; bit++ ) {
+				key |= (unsigned long long)((bx >> bit) & 1) << (2*bit);
+				key |= (unsigned long long)((by >> bit) & 1) << (2*bit+1);
+			}
+			return key;
+		}
+
+		inline unsigned int BrickIndex( const unsigned int bx, const unsigned int by, const unsigned int bz ) const
+		{
+			return (bz*m_nBricksY + by)*m_nBricksX + bx;
+		}
+
+		//! Voxel at 0-based indices that are known to be in range
+		inline T Voxel( const unsigned int ax, const unsigned int ay, const unsigned int az ) const
+		{
+			const T* b = m_brickData[ BrickIndex( ax>>kBrickShift, ay>>kBrickShift, az>>kBrickShift ) ];
+			if( !b ) {
+				return T(0);
+			}
+			return b[ LocalIndex( ax&kBrickMask, ay&kBrickMask, az&kBrickMask ) ];
+		}
+
+		void MakeEmpty()
+		{
+			m_nWidth = m_nHeight = m_nDepth = 0;
+			m_nWidthOV2 = m_nHeightOV2 = m_nDepthOV2 = 0;
+			m_nBricksX = m_nBricksY = m_nBricksZ = 0;
+		}
+
+	public:
+		SparseVolume(
+			const char * szFilePattern,
+			unsigned int width,
+			unsigned int height,
+			unsigned int zstart,
+			unsigned int zend
+			) :
+		m_nWidth( width ),
+		m_nHeight( height ),
+		m_nDepth( zend >= zstart ? zend-zstart+1 : 0 ),
+		m_nWidthOV2( 0 ),
+		m_nHeightOV2( 0 ),
+		m_nDepthOV2( 0 ),
+		m_nBricksX( 0 ),
+		m_nBricksY( 0 ),
+		m_nBricksZ( 0 ),
+		m_nResident( 0 )
+		{
+			m_OVMaxValue = 1.0 / ( Scalar( 1 << (sizeof( T )*8) ) - 1.0 );
+
+			// Coordinates are centered signed ints, so every axis must
+			// fit a positive int; the brick table is indexed with
+			// unsigned ints.  There is no cap on the dense size -- only
+			// resident bricks are stored.
+			const unsigned long long kMaxAxis = 0x7fffffffULL;
+			const unsigned long long depth64 = zend >= zstart ? (unsigned long long)zend - zstart + 1ULL : 0ULL;
+			if( width == 0 || height == 0 || depth64 == 0 ||
+				width > kMaxAxis || height > kMaxAxis || depth64 > kMaxAxis ) {
+				GlobalLog()->PrintEx( eLog_Error,
+					"SparseVolume:: Invalid volume dimensions %ux%ux(z %u..%u) (empty volume)",
+					width, height, zstart, zend );
+				MakeEmpty();
+				return;
+			}
+
+			const unsigned long long bx = ((unsigned long long)width + kBrickMask) >> kBrickShift;
+			const unsigned long long by = ((unsigned long long)height + kBrickMask) >> kBrickShift;
+			const unsigned long long bz = (depth64 + kBrickMask) >> kBrickShift;
+			if( bx*by*bz >= kMaxBricks ) {
+				GlobalLog()->PrintEx( eLog_Error,
+					"SparseVolume:: Too many bricks for %ux%ux(z %u..%u) (empty volume)",
+					width, height, zstart, zend );
+				MakeEmpty();
+				return;
+			}
+
+			m_nBricksX = (unsigned int)bx;
+			m_nBricksY = (unsigned int)by;
+			m_nBricksZ = (unsigned int)bz;
+
+			const unsigned int nBricks = m_nBricksX*m_nBricksY*m_nBricksZ;
+			m_brickData.assign( nBricks, (const T*)0 );
+			m_brickMin.assign( nBricks, T(0) );
+			m_brickMax.assign( nBricks, T(0) );
+			m_slabBricks.resize( m_nBricksZ );
+
+			// Every slab visits its bricks in the same Morton order of x, y
+			std::vector< std::pair<unsigned long long, unsigned int> > order( m_nBricksX*m_nBricksY );
+			for( unsigned int by_=0; by_<m_nBricksY; by_++ ) {
+				for( unsigned int bx_=0; bx_<m_nBricksX; bx_++ ) {
+					order[by_*m_nBricksX + bx_] = std::make_pair( BrickKey( bx_, by_ ), by_*m_nBricksX + bx_ );
+				}
+			}
+			std::sort( order.begin(), order.end() );
+
+			const size_t sliceVoxels = size_t(width) * size_t(height);
+
+			Implementation::GlobalThreadPool().ParallelFor( m_nBricksZ, [&]( unsigned int slab )
+			{
+				// Missing or short slices stay zero, as in Volume<T>
+				std::vector<T> dense( sliceVoxels * kBrickEdge, T(0) );
+
+				const unsigned int z0 = slab << kBrickShift;
+				for( unsigned int dz=0; dz<kBrickEdge && z0+dz<m_nDepth; dz++ )
+				{
+					static const int MAX_BUFFER_SIZE = 1024;
+					char buffer[MAX_BUFFER_SIZE] = {0};
+
+					snprintf( buffer, MAX_BUFFER_SIZE, szFilePattern, zstart+z0+dz );
+					FILE* f = fopen( GlobalMediaPathLocator().Find(buffer).c_str(), "rb" );
+
+					if( f ) {
+						const size_t got = fread( &dense[dz*sliceVoxels], sizeof( T ), sliceVoxels, f );
+						fclose( f );
+						if( got < sliceVoxels ) {
+							GlobalLog()->PrintEx( eLog_Error,
+								"SparseVolume:: Short read on slice `%s`: got %u of %u voxels (remainder zeroed)",
+								buffer, static_cast<unsigned>(got), static_cast<unsigned>(sliceVoxels) );
+						}
+					} else {
+						GlobalLog()->PrintEx( eLog_Error,
+							"SparseVolume:: Failed to open slice file `%s` (slice zeroed)", buffer );
+					}
+				}
+
+				// Padding past the volume edge reads as zero, like GetValue
+				auto denseAt = [&]( const unsigned int bx_, const unsigned int by_, const unsigned int lx, const unsigned int ly, const unsigned int lz ) -> T
+				{
+					const unsigned int ax = (bx_<<kBrickShift) + lx;
+					const unsigned int ay = (by_<<kBrickShift) + ly;
+					return (ax < m_nWidth && ay < m_nHeight) ? dense[ lz*sliceVoxels + size_t(ay)*m_nWidth + ax ] : T(0);
+				};
+
+				// First the bounds of every brick, to size the slab's block exactly
+				unsigned int resident = 0;
+				for( size_t o=0; o<order.size(); o++ ) {
+					const unsigned int bx_ = order[o].second % m_nBricksX;
+					const unsigned int by_ = order[o].second / m_nBricksX;
+					T lo = T(0), hi = T(0);
+					bool first = true;
+					for( unsigned int lz=0; lz<kBrickEdge; lz++ ) {
+						for( unsigned int ly=0; ly<kBrickEdge; ly++ ) {
+							for( unsigned int lx=0; lx<kBrickEdge; lx++ ) {
+								const T v = denseAt( bx_, by_, lx, ly, lz );
+								if( first ) { lo = hi = v; first = false; }
+								else { lo = std::min( lo, v ); hi = std::max( hi, v ); }
+							}
+						}
+					}
+
+					const unsigned int idx = BrickIndex( bx_, by_, slab );
+					m_brickMin[idx] = lo;
+					m_brickMax[idx] = hi;
+					if( hi != T(0) ) {
+						resident++;
+					}
+				}
+
+				// Then the non-empty bricks, straight into the block the
+				// volume keeps
+				std::vector<T>& block = m_slabBricks[slab];
+				block.resize( size_t(resident) * kBrickVoxels );
+				T* brick = resident ? &block[0] : 0;
+				for( size_t o=0; o<order.size(); o++ ) {
+					const unsigned int bx_ = order[o].second % m_nBricksX;
+					const unsigned int by_ = order[o].second / m_nBricksX;
+					const unsigned int idx = BrickIndex( bx_, by_, slab );
+					if( m_brickMax[idx] == T(0) ) {
+						continue;
+					}
+
+					for( unsigned int lz=0; lz<kBrickEdge; lz++ ) {
+						for( unsigned int ly=0; ly<kBrickEdge; ly++ ) {
+							for( unsigned int lx=0; lx<kBrickEdge; lx++ ) {
+								brick[ LocalIndex( lx, ly, lz ) ] = denseAt( bx_, by_, lx, ly, lz );
+							}
+						}
+					}
+					m_brickData[idx] = brick;
+					brick += kBrickVoxels;
+				}
+			} );
+
+			for( unsigned int slab=0; slab<m_nBricksZ; slab++ ) {
+				m_nResident += static_cast<unsigned int>( m_slabBricks[slab].size() / kBrickVoxels );
+			}
+
+			m_nWidthOV2 = int(m_nWidth>>1);
+			m_nHeightOV2 = int(m_nHeight>>1);
+			m_nDepthOV2 = int(m_nDepth>>1);
+
+			GlobalLog()->PrintEx( eLog_Info,
+				"SparseVolume:: %ux%ux%u voxels, %u of %u bricks resident",
+				m_nWidth, m_nHeight, m_nDepth, ResidentBricks(), nBricks );
+		}
+
+		unsigned int Width( ) const
+		{
+			return m_nWidth;
+		}
+
+		unsigned int Height( ) const
+		{
+			return m_nHeight;
+		}
+
+		unsigned int Depth( ) const
+		{
+			return m_nDepth;
+		}
+
+		//! Number of non-empty bricks held in memory
+		unsigned int ResidentBricks( ) const
+		{
+			return m_nResident;
+		}
+
+		Scalar GetValue( const int x, const int y, const int z ) const
+		{
+			// Volumes are centered at the middle
+			const int az = z + m_nDepthOV2;
+			const int ay = y + m_nHeightOV2;
+			const int ax = x + m_nWidthOV2;
+
+			if( az >= int(m_nDepth) || ay >= int(m_nHeight) || ax >= int(m_nWidth) ||
+				az < 0 || ay < 0 || ax < 0 ) {
+				return 0;
+			}
+
+			return Scalar( Voxel( ax, ay, az ) ) * m_OVMaxValue;
+		}
+
+		void GetCellValues( const int x, const int y, const int z, Scalar values[8] ) const
+		{
+			const int ax = x + m_nWidthOV2;
+			const int ay = y + m_nHeightOV2;
+			const int az = z + m_nDepthOV2;
+
+			// Fast path: the whole cell is inside the volume and inside one
+			// brick, so the brick is resolved once
+			if( ax >= 0 && ay >= 0 && az >= 0 &&
+				ax+1 < int(m_nWidth) && ay+1 < int(m_nHeight) && az+1 < int(m_nDepth) &&
+				(ax & kBrickMask) != kBrickMask && (ay & kBrickMask) != kBrickMask && (az & kBrickMask) != kBrickMask )
+			{
+				const T* b = m_brickData[ BrickIndex( ax>>kBrickShift, ay>>kBrickShift, az>>kBrickShift ) ];
+				if( !b ) {
+					for( int i=0; i<8; i++ ) {
+						values[i] = 0;
+					}
+					return;
+				}
+
+				const unsigned int lx = ax & kBrickMask, ly = ay & kBrickMask, lz = az & kBrickMask;
+				values[0] = Scalar( b[ LocalIndex( lx,   ly,   lz   ) ] ) * m_OVMaxValue;
+				values[1] = Scalar( b[ LocalIndex( lx+1, ly,   lz   ) ] ) * m_OVMaxValue;
+				values[2] = Scalar( b[ LocalIndex( lx,   ly+1, lz   ) ] ) * m_OVMaxValue;
+				values[3] = Scalar( b[ LocalIndex( lx+1, ly+1, lz   ) ] ) * m_OVMaxValue;
+				values[4] = Scalar( b[ LocalIndex( lx,   ly,   lz+1 ) ] ) * m_OVMaxValue;
+				values[5] = Scalar( b[ LocalIndex( lx+1, ly,   lz+1 ) ] ) * m_OVMaxValue;
+				values[6] = Scalar( b[ LocalIndex( lx,   ly+1, lz+1 ) ] ) * m_OVMaxValue;
+				values[7] = Scalar( b[ LocalIndex( lx+1, ly+1, lz+1 ) ] ) * m_OVMaxValue;
+				return;
+			}
+
+			values[0] = GetValue( x,   y,   z   );
+			values[1] = GetValue( x+1, y,   z   );
+			values[2] = GetValue( x,   y+1, z   );
+			values[3] = GetValue( x+1, y+1, z   );
+			values[4] = GetValue( x,   y,   z+1 );
+			values[5] = GetValue( x+1, y,   z+1 );
+			values[6] = GetValue( x,   y+1, z+1 );
+			values[7] = GetValue( x+1, y+1, z+1 );
+		}
+
+		unsigned int BrickEdge( ) const { return kBrickEdge; }
+		unsigned int BricksX( ) const { return m_nBricksX; }
+		unsigned int BricksY( ) const { return m_nBricksY; }
+		unsigned int BricksZ( ) const { return m_nBricksZ; }
+
+		Scalar BrickMaxValue( const unsigned int bx, const unsigned int by, const unsigned int bz ) const
+		{
+			return Scalar( m_brickMax[ BrickIndex( bx, by, bz ) ] ) * m_OVMaxValue;
+		}
+
+		Scalar BrickMinValue( const unsigned int bx, const unsigned int by, const unsigned int bz ) const
+		{
+			return Scalar( m_brickMin[ BrickIndex( bx, by, bz ) ] ) * m_OVMaxValue;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,101 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  VolumeAccessor_BrickedTRI.h - Trilinear interpolator that fetches
+//    its 2x2x2 stencil through IBrickedVolume::GetCellValues
+//
+//  Same arithmetic as VolumeAccessor_TRI, so the result is bit
+//  identical; the only difference is that a bricked volume resolves
+//  the brick once per lookup instead of eight times.  Bound to a
+//  volume that is not bricked it falls back to plain GetValue reads.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//  Comments:
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#ifndef _VolumeAccessor_BrickedTRI
+#define _VolumeAccessor_BrickedTRI
+
+#include "VolumeAccessorHelper.h"
+#include "../Interfaces/IBrickedVolume.h"
+
+#include <math.h>
+
+namespace RISE
+{
+	class VolumeAccessor_BrickedTRI :
+		public virtual VolumeAccessorHelper
+	{
+	protected:
+		const IBrickedVolume*	pBricks;
+
+		virtual ~VolumeAccessor_BrickedTRI( ){}
+
+	public:
+		VolumeAccessor_BrickedTRI( ) : pBricks( 0 ) {};
+
+		void BindVolume( const IVolume* pVol )
+		{
+			VolumeAccessorHelper::BindVolume( pVol );
+			pBricks = dynamic_cast<const IBrickedVolume*>( pVolume );
+		}
+
+		Scalar GetValue( Scalar x, Scalar y, Scalar z )const
+		{
+			const Scalar ulo = floor( x );
+			const Scalar vlo = floor( y );
+			const Scalar wlo = floor( z );
+
+			Scalar	ut = x - ulo;
+			Scalar	vt = y - vlo;
+			Scalar	wt = z - wlo;
+
+			const int xlo = int(ulo);
+			const int ylo = int(vlo);
+			const int zlo = int(wlo);
+
+			// Stencil order matches IBrickedVolume::GetCellValues
+			Scalar v[8];
+			if( pBricks ) {
+				pBricks->GetCellValues( xlo, ylo, zlo, v );
+			} else {
+				v[0] = pVolume->GetValue( xlo,   ylo,   zlo   );
+				v[1] = pVolume->GetValue( xlo+1, ylo,   zlo   );
+				v[2] = pVolume->GetValue( xlo,   ylo+1, zlo   );
+				v[3] = pVolume->GetValue( xlo+1, ylo+1, zlo   );
+				v[4] = pVolume->GetValue( xlo,   ylo,   zlo+1 );
+				v[5] = pVolume->GetValue( xlo+1, ylo,   zlo+1 );
+				v[6] = pVolume->GetValue( xlo,   ylo+1, zlo+1 );
+				v[7] = pVolume->GetValue( xlo+1, ylo+1, zlo+1 );
+			}
+
+			Scalar	omut = 1.0 - ut;
+			Scalar	omvt = 1.0 - vt;
+			Scalar	omwt = 1.0 - wt;
+
+			// Keep the term order of VolumeAccessor_TRI so results match bit for bit
+			Scalar front = (v[0] * (omut * omvt)
+				+ v[2] * (omut * vt)
+				+ v[1] * (ut * omvt)
+				+ v[3] * (ut * vt));
+
+			Scalar back = (v[4] * (omut * omvt)
+				+ v[6] * (omut * vt)
+				+ v[5] * (ut * omvt)
+				+ v[7] * (ut * vt));
+
+			return (front * omwt + back * wt);
+		}
+
+		Scalar GetValue( int x, int y, int z )const
+		{
+			return GetValue( (Scalar)x, (Scalar)y, (Scalar)z );
+		}
+	};
+}
+
+#endif
@@ -31,6 +31,8 @@
 #include "../Utilities/Reference.h"
 #include "../Utilities/Color/ColorMath.h"
 #include "../Intersection/RayIntersectionGeometric.h"
+#include "../Painters/PainterProgram.h"
+#include <vector>
 #include <math.h>
 
 namespace RISE
@@ -52,6 +54,7 @@ namespace RISE
 		Point3				m_bboxMin;			///< World-space AABB minimum
 		Vector3				m_extent;			///< World-space AABB extent (max - min)
 		char				m_colorToScalar;	///< Conversion mode: 'l', 'm', or 'r'
+		Implementation::PainterProgram	m_program;	///< m_pPainter compiled for GetValueRow
 
 		virtual ~VolumeAccessor_Painter()
 		{
@@ -119,6 +122,9 @@ namespace RISE
 		  m_colorToScalar( colorToScalar )
 		{
 			m_pPainter->addref();
+
+			Implementation::PainterCompiler compiler;
+			compiler.Compile( *m_pPainter, m_program );
 		}
 
 		Scalar GetValue( Scalar x, Scalar y, Scalar z ) const
@@ -143,6 +149,30 @@ namespace RISE
 			return GetValue( Scalar(x), Scalar(y), Scalar(z) );
 		}
 
+		/// Batched row fetch used by MajorantGrid construction, which
+		/// visits every voxel.  The whole row is shaded in one batch by
+		/// the painter program compiled when the accessor was made; the
+		/// majorant grid is built once, when the medium is, so it never
+		/// sees later painter edits either way.  Per-sample lookups
+		/// during rendering still go through GetValue.
+		void GetValueRow( int x, int y, int z, unsigned int count, Scalar* values ) const
+		{
+			const Ray dummyRay( Point3( 0, 0, 0 ), Vector3( 0, 1, 0 ) );
+			std::vector<RayIntersectionGeometric> hits( count, RayIntersectionGeometric( dummyRay, nullRasterizerState ) );
+			for( unsigned int i = 0; i < count; i++ ) {
+				const Point3 worldPt = CenteredToWorld( Scalar(x + int(i)), Scalar(y), Scalar(z) );
+				hits[i].ray = Ray( worldPt, Vector3( 0, 1, 0 ) );
+				hits[i].ptIntersection = worldPt;
+				hits[i].ptObjIntersec = worldPt;
+			}
+
+			std::vector<RISEPel> colors( count );
+			m_program.EvaluateBatch( count ? &hits[0] : 0, count, count ? &colors[0] : 0 );
+			for( unsigned int i = 0; i < count; i++ ) {
+				values[i] = ColorToScalar( colors[i] );
+			}
+		}
+
 		void BindVolume( const IVolume* )
 		{
 			// No-op: this accessor does not use a discrete volume
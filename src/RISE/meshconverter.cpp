@@ -1,6 +1,6 @@
 //////////////////////////////////////////////////////////////////////
 //
-//  meshconverter.cpp - Converts an input mesh (.3ds or .ply) into a
+//  meshconverter.cpp - Converts an input mesh (.3ds, .ply or RAW2) into a
 //    .risemesh file with a baked BVH cache.
 //
 //  Author: Aravind Krishnaswamy
@@ -13,13 +13,15 @@
 //  Tier A2/A3 sweep (2026-04-27): the legacy bsp/maxpolys/maxdepth CLI
 //  arguments are gone — BVH is the sole acceleration structure and its
 //  parameters are not user-tunable from this tool.  Today's CLI:
-//      meshconverter <in.3ds|in.ply> <out.risemesh> <invert_faces 0|1> <face_normals 0|1>
+//      meshconverter <in.3ds|in.ply|in.rawmesh2> <out.risemesh> <invert_faces 0|1> <face_normals 0|1>
 //
 //////////////////////////////////////////////////////////////////////
 
 #include <iostream>
+#include <string>
 #include "../Library/RISE_API.h"
 #include <string.h>
+#include <ctype.h>
 
 using namespace RISE;
 
@@ -34,43 +36,48 @@ int main( int argc, char** argv )
 	const bool bInvertFaces = !!atoi( argv[3] );
 	const bool bFaceNormals = !!atoi( argv[4] );
 
-	// Try and load the input mesh file (assume 3DS mesh for now)
 	IMemoryBuffer*				pReadBuffer = 0;
 	ITriangleMeshLoaderIndexed*	loader = 0;
 
 	// Figure out what loader to use, depending on the extension of the file
-	char* three_letter_extension = &((argv[1])[strlen(argv[1])-4]);
-#ifdef strlwr
-	if( strcmp( strlwr(three_letter_extension), ".3ds" ) == 0 ) {
-#else
-	if( strcmp( three_letter_extension, ".3ds" ) == 0 ) {
-#endif
+	const char* dot = strrchr( argv[1], '.' );
+	std::string extension = dot ? dot : "";
+	for( size_t i = 0; i < extension.size(); i++ ) {
+		extension[i] = (char)tolower( (unsigned char)extension[i] );
+	}
+
+	if( extension == ".3ds" ) {
 		std::cout << "Using 3DS mesh loader" << std::endl;
 		RISE_API_CreateMemoryBufferFromFile( &pReadBuffer, argv[1] );
 		RISE_API_Create3DSTriangleMeshLoader( &loader, pReadBuffer );
-#ifdef strlwr
-	} else if( strcmp( strlwr(three_letter_extension), ".ply" ) == 0 ) {
-#else
-	} else if( strcmp( three_letter_extension, ".ply" ) == 0 ) {
-#endif
+	} else if( extension == ".ply" ) {
 		std::cout << "Using PLY mesh loader" << std::endl;
 		RISE_API_CreatePLYTriangleMeshLoader( &loader, argv[1], bInvertFaces );
+	} else if( extension == ".rawmesh2" || extension == ".raw2" ) {
+		std::cout << "Using RAW2 mesh loader" << std::endl;
+		RISE_API_CreateRAW2TriangleMeshLoader( &loader, argv[1] );
 	} else {
-		std::cout << "Unknown extension: " << three_letter_extension << " on file, must be either .3ds or .ply" << std::endl;
-		if( pReadBuffer ) {
-			pReadBuffer->release();
-		}
+		std::cout << "Unknown extension: " << extension << " on file, must be one of .3ds, .ply, .rawmesh2 or .raw2" << std::endl;
 		return 1;
 	}
 
 	ITriangleMeshGeometryIndexed*		geom = 0;
 	RISE_API_CreateTriangleMeshGeometryIndexed( &geom, /*double_sided=*/false, bFaceNormals );
 
-	loader->LoadTriangleMesh( geom );
+	// Loading finishes by building the BVH, which Serialize writes out with
+	// the mesh so a .risemesh loads without rebuilding it
+	const bool bLoaded = loader->LoadTriangleMesh( geom );
 
 	if( pReadBuffer ) {
 		pReadBuffer->release();
 	}
+	loader->release();
+
+	if( !bLoaded ) {
+		std::cout << "Failed to load: " << argv[1] << std::endl;
+		geom->release();
+		return 1;
+	}
 
 	// Then dump the geometry out
 	IWriteBuffer*		pBuffer = 0;
@@ -78,8 +85,5 @@ int main( int argc, char** argv )
 	geom->Serialize( *pBuffer );
 	pBuffer->release();
 	geom->release();
-	if( loader ) {
-		loader->release();
-	}
 	return 0;
 }
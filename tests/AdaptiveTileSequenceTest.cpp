@@ -0,0 +1,191 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  AdaptiveTileSequenceTest.cpp - Tests for the adaptive pass tile
+//  order
+//
+//  TileRemainingError must be 0 exactly when IsTileDone is true and
+//  must grow with the relative error of the unfinished pixels.
+//  AdaptiveTileSequence must hand out only the unfinished tiles,
+//  largest error first with Morton order between ties, and none once
+//  every pixel is done.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <vector>
+
+#include "../src/Library/Rendering/AdaptiveTileSequence.h"
+
+using namespace RISE;
+using namespace RISE::Implementation;
+
+static int passCount = 0;
+static int failCount = 0;
+
+static void Check( bool cond, const char* name )
+{
+	if( cond ) { ++passCount; }
+	else { ++failCount; std::cout << "  FAIL: " << name << std::endl; }
+}
+
+static const unsigned int kTarget = 64;
+
+// Gives a pixel Welford state with the given mean and relative error
+static void SetStats( ProgressivePixel& px, const Scalar mean, const Scalar relError, const unsigned int n )
+{
+	const Scalar stdErr = relError * mean;
+	px.wN = n;
+	px.wMean = mean;
+	px.wM2 = stdErr * stdErr * Scalar( n ) * Scalar( n - 1 );
+	px.sampleIndex = n;
+}
+
+static void MarkDone( ProgressiveFilm& film, const Rect& rect )
+{
+	for( unsigned int y = rect.top; y <= rect.bottom; y++ ) {
+		for( unsigned int x = rect.left; x <= rect.right; x++ ) {
+			film.Get( x, y ).converged = true;
+		}
+	}
+}
+
+static std::vector<Rect> Drain( IRasterizeSequence& seq, const unsigned int w, const unsigned int h )
+{
+	std::vector<Rect> out;
+	seq.Begin( 0, w-1, 0, h-1 );
+	const unsigned int n = seq.NumRegions();
+	for( unsigned int i = 0; i < n; i++ ) {
+		out.push_back( seq.GetNextRegion() );
+	}
+	seq.End();
+	return out;
+}
+
+static bool Same( const Rect& a, const Rect& b )
+{
+	return a.top == b.top && a.left == b.left && a.bottom == b.bottom && a.right == b.right;
+}
+
+static void TestRemainingError()
+{
+	std::cout << "Test: TileRemainingError" << std::endl;
+
+	ProgressiveFilm film( 4, 4 );
+	const Rect all( 0, 0, 3, 3 );
+	Check( film.TileRemainingError( all, kTarget ) == 16, "a fresh tile counts 1 per pixel" );
+	Check( !film.IsTileDone( all, kTarget ), "and is not done" );
+
+	for( unsigned int y = 0; y < 4; y++ ) {
+		for( unsigned int x = 0; x < 4; x++ ) {
+			SetStats( film.Get( x, y ), 0.5, 0.01, 16 );
+		}
+	}
+	const Scalar low = film.TileRemainingError( all, kTarget );
+	Check( std::fabs( low - 0.16 ) < 1e-9, "sums the relative standard errors" );
+
+	SetStats( film.Get( 2, 2 ), 0.5, 0.2, 16 );
+	Check( film.TileRemainingError( all, kTarget ) > low, "a noisier pixel raises it" );
+
+	SetStats( film.Get( 1, 1 ), 0.5, 50.0, 16 );
+	Check( film.TileRemainingError( Rect( 1, 1, 1, 1 ), kTarget ) == 1, "capped at 1 per pixel" );
+
+	SetStats( film.Get( 0, 0 ), 0.5, 0.0, 16 );
+	Check( film.TileRemainingError( Rect( 0, 0, 0, 0 ), kTarget ) > 0, "an unfinished zero-variance pixel still counts" );
+
+	film.Get( 3, 3 ).sampleIndex = kTarget;
+	Check( film.TileRemainingError( Rect( 3, 3, 3, 3 ), kTarget ) == 0, "a pixel at the budget counts 0" );
+
+	MarkDone( film, all );
+	Check( film.TileRemainingError( all, kTarget ) == 0 && film.IsTileDone( all, kTarget ), "0 exactly when done" );
+}
+
+static void TestOrdering()
+{
+	std::cout << "Test: tile order" << std::endl;
+
+	const unsigned int W = 32, H = 32, T = 8;
+	ProgressiveFilm film( W, H );
+
+	MortonRasterizeSequence* morton = new MortonRasterizeSequence( T );
+	const std::vector<Rect> mortonTiles = Drain( *morton, W, H );
+	morton->release();
+
+	// All tiles fresh: every score ties, so the order must be Morton
+	AdaptiveTileSequence* seq = new AdaptiveTileSequence( T, film, kTarget );
+	std::vector<Rect> tiles = Drain( *seq, W, H );
+	bool sameOrder = tiles.size() == mortonTiles.size();
+	for( size_t i = 0; sameOrder && i < tiles.size(); i++ ) {
+		if( !Same( tiles[i], mortonTiles[i] ) ) sameOrder = false;
+	}
+	Check( sameOrder, "ties keep Morton order" );
+
+	// Converge everything except three tiles with different errors
+	MarkDone( film, Rect( 0, 0, H-1, W-1 ) );
+	const Rect quiet( 0, 0, 7, 7 ), noisy( 24, 24, 31, 31 ), mid( 8, 16, 15, 23 );
+	for( unsigned int y = 0; y < T; y++ ) {
+		for( unsigned int x = 0; x < T; x++ ) {
+			ProgressivePixel& a = film.Get( quiet.left+x, quiet.top+y );
+			ProgressivePixel& b = film.Get( noisy.left+x, noisy.top+y );
+			ProgressivePixel& c = film.Get( mid.left+x, mid.top+y );
+			a.converged = b.converged = c.converged = false;
+			SetStats( a, 1.0, 0.01, 8 );
+			SetStats( b, 1.0, 0.30, 8 );
+			SetStats( c, 1.0, 0.10, 8 );
+		}
+	}
+
+	Check( seq->Rank( 0, W-1, 0, H-1 ) == 3, "only unfinished tiles are kept" );
+	Check( seq->RemainingError() > 0, "remaining error reported" );
+	tiles = Drain( *seq, W, H );
+	Check( tiles.size() == 3, "Begin reuses the ranking" );
+	Check( tiles.size() == 3 && Same( tiles[0], noisy ) && Same( tiles[1], mid ) && Same( tiles[2], quiet ),
+		"largest error first" );
+
+	// A partly finished tile is still handed out
+	MarkDone( film, noisy );
+	MarkDone( film, mid );
+	film.Get( quiet.left, quiet.top ).converged = true;
+	tiles = Drain( *seq, W, H );
+	Check( tiles.size() == 1 && Same( tiles[0], quiet ), "a partly done tile stays" );
+
+	MarkDone( film, quiet );
+	Check( seq->Rank( 0, W-1, 0, H-1 ) == 0 && seq->NumRegions() == 0, "nothing left once all converged" );
+	Check( seq->RemainingError() == 0, "and no error left" );
+
+	seq->release();
+}
+
+static void TestSubRegion()
+{
+	std::cout << "Test: render region" << std::endl;
+
+	ProgressiveFilm film( 20, 20 );
+	AdaptiveTileSequence* seq = new AdaptiveTileSequence( 8, film, kTarget );
+
+	// A 10x6 region cut into 8-wide tiles gives 2 tiles, both unfinished
+	Check( seq->Rank( 5, 14, 3, 8 ) == 2, "tiles cover only the region" );
+	MarkDone( film, Rect( 3, 5, 8, 12 ) );
+	Check( seq->Rank( 5, 14, 3, 8 ) == 1, "the finished one is dropped" );
+	const Rect r = seq->GetNextRegion();
+	Check( r.left == 13 && r.right == 14 && r.top == 3 && r.bottom == 8, "the clipped remainder is kept" );
+
+	seq->release();
+}
+
+int main()
+{
+	std::cout << "=== Adaptive Tile Sequence Tests ===" << std::endl;
+
+	TestRemainingError();
+	TestOrdering();
+	TestSubRegion();
+
+	std::cout << std::endl << "Passed: " << passCount << "  Failed: " << failCount << std::endl;
+	return failCount > 0 ? 1 : 0;
+}
@@ -0,0 +1,294 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  AnalyticLeafFilterTest.cpp - Tests for the BVH analytic leaf
+//  filter
+//
+//  The float four-wide analytic kernel must never drop a primitive the
+//  ray hits, must report a distance no farther than the real hit, and
+//  must drop the ones the ray clearly misses.  A TLAS over a crowd of
+//  spheres, boxes, cylinders, ellipsoids and tori under uniform,
+//  non-uniform, rotated and mirrored transforms must then answer every
+//  closest-hit and shadow query exactly as a linear walk does.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "../src/Library/Utilities/Math3D/Math3D.h"
+#include "../src/Library/Utilities/Ray.h"
+#include "../src/Library/Utilities/RandomNumbers.h"
+#include "../src/Library/Intersection/RayIntersection.h"
+#include "../src/Library/Geometry/SphereGeometry.h"
+#include "../src/Library/Geometry/BoxGeometry.h"
+#include "../src/Library/Geometry/CylinderGeometry.h"
+#include "../src/Library/Geometry/EllipsoidGeometry.h"
+#include "../src/Library/Geometry/TorusGeometry.h"
+#include "../src/Library/Objects/Object.h"
+#include "../src/Library/Managers/ObjectManager.h"
+#include "../src/Library/Acceleration/BVH.h"
+
+using namespace RISE;
+using namespace RISE::Implementation;
+
+typedef BVH<const IObjectPriv*> ObjectBVH;
+
+static int passCount = 0;
+static int failCount = 0;
+
+static void Check( bool cond, const char* name )
+{
+	if( cond ) { ++passCount; }
+	else { ++failCount; std::cout << "  FAIL: " << name << std::endl; }
+}
+
+static Object* Place( const IGeometry* pGeo, const Matrix4& mx )
+{
+	Object* pObj = new Object( pGeo );
+	pObj->PushTopTransStack( mx );
+	pObj->FinalizeTransformations();
+	return pObj;
+}
+
+static void TestKernel()
+{
+	std::cout << "Test: four-wide kernel" << std::endl;
+
+	// Four unit spheres along x, the third squashed and the fourth a box
+	SphereGeometry* pSphere = new SphereGeometry( 1.0 );
+	BoxGeometry* pBox = new BoxGeometry( 2, 2, 2 );
+	const Matrix4 mx[4] = {
+		Matrix4Ops::Translation( Vector3( 0, 0, 0 ) ),
+		Matrix4Ops::Translation( Vector3( 3, 0, 0 ) ),
+		Matrix4Ops::Translation( Vector3( 6, 0, 0 ) ) * Matrix4Ops::Stretch( Vector3( 1, 0.25, 1 ) ),
+		Matrix4Ops::Translation( Vector3( 9, 0, 0 ) ) };
+
+	ObjectBVH::AnalyticPacket pk;
+	memset( &pk, 0, sizeof( pk ) );
+	pk.count = 4;
+	std::vector<Object*> objs;
+	for( uint32_t lane = 0; lane < 4; lane++ ) {
+		objs.push_back( Place( lane == 3 ? (IGeometry*)pBox : (IGeometry*)pSphere, mx[lane] ) );
+		AnalyticShape shape;
+		Matrix4 inv;
+		objs[lane]->GetAnalyticShape( shape, inv );
+		ObjectBVH::FillAnalyticLane( pk, lane, shape, inv );
+	}
+
+	RandomNumberGenerator rng( 11 );
+	bool neverDropped = true, boundHolds = true;
+	unsigned int hits = 0, culled = 0, misses = 0;
+	for( unsigned int r = 0; r < 20000; r++ ) {
+		const Point3 o( -4 + 17 * rng.CanonicalRandom(), -3 + 6 * rng.CanonicalRandom(), -6 );
+		const Point3 t( -2 + 13 * rng.CanonicalRandom(), -1.5 + 3 * rng.CanonicalRandom(), 6 * rng.CanonicalRandom() - 3 );
+		const Ray ray( o, Vector3Ops::Normalize( Vector3Ops::mkVector3( t, o ) ) );
+
+		const float origin[3] = { (float)o.x, (float)o.y, (float)o.z };
+		const float dir[3] = { (float)ray.Dir().x, (float)ray.Dir().y, (float)ray.Dir().z };
+		float tNear[4];
+		const uint32_t mask = ObjectBVH::RayAnalytic4( origin, dir, FLT_MAX, pk, tNear );
+
+		for( uint32_t lane = 0; lane < 4; lane++ ) {
+			RayIntersection ri( ray, nullRasterizerState );
+			objs[lane]->IntersectRay( ri, RISE_INFINITY, true, true, false );
+			if( ri.geometric.bHit ) {
+				hits++;
+				if( !( mask & ( 1u << lane ) ) ) neverDropped = false;
+				else if( tNear[lane] > ri.geometric.range ) boundHolds = false;
+			} else {
+				misses++;
+				if( !( mask & ( 1u << lane ) ) ) culled++;
+			}
+		}
+	}
+	std::cout << "  " << hits << " hits, " << culled << " of " << misses << " misses culled" << std::endl;
+	Check( hits > 5000, "the rays hit the primitives" );
+	Check( neverDropped, "no hit primitive is dropped" );
+	Check( boundHolds, "tNear never passes the real hit" );
+	Check( culled > misses * 9 / 10, "most misses are culled" );
+
+	// A ray starting inside the first sphere still sees it, at t = 0
+	{
+		const float origin[3] = { 0.2f, 0, 0 }, dir[3] = { 0, 0, 1 };
+		float tNear[4];
+		const uint32_t mask = ObjectBVH::RayAnalytic4( origin, dir, FLT_MAX, pk, tNear );
+		Check( ( mask & 0xF ) == 1 && tNear[0] == 0.0f, "a ray from inside keeps its primitive" );
+	}
+
+	// Nothing behind the ray, nothing past the hit in hand
+	{
+		const float origin[3] = { 12, 0, 0 }, dir[3] = { 1, 0, 0 };
+		float tNear[4];
+		Check( ObjectBVH::RayAnalytic4( origin, dir, FLT_MAX, pk, tNear ) == 0, "primitives behind the ray are culled" );
+		const float back[3] = { -1, 0, 0 };
+		const uint32_t mask = ObjectBVH::RayAnalytic4( origin, back, 4.5f, pk, tNear );
+		Check( mask == 8 && tNear[3] <= 2.0f, "only the primitive before the hit in hand is kept" );
+	}
+
+	// A lane without a shape is always a candidate
+	pk.alwaysMask = 2;
+	{
+		const float origin[3] = { 0, 50, 0 }, dir[3] = { 0, 1, 0 };
+		float tNear[4];
+		Check( ObjectBVH::RayAnalytic4( origin, dir, FLT_MAX, pk, tNear ) == 2 && tNear[1] == 0.0f, "a lane without a shape is kept" );
+	}
+
+	for( size_t i = 0; i < objs.size(); i++ ) objs[i]->release();
+	pSphere->release();
+	pBox->release();
+}
+
+// A random rotation, stretch (possibly mirrored) and move
+static Matrix4 RandomPlacement( RandomNumberGenerator& rng, const Scalar spread )
+{
+	const Point3 at( spread * ( rng.CanonicalRandom() - 0.5 ), spread * ( rng.CanonicalRandom() - 0.5 ), spread * ( rng.CanonicalRandom() - 0.5 ) );
+	Vector3 stretch( 1, 1, 1 );
+	const Scalar kind = rng.CanonicalRandom();
+	if( kind < 0.3 ) {
+		const Scalar s = 0.5 + rng.CanonicalRandom();
+		stretch = Vector3( s, s, s );
+	} else if( kind < 0.8 ) {
+		stretch = Vector3( 0.3 + rng.CanonicalRandom(), 0.3 + rng.CanonicalRandom(), 0.3 + rng.CanonicalRandom() );
+	} else {
+		stretch = Vector3( -( 0.5 + rng.CanonicalRandom() ), 0.5 + rng.CanonicalRandom(), 1 );
+	}
+	return Matrix4Ops::Translation( Vector3( at.x, at.y, at.z ) ) *
+		Matrix4Ops::XRotation( TWO_PI * rng.CanonicalRandom() ) *
+		Matrix4Ops::YRotation( TWO_PI * rng.CanonicalRandom() ) *
+		Matrix4Ops::Stretch( stretch );
+}
+
+static void TestAgainstLinear()
+{
+	std::cout << "Test: TLAS with the filter against a linear walk" << std::endl;
+
+	std::vector<IGeometry*> geoms;
+	geoms.push_back( new SphereGeometry( 0.6 ) );
+	geoms.push_back( new BoxGeometry( 1.0, 0.4, 0.7 ) );
+	geoms.push_back( new CylinderGeometry( 'y', 0.3, 1.2, true ) );
+	geoms.push_back( new CylinderGeometry( 'x', 0.4, 0.8, false ) );
+	geoms.push_back( new EllipsoidGeometry( Vector3( 0.7, 0.3, 0.5 ) ) );
+	geoms.push_back( new TorusGeometry( 0.5, 0.15 ) );
+
+	ObjectManager* pFiltered = new ObjectManager( true, false, 4, 24 );
+	ObjectManager* pLinear = new ObjectManager( false, false, 4, 24 );
+
+	RandomNumberGenerator rng( 5 );
+	const Scalar spread = 12;
+	std::vector<const IObjectPriv*> elements;
+	for( unsigned int i = 0; i < 600; i++ ) {
+		Object* pObj = Place( geoms[i % geoms.size()], RandomPlacement( rng, spread ) );
+		char name[32];
+		sprintf( name, "o%u", i );
+		pFiltered->AddItem( pObj, name );
+		pLinear->AddItem( pObj, name );
+		elements.push_back( pObj );
+		pObj->release();
+	}
+
+	// A BVH over the same objects reports the filter is in use
+	{
+		AccelerationConfig cfg{};
+		cfg.maxLeafSize = 4;
+		cfg.binCount = 32;
+		cfg.sahTraversalCost = 1.0;
+		cfg.sahIntersectionCost = 8.0;
+		cfg.doubleSided = true;
+		BoundingBox box( Point3( RISE_INFINITY, RISE_INFINITY, RISE_INFINITY ), Point3( -RISE_INFINITY, -RISE_INFINITY, -RISE_INFINITY ) );
+		for( size_t i = 0; i < elements.size(); i++ ) box.Include( elements[i]->getBoundingBox() );
+		ObjectBVH* pBVH = new ObjectBVH( *pFiltered, elements, box, cfg );
+		std::cout << "  " << pBVH->numAnalyticPackets() << " packets" << std::endl;
+		Check( pBVH->AnalyticFilterEnabled() && pBVH->numAnalyticPackets() > 50, "the object BVH packs its leaves" );
+		pBVH->release();
+	}
+
+	pFiltered->PrepareForRendering();
+
+	unsigned int hits = 0;
+	bool hitsAgree = true, rangesAgree = true, shadowsAgree = true, exitsAgree = true;
+	for( unsigned int r = 0; r < 12000; r++ ) {
+		// Rays from outside, from within the crowd, and from far away.
+		// Not too far: past a few hundred units the torus's quartic
+		// starts reporting roots off its surface, which the filter
+		// rightly drops and the linear walk keeps.
+		Scalar reach = spread;
+		if( r % 3 == 1 ) reach = 0.5 * spread;
+		if( r % 3 == 2 ) reach = 300;
+		const Point3 o( reach * ( rng.CanonicalRandom() - 0.5 ) * 2, reach * ( rng.CanonicalRandom() - 0.5 ) * 2, reach * ( rng.CanonicalRandom() - 0.5 ) * 2 );
+		const Point3 t( spread * ( rng.CanonicalRandom() - 0.5 ), spread * ( rng.CanonicalRandom() - 0.5 ), spread * ( rng.CanonicalRandom() - 0.5 ) );
+		const Ray ray( o, Vector3Ops::Normalize( Vector3Ops::mkVector3( t, o ) ) );
+
+		RayIntersection a( ray, nullRasterizerState );
+		RayIntersection b( ray, nullRasterizerState );
+		pFiltered->IntersectRay( a, true, true, r % 2 == 0 );
+		pLinear->IntersectRay( b, true, true, r % 2 == 0 );
+
+		if( a.geometric.bHit != b.geometric.bHit ) { hitsAgree = false; continue; }
+		if( pFiltered->IntersectShadowRay( ray, RISE_INFINITY, true, true ) != b.geometric.bHit ) shadowsAgree = false;
+		if( !a.geometric.bHit ) continue;
+
+		hits++;
+		if( a.geometric.range != b.geometric.range ) rangesAgree = false;
+		if( r % 2 == 0 && a.geometric.range2 != b.geometric.range2 ) exitsAgree = false;
+
+		const Scalar dShort = b.geometric.range * 0.999 - 1e-6;
+		if( pFiltered->IntersectShadowRay( ray, dShort, true, true ) != pLinear->IntersectShadowRay( ray, dShort, true, true ) ) shadowsAgree = false;
+	}
+	std::cout << "  " << hits << " hits" << std::endl;
+	Check( hits > 3000, "the rays hit the crowd" );
+	Check( hitsAgree, "same rays hit" );
+	Check( rangesAgree, "same closest distance" );
+	Check( exitsAgree, "same exit distance" );
+	Check( shadowsAgree, "shadow rays agree" );
+
+	pFiltered->release();
+	pLinear->release();
+	for( size_t i = 0; i < geoms.size(); i++ ) geoms[i]->release();
+}
+
+static void TestShapes()
+{
+	std::cout << "Test: who supplies a shape" << std::endl;
+
+	SphereGeometry* pSphere = new SphereGeometry( 1.0 );
+	TorusGeometry* pTorus = new TorusGeometry( 2.0, 0.5 );
+
+	AnalyticShape shape;
+	Check( pTorus->GetAnalyticShape( shape ) && shape.bQuadric && shape.bounds.ur.y < 0.6 && shape.bounds.ur.x >= 2.5, "the torus bound is flat" );
+
+	Object* pStill = Place( pSphere, Matrix4Ops::Translation( Vector3( 1, 2, 3 ) ) );
+	Matrix4 mx;
+	Check( pStill->GetAnalyticShape( shape, mx ) && std::fabs( mx._30 + 1 ) < 1e-12 && std::fabs( mx._31 + 2 ) < 1e-12 && std::fabs( mx._32 + 3 ) < 1e-12, "a placed sphere hands out its inverse transform" );
+
+	// A moving object has no single matrix
+	Object* pMoving = Place( pSphere, Matrix4Ops::Identity() );
+	std::vector<Matrix4> keys;
+	keys.push_back( Matrix4Ops::Identity() );
+	keys.push_back( Matrix4Ops::Translation( Vector3( 1, 0, 0 ) ) );
+	pMoving->SetMotion( 0, 1, keys );
+	Check( !pMoving->GetAnalyticShape( shape, mx ), "a moving object is not filtered" );
+
+	pStill->release();
+	pMoving->release();
+	pTorus->release();
+	pSphere->release();
+}
+
+int main()
+{
+	std::cout << "=== Analytic Leaf Filter Tests ===" << std::endl;
+
+	TestKernel();
+	TestAgainstLinear();
+	TestShapes();
+
+	std::cout << std::endl << "Passed: " << passCount << "  Failed: " << failCount << std::endl;
+	return failCount > 0 ? 1 : 0;
+}
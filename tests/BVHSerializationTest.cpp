@@ -13,6 +13,9 @@
 //     intersection-equivalence check.
 //  3. Silent corruption of overallBox or per-node bbox bytes during
 //     write/read.
+//  4. Drift in the v2 cache, which stores the BVH4 nodes and float
+//     filter instead of re-deriving them, and the fallbacks for a
+//     stored block that no longer fits.
 //
 //  Pattern follows tests/BVHBuilderTest.cpp's TestPrim/TestProc
 //  fixture so the assertions are decoupled from the production mesh
@@ -22,6 +25,8 @@
 
 #include <cassert>
 #include <cmath>
+#include <cstddef>
+#include <cstring>
 #include <iostream>
 #include <random>
 #include <vector>
@@ -96,6 +101,26 @@ namespace
 		void DeserializeElement( IReadBuffer&, TestPrim& ) const {}
 	};
 
+	// TestProc whose prims also read as a triangle across the box's
+	// near face, so the BVH builds (and v2 persists) its float filter.
+	// `shift` moves the triangles, standing in for a cache that no
+	// longer matches the prims it is loaded against.
+	class TriProc : public TestProc
+	{
+	public:
+		float shift;
+		TriProc() : shift( 0 ) {}
+
+		bool GetFloatTriangleVertices( const TestPrim elem, float v0[3], float v1[3], float v2[3] ) const
+		{
+			const float z = (float)elem.bbox.ll.z;
+			v0[0] = (float)elem.bbox.ll.x + shift; v0[1] = (float)elem.bbox.ll.y; v0[2] = z;
+			v1[0] = (float)elem.bbox.ur.x + shift; v1[1] = (float)elem.bbox.ll.y; v1[2] = z;
+			v2[0] = (float)elem.bbox.ll.x + shift; v2[1] = (float)elem.bbox.ur.y; v2[2] = z;
+			return true;
+		}
+	};
+
 	int  failures   = 0;
 	int  totalChecks = 0;
 
@@ -377,6 +402,152 @@ namespace
 		safe_release( buf );
 		proc->release();
 	}
+
+	unsigned int CompareHits( BVH<TestPrim>* bvhA, BVH<TestPrim>* bvhB, unsigned int R )
+	{
+		std::mt19937                          rng( 4242 );
+		std::uniform_real_distribution<float> u( -1.0f, 1.0f );
+
+		unsigned int divergent = 0;
+		for( unsigned int r = 0; r < R; ++r ) {
+			Ray ray;
+			ray.origin = Point3( u(rng) * 0.5, u(rng) * 0.5, 0.0 );
+			ray.SetDir( Vector3Ops::Normalize( Vector3( u(rng) * 0.5, u(rng) * 0.5, 1.0 ) ) );
+
+			RayIntersectionGeometric riA( ray, nullRasterizerState );
+			bvhA->IntersectRay( riA, true, true );
+			RayIntersectionGeometric riB( ray, nullRasterizerState );
+			bvhB->IntersectRay( riB, true, true );
+
+			if( riA.bHit != riB.bHit ||
+			    ( riA.bHit && ( riA.ptCoord.x != riB.ptCoord.x || std::fabs( riA.range - riB.range ) >= 1e-9 ) ) ||
+			    bvhA->IntersectRay_IntersectionOnly( ray, 100.0, true, true ) !=
+			    bvhB->IntersectRay_IntersectionOnly( ray, 100.0, true, true ) ) {
+				++divergent;
+			}
+		}
+		return divergent;
+	}
+
+	// Byte offset of the v2 precompute section (originalSAH) in a
+	// stream written by SerializeWithPrecompute.
+	size_t PrecomputeOffset( const BVH<TestPrim>* bvh )
+	{
+		return 4 + 4 + 4 + bvh->numNodes() * sizeof( BVH<TestPrim>::Node ) +
+		       4 + bvh->numPrims() * sizeof( uint32_t ) + 6 * sizeof( double );
+	}
+
+	//
+	// Test 6: v2 (persisted precompute) round trip.  The BVH4 nodes and
+	// the float filter come back from the stream rather than being
+	// re-derived, and must traverse exactly like the original.  Then
+	// each way a stored block can stop fitting -- a different element
+	// layout, a child index out of range, a filter that no longer
+	// matches the prims, a truncated stream -- must either fall back
+	// to re-deriving that block or reject the cache outright.
+	//
+	void TestPrecomputeRoundTrip( unsigned int N, unsigned int R )
+	{
+		std::cerr << "TestPrecomputeRoundTrip N=" << N << " R=" << R << "...\n";
+
+		std::vector<TestPrim> prims = MakeRandomPrims( N, 31337 + N );
+		TriProc* proc = new TriProc(); proc->addref();
+		BVH<TestPrim>* bvhA = new BVH<TestPrim>( *proc, prims, WorldBox(prims), MkCfg(4) );
+		EXPECT( bvhA->FastFilterEnabled() && bvhA->BVH4Enabled(), "triangle BVH builds its filter and BVH4" );
+
+		MemoryBuffer* buf = new MemoryBuffer();
+		bvhA->SerializeWithPrecompute( *buf, []( const TestPrim& p ) { return p.id; } );
+		const size_t offPre = PrecomputeOffset( bvhA );
+		const size_t offNodes4 = offPre + sizeof( double ) + 8;
+		const size_t offFilter = offNodes4 + bvhA->numNodes4() * sizeof( BVH<TestPrim>::BVH4Node ) + 8;
+		EXPECT( buf->Size() == offFilter + bvhA->numPrims() * sizeof( BVH<TestPrim>::TriangleFilterData ),
+			"v2 stream carries the BVH4 nodes and one filter entry per prim" );
+
+		std::vector<char> clean( buf->Pointer(), buf->Pointer() + buf->Size() );
+		const auto load = [&]( const std::vector<char>& bytes, bool& ok ) -> BVH<TestPrim>* {
+			MemoryBuffer* in = new MemoryBuffer( (unsigned int)bytes.size() );
+			in->setBytes( bytes.data(), (unsigned int)bytes.size() );
+			in->seek( IBuffer::START, 0 );
+			std::vector<TestPrim> empty;
+			BVH<TestPrim>* bvh = new BVH<TestPrim>( *proc, empty,
+				BoundingBox( Point3(0,0,0), Point3(1,1,1) ), MkCfg(4) );
+			ok = bvh->Deserialize( *in, (uint32_t)prims.size(),
+				[&prims]( unsigned int idx ) -> TestPrim {
+					return idx < prims.size() ? prims[idx] : TestPrim();
+				} );
+			safe_release( in );
+			return bvh;
+		};
+
+		bool ok = false;
+		BVH<TestPrim>* bvhB = load( clean, ok );
+		EXPECT( ok, "Deserialize on a v2 stream succeeds" );
+		EXPECT( bvhB->numNodes4() == bvhA->numNodes4() && bvhB->BVH4Enabled(), "stored BVH4 nodes are loaded" );
+		EXPECT( bvhB->FastFilterEnabled(), "stored float filter is loaded" );
+		EXPECT( std::fabs( bvhB->SAHDegradationRatio() - 1.0 ) < 1e-12, "build-time SAH is carried over" );
+		EXPECT( CompareHits( bvhA, bvhB, R ) == 0, "v2 round-tripped BVH must produce identical hits to original" );
+		bvhB->release();
+
+		// A BVH4 block written for a different node layout (here, as
+		// twice as many nodes of half the size) is skipped
+		std::vector<char> bytes = clean;
+		const uint32_t foreign[2] = {
+			(uint32_t)( sizeof( BVH<TestPrim>::BVH4Node ) / 2 ),
+			(uint32_t)( bvhA->numNodes4() * 2 ) };
+		memcpy( &bytes[offNodes4 - 8], foreign, 8 );
+		bvhB = load( bytes, ok );
+		EXPECT( ok && bvhB->numNodes4() == bvhA->numNodes4() && bvhB->FastFilterEnabled(),
+			"a foreign BVH4 layout is skipped and re-derived, the filter still loads" );
+		EXPECT( CompareHits( bvhA, bvhB, R ) == 0, "re-derived BVH4 produces identical hits" );
+		bvhB->release();
+
+		// A BVH4 child pointing outside the arrays is caught
+		bytes = clean;
+		int32_t bogusChild = 0x7FFFFFFF;
+		memcpy( &bytes[offNodes4 + offsetof( BVH<TestPrim>::BVH4Node, children )], &bogusChild, 4 );
+		bvhB = load( bytes, ok );
+		EXPECT( ok && bvhB->numNodes4() == bvhA->numNodes4(), "an out-of-range BVH4 child forces a re-derive" );
+		EXPECT( CompareHits( bvhA, bvhB, R ) == 0, "BVH4 re-derived after damage produces identical hits" );
+		bvhB->release();
+
+		// A filter that no longer matches the prims is caught
+		bytes = clean;
+		float bogusVertex = 1e6f;
+		memcpy( &bytes[offFilter], &bogusVertex, 4 );
+		bvhB = load( bytes, ok );
+		EXPECT( ok && bvhB->FastFilterEnabled(), "a mismatched filter forces a re-derive" );
+		EXPECT( CompareHits( bvhA, bvhB, R ) == 0, "filter re-derived after damage produces identical hits" );
+		bvhB->release();
+
+		// A truncated precompute section rejects the whole cache
+		bytes.assign( clean.begin(), clean.end() - 16 );
+		bvhB = load( bytes, ok );
+		EXPECT( !ok, "a truncated v2 stream is rejected" );
+		bvhB->release();
+
+		// The v1 stream of the same tree still loads through the hooks
+		MemoryBuffer* buf1 = new MemoryBuffer();
+		bvhA->Serialize( *buf1, []( const TestPrim& p ) { return p.id; } );
+		EXPECT( buf1->Size() == offPre, "v1 stream stops before the precompute section" );
+		bytes.assign( buf1->Pointer(), buf1->Pointer() + buf1->Size() );
+		bvhB = load( bytes, ok );
+		EXPECT( ok && bvhB->numNodes4() == bvhA->numNodes4() && bvhB->FastFilterEnabled(), "v1 stream re-derives BVH4 and filter" );
+		EXPECT( CompareHits( bvhA, bvhB, R ) == 0, "v1 round-tripped triangle BVH produces identical hits" );
+		bvhB->release();
+		safe_release( buf1 );
+
+		// Loaded against moved triangles, the stored filter is refused
+		proc->shift = 0.01f;
+		bvhB = load( clean, ok );
+		BVH<TestPrim>* bvhC = new BVH<TestPrim>( *proc, prims, WorldBox(prims), MkCfg(4) );
+		EXPECT( ok && CompareHits( bvhC, bvhB, R ) == 0, "a stale filter is re-derived from the current prims" );
+		bvhB->release();
+		bvhC->release();
+
+		bvhA->release();
+		safe_release( buf );
+		proc->release();
+	}
 }
 
 int main()
@@ -388,6 +559,8 @@ int main()
 	TestRandomRoundTripIntersectionEquivalence( 1000, 1000, 10 );
 	TestVersionMismatchRejected();
 	TestBadMagicRejected();
+	TestPrecomputeRoundTrip(   1, 100 );
+	TestPrecomputeRoundTrip( 2000, 2000 );
 
 	std::cerr << "\nBVHSerializationTest: " << (totalChecks - failures) << "/"
 	          << totalChecks << " checks passed, " << failures << " failures.\n";
@@ -11,11 +11,15 @@
 //    [count_v]    count_v defaults to 1 (a 1D linear array).
 //    [refuse]     missing template / count_u, a bad count.
 //    [incremental] an instance_array edit refuses -> full-derive fallback.
+//    [compact]    `compact true` -> ONE object `g` over ONE instance array geometry `g.instances`,
+//                 hit where the expanded g[i,j] objects are, with sphere and triangle mesh templates;
+//                 per-instance shared params refuse.
 //
 //////////////////////////////////////////////////////////////////////
 
 #include "CstRenderEquivalence.h"
 #include "../src/Library/Cst/Cst.h"
+#include "../src/Library/Intersection/RayIntersection.h"
 
 using namespace RISE;
 using namespace RISE::Cst;
@@ -60,6 +64,14 @@ static NodeRef FirstChunk( const std::string& src )
 	return item;
 }
 
+// Does a ray down -z at (x,y) hit anything in the derived scene?
+static bool Hits( Job& j, const Scalar x, const Scalar y )
+{
+	RayIntersection ri( Ray( Point3( x, y, 10 ), Vector3( 0, 0, -1 ) ), nullRasterizerState );
+	j.GetObjects()->IntersectRay( ri, true, true, false );
+	return ri.geometric.bHit;
+}
+
 int main()
 {
 	std::printf( "CstInstanceArrayTest -- Facet 1 / #5 slice 4: instance_array generator (§2.6.1)\n" );
@@ -278,6 +290,68 @@ int main()
 		Check( idx >= 0 && d2.instanceArrayCount == 1, "replace: instance_array -> instance_array keeps count == 1 (role-preserving, nets 0)" );
 	}
 
+	// [compact] one object over one instance array, hit where the expanded objects are.
+	{
+		const std::string body = "instance_array\n{\nname g\ntemplate geo\nmaterial m\ncount_u 3\ncount_v 2\nposition expr(i*3) expr(j*3) 0\nscale expr(0.5+u*0.5) expr(0.5+u*0.5) 1\n";
+		Job* jc = new Job(); std::vector<std::string> dc;
+		DeriveToJob( ParseToCst( Scene( body + "compact true\n}\n" ) ), *jc, &dc );
+		Job* je = new Job(); std::vector<std::string> de;
+		DeriveToJob( ParseToCst( Scene( body + "}\n" ) ), *je, &de );
+		Check( dc.empty() && de.empty(), "compact: both derives succeed" );
+		jc->GetObjects()->PrepareForRendering();
+		je->GetObjects()->PrepareForRendering();
+		Check( jc->GetObjects()->GetItem( "g" ) && !jc->GetObjects()->GetItem( "g[0,0]" ) && jc->GetGeometries()->GetItem( "g.instances" ),
+		       "compact: one object g over geometry g.instances, no g[i,j]" );
+		// The grid is offset from the instance centres by an eighth so no
+		// ray grazes a sphere exactly, where either answer is right
+		bool same = true; int hits = 0;
+		for( Scalar y = -1.375; y <= 4.5; y += 0.25 )
+			for( Scalar x = -1.375; x <= 7.5; x += 0.25 ) {
+				const bool h = Hits( *jc, x, y );
+				if( h != Hits( *je, x, y ) ) same = false;
+				if( h ) ++hits;
+			}
+		Check( same && hits > 20, "compact: hit exactly where the expanded objects are" );
+		jc->release(); je->release();
+	}
+	// [compact: mesh template] a triangle mesh child, whose own BVH is traversed from inside the array's.
+	{
+		const std::string mesh = "displaced_geometry\n{\nname mesh\nbase_geometry geo\ndetail 24\n}\n";
+		const std::string body = mesh + "instance_array\n{\nname g\ntemplate mesh\nmaterial m\ncount_u 6\ncount_v 6\nposition expr(i*2.5) expr(j*2.5) expr((i+j)*0.5)\norientation 0 expr(i*15) 0\n";
+		Job* jc = new Job(); std::vector<std::string> dc;
+		DeriveToJob( ParseToCst( Scene( body + "compact true\n}\n" ) ), *jc, &dc );
+		Job* je = new Job(); std::vector<std::string> de;
+		DeriveToJob( ParseToCst( Scene( body + "}\n" ) ), *je, &de );
+		Check( dc.empty() && de.empty(), "compact(mesh): both derives succeed" );
+		jc->GetObjects()->PrepareForRendering();
+		je->GetObjects()->PrepareForRendering();
+		// Offset by a sixteenth so no ray runs along a silhouette
+		bool same = true; int hits = 0;
+		for( Scalar y = -1.3125; y <= 14; y += 0.125 )
+			for( Scalar x = -1.3125; x <= 14; x += 0.125 ) {
+				const bool h = Hits( *jc, x, y );
+				if( h != Hits( *je, x, y ) ) same = false;
+				if( h ) ++hits;
+			}
+		Check( same && hits > 1000, "compact(mesh): hit exactly where the expanded mesh objects are" );
+		jc->release(); je->release();
+	}
+	{
+		std::vector<std::string> d;
+		DumpCst( Scene( "instance_array\n{\nname g\ntemplate geo\nmaterial m\ncount_u 2\ncompact true\nmatrix 1 0 0 0 0 1 0 0 0 0 1 0 expr(i*3) 0 0 1\n}\n" ), &d );
+		Check( d.empty(), "compact: a per-instance `matrix` is accepted" );
+	}
+	{
+		std::vector<std::string> d;
+		DumpCst( Scene( "instance_array\n{\nname g\ntemplate geo\ncount_u 2\ncompact true\nradiance_scale expr(i+1)\n}\n" ), &d );
+		Check( !d.empty(), "compact: a shared param varying per instance refuses" );
+	}
+	{
+		std::vector<std::string> d;
+		DumpCst( Scene( "instance_array\n{\nname g\ntemplate geo\nmaterial m\ncount_u 2\ncompact true\nquaternion 0 0 0 1\n}\n" ), &d );
+		Check( !d.empty(), "compact: quaternion refuses" );
+	}
+
 	std::printf( "%d passed, %d failed.\n", g_pass, g_fail );
 	return g_fail == 0 ? 0 : 1;
 }
@@ -0,0 +1,125 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  CstRegionParseTest.cpp - a large scene parses region-parallel to the
+//  SAME Document the serial parser builds.
+//
+//  ParseToCst splits a multi-MB input at top-level chunk boundaries, parses
+//  the regions on the global thread pool, and bulk-builds the item sequence
+//  and the id / name / param indices in one pass.  This test builds a ~3 MB
+//  scene out of two halves that each stay under the region threshold, so the
+//  halves parse serially while the whole parses by region, and checks:
+//    - the whole round-trips byte-identically;
+//    - its items are the halves' items, in order, with the same kind, role
+//      and bytes -- including block comments and line comments holding braces,
+//      nested '{...}' values, stray top-level words and an unterminated
+//      trailing chunk, none of which may move a region split;
+//    - NodeIds ascend in document order and resolve back to their items;
+//    - name lookup (unique, duplicate, absent) and param ids resolve.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "../src/Library/Cst/Cst.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace RISE;
+
+static int g_pass = 0, g_fail = 0;
+static void Check( bool cond, const char* what ) { if( cond ) ++g_pass; else { ++g_fail; std::printf( "  FAIL: %s\n", what ); } }
+
+// Chunks [first, last) of the test scene.  Every piece starts with a newline
+// and ends on its closing brace, so two halves concatenate with the boundary
+// exactly after a '}' -- where the serial parser ends an item as well.
+static std::string Pieces( int first, int last )
+{
+	std::string s;
+	for( int i = first; i < last; ++i ) {
+		const std::string id = std::to_string( i );
+		if( i % 7 == 0 )  s += "\n/* a block comment { with braces } and } a stray close */";
+		if( i % 11 == 0 ) s += "\n# a line comment } {";
+		if( i % 17 == 0 ) s += "\nstray_word_" + id;
+		if( i % 13 == 0 ) {
+			s += "\nstandard_shader\n{\n\tname sh" + id + "\n\tshaderop { a { b } c }\n}";
+		} else if( i % 997 == 0 ) {
+			s += "\nsphere_geometry\n{\n\tname dup\n\tradius 2.0\n}";
+		} else {
+			s += "\nsphere_geometry\n{\n\tname s" + id + "\n\tradius 0." + id + "\n}";
+		}
+	}
+	return s;
+}
+
+static Cst::NodeRef ItemAt( const Cst::Document& d, int index )
+{
+	return Cst::DocResolveNodeId( d, Cst::DocNodeIdAt( d, index ) );
+}
+
+int main()
+{
+	std::printf( "CstRegionParseTest -- region-parallel ParseToCst matches the serial parse\n" );
+
+	const int N = 60000;
+	const std::string a = "RISE ASCII SCENE 7" + Pieces( 0, N/2 );
+	const std::string b = Pieces( N/2, N ) + "\n# trailing\nbroken_chunk\n{\n\tname x\n";
+	const std::string whole = a + b;
+	std::printf( "  halves %zu + %zu bytes, whole %zu bytes\n", a.size(), b.size(), whole.size() );
+	Check( a.size() < ((size_t)2 << 20) && b.size() < ((size_t)2 << 20), "each half stays under the 2 MiB region threshold (serial parse)" );
+	Check( whole.size() >= ((size_t)2 << 20), "the whole is over the 2 MiB region threshold (region parse)" );
+
+	const Cst::Document da = Cst::ParseToCst( a );
+	const Cst::Document db = Cst::ParseToCst( b );
+	const Cst::Document dw = Cst::ParseToCst( whole );
+
+	Check( Cst::SerializeCst( dw ) == whole, "whole round-trips byte-identically" );
+	Check( Cst::DocByteWidth( dw ) == whole.size(), "whole byte-width aggregate is exact" );
+
+	const int na = Cst::DocItemCount( da ), nb = Cst::DocItemCount( db ), nw = Cst::DocItemCount( dw );
+	Check( nw == na + nb, "whole has the halves' item count" );
+
+	bool same = true, ascending = true, resolves = true;
+	Cst::NodeId prev = 0;
+	for( int i = 0; i < nw && i < na + nb; ++i ) {
+		const Cst::NodeRef w = ItemAt( dw, i );
+		const Cst::NodeRef h = ( i < na ) ? ItemAt( da, i ) : ItemAt( db, i - na );
+		if( !w || !h || w->kind != h->kind || w->role != h->role || Cst::SerializeNode( w ) != Cst::SerializeNode( h ) ) {
+			if( same ) std::printf( "  first mismatch at item %d\n", i );
+			same = false;
+		}
+		const Cst::NodeId id = Cst::DocNodeIdAt( dw, i );
+		if( id <= prev ) ascending = false;
+		prev = id;
+		Cst::NodeRef back;
+		if( Cst::DocIndexOfNodeId( dw, id, &back ) != i || back != w ) resolves = false;
+	}
+	Check( same, "every item matches the serial parse in kind, role and bytes" );
+	Check( ascending, "NodeIds ascend in document order" );
+	Check( resolves, "every NodeId resolves back to its own index and item" );
+
+	// Name index, on both sides of the halves' boundary and in the nested-value chunks
+	const int probes[] = { 1, N/2 - 1, N/2 + 1, N - 1 };
+	bool named = true, params = true;
+	for( int i : probes ) {
+		int occ = 0;
+		const Cst::NodeId id = Cst::DocFindByName( dw, "sphere_geometry/s" + std::to_string( i ), nullptr, &occ );
+		if( !id || occ != 1 ) named = false;
+		if( id && !Cst::DocParamId( dw, id, "radius" ) ) params = false;
+	}
+	Check( named, "unique names resolve across the whole document" );
+	Check( params, "param ids resolve for the named chunks" );
+
+	int occ = 0;
+	Check( Cst::DocFindByName( dw, "standard_shader/sh" + std::to_string( 13 * ( N/26 ) ), nullptr, &occ ) != 0 && occ == 1, "a nested-value chunk resolves by name" );
+	Check( Cst::DocFindByName( dw, "sphere_geometry/dup", nullptr, &occ ) == 0 && occ > 1, "a duplicated name is counted and refused" );
+	Check( Cst::DocFindByName( dw, "sphere_geometry/absent", nullptr, &occ ) == 0 && occ == 0, "an absent name is not found" );
+
+	// An item-level edit on the region-built Document behaves like one on a serial Document
+	const int mid = Cst::DocIndexOfNodeId( dw, Cst::DocFindByName( dw, "sphere_geometry/s" + std::to_string( N/2 + 1 ) ), nullptr );
+	const Cst::Document de = Cst::DocRemoveItem( dw, mid );
+	Check( Cst::DocItemCount( de ) == nw - 1 && Cst::DocFindByName( de, "sphere_geometry/s" + std::to_string( N/2 + 1 ) ) == 0,
+		"removing an item from the region-built Document drops it from the name index" );
+
+	std::printf( "%d passed, %d failed.\n", g_pass, g_fail );
+	return g_fail ? 1 : 0;
+}
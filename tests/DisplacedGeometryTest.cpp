@@ -4,9 +4,11 @@
 #include <thread>
 #include <atomic>
 #include <vector>
+#include <map>
 #include "../src/Library/Geometry/DisplacedGeometry.h"
 #include "../src/Library/Geometry/SphereGeometry.h"
 #include "../src/Library/Geometry/InfinitePlaneGeometry.h"
+#include "../src/Library/Geometry/ClippedPlaneGeometry.h"
 #include "../src/Library/Geometry/TriangleMeshGeometryIndexed.h"
 #include "../src/Library/Intersection/RayIntersectionGeometric.h"
 #include "../src/Library/Utilities/Reference.h"
@@ -502,6 +504,359 @@ static void TestConcurrentRealize()
 	pSphere->release();
 }
 
+
+//-----------------------------------------------------------------------------
+// Lazy tessellation helpers: an open wavy field over a flat [-1,1]^2 quad.
+// The quad's tessellation is affine in (u,v), so a lazy geometry at
+// detail d with patch_subdivision N samples the same lattice as an eager
+// one at detail d*N and the two should agree to within the diagonal
+// choice of a few cells.
+//-----------------------------------------------------------------------------
+class WavyFunction2D : public virtual IFunction2D, public virtual Reference
+{
+public:
+	Scalar Evaluate( const Scalar x, const Scalar y ) const
+	{
+		return 0.5 * std::sin( 2.0 * PI * x ) * std::cos( 2.0 * PI * y );
+	}
+};
+
+static ClippedPlaneGeometry* MakeUnitQuad()
+{
+	const Point3 corners[4] = {
+		Point3( -1.0, -1.0, 0.0 ), Point3( 1.0, -1.0, 0.0 ),
+		Point3( 1.0, 1.0, 0.0 ), Point3( -1.0, 1.0, 0.0 ) };
+	return new ClippedPlaneGeometry( corners, false );
+}
+
+static DisplacedGeometry* WrapQuad(
+	IGeometry*          pBase,
+	const unsigned int  detail,
+	const IFunction2D*  displacement,
+	const bool          bLazy,
+	const unsigned int  patchSubdivision,
+	const unsigned int  cacheTriangles )
+{
+	DisplacedGeometry* pDisp = new DisplacedGeometry(
+		pBase, detail, displacement, 0.1,
+		/*bDoubleSided=*/true, /*bUseFaceNormals=*/false, /*bSeamFold=*/false,
+		bLazy, patchSubdivision, cacheTriangles );
+	pDisp->Realize();
+	return pDisp;
+}
+
+//-----------------------------------------------------------------------------
+// Case 9: lazy and eager tessellation of the same displaced surface agree
+// on hits, shading normals, bounds and area.
+//-----------------------------------------------------------------------------
+static void TestLazyMatchesEager()
+{
+	std::cout << "Test 9: lazy tessellation matches the eager bake...\n";
+
+	ClippedPlaneGeometry* pQuad  = MakeUnitQuad();
+	WavyFunction2D*       pWavy  = new WavyFunction2D();
+	DisplacedGeometry*    pEager = WrapQuad( pQuad, 32, pWavy, false, 0, 0 );
+	DisplacedGeometry*    pLazy  = WrapQuad( pQuad, 8, pWavy, true, 4, 1u<<20 );
+
+	assert( pEager->GetLazyMesh() == 0 );
+	assert( pLazy->GetLazyMesh() != 0 );
+	assert( pLazy->GetLazyMesh()->GetStats().builds == 0 );	// nothing tessellated before the first ray
+
+	Scalar worstRange = 0, worstDot = 1;
+	for( int y = 0; y < 40; y++ ) {
+		for( int x = 0; x < 40; x++ ) {
+			const Point3 o( -0.975 + 0.05*x, -0.975 + 0.05*y, 5.0 );
+			RayIntersectionGeometric riE = MakeRI( o, Vector3( 0.0, 0.0, -1.0 ) );
+			RayIntersectionGeometric riL = MakeRI( o, Vector3( 0.0, 0.0, -1.0 ) );
+			pEager->IntersectRay( riE, true, true, false );
+			pLazy->IntersectRay( riL, true, true, false );
+			assert( riE.bHit && riL.bHit );
+			worstRange = std::max( worstRange, std::fabs( riE.range - riL.range ) );
+			worstDot = std::min( worstDot, Vector3Ops::Dot( riE.vNormal, riL.vNormal ) );
+
+			assert( pLazy->IntersectRay_IntersectionOnly( Ray( o, Vector3( 0.0, 0.0, -1.0 ) ), 10.0, true, true ) );
+			assert( !pLazy->IntersectRay_IntersectionOnly( Ray( o, Vector3( 0.0, 0.0, -1.0 ) ), 4.0, true, true ) );
+		}
+	}
+	std::cout << "  worst |range difference| " << worstRange << ", worst normal dot " << worstDot << "\n";
+	assert( worstRange < 2e-3 );
+	assert( worstDot > 0.99 );
+
+	const BoundingBox bbE = pEager->GenerateBoundingBox();
+	const BoundingBox bbL = pLazy->GenerateBoundingBox();
+	assert( IsClose( bbE.ll.z, bbL.ll.z, 1e-3 ) && IsClose( bbE.ur.z, bbL.ur.z, 1e-3 ) );
+	assert( IsClose( bbE.ll.x, bbL.ll.x, 1e-3 ) && IsClose( bbE.ur.y, bbL.ur.y, 1e-3 ) );
+	assert( IsClose( pEager->GetArea(), pLazy->GetArea(), 1e-3 * pEager->GetArea() ) );
+
+	// Sampled points lie on the lazily displaced surface
+	for( int i = 1; i <= 8; i++ ) {
+		Point3 pt;
+		Vector3 nrm;
+		Point2 uv;
+		pLazy->UniformRandomPoint( &pt, &nrm, &uv, Point3( i/9.0, (i*5%9)/9.0, (i*7%9)/9.0 ) );
+		assert( IsClose( pt.z, 0.1 * pWavy->Evaluate( uv.x, uv.y ), 5e-3 ) );
+	}
+
+	pLazy->release();
+	pEager->release();
+	pWavy->release();
+	pQuad->release();
+}
+
+//-----------------------------------------------------------------------------
+// Case 10: neighbouring patches are crack-free.  Welding the lazy mesh by
+// EXACT vertex position must leave a manifold grid: every micro edge is
+// shared by two triangles except the 4*d*N edges of the quad's border.
+//-----------------------------------------------------------------------------
+static void TestLazyPatchesAreCrackFree()
+{
+	std::cout << "Test 10: lazy patches meet bit-exactly along shared edges...\n";
+
+	const unsigned int d = 6, N = 5;
+	ClippedPlaneGeometry* pQuad = MakeUnitQuad();
+	WavyFunction2D*       pWavy = new WavyFunction2D();
+	DisplacedGeometry*    pLazy = WrapQuad( pQuad, d, pWavy, true, N, 1u<<20 );
+
+	IndexTriangleListType tris;
+	VerticesListType      vertices;
+	NormalsListType       normals;
+	TexCoordsListType     coords;
+	assert( pLazy->TessellateToMesh( tris, vertices, normals, coords, 0 ) );
+	assert( tris.size() == 2*d*d*N*N );
+
+	typedef std::pair<Scalar,std::pair<Scalar,Scalar> > Key;
+	std::map< std::pair<Key,Key>, int > edges;
+	for( size_t t = 0; t < tris.size(); t++ ) {
+		for( int e = 0; e < 3; e++ ) {
+			const Point3& a = vertices[tris[t].iVertices[e]];
+			const Point3& b = vertices[tris[t].iVertices[(e+1)%3]];
+			Key ka( a.x, std::make_pair( a.y, a.z ) );
+			Key kb( b.x, std::make_pair( b.y, b.z ) );
+			if( kb < ka ) std::swap( ka, kb );
+			edges[std::make_pair( ka, kb )]++;
+		}
+	}
+
+	unsigned int border = 0;
+	for( std::map< std::pair<Key,Key>, int >::const_iterator it = edges.begin(); it != edges.end(); it++ ) {
+		assert( it->second == 1 || it->second == 2 );
+		if( it->second == 1 ) border++;
+	}
+	std::cout << "  " << edges.size() << " welded edges, " << border << " on the border (want " << 4*d*N << ")\n";
+	assert( border == 4*d*N );
+
+	pLazy->release();
+	pWavy->release();
+	pQuad->release();
+}
+
+//-----------------------------------------------------------------------------
+// Case 11: the micro-mesh cache stays within its budget, only tessellates
+// what rays reach, and gives the same answers when it thrashes -- also
+// with several threads evicting each other's meshes.
+//-----------------------------------------------------------------------------
+static void TestLazyCacheIsBounded()
+{
+	std::cout << "Test 11: lazy micro-mesh cache is bounded and thread-safe...\n";
+
+	const unsigned int d = 16, N = 4;
+	ClippedPlaneGeometry* pQuad  = MakeUnitQuad();
+	WavyFunction2D*       pWavy  = new WavyFunction2D();
+	DisplacedGeometry*    pRoomy = WrapQuad( pQuad, d, pWavy, true, N, 1u<<20 );
+	// Budget of 32 patches for the whole cache, out of 512
+	DisplacedGeometry*    pTight = WrapQuad( pQuad, d, pWavy, true, N, 32*N*N );
+
+	// A few rays into one corner only touch the patches there
+	for( int i = 0; i < 16; i++ ) {
+		RayIntersectionGeometric ri = MakeRI( Point3( -0.95 + 0.01*i, -0.95, 5.0 ), Vector3( 0.0, 0.0, -1.0 ) );
+		pRoomy->IntersectRay( ri, true, true, false );
+		assert( ri.bHit );
+	}
+	assert( pRoomy->GetLazyMesh()->GetStats().builds <= 4 );
+
+	const int R = 48;
+	std::vector<Scalar> expected( R*R );
+	for( int k = 0; k < R*R; k++ ) {
+		const Point3 o( -0.99 + 1.98*(k%R)/(R-1), -0.99 + 1.98*(k/R)/(R-1), 5.0 );
+		RayIntersectionGeometric ri = MakeRI( o, Vector3( 0.1, -0.05, -1.0 ) );
+		pRoomy->IntersectRay( ri, true, true, false );
+		expected[k] = ri.bHit ? ri.range : -1;
+	}
+
+	std::atomic<int> mismatches( 0 );
+	std::vector<std::thread> threads;
+	for( int t = 0; t < 4; t++ ) {
+		threads.emplace_back( [&, t]{
+			for( int pass = 0; pass < 2; pass++ ) {
+				for( int k = t; k < R*R; k += 2 ) {
+					const Point3 o( -0.99 + 1.98*(k%R)/(R-1), -0.99 + 1.98*(k/R)/(R-1), 5.0 );
+					RayIntersectionGeometric ri = MakeRI( o, Vector3( 0.1, -0.05, -1.0 ) );
+					pTight->IntersectRay( ri, true, true, false );
+					if( ( ri.bHit ? ri.range : -1 ) != expected[k] ) {
+						mismatches.fetch_add( 1 );
+					}
+				}
+			}
+		} );
+	}
+	for( std::thread& th : threads ) { th.join(); }
+
+	const LazyDisplacedMesh::Stats tight = pTight->GetLazyMesh()->GetStats();
+	std::cout << "  tight cache: " << tight.builds << " builds, " << tight.hits << " hits, peak "
+		<< tight.peakCachedTriangles << " of " << d*d*2*N*N << " triangles\n";
+	assert( mismatches.load() == 0 );
+	assert( tight.peakCachedTriangles <= 32*N*N );
+	assert( tight.cachedTriangles <= 32*N*N );
+	assert( tight.builds > tight.patches );		// it really did evict and rebuild
+
+	pTight->release();
+	pRoomy->release();
+	pWavy->release();
+	pQuad->release();
+}
+
+//-----------------------------------------------------------------------------
+// Case 12: realizing a lazy surface displaces each patch's lattice once
+// and builds no micro-mesh, and the patch bounds hold every micro vertex:
+// over a curved base, and for a ridge too narrow for a coarse sampling of
+// the displacement to see.  Asking for exit info changes no hit.
+//-----------------------------------------------------------------------------
+class CountingWavyFunction2D : public WavyFunction2D
+{
+public:
+	mutable std::atomic<unsigned int> calls;
+	CountingWavyFunction2D() : calls( 0 ) {}
+	Scalar Evaluate( const Scalar x, const Scalar y ) const
+	{
+		calls.fetch_add( 1 );
+		return WavyFunction2D::Evaluate( x, y );
+	}
+};
+
+// Zero except along a thin ridge at u = 0.515625, which falls between
+// the points of a 4 x 4 sampling of each patch
+class RidgeFunction2D : public virtual IFunction2D, public virtual Reference
+{
+public:
+	Scalar Evaluate( const Scalar x, const Scalar /*y*/ ) const
+	{
+		return std::fabs( x - 0.515625 ) < 0.01 ? 5.0 : 0.0;
+	}
+};
+
+static void TestLazyBoundsAreConservative()
+{
+	std::cout << "Test 12: lazy realize bounds every micro vertex...\n";
+
+	const unsigned int d = 8, N = 16;
+	ClippedPlaneGeometry*   pQuad  = MakeUnitQuad();
+	CountingWavyFunction2D* pWavy  = new CountingWavyFunction2D();
+	DisplacedGeometry*      pLazy  = WrapQuad( pQuad, d, pWavy, true, N, 1u<<20 );
+
+	// One evaluation per point of each patch's 16 x 16 micro lattice,
+	// and no micro-mesh built
+	const unsigned int patches = pLazy->GetLazyMesh()->GetStats().patches;
+	std::cout << "  " << pWavy->calls.load() << " displacement evaluations for " << patches << " patches\n";
+	assert( pWavy->calls.load() <= patches*153 );
+	assert( pLazy->GetLazyMesh()->GetStats().builds == 0 );
+	pLazy->release();
+
+	// Rays skimming the quad below the ridge's crest hit only the ridge,
+	// so a patch box built from coarse samples (all zero) would cull it
+	RidgeFunction2D*   pRidge = new RidgeFunction2D();
+	DisplacedGeometry* pRidged = WrapQuad( pQuad, d, pRidge, true, N, 1u<<20 );
+	{
+		IndexTriangleListType tris;
+		VerticesListType      vertices;
+		NormalsListType       normals;
+		TexCoordsListType     coords;
+		assert( pRidged->TessellateToMesh( tris, vertices, normals, coords, 0 ) );
+		TriangleMeshGeometryIndexed* pFull = new TriangleMeshGeometryIndexed( true, false );
+		pFull->BeginIndexedTriangles();
+		pFull->AddVertices( vertices );
+		pFull->AddNormals( normals );
+		pFull->AddTexCoords( coords );
+		pFull->AddIndexedTriangles( tris );
+		pFull->DoneIndexedTriangles();
+
+		unsigned int hits = 0;
+		for( int k = 0; k < 400; k++ ) {
+			const Scalar t = -0.9975 + 0.005 * k;
+			for( int axis = 0; axis < 2; axis++ ) {
+				const Point3 o = axis ? Point3( t, -3.0, 0.25 ) : Point3( -3.0, t, 0.25 );
+				const Vector3 dir = axis ? Vector3( 0, 1, 0 ) : Vector3( 1, 0, 0 );
+				RayIntersectionGeometric ri  = MakeRI( o, dir );
+				RayIntersectionGeometric rif = MakeRI( o, dir );
+				pRidged->IntersectRay( ri, true, true, false );
+				pFull->IntersectRay( rif, true, true, false );
+				assert( ri.bHit == rif.bHit );
+				assert( pRidged->IntersectRay_IntersectionOnly( Ray( o, dir ), RISE_INFINITY, true, true ) == rif.bHit );
+				if( ri.bHit ) {
+					assert( IsClose( ri.range, rif.range, 1e-9 ) );
+					hits++;
+				}
+			}
+		}
+		std::cout << "  " << hits << " skimming rays hit the ridge\n";
+		assert( hits > 0 );
+		pFull->release();
+	}
+	pRidged->release();
+	pRidge->release();
+
+	SphereGeometry*    pSphere = new SphereGeometry( 1.0 );
+	DisplacedGeometry* pBall = new DisplacedGeometry(
+		pSphere, 8, pWavy, 0.1,
+		/*bDoubleSided=*/false, /*bUseFaceNormals=*/false, /*bSeamFold=*/true,
+		/*bLazy=*/true, 6, 1u<<20 );
+	pBall->Realize();
+
+	const BoundingBox bb = pBall->GenerateBoundingBox();
+	IndexTriangleListType tris;
+	VerticesListType      vertices;
+	NormalsListType       normals;
+	TexCoordsListType     coords;
+	assert( pBall->TessellateToMesh( tris, vertices, normals, coords, 0 ) );
+	for( size_t i = 0; i < vertices.size(); i++ ) {
+		const Point3& v = vertices[i];
+		assert( v.x >= bb.ll.x && v.y >= bb.ll.y && v.z >= bb.ll.z );
+		assert( v.x <= bb.ur.x && v.y <= bb.ur.y && v.z <= bb.ur.z );
+	}
+
+	// A patch box that missed part of its micro-mesh would cut off hits
+	// the fully tessellated surface has
+	TriangleMeshGeometryIndexed* pFull = new TriangleMeshGeometryIndexed( false, false );
+	pFull->BeginIndexedTriangles();
+	pFull->AddVertices( vertices );
+	pFull->AddNormals( normals );
+	pFull->AddTexCoords( coords );
+	pFull->AddIndexedTriangles( tris );
+	pFull->DoneIndexedTriangles();
+
+	for( int k = 0; k < 64; k++ ) {
+		const Scalar a = 2.0 * PI * k / 64.0;
+		const Point3 o( 3.0*std::cos( a ), 0.4*std::sin( 3.0*a ), 3.0*std::sin( a ) );
+		const Vector3 dir( -o.x, -o.y, -o.z );
+		RayIntersectionGeometric ri  = MakeRI( o, dir );
+		RayIntersectionGeometric rix = MakeRI( o, dir );
+		pBall->IntersectRay( ri, true, true, false );
+		pBall->IntersectRay( rix, true, true, true );
+		assert( ri.bHit && rix.bHit );
+		assert( ri.range == rix.range );
+
+		RayIntersectionGeometric rif = MakeRI( o, dir );
+		pFull->IntersectRay( rif, true, true, false );
+		assert( rif.bHit && IsClose( rif.range, ri.range, 1e-9 ) );
+	}
+
+	pFull->release();
+
+	pBall->release();
+	pSphere->release();
+	pWavy->release();
+	pQuad->release();
+}
+
 int main()
 {
 	TestPureTessellationBBox();
@@ -514,6 +869,10 @@ int main()
 	TestNestedComposition();
 	TestFaceNormalMeshDisplacesAlongFaceNormal();
 	TestConcurrentRealize();
+	TestLazyMatchesEager();
+	TestLazyPatchesAreCrackFree();
+	TestLazyCacheIsBounded();
+	TestLazyBoundsAreConservative();
 
 	std::cout << "All DisplacedGeometry tests passed.\n";
 	return 0;
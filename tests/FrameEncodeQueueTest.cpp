@@ -0,0 +1,338 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  FrameEncodeQueueTest.cpp - Tests for the background frame
+//  encoding queue
+//
+//  FrameEncodeQueue must run every submitted task before Flush
+//  returns, block Submit when the queue is full, collapse queued
+//  writes to the same file into the last one, and never run two
+//  writes to the same file at once.  FrameStore::CreateSnapshot must
+//  copy every channel and the metadata and be independent of later
+//  writes.  End to end, animation frames written through the queue
+//  must be byte-identical to frames written inline.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+	#include <process.h>
+	#define getpid _getpid
+#else
+	#include <unistd.h>
+#endif
+
+#include "../src/Library/Rendering/FrameEncodeQueue.h"
+#include "../src/Library/Rendering/FrameStore.h"
+#include "../src/Library/Rendering/FileRasterizerOutput.h"
+#include "../src/Library/RasterImages/RasterImage.h"
+#include "../src/Library/Utilities/Reference.h"
+
+using namespace RISE;
+using namespace RISE::Implementation;
+using namespace RISE::FrameStoreOutput;
+
+static int passCount = 0;
+static int failCount = 0;
+
+static void Check( bool cond, const char* name )
+{
+	if( cond ) { ++passCount; }
+	else { ++failCount; std::cout << "  FAIL: " << name << std::endl; }
+}
+
+static std::string TmpPrefix()
+{
+	const char* tmp = getenv( "TMPDIR" );
+	std::string dir = tmp ? tmp : "/tmp/";
+	if( !dir.empty() && dir[dir.size()-1] != '/' ) dir += "/";
+	std::ostringstream os;
+	os << dir << "rise_encq_" << getpid();
+	return os.str();
+}
+
+static bool ReadAll( const std::string& path, std::vector<unsigned char>& out )
+{
+	std::ifstream f( path.c_str(), std::ios::binary );
+	if( !f.is_open() ) return false;
+	out.assign( std::istreambuf_iterator<char>( f ), std::istreambuf_iterator<char>() );
+	return true;
+}
+
+static void TestFlushRunsEverything()
+{
+	std::cout << "Test: Flush waits for every task" << std::endl;
+
+	FrameEncodeQueue q( 2, 4 );
+	std::atomic<int> done( 0 );
+	for( int i = 0; i < 20; i++ ) {
+		std::ostringstream key;
+		key << "file" << i;
+		q.Submit( key.str(), [&done]() {
+			std::this_thread::sleep_for( std::chrono::milliseconds( 2 ) );
+			done.fetch_add( 1 );
+		} );
+	}
+	q.Flush();
+	Check( done.load() == 20, "all tasks ran" );
+	Check( q.Outstanding() == 0, "nothing outstanding after Flush" );
+}
+
+static void TestBackPressure()
+{
+	std::cout << "Test: Submit blocks when the queue is full" << std::endl;
+
+	FrameEncodeQueue q( 1, 1 );
+	std::atomic<bool> gate( false );
+	std::atomic<bool> started( false );
+
+	// Occupies the only worker until the gate opens
+	q.Submit( "a", [&]() {
+		started = true;
+		while( !gate.load() ) {
+			std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+		}
+	} );
+	while( !started.load() ) {
+		std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+	}
+
+	// Fills the one pending slot
+	q.Submit( "b", []() {} );
+
+	std::atomic<bool> submitted( false );
+	std::thread producer( [&]() {
+		q.Submit( "c", []() {} );
+		submitted = true;
+	} );
+
+	std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+	Check( !submitted.load(), "third submit blocks while the queue is full" );
+
+	gate = true;
+	producer.join();
+	Check( submitted.load(), "third submit proceeds once space frees" );
+	q.Flush();
+	Check( q.Outstanding() == 0, "drained" );
+}
+
+static void TestSameKeyReplaced()
+{
+	std::cout << "Test: queued writes to the same file collapse" << std::endl;
+
+	FrameEncodeQueue q( 1, 4 );
+	std::atomic<bool> gate( false );
+	std::atomic<bool> started( false );
+	q.Submit( "busy", [&]() {
+		started = true;
+		while( !gate.load() ) {
+			std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+		}
+	} );
+	while( !started.load() ) {
+		std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+	}
+
+	std::vector<int> ran;
+	std::mutex ranMutex;
+	for( int i = 0; i < 10; i++ ) {
+		// Would block after 4 if replacement did not happen
+		q.Submit( "same", [&ran, &ranMutex, i]() {
+			std::lock_guard<std::mutex> lock( ranMutex );
+			ran.push_back( i );
+		} );
+	}
+	gate = true;
+	q.Flush();
+
+	Check( ran.size() == 1, "only one write ran" );
+	Check( !ran.empty() && ran[0] == 9, "the last write won" );
+}
+
+static void TestSameKeyNeverConcurrent()
+{
+	std::cout << "Test: writes to the same file never overlap" << std::endl;
+
+	FrameEncodeQueue q( 4, 8 );
+	std::atomic<int> inside( 0 );
+	std::atomic<bool> overlapped( false );
+	std::atomic<int> done( 0 );
+
+	for( int i = 0; i < 12; i++ ) {
+		// Alternate with other keys so the same key is never pending
+		// twice and therefore never replaced
+		q.Submit( "shared", [&]() {
+			if( inside.fetch_add( 1 ) != 0 ) overlapped = true;
+			std::this_thread::sleep_for( std::chrono::milliseconds( 3 ) );
+			inside.fetch_sub( 1 );
+			done.fetch_add( 1 );
+		} );
+		std::ostringstream other;
+		other << "other" << i;
+		q.Submit( other.str(), []() {
+			std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+		} );
+		// Give a worker the chance to pick "shared" up before the next one
+		std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+	}
+	q.Flush();
+
+	Check( !overlapped.load(), "no two same-key tasks ran at once" );
+	Check( done.load() >= 1, "same-key tasks ran" );
+}
+
+static void TestSnapshot()
+{
+	std::cout << "Test: FrameStore snapshot" << std::endl;
+
+	FrameStore::Spec spec;
+	spec.width = 40;
+	spec.height = 24;
+	spec.tileEdge = 16;
+	spec.aovChannels.push_back( ChannelId::Depth );
+	FrameStore* store = new FrameStore( spec );
+	store->MutableMeta().cameraExposureEV = 1.5;
+	store->MutableMeta().sampleCount = 64;
+
+	for( size_t ty = 0; ty < store->TileCountY(); ty++ ) {
+		for( size_t tx = 0; tx < store->TileCountX(); tx++ ) {
+			store->BeginTile( tx, ty );
+		}
+	}
+	for( unsigned int y = 0; y < 24; y++ ) {
+		for( unsigned int x = 0; x < 40; x++ ) {
+			store->GetChannel<ChannelId::Beauty>()->At( x, y ) = RISEPel( x, y, x+y );
+			store->GetChannel<ChannelId::Alpha>()->At( x, y ) = 0.5f;
+			store->GetChannel<ChannelId::Depth>()->At( x, y ) = float( x*y );
+		}
+	}
+	for( size_t ty = 0; ty < store->TileCountY(); ty++ ) {
+		for( size_t tx = 0; tx < store->TileCountX(); tx++ ) {
+			store->EndTile( tx, ty );
+		}
+	}
+
+	FrameStore* snap = store->CreateSnapshot();
+	Check( snap->Width() == 40 && snap->Height() == 24 && snap->TileEdge() == 16, "geometry" );
+	Check( snap->HasChannel( ChannelId::Depth ) && !snap->HasChannel( ChannelId::Normal ), "channel set" );
+	Check( snap->Meta().cameraExposureEV == 1.5 && snap->Meta().sampleCount == 64, "metadata" );
+
+	bool same = true;
+	for( unsigned int y = 0; y < 24; y++ ) {
+		for( unsigned int x = 0; x < 40; x++ ) {
+			const RISEPel a = snap->GetChannel<ChannelId::Beauty>()->At( x, y );
+			if( a[0] != x || a[1] != y || a[2] != x+y ) same = false;
+			if( snap->GetChannel<ChannelId::Alpha>()->At( x, y ) != 0.5f ) same = false;
+			if( snap->GetChannel<ChannelId::Depth>()->At( x, y ) != float( x*y ) ) same = false;
+		}
+	}
+	Check( same, "pixels copied" );
+
+	store->BeginTile( 0, 0 );
+	store->GetChannel<ChannelId::Beauty>()->At( 0, 0 ) = RISEPel( 9, 9, 9 );
+	store->EndTile( 0, 0 );
+	Check( snap->GetChannel<ChannelId::Beauty>()->At( 0, 0 )[0] == 0, "independent of later writes" );
+
+	snap->release();
+	store->release();
+}
+
+static RasterImage_Template<RISEPel>* MakeFrame( unsigned int frame )
+{
+	RasterImage_Template<RISEPel>* img = new RasterImage_Template<RISEPel>(
+		24, 16, RISEColor( RISEPel( 0, 0, 0 ), 1.0 ) );
+	for( unsigned int y = 0; y < 16; y++ ) {
+		for( unsigned int x = 0; x < 24; x++ ) {
+			img->SetPEL( x, y, RISEColor( RISEPel( x/24.0, y/16.0, frame*0.3 ), 1.0 ) );
+		}
+	}
+	return img;
+}
+
+static FileRasterizerOutput* MakeOutput( const std::string& pattern, const bool multiple )
+{
+	return new FileRasterizerOutput(
+		pattern.c_str(), multiple, FileRasterizerOutput::PPM, 8,
+		eColorSpace_sRGB, 0.0, eDisplayTransform_None, eExrCompression_Piz, true );
+}
+
+static void TestAnimationFilesMatchInline()
+{
+	std::cout << "Test: queued animation frames match inline writes" << std::endl;
+
+	const std::string prefix = TmpPrefix();
+	const std::string animPattern = prefix + "_anim";
+
+	FileRasterizerOutput* anim = MakeOutput( animPattern, true );
+	for( unsigned int frame = 0; frame < 3; frame++ ) {
+		RasterImage_Template<RISEPel>* img = MakeFrame( frame );
+		anim->OutputImage( *img, 0, frame );
+		img->release();
+	}
+	FrameEncodeQueue::FlushGlobal();
+
+	bool allMatch = true;
+	for( unsigned int frame = 0; frame < 3; frame++ ) {
+		std::ostringstream single;
+		single << prefix << "_single" << frame;
+		FileRasterizerOutput* out = MakeOutput( single.str(), false );
+		RasterImage_Template<RISEPel>* img = MakeFrame( frame );
+		out->OutputImage( *img, 0, 0 );
+		img->release();
+		out->release();
+
+		char animName[1024];
+		snprintf( animName, sizeof( animName ), "%s%.4u.ppm", animPattern.c_str(), frame );
+		const std::string singleName = single.str() + ".ppm";
+
+		std::vector<unsigned char> a, b;
+		const bool readA = ReadAll( animName, a );
+		const bool readB = ReadAll( singleName, b );
+		if( !readA || !readB || a.empty() || a != b ) {
+			allMatch = false;
+		}
+		remove( animName );
+		remove( singleName.c_str() );
+	}
+	anim->release();
+
+	Check( allMatch, "every frame byte-identical to an inline write" );
+}
+
+int main()
+{
+	std::cout << "=== FrameEncodeQueue Tests ===" << std::endl;
+
+	// Temp paths are absolute; see FileRasterizerOutputShimTest
+#ifdef _WIN32
+	_putenv( "RISE_MEDIA_PATH=" );
+#else
+	unsetenv( "RISE_MEDIA_PATH" );
+#endif
+
+	TestFlushRunsEverything();
+	TestBackPressure();
+	TestSameKeyReplaced();
+	TestSameKeyNeverConcurrent();
+	TestSnapshot();
+	TestAnimationFilesMatchInline();
+
+	std::cout << std::endl << "Passed: " << passCount << "  Failed: " << failCount << std::endl;
+	return failCount > 0 ? 1 : 0;
+}
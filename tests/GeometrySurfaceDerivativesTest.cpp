@@ -459,7 +459,7 @@ static void TestTriangleMeshIndexed_Curved()
 static void TestBilinearPatch()
 {
 	std::cout << "Testing BilinearPatchGeometry..." << std::endl;
-	BilinearPatchGeometry* g = new BilinearPatchGeometry( 10, 8, false );
+	BilinearPatchGeometry* g = new BilinearPatchGeometry();
 
 	// Build a CURVED bilinear patch: corners not coplanar.  A proper
 	// analytical implementation must return nonzero dndu/dndv for this
@@ -503,11 +503,9 @@ static void TestBilinearPatch()
 static void TestBezierPatch()
 {
 	std::cout << "Testing BezierPatchGeometry..." << std::endl;
-	// Constructor args, per RISE_API.cpp::CreateBezierPatchGeometry:
-	//   max_patches_per_node, max_recursion_level, bUseBSP
-	// (Rendering is always analytic; displacement / tessellation belong
-	//  on a wrapping DisplacedGeometry, not on the patch geometry itself.)
-	BezierPatchGeometry* g = new BezierPatchGeometry( 10, 8, false );
+	// Rendering is always analytic; displacement / tessellation belong
+	// on a wrapping DisplacedGeometry, not on the patch geometry itself.
+	BezierPatchGeometry* g = new BezierPatchGeometry();
 
 	// Construct a CURVED bezier patch — the 16 control points form a
 	// gently warped surface.  Analytical derivatives must be nonzero in
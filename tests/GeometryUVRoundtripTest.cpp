@@ -1225,7 +1225,7 @@ static void TestBilinearPatchAreaLightContract()
 	//   pts[0]=(u0,v0)  pts[1]=(u0,v1)  pts[2]=(u1,v0)  pts[3]=(u1,v1)
 	// Width at v=0 is 4 (x from 0..4); at v=1 it is 1 (x from 0..1); height 1.
 	// Exact area of that trapezoid = (4 + 1)/2 * 1 = 2.5.
-	BilinearPatchGeometry* g = new BilinearPatchGeometry( 10, 8, /*bUseBSP=*/false );
+	BilinearPatchGeometry* g = new BilinearPatchGeometry();
 	BilinearPatch patch;
 	patch.pts[0] = Point3( 0, 0, 0 );   // (u=0, v=0)
 	patch.pts[1] = Point3( 0, 1, 0 );   // (u=0, v=1)
@@ -1292,7 +1292,7 @@ static void TestBilinearPatch()
 {
 	std::cout << "Testing BilinearPatchGeometry UV roundtrip..." << std::endl;
 
-	BilinearPatchGeometry* g = new BilinearPatchGeometry( 10, 8, /*bUseBSP=*/false );
+	BilinearPatchGeometry* g = new BilinearPatchGeometry();
 	BilinearPatch patch;
 	patch.pts[0] = Point3( 0, 0, 0 );
 	patch.pts[1] = Point3( 0, 1, 0.2 );  // pts[1] at (u=0, v=1)
@@ -0,0 +1,359 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  InstanceArrayGeometryTest.cpp - Tests for instance arrays
+//
+//  An object placing an InstanceArrayGeometry must be hit exactly
+//  where one object per instance would be hit, with the same distance,
+//  point and normals, through both intersection entry points, and for
+//  uniform, non-uniform and mirroring instance transforms.  The array
+//  must bound every instance, must miss until realized, must sample
+//  points on its instances, and must refuse another array as child.
+//  Triangle mesh children, whose BVH runs nested inside the array's,
+//  must lose no hits either, and BVH elements must round trip.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "../src/Library/Utilities/Math3D/Math3D.h"
+#include "../src/Library/Utilities/Ray.h"
+#include "../src/Library/Intersection/RayIntersection.h"
+#include "../src/Library/Geometry/SphereGeometry.h"
+#include "../src/Library/Geometry/InstanceArrayGeometry.h"
+#include "../src/Library/Geometry/TriangleMeshGeometryIndexed.h"
+#include "../src/Library/Objects/Object.h"
+#include "../src/Library/Utilities/MemoryBuffer.h"
+#include "../src/Library/RISE_API.h"
+
+using namespace RISE;
+using namespace RISE::Implementation;
+
+static int passCount = 0;
+static int failCount = 0;
+
+static void Check( bool cond, const char* name )
+{
+	if( cond ) { ++passCount; }
+	else { ++failCount; std::cout << "  FAIL: " << name << std::endl; }
+}
+
+static bool Near( Scalar a, Scalar b, Scalar tol = 1e-6 )
+{
+	return std::fabs( a - b ) < tol;
+}
+
+static bool Near( const Vector3& a, const Vector3& b, Scalar tol = 1e-6 )
+{
+	return Near( a.x, b.x, tol ) && Near( a.y, b.y, tol ) && Near( a.z, b.z, tol );
+}
+
+static bool Near( const Point3& a, const Point3& b, Scalar tol = 1e-6 )
+{
+	return Near( a.x, b.x, tol ) && Near( a.y, b.y, tol ) && Near( a.z, b.z, tol );
+}
+
+// Column-major 4x4, the layout RISE_API_CreateInstanceArrayGeometry takes
+static void ToColumnMajor( const Matrix4& mx, Scalar* m )
+{
+	m[ 0] = mx._00; m[ 1] = mx._01; m[ 2] = mx._02; m[ 3] = mx._03;
+	m[ 4] = mx._10; m[ 5] = mx._11; m[ 6] = mx._12; m[ 7] = mx._13;
+	m[ 8] = mx._20; m[ 9] = mx._21; m[10] = mx._22; m[11] = mx._23;
+	m[12] = mx._30; m[13] = mx._31; m[14] = mx._32; m[15] = mx._33;
+}
+
+// A plain copy, a scaled copy, a squashed and rotated copy and a
+// mirrored copy of the unit sphere
+static std::vector<Matrix4> Placements()
+{
+	std::vector<Matrix4> v;
+	v.push_back( Matrix4Ops::Identity() );
+	v.push_back( Matrix4Ops::Translation( Vector3( 4, 0, 0 ) ) * Matrix4Ops::Stretch( Vector3( 2, 2, 2 ) ) );
+	v.push_back( Matrix4Ops::Translation( Vector3( -4, 1, 0.5 ) ) * Matrix4Ops::ZRotation( 0.7 ) * Matrix4Ops::Stretch( Vector3( 1, 0.5, 2 ) ) );
+	v.push_back( Matrix4Ops::Translation( Vector3( 0, -4, 0 ) ) * Matrix4Ops::Stretch( Vector3( -1, 1, 1 ) ) );
+	return v;
+}
+
+static InstanceArrayGeometry* MakeArray( const IGeometry& child, const std::vector<Matrix4>& placements )
+{
+	std::vector<Scalar> m( placements.size() * 16 );
+	for( size_t i = 0; i < placements.size(); i++ ) {
+		ToColumnMajor( placements[i], &m[i*16] );
+	}
+	return new InstanceArrayGeometry( child, (unsigned int)placements.size(), &m[0] );
+}
+
+static Object* Place( const IGeometry* pGeo, const Matrix4& mx )
+{
+	Object* pObj = new Object( pGeo );
+	pObj->PushTopTransStack( mx );
+	pObj->FinalizeTransformations();
+	return pObj;
+}
+
+static void TestAgainstObjects()
+{
+	std::cout << "Test: hits match one object per instance" << std::endl;
+
+	SphereGeometry* pSphere = new SphereGeometry( 1.0 );
+	InstanceArrayGeometry* pArray = MakeArray( *pSphere, Placements() );
+	pArray->Realize();
+	Check( pArray->IsRealized() && pArray->NumInstances() == 4, "realized with four instances" );
+
+	// The whole array is itself placed by a rotated, moved object
+	const Matrix4 outer = Matrix4Ops::Translation( Vector3( 0.5, 0, 3 ) ) * Matrix4Ops::YRotation( 0.3 );
+	Object* pArrayObj = Place( pArray, outer );
+
+	// The references use the array's own float-rounded transforms
+	std::vector<Object*> refs;
+	for( unsigned int i = 0; i < pArray->NumInstances(); i++ ) {
+		refs.push_back( Place( pSphere, outer * pArray->GetInstance( i ).Get() ) );
+	}
+
+	unsigned int hits = 0;
+	bool hitsAgree = true, pointsAgree = true, normalsAgree = true, shadowsAgree = true, exitsAgree = true;
+	for( Scalar y = -7; y <= 5; y += 0.37 ) {
+		for( Scalar x = -8; x <= 9; x += 0.41 ) {
+			const Ray ray( Point3( x, y, -20 ), Vector3Ops::Normalize( Vector3( 0.05, -0.02, 1 ) ) );
+
+			RayIntersection best( ray, nullRasterizerState );
+			best.geometric.range = RISE_INFINITY;
+			bool refShadow = false;
+			for( size_t i = 0; i < refs.size(); i++ ) {
+				RayIntersection ri( ray, nullRasterizerState );
+				refs[i]->IntersectRay( ri, RISE_INFINITY, true, true, true );
+				if( ri.geometric.bHit && ri.geometric.range < best.geometric.range ) {
+					best = ri;
+				}
+				refShadow = refShadow || refs[i]->IntersectRay_IntersectionOnly( ray, RISE_INFINITY, true, true );
+			}
+
+			RayIntersection ri( ray, nullRasterizerState );
+			pArrayObj->IntersectRay( ri, RISE_INFINITY, true, true, true );
+
+			if( ri.geometric.bHit != best.geometric.bHit ) { hitsAgree = false; continue; }
+			if( pArrayObj->IntersectRay_IntersectionOnly( ray, RISE_INFINITY, true, true ) != refShadow ) shadowsAgree = false;
+			if( !ri.geometric.bHit ) continue;
+
+			hits++;
+			if( !Near( ri.geometric.range, best.geometric.range ) || !Near( ri.geometric.ptIntersection, best.geometric.ptIntersection ) ) pointsAgree = false;
+			if( !Near( ri.geometric.vNormal, best.geometric.vNormal ) || !Near( ri.geometric.vGeomNormal, best.geometric.vGeomNormal ) ) normalsAgree = false;
+			if( !Near( ri.geometric.range2, best.geometric.range2 ) || !Near( ri.geometric.vNormal2, best.geometric.vNormal2 ) ) exitsAgree = false;
+		}
+	}
+	Check( hits > 100, "the grid hits the instances" );
+	Check( hitsAgree, "same rays hit" );
+	Check( pointsAgree, "same distance and point" );
+	Check( normalsAgree, "same normals, including the mirrored copy" );
+	Check( exitsAgree, "same exit distance and normal" );
+	Check( shadowsAgree, "shadow rays agree" );
+
+	// A shadow ray stopping short of the only instance on its line
+	const Ray toFar( Point3( 4, 0, -20 ), Vector3( 0, 0, 1 ) );
+	Check( pArray->IntersectRay_IntersectionOnly( toFar, 30, true, true ), "reaches the scaled copy" );
+	Check( !pArray->IntersectRay_IntersectionOnly( toFar, 17.5, true, true ), "but not when stopped short of it" );
+
+	for( size_t i = 0; i < refs.size(); i++ ) refs[i]->release();
+	pArrayObj->release();
+	pArray->release();
+	pSphere->release();
+}
+
+// A tessellated unit sphere of n x n quads, enough triangles that its
+// BVH is several levels deep
+static TriangleMeshGeometryIndexed* MakeMesh( const int n )
+{
+	TriangleMeshGeometryIndexed* pMesh = new TriangleMeshGeometryIndexed( false, false );
+	pMesh->BeginIndexedTriangles();
+	for( int j = 0; j <= n; j++ ) {
+		for( int i = 0; i <= n; i++ ) {
+			const Scalar th = PI * j / n, ph = TWO_PI * i / n;
+			const Vector3 d( sin( th ) * cos( ph ), cos( th ), sin( th ) * sin( ph ) );
+			pMesh->AddVertex( Point3( d.x, d.y, d.z ) );
+			pMesh->AddNormal( d );
+			pMesh->AddTexCoord( Point2( Scalar(i) / n, Scalar(j) / n ) );
+		}
+	}
+	for( int j = 0; j < n; j++ ) {
+		for( int i = 0; i < n; i++ ) {
+			const unsigned int a = j*(n+1) + i, b = a + 1, c = a + (n+1), d = c + 1;
+			const unsigned int quads[2][3] = { { a, c, b }, { b, c, d } };
+			for( int q = 0; q < 2; q++ ) {
+				IndexedTriangle tri;
+				for( int k = 0; k < 3; k++ ) {
+					tri.iVertices[k] = tri.iNormals[k] = tri.iCoords[k] = quads[q][k];
+				}
+				pMesh->AddIndexedTriangle( tri );
+			}
+		}
+	}
+	pMesh->DoneIndexedTriangles();
+	return pMesh;
+}
+
+static void TestMeshChildren()
+{
+	std::cout << "Test: triangle mesh children" << std::endl;
+
+	// The mesh and the array both keep a BVH over unsigned int, so the
+	// mesh's traversal runs nested inside the array's on the same
+	// thread.  A grid of many copies makes the array's BVH deep enough
+	// that rays leave nodes pending while a mesh is being traversed.
+	TriangleMeshGeometryIndexed* pMesh = MakeMesh( 32 );
+	std::vector<Matrix4> placements;
+	for( int k = 0; k < 4; k++ ) {
+		for( int j = 0; j < 4; j++ ) {
+			for( int i = 0; i < 4; i++ ) {
+				placements.push_back( Matrix4Ops::Translation( Vector3( 2.5*i - 3.75, 2.5*j - 3.75, 3.0*k ) ) *
+					Matrix4Ops::YRotation( 0.4*(i+j+k) ) * Matrix4Ops::Stretch( Vector3( 1, 0.8 + 0.1*k, 1 ) ) );
+			}
+		}
+	}
+	InstanceArrayGeometry* pArray = MakeArray( *pMesh, placements );
+	pArray->Realize();
+	Check( pArray->IsRealized() && pArray->NumInstances() == 64, "realized with 64 instances" );
+
+	Object* pArrayObj = Place( pArray, Matrix4Ops::Identity() );
+	std::vector<Object*> refs;
+	for( unsigned int i = 0; i < pArray->NumInstances(); i++ ) {
+		refs.push_back( Place( pMesh, pArray->GetInstance( i ).Get() ) );
+	}
+
+	unsigned int hits = 0, hitsMissed = 0, pointsWrong = 0, shadowsMissed = 0;
+	for( Scalar y = -5.5; y <= 5.5; y += 0.13 ) {
+		for( Scalar x = -5.5; x <= 5.5; x += 0.13 ) {
+			// Slanted so most rays pass several copies
+			const Ray ray( Point3( x, y, -10 ), Vector3Ops::Normalize( Vector3( 0.15, 0.1, 1 ) ) );
+
+			RayIntersection best( ray, nullRasterizerState );
+			best.geometric.range = RISE_INFINITY;
+			bool refShadow = false;
+			for( size_t i = 0; i < refs.size(); i++ ) {
+				RayIntersection ri( ray, nullRasterizerState );
+				refs[i]->IntersectRay( ri, RISE_INFINITY, true, true, false );
+				if( ri.geometric.bHit && ri.geometric.range < best.geometric.range ) {
+					best = ri;
+				}
+				refShadow = refShadow || refs[i]->IntersectRay_IntersectionOnly( ray, RISE_INFINITY, true, true );
+			}
+
+			RayIntersection ri( ray, nullRasterizerState );
+			pArrayObj->IntersectRay( ri, RISE_INFINITY, true, true, false );
+			if( refShadow && !pArrayObj->IntersectRay_IntersectionOnly( ray, RISE_INFINITY, true, true ) ) shadowsMissed++;
+			if( !best.geometric.bHit ) continue;
+
+			hits++;
+			if( !ri.geometric.bHit ) { hitsMissed++; continue; }
+			if( !Near( ri.geometric.range, best.geometric.range ) || !Near( ri.geometric.ptIntersection, best.geometric.ptIntersection ) ) pointsWrong++;
+		}
+	}
+	Check( hits > 2000, "the grid hits the copies" );
+	Check( hitsMissed == 0, "no closest hit is lost" );
+	Check( pointsWrong == 0, "closest hits land on the nearest copy" );
+	Check( shadowsMissed == 0, "no shadow hit is lost" );
+
+	for( size_t i = 0; i < refs.size(); i++ ) refs[i]->release();
+	pArrayObj->release();
+	pArray->release();
+	pMesh->release();
+}
+
+static void TestBoundsAndArea()
+{
+	std::cout << "Test: bounds, area and sampling" << std::endl;
+
+	SphereGeometry* pSphere = new SphereGeometry( 1.0 );
+	InstanceArrayGeometry* pArray = MakeArray( *pSphere, Placements() );
+
+	const BoundingBox box = pArray->GenerateBoundingBox();
+	Check( Near( box.ur.x, 6 ) && Near( box.ll.y, -5 ) && box.ur.y >= 2, "box spans every instance" );
+	Check( box.ll.z <= -1.5 && box.ur.z >= 2.5, "including the stretched one" );
+
+	// Unrealized arrays report a miss rather than a half-built answer
+	RayIntersectionGeometric rig( Ray( Point3( 0, 0, -10 ), Vector3( 0, 0, 1 ) ), nullRasterizerState );
+	pArray->IntersectRay( rig, true, true, false );
+	Check( !rig.bHit && !pArray->IsRealized(), "misses before Realize" );
+
+	pArray->Realize();
+	const Scalar sphere = pSphere->GetArea();
+	Check( Near( pArray->GetArea(), sphere * ( 1 + 4 + 1 + 1 ), 1e-3 ), "area sums the instances" );
+
+	// Every sample lies on one of the instances
+	bool onSurface = true;
+	std::vector<Matrix4> inverses;
+	for( unsigned int i = 0; i < pArray->NumInstances(); i++ ) {
+		inverses.push_back( Matrix4Ops::Inverse( pArray->GetInstance( i ).Get() ) );
+	}
+	for( unsigned int s = 0; s < 200; s++ ) {
+		Point3 p; Vector3 n; Point2 uv;
+		pArray->UniformRandomPoint( &p, &n, &uv, Point3( (s+0.5)/200.0, std::fmod( s*0.618, 1.0 ), std::fmod( s*0.382, 1.0 ) ) );
+		bool onOne = false;
+		for( size_t i = 0; i < inverses.size(); i++ ) {
+			const Point3 q = Point3Ops::Transform( inverses[i], p );
+			if( Near( std::sqrt( q.x*q.x + q.y*q.y + q.z*q.z ), 1, 1e-4 ) ) onOne = true;
+		}
+		if( !onOne || !Near( Vector3Ops::Magnitude( n ), 1, 1e-6 ) ) onSurface = false;
+	}
+	Check( onSurface, "samples lie on the instances with unit normals" );
+
+	// BVH elements are instance indices and write out as such
+	MemoryBuffer* pBuffer = new MemoryBuffer();
+	pArray->SerializeElement( *pBuffer, 3 );
+	pArray->SerializeElement( *pBuffer, 1 );
+	pBuffer->seek( IBuffer::START, 0 );
+	unsigned int e0 = 0, e1 = 0;
+	pArray->DeserializeElement( *pBuffer, e0 );
+	pArray->DeserializeElement( *pBuffer, e1 );
+	Check( e0 == 3 && e1 == 1, "elements round trip through a buffer" );
+	pBuffer->release();
+
+	pArray->release();
+	pSphere->release();
+}
+
+static void TestCreation()
+{
+	std::cout << "Test: creation" << std::endl;
+
+	SphereGeometry* pSphere = new SphereGeometry( 1.0 );
+	const std::vector<Matrix4> placements = Placements();
+	std::vector<Scalar> m( placements.size() * 16 );
+	for( size_t i = 0; i < placements.size(); i++ ) ToColumnMajor( placements[i], &m[i*16] );
+
+	IGeometry* pArray = 0;
+	Check( RISE_API_CreateInstanceArrayGeometry( &pArray, pSphere, 4, &m[0] ) && pArray, "created through the API" );
+
+	IGeometry* pNested = 0;
+	Check( !RISE_API_CreateInstanceArrayGeometry( &pNested, pArray, 4, &m[0] ) && !pNested, "an array of arrays is refused" );
+	Check( !RISE_API_CreateInstanceArrayGeometry( &pNested, pSphere, 4, 0 ), "missing matrices are refused" );
+
+	// An empty array is legal and hits nothing
+	IGeometry* pEmpty = 0;
+	Check( RISE_API_CreateInstanceArrayGeometry( &pEmpty, pSphere, 0, 0 ) && pEmpty, "an empty array is created" );
+	pEmpty->Realize();
+	Check( !pEmpty->IntersectRay_IntersectionOnly( Ray( Point3( 0, 0, -10 ), Vector3( 0, 0, 1 ) ), RISE_INFINITY, true, true ), "and hits nothing" );
+
+	pEmpty->release();
+	pArray->release();
+	pSphere->release();
+}
+
+int main()
+{
+	std::cout << "=== Instance Array Geometry Tests ===" << std::endl;
+
+	TestAgainstObjects();
+	TestMeshChildren();
+	TestBoundsAndArea();
+	TestCreation();
+
+	std::cout << std::endl << "Passed: " << passCount << "  Failed: " << failCount << std::endl;
+	return failCount > 0 ? 1 : 0;
+}
@@ -0,0 +1,192 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  InteractiveCheckerboardTest.cpp - Tests for the live-drag
+//  checkerboard pass
+//
+//  FillCheckerboardBlock must rewrite exactly the untraced parity of
+//  a block, each pixel as the average of its traced 4-neighbours that
+//  lie inside the block, and must never read or write outside the
+//  block or below the last traced row.  SetLiveCheckerboard must be
+//  gated by Config::liveCheckerboard.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <iostream>
+
+#include "../src/Library/Rendering/InteractivePelRasterizer.h"
+#include "../src/Library/RasterImages/RasterImage.h"
+
+using namespace RISE;
+using namespace RISE::Implementation;
+
+static int passCount = 0;
+static int failCount = 0;
+
+static void Check( bool cond, const char* name )
+{
+	if( cond ) { ++passCount; }
+	else { ++failCount; std::cout << "  FAIL: " << name << std::endl; }
+}
+
+// Exposes the protected pieces under test
+class TestRasterizer : public InteractivePelRasterizer
+{
+public:
+	// The virtual bases have to be constructed by the most derived class
+	TestRasterizer( const Config& cfg ) :
+	  Rasterizer( 0 ),
+	  PixelBasedRasterizerHelper( 0, 0 ),
+	  InteractivePelRasterizer( 0, cfg )
+	{}
+
+	void Fill( IRasterImage& image, const Rect& rect, const unsigned int lastRow ) const
+	{
+		FillCheckerboardBlock( image, rect, lastRow );
+	}
+
+	bool Armed() const { return mCheckerboardPass; }
+};
+
+static const Scalar kSentinel = -1.0;
+
+static Scalar Traced( unsigned int x, unsigned int y )
+{
+	return Scalar( x*7 + y*13 );
+}
+
+static bool Near( Scalar a, Scalar b )
+{
+	return std::fabs( a - b ) < 1e-9;
+}
+
+// Traced parity gets a position-dependent value, the other parity a
+// sentinel that the fill has to replace
+static RasterImage_Template<RISEPel>* MakeImage( unsigned int w, unsigned int h )
+{
+	RasterImage_Template<RISEPel>* img = new RasterImage_Template<RISEPel>(
+		w, h, RISEColor( RISEPel( kSentinel, kSentinel, kSentinel ), 1.0 ) );
+	for( unsigned int y = 0; y < h; y++ ) {
+		for( unsigned int x = 0; x < w; x++ ) {
+			if( ((x + y) & 1) == 0 ) {
+				const Scalar v = Traced( x, y );
+				img->SetPEL( x, y, RISEColor( RISEPel( v, v, v ), 0.5 ) );
+			}
+		}
+	}
+	return img;
+}
+
+static void TestFill()
+{
+	std::cout << "Test: checkerboard fill" << std::endl;
+
+	TestRasterizer* rast = new TestRasterizer( InteractivePelRasterizer::Config() );
+	RasterImage_Template<RISEPel>* img = MakeImage( 12, 10 );
+
+	// An odd-aligned block in the middle of the image
+	const Rect rect( 3, 2, 8, 7 );
+	rast->Fill( *img, rect, rect.bottom );
+
+	bool tracedKept = true, insideFilled = true, outsideKept = true, averaged = true;
+	for( unsigned int y = 0; y < 10; y++ ) {
+		for( unsigned int x = 0; x < 12; x++ ) {
+			const RISEColor c = img->GetPEL( x, y );
+			const bool inside = x >= rect.left && x <= rect.right && y >= rect.top && y <= rect.bottom;
+			if( ((x + y) & 1) == 0 ) {
+				if( !Near( c.base[0], Traced( x, y ) ) ) tracedKept = false;
+				continue;
+			}
+			if( !inside ) {
+				if( !Near( c.base[0], kSentinel ) ) outsideKept = false;
+				continue;
+			}
+
+			Scalar sum = 0;
+			unsigned int n = 0;
+			if( x > rect.left )   { sum += Traced( x-1, y ); n++; }
+			if( x < rect.right )  { sum += Traced( x+1, y ); n++; }
+			if( y > rect.top )    { sum += Traced( x, y-1 ); n++; }
+			if( y < rect.bottom ) { sum += Traced( x, y+1 ); n++; }
+			if( Near( c.base[0], kSentinel ) ) insideFilled = false;
+			if( !Near( c.base[0], sum / n ) || !Near( c.base[2], sum / n ) || !Near( c.a, 0.5 ) ) averaged = false;
+		}
+	}
+	Check( tracedKept, "traced pixels untouched" );
+	Check( insideFilled, "every untraced pixel in the block filled" );
+	Check( averaged, "filled with the mean of in-block neighbours" );
+	Check( outsideKept, "nothing outside the block written" );
+
+	img->release();
+	rast->release();
+}
+
+static void TestFillStopsAtLastRow()
+{
+	std::cout << "Test: a cancelled block fills only its traced rows" << std::endl;
+
+	TestRasterizer* rast = new TestRasterizer( InteractivePelRasterizer::Config() );
+	RasterImage_Template<RISEPel>* img = MakeImage( 8, 8 );
+
+	// Rows 4..7 were never traced: sentinel them as well
+	for( unsigned int y = 4; y < 8; y++ ) {
+		for( unsigned int x = 0; x < 8; x++ ) {
+			img->SetPEL( x, y, RISEColor( RISEPel( kSentinel, kSentinel, kSentinel ), 1.0 ) );
+		}
+	}
+	rast->Fill( *img, Rect( 0, 0, 7, 7 ), 3 );
+
+	bool filledAbove = true, untouchedBelow = true;
+	for( unsigned int y = 0; y < 8; y++ ) {
+		for( unsigned int x = 0; x < 8; x++ ) {
+			const Scalar v = img->GetPEL( x, y ).base[0];
+			if( y <= 3 && Near( v, kSentinel ) ) filledAbove = false;
+			if( y > 3 && !Near( v, kSentinel ) ) untouchedBelow = false;
+		}
+	}
+	Check( filledAbove, "rows up to the last traced row filled" );
+	Check( untouchedBelow, "no neighbour borrowed from untraced rows" );
+
+	img->release();
+	rast->release();
+}
+
+static void TestGating()
+{
+	std::cout << "Test: SetLiveCheckerboard honours the config" << std::endl;
+
+	InteractivePelRasterizer::Config cfg;
+	Check( cfg.liveCheckerboard, "enabled by default" );
+
+	TestRasterizer* on = new TestRasterizer( cfg );
+	Check( !on->Armed(), "not armed at construction" );
+	on->SetLiveCheckerboard( true );
+	Check( on->Armed(), "armed on request" );
+	on->SetLiveCheckerboard( false );
+	Check( !on->Armed(), "disarmed on request" );
+	on->release();
+
+	cfg.liveCheckerboard = false;
+	TestRasterizer* off = new TestRasterizer( cfg );
+	off->SetLiveCheckerboard( true );
+	Check( !off->Armed(), "ignored when the config disables it" );
+	off->release();
+}
+
+int main()
+{
+	std::cout << "=== Interactive Checkerboard Tests ===" << std::endl;
+
+	TestFill();
+	TestFillStopsAtLastRow();
+	TestGating();
+
+	std::cout << std::endl << "Passed: " << passCount << "  Failed: " << failCount << std::endl;
+	return failCount > 0 ? 1 : 0;
+}
@@ -2,6 +2,7 @@
 #include <vector>
 #include <cassert>
 #include <cmath>
+#include <thread>
 #include "../src/Library/PhotonMapping/IrradianceCache.h"
 
 using namespace RISE;
@@ -241,6 +242,129 @@ void TestQueryUsesSofterThresholdThanSampleNeeded() {
 	std::cout << "IrradianceCache query/sample threshold split Passed!" << std::endl;
 }
 
+namespace {
+	// Deterministic scatter of records over a bumpy floor, so the tree
+	// gets records at several depths
+	void MakeRecord(const unsigned int i, Point3& p, Vector3& n, RISEPel& c, Scalar& r0) {
+		const Scalar u = Scalar((i * 7919u) % 1000u) / 1000.0;
+		const Scalar v = Scalar((i * 104729u) % 997u) / 997.0;
+		p = Point3(u * 10.0 - 5.0, 0.05 * std::sin(u * 31.0), v * 10.0 - 5.0);
+		n = Vector3Ops::Normalize(Vector3(0.1 * std::cos(v * 17.0), 1.0, 0.0));
+		c = RISEPel(u, v, 0.5);
+		r0 = 0.2 + 2.0 * Scalar(i % 13) / 13.0;
+	}
+}
+
+void TestConcurrentInsertsMatchSerial() {
+	std::cout << "Testing IrradianceCache concurrent inserts..." << std::endl;
+
+	const unsigned int numRecords = 4000;
+	const unsigned int numThreads = 8;
+
+	IrradianceCache* pSerial = new IrradianceCache(16.0, 0.2, 0.01, 100.0, 0.5, 0.0);
+	IrradianceCache* pParallel = new IrradianceCache(16.0, 0.2, 0.01, 100.0, 0.5, 0.0);
+
+	for (unsigned int i = 0; i < numRecords; i++) {
+		Point3 p; Vector3 n; RISEPel c; Scalar r0;
+		MakeRecord(i, p, n, c, r0);
+		pSerial->InsertElement(p, n, c, r0, 0, 0);
+	}
+
+	// Writers and readers run against the live tree together, the way
+	// the irradiance prepass mixes IsSampleNeeded with InsertElement
+	std::vector<std::thread> threads;
+	for (unsigned int t = 0; t < numThreads; t++) {
+		threads.push_back(std::thread([pParallel, t, numThreads]() {
+			for (unsigned int i = t; i < numRecords; i += numThreads) {
+				Point3 p; Vector3 n; RISEPel c; Scalar r0;
+				MakeRecord(i, p, n, c, r0);
+				pParallel->InsertElement(p, n, c, r0, 0, 0);
+				pParallel->IsSampleNeeded(p, n);
+				pParallel->WouldInterpolate(p, n, 2);
+			}
+		}));
+	}
+	for (unsigned int t = 0; t < numThreads; t++) {
+		threads[t].join();
+	}
+
+	assert(pSerial->NumRecords() == numRecords);
+	assert(pParallel->NumRecords() == numRecords);
+
+	pSerial->FinishedPrecomputation();
+	pParallel->FinishedPrecomputation();
+
+	// Insert order differs, so compare the weight sums and the record
+	// counts rather than the result order
+	for (unsigned int q = 0; q < 500; q++) {
+		Point3 p; Vector3 n; RISEPel c; Scalar r0;
+		MakeRecord(q * 3 + 1, p, n, c, r0);
+		p = Point3(p.x + 0.037, p.y, p.z - 0.021);
+
+		std::vector<IIrradianceCache::CacheElement> a, b;
+		const Scalar wa = pSerial->Query(p, n, a);
+		const Scalar wb = pParallel->Query(p, n, b);
+		assert(a.size() == b.size());
+		assert(IsClose(wa, wb, 1e-6 * (1.0 + wa)));
+		assert(pSerial->IsSampleNeeded(p, n) == pParallel->IsSampleNeeded(p, n));
+	}
+
+	safe_release(pSerial);
+	safe_release(pParallel);
+	std::cout << "IrradianceCache concurrent inserts Passed!" << std::endl;
+}
+
+void TestFlatSnapshotMatchesTree() {
+	std::cout << "Testing IrradianceCache flat snapshot..." << std::endl;
+
+	IrradianceCache* pCache = new IrradianceCache(16.0, 0.2, 0.01, 100.0, 0.5, 0.5);
+	for (unsigned int i = 0; i < 2000; i++) {
+		Point3 p; Vector3 n; RISEPel c; Scalar r0;
+		MakeRecord(i, p, n, c, r0);
+		pCache->InsertElement(p, n, c, r0, 0, 0);
+	}
+
+	// Answers from the pointer octree, taken before the flatten
+	std::vector< std::vector<IIrradianceCache::CacheElement> > before;
+	std::vector<Scalar> beforeWeights;
+	std::vector<bool> beforeNeeded;
+	for (unsigned int q = 0; q < 300; q++) {
+		Point3 p; Vector3 n; RISEPel c; Scalar r0;
+		MakeRecord(q * 5 + 2, p, n, c, r0);
+		p = Point3(p.x - 0.013, p.y, p.z + 0.029);
+		before.push_back(std::vector<IIrradianceCache::CacheElement>());
+		beforeWeights.push_back(pCache->Query(p, n, before.back()));
+		beforeNeeded.push_back(pCache->IsSampleNeeded(p, n));
+	}
+
+	pCache->FinishedPrecomputation();
+
+	// Same records, same order, bit-identical weights
+	for (unsigned int q = 0; q < 300; q++) {
+		Point3 p; Vector3 n; RISEPel c; Scalar r0;
+		MakeRecord(q * 5 + 2, p, n, c, r0);
+		p = Point3(p.x - 0.013, p.y, p.z + 0.029);
+		std::vector<IIrradianceCache::CacheElement> after;
+		const Scalar w = pCache->Query(p, n, after);
+		assert(w == beforeWeights[q]);
+		assert(after.size() == before[q].size());
+		for (size_t k = 0; k < after.size(); k++) {
+			assert(after[k].dWeight == before[q][k].dWeight);
+			assert(after[k].ptPosition.x == before[q][k].ptPosition.x);
+			assert(IsPelClose(after[k].cIRad, before[q][k].cIRad, 0));
+		}
+		assert(pCache->IsSampleNeeded(p, n) == beforeNeeded[q]);
+	}
+
+	// Clear drops the snapshot and the tree, root records included
+	pCache->Clear();
+	assert(!pCache->Precomputed());
+	assert(pCache->NumRecords() == 0);
+
+	safe_release(pCache);
+	std::cout << "IrradianceCache flat snapshot Passed!" << std::endl;
+}
+
 int main() {
 	TestGradientDataRoundTripsThroughQuery();
 	TestNullGradientsDefaultToZero();
@@ -249,5 +373,7 @@ int main() {
 	TestNeighborCellReuseAcrossBoundary();
 	TestWeightFallsOffWithDistanceAndAngle();
 	TestQueryUsesSofterThresholdThanSampleNeeded();
+	TestConcurrentInsertsMatchSerial();
+	TestFlatSnapshotMatchesTree();
 	return 0;
 }
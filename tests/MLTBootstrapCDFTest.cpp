@@ -0,0 +1,124 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  MLTBootstrapCDFTest.cpp - Tests for the MLT bootstrap CDF
+//
+//  MLTRasterizer::BuildBootstrapCDF must give bit-identical results
+//  for every thread count, must agree with a plain serial running sum
+//  to rounding, must end at 1 and never decrease, and must leave an
+//  all-zero input alone.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "../src/Library/Rendering/MLTRasterizer.h"
+#include "../src/Library/Utilities/RandomNumbers.h"
+
+using namespace RISE;
+using namespace RISE::Implementation;
+
+static int passCount = 0;
+static int failCount = 0;
+
+static void Check( bool cond, const char* name )
+{
+	if( cond ) { ++passCount; }
+	else { ++failCount; std::cout << "  FAIL: " << name << std::endl; }
+}
+
+// Mostly dark samples with rare bright ones, like a caustic scene
+static std::vector<Scalar> Luminances( const unsigned int n )
+{
+	RandomNumberGenerator rng( 1234 );
+	std::vector<Scalar> lum( n );
+	for( unsigned int i = 0; i < n; i++ ) {
+		const Scalar u = rng.CanonicalRandom();
+		lum[i] = u < 0.7 ? 0 : ( u < 0.99 ? u * 0.01 : u * 1000.0 );
+	}
+	return lum;
+}
+
+static void TestThreadCountInvariance( const unsigned int n )
+{
+	std::cout << "Test: " << n << " samples" << std::endl;
+
+	const std::vector<Scalar> lum = Luminances( n );
+
+	std::vector<Scalar> serial( lum );
+	const Scalar serialTotal = MLTRasterizer::BuildBootstrapCDF( serial, 1 );
+
+	bool identical = true;
+	const unsigned int threadCounts[] = { 2, 3, 8, 64 };
+	for( unsigned int t = 0; t < 4; t++ ) {
+		std::vector<Scalar> cdf( lum );
+		const Scalar total = MLTRasterizer::BuildBootstrapCDF( cdf, threadCounts[t] );
+		if( total != serialTotal || memcmp( &cdf[0], &serial[0], n * sizeof( Scalar ) ) != 0 ) {
+			identical = false;
+		}
+	}
+	Check( identical, "bit-identical for 1, 2, 3, 8 and 64 threads" );
+
+	Scalar running = 0;
+	Scalar worst = 0;
+	bool monotonic = true;
+	for( unsigned int i = 0; i < n; i++ ) {
+		running += lum[i];
+		if( i > 0 && serial[i] < serial[i-1] ) {
+			monotonic = false;
+		}
+	}
+	Check( std::fabs( serialTotal - running ) <= 1e-12 * running, "total matches a serial sum" );
+	running = 0;
+	for( unsigned int i = 0; i < n; i++ ) {
+		running += lum[i];
+		const Scalar d = std::fabs( serial[i] - running / serialTotal );
+		if( d > worst ) {
+			worst = d;
+		}
+	}
+	Check( worst < 1e-12, "CDF matches a serial running sum" );
+	Check( monotonic, "never decreases" );
+	Check( std::fabs( serial[n-1] - 1.0 ) < 1e-15, "ends at 1" );
+}
+
+static void TestDegenerate()
+{
+	std::cout << "Test: degenerate inputs" << std::endl;
+
+	std::vector<Scalar> zeros( 40000, 0 );
+	Check( MLTRasterizer::BuildBootstrapCDF( zeros, 4 ) == 0, "all-zero total is 0" );
+	bool allZero = true;
+	for( size_t i = 0; i < zeros.size(); i++ ) {
+		if( zeros[i] != 0 ) allZero = false;
+	}
+	Check( allZero, "all-zero CDF left at 0" );
+
+	std::vector<Scalar> empty;
+	Check( MLTRasterizer::BuildBootstrapCDF( empty, 4 ) == 0 && empty.empty(), "empty input" );
+
+	std::vector<Scalar> one( 1, 3.5 );
+	Check( MLTRasterizer::BuildBootstrapCDF( one, 4 ) == 3.5 && std::fabs( one[0] - 1.0 ) < 1e-15, "single sample" );
+}
+
+int main()
+{
+	std::cout << "=== MLT Bootstrap CDF Tests ===" << std::endl;
+
+	// Below one block, exactly one block, and many uneven blocks
+	TestThreadCountInvariance( 1000 );
+	TestThreadCountInvariance( 16384 );
+	TestThreadCountInvariance( 100003 );
+	TestDegenerate();
+
+	std::cout << std::endl << "Passed: " << passCount << "  Failed: " << failCount << std::endl;
+	return failCount > 0 ? 1 : 0;
+}
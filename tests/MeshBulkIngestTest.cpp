@@ -0,0 +1,351 @@
+// MeshBulkIngestTest.cpp
+//
+// The binary PLY loader reads fixed-layout elements a slab at a time and
+// converts them on the thread pool; the RAW2 loader reads its file in one
+// go and parses the lines on the thread pool.  This test loads the same
+// few-hundred-thousand-triangle grid through those paths and through the
+// ASCII PLY path (which still reads one value at a time) and checks they
+// build identical meshes.
+//
+// Coverage:
+//   - Binary little-endian float xyz + normals + uchar colors, more
+//     faces than one slab holds
+//   - Binary big-endian double xyz, ushort list counts, an extra face
+//     property and an extra element that is skipped
+//   - A quad among the faces, which sends the face element back to the
+//     per-value path
+//   - Inverted faces
+//   - A truncated file fails to load
+//   - RAW2 positions / normals / coords / colors / triangles, and a bad
+//     vertex line deep in the file failing the load
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../src/Library/Geometry/TriangleMeshLoaderPLY.h"
+#include "../src/Library/Geometry/TriangleMeshLoaderRAW2.h"
+#include "../src/Library/Geometry/TriangleMeshGeometryIndexed.h"
+
+using namespace RISE;
+using namespace RISE::Implementation;
+
+static int passCount = 0;
+static int failCount = 0;
+
+static void Check( bool condition, const char* testName )
+{
+	if( condition ) {
+		passCount++;
+	} else {
+		failCount++;
+		std::cout << "  FAIL: " << testName << std::endl;
+	}
+}
+
+namespace
+{
+	std::string TempPath( const char* suffix )
+	{
+		static std::atomic<unsigned> counter{ 0 };
+		const auto stamp = std::chrono::steady_clock::now().time_since_epoch().count();
+		std::string name = "rise_mesh_bulk_test_";
+		name += std::to_string( static_cast<unsigned long long>( stamp ) );
+		name += "_";
+		name += std::to_string( counter.fetch_add( 1 ) );
+		name += suffix;
+		return ( std::filesystem::temp_directory_path() / name ).string();
+	}
+
+	// A G x G grid of vertices, two triangles per cell, on coordinates
+	// that print exactly in ASCII.  With `quadAtEnd` the last cell is one
+	// quad instead.
+	struct Grid
+	{
+		std::vector<float>			xyz;
+		std::vector<unsigned char>	rgb;
+		std::vector<unsigned int>	faces;		// count, then the indices
+	};
+
+	Grid MakeGrid( const unsigned int G, const bool quadAtEnd )
+	{
+		Grid g;
+		for( unsigned int j = 0; j < G; ++j ) {
+			for( unsigned int i = 0; i < G; ++i ) {
+				g.xyz.push_back( 0.125f * i );
+				g.xyz.push_back( 0.25f * j );
+				g.xyz.push_back( 0.0625f * ( (i * 7 + j * 3) % 11 ) );
+				g.rgb.push_back( (unsigned char)( i % 256 ) );
+				g.rgb.push_back( (unsigned char)( j % 256 ) );
+				g.rgb.push_back( (unsigned char)( (i + j) % 256 ) );
+			}
+		}
+		for( unsigned int j = 0; j + 1 < G; ++j ) {
+			for( unsigned int i = 0; i + 1 < G; ++i ) {
+				const unsigned int a = j*G + i, b = a + 1, c = a + G + 1, d = a + G;
+				if( quadAtEnd && j + 2 == G && i + 2 == G ) {
+					g.faces.insert( g.faces.end(), { 4, a, b, c, d } );
+				} else {
+					g.faces.insert( g.faces.end(), { 3, a, b, c } );
+					g.faces.insert( g.faces.end(), { 3, a, c, d } );
+				}
+			}
+		}
+		return g;
+	}
+
+	unsigned int NumFaces( const Grid& g )
+	{
+		unsigned int n = 0;
+		for( size_t k = 0; k < g.faces.size(); k += 1 + g.faces[k] ) ++n;
+		return n;
+	}
+
+	void WriteAscii( const std::string& path, const Grid& g, const bool colors )
+	{
+		FILE* f = std::fopen( path.c_str(), "wb" );
+		const size_t nv = g.xyz.size() / 3;
+		std::fprintf( f, "ply\nformat ascii 1.0\nelement vertex %zu\n", nv );
+		std::fprintf( f, "property float x\nproperty float y\nproperty float z\n" );
+		if( colors ) std::fprintf( f, "property uchar red\nproperty uchar green\nproperty uchar blue\n" );
+		std::fprintf( f, "element face %u\nproperty list uchar int vertex_indices\nend_header\n", NumFaces( g ) );
+		for( size_t v = 0; v < nv; ++v ) {
+			std::fprintf( f, "%.9g %.9g %.9g", g.xyz[3*v], g.xyz[3*v+1], g.xyz[3*v+2] );
+			if( colors ) std::fprintf( f, " %u %u %u", g.rgb[3*v], g.rgb[3*v+1], g.rgb[3*v+2] );
+			std::fprintf( f, "\n" );
+		}
+		for( size_t k = 0; k < g.faces.size(); k += 1 + g.faces[k] ) {
+			std::fprintf( f, "%u", g.faces[k] );
+			for( unsigned int m = 1; m <= g.faces[k]; ++m ) std::fprintf( f, " %u", g.faces[k+m] );
+			std::fprintf( f, "\n" );
+		}
+		std::fclose( f );
+	}
+
+	// Writes `bytes` bytes of v, byte-swapped when `bigEndian` (this test
+	// runs on little-endian hosts, as the loader's binary path assumes)
+	void Put( FILE* f, const void* v, const size_t bytes, const bool bigEndian )
+	{
+		unsigned char b[8];
+		std::memcpy( b, v, bytes );
+		if( bigEndian ) {
+			for( size_t i = 0; i < bytes / 2; ++i ) std::swap( b[i], b[bytes-1-i] );
+		}
+		std::fwrite( b, 1, bytes, f );
+	}
+
+	// Little-endian: float xyz + float normals + uchar colors, faces as
+	// "list uchar uint".  Big-endian: double xyz, a skipped "material"
+	// element, faces as "uchar flags" + "list ushort int".
+	void WriteBinary( const std::string& path, const Grid& g, const bool bigEndian, const size_t truncateBy = 0 )
+	{
+		FILE* f = std::fopen( path.c_str(), "wb" );
+		const size_t nv = g.xyz.size() / 3;
+		std::fprintf( f, "ply\nformat %s 1.0\n", bigEndian ? "binary_big_endian" : "binary_little_endian" );
+		std::fprintf( f, "element vertex %zu\n", nv );
+		if( bigEndian ) {
+			std::fprintf( f, "property double x\nproperty double y\nproperty double z\n" );
+			std::fprintf( f, "element material 2\nproperty float shine\nproperty uchar id\n" );
+			std::fprintf( f, "element face %u\nproperty uchar flags\nproperty list ushort int vertex_indices\nend_header\n", NumFaces( g ) );
+		} else {
+			std::fprintf( f, "property float x\nproperty float y\nproperty float z\n" );
+			std::fprintf( f, "property float nx\nproperty float ny\nproperty float nz\n" );
+			std::fprintf( f, "property uchar red\nproperty uchar green\nproperty uchar blue\n" );
+			std::fprintf( f, "element face %u\nproperty list uchar uint vertex_indices\nend_header\n", NumFaces( g ) );
+		}
+
+		for( size_t v = 0; v < nv; ++v ) {
+			if( bigEndian ) {
+				for( int k = 0; k < 3; ++k ) { const double d = g.xyz[3*v+k]; Put( f, &d, 8, true ); }
+			} else {
+				for( int k = 0; k < 3; ++k ) Put( f, &g.xyz[3*v+k], 4, false );
+				const float n[3] = { 0, 0, 1 };
+				for( int k = 0; k < 3; ++k ) Put( f, &n[k], 4, false );
+				for( int k = 0; k < 3; ++k ) Put( f, &g.rgb[3*v+k], 1, false );
+			}
+		}
+		if( bigEndian ) {
+			for( int m = 0; m < 2; ++m ) {
+				const float shine = 0.5f; const unsigned char id = (unsigned char)m;
+				Put( f, &shine, 4, true ); Put( f, &id, 1, true );
+			}
+		}
+		for( size_t k = 0; k < g.faces.size(); k += 1 + g.faces[k] ) {
+			if( bigEndian ) {
+				const unsigned char flags = 7; const unsigned short cnt = (unsigned short)g.faces[k];
+				Put( f, &flags, 1, true ); Put( f, &cnt, 2, true );
+			} else {
+				const unsigned char cnt = (unsigned char)g.faces[k];
+				Put( f, &cnt, 1, false );
+			}
+			for( unsigned int m = 1; m <= g.faces[k]; ++m ) Put( f, &g.faces[k+m], 4, bigEndian );
+		}
+		std::fclose( f );
+
+		if( truncateBy ) {
+			std::filesystem::resize_file( path, std::filesystem::file_size( path ) - truncateBy );
+		}
+	}
+
+	TriangleMeshGeometryIndexed* LoadPLY( const std::string& path, const bool invert, bool& ok )
+	{
+		TriangleMeshGeometryIndexed* pMesh = new TriangleMeshGeometryIndexed( false, false );
+		pMesh->addref();
+		TriangleMeshLoaderPLY* pLoader = new TriangleMeshLoaderPLY( path.c_str(), invert );
+		pLoader->addref();
+		ok = pLoader->LoadTriangleMesh( pMesh );
+		pLoader->release();
+		return pMesh;
+	}
+
+	bool SameMesh( const TriangleMeshGeometryIndexed& a, const TriangleMeshGeometryIndexed& b, const bool colors )
+	{
+		const auto& pa = a.getVertices();
+		const auto& pb = b.getVertices();
+		if( pa.size() != pb.size() || a.getFaces().size() != b.getFaces().size() ) return false;
+		for( size_t v = 0; v < pa.size(); ++v ) {
+			if( pa[v].x != pb[v].x || pa[v].y != pb[v].y || pa[v].z != pb[v].z ) return false;
+		}
+		for( size_t t = 0; t < a.getFaces().size(); ++t ) {
+			for( int k = 0; k < 3; ++k ) {
+				if( a.getFaces()[t].pVertices[k] - &pa[0] != b.getFaces()[t].pVertices[k] - &pb[0] ) return false;
+			}
+		}
+		if( colors ) {
+			const auto& ca = a.getColors();
+			const auto& cb = b.getColors();
+			if( ca.size() != pa.size() || cb.size() != pb.size() ) return false;
+			for( size_t v = 0; v < ca.size(); ++v ) {
+				if( ca[v].r != cb[v].r || ca[v].g != cb[v].g || ca[v].b != cb[v].b ) return false;
+			}
+		}
+		return true;
+	}
+
+	void TestPLY()
+	{
+		std::cout << "Testing binary PLY bulk path against the ASCII path..." << std::endl;
+
+		const unsigned int G = 380;		// 2*379*379 = 287282 faces, over one slab
+		for( int quad = 0; quad < 2; ++quad ) {
+			const Grid g = MakeGrid( G, quad != 0 );
+			const std::string ascii = TempPath( ".ply" ), asciiColor = TempPath( ".ply" ), le = TempPath( ".ply" ), be = TempPath( ".ply" );
+			WriteAscii( ascii, g, false );
+			WriteAscii( asciiColor, g, true );
+			WriteBinary( le, g, false );
+			WriteBinary( be, g, true );
+
+			for( int invert = 0; invert < 2; ++invert ) {
+				bool okA = false, okC = false, okL = false, okB = false;
+				TriangleMeshGeometryIndexed* mA = LoadPLY( ascii, invert != 0, okA );
+				TriangleMeshGeometryIndexed* mC = LoadPLY( asciiColor, invert != 0, okC );
+				TriangleMeshGeometryIndexed* mL = LoadPLY( le, invert != 0, okL );
+				TriangleMeshGeometryIndexed* mB = LoadPLY( be, invert != 0, okB );
+
+				const std::string tag = std::string( quad ? "with a quad" : "all triangles" ) + ( invert ? ", inverted" : "" );
+				Check( okA && okC && okL && okB, ( "all four files load, " + tag ).c_str() );
+				Check( mA->getFaces().size() == 2u*(G-1)*(G-1), ( "face count, " + tag ).c_str() );
+				Check( SameMesh( *mC, *mL, true ), ( "little-endian float + colors matches ASCII, " + tag ).c_str() );
+				Check( SameMesh( *mA, *mB, false ), ( "big-endian double + extra element matches ASCII, " + tag ).c_str() );
+
+				mA->release(); mC->release(); mL->release(); mB->release();
+			}
+
+			std::remove( ascii.c_str() ); std::remove( asciiColor.c_str() ); std::remove( le.c_str() ); std::remove( be.c_str() );
+		}
+
+		// A file that ends early fails, in the vertex block and in the face block
+		const Grid g = MakeGrid( 64, false );
+		const std::string shortFaces = TempPath( ".ply" ), shortVerts = TempPath( ".ply" );
+		WriteBinary( shortFaces, g, false, 5 );
+		WriteBinary( shortVerts, g, false, 13*NumFaces( g ) + 20 );
+		bool ok = true;
+		TriangleMeshGeometryIndexed* m = LoadPLY( shortFaces, false, ok );
+		Check( !ok, "truncated face block fails to load" );
+		m->release();
+		m = LoadPLY( shortVerts, false, ok );
+		Check( !ok, "truncated vertex block fails to load" );
+		m->release();
+		std::remove( shortFaces.c_str() ); std::remove( shortVerts.c_str() );
+	}
+
+	void TestRAW2()
+	{
+		std::cout << "Testing RAW2 bulk parse..." << std::endl;
+
+		const unsigned int G = 120;		// 14400 vertex lines, several pool blocks
+		const Grid g = MakeGrid( G, false );
+		const size_t nv = g.xyz.size() / 3;
+		const unsigned int nt = NumFaces( g );
+
+		for( int bad = 0; bad < 2; ++bad ) {
+			const std::string path = TempPath( ".raw2" );
+			FILE* f = std::fopen( path.c_str(), "wb" );
+			std::fprintf( f, "%zu %u\n", nv, nt );
+			for( size_t v = 0; v < nv; ++v ) {
+				if( bad && v == nv - 100 ) {
+					std::fprintf( f, "v 1 2 3\n" );
+					continue;
+				}
+				std::fprintf( f, "v %.9g %.9g %.9g 0 0 1 %.9g %.9g %.9g %.9g %.9g\n",
+					g.xyz[3*v], g.xyz[3*v+1], g.xyz[3*v+2], g.xyz[3*v], g.xyz[3*v+1],
+					g.rgb[3*v] / 255.0, g.rgb[3*v+1] / 255.0, g.rgb[3*v+2] / 255.0 );
+			}
+			for( size_t k = 0; k < g.faces.size(); k += 4 ) {
+				std::fprintf( f, "t %u %u %u\r\n", g.faces[k+1], g.faces[k+2], g.faces[k+3] );
+			}
+			std::fclose( f );
+
+			TriangleMeshGeometryIndexed* pMesh = new TriangleMeshGeometryIndexed( false, false );
+			pMesh->addref();
+			TriangleMeshLoaderRAW2* pLoader = new TriangleMeshLoaderRAW2( path.c_str() );
+			pLoader->addref();
+			const bool ok = pLoader->LoadTriangleMesh( pMesh );
+
+			if( bad ) {
+				Check( !ok, "RAW2 with a short vertex line fails to load" );
+			} else {
+				Check( ok, "RAW2 loads" );
+				const auto& pts = pMesh->getVertices();
+				const auto& nrm = pMesh->getNormals();
+				const auto& crd = pMesh->getCoords();
+				const auto& col = pMesh->getColors();
+				bool same = pts.size() == nv && nrm.size() == nv && crd.size() == nv && col.size() == nv;
+				for( size_t v = 0; same && v < nv; ++v ) {
+					same = pts[v].x == g.xyz[3*v] && pts[v].y == g.xyz[3*v+1] && pts[v].z == g.xyz[3*v+2] &&
+						nrm[v].z == 1.0 && crd[v].x == g.xyz[3*v] && crd[v].y == g.xyz[3*v+1];
+					const RISEPel expected( sRGBPel( g.rgb[3*v] / 255.0, g.rgb[3*v+1] / 255.0, g.rgb[3*v+2] / 255.0 ) );
+					same = same && std::fabs( col[v].r - expected.r ) < 1e-6 && std::fabs( col[v].g - expected.g ) < 1e-6 && std::fabs( col[v].b - expected.b ) < 1e-6;
+				}
+				Check( same, "RAW2 positions, normals, coords and colors" );
+
+				bool faces = pMesh->getFaces().size() == nt;
+				for( size_t t = 0; faces && t < nt; ++t ) {
+					for( int k = 0; k < 3; ++k ) {
+						faces = faces && (unsigned int)( pMesh->getFaces()[t].pVertices[k] - &pts[0] ) == g.faces[4*t+1+k];
+					}
+				}
+				Check( faces, "RAW2 triangles, with CRLF line ends" );
+			}
+
+			pLoader->release();
+			pMesh->release();
+			std::remove( path.c_str() );
+		}
+	}
+}
+
+int main()
+{
+	std::cout << "Running MeshBulkIngestTest..." << std::endl;
+	TestPLY();
+	TestRAW2();
+	std::cout << std::endl << "Passed: " << passCount << "  Failed: " << failCount << std::endl;
+	return failCount > 0 ? 1 : 0;
+}
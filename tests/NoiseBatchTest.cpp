@@ -0,0 +1,325 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  NoiseBatchTest.cpp - Unit tests for the batched noise evaluation
+//    paths (IFunction3D::EvaluateBatch / EvaluateBatchFloat)
+//
+//  Tests:
+//    1. HashBlock3D matches Noise3D at every lattice point, including
+//       negative and very large lattice coordinates
+//    2. InterpolatedNoise3D batch is bit-identical to Evaluate
+//    3. PerlinNoise3D batch is bit-identical to Evaluate (linear and
+//       cosine interpolation, counts around the chunk size)
+//    4. TurbulenceNoise3D batch is bit-identical to Evaluate
+//    5. The default IFunction3D batch (Simplex, Worley) matches Evaluate
+//    6. Float batches agree with the double path within tolerance
+//    7. Timing of scalar vs batched Turbulence (informational only)
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include <chrono>
+
+#include "../src/Library/Noise/NoiseBatch.h"
+#include "../src/Library/Noise/PerlinNoise.h"
+#include "../src/Library/Noise/TurbulenceNoise.h"
+#include "../src/Library/Noise/SimplexNoise.h"
+#include "../src/Library/Noise/WorleyNoise.h"
+#include "../src/Library/Utilities/SimpleInterpolators.h"
+#include "StandaloneTestReporting.h"
+
+using namespace RISE;
+using namespace RISE::Implementation;
+using StandaloneTestReporting::PrintSection;
+
+struct PointSet
+{
+	std::vector<Scalar> x, y, z;
+	std::vector<float> xf, yf, zf;
+};
+
+/// Random points over [-range, range]^3, with runs of nearby points so the
+/// cell reuse in the batched path is exercised as well as cell changes
+static PointSet MakePoints( const unsigned int count, const Scalar range )
+{
+	PointSet p;
+	srand( 4321 );
+	for( unsigned int i = 0; i < count; i++ ) {
+		Scalar x, y, z;
+		if( i > 0 && (i % 3) != 0 ) {
+			x = p.x[i-1] + 0.01;
+			y = p.y[i-1];
+			z = p.z[i-1] - 0.005;
+		} else {
+			x = (Scalar( rand() ) / RAND_MAX * 2.0 - 1.0) * range;
+			y = (Scalar( rand() ) / RAND_MAX * 2.0 - 1.0) * range;
+			z = (Scalar( rand() ) / RAND_MAX * 2.0 - 1.0) * range;
+		}
+		p.x.push_back( x );
+		p.y.push_back( y );
+		p.z.push_back( z );
+		p.xf.push_back( float( x ) );
+		p.yf.push_back( float( y ) );
+		p.zf.push_back( float( z ) );
+	}
+	return p;
+}
+
+static bool BatchMatchesExactly( const IFunction3D& f, const PointSet& p, const unsigned int count, const char* name )
+{
+	std::vector<Scalar> out( count );
+	f.EvaluateBatch( &p.x[0], &p.y[0], &p.z[0], &out[0], count );
+	for( unsigned int i = 0; i < count; i++ ) {
+		const Scalar ref = f.Evaluate( p.x[i], p.y[i], p.z[i] );
+		if( ref != out[i] ) {
+			std::cout << "    FAIL: " << name << " point " << i << " Evaluate=" << ref << " batch=" << out[i] << std::endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool FloatBatchWithin( const IFunction3D& f, const PointSet& p, const unsigned int count, const Scalar tol, const char* name )
+{
+	std::vector<float> out( count );
+	f.EvaluateBatchFloat( &p.xf[0], &p.yf[0], &p.zf[0], &out[0], count );
+	Scalar maxErr = 0;
+	for( unsigned int i = 0; i < count; i++ ) {
+		// Compare against the double path at the same (float) point
+		const Scalar ref = f.Evaluate( p.xf[i], p.yf[i], p.zf[i] );
+		const Scalar err = fabs( ref - Scalar( out[i] ) );
+		if( err > maxErr ) maxErr = err;
+	}
+	if( maxErr > tol ) {
+		std::cout << "    FAIL: " << name << " float max error " << maxErr << " > " << tol << std::endl;
+		return false;
+	}
+	std::cout << "    " << name << " float max error " << maxErr << std::endl;
+	return true;
+}
+
+/// Test 1: the block hash matches Noise3D lattice values
+bool TestHashBlock()
+{
+	std::cout << "  Test 1: HashBlock3D matches Noise3D (" << NoiseBatch::KernelName() << ")..." << std::endl;
+
+	Noise3D* noise = new Noise3D();
+	const int cells[][3] = { {0,0,0}, {5,-7,3}, {-1000,2000,-3000}, {2147483000,-2147483000,12345}, {-2147483647,1,1} };
+
+	bool passed = true;
+	for( unsigned int c = 0; c < 5 && passed; c++ ) {
+		const int X = cells[c][0], Y = cells[c][1], Z = cells[c][2];
+		Scalar block[64];
+		float blockf[64];
+		NoiseBatch::HashBlock3D( X, Y, Z, block );
+		NoiseBatch::HashBlock3D( X, Y, Z, blockf );
+		for( int dz = 0; dz < 4 && passed; dz++ ) {
+			for( int dy = 0; dy < 4 && passed; dy++ ) {
+				for( int dx = 0; dx < 4; dx++ ) {
+					// Same unsigned wrap-around the kernel uses
+					const int lx = int( (unsigned int)X - 1u + (unsigned int)dx );
+					const int ly = int( (unsigned int)Y - 1u + (unsigned int)dy );
+					const int lz = int( (unsigned int)Z - 1u + (unsigned int)dz );
+					const Scalar ref = noise->Evaluate( lx, ly, lz );
+					const int idx = dz*16 + dy*4 + dx;
+					if( ref != block[idx] || fabs( ref - blockf[idx] ) > 1e-6 ) {
+						std::cout << "    FAIL: cell " << c << " offset (" << dx << "," << dy << "," << dz << ") Noise3D="
+							<< ref << " block=" << block[idx] << " float=" << blockf[idx] << std::endl;
+						passed = false;
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	noise->release();
+	if( passed )
+		std::cout << "    PASSED" << std::endl;
+	return passed;
+}
+
+/// Test 2: InterpolatedNoise3D batch is bit-identical
+bool TestInterpolatedExact()
+{
+	std::cout << "  Test 2: InterpolatedNoise3D batch is exact..." << std::endl;
+
+	RealLinearInterpolator* lin = new RealLinearInterpolator();
+	RealCosineInterpolator* cosi = new RealCosineInterpolator();
+	InterpolatedNoise3D* a = new InterpolatedNoise3D( *lin );
+	InterpolatedNoise3D* b = new InterpolatedNoise3D( *cosi );
+
+	const PointSet p = MakePoints( 1000, 50.0 );
+	bool passed = BatchMatchesExactly( *a, p, 1000, "linear" ) && BatchMatchesExactly( *b, p, 1000, "cosine" );
+
+	b->release();
+	a->release();
+	cosi->release();
+	lin->release();
+	if( passed )
+		std::cout << "    PASSED" << std::endl;
+	return passed;
+}
+
+/// Test 3: PerlinNoise3D batch is bit-identical
+bool TestPerlinExact()
+{
+	std::cout << "  Test 3: PerlinNoise3D batch is exact..." << std::endl;
+
+	RealLinearInterpolator* lin = new RealLinearInterpolator();
+	RealCosineInterpolator* cosi = new RealCosineInterpolator();
+	PerlinNoise3D* a = new PerlinNoise3D( *lin, 0.5, 6 );
+	PerlinNoise3D* b = new PerlinNoise3D( *cosi, 0.7, 8 );
+
+	const PointSet p = MakePoints( 1000, 20.0 );
+	bool passed = true;
+	const unsigned int counts[] = { 1, NoiseBatch::kChunk - 1, NoiseBatch::kChunk, NoiseBatch::kChunk + 1, 1000 };
+	for( unsigned int k = 0; k < 5 && passed; k++ ) {
+		passed = BatchMatchesExactly( *a, p, counts[k], "linear" ) && BatchMatchesExactly( *b, p, counts[k], "cosine" );
+	}
+
+	b->release();
+	a->release();
+	cosi->release();
+	lin->release();
+	if( passed )
+		std::cout << "    PASSED" << std::endl;
+	return passed;
+}
+
+/// Test 4: TurbulenceNoise3D batch is bit-identical
+bool TestTurbulenceExact()
+{
+	std::cout << "  Test 4: TurbulenceNoise3D batch is exact..." << std::endl;
+
+	RealCosineInterpolator* cosi = new RealCosineInterpolator();
+	TurbulenceNoise3D* t = new TurbulenceNoise3D( *cosi, 0.5, 7 );
+
+	const PointSet p = MakePoints( 1000, 20.0 );
+	const bool passed = BatchMatchesExactly( *t, p, 1000, "turbulence" );
+
+	t->release();
+	cosi->release();
+	if( passed )
+		std::cout << "    PASSED" << std::endl;
+	return passed;
+}
+
+/// Test 5: generators without a kernel use the default loop
+bool TestDefaultBatch()
+{
+	std::cout << "  Test 5: Default batch (Simplex, Worley) matches Evaluate..." << std::endl;
+
+	SimplexNoise3D* s = new SimplexNoise3D( 0.5, 5 );
+	WorleyNoise3D* w = new WorleyNoise3D( 1.0, eWorley_Euclidean, eWorley_F1 );
+
+	const PointSet p = MakePoints( 300, 10.0 );
+	bool passed = BatchMatchesExactly( *s, p, 300, "simplex" ) && BatchMatchesExactly( *w, p, 300, "worley" );
+	passed = passed && FloatBatchWithin( *s, p, 300, 1e-6, "simplex" );
+
+	w->release();
+	s->release();
+	if( passed )
+		std::cout << "    PASSED" << std::endl;
+	return passed;
+}
+
+/// Test 6: float batches track the double path
+bool TestFloatTolerance()
+{
+	std::cout << "  Test 6: Float batches within tolerance..." << std::endl;
+
+	RealCosineInterpolator* cosi = new RealCosineInterpolator();
+	PerlinNoise3D* perlin = new PerlinNoise3D( *cosi, 0.5, 6 );
+	TurbulenceNoise3D* turb = new TurbulenceNoise3D( *cosi, 0.5, 6 );
+
+	const PointSet p = MakePoints( 1000, 20.0 );
+	const bool passed =
+		FloatBatchWithin( *perlin, p, 1000, 1e-5, "perlin" ) &&
+		FloatBatchWithin( *turb, p, 1000, 1e-5, "turbulence" );
+
+	turb->release();
+	perlin->release();
+	cosi->release();
+	if( passed )
+		std::cout << "    PASSED" << std::endl;
+	return passed;
+}
+
+/// Test 7: timing, printed for reference, never fails
+bool TestTiming()
+{
+	std::cout << "  Test 7: Scalar vs batched turbulence timing..." << std::endl;
+
+	RealCosineInterpolator* cosi = new RealCosineInterpolator();
+	TurbulenceNoise3D* turb = new TurbulenceNoise3D( *cosi, 0.5, 6 );
+
+	// A dense row, as MajorantGrid / volume bakes request it
+	const unsigned int count = 200000;
+	PointSet p;
+	for( unsigned int i = 0; i < count; i++ ) {
+		p.x.push_back( i * 0.001 );
+		p.y.push_back( 0.37 );
+		p.z.push_back( -1.21 );
+	}
+	std::vector<Scalar> out( count );
+
+	Scalar sink = 0;
+	const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+	for( unsigned int i = 0; i < count; i++ ) {
+		sink += turb->Evaluate( p.x[i], p.y[i], p.z[i] );
+	}
+	const std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+	turb->EvaluateBatch( &p.x[0], &p.y[0], &p.z[0], &out[0], count );
+	const std::chrono::steady_clock::time_point t2 = std::chrono::steady_clock::now();
+	for( unsigned int i = 0; i < count; i++ ) {
+		sink -= out[i];
+	}
+
+	const double scalarMs = std::chrono::duration<double, std::milli>( t1 - t0 ).count();
+	const double batchMs = std::chrono::duration<double, std::milli>( t2 - t1 ).count();
+	std::cout << "    scalar " << scalarMs << " ms, batch " << batchMs << " ms"
+		<< " (checksum " << sink << ")" << std::endl;
+
+	turb->release();
+	cosi->release();
+	std::cout << "    PASSED" << std::endl;
+	return true;
+}
+
+int main()
+{
+	std::cout << "=== Noise Batch Tests ===" << std::endl;
+	bool allPassed = true;
+
+	PrintSection( "Lattice Kernel" );
+	allPassed &= TestHashBlock();
+
+	PrintSection( "Bit-Exact Batches" );
+	allPassed &= TestInterpolatedExact();
+	allPassed &= TestPerlinExact();
+	allPassed &= TestTurbulenceExact();
+	allPassed &= TestDefaultBatch();
+
+	PrintSection( "Single Precision" );
+	allPassed &= TestFloatTolerance();
+
+	PrintSection( "Performance" );
+	allPassed &= TestTiming();
+
+	std::cout << std::endl;
+	if( allPassed )
+		std::cout << "ALL TESTS PASSED" << std::endl;
+	else
+		std::cout << "SOME TESTS FAILED" << std::endl;
+
+	return allPassed ? 0 : 1;
+}
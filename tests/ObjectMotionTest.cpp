@@ -0,0 +1,224 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  ObjectMotionTest.cpp - Tests for per-ray object motion
+//
+//  ObjectMotion must reproduce its keys exactly at the key times,
+//  interpolate linearly between them and clamp outside the shutter.
+//  Its boxes must bound the object at every time.  An Object with
+//  motion keys must be hit where it is at the ray's own time by both
+//  intersection entry points, must report the box of its whole motion,
+//  and must go back to its static transform on ClearMotion.  New rays
+//  must take the calling thread's sample time.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "../src/Library/Utilities/Math3D/Math3D.h"
+#include "../src/Library/Utilities/Ray.h"
+#include "../src/Library/Utilities/ThreadPool.h"
+#include "../src/Library/Intersection/RayIntersection.h"
+#include "../src/Library/Geometry/SphereGeometry.h"
+#include "../src/Library/Objects/Object.h"
+#include "../src/Library/Objects/ObjectMotion.h"
+
+using namespace RISE;
+using namespace RISE::Implementation;
+
+static int passCount = 0;
+static int failCount = 0;
+
+static void Check( bool cond, const char* name )
+{
+	if( cond ) { ++passCount; }
+	else { ++failCount; std::cout << "  FAIL: " << name << std::endl; }
+}
+
+static bool Near( Scalar a, Scalar b )
+{
+	return std::fabs( a - b ) < 1e-9;
+}
+
+// A unit sphere sliding from x=0 to x=4 over [0,1], in three keys
+static std::vector<Matrix4> SlideKeys()
+{
+	std::vector<Matrix4> keys;
+	keys.push_back( Matrix4Ops::Translation( Vector3( 0, 0, 0 ) ) );
+	keys.push_back( Matrix4Ops::Translation( Vector3( 2, 0, 0 ) ) );
+	keys.push_back( Matrix4Ops::Translation( Vector3( 4, 0, 0 ) ) );
+	return keys;
+}
+
+static const BoundingBox kUnitBox( Point3( -1, -1, -1 ), Point3( 1, 1, 1 ) );
+
+static void TestInterpolation()
+{
+	std::cout << "Test: key interpolation" << std::endl;
+
+	const ObjectMotion motion( 0, 1, SlideKeys(), kUnitBox );
+	ObjectMotion::Frame f;
+
+	motion.Evaluate( 0.5, f );
+	Check( Near( f.mxFinalTrans._30, 2 ), "exact at a key" );
+	motion.Evaluate( 0.125, f );
+	Check( Near( f.mxFinalTrans._30, 0.5 ), "linear between keys" );
+	const Point3 back = Point3Ops::Transform( f.mxInvFinalTrans, Point3( 0.5, 0, 0 ) );
+	Check( Near( back.x, 0 ) && Near( back.y, 0 ), "inverse matches" );
+	Check( f.tangentFrameSign == 1, "no mirroring" );
+
+	motion.Evaluate( -3, f );
+	Check( Near( f.mxFinalTrans._30, 0 ), "clamped before the shutter opens" );
+	motion.Evaluate( 7, f );
+	Check( Near( f.mxFinalTrans._30, 4 ), "clamped after it closes" );
+
+	std::vector<Matrix4> one( 1, Matrix4Ops::Translation( Vector3( 1, 2, 3 ) ) );
+	const ObjectMotion still( 0, 1, one, kUnitBox );
+	still.Evaluate( 0.3, f );
+	Check( still.NumKeys() == 2 && Near( f.mxFinalTrans._31, 2 ), "a single key holds still" );
+}
+
+static void TestBounds()
+{
+	std::cout << "Test: motion boxes" << std::endl;
+
+	const ObjectMotion motion( 0, 1, SlideKeys(), kUnitBox );
+	const BoundingBox& all = motion.Bounds();
+	Check( Near( all.ll.x, -1 ) && Near( all.ur.x, 5 ) && Near( all.ll.y, -1 ) && Near( all.ur.z, 1 ), "union of the whole motion" );
+
+	const BoundingBox mid = motion.BoundsAt( 0.25 );
+	Check( Near( mid.ll.x, 0 ) && Near( mid.ur.x, 2 ), "box at a time between keys" );
+
+	// A ray through x=4.5 can only meet the sphere late in the shutter
+	Ray late( Point3( 4.5, 0, -10 ), Vector3( 0, 0, 1 ) );
+	late.time = 0.1;
+	Check( !motion.MayHit( late, RISE_INFINITY ), "rejected early in the shutter" );
+	late.time = 0.95;
+	Check( motion.MayHit( late, RISE_INFINITY ), "kept late in the shutter" );
+	Check( !motion.MayHit( late, 5 ), "rejected beyond dHowFar" );
+}
+
+static Object* MakeSphere()
+{
+	SphereGeometry* pGeo = new SphereGeometry( 1.0 );
+	Object* pObj = new Object( pGeo );
+	pGeo->release();
+	pObj->FinalizeTransformations();
+	return pObj;
+}
+
+static void TestObject()
+{
+	std::cout << "Test: object hit at the ray's time" << std::endl;
+
+	Object* pObj = MakeSphere();
+	Check( Near( pObj->getBoundingBox().ur.x, 1 ), "static box" );
+	Check( pObj->SetMotion( 0, 1, SlideKeys() ) && pObj->HasMotion(), "motion set" );
+	Check( Near( pObj->getBoundingBox().ll.x, -1 ) && Near( pObj->getBoundingBox().ur.x, 5 ), "box covers the motion" );
+
+	bool allRight = true;
+	for( unsigned int i = 0; i <= 20; i++ ) {
+		const Scalar t = Scalar( i ) / 20;
+		for( Scalar x = -1.5; x <= 5.5; x += 0.25 ) {
+			Ray ray( Point3( x, 0.1, -10 ), Vector3( 0, 0, 1 ) );
+			ray.time = t;
+			const bool expect = std::fabs( x - 4*t ) < 0.99;
+			const bool reject = std::fabs( x - 4*t ) > 1.01;
+
+			RayIntersection ri( ray, nullRasterizerState );
+			pObj->IntersectRay( ri, RISE_INFINITY, true, true, false );
+			const bool shadow = pObj->IntersectRay_IntersectionOnly( ray, RISE_INFINITY, true, true );
+
+			if( expect && !( ri.geometric.bHit && shadow && Near( ri.geometric.ptIntersection.x, x ) ) ) allRight = false;
+			if( reject && ( ri.geometric.bHit || shadow ) ) allRight = false;
+			if( ri.geometric.bHit && ri.geometric.vNormal.x * ( x - 4*t ) < -1e-6 ) allRight = false;
+		}
+	}
+	Check( allRight, "both entry points follow the motion, normals too" );
+
+	// The shared transform is never changed by a hit
+	Check( Near( pObj->GetFinalTransformMatrix()._30, 0 ), "static transform untouched" );
+
+	pObj->ClearMotion();
+	Check( !pObj->HasMotion() && Near( pObj->getBoundingBox().ur.x, 1 ), "ClearMotion restores the static box" );
+	Ray ray( Point3( 4, 0, -10 ), Vector3( 0, 0, 1 ) );
+	ray.time = 1;
+	Check( !pObj->IntersectRay_IntersectionOnly( ray, RISE_INFINITY, true, true ), "and the static transform" );
+
+	pObj->release();
+}
+
+static void TestThreadTime()
+{
+	std::cout << "Test: rays take the thread's sample time" << std::endl;
+
+	Check( Ray().time == 0, "0 by default" );
+	Ray::ThreadTime() = 0.7;
+	const Ray a( Point3( 0, 0, 0 ), Vector3( 1, 0, 0 ) );
+	Ray b;
+	Check( a.time == 0.7 && b.time == 0.7, "new rays stamped" );
+	Ray::ThreadTime() = 0.2;
+	b = a;
+	const Ray c( a );
+	Check( b.time == 0.7 && c.time == 0.7, "copies keep their own time" );
+	Ray::ThreadTime() = 0;
+}
+
+static void TestThreadTimeInPool()
+{
+	std::cout << "Test: pool tasks take the dispatcher's time" << std::endl;
+
+	ThreadPool pool( 3, std::vector<unsigned int>() );
+	const unsigned int n = 64;
+	std::vector<Scalar> seen( n, -1 );
+
+	// Every task sets its own time, the way a pre-pass times a path
+	Ray::ThreadTime() = 0.3;
+	pool.ParallelFor( n, [&seen]( unsigned int i ) {
+		seen[i] = Ray().time;
+		Ray::ThreadTime() = 0.9;
+	} );
+	bool all = true;
+	for( unsigned int i=0; i<n; i++ ) {
+		all = all && seen[i] == Scalar( 0.3 );
+	}
+	Check( all, "tasks start at the caller's time" );
+	Check( Ray::ThreadTime() == Scalar( 0.3 ), "caller keeps its time after draining tasks" );
+
+	Ray::ThreadTime() = 0;
+	pool.ParallelFor( n, [&seen]( unsigned int i ) {
+		seen[i] = Ray().time;
+	} );
+	all = true;
+	for( unsigned int i=0; i<n; i++ ) {
+		all = all && seen[i] == 0;
+	}
+	Check( all, "no task sees a time an earlier task set" );
+
+	{
+		RayTimeScope scope( 0.5 );
+		Check( Ray().time == Scalar( 0.5 ), "scope installs its time" );
+	}
+	Check( Ray::ThreadTime() == 0, "and puts the previous one back" );
+}
+
+int main()
+{
+	std::cout << "=== Object Motion Tests ===" << std::endl;
+
+	TestInterpolation();
+	TestBounds();
+	TestObject();
+	TestThreadTime();
+	TestThreadTimeInPool();
+
+	std::cout << std::endl << "Passed: " << passCount << "  Failed: " << failCount << std::endl;
+	return failCount > 0 ? 1 : 0;
+}
@@ -0,0 +1,315 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  PNGParallelDeflateTest.cpp - Tests for PNGWriter's parallel
+//  deflate path
+//
+//  A large image written with slab-parallel deflate must be a valid
+//  PNG (chunk CRCs, zlib header and Adler-32) whose scanlines,
+//  filter bytes included, are exactly the libpng path's, must
+//  decode through libpng to the same pixels, and must come out byte
+//  for byte the same on every write.  Also prints encode throughput for the
+//  libpng and parallel paths.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+	#include <process.h>
+	#define getpid _getpid
+#else
+	#include <unistd.h>
+#endif
+
+#include "../src/Library/RasterImages/PNGWriter.h"
+#include "../src/Library/Utilities/DiskFileWriteBuffer.h"
+#include "../src/Library/Utilities/Color/Color.h"
+
+#ifndef NO_PNG_SUPPORT
+	#include <png.h>
+	#include <zlib.h>
+#endif
+
+using namespace RISE;
+using namespace RISE::Implementation;
+
+static int passCount = 0;
+static int failCount = 0;
+
+static void Check( bool cond, const char* name )
+{
+	if( cond ) { ++passCount; }
+	else { ++failCount; std::cout << "  FAIL: " << name << std::endl; }
+}
+
+#ifndef NO_PNG_SUPPORT
+
+// Forces the libpng path, for comparison
+class SerialPNGWriter : public PNGWriter
+{
+public:
+	SerialPNGWriter( IWriteBuffer& buffer, const unsigned char bpp_ ) :
+	  PNGWriter( buffer, bpp_, eColorSpace_sRGB )
+	{
+		bParallelDeflate = false;
+	}
+};
+
+class ParallelPNGWriter : public PNGWriter
+{
+public:
+	ParallelPNGWriter( IWriteBuffer& buffer, const unsigned char bpp_ ) :
+	  PNGWriter( buffer, bpp_, eColorSpace_sRGB )
+	{
+		bParallelDeflate = true;
+	}
+};
+
+static std::string TmpPath( const char* tag )
+{
+	const char* tmp = getenv( "TMPDIR" );
+	std::string dir = tmp ? tmp : "/tmp/";
+	if( !dir.empty() && dir[dir.size()-1] != '/' ) dir += "/";
+	std::ostringstream os;
+	os << dir << "rise_pngdeflate_" << getpid() << "_" << tag << ".png";
+	return os.str();
+}
+
+static RISEColor Pixel( unsigned int x, unsigned int y )
+{
+	// Smooth gradients plus some noise so slabs are not trivially compressible
+	const double n = double( (x*2654435761u ^ y*40503u) & 0xFF ) / 2550.0;
+	return RISEColor( RISEPel( x / 1024.0 + n, y / 768.0, 0.5 + 0.4*((x+y)%37)/37.0 ), 0.25 + 0.75*((x*y)%11)/10.0 );
+}
+
+static double WriteImage( IRasterImageWriter& writer, const unsigned int w, const unsigned int h )
+{
+	writer.BeginWrite( w, h );
+	for( unsigned int y = 0; y < h; y++ ) {
+		for( unsigned int x = 0; x < w; x++ ) {
+			writer.WriteColor( Pixel( x, y ), x, y );
+		}
+	}
+
+	// Only the encode itself is timed
+	const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+	writer.EndWrite();
+	return std::chrono::duration<double>( std::chrono::steady_clock::now() - t0 ).count();
+}
+
+static double Encode( const bool parallel, const unsigned char bpp, const unsigned int w, const unsigned int h,
+	const std::string& path, std::vector<unsigned char>& bytes )
+{
+	DiskFileWriteBuffer* buffer = new DiskFileWriteBuffer( path.c_str() );
+	PNGWriter* writer = parallel ?
+		static_cast<PNGWriter*>( new ParallelPNGWriter( *buffer, bpp ) ) :
+		static_cast<PNGWriter*>( new SerialPNGWriter( *buffer, bpp ) );
+	const double seconds = WriteImage( *writer, w, h );
+	writer->release();
+	buffer->release();
+
+	std::ifstream f( path.c_str(), std::ios::binary );
+	bytes.assign( std::istreambuf_iterator<char>( f ), std::istreambuf_iterator<char>() );
+	remove( path.c_str() );
+	return seconds;
+}
+
+static unsigned int U32( const unsigned char* p )
+{
+	return (unsigned int)(p[0])<<24 | (unsigned int)(p[1])<<16 | (unsigned int)(p[2])<<8 | p[3];
+}
+
+static int PaethPredict( int a, int b, int c )
+{
+	const int p = a + b - c;
+	const int pa = abs( p - a ), pb = abs( p - b ), pc = abs( p - c );
+	return (pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c);
+}
+
+// Reverses the per-row filters, leaving just the pixel bytes
+static bool Unfilter( const std::vector<unsigned char>& scanlines, const unsigned int w, const unsigned int h,
+	const unsigned int depth, std::vector<unsigned char>& pixels )
+{
+	const size_t bpp = 4 * (depth/8);
+	const size_t length = w * bpp;
+	pixels.assign( length * h, 0 );
+	for( unsigned int y = 0; y < h; y++ ) {
+		const unsigned char* in = &scanlines[ y * (length + 1) ];
+		unsigned char* row = &pixels[ y * length ];
+		const unsigned char* prior = y ? row - length : 0;
+		for( size_t i = 0; i < length; i++ ) {
+			const int a = i >= bpp ? row[i-bpp] : 0;
+			const int b = prior ? prior[i] : 0;
+			const int c = (prior && i >= bpp) ? prior[i-bpp] : 0;
+			int pred = 0;
+			switch( in[0] ) {
+			case 0: pred = 0; break;
+			case 1: pred = a; break;
+			case 2: pred = b; break;
+			case 3: pred = (a + b) / 2; break;
+			case 4: pred = PaethPredict( a, b, c ); break;
+			default: return false;
+			}
+			row[i] = static_cast<unsigned char>( in[1+i] + pred );
+		}
+	}
+	return true;
+}
+
+// Walks the chunks, checking every CRC, and returns the inflated IDAT
+// stream (uncompress checks the zlib header and Adler-32)
+static bool Unpack( const std::vector<unsigned char>& png, std::vector<unsigned char>& scanlines,
+	unsigned int& width, unsigned int& height, unsigned int& depth )
+{
+	static const unsigned char signature[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+	if( png.size() < 8 || memcmp( &png[0], signature, 8 ) != 0 ) {
+		return false;
+	}
+
+	std::vector<unsigned char> idat;
+	bool sawEnd = false;
+	size_t pos = 8;
+	while( pos + 12 <= png.size() && !sawEnd ) {
+		const unsigned int length = U32( &png[pos] );
+		if( pos + 12 + length > png.size() ) {
+			return false;
+		}
+		const unsigned char* type = &png[pos+4];
+		const unsigned char* data = &png[pos+8];
+		uLong crc = crc32( 0L, Z_NULL, 0 );
+		crc = crc32( crc, type, 4 + length );
+		if( crc != U32( data + length ) ) {
+			return false;
+		}
+		if( memcmp( type, "IHDR", 4 ) == 0 ) {
+			width = U32( data );
+			height = U32( data + 4 );
+			depth = data[8];
+		} else if( memcmp( type, "IDAT", 4 ) == 0 ) {
+			idat.insert( idat.end(), data, data + length );
+		} else if( memcmp( type, "IEND", 4 ) == 0 ) {
+			sawEnd = true;
+		}
+		pos += 12 + length;
+	}
+	if( !sawEnd ) {
+		return false;
+	}
+
+	uLongf size = static_cast<uLongf>( (size_t( width ) * 4 * (depth/8) + 1) * height );
+	scanlines.resize( size );
+	return uncompress( &scanlines[0], &size, &idat[0], static_cast<uLong>( idat.size() ) ) == Z_OK &&
+		size == scanlines.size();
+}
+
+static void TestParallelMatchesLibpng( const unsigned char bpp )
+{
+	std::cout << "Test: " << int( bpp ) << "-bit parallel deflate" << std::endl;
+
+	const unsigned int W = 1024, H = 768;
+	std::vector<unsigned char> parallel, parallelAgain, serial;
+	Encode( true, bpp, W, H, TmpPath( "p" ), parallel );
+	Encode( true, bpp, W, H, TmpPath( "p2" ), parallelAgain );
+	Encode( false, bpp, W, H, TmpPath( "s" ), serial );
+
+	Check( parallel == parallelAgain, "deterministic output" );
+	Check( parallel != serial, "large image took the parallel path" );
+
+	std::vector<unsigned char> a, b;
+	unsigned int wa = 0, ha = 0, da = 0, wb = 0, hb = 0, db = 0;
+	Check( Unpack( parallel, a, wa, ha, da ), "parallel file is well formed" );
+	Check( Unpack( serial, b, wb, hb, db ), "libpng file is well formed" );
+	Check( wa == W && ha == H && da == bpp, "parallel header" );
+	Check( !a.empty() && a == b, "same scanlines as libpng, filter bytes included" );
+	std::vector<unsigned char> pa, pb;
+	Check( Unfilter( a, wa, ha, da, pa ) && Unfilter( b, wb, hb, db, pb ) && !pa.empty() && pa == pb,
+		"identical pixels after unfiltering" );
+
+	// Independent decode through libpng
+	if( bpp == 8 ) {
+		png_image image;
+		memset( &image, 0, sizeof( image ) );
+		image.version = PNG_IMAGE_VERSION;
+		bool decoded = false;
+		std::vector<unsigned char> pixels;
+		if( png_image_begin_read_from_memory( &image, &parallel[0], parallel.size() ) ) {
+			image.format = PNG_FORMAT_RGBA;
+			pixels.resize( PNG_IMAGE_SIZE( image ) );
+			decoded = png_image_finish_read( &image, 0, &pixels[0], 0, 0 ) != 0;
+		}
+		Check( decoded, "libpng decodes the parallel file" );
+
+		bool same = decoded;
+		for( unsigned int y = 0; same && y < H; y++ ) {
+			for( unsigned int x = 0; x < W; x++ ) {
+				const RGBA8 p = Pixel( x, y ).Integerize<sRGBPel,unsigned char>( 255.0 );
+				const unsigned char* q = &pixels[ (size_t( y )*W + x)*4 ];
+				if( q[0] != p.r || q[1] != p.g || q[2] != p.b || q[3] != p.a ) {
+					same = false;
+					break;
+				}
+			}
+		}
+		Check( same, "decoded pixels match the source" );
+	}
+}
+
+static void TestSmallImageUsesLibpng()
+{
+	std::cout << "Test: small images stay on the libpng path" << std::endl;
+
+	std::vector<unsigned char> parallel, serial;
+	Encode( true, 8, 64, 48, TmpPath( "small_p" ), parallel );
+	Encode( false, 8, 64, 48, TmpPath( "small_s" ), serial );
+	Check( !parallel.empty() && parallel == serial, "byte identical to libpng" );
+}
+
+static void ReportThroughput()
+{
+	std::cout << "Throughput: 4096x2160, 8-bit" << std::endl;
+
+	const unsigned int W = 4096, H = 2160;
+	const double mb = double( W ) * H * 4 / (1024.0*1024.0);
+	std::vector<unsigned char> bytes;
+
+	const double serial = Encode( false, 8, W, H, TmpPath( "bench_s" ), bytes );
+	const size_t serialSize = bytes.size();
+	const double parallel = Encode( true, 8, W, H, TmpPath( "bench_p" ), bytes );
+	const size_t parallelSize = bytes.size();
+
+	printf( "  libpng:   %7.3f s  %8.1f MB/s  %zu bytes\n", serial, mb / serial, serialSize );
+	printf( "  parallel: %7.3f s  %8.1f MB/s  %zu bytes  (%.2fx)\n", parallel, mb / parallel, parallelSize, serial / parallel );
+}
+
+#endif
+
+int main()
+{
+	std::cout << "=== PNG Parallel Deflate Tests ===" << std::endl;
+
+#ifndef NO_PNG_SUPPORT
+	TestParallelMatchesLibpng( 8 );
+	TestParallelMatchesLibpng( 16 );
+	TestSmallImageUsesLibpng();
+	ReportThroughput();
+#else
+	std::cout << "PNG support not compiled, skipping" << std::endl;
+#endif
+
+	std::cout << std::endl << "Passed: " << passCount << "  Failed: " << failCount << std::endl;
+	return failCount > 0 ? 1 : 0;
+}
@@ -0,0 +1,296 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  PainterProgramTest.cpp - Unit tests for the painter DAG compiler
+//    (PainterCompiler / PainterProgram)
+//
+//  Tests:
+//    1. A fully compilable graph (blend of checker / turbulence /
+//       perlin / channel under a uv transform) matches the virtual
+//       GetColor path bit-for-bit and emits no virtual fallbacks
+//    2. A painter with no compiled form becomes a kVirtual fallback,
+//       including underneath a uv transform, and still matches
+//    3. Batches larger than kBatchSize are chunked correctly
+//    4. VolumeAccessor_Painter::GetValueRow matches per-voxel GetValue
+//    5. A painter shared by two parents is compiled once (DAG dedup)
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include "../src/Library/Painters/PainterProgram.h"
+#include "../src/Library/Painters/UniformColorPainter.h"
+#include "../src/Library/Painters/BlendPainter.h"
+#include "../src/Library/Painters/CheckerPainter.h"
+#include "../src/Library/Painters/ChannelPainter.h"
+#include "../src/Library/Painters/UVTransformPainter.h"
+#include "../src/Library/Painters/Turbulence3DPainter.h"
+#include "../src/Library/Painters/Perlin3DPainter.h"
+#include "../src/Library/Volume/VolumeAccessor_Painter.h"
+#include "StandaloneTestReporting.h"
+
+using namespace RISE;
+using namespace RISE::Implementation;
+using StandaloneTestReporting::PrintSection;
+
+/// Painter with no compiled form: colour is a function of the uv, so a
+/// wrong coordinate set under a uv transform shows up immediately.
+class UVRampPainter : public Painter
+{
+public:
+	UVRampPainter() {}
+
+	RISEPel GetColor( const RayIntersectionGeometric& ri ) const
+	{
+		return RISEPel( ri.ptCoord.x, ri.ptCoord.y, ri.ptCoord.x * ri.ptCoord.y );
+	}
+
+	IKeyframeParameter* KeyframeFromParameters( const String&, const String& ) { return 0; }
+	void SetIntermediateValue( const IKeyframeParameter& ) {}
+	void RegenerateData() {}
+};
+
+static std::vector<RayIntersectionGeometric> MakeHits( const unsigned int count )
+{
+	const Ray ray( Point3( 0, 0, 0 ), Vector3( 0, 0, 1 ) );
+	std::vector<RayIntersectionGeometric> hits( count, RayIntersectionGeometric( ray, nullRasterizerState ) );
+	srand( 1234 );
+	for( unsigned int i = 0; i < count; i++ ) {
+		const Scalar r0 = Scalar( rand() ) / RAND_MAX;
+		const Scalar r1 = Scalar( rand() ) / RAND_MAX;
+		const Scalar r2 = Scalar( rand() ) / RAND_MAX;
+		hits[i].bHit = true;
+		hits[i].ptCoord = Point2( r0 * 4.0 - 2.0, r1 * 4.0 - 2.0 );
+		hits[i].ptIntersection = Point3( r0 * 10.0 - 5.0, r1 * 10.0 - 5.0, r2 * 10.0 - 5.0 );
+		hits[i].ptObjIntersec = hits[i].ptIntersection;
+	}
+	return hits;
+}
+
+static bool MatchesVirtual( const IPainter& root, const PainterProgram& program, const unsigned int count )
+{
+	std::vector<RayIntersectionGeometric> hits = MakeHits( count );
+	std::vector<RISEPel> batch( count );
+	program.EvaluateBatch( &hits[0], count, &batch[0] );
+
+	for( unsigned int i = 0; i < count; i++ ) {
+		const RISEPel ref = root.GetColor( hits[i] );
+		if( ref.r != batch[i].r || ref.g != batch[i].g || ref.b != batch[i].b ) {
+			std::cout << "    FAIL: lane " << i << " virtual=(" << ref.r << "," << ref.g << "," << ref.b
+				<< ") program=(" << batch[i].r << "," << batch[i].g << "," << batch[i].b << ")" << std::endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+/// Test 1: fully compilable graph matches the virtual path exactly
+bool TestCompilableGraphMatches()
+{
+	std::cout << "  Test 1: Compilable graph matches virtual path..." << std::endl;
+
+	UniformColorPainter* red = new UniformColorPainter( RISEPel( 0.9, 0.1, 0.1 ) );
+	UniformColorPainter* blue = new UniformColorPainter( RISEPel( 0.1, 0.2, 0.8 ) );
+	UniformColorPainter* white = new UniformColorPainter( RISEPel( 1.0, 1.0, 1.0 ) );
+	CheckerPainter* checker = new CheckerPainter( 0.25, *red, *blue );
+	UVTransformPainter* uvt = new UVTransformPainter( *checker, 0.1, -0.3, 0.4, 2.0, 0.5 );
+	Turbulence3DPainter* turb = new Turbulence3DPainter( 0.5, 5, *red, *white, Vector3( 1.3, 0.7, 2.1 ), Vector3( 0.2, 0.0, -0.4 ) );
+	Perlin3DPainter* perlin = new Perlin3DPainter( 0.6, 4, *blue, *white, Vector3( 0.5, 0.5, 0.5 ), Vector3( 0, 0, 0 ) );
+	ChannelPainter* mask = new ChannelPainter( *perlin, ChannelPainter::CHAN_G, 0.8, 0.1 );
+	BlendPainter* root = new BlendPainter( *uvt, *turb, *mask );
+
+	PainterProgram program;
+	PainterCompiler compiler;
+	bool passed = compiler.Compile( *root, program );
+	if( !passed ) {
+		std::cout << "    FAIL: compile reported failure" << std::endl;
+	}
+	if( passed && program.NumVirtualFallbacks() != 0 ) {
+		std::cout << "    FAIL: expected no virtual fallbacks, got " << program.NumVirtualFallbacks() << std::endl;
+		passed = false;
+	}
+	if( passed ) {
+		passed = MatchesVirtual( *root, program, 500 );
+	}
+
+	root->release();
+	mask->release();
+	perlin->release();
+	turb->release();
+	uvt->release();
+	checker->release();
+	white->release();
+	blue->release();
+	red->release();
+
+	if( passed )
+		std::cout << "    PASSED (" << program.NumInstructions() << " instructions)" << std::endl;
+	return passed;
+}
+
+/// Test 2: unsupported painters fall back to the virtual path
+bool TestVirtualFallback()
+{
+	std::cout << "  Test 2: Virtual fallback (incl. under uv transform)..." << std::endl;
+
+	UVRampPainter* ramp = new UVRampPainter();
+	UniformColorPainter* grey = new UniformColorPainter( RISEPel( 0.5, 0.5, 0.5 ) );
+	UVTransformPainter* uvt = new UVTransformPainter( *ramp, 0.25, 0.5, 1.1, 3.0, 0.75 );
+	CheckerPainter* root = new CheckerPainter( 0.5, *uvt, *grey );
+
+	PainterProgram program;
+	PainterCompiler compiler;
+	compiler.Compile( *root, program );
+
+	bool passed = true;
+	if( program.NumVirtualFallbacks() != 1 ) {
+		std::cout << "    FAIL: expected 1 virtual fallback, got " << program.NumVirtualFallbacks() << std::endl;
+		passed = false;
+	}
+	if( passed ) {
+		passed = MatchesVirtual( *root, program, 200 );
+	}
+
+	root->release();
+	uvt->release();
+	grey->release();
+	ramp->release();
+
+	if( passed )
+		std::cout << "    PASSED" << std::endl;
+	return passed;
+}
+
+/// Test 5: a shared sub-graph compiles to one register
+bool TestSharedSubgraph()
+{
+	std::cout << "  Test 5: Shared sub-graph is compiled once..." << std::endl;
+
+	UniformColorPainter* red = new UniformColorPainter( RISEPel( 1, 0, 0 ) );
+	UniformColorPainter* green = new UniformColorPainter( RISEPel( 0, 1, 0 ) );
+	Turbulence3DPainter* turb = new Turbulence3DPainter( 0.5, 4, *red, *green, Vector3( 1, 1, 1 ), Vector3( 0, 0, 0 ) );
+	// turb is both an operand and the mask
+	BlendPainter* root = new BlendPainter( *turb, *red, *turb );
+
+	PainterProgram program;
+	PainterCompiler compiler;
+	compiler.Compile( *root, program );
+
+	unsigned int noiseOps = 0;
+	for( size_t i = 0; i < program.Code().size(); i++ ) {
+		if( program.Code()[i].op == PainterProgram::kNoiseBlend ) {
+			noiseOps++;
+		}
+	}
+
+	bool passed = ( noiseOps == 1 ) && ( program.NumInstructions() == 4 );
+	if( !passed ) {
+		std::cout << "    FAIL: noiseOps=" << noiseOps << " instructions=" << program.NumInstructions() << std::endl;
+	} else {
+		passed = MatchesVirtual( *root, program, 100 );
+	}
+
+	root->release();
+	turb->release();
+	green->release();
+	red->release();
+
+	if( passed )
+		std::cout << "    PASSED" << std::endl;
+	return passed;
+}
+
+/// Test 3: counts that are not a multiple of the batch size
+bool TestChunking()
+{
+	std::cout << "  Test 3: Chunking across kBatchSize..." << std::endl;
+
+	UniformColorPainter* a = new UniformColorPainter( RISEPel( 0.2, 0.4, 0.6 ) );
+	UniformColorPainter* b = new UniformColorPainter( RISEPel( 0.7, 0.3, 0.1 ) );
+	Perlin3DPainter* root = new Perlin3DPainter( 0.5, 3, *a, *b, Vector3( 2, 2, 2 ), Vector3( 0, 0, 0 ) );
+
+	PainterProgram program;
+	PainterCompiler compiler;
+	compiler.Compile( *root, program );
+
+	bool passed = true;
+	const unsigned int counts[] = { 1, PainterProgram::kBatchSize - 1, PainterProgram::kBatchSize, PainterProgram::kBatchSize * 3 + 7 };
+	for( unsigned int k = 0; k < 4 && passed; k++ ) {
+		passed = MatchesVirtual( *root, program, counts[k] );
+	}
+
+	root->release();
+	b->release();
+	a->release();
+
+	if( passed )
+		std::cout << "    PASSED" << std::endl;
+	return passed;
+}
+
+/// Test 4: the batched volume accessor row agrees with per-voxel lookups
+bool TestVolumeAccessorRow()
+{
+	std::cout << "  Test 4: VolumeAccessor_Painter row fetch..." << std::endl;
+
+	UniformColorPainter* a = new UniformColorPainter( RISEPel( 0, 0, 0 ) );
+	UniformColorPainter* b = new UniformColorPainter( RISEPel( 1, 1, 1 ) );
+	Turbulence3DPainter* turb = new Turbulence3DPainter( 0.5, 5, *a, *b, Vector3( 3, 3, 3 ), Vector3( 0, 0, 0 ) );
+	VolumeAccessor_Painter* acc = new VolumeAccessor_Painter( *turb, 32, 16, 8, Point3( -1, -1, -1 ), Point3( 1, 1, 1 ), 'l' );
+
+	bool passed = true;
+	std::vector<Scalar> row( 32 );
+	for( int z = -4; z < 4 && passed; z++ ) {
+		for( int y = -8; y < 8 && passed; y++ ) {
+			acc->GetValueRow( -16, y, z, 32, &row[0] );
+			for( int x = 0; x < 32; x++ ) {
+				const Scalar ref = acc->GetValue( x - 16, y, z );
+				if( ref != row[x] ) {
+					std::cout << "    FAIL: (" << x - 16 << "," << y << "," << z << ") GetValue=" << ref << " row=" << row[x] << std::endl;
+					passed = false;
+					break;
+				}
+			}
+		}
+	}
+
+	acc->release();
+	turb->release();
+	b->release();
+	a->release();
+
+	if( passed )
+		std::cout << "    PASSED" << std::endl;
+	return passed;
+}
+
+int main()
+{
+	std::cout << "=== PainterProgram Tests ===" << std::endl;
+	bool allPassed = true;
+
+	PrintSection( "Parity With The Virtual Path" );
+	allPassed &= TestCompilableGraphMatches();
+	allPassed &= TestVirtualFallback();
+	allPassed &= TestChunking();
+	allPassed &= TestVolumeAccessorRow();
+
+	PrintSection( "Program Structure" );
+	allPassed &= TestSharedSubgraph();
+
+	std::cout << std::endl;
+	if( allPassed )
+		std::cout << "ALL TESTS PASSED" << std::endl;
+	else
+		std::cout << "SOME TESTS FAILED" << std::endl;
+
+	return allPassed ? 0 : 1;
+}
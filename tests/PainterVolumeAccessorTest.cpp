@@ -5,7 +5,8 @@
 //
 //  Tests:
 //    1. Uniform painter produces constant density
-//    2. Spatially varying painter produces correct density gradient
+//    2. Spatially varying painter produces correct density gradient,
+//       and the batched row fetch agrees with per-voxel lookups
 //    3. Density values are clamped to [0, 1]
 //    4. MajorantGrid integration (majorants >= actual density)
 //    5. Color-to-scalar conversion modes
@@ -28,6 +29,7 @@
 //////////////////////////////////////////////////////////////////////
 
 #include <iostream>
+#include <vector>
 #include <cmath>
 #include <cstdlib>
 
@@ -218,6 +220,23 @@ bool TestGradientDensity()
 		passed = false;
 	}
 
+	// The batched row fetch the majorant grid uses gives the same values,
+	// row after row, from the program compiled once by the accessor
+	std::vector<Scalar> row( res );
+	for( int y = -half; y < (int)res - half; y += 7 )
+	{
+		accessor->GetValueRow( -half, y, 3, res, &row[0] );
+		for( unsigned int i = 0; i < res; i++ )
+		{
+			if( !IsClose( row[i], accessor->GetValue( -half + (int)i, y, 3 ) ) )
+			{
+				std::cout << "    FAIL: GetValueRow differs from GetValue at x=" << ( -half + (int)i ) << " y=" << y << std::endl;
+				passed = false;
+				break;
+			}
+		}
+	}
+
 	accessor->release();
 	if( passed )
 		std::cout << "    PASSED (left=" << dLeft << " right=" << dRight << ")" << std::endl;
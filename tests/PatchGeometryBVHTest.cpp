@@ -0,0 +1,280 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  PatchGeometryBVHTest.cpp - Tests for the BVH over Bezier and
+//  bilinear patch geometries
+//
+//  A patch geometry must report the same closest hit through its BVH
+//  as a brute-force walk over its patches, must answer shadow rays the
+//  same way, and must survive a Serialize / Deserialize round trip
+//  with identical hits.  The subdivided Bezier bound must sit inside
+//  the control-hull bound and still contain the surface.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "../src/Library/Utilities/Math3D/Math3D.h"
+#include "../src/Library/Utilities/Ray.h"
+#include "../src/Library/Utilities/GeometricUtilities.h"
+#include "../src/Library/Utilities/MemoryBuffer.h"
+#include "../src/Library/Intersection/RayIntersectionGeometric.h"
+#include "../src/Library/Geometry/BezierPatchGeometry.h"
+#include "../src/Library/Geometry/BilinearPatchGeometry.h"
+
+using namespace RISE;
+using namespace RISE::Implementation;
+
+static int passCount = 0;
+static int failCount = 0;
+
+static void Check( bool cond, const char* name )
+{
+	if( cond ) { ++passCount; }
+	else { ++failCount; std::cout << "  FAIL: " << name << std::endl; }
+}
+
+static bool Near( Scalar a, Scalar b, Scalar tol = 1e-9 )
+{
+	return std::fabs( a - b ) < tol;
+}
+
+static Scalar Height( Scalar x, Scalar z )
+{
+	return 0.6 * std::sin( 1.3 * x ) * std::cos( 0.9 * z );
+}
+
+// A rolling n x n sheet of bicubic patches over [0,n] x [0,n]
+static std::vector<BezierPatch> BezierSheet( const unsigned int n )
+{
+	std::vector<BezierPatch> v;
+	for( unsigned int i = 0; i < n; i++ ) {
+		for( unsigned int j = 0; j < n; j++ ) {
+			BezierPatch p;
+			for( int r = 0; r < 4; r++ ) {
+				for( int c = 0; c < 4; c++ ) {
+					const Scalar x = i + c / 3.0;
+					const Scalar z = j + r / 3.0;
+					p.c[r].pts[c] = Point3( x, Height( x, z ), z );
+				}
+			}
+			v.push_back( p );
+		}
+	}
+	return v;
+}
+
+// The same sheet made of twisted bilinear quads
+static std::vector<BilinearPatch> BilinearSheet( const unsigned int n )
+{
+	std::vector<BilinearPatch> v;
+	for( unsigned int i = 0; i < n; i++ ) {
+		for( unsigned int j = 0; j < n; j++ ) {
+			BilinearPatch p;
+			const Scalar x0 = i * 0.5, x1 = x0 + 0.5, z0 = j * 0.5, z1 = z0 + 0.5;
+			p.pts[0] = Point3( x0, Height( x0, z0 ), z0 );
+			p.pts[1] = Point3( x1, Height( x1, z0 ), z0 );
+			p.pts[2] = Point3( x0, Height( x0, z1 ) + 0.1, z1 );
+			p.pts[3] = Point3( x1, Height( x1, z1 ), z1 );
+			v.push_back( p );
+		}
+	}
+	return v;
+}
+
+// Slanted rays over the sheet, most of which graze several patches
+static std::vector<Ray> Rays( const Scalar extent )
+{
+	std::vector<Ray> v;
+	for( Scalar x = -0.3; x <= extent + 0.3; x += extent / 23.0 ) {
+		for( Scalar z = -0.3; z <= extent + 0.3; z += extent / 19.0 ) {
+			v.push_back( Ray( Point3( x, 3, z ), Vector3Ops::Normalize( Vector3( 0.35, -1, 0.2 ) ) ) );
+			v.push_back( Ray( Point3( x - 2, 0.2, z ), Vector3Ops::Normalize( Vector3( 1, -0.05, 0.1 ) ) ) );
+		}
+	}
+	return v;
+}
+
+// Closest hit over one single-patch geometry per patch
+template< class G >
+static RayIntersectionGeometric BruteForce( const std::vector<G*>& singles, const Ray& ray )
+{
+	RayIntersectionGeometric best( ray, nullRasterizerState );
+	best.range = RISE_INFINITY;
+	for( size_t i = 0; i < singles.size(); i++ ) {
+		RayIntersectionGeometric ri( ray, nullRasterizerState );
+		singles[i]->IntersectRay( ri, true, true, false );
+		if( ri.bHit && ri.range < best.range ) {
+			best = ri;
+		}
+	}
+	return best;
+}
+
+template< class G, class P >
+static void CompareToBruteForce( G* pGeom, const std::vector<P>& patches, const Scalar extent, const char* what )
+{
+	std::vector<G*> singles;
+	for( size_t i = 0; i < patches.size(); i++ ) {
+		G* g = new G();
+		g->AddPatch( patches[i] );
+		g->Prepare();
+		singles.push_back( g );
+	}
+
+	const std::vector<Ray> rays = Rays( extent );
+	unsigned int hits = 0;
+	bool hitsAgree = true, rangesAgree = true, shadowsAgree = true;
+	for( size_t r = 0; r < rays.size(); r++ ) {
+		const RayIntersectionGeometric best = BruteForce( singles, rays[r] );
+
+		RayIntersectionGeometric ri( rays[r], nullRasterizerState );
+		pGeom->IntersectRay( ri, true, true, false );
+		if( ri.bHit != best.bHit ) { hitsAgree = false; continue; }
+		if( pGeom->IntersectRay_IntersectionOnly( rays[r], RISE_INFINITY, true, true ) != best.bHit ) shadowsAgree = false;
+		if( !ri.bHit ) continue;
+
+		hits++;
+		if( !Near( ri.range, best.range, 1e-7 ) ) rangesAgree = false;
+
+		// A shadow ray stopping just short of the closest hit must not see it
+		if( pGeom->IntersectRay_IntersectionOnly( rays[r], best.range * 0.999 - 1e-6, true, true ) ) shadowsAgree = false;
+	}
+
+	std::cout << "  " << what << ": " << hits << " hits over " << rays.size() << " rays" << std::endl;
+	Check( hits > rays.size() / 4, "the rays hit the sheet" );
+	Check( hitsAgree, "BVH and brute force hit the same rays" );
+	Check( rangesAgree, "BVH finds the closest patch" );
+	Check( shadowsAgree, "shadow rays agree" );
+
+	for( size_t i = 0; i < singles.size(); i++ ) singles[i]->release();
+}
+
+template< class G >
+static void CompareRoundTrip( G* pGeom, const Scalar extent, const unsigned int numPatches )
+{
+	MemoryBuffer* buf = new MemoryBuffer();
+	pGeom->Serialize( *buf );
+	buf->seek( IBuffer::START, 0 );
+
+	G* pLoaded = new G();
+	pLoaded->Deserialize( *buf );
+	buf->release();
+
+	Check( pLoaded->numPatches() == numPatches, "round trip keeps every patch" );
+
+	const BoundingBox a = pGeom->GenerateBoundingBox();
+	const BoundingBox b = pLoaded->GenerateBoundingBox();
+	Check( a.ll.x == b.ll.x && a.ll.y == b.ll.y && a.ll.z == b.ll.z &&
+		a.ur.x == b.ur.x && a.ur.y == b.ur.y && a.ur.z == b.ur.z, "round trip keeps the bounds" );
+
+	const std::vector<Ray> rays = Rays( extent );
+	bool identical = true;
+	for( size_t r = 0; r < rays.size(); r++ ) {
+		RayIntersectionGeometric ra( rays[r], nullRasterizerState );
+		RayIntersectionGeometric rb( rays[r], nullRasterizerState );
+		pGeom->IntersectRay( ra, true, true, false );
+		pLoaded->IntersectRay( rb, true, true, false );
+		if( ra.bHit != rb.bHit || ( ra.bHit && ( ra.range != rb.range || ra.ptCoord.x != rb.ptCoord.x || ra.ptCoord.y != rb.ptCoord.y ) ) ) {
+			identical = false;
+		}
+	}
+	Check( identical, "loaded geometry gives identical hits" );
+
+	pLoaded->release();
+}
+
+static void TestBezier()
+{
+	std::cout << "Test: Bezier patches" << std::endl;
+
+	const std::vector<BezierPatch> patches = BezierSheet( 4 );
+	BezierPatchGeometry* pGeom = new BezierPatchGeometry();
+	for( size_t i = 0; i < patches.size(); i++ ) pGeom->AddPatch( patches[i] );
+	pGeom->Prepare();
+	Check( pGeom->numPatches() == 16, "sixteen patches" );
+
+	CompareToBruteForce( pGeom, patches, 4, "bezier" );
+	CompareRoundTrip( pGeom, 4, 16 );
+
+	pGeom->release();
+}
+
+static void TestBilinear()
+{
+	std::cout << "Test: bilinear patches" << std::endl;
+
+	const std::vector<BilinearPatch> patches = BilinearSheet( 8 );
+	BilinearPatchGeometry* pGeom = new BilinearPatchGeometry();
+	for( size_t i = 0; i < patches.size(); i++ ) pGeom->AddPatch( patches[i] );
+	pGeom->Prepare();
+	Check( pGeom->numPatches() == 64, "sixty-four patches" );
+
+	CompareToBruteForce( pGeom, patches, 4, "bilinear" );
+	CompareRoundTrip( pGeom, 4, 64 );
+
+	pGeom->release();
+}
+
+static void TestSubdividedBounds()
+{
+	std::cout << "Test: subdivided Bezier bounds" << std::endl;
+
+	// One strongly curved patch: the middle control points bulge far
+	// above the surface they pull on
+	BezierPatch p;
+	for( int r = 0; r < 4; r++ ) {
+		for( int c = 0; c < 4; c++ ) {
+			const bool inner = ( r == 1 || r == 2 ) && ( c == 1 || c == 2 );
+			p.c[r].pts[c] = Point3( c, inner ? 3.0 : 0.0, r );
+		}
+	}
+
+	const BoundingBox hull = GeometricUtilities::BezierPatchBoundingBox( p );
+	bool contained = true, inside = true;
+	Scalar lastTop = RISE_INFINITY;
+	for( unsigned int levels = 0; levels <= 3; levels++ ) {
+		const BoundingBox box = GeometricUtilities::BezierPatchSubdividedBoundingBox( p, levels );
+		if( box.ll.x < hull.ll.x - 1e-12 || box.ll.y < hull.ll.y - 1e-12 || box.ll.z < hull.ll.z - 1e-12 ||
+			box.ur.x > hull.ur.x + 1e-12 || box.ur.y > hull.ur.y + 1e-12 || box.ur.z > hull.ur.z + 1e-12 ) {
+			inside = false;
+		}
+		if( box.ur.y > lastTop + 1e-12 ) inside = false;
+		lastTop = box.ur.y;
+
+		for( int i = 0; i <= 20; i++ ) {
+			for( int j = 0; j <= 20; j++ ) {
+				const Point3 s = GeometricUtilities::EvaluateBezierPatchAt( p, i / 20.0, j / 20.0 );
+				if( s.x < box.ll.x - 1e-9 || s.y < box.ll.y - 1e-9 || s.z < box.ll.z - 1e-9 ||
+					s.x > box.ur.x + 1e-9 || s.y > box.ur.y + 1e-9 || s.z > box.ur.z + 1e-9 ) {
+					contained = false;
+				}
+			}
+		}
+	}
+	Check( inside, "subdivided boxes sit inside the hull box and shrink with depth" );
+	Check( contained, "subdivided boxes contain the surface" );
+
+	// The surface peaks at 3 * (3/4)^2 = 1.69; two levels get close to it
+	const BoundingBox two = GeometricUtilities::BezierPatchSubdividedBoundingBox( p, 2 );
+	Check( Near( hull.ur.y, 3.0 ) && two.ur.y < 2.0, "two levels trim most of the bulge" );
+}
+
+int main()
+{
+	std::cout << "=== Patch Geometry BVH Tests ===" << std::endl;
+
+	TestBezier();
+	TestBilinear();
+	TestSubdividedBounds();
+
+	std::cout << std::endl << "Passed: " << passCount << "  Failed: " << failCount << std::endl;
+	return failCount > 0 ? 1 : 0;
+}
@@ -0,0 +1,283 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  PixelReuseCacheTest.cpp - Tests for the interactive preview's
+//  pixel history
+//
+//  Fetch must return a recorded pixel only if it was traced with at
+//  least the requested samples.  InvalidateObjects must drop the
+//  pixels whose first hit is an edited object and their 8 neighbours,
+//  and nothing else.  Resize must drop everything when the size
+//  changes and keep everything when it does not.  Reproject must carry
+//  each hit point to the pixel that sees it from a pinhole camera's new
+//  pose, hold it back until it is confirmed, and drop what turned too
+//  far.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "../src/Library/RISE_API.h"
+#include "../src/Library/Interfaces/ICamera.h"
+#include "../src/Library/Rendering/PixelReuseCache.h"
+#include "../src/Library/Utilities/RandomNumbers.h"
+#include "../src/Library/Utilities/RuntimeContext.h"
+
+using namespace RISE;
+using namespace RISE::Implementation;
+
+static int passCount = 0;
+static int failCount = 0;
+
+static void Check( bool cond, const char* name )
+{
+	if( cond ) { ++passCount; }
+	else { ++failCount; std::cout << "  FAIL: " << name << std::endl; }
+}
+
+// Only the addresses are used as first-hit identities
+static const IObject* const kObjA = reinterpret_cast<const IObject*>( 0x1000 );
+static const IObject* const kObjB = reinterpret_cast<const IObject*>( 0x2000 );
+
+static RISEColor Colour( unsigned int x, unsigned int y )
+{
+	return RISEColor( RISEPel( x, y, x+y ), 1.0 );
+}
+
+static PrimaryHit Hit( const IObject* pObject )
+{
+	PrimaryHit h;
+	h.pObject = pObject;
+	h.captured = true;
+	return h;
+}
+
+static void TestFetchAndSamples()
+{
+	std::cout << "Test: fetch honours the sample count" << std::endl;
+
+	PixelReuseCache cache;
+	cache.Resize( 4, 3 );
+	Check( cache.CountValid() == 0, "starts empty" );
+
+	RISEColor c;
+	Check( !cache.Fetch( 1, 1, 1, c ), "nothing to fetch before a record" );
+
+	cache.Record( 1, 1, 4, Hit( kObjA ), Colour( 1, 1 ) );
+	Check( cache.Fetch( 1, 1, 1, c ) && c.base[0] == 1 && c.base[2] == 2, "a 4 spp pixel serves a 1 spp pass" );
+	Check( cache.Fetch( 1, 1, 4, c ), "and a 4 spp pass" );
+	Check( !cache.Fetch( 1, 1, 16, c ), "but not a 16 spp pass" );
+
+	cache.Record( 2, 1, 1, Hit( 0 ), Colour( 2, 1 ) );
+	Check( !cache.Fetch( 2, 1, 4, c ), "a 1 spp pixel is retraced by a polish pass" );
+	Check( !cache.Fetch( 9, 9, 1, c ), "out of range fetch fails" );
+	Check( cache.CountValid() == 2, "two valid pixels" );
+
+	cache.InvalidateAll();
+	Check( cache.CountValid() == 0 && !cache.Fetch( 1, 1, 1, c ), "InvalidateAll drops everything" );
+}
+
+static void TestInvalidateObjects()
+{
+	std::cout << "Test: object invalidation with neighbour dilation" << std::endl;
+
+	const unsigned int W = 8, H = 6;
+	PixelReuseCache cache;
+	cache.Resize( W, H );
+
+	// Object A covers the single pixel (3,2), B a column at x=7, the
+	// rest is background
+	for( unsigned int y = 0; y < H; y++ ) {
+		for( unsigned int x = 0; x < W; x++ ) {
+			const IObject* obj = 0;
+			if( x == 3 && y == 2 ) obj = kObjA;
+			else if( x == 7 ) obj = kObjB;
+			cache.Record( x, y, 1, Hit( obj ), Colour( x, y ) );
+		}
+	}
+	Check( cache.CountValid() == W*H, "all recorded" );
+
+	cache.InvalidateObjects( std::vector<const IObject*>( 1, kObjA ) );
+
+	bool exact = true;
+	RISEColor c;
+	for( unsigned int y = 0; y < H; y++ ) {
+		for( unsigned int x = 0; x < W; x++ ) {
+			const bool nearA = x >= 2 && x <= 4 && y >= 1 && y <= 3;
+			if( cache.Fetch( x, y, 1, c ) == nearA ) exact = false;
+		}
+	}
+	Check( exact, "exactly the 3x3 around the edited pixel dropped" );
+	Check( cache.CountValid() == W*H - 9, "nine pixels dropped" );
+
+	// Dropped pixels must not spread the invalidation any further
+	cache.InvalidateObjects( std::vector<const IObject*>( 1, kObjA ) );
+	Check( cache.CountValid() == W*H - 9, "a second invalidation of A is a no-op" );
+
+	// B sits on the right edge: the dilation clamps at the border
+	cache.InvalidateObjects( std::vector<const IObject*>( 1, kObjB ) );
+	Check( cache.CountValid() == W*H - 9 - 2*H, "the edge column and its neighbour dropped" );
+	Check( cache.Fetch( 5, 0, 1, c ) && c.base[0] == 5, "pixels two columns away kept" );
+
+	cache.InvalidateObjects( std::vector<const IObject*>() );
+	Check( cache.CountValid() == W*H - 9 - 2*H, "an empty list drops nothing" );
+}
+
+static void TestResize()
+{
+	std::cout << "Test: resize" << std::endl;
+
+	PixelReuseCache cache;
+	cache.Resize( 5, 5 );
+	cache.Record( 0, 0, 1, Hit( kObjA ), Colour( 0, 0 ) );
+	cache.Resize( 5, 5 );
+	Check( cache.CountValid() == 1, "same size keeps the history" );
+	cache.Resize( 6, 5 );
+	Check( cache.CountValid() == 0 && cache.Width() == 6 && cache.Height() == 5, "a new size drops it" );
+}
+
+static ICamera* MakeCamera( const Point3& ptEye, const Point3& ptLookAt, unsigned int w, unsigned int h )
+{
+	ICamera* cam = 0;
+	RISE_API_CreatePinholeCamera(
+		&cam, ptEye, ptLookAt, Vector3( 0, 1, 0 ),
+		Scalar( 0.785398 ), w, h,
+		Scalar( 1 ), Scalar( 0 ), Scalar( 0 ), Scalar( 0 ),
+		Vector3( 0, 0, 0 ), Vector2( 0, 0 ) );
+	return cam;
+}
+
+// Where the camera ray of pixel (x,y) meets the plane z=0
+static bool TraceToPlane( const ICamera& cam, unsigned int x, unsigned int y, unsigned int h, PrimaryHit& hit )
+{
+	RandomNumberGenerator rng( 1u );
+	RuntimeContext rc( rng, RuntimeContext::PASS_NORMAL, false );
+	Ray ray;
+	if( !cam.GenerateRay( rc, ray, Point2( x, h-y ) ) || ray.Dir().z >= 0 ) {
+		return false;
+	}
+	hit = Hit( kObjA );
+	hit.ptHit = ray.PointAtLength( -ray.origin.z / ray.Dir().z );
+	hit.vDir = ray.Dir();
+	return true;
+}
+
+// Records every pixel of `cam` looking at the plane z=0
+static void RecordPlane( PixelReuseCache& cache, const ICamera& cam, unsigned int w, unsigned int h, unsigned int spp )
+{
+	for( unsigned int y = 0; y < h; y++ ) {
+		for( unsigned int x = 0; x < w; x++ ) {
+			PrimaryHit hit;
+			if( TraceToPlane( cam, x, y, h, hit ) ) {
+				cache.Record( x, y, spp, hit, Colour( x, y ) );
+			}
+		}
+	}
+}
+
+static void TestReproject()
+{
+	std::cout << "Test: reprojection over a camera move" << std::endl;
+
+	const unsigned int W = 64, H = 48;
+	ICamera* a = MakeCamera( Point3( 0, 0, 5 ), Point3( 0, 0, 0 ), W, H );
+	if( !a ) {
+		Check( false, "camera builds" );
+		return;
+	}
+
+	PixelReuseCache cache;
+	cache.Resize( W, H );
+	RecordPlane( cache, *a, W, H, 4 );
+	Check( cache.CountValid() == W*H, "the plane fills the view" );
+
+	// Slide the camera sideways by exactly two pixels' worth of the
+	// plane.  At 64 pixels across 45 degrees that turns the view of
+	// any point by at most about 1.4 degrees
+	PrimaryHit h0, h1;
+	TraceToPlane( *a, 10, 10, H, h0 );
+	TraceToPlane( *a, 11, 10, H, h1 );
+	const Scalar shift = 2*(h1.ptHit.x - h0.ptHit.x);
+	ICamera* b = MakeCamera( Point3( shift, 0, 5 ), Point3( shift, 0, 0 ), W, H );
+
+	cache.Reproject( b->GetMatrix(), b->GetLocation() );
+	Check( cache.CountValid() == 0, "nothing is fetchable until confirmed" );
+
+	unsigned int carried = 0;
+	bool landed = true;
+	bool onlyFromRight = true;
+	for( unsigned int y = 0; y < H; y++ ) {
+		for( unsigned int x = 0; x < W; x++ ) {
+			const IObject* pObject = 0;
+			Point3 pt;
+			if( !cache.NeedsConfirm( x, y, 1, pObject, pt ) ) {
+				if( x < W-2 ) onlyFromRight = false;
+				continue;
+			}
+			carried++;
+			PrimaryHit now;
+			if( x >= W-2 || !TraceToPlane( *b, x, y, H, now ) ||
+				pObject != kObjA || Point3Ops::Distance( now.ptHit, pt ) > 1e-6 ) {
+				landed = false;
+			}
+		}
+	}
+	Check( carried == (W-2)*H, "every pixel still in view is carried over" );
+	Check( landed, "each lands on the pixel that now sees it" );
+	Check( onlyFromRight, "only the newly exposed columns are empty" );
+
+	const IObject* pObject = 0;
+	Point3 pt;
+	Check( !cache.NeedsConfirm( 5, 5, 4, pObject, pt ), "a carried pixel counts as one sample" );
+
+	RISEColor c;
+	cache.Confirm( 5, 5, true );
+	Check( cache.Fetch( 5, 5, 1, c ) && c.base[0] == 7, "a confirmed pixel keeps its colour" );
+	Check( !cache.Fetch( 5, 5, 4, c ), "but not its sample count" );
+	cache.Confirm( 6, 5, false );
+	Check( !cache.Fetch( 6, 5, 1, c ) && !cache.NeedsConfirm( 6, 5, 1, pObject, pt ), "a rejected pixel is dropped" );
+
+	// Orbiting 10 degrees round the look-at point turns every view too far
+	RecordPlane( cache, *a, W, H, 1 );
+	const Scalar ang = 10.0 * PI / 180.0;
+	ICamera* o = MakeCamera( Point3( 5*sin( ang ), 0, 5*cos( ang ) ), Point3( 0, 0, 0 ), W, H );
+	cache.Reproject( o->GetMatrix(), o->GetLocation() );
+	unsigned int kept = 0;
+	for( unsigned int y = 0; y < H; y++ ) {
+		for( unsigned int x = 0; x < W; x++ ) {
+			if( cache.NeedsConfirm( x, y, 1, pObject, pt ) ) kept++;
+		}
+	}
+	Check( kept == 0, "a large orbit drops the history" );
+
+	// Misses are never carried over
+	cache.Resize( W, H );
+	cache.InvalidateAll();
+	cache.Record( 4, 4, 1, Hit( 0 ), Colour( 4, 4 ) );
+	cache.Reproject( a->GetMatrix(), a->GetLocation() );
+	Check( !cache.NeedsConfirm( 4, 4, 1, pObject, pt ) && cache.CountValid() == 0, "a miss is dropped" );
+
+	o->release();
+	b->release();
+	a->release();
+}
+
+int main()
+{
+	std::cout << "=== Pixel Reuse Cache Tests ===" << std::endl;
+
+	TestFetchAndSamples();
+	TestInvalidateObjects();
+	TestResize();
+	TestReproject();
+
+	std::cout << std::endl << "Passed: " << passCount << "  Failed: " << failCount << std::endl;
+	return failCount > 0 ? 1 : 0;
+}
@@ -0,0 +1,372 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  QuarticIntervalSolverTest.cpp - Accuracy of the interval cubic
+//  and quartic solvers and of the torus kernel built on them
+//
+//  The interval solvers must find every real root inside the window
+//  of polynomials built from known roots, as closely as evaluating
+//  the polynomial allows and with a worst case no worse than
+//  SolveQuartic's, ignore the roots outside it, report them sorted,
+//  and refuse non-finite input.  The torus kernel must
+//  put its hits on the surface from near and from far, agree with a
+//  marched reference about which rays hit and where, and still tell
+//  an origin inside the tube.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <iostream>
+#include <algorithm>
+#include <cfloat>
+
+#include "../src/Library/Utilities/Math3D/Math3D.h"
+#include "../src/Library/Utilities/Ray.h"
+#include "../src/Library/Utilities/RandomNumbers.h"
+#include "../src/Library/Functions/Polynomial.h"
+#include "../src/Library/Intersection/RayPrimitiveIntersections.h"
+
+using namespace RISE;
+
+static int passCount = 0;
+static int failCount = 0;
+
+static void Check( bool cond, const char* name )
+{
+	if( cond ) { ++passCount; }
+	else { ++failCount; std::cout << "  FAIL: " << name << std::endl; }
+}
+
+// Coefficients, leading first, of the monic polynomial with the given roots
+static void QuarticFromRoots( const Scalar (&r)[4], Scalar (&c)[5] )
+{
+	c[0] = 1.0;
+	c[1] = -( r[0] + r[1] + r[2] + r[3] );
+	c[2] = r[0]*r[1] + r[0]*r[2] + r[0]*r[3] + r[1]*r[2] + r[1]*r[3] + r[2]*r[3];
+	c[3] = -( r[0]*r[1]*r[2] + r[0]*r[1]*r[3] + r[0]*r[2]*r[3] + r[1]*r[2]*r[3] );
+	c[4] = r[0]*r[1]*r[2]*r[3];
+}
+
+// Largest distance from a known root to the nearest reported root, or
+// infinity when the counts differ
+static Scalar WorstRootError( const Scalar* known, const int numKnown, const Scalar* found, const int numFound )
+{
+	if( numKnown != numFound ) {
+		return RISE_INFINITY;
+	}
+	Scalar worst = 0;
+	for( int i = 0; i < numKnown; i++ ) {
+		Scalar best = RISE_INFINITY;
+		for( int j = 0; j < numFound; j++ ) {
+			best = std::min( best, std::fabs( known[i] - found[j] ) );
+		}
+		worst = std::max( worst, best );
+	}
+	return worst;
+}
+
+static void TestQuarticFromRoots()
+{
+	std::cout << "Test: quartics with known real roots" << std::endl;
+
+	RandomNumberGenerator rng( 1234 );
+	bool allFound = true, sorted = true, conditioned = true;
+	Scalar worstNew = 0, worstOld = 0;
+	for( int trial = 0; trial < 20000; trial++ ) {
+		// Separated roots in [-3,3], so the problem itself is well posed
+		Scalar r[4];
+		for( int i = 0; i < 4; i++ ) {
+			bool ok;
+			do {
+				r[i] = -3.0 + 6.0 * rng.CanonicalRandom();
+				ok = true;
+				for( int j = 0; j < i; j++ ) if( std::fabs( r[i] - r[j] ) < 0.05 ) ok = false;
+			} while( !ok );
+		}
+		Scalar c[5];
+		QuarticFromRoots( r, c );
+
+		Scalar s[4];
+		const int n = Polynomial::SolveQuarticWithinInterval( c, s, -4.0, 4.0 );
+		const Scalar errNew = WorstRootError( r, 4, s, n );
+		if( errNew > 1e-9 ) allFound = false;
+		for( int i = 1; i < n; i++ ) if( s[i] < s[i-1] ) sorted = false;
+
+		// Each root is as good as evaluating the polynomial near it
+		// allows: within a few times the Horner rounding bound over the
+		// slope there
+		for( int i = 0; i < 4 && n == 4; i++ ) {
+			const Scalar x = r[i], ax = std::fabs( x );
+			const Scalar mag = (((std::fabs( c[0] )*ax + std::fabs( c[1] ))*ax + std::fabs( c[2] ))*ax + std::fabs( c[3] ))*ax + std::fabs( c[4] );
+			const Scalar slope = ((4.0*c[0]*x + 3.0*c[1])*x + 2.0*c[2])*x + c[3];
+			const Scalar bound = 8.0 * DBL_EPSILON * mag / std::fabs( slope );
+			Scalar best = RISE_INFINITY;
+			for( int j = 0; j < n; j++ ) best = std::min( best, std::fabs( s[j] - x ) );
+			if( best > 4.0 * bound + 1e-15 ) conditioned = false;
+		}
+
+		Scalar so[4];
+		const int no = Polynomial::SolveQuartic( c, so );
+		const Scalar errOld = WorstRootError( r, 4, so, no );
+
+		worstNew = std::max( worstNew, errNew );
+		if( errOld < RISE_INFINITY ) worstOld = std::max( worstOld, errOld );
+	}
+	std::cout << "  worst root error: interval " << worstNew << ", SolveQuartic " << worstOld << std::endl;
+	Check( allFound, "every known root found to 1e-9" );
+	Check( sorted, "roots come out sorted" );
+	Check( conditioned, "each root within the evaluation error bound" );
+	Check( worstNew <= 2.0 * worstOld, "worst case no worse than SolveQuartic" );
+}
+
+static void TestQuarticWindowAndComplexRoots()
+{
+	std::cout << "Test: window and complex roots" << std::endl;
+
+	// (x-1)(x-2)(x-5)(x+3): the window [0,3] holds 1 and 2 only
+	{
+		const Scalar r[4] = { 1, 2, 5, -3 };
+		Scalar c[5];
+		QuarticFromRoots( r, c );
+		Scalar s[4];
+		const int n = Polynomial::SolveQuarticWithinInterval( c, s, 0.0, 3.0 );
+		Check( n == 2 && std::fabs( s[0] - 1 ) < 1e-12 && std::fabs( s[1] - 2 ) < 1e-12, "only the roots inside the window" );
+		Check( Polynomial::SolveQuarticWithinInterval( c, s, 2.5, 4.5 ) == 0, "an empty window between roots" );
+		Check( Polynomial::SolveQuarticWithinInterval( c, s, 3.0, 0.0 ) == 0, "an inverted window" );
+	}
+
+	// (x^2+1)(x-0.5)(x+0.25): two real roots and a complex pair
+	{
+		const Scalar c[5] = { 1.0, -0.25, 0.875, -0.25, -0.125 };
+		Scalar s[4];
+		const int n = Polynomial::SolveQuarticWithinInterval( c, s, -10.0, 10.0 );
+		Check( n == 2 && std::fabs( s[0] + 0.25 ) < 1e-12 && std::fabs( s[1] - 0.5 ) < 1e-12, "two real roots beside a complex pair" );
+	}
+
+	// (x^2+1)(x^2+4): no real roots
+	{
+		const Scalar c[5] = { 1.0, 0.0, 5.0, 0.0, 4.0 };
+		Scalar s[4];
+		Check( Polynomial::SolveQuarticWithinInterval( c, s, -10.0, 10.0 ) == 0, "no real roots" );
+	}
+
+	// A zero leading coefficient drops to the cubic: (x-1)(x-2)(x-3)
+	{
+		const Scalar c[5] = { 0.0, 1.0, -6.0, 11.0, -6.0 };
+		Scalar s[4];
+		const int n = Polynomial::SolveQuarticWithinInterval( c, s, 0.0, 10.0 );
+		Check( n == 3 && std::fabs( s[0] - 1 ) < 1e-12 && std::fabs( s[1] - 2 ) < 1e-12 && std::fabs( s[2] - 3 ) < 1e-12, "zero leading coefficient solves the cubic" );
+	}
+
+	// A root sitting exactly on the window's upper end is kept
+	{
+		const Scalar r[4] = { -1, 0.5, 2, 3 };
+		Scalar c[5];
+		QuarticFromRoots( r, c );
+		Scalar s[4];
+		const int n = Polynomial::SolveQuarticWithinInterval( c, s, 0.0, 2.0 );
+		Check( n == 2 && std::fabs( s[1] - 2 ) < 1e-12, "a root on the upper end of the window" );
+	}
+
+	// Non-finite coefficients ask for the fallback
+	{
+		const Scalar c[5] = { 1.0, std::numeric_limits<Scalar>::max() * 2.0, 0.0, 0.0, -1.0 };
+		Scalar s[4];
+		Check( Polynomial::SolveQuarticWithinInterval( c, s, -1.0, 1.0 ) == -1, "non-finite coefficients return -1" );
+	}
+}
+
+static void TestCubic()
+{
+	std::cout << "Test: cubics" << std::endl;
+
+	RandomNumberGenerator rng( 99 );
+	bool allFound = true;
+	for( int trial = 0; trial < 20000; trial++ ) {
+		Scalar r[3];
+		for( int i = 0; i < 3; i++ ) {
+			bool ok;
+			do {
+				r[i] = -2.0 + 4.0 * rng.CanonicalRandom();
+				ok = true;
+				for( int j = 0; j < i; j++ ) if( std::fabs( r[i] - r[j] ) < 0.05 ) ok = false;
+			} while( !ok );
+		}
+		const Scalar lead = 0.1 + 3.0 * rng.CanonicalRandom();
+		const Scalar c[4] = {
+			lead,
+			-lead * ( r[0] + r[1] + r[2] ),
+			lead * ( r[0]*r[1] + r[0]*r[2] + r[1]*r[2] ),
+			-lead * r[0]*r[1]*r[2]
+		};
+		Scalar s[3];
+		const int n = Polynomial::SolveCubicWithinInterval( c, s, -3.0, 3.0 );
+		if( WorstRootError( r, 3, s, n ) > 1e-9 ) allFound = false;
+	}
+	Check( allFound, "every cubic root found to 1e-9" );
+
+	// A quadratic handed in as a cubic, with one root outside the window
+	{
+		const Scalar c[4] = { 0.0, 2.0, -2.0, -12.0 };		// 2(x-3)(x+2)
+		Scalar s[3];
+		const int n = Polynomial::SolveCubicWithinInterval( c, s, 0.0, 5.0 );
+		Check( n == 1 && std::fabs( s[0] - 3 ) < 1e-12, "quadratic case keeps the window" );
+	}
+}
+
+// Implicit torus, relative to the size of its terms at p
+static Scalar TorusResidual( const Point3& p, const Scalar R, const Scalar r )
+{
+	const Scalar sq = p.x*p.x + p.y*p.y + p.z*p.z;
+	const Scalar a = sq + R*R - r*r;
+	const Scalar F = a*a - 4.0*R*R*( p.x*p.x + p.z*p.z );
+	return std::fabs( F ) / ( a*a + 4.0*R*R*( p.x*p.x + p.z*p.z ) + r*r*r*r );
+}
+
+static Scalar TorusF( const Point3& p, const Scalar R, const Scalar r )
+{
+	const Scalar sq = p.x*p.x + p.y*p.y + p.z*p.z;
+	const Scalar a = sq + R*R - r*r;
+	return a*a - 4.0*R*R*( p.x*p.x + p.z*p.z );
+}
+
+// First sign change of the implicit along the ray, marched in small
+// steps through the bounding sphere and bisected
+static bool MarchedFirstHit( const Ray& ray, const Scalar R, const Scalar r, Scalar& t )
+{
+	const Vector3 d = ray.Dir();
+	const Scalar tc = -( ray.origin.x*d.x + ray.origin.y*d.y + ray.origin.z*d.z );
+	const Point3 c = ray.PointAtLength( tc );
+	const Scalar h2 = ( R + r )*( R + r ) - ( c.x*c.x + c.y*c.y + c.z*c.z );
+	if( h2 <= 0 ) {
+		return false;
+	}
+	const Scalar h = std::sqrt( h2 );
+	const Scalar t0 = std::max( tc - h, Scalar( 1e-6 ) ), t1 = tc + h;
+	if( t1 <= t0 ) {
+		return false;
+	}
+	const int steps = 4000;
+	Scalar a = t0;
+	Scalar fa = TorusF( ray.PointAtLength( a ), R, r );
+	for( int i = 1; i <= steps; i++ ) {
+		const Scalar b = t0 + ( t1 - t0 ) * i / steps;
+		const Scalar fb = TorusF( ray.PointAtLength( b ), R, r );
+		if( ( fa < 0 ) != ( fb < 0 ) ) {
+			Scalar lo = a, hi = b;
+			for( int k = 0; k < 100; k++ ) {
+				const Scalar m = 0.5 * ( lo + hi );
+				if( ( TorusF( ray.PointAtLength( m ), R, r ) < 0 ) == ( fa < 0 ) ) lo = m; else hi = m;
+			}
+			t = 0.5 * ( lo + hi );
+			return true;
+		}
+		a = b;
+		fa = fb;
+	}
+	return false;
+}
+
+static void TestTorus()
+{
+	std::cout << "Test: torus kernel" << std::endl;
+
+	const Scalar R = 1.0, r = 0.3;
+	RandomNumberGenerator rng( 7 );
+
+	const Scalar distances[3] = { 3.0, 50.0, 5000.0 };
+	for( int di = 0; di < 3; di++ ) {
+		unsigned int hits = 0, refHits = 0, agree = 0;
+		bool onSurface = true, noneMissed = true, closest = true;
+		for( int i = 0; i < 4000; i++ ) {
+			// From a point on a sphere of the given distance towards a
+			// point in the torus's box
+			const Scalar th = std::acos( 1.0 - 2.0 * rng.CanonicalRandom() ), ph = TWO_PI * rng.CanonicalRandom();
+			const Scalar D = distances[di];
+			const Point3 o( D*std::sin( th )*std::cos( ph ), D*std::cos( th ), D*std::sin( th )*std::sin( ph ) );
+			const Point3 aim( ( R + r ) * ( 2.0*rng.CanonicalRandom() - 1.0 ), r * ( 2.0*rng.CanonicalRandom() - 1.0 ), ( R + r ) * ( 2.0*rng.CanonicalRandom() - 1.0 ) );
+			const Ray ray( o, Vector3Ops::Normalize( Vector3Ops::mkVector3( aim, o ) ) );
+
+			HIT h;
+			RayTorusIntersection( ray, h, R, r, R*R );
+			Scalar tRef = 0;
+			const bool bRef = MarchedFirstHit( ray, R, r, tRef );
+
+			if( h.bHit ) {
+				hits++;
+				if( TorusResidual( ray.PointAtLength( h.dRange ), R, r ) > 1e-10 ) onSurface = false;
+			}
+			if( bRef ) {
+				refHits++;
+				if( !h.bHit ) noneMissed = false;
+				else if( h.dRange > tRef + 1e-9 * D ) closest = false;
+				else if( std::fabs( h.dRange - tRef ) <= 1e-9 * D ) agree++;
+			}
+		}
+		std::cout << "  from " << distances[di] << ": " << hits << " hits, marched reference " << refHits << ", " << agree << " at the same distance" << std::endl;
+		Check( hits > 400, "the rays hit the torus" );
+		Check( onSurface, "every hit lies on the surface" );
+		Check( noneMissed, "no ray the reference hits is missed" );
+		Check( closest, "no hit beyond the reference's first crossing" );
+		Check( agree + 5 >= refHits, "hits agree with the reference" );
+	}
+
+	// An origin inside the tube reports range2 = 0
+	{
+		bool inside = true;
+		for( int i = 0; i < 1000; i++ ) {
+			const Scalar a = TWO_PI * rng.CanonicalRandom(), b = TWO_PI * rng.CanonicalRandom(), rr = 0.9 * r * rng.CanonicalRandom();
+			const Point3 o( ( R + rr*std::cos( b ) ) * std::cos( a ), rr * std::sin( b ), ( R + rr*std::cos( b ) ) * std::sin( a ) );
+			const Scalar u = TWO_PI * rng.CanonicalRandom(), v = std::acos( 1.0 - 2.0 * rng.CanonicalRandom() );
+			const Ray ray( o, Vector3( std::sin( v )*std::cos( u ), std::cos( v ), std::sin( v )*std::sin( u ) ) );
+			HIT h;
+			RayTorusIntersection( ray, h, R, r, R*R );
+			if( !h.bHit || h.dRange2 != 0 || TorusResidual( ray.PointAtLength( h.dRange ), R, r ) > 1e-10 ) inside = false;
+		}
+		Check( inside, "an origin inside the tube hits with range2 = 0" );
+	}
+
+	// A continuation ray leaving the surface does not hit itself
+	{
+		bool noSelf = true;
+		for( int i = 0; i < 1000; i++ ) {
+			const Scalar a = TWO_PI * rng.CanonicalRandom(), b = TWO_PI * rng.CanonicalRandom();
+			const Point3 p( ( R + r*std::cos( b ) ) * std::cos( a ), r * std::sin( b ), ( R + r*std::cos( b ) ) * std::sin( a ) );
+			const Vector3 n( std::cos( b ) * std::cos( a ), std::sin( b ), std::cos( b ) * std::sin( a ) );
+			const Ray ray( p, n );
+			HIT h;
+			RayTorusIntersection( ray, h, R, r, R*R );
+			if( h.bHit && h.dRange < 1e-6 ) noSelf = false;
+		}
+		Check( noSelf, "a ray leaving along the normal does not hit at its origin" );
+	}
+
+	// Rays that pass the bounding sphere by, or run flat above the tube
+	{
+		HIT h;
+		RayTorusIntersection( Ray( Point3( 0, 5, -10 ), Vector3( 0, 0, 1 ) ), h, R, r, R*R );
+		Check( !h.bHit, "a ray past the bounding sphere misses" );
+		RayTorusIntersection( Ray( Point3( 0, 0.31, -10 ), Vector3( 0, 0, 1 ) ), h, R, r, R*R );
+		Check( !h.bHit, "a flat ray just above the tube misses" );
+		RayTorusIntersection( Ray( Point3( 0, 0.29, -10 ), Vector3( 0, 0, 1 ) ), h, R, r, R*R );
+		Check( h.bHit && std::fabs( h.dRange - ( 10.0 - R - std::sqrt( r*r - 0.29*0.29 ) ) ) < 1e-9, "a flat ray just inside the tube hits where expected" );
+	}
+}
+
+int main()
+{
+	std::cout << "=== Quartic Interval Solver Tests ===" << std::endl;
+
+	TestQuarticFromRoots();
+	TestQuarticWindowAndComplexRoots();
+	TestCubic();
+	TestTorus();
+
+	std::cout << std::endl << "Passed: " << passCount << "  Failed: " << failCount << std::endl;
+	return failCount > 0 ? 1 : 0;
+}
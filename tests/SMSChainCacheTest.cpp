@@ -0,0 +1,169 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  SMSChainCacheTest.cpp - Tests for the SMS converged-chain cache
+//
+//  A stored chain must come back for queries in the same shading
+//  cell and light region with the same topology, and must not come
+//  back when the cell, the light region, the chain length, a vertex
+//  object or a vertex's scattering flags differ.  Concurrent inserts
+//  and lookups must be safe and counted.
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "../src/Library/Utilities/Math3D/Math3D.h"
+#include "../src/Library/Utilities/SMSChainCache.h"
+
+using namespace RISE;
+using namespace RISE::Implementation;
+
+static int passCount = 0;
+static int failCount = 0;
+
+static void Check( bool cond, const char* name )
+{
+	if( cond ) { ++passCount; }
+	else { ++failCount; std::cout << "  FAIL: " << name << std::endl; }
+}
+
+// Object identity only matters as a pointer value, so any distinct
+// addresses will do
+static const char objA = 0;
+static const char objB = 0;
+
+static std::vector<ManifoldVertex> MakeChain( const Scalar x, const IObject* first, const IObject* second )
+{
+	std::vector<ManifoldVertex> chain( 2 );
+	chain[0].position = Point3( x, 1, 0 );
+	chain[0].pObject = first;
+	chain[0].isExiting = false;
+	chain[1].position = Point3( x, 1.5, 0 );
+	chain[1].pObject = second;
+	chain[1].isExiting = true;
+	chain[0].valid = chain[1].valid = true;
+	return chain;
+}
+
+static void TestHitAndMiss()
+{
+	std::cout << "Test: lookup hits and misses" << std::endl;
+
+	const IObject* pA = reinterpret_cast<const IObject*>( &objA );
+	const IObject* pB = reinterpret_cast<const IObject*>( &objB );
+
+	SMSChainCache cache( 1024, 0.1, 0.8 );
+	const Point3 shading( 0.01, 0.02, 0.03 );
+	const Point3 light( 0.1, 5, 0.1 );
+
+	const std::vector<ManifoldVertex> stored = MakeChain( 0.25, pA, pA );
+	cache.Insert( shading, light, stored );
+
+	std::vector<ManifoldVertex> out;
+	const std::vector<ManifoldVertex> seed = MakeChain( 0.3, pA, pA );
+
+	Check( cache.Lookup( Point3( 0.09, 0.05, 0.01 ), Point3( 0.5, 5.3, 0.2 ), seed, out ), "same cells hit" );
+	Check( out.size() == 2 && out[0].position.x == 0.25 && out[1].position.y == 1.5, "returns the stored chain, not the seed" );
+
+	Check( !cache.Lookup( Point3( 0.11, 0.02, 0.03 ), light, seed, out ), "neighbouring shading cell misses" );
+	Check( !cache.Lookup( Point3( -0.01, 0.02, 0.03 ), light, seed, out ), "negative side of the cell boundary misses" );
+	Check( !cache.Lookup( shading, Point3( 0.1, 6, 0.1 ), seed, out ), "different light region misses" );
+
+	Check( !cache.Lookup( shading, light, MakeChain( 0.3, pA, pB ), out ), "different object misses" );
+
+	std::vector<ManifoldVertex> flipped = seed;
+	flipped[1].isReflection = true;
+	Check( !cache.Lookup( shading, light, flipped, out ), "different scattering flags miss" );
+
+	std::vector<ManifoldVertex> longer = seed;
+	longer.push_back( seed[1] );
+	Check( !cache.Lookup( shading, light, longer, out ), "different chain length misses" );
+
+	Check( !cache.Lookup( shading, light, std::vector<ManifoldVertex>(), out ), "empty topology misses" );
+
+	// A later insert for the same key replaces the earlier one
+	cache.Insert( shading, light, MakeChain( 0.75, pA, pA ) );
+	Check( cache.Lookup( shading, light, seed, out ) && out[0].position.x == 0.75, "insert replaces" );
+
+	const SMSChainCache::Stats s = cache.GetStats();
+	Check( s.lookups == 9 && s.hits == 2 && s.inserts == 2, "stats" );
+}
+
+static void TestSameTopology()
+{
+	std::cout << "Test: topology comparison" << std::endl;
+
+	const IObject* pA = reinterpret_cast<const IObject*>( &objA );
+	const IObject* pB = reinterpret_cast<const IObject*>( &objB );
+
+	Check( SMSChainCache::SameTopology( MakeChain( 0, pA, pB ), MakeChain( 9, pA, pB ) ), "positions do not matter" );
+	Check( !SMSChainCache::SameTopology( MakeChain( 0, pA, pB ), MakeChain( 0, pB, pA ) ), "object order matters" );
+
+	std::vector<ManifoldVertex> mirror = MakeChain( 0, pA, pB );
+	mirror[0].canRefract = false;
+	Check( !SMSChainCache::SameTopology( MakeChain( 0, pA, pB ), mirror ), "canRefract matters" );
+}
+
+static void TestConcurrent()
+{
+	std::cout << "Test: concurrent inserts and lookups" << std::endl;
+
+	const IObject* pA = reinterpret_cast<const IObject*>( &objA );
+
+	// Small table so threads collide on slots and shards
+	SMSChainCache cache( 64, 0.01, 0.08 );
+
+	const unsigned int numThreads = 8;
+	const unsigned int perThread = 5000;
+	std::vector<std::thread> threads;
+	std::vector<unsigned int> goodHits( numThreads, 0 );
+
+	for( unsigned int t = 0; t < numThreads; t++ ) {
+		threads.push_back( std::thread( [&cache, &goodHits, pA, t, perThread]() {
+			std::vector<ManifoldVertex> out;
+			for( unsigned int i = 0; i < perThread; i++ ) {
+				const Scalar x = Scalar( (i * 7 + t) % 200 ) * 0.01 + 0.005;
+				const Point3 p( x, 0, 0 );
+				const std::vector<ManifoldVertex> chain = MakeChain( x, pA, pA );
+				cache.Insert( p, p, chain );
+				if( cache.Lookup( p, p, chain, out ) && out.size() == 2 && out[0].pObject == pA ) {
+					goodHits[t]++;
+				}
+			}
+		} ) );
+	}
+
+	for( unsigned int t = 0; t < numThreads; t++ ) {
+		threads[t].join();
+	}
+
+	const SMSChainCache::Stats s = cache.GetStats();
+	unsigned int hits = 0;
+	for( unsigned int t = 0; t < numThreads; t++ ) {
+		hits += goodHits[t];
+	}
+
+	Check( s.lookups == numThreads * perThread && s.inserts == numThreads * perThread, "every call counted" );
+	Check( s.hits == hits, "every hit returned a well-formed chain" );
+	Check( hits > 0, "some lookups hit" );
+}
+
+int main()
+{
+	std::cout << "=== SMSChainCache Tests ===" << std::endl;
+
+	TestHitAndMiss();
+	TestSameTopology();
+	TestConcurrent();
+
+	std::cout << std::endl << "Passed: " << passCount << "  Failed: " << failCount << std::endl;
+	return failCount > 0 ? 1 : 0;
+}
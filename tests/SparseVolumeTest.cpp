@@ -0,0 +1,256 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  SparseVolumeTest.cpp - Tests for the sparse bricked volume
+//
+//  SparseVolume<T> must be a drop-in for Volume<T>: every voxel (and
+//  every out-of-range coordinate) reads back the same value, the
+//  bricked trilinear accessor must match VolumeAccessor_TRI bit for
+//  bit, empty bricks must not be resident, and a majorant grid built
+//  from brick maxima must never fall below the voxel-based grid (and
+//  must equal it when bricks nest inside cells).
+//
+//  Author: Aravind Krishnaswamy
+//  Date of Birth: October 19, 2026
+//  Tabs: 4
+//
+//  License Information: Please see the attached LICENSE.TXT file
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+
+#include "../src/Library/Utilities/Math3D/Math3D.h"
+#include "../src/Library/Volume/Volume.h"
+#include "../src/Library/Volume/SparseVolume.h"
+#include "../src/Library/Volume/VolumeAccessor_TRI.h"
+#include "../src/Library/Volume/VolumeAccessor_BrickedTRI.h"
+#include "../src/Library/Utilities/MajorantGrid.h"
+
+using namespace RISE;
+using namespace RISE::Implementation;
+
+static int passCount = 0;
+static int failCount = 0;
+
+static void Check( bool cond, const char* name )
+{
+	if( cond ) { ++passCount; }
+	else { ++failCount; std::cout << "  FAIL: " << name << std::endl; }
+}
+
+static std::string TmpDir()
+{
+	const char* tmp = getenv( "TMPDIR" );
+	std::string dir = tmp ? tmp : "/tmp/";
+	if( !dir.empty() && dir[dir.size()-1] != '/' ) dir += "/";
+	return dir;
+}
+
+// Density of voxel (x,y,z): a solid blob in one corner, one isolated
+// voxel far from it, zero elsewhere
+static unsigned char Density( unsigned int x, unsigned int y, unsigned int z )
+{
+	if( x < 11 && y < 9 && z < 10 ) {
+		return static_cast<unsigned char>( 1 + (x*7 + y*13 + z*29) % 254 );
+	}
+	if( x == 30 && y == 20 && z == 17 ) {
+		return 200;
+	}
+	return 0;
+}
+
+static std::string WriteSlices( const char* tag, unsigned int w, unsigned int h, unsigned int d )
+{
+	const std::string pattern = TmpDir() + "rise_sparsevol_" + tag + "_%d.raw";
+	for( unsigned int z = 0; z < d; z++ ) {
+		char path[1024];
+		snprintf( path, sizeof( path ), pattern.c_str(), z );
+		std::vector<unsigned char> slice( w*h );
+		for( unsigned int y = 0; y < h; y++ )
+			for( unsigned int x = 0; x < w; x++ )
+				slice[y*w + x] = Density( x, y, z );
+		std::ofstream f( path, std::ios::binary | std::ios::trunc );
+		f.write( reinterpret_cast<const char*>( &slice[0] ), slice.size() );
+	}
+	return pattern;
+}
+
+static void RemoveSlices( const std::string& pattern, unsigned int d )
+{
+	for( unsigned int z = 0; z < d; z++ ) {
+		char path[1024];
+		snprintf( path, sizeof( path ), pattern.c_str(), z );
+		remove( path );
+	}
+}
+
+static void TestMatchesDense()
+{
+	std::cout << "Test: sparse volume matches dense volume" << std::endl;
+
+	const unsigned int W = 37, H = 29, D = 21;
+	const std::string pattern = WriteSlices( "match", W, H, D );
+
+	Volume<unsigned char>* dense = new Volume<unsigned char>( pattern.c_str(), W, H, 0, D-1 );
+	SparseVolume<unsigned char>* sparse = new SparseVolume<unsigned char>( pattern.c_str(), W, H, 0, D-1 );
+
+	Check( sparse->Width() == W && sparse->Height() == H && sparse->Depth() == D, "dimensions" );
+	Check( sparse->BricksX() == 5 && sparse->BricksY() == 4 && sparse->BricksZ() == 3, "brick counts" );
+
+	// Blob covers bricks x 0..1, y 0..1, z 0..1 (8), plus the lone voxel's brick
+	Check( sparse->ResidentBricks() == 9, "only non-empty bricks are resident" );
+
+	bool same = true;
+	for( int z = -int(D)/2 - 2; z < int(D) - int(D)/2 + 2; z++ )
+		for( int y = -int(H)/2 - 2; y < int(H) - int(H)/2 + 2; y++ )
+			for( int x = -int(W)/2 - 2; x < int(W) - int(W)/2 + 2; x++ )
+				if( dense->GetValue( x, y, z ) != sparse->GetValue( x, y, z ) )
+					same = false;
+	Check( same, "every voxel, including out of range, reads the same" );
+
+	// Cell fetches agree with 8 GetValue calls everywhere, brick seams included
+	bool cellsOk = true;
+	for( int z = -int(D)/2 - 1; z < int(D) - int(D)/2; z++ )
+		for( int y = -int(H)/2 - 1; y < int(H) - int(H)/2; y++ )
+			for( int x = -int(W)/2 - 1; x < int(W) - int(W)/2; x++ ) {
+				Scalar v[8];
+				sparse->GetCellValues( x, y, z, v );
+				for( int i = 0; i < 8; i++ )
+					if( v[i] != dense->GetValue( x + (i&1), y + ((i>>1)&1), z + ((i>>2)&1) ) )
+						cellsOk = false;
+			}
+	Check( cellsOk, "GetCellValues matches per-voxel reads" );
+
+	// Brick min/max
+	bool bounds = true;
+	for( unsigned int bz = 0; bz < sparse->BricksZ(); bz++ )
+		for( unsigned int by = 0; by < sparse->BricksY(); by++ )
+			for( unsigned int bx = 0; bx < sparse->BricksX(); bx++ ) {
+				unsigned char mx = 0;
+				for( unsigned int z = bz*8; z < bz*8+8 && z < D; z++ )
+					for( unsigned int y = by*8; y < by*8+8 && y < H; y++ )
+						for( unsigned int x = bx*8; x < bx*8+8 && x < W; x++ )
+							if( Density( x, y, z ) > mx ) mx = Density( x, y, z );
+				if( sparse->BrickMaxValue( bx, by, bz ) != Scalar(mx) / 255.0 )
+					bounds = false;
+			}
+	Check( bounds, "brick maxima" );
+
+	// Trilinear through bricks is bit identical to the dense trilinear accessor
+	VolumeAccessor_TRI* tri = new VolumeAccessor_TRI();
+	VolumeAccessor_BrickedTRI* btri = new VolumeAccessor_BrickedTRI();
+	tri->BindVolume( dense );
+	btri->BindVolume( sparse );
+
+	bool interpOk = true;
+	srand( 1234 );
+	for( int i = 0; i < 20000; i++ ) {
+		const Scalar x = (Scalar(rand()) / RAND_MAX - 0.5) * (W + 4);
+		const Scalar y = (Scalar(rand()) / RAND_MAX - 0.5) * (H + 4);
+		const Scalar z = (Scalar(rand()) / RAND_MAX - 0.5) * (D + 4);
+		if( tri->GetValue( x, y, z ) != btri->GetValue( x, y, z ) )
+			interpOk = false;
+	}
+	Check( interpOk, "bricked trilinear matches VolumeAccessor_TRI exactly" );
+
+	// Unbricked volume falls back to plain reads
+	VolumeAccessor_BrickedTRI* fallback = new VolumeAccessor_BrickedTRI();
+	fallback->BindVolume( dense );
+	Check( fallback->GetValue( Scalar(-12.25), Scalar(-10.5), Scalar(-6.75) ) ==
+		tri->GetValue( Scalar(-12.25), Scalar(-10.5), Scalar(-6.75) ), "fallback on a dense volume" );
+
+	fallback->release();
+	btri->release();
+	tri->release();
+	sparse->release();
+	dense->release();
+	RemoveSlices( pattern, D );
+}
+
+static void TestMajorantFromBricks()
+{
+	std::cout << "Test: majorant grid from brick maxima" << std::endl;
+
+	const Point3 bboxMin( -1, -1, -1 );
+	const Point3 bboxMax( 1, 1, 1 );
+	const Scalar sigma = 3.0;
+
+	// 64^3 gets the default 8^3 grid: every cell is exactly one brick
+	{
+		const unsigned int N = 64;
+		const std::string pattern = WriteSlices( "aligned", N, N, N );
+		SparseVolume<unsigned char>* sparse = new SparseVolume<unsigned char>( pattern.c_str(), N, N, 0, N-1 );
+		VolumeAccessor_TRI* tri = new VolumeAccessor_TRI();
+		tri->BindVolume( sparse );
+
+		unsigned int gx, gy, gz;
+		MajorantGrid::DefaultGridResolution( N, N, N, gx, gy, gz );
+		MajorantGrid voxelGrid( *tri, N, N, N, bboxMin, bboxMax, sigma, gx, gy, gz );
+		MajorantGrid brickGrid( *sparse, bboxMin, bboxMax, sigma, gx, gy, gz );
+
+		bool equal = true;
+		for( unsigned int cz = 0; cz < gz; cz++ )
+			for( unsigned int cy = 0; cy < gy; cy++ )
+				for( unsigned int cx = 0; cx < gx; cx++ )
+					if( voxelGrid.GetCellMajorant( cx, cy, cz ) != brickGrid.GetCellMajorant( cx, cy, cz ) )
+						equal = false;
+		Check( equal, "aligned grid equals the voxel-based grid" );
+
+		tri->release();
+		sparse->release();
+		RemoveSlices( pattern, N );
+	}
+
+	// Odd sizes: bricks straddle cells, the brick grid must stay an upper bound
+	{
+		const unsigned int W = 37, H = 29, D = 21;
+		const std::string pattern = WriteSlices( "unaligned", W, H, D );
+		SparseVolume<unsigned char>* sparse = new SparseVolume<unsigned char>( pattern.c_str(), W, H, 0, D-1 );
+		VolumeAccessor_TRI* tri = new VolumeAccessor_TRI();
+		tri->BindVolume( sparse );
+
+		unsigned int gx, gy, gz;
+		MajorantGrid::DefaultGridResolution( W, H, D, gx, gy, gz );
+		MajorantGrid voxelGrid( *tri, W, H, D, bboxMin, bboxMax, sigma, gx, gy, gz );
+		MajorantGrid brickGrid( *sparse, bboxMin, bboxMax, sigma, gx, gy, gz );
+
+		bool bound = true;
+		for( unsigned int cz = 0; cz < gz; cz++ )
+			for( unsigned int cy = 0; cy < gy; cy++ )
+				for( unsigned int cx = 0; cx < gx; cx++ )
+					if( brickGrid.GetCellMajorant( cx, cy, cz ) < voxelGrid.GetCellMajorant( cx, cy, cz ) )
+						bound = false;
+		Check( bound, "unaligned grid bounds the voxel-based grid" );
+
+		tri->release();
+		sparse->release();
+		RemoveSlices( pattern, D );
+	}
+}
+
+static void TestInvalidDimensions()
+{
+	std::cout << "Test: invalid dimensions give an empty volume" << std::endl;
+
+	SparseVolume<unsigned char>* v = new SparseVolume<unsigned char>( "nonexistent_%d.raw", 0, 16, 0, 3 );
+	Check( v->Width() == 0 && v->ResidentBricks() == 0, "zero width" );
+	Check( v->GetValue( 0, 0, 0 ) == 0, "reads zero" );
+	v->release();
+}
+
+int main()
+{
+	std::cout << "=== SparseVolume Tests ===" << std::endl;
+
+	TestMatchesDense();
+	TestMajorantFromBricks();
+	TestInvalidDimensions();
+
+	std::cout << std::endl << "Passed: " << passCount << "  Failed: " << failCount << std::endl;
+	return failCount > 0 ? 1 : 0;
+}
@@ -0,0 +1,274 @@
+// TriangleMeshCacheTest.cpp
+//
+// Tests for the opt-in on-disk mesh cache (Geometry/TriangleMeshCache).
+//
+// Coverage:
+//   - Disabled cache (no directory) is a no-op
+//   - Miss, store, then hit returns the same mesh, BVH included
+//   - Changing the source bytes or a loader parameter changes the entry
+//   - Truncated, bit-flipped and foreign entries are misses
+//   - Threads storing the same entry at once leave a loadable entry
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../src/Library/Geometry/TriangleMeshCache.h"
+#include "../src/Library/Geometry/TriangleMeshLoaderPLY.h"
+#include "../src/Library/Geometry/TriangleMeshGeometryIndexed.h"
+#include "../src/Library/Utilities/DiskFileWriteBuffer.h"
+#include "../src/Library/Intersection/RayIntersectionGeometric.h"
+
+using namespace RISE;
+using namespace RISE::Implementation;
+
+namespace
+{
+	std::string TempPath( const char* suffix )
+	{
+		static std::atomic<unsigned> counter{ 0 };
+		const auto stamp = std::chrono::steady_clock::now().time_since_epoch().count();
+		std::string name = "rise_meshcache_test_";
+		name += std::to_string( static_cast<unsigned long long>( stamp ) );
+		name += "_";
+		name += std::to_string( counter.fetch_add( 1 ) );
+		name += suffix;
+		return ( std::filesystem::temp_directory_path() / name ).string();
+	}
+
+	// An n x n grid of quads in the XY plane, bumped in z
+	void WriteGridPLY( const std::string& path, const unsigned int n, const float bump )
+	{
+		FILE* f = std::fopen( path.c_str(), "w" );
+		assert( f );
+		std::fprintf( f, "ply\nformat ascii 1.0\n" );
+		std::fprintf( f, "element vertex %u\nproperty float x\nproperty float y\nproperty float z\n", (n+1)*(n+1) );
+		std::fprintf( f, "element face %u\nproperty list uchar uint vertex_indices\nend_header\n", n*n );
+		for( unsigned int j=0; j<=n; j++ ) {
+			for( unsigned int i=0; i<=n; i++ ) {
+				std::fprintf( f, "%f %f %f\n", float(i)/n, float(j)/n, bump * std::sin( float(i+2*j) ) );
+			}
+		}
+		for( unsigned int j=0; j<n; j++ ) {
+			for( unsigned int i=0; i<n; i++ ) {
+				const unsigned int a = j*(n+1)+i;
+				std::fprintf( f, "4 %u %u %u %u\n", a, a+1, a+n+2, a+n+1 );
+			}
+		}
+		std::fclose( f );
+	}
+
+	TriangleMeshGeometryIndexed* LoadPLY( const std::string& path )
+	{
+		TriangleMeshGeometryIndexed* pMesh = new TriangleMeshGeometryIndexed( false, false );
+		TriangleMeshLoaderPLY* pLoader = new TriangleMeshLoaderPLY( path.c_str(), false );
+		const bool ok = pLoader->LoadTriangleMesh( pMesh );
+		assert( ok );
+		pLoader->release();
+		return pMesh;
+	}
+
+	bool SameHit( const TriangleMeshGeometryIndexed& a, const TriangleMeshGeometryIndexed& b, const Ray& ray )
+	{
+		RayIntersectionGeometric ra( ray, nullRasterizerState );
+		RayIntersectionGeometric rb( ray, nullRasterizerState );
+		a.IntersectRay( ra, true, true, false );
+		b.IntersectRay( rb, true, true, false );
+		if( ra.bHit != rb.bHit ) {
+			return false;
+		}
+		return !ra.bHit || ra.range == rb.range;
+	}
+}
+
+static void TestDisabledIsNoOp()
+{
+	std::cout << "Testing disabled mesh cache..." << std::endl;
+	const std::string ply = TempPath( ".ply" );
+	WriteGridPLY( ply, 4, 0.1f );
+
+	const TriangleMeshCache cache( "", "ply", ply.c_str(), "ds=0" );
+	assert( !cache.IsEnabled() );
+
+	TriangleMeshGeometryIndexed* pMesh = LoadPLY( ply );
+	assert( !cache.Store( *pMesh ) );
+	assert( !cache.Load( *pMesh ) );
+	pMesh->release();
+
+	std::remove( ply.c_str() );
+	std::cout << "Disabled mesh cache Passed!" << std::endl;
+}
+
+static void TestRoundTrip()
+{
+	std::cout << "Testing mesh cache round trip..." << std::endl;
+	const std::string dir = TempPath( "_dir" );
+	std::filesystem::create_directory( dir );
+	const std::string ply = TempPath( ".ply" );
+	WriteGridPLY( ply, 16, 0.1f );
+
+	const TriangleMeshCache cache( dir.c_str(), "ply", ply.c_str(), "ds=0 inv=0 fn=0" );
+	assert( cache.IsEnabled() );
+
+	// Miss
+	TriangleMeshGeometryIndexed* pCached = new TriangleMeshGeometryIndexed( false, false );
+	assert( !cache.Load( *pCached ) );
+
+	// Store, then hit
+	TriangleMeshGeometryIndexed* pParsed = LoadPLY( ply );
+	assert( cache.Store( *pParsed ) );
+	assert( std::filesystem::exists( cache.EntryPath() ) );
+	assert( cache.Load( *pCached ) );
+
+	assert( pCached->numPoints() == pParsed->numPoints() );
+	assert( pCached->getFaces().size() == pParsed->getFaces().size() );
+	assert( std::fabs( pCached->GetArea() - pParsed->GetArea() ) < 1e-12 );
+
+	for( int k=0; k<200; k++ ) {
+		const Scalar u = (k % 20) / 20.0 + 0.013, v = (k / 20) / 10.0 + 0.007;
+		const Ray ray( Point3( u, v, 2.0 ), Vector3( 0.01, -0.02, -1.0 ) );
+		assert( SameHit( *pCached, *pParsed, ray ) );
+	}
+
+	pCached->release();
+	pParsed->release();
+
+	// Different source bytes or different parameters: different entry
+	const TriangleMeshCache otherParams( dir.c_str(), "ply", ply.c_str(), "ds=1 inv=0 fn=0" );
+	assert( otherParams.EntryPath() != cache.EntryPath() );
+
+	WriteGridPLY( ply, 16, 0.2f );
+	const TriangleMeshCache edited( dir.c_str(), "ply", ply.c_str(), "ds=0 inv=0 fn=0" );
+	assert( edited.EntryPath() != cache.EntryPath() );
+	TriangleMeshGeometryIndexed* pMiss = new TriangleMeshGeometryIndexed( false, false );
+	assert( !edited.Load( *pMiss ) );
+	pMiss->release();
+
+	std::remove( ply.c_str() );
+	std::filesystem::remove_all( dir );
+	std::cout << "Mesh cache round trip Passed!" << std::endl;
+}
+
+static void TestDamagedEntries()
+{
+	std::cout << "Testing damaged mesh cache entries..." << std::endl;
+	const std::string dir = TempPath( "_dir" );
+	std::filesystem::create_directory( dir );
+	const std::string ply = TempPath( ".ply" );
+	WriteGridPLY( ply, 16, 0.1f );
+
+	const TriangleMeshCache cache( dir.c_str(), "ply", ply.c_str(), "ds=0 inv=0 fn=0" );
+	TriangleMeshGeometryIndexed* pParsed = LoadPLY( ply );
+	assert( cache.Store( *pParsed ) );
+	const std::uintmax_t size = std::filesystem::file_size( cache.EntryPath() );
+
+	std::vector<char> good( size );
+	{
+		FILE* f = std::fopen( cache.EntryPath().c_str(), "rb" );
+		assert( f );
+		const size_t got = std::fread( &good[0], 1, good.size(), f );
+		std::fclose( f );
+		assert( got == good.size() );
+	}
+	const auto writeEntry = [&cache]( const std::vector<char>& bytes ) {
+		FILE* f = std::fopen( cache.EntryPath().c_str(), "wb" );
+		assert( f );
+		if( !bytes.empty() ) {
+			std::fwrite( &bytes[0], 1, bytes.size(), f );
+		}
+		std::fclose( f );
+	};
+	const auto loads = [&cache]() {
+		TriangleMeshGeometryIndexed* pMesh = new TriangleMeshGeometryIndexed( false, false );
+		const bool hit = cache.Load( *pMesh );
+		pMesh->release();
+		return hit;
+	};
+
+	// Cut anywhere: the tail of the payload, mid-payload, inside the header
+	const size_t cuts[3] = { size - 1, size / 2, 10 };
+	for( int i=0; i<3; i++ ) {
+		writeEntry( std::vector<char>( good.begin(), good.begin() + cuts[i] ) );
+		assert( !loads() );
+	}
+
+	// One flipped bit in the mesh data
+	std::vector<char> flipped = good;
+	flipped[size / 2] ^= 0x10;
+	writeEntry( flipped );
+	assert( !loads() );
+
+	// A bare .risemesh (the previous entry layout) under the entry's name
+	{
+		DiskFileWriteBuffer* pBuffer = new DiskFileWriteBuffer( cache.EntryPath().c_str() );
+		pParsed->Serialize( *pBuffer );
+		pBuffer->release();
+	}
+	assert( !loads() );
+
+	writeEntry( good );
+	assert( loads() );
+
+	pParsed->release();
+	std::remove( ply.c_str() );
+	std::filesystem::remove_all( dir );
+	std::cout << "Damaged mesh cache entries Passed!" << std::endl;
+}
+
+static void TestConcurrentStores()
+{
+	std::cout << "Testing concurrent mesh cache stores..." << std::endl;
+	const std::string dir = TempPath( "_dir" );
+	std::filesystem::create_directory( dir );
+	const std::string ply = TempPath( ".ply" );
+	WriteGridPLY( ply, 24, 0.1f );
+
+	const TriangleMeshCache cache( dir.c_str(), "ply", ply.c_str(), "ds=0 inv=0 fn=0" );
+	TriangleMeshGeometryIndexed* pParsed = LoadPLY( ply );
+
+	std::vector<std::thread> threads;
+	for( int t=0; t<4; t++ ) {
+		threads.push_back( std::thread( [&cache, pParsed]() {
+			for( int k=0; k<4; k++ ) {
+				cache.Store( *pParsed );
+			}
+		} ) );
+	}
+	for( size_t t=0; t<threads.size(); t++ ) {
+		threads[t].join();
+	}
+
+	// Whoever won, the entry is whole and no temporary is left behind
+	TriangleMeshGeometryIndexed* pCached = new TriangleMeshGeometryIndexed( false, false );
+	assert( cache.Load( *pCached ) );
+	assert( pCached->numPoints() == pParsed->numPoints() );
+	pCached->release();
+
+	unsigned int files = 0;
+	for( const auto& entry : std::filesystem::directory_iterator( dir ) ) {
+		(void)entry;
+		files++;
+	}
+	assert( files == 1 );
+
+	pParsed->release();
+	std::remove( ply.c_str() );
+	std::filesystem::remove_all( dir );
+	std::cout << "Concurrent mesh cache stores Passed!" << std::endl;
+}
+
+int main()
+{
+	TestDisabledIsNoOp();
+	TestRoundTrip();
+	TestDamagedEntries();
+	TestConcurrentStores();
+	return 0;
+}
@@ -0,0 +1,226 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  TriangleMeshCompactTest.cpp - a compact TriangleMeshGeometryIndexed
+//  renders the same triangles as the default layout.
+//
+//  Builds the same meshes twice, once with SetCompactStorage, from
+//  float-exact positions so the triangles are identical, and checks:
+//    - rays hit the same surface at the same range, with normals,
+//      UVs and vertex colors within the encodings' precision;
+//    - shadow rays agree, and the area and bounds are unchanged;
+//    - corners that index positions, normals and coords differently
+//      are split into one vertex each;
+//    - meshes over 65536 vertices (32-bit indices) work as well;
+//    - a compact mesh serializes to a .risemesh the default layout
+//      reads back, and reads one back itself;
+//    - a compact mesh refuses UpdateVertices.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "../src/Library/Geometry/TriangleMeshGeometryIndexed.h"
+#include "../src/Library/Intersection/RayIntersectionGeometric.h"
+#include "../src/Library/Utilities/MemoryBuffer.h"
+#include "../src/Library/Utilities/RandomNumbers.h"
+
+#include <cmath>
+#include <cstdio>
+
+using namespace RISE;
+using namespace RISE::Implementation;
+
+static int g_pass = 0, g_fail = 0;
+static void Check( bool cond, const char* what ) { if( cond ) ++g_pass; else { ++g_fail; std::printf( "  FAIL: %s\n", what ); } }
+
+static Scalar F( const Scalar x ) { return (Scalar)(float)x; }
+
+// A bumpy sphere of n x n quads, UVs tiled 4x, with per-vertex colors.  With
+// bFaceVarying every triangle gets its own normals and coords, so no corner
+// shares its normal or coord index with its position index.
+static void BuildSphere( TriangleMeshGeometryIndexed& mesh, const int n, const bool bFaceVarying )
+{
+	mesh.BeginIndexedTriangles();
+	for( int j = 0; j <= n; j++ ) {
+		for( int i = 0; i <= n; i++ ) {
+			const Scalar th = PI * j / n, ph = TWO_PI * i / n;
+			const Scalar r = 1.0 + 0.05 * sin( 5.0 * ph ) * sin( 3.0 * th );
+			const Vector3 d( sin( th ) * cos( ph ), cos( th ), sin( th ) * sin( ph ) );
+			mesh.AddVertex( Point3( F( r*d.x ), F( r*d.y ), F( r*d.z ) ) );
+			mesh.AddColor( RISEPel( Scalar(i) / n, Scalar(j) / n, 0.5 ) );
+			if( !bFaceVarying ) {
+				mesh.AddNormal( d );
+				mesh.AddTexCoord( Point2( 4.0 * i / n, 4.0 * j / n ) );
+			}
+		}
+	}
+
+	unsigned int next = 0;
+	for( int j = 0; j < n; j++ ) {
+		for( int i = 0; i < n; i++ ) {
+			const unsigned int a = j*(n+1) + i, b = a + 1, c = a + (n+1), d = c + 1;
+			const unsigned int quads[2][3] = { { a, c, b }, { b, c, d } };
+			for( int q = 0; q < 2; q++ ) {
+				IndexedTriangle tri;
+				for( int k = 0; k < 3; k++ ) {
+					tri.iVertices[k] = quads[q][k];
+					if( bFaceVarying ) {
+						const Scalar tilt = 0.1 * k;
+						mesh.AddNormal( Vector3Ops::Normalize( Vector3( cos( tilt ), sin( tilt ), Scalar(q) - 0.5 ) ) );
+						mesh.AddTexCoord( Point2( 0.01 * ( i + k ), 0.01 * ( j + q ) ) );
+						tri.iNormals[k] = tri.iCoords[k] = next++;
+					} else {
+						tri.iNormals[k] = tri.iCoords[k] = quads[q][k];
+					}
+				}
+				mesh.AddIndexedTriangle( tri );
+			}
+		}
+	}
+	mesh.DoneIndexedTriangles();
+}
+
+struct Agreement
+{
+	int rays, hits, hitMismatch, shadowMismatch;
+	Scalar worstRange, worstNormal, worstCoord, worstColor;
+};
+
+static Agreement Compare( const TriangleMeshGeometryIndexed& a, const TriangleMeshGeometryIndexed& b, const int numRays )
+{
+	Agreement r = { numRays, 0, 0, 0, 0, 0, 0, 0 };
+	RandomNumberGenerator rng( 31 );
+	for( int i = 0; i < numRays; i++ ) {
+		const Scalar th = acos( 1.0 - 2.0 * rng.CanonicalRandom() ), ph = TWO_PI * rng.CanonicalRandom();
+		const Point3 o( 3.0*sin( th )*cos( ph ), 3.0*cos( th ), 3.0*sin( th )*sin( ph ) );
+		const Point3 aim( 1.2 * ( 2.0*rng.CanonicalRandom() - 1.0 ), 1.2 * ( 2.0*rng.CanonicalRandom() - 1.0 ), 1.2 * ( 2.0*rng.CanonicalRandom() - 1.0 ) );
+		const Ray ray( o, Vector3Ops::Normalize( Vector3Ops::mkVector3( aim, o ) ) );
+
+		RayIntersectionGeometric ra( ray, nullRasterizerState ), rb( ray, nullRasterizerState );
+		a.IntersectRay( ra, true, false, false );
+		b.IntersectRay( rb, true, false, false );
+		if( ra.bHit != rb.bHit ) {
+			r.hitMismatch++;
+			continue;
+		}
+		if( a.IntersectRay_IntersectionOnly( ray, 2.5, true, false ) != b.IntersectRay_IntersectionOnly( ray, 2.5, true, false ) ) {
+			r.shadowMismatch++;
+		}
+		if( !ra.bHit ) {
+			continue;
+		}
+		r.hits++;
+		r.worstRange = std::max( r.worstRange, fabs( ra.range - rb.range ) );
+		r.worstNormal = std::max( r.worstNormal, Vector3Ops::Magnitude( Vector3Ops::Normalize( ra.vNormal ) - Vector3Ops::Normalize( rb.vNormal ) ) );
+		r.worstCoord = std::max( r.worstCoord, std::max( fabs( ra.ptCoord.x - rb.ptCoord.x ), fabs( ra.ptCoord.y - rb.ptCoord.y ) ) );
+		if( ra.bHasVertexColor != rb.bHasVertexColor ) {
+			r.worstColor = 1.0;
+		} else if( ra.bHasVertexColor ) {
+			r.worstColor = std::max( r.worstColor, fabs( ra.vColor.r - rb.vColor.r ) + fabs( ra.vColor.g - rb.vColor.g ) + fabs( ra.vColor.b - rb.vColor.b ) );
+		}
+	}
+	return r;
+}
+
+static void CheckAgreement( const Agreement& r, const char* label, const Scalar coordTol )
+{
+	std::printf( "  %s: %d/%d rays hit, range %.2g, normal %.2g, uv %.2g, color %.2g\n",
+		label, r.hits, r.rays, r.worstRange, r.worstNormal, r.worstCoord, r.worstColor );
+	char what[256];
+	std::snprintf( what, sizeof( what ), "%s: every ray hits or misses both layouts", label );
+	Check( r.hitMismatch == 0 && r.hits > r.rays / 4, what );
+	std::snprintf( what, sizeof( what ), "%s: shadow rays agree", label );
+	Check( r.shadowMismatch == 0, what );
+	std::snprintf( what, sizeof( what ), "%s: hit ranges agree", label );
+	Check( r.worstRange < 1e-9, what );
+	std::snprintf( what, sizeof( what ), "%s: shading normals within the octahedral precision", label );
+	Check( r.worstNormal < 2e-4, what );
+	std::snprintf( what, sizeof( what ), "%s: UVs within the 16-bit quantization", label );
+	Check( r.worstCoord < coordTol, what );
+	std::snprintf( what, sizeof( what ), "%s: vertex colors agree", label );
+	Check( r.worstColor < 1e-9, what );
+}
+
+int main()
+{
+	std::printf( "TriangleMeshCompactTest -- the compact mesh layout matches the default one\n" );
+
+	// Shared indices, 16-bit
+	{
+		TriangleMeshGeometryIndexed* pDefault = new TriangleMeshGeometryIndexed( false, false );
+		TriangleMeshGeometryIndexed* pCompact = new TriangleMeshGeometryIndexed( false, false );
+		pCompact->SetCompactStorage( true );
+		BuildSphere( *pDefault, 64, false );
+		BuildSphere( *pCompact, 64, false );
+
+		Check( pCompact->IsCompactStorage() && !pDefault->IsCompactStorage(), "only the requested mesh is compact" );
+		Check( pCompact->numPoints() == pDefault->numPoints(), "shared-index corners keep one vertex each" );
+		Check( pCompact->getFaces().empty() && pCompact->getVertices().empty(), "the compact mesh drops the default lists" );
+		Check( fabs( pCompact->GetArea() - pDefault->GetArea() ) < 1e-9 * pDefault->GetArea(), "area is unchanged" );
+		const BoundingBox ba = pDefault->GenerateBoundingBox(), bb = pCompact->GenerateBoundingBox();
+		Check( Point3Ops::AreEqual( ba.ll, bb.ll, 1e-12 ) && Point3Ops::AreEqual( ba.ur, bb.ur, 1e-12 ), "bounds are unchanged" );
+
+		CheckAgreement( Compare( *pDefault, *pCompact, 20000 ), "16-bit", 4.0 / 65535 );
+
+		IndexTriangleListType tris;
+		VerticesListType verts;
+		NormalsListType norms;
+		TexCoordsListType coords;
+		Check( pCompact->TessellateToMesh( tris, verts, norms, coords, 0 ) && tris.size() == 2u*64*64, "tessellation emits every triangle" );
+
+		VerticesListType moved( pCompact->numPoints(), Point3( 0, 0, 0 ) );
+		NormalsListType movedN( pCompact->numNormals(), Vector3( 0, 0, 1 ) );
+		Check( pCompact->UpdateVertices( moved, movedN ) == 0, "a compact mesh refuses UpdateVertices" );
+
+		// A compact mesh writes a .risemesh either layout reads back
+		MemoryBuffer* pBuffer = new MemoryBuffer();
+		pCompact->Serialize( *pBuffer );
+		pBuffer->seek( IBuffer::START, 0 );
+		TriangleMeshGeometryIndexed* pRead = new TriangleMeshGeometryIndexed( false, false );
+		pRead->Deserialize( *pBuffer );
+		pBuffer->seek( IBuffer::START, 0 );
+		TriangleMeshGeometryIndexed* pReadCompact = new TriangleMeshGeometryIndexed( false, false );
+		pReadCompact->SetCompactStorage( true );
+		pReadCompact->Deserialize( *pBuffer );
+
+		Check( !pRead->IsCompactStorage() && pRead->getFaces().size() == 2u*64*64, "the default layout reads a compact mesh's file" );
+		Check( pReadCompact->IsCompactStorage() && pReadCompact->numPoints() == pCompact->numPoints(), "a compact mesh reads it back compactly" );
+		const Agreement rd = Compare( *pCompact, *pRead, 5000 );
+		Check( rd.hitMismatch == 0 && rd.worstRange < 1e-9 && rd.worstNormal < 1e-6 && rd.worstCoord < 1e-9, "the file holds the compact mesh's decoded attributes" );
+		const Agreement rc = Compare( *pCompact, *pReadCompact, 5000 );
+		Check( rc.hitMismatch == 0 && rc.worstRange < 1e-9 && rc.worstNormal < 1e-6 && rc.worstCoord < 1e-9, "re-compacting the file gives the same mesh" );
+
+		pBuffer->release();
+		pRead->release();
+		pReadCompact->release();
+		pDefault->release();
+		pCompact->release();
+	}
+
+	// Face-varying normals and coords
+	{
+		TriangleMeshGeometryIndexed* pDefault = new TriangleMeshGeometryIndexed( false, false );
+		TriangleMeshGeometryIndexed* pCompact = new TriangleMeshGeometryIndexed( false, false );
+		pCompact->SetCompactStorage( true );
+		BuildSphere( *pDefault, 32, true );
+		BuildSphere( *pCompact, 32, true );
+		Check( pCompact->numPoints() == 3u*2*32*32, "face-varying corners get a vertex each" );
+		CheckAgreement( Compare( *pDefault, *pCompact, 20000 ), "face-varying", 0.34 / 65535 );
+		pDefault->release();
+		pCompact->release();
+	}
+
+	// Over 65536 vertices, 32-bit
+	{
+		TriangleMeshGeometryIndexed* pDefault = new TriangleMeshGeometryIndexed( false, false );
+		TriangleMeshGeometryIndexed* pCompact = new TriangleMeshGeometryIndexed( false, false );
+		pCompact->SetCompactStorage( true );
+		BuildSphere( *pDefault, 300, false );
+		BuildSphere( *pCompact, 300, false );
+		Check( pCompact->numPoints() > 65536, "the large mesh needs 32-bit indices" );
+		CheckAgreement( Compare( *pDefault, *pCompact, 20000 ), "32-bit", 4.0 / 65535 );
+		pDefault->release();
+		pCompact->release();
+	}
+
+	std::printf( "%d passed, %d failed.\n", g_pass, g_fail );
+	return g_fail ? 1 : 0;
+}
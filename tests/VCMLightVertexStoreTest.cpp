@@ -23,6 +23,8 @@
 //      6. Concat path: per-thread buffer moves into the store
 //      7. Stress test: 10k random vertices, 100 random queries vs
 //         brute force
+//      8. PackedLightVertex round trip: position, directions,
+//         throughput and MIS partials within float/octahedral error
 //
 //  Author: Aravind Krishnaswamy
 //  Tabs: 4
@@ -68,7 +70,9 @@ static std::set<std::size_t> BruteForceQueryIndices(
 {
 	std::set<std::size_t> indices;
 	for( std::size_t i = 0; i < all.size(); i++ ) {
-		const Vector3 d = Vector3Ops::mkVector3( center, all[i].ptPosition );
+		// Compare against the position as the store holds it
+		const Point3 stored = PackedPoint3( all[i].ptPosition );
+		const Vector3 d = Vector3Ops::mkVector3( center, stored );
 		const Scalar distSq = Vector3Ops::SquaredModulus( d );
 		if( distSq < radiusSq ) {
 			indices.insert( i );
@@ -97,7 +101,7 @@ static LightVertex MakeVertex( Scalar x, Scalar y, Scalar z, unsigned short id )
 // BuildKDTree permutes the internal array, the ids are the stable
 // identity we compare against brute force.
 //
-static std::set<unsigned short> IdsFromQueryResult( const std::vector<LightVertex>& result )
+static std::set<unsigned short> IdsFromQueryResult( const std::vector<PackedLightVertex>& result )
 {
 	std::set<unsigned short> ids;
 	for( std::size_t i = 0; i < result.size(); i++ ) {
@@ -139,7 +143,7 @@ static void TestEmptyStore()
 	Check( store.IsBuilt(), "empty: built after BuildKDTree" );
 	Check( store.Size() == 0, "empty: size still 0" );
 
-	std::vector<LightVertex> out;
+	std::vector<PackedLightVertex> out;
 	store.Query( Point3( 0, 0, 0 ), 1.0, out );
 	Check( out.empty(), "empty: query returns nothing" );
 
@@ -160,7 +164,7 @@ static void TestSingleVertex()
 
 	// Inside radius
 	{
-		std::vector<LightVertex> out;
+		std::vector<PackedLightVertex> out;
 		store.Query( Point3( 1, 2, 3 ), 0.01, out );
 		Check( out.size() == 1, "single: self-query hit" );
 		Check( out.size() == 1 && out[0].pathLength == 42, "single: returned vertex is the right one" );
@@ -168,7 +172,7 @@ static void TestSingleVertex()
 
 	// Outside radius
 	{
-		std::vector<LightVertex> out;
+		std::vector<PackedLightVertex> out;
 		store.Query( Point3( 10, 10, 10 ), 1.0, out );
 		Check( out.empty(), "single: far query misses" );
 	}
@@ -176,7 +180,7 @@ static void TestSingleVertex()
 	// Radius exactly touches the point (the store uses "<", not "<=",
 	// so a point at exactly radius is NOT in the result)
 	{
-		std::vector<LightVertex> out;
+		std::vector<PackedLightVertex> out;
 		const Vector3 delta = Vector3Ops::mkVector3( Point3( 1, 2, 3 ), Point3( 4, 2, 3 ) );
 		const Scalar rSq = Vector3Ops::SquaredModulus( delta );
 		store.Query( Point3( 4, 2, 3 ), rSq, out );
@@ -229,7 +233,7 @@ static void TestGridVsBruteForce()
 
 	// Compare every query result against the pre-built expected set.
 	for( std::size_t c = 0; c < sizeof( cases ) / sizeof( cases[0] ); c++ ) {
-		std::vector<LightVertex> out;
+		std::vector<PackedLightVertex> out;
 		store.Query( cases[c].center, cases[c].radiusSq, out );
 		const std::set<unsigned short> got = IdsFromQueryResult( out );
 		if( got == expected[c] ) {
@@ -254,7 +258,7 @@ static void TestZeroRadius()
 	store.Append( MakeVertex( 1, 0, 0, 1 ) );
 	store.BuildKDTree();
 
-	std::vector<LightVertex> out;
+	std::vector<PackedLightVertex> out;
 	store.Query( Point3( 0, 0, 0 ), 0.0, out );
 	Check( out.empty(), "r=0: nothing returned" );
 }
@@ -296,24 +300,24 @@ static void TestConcat()
 	LightVertexStore store;
 
 	// Thread 1 buffer
-	std::vector<LightVertex> buf1;
-	buf1.push_back( MakeVertex( 0, 0, 0, 10 ) );
-	buf1.push_back( MakeVertex( 1, 0, 0, 11 ) );
+	std::vector<PackedLightVertex> buf1;
+	buf1.push_back( PackedLightVertex( MakeVertex( 0, 0, 0, 10 ) ) );
+	buf1.push_back( PackedLightVertex( MakeVertex( 1, 0, 0, 11 ) ) );
 	store.Concat( std::move( buf1 ) );
 	Check( store.Size() == 2, "concat 1: size 2" );
 
 	// Thread 2 buffer concatenated onto existing data
-	std::vector<LightVertex> buf2;
-	buf2.push_back( MakeVertex( 2, 0, 0, 20 ) );
-	buf2.push_back( MakeVertex( 3, 0, 0, 21 ) );
-	buf2.push_back( MakeVertex( 4, 0, 0, 22 ) );
+	std::vector<PackedLightVertex> buf2;
+	buf2.push_back( PackedLightVertex( MakeVertex( 2, 0, 0, 20 ) ) );
+	buf2.push_back( PackedLightVertex( MakeVertex( 3, 0, 0, 21 ) ) );
+	buf2.push_back( PackedLightVertex( MakeVertex( 4, 0, 0, 22 ) ) );
 	store.Concat( std::move( buf2 ) );
 	Check( store.Size() == 5, "concat 2: size 5" );
 
 	store.BuildKDTree();
 
 	// Query should see all five.
-	std::vector<LightVertex> out;
+	std::vector<PackedLightVertex> out;
 	store.Query( Point3( 2, 0, 0 ), 100.0, out );
 	Check( out.size() == 5, "concat: query recovers all 5 vertices" );
 
@@ -374,7 +378,7 @@ static void TestStressRandom()
 	int mismatches = 0;
 	std::size_t totalHits = 0;
 	for( std::size_t q = 0; q < queries.size(); q++ ) {
-		std::vector<LightVertex> out;
+		std::vector<PackedLightVertex> out;
 		store.Query( queries[q].center, queries[q].radiusSq, out );
 		totalHits += out.size();
 		const std::set<unsigned short> got = IdsFromQueryResult( out );
@@ -393,6 +397,64 @@ static void TestStressRandom()
 //////////////////////////////////////////////////////////////////////
 // Main
 //////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////
+// Test 8: PackedLightVertex round trip
+//////////////////////////////////////////////////////////////////////
+static void TestPackedRoundTrip()
+{
+	printf( "Test 8: PackedLightVertex round trip\n" );
+
+	Check( sizeof( PackedLightVertex ) * 3 <= sizeof( LightVertex ), "packed: at most a third of LightVertex" );
+
+	srand( 7 );
+	Scalar worstDot = 1;
+	bool poles = true;
+	for( int i = 0; i < 20000; i++ ) {
+		Vector3 d(
+			Scalar( rand() ) / RAND_MAX * 2 - 1,
+			Scalar( rand() ) / RAND_MAX * 2 - 1,
+			Scalar( rand() ) / RAND_MAX * 2 - 1 );
+		if( Vector3Ops::SquaredModulus( d ) < 1e-6 ) {
+			continue;
+		}
+		d = Vector3Ops::Normalize( d );
+		worstDot = std::min( worstDot, Vector3Ops::Dot( d, DecodeOctahedral( EncodeOctahedral( d ) ) ) );
+	}
+	const Vector3 axes[6] = { Vector3( 1, 0, 0 ), Vector3( -1, 0, 0 ), Vector3( 0, 1, 0 ),
+		Vector3( 0, -1, 0 ), Vector3( 0, 0, 1 ), Vector3( 0, 0, -1 ) };
+	for( int i = 0; i < 6; i++ ) {
+		if( Vector3Ops::Dot( axes[i], DecodeOctahedral( EncodeOctahedral( axes[i] ) ) ) < 1 - 1e-9 ) {
+			poles = false;
+		}
+	}
+	Check( std::acos( std::min( worstDot, Scalar( 1 ) ) ) < 2e-4, "octahedral: worst angular error under 2e-4 rad" );
+	Check( poles, "octahedral: axes exact" );
+	const Vector3 zero = DecodeOctahedral( EncodeOctahedral( Vector3( 0, 0, 0 ) ) );
+	Check( zero.x == 0 && zero.y == 0 && zero.z == 0, "octahedral: zero vector preserved" );
+
+	LightVertex v = MakeVertex( 123.456789, -0.001234, 98765.4321, 42 );
+	v.plane = 1;
+	v.flags = kLVF_IsConnectible;
+	v.wi = Vector3Ops::Normalize( Vector3( 0.3, -0.4, -0.85 ) );
+	v.throughput = RISEPel( 0.25, 1.5e-3, 7.0 );
+	v.mis.dVCM = 3.5;
+	v.mis.dVC = 1e-4;
+	v.mis.dVM = 12.0;
+
+	const PackedLightVertex p( v );
+	const Point3 pos = p.ptPosition;
+	Check( std::fabs( pos.x - v.ptPosition.x ) <= 1e-7 * std::fabs( v.ptPosition.x ) &&
+		std::fabs( pos.z - v.ptPosition.z ) <= 1e-7 * std::fabs( v.ptPosition.z ), "packed: position to float precision" );
+	Check( p.plane == 1 && p.flags == kLVF_IsConnectible && p.pathLength == 42, "packed: metadata exact" );
+	Check( Vector3Ops::Dot( p.Wi(), v.wi ) > 1 - 1e-7, "packed: wi" );
+	Check( Vector3Ops::Dot( p.Normal(), v.normal ) > 1 - 1e-7, "packed: normal" );
+	const RISEPel t = p.Throughput();
+	Check( std::fabs( t[0] - 0.25 ) < 1e-7 && std::fabs( t[1] - 1.5e-3 ) < 1e-9 && std::fabs( t[2] - 7.0 ) < 1e-6,
+		"packed: throughput" );
+	Check( std::fabs( p.Mis().dVCM - 3.5 ) < 1e-6 && std::fabs( p.Mis().dVC - 1e-4 ) < 1e-10 &&
+		std::fabs( p.Mis().dVM - 12.0 ) < 1e-6, "packed: MIS partials" );
+}
+
 int main()
 {
 	printf( "=== VCMLightVertexStore Unit Test ===\n" );
@@ -404,6 +466,7 @@ int main()
 	TestBuildStateTracking();
 	TestConcat();
 	TestStressRandom();
+	TestPackedRoundTrip();
 
 	printf( "\nPassed: %d\nFailed: %d\n", g_pass, g_fail );
 	if( g_fail > 0 ) {
@@ -0,0 +1,171 @@
+//////////////////////////////////////////////////////////////////////
+//
+//  QuarticSolverBenchmark.cpp - Performance micro-benchmark for the
+//  interval quartic solver against SolveQuartic, on the quartics the
+//  torus kernel forms.  This is an informational benchmark, not an
+//  assertion-style correctness test (see QuarticIntervalSolverTest).
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <cmath>
+#include <chrono>
+#include <algorithm>
+
+#include "../src/Library/Utilities/Math3D/Math3D.h"
+#include "../src/Library/Utilities/Ray.h"
+#include "../src/Library/Utilities/RandomNumbers.h"
+#include "../src/Library/Functions/Polynomial.h"
+#include "../src/Library/Intersection/RayPrimitiveIntersections.h"
+
+using namespace RISE;
+
+static const Scalar R = 1.0;
+static const Scalar r = 0.3;
+
+// The torus quartic along o + t*d, as RayTorusIntersection forms it
+static void TorusQuartic( const Point3& o, const Vector3& d, Scalar (&C)[5] )
+{
+	const Scalar a0 = 4.0*R*R, b0 = R*R - r*r;
+	const Scalar f = 1.0 - d.y*d.y;
+	const Scalar l = 2.0 * (o.x*d.x + o.z*d.z);
+	const Scalar t = o.x*o.x + o.z*o.z;
+	const Scalar m = l + 2.0*d.y*o.y;
+	const Scalar u = t + o.y*o.y + b0;
+	C[0] = 1.0;
+	C[1] = 2.0 * m;
+	C[2] = m*m + 2.0*u - a0*f;
+	C[3] = 2.0*m*u - a0*l;
+	C[4] = u*u - a0*t;
+}
+
+static Scalar Residual( const Point3& p )
+{
+	const Scalar a = p.x*p.x + p.y*p.y + p.z*p.z + R*R - r*r;
+	const Scalar F = a*a - 4.0*R*R*( p.x*p.x + p.z*p.z );
+	return std::fabs( F ) / ( a*a + 4.0*R*R*( p.x*p.x + p.z*p.z ) + r*r*r*r );
+}
+
+template< class F >
+static double MedianNsPerCall( F fn, const int numCalls )
+{
+	std::vector<double> timings;
+	for( int iter = 0; iter < 7; iter++ ) {
+		auto start = std::chrono::high_resolution_clock::now();
+		fn();
+		auto end = std::chrono::high_resolution_clock::now();
+		timings.push_back( std::chrono::duration<double, std::nano>( end - start ).count() / numCalls );
+	}
+	std::sort( timings.begin(), timings.end() );
+	return timings[timings.size() / 2];
+}
+
+int main()
+{
+	std::cout << "Quartic Solver Benchmark" << std::endl;
+	std::cout << "========================" << std::endl;
+
+	const int numRays = 200000;
+	const Scalar distances[3] = { 3.0, 50.0, 5000.0 };
+
+	for( int di = 0; di < 3; di++ ) {
+		// Rays from a sphere of the given distance aimed into the torus's
+		// box, most of which hit it
+		RandomNumberGenerator rng( 17 );
+		std::vector<Ray> rays;
+		for( int i = 0; i < numRays; i++ ) {
+			const Scalar th = std::acos( 1.0 - 2.0 * rng.CanonicalRandom() ), ph = TWO_PI * rng.CanonicalRandom();
+			const Scalar D = distances[di];
+			const Point3 o( D*std::sin( th )*std::cos( ph ), D*std::cos( th ), D*std::sin( th )*std::sin( ph ) );
+			const Point3 aim( ( R + r ) * ( 2.0*rng.CanonicalRandom() - 1.0 ), r * ( 2.0*rng.CanonicalRandom() - 1.0 ), ( R + r ) * ( 2.0*rng.CanonicalRandom() - 1.0 ) );
+			rays.push_back( Ray( o, Vector3Ops::Normalize( Vector3Ops::mkVector3( aim, o ) ) ) );
+		}
+
+		// The same quartics, in t from the origin as the kernel used to
+		// solve them and shifted to the closest approach with the window
+		// the kernel now gives the interval solver
+		std::vector<Scalar> coeffT( numRays * 5 ), coeffS( numRays * 5 ), shift( numRays ), lo( numRays ), hi( numRays );
+		for( int i = 0; i < numRays; i++ ) {
+			const Vector3 d = rays[i].Dir();
+			const Scalar ts = -( rays[i].origin.x*d.x + rays[i].origin.y*d.y + rays[i].origin.z*d.z );
+			const Point3 c = rays[i].PointAtLength( ts );
+			Scalar C[5];
+			TorusQuartic( rays[i].origin, d, C );
+			for( int k = 0; k < 5; k++ ) coeffT[i*5+k] = C[k];
+			TorusQuartic( c, d, C );
+			for( int k = 0; k < 5; k++ ) coeffS[i*5+k] = C[k];
+			const Scalar h = std::sqrt( std::max( ( R + r )*( R + r ) - ( c.x*c.x + c.y*c.y + c.z*c.z ), Scalar( 0 ) ) );
+			shift[i] = ts;
+			lo[i] = -h;
+			hi[i] = h;
+		}
+
+		int rootsOld = 0, rootsShifted = 0, rootsNew = 0;
+		double worstOld = 0, worstShifted = 0, worstNew = 0;
+		const double nsOld = MedianNsPerCall( [&]() {
+			rootsOld = 0;
+			for( int i = 0; i < numRays; i++ ) {
+				const Scalar (&C)[5] = *reinterpret_cast<const Scalar(*)[5]>( &coeffT[i*5] );
+				Scalar s[4];
+				rootsOld += Polynomial::SolveQuartic( C, s );
+			}
+		}, numRays );
+		const double nsShifted = MedianNsPerCall( [&]() {
+			rootsShifted = 0;
+			for( int i = 0; i < numRays; i++ ) {
+				const Scalar (&C)[5] = *reinterpret_cast<const Scalar(*)[5]>( &coeffS[i*5] );
+				Scalar s[4];
+				rootsShifted += Polynomial::SolveQuartic( C, s );
+			}
+		}, numRays );
+		const double nsNew = MedianNsPerCall( [&]() {
+			rootsNew = 0;
+			for( int i = 0; i < numRays; i++ ) {
+				const Scalar (&C)[5] = *reinterpret_cast<const Scalar(*)[5]>( &coeffS[i*5] );
+				Scalar s[4];
+				const int n = Polynomial::SolveQuarticWithinInterval( C, s, lo[i], hi[i] );
+				rootsNew += n > 0 ? n : 0;
+			}
+		}, numRays );
+
+		// How far off the surface each solver's roots land
+		for( int i = 0; i < numRays; i++ ) {
+			const Scalar (&CT)[5] = *reinterpret_cast<const Scalar(*)[5]>( &coeffT[i*5] );
+			const Scalar (&CS)[5] = *reinterpret_cast<const Scalar(*)[5]>( &coeffS[i*5] );
+			Scalar s[4];
+			const int no = Polynomial::SolveQuartic( CT, s );
+			for( int k = 0; k < no; k++ ) worstOld = std::max( worstOld, double( Residual( rays[i].PointAtLength( s[k] ) ) ) );
+			const int ns = Polynomial::SolveQuartic( CS, s );
+			for( int k = 0; k < ns; k++ ) worstShifted = std::max( worstShifted, double( Residual( rays[i].PointAtLength( s[k] + shift[i] ) ) ) );
+			const int nn = Polynomial::SolveQuarticWithinInterval( CS, s, lo[i], hi[i] );
+			for( int k = 0; k < nn; k++ ) worstNew = std::max( worstNew, double( Residual( rays[i].PointAtLength( s[k] + shift[i] ) ) ) );
+		}
+
+		int hits = 0;
+		const double nsKernel = MedianNsPerCall( [&]() {
+			hits = 0;
+			for( int i = 0; i < numRays; i++ ) {
+				HIT h;
+				RayTorusIntersection( rays[i], h, R, r, R*R );
+				if( h.bHit ) hits++;
+			}
+		}, numRays );
+
+		std::cout << std::endl << "Rays from distance " << distances[di] << ":" << std::endl;
+		std::cout << "  SolveQuartic:               " << nsOld << " ns/call, " << rootsOld << " roots, worst residual " << worstOld << std::endl;
+		std::cout << "  SolveQuartic, shifted:      " << nsShifted << " ns/call, " << rootsShifted << " roots, worst residual " << worstShifted << std::endl;
+		std::cout << "  SolveQuarticWithinInterval: " << nsNew << " ns/call, " << rootsNew << " roots, worst residual " << worstNew << std::endl;
+		std::cout << "  RayTorusIntersection:       " << nsKernel << " ns/ray, " << hits << " hits" << std::endl;
+
+		// Keep a basic sanity check so benchmark runs still catch obvious breakage
+		assert( hits > numRays / 2 );
+	}
+
+	std::cout << std::endl;
+	std::cout << "Quartic solver benchmark complete." << std::endl;
+	std::cout << "Use the median ns/call for before/after comparison." << std::endl;
+
+	return 0;
+}
@@ -0,0 +1,523 @@
+#!/usr/bin/env python3
+"""A/B performance comparison of two RISE binaries over a scene matrix.
+
+Automates the protocol in docs/skills/performance-work-with-baselines.md and
+docs/L8_INTERACTIVE_PERF_REPORT.md: per scene, discarded warm-up renders, then
+K interleaved trials (A B, B A, A B, ...) so thermal and cache drift lands on
+both arms equally.  The metric is the rasterizer-internal time from the
+`RISE_PERF {...}` log line (scene load and output encode excluded).  Each arm
+keeps the images from its first two trials; the A-vs-B image RMSE is reported
+against the B-vs-B Monte-Carlo noise floor, so a ratio near 1.0 means the
+change did not alter the rendering beyond sampling noise.
+
+No third-party Python dependencies: PNG decoding and the Student-t CDF are
+implemented here.  Writes results.json and REPORT.md into the output folder.
+
+    tools/perf_ab.py --baseline /tmp/rise-base --candidate bin/rise -k 5
+"""
+
+from __future__ import annotations
+
+import argparse
+import glob
+import json
+import math
+import os
+import re
+import shutil
+import struct
+import subprocess
+import sys
+import tempfile
+import zlib
+from datetime import datetime, timezone
+from pathlib import Path
+
+
+PNG_SIGNATURE = b"\x89PNG\r\n\x1a\n"
+DEFAULT_SCENES = "scenes/Tests/Bench/*.RISEscene"
+PERF_LINE = re.compile(r"RISE_PERF (\{.*?\})")
+HUMAN_LINE = re.compile(r"Total Rasterization Time:((?: \d+ (?:days|hours|minutes|seconds|ms))*)")
+HUMAN_UNITS_MS = {"days": 86400000, "hours": 3600000, "minutes": 60000, "seconds": 1000, "ms": 1}
+BENCH_OPTIONS = "render_thread_reserve_count 0\nforce_all_threads_low_priority false\n"
+IMAGE_SUFFIXES = (".png",)
+
+
+# ---------------------------------------------------------------- timing log
+
+def parse_render_ms(text):
+    """Sum of every rasterize interval in a log; None if there is none.
+
+    Prefers the machine-readable RISE_PERF line; falls back to the
+    human-readable 'Total Rasterization Time' line so binaries built before
+    RISE_PERF existed can still serve as the baseline arm.
+    """
+    total = None
+    for match in PERF_LINE.finditer(text):
+        record = json.loads(match.group(1))
+        if str(record.get("phase", "")).startswith("rasterize"):
+            total = (total or 0) + int(record["ms"])
+    if total is not None:
+        return total
+    for match in HUMAN_LINE.finditer(text):
+        ms = 0
+        for amount, unit in re.findall(r"(\d+) (days|hours|minutes|seconds|ms)", match.group(1)):
+            ms += int(amount) * HUMAN_UNITS_MS[unit]
+        total = (total or 0) + ms
+    return total
+
+
+# ---------------------------------------------------------------- statistics
+
+def mean(values):
+    return sum(values) / len(values)
+
+
+def stddev(values):
+    """Sample standard deviation (Bessel-corrected)."""
+    if len(values) < 2:
+        return 0.0
+    m = mean(values)
+    return math.sqrt(sum((v - m) ** 2 for v in values) / (len(values) - 1))
+
+
+def _betacf(a, b, x):
+    # Continued fraction for the incomplete beta function (modified Lentz)
+    tiny = 1e-300
+    qab, qap, qam = a + b, a + 1.0, a - 1.0
+    c, d = 1.0, 1.0 - qab * x / qap
+    d = 1.0 / (d if abs(d) > tiny else tiny)
+    h = d
+    for m in range(1, 300):
+        m2 = 2 * m
+        aa = m * (b - m) * x / ((qam + m2) * (a + m2))
+        d = 1.0 + aa * d
+        d = 1.0 / (d if abs(d) > tiny else tiny)
+        c = 1.0 + aa / c
+        c = c if abs(c) > tiny else tiny
+        h *= d * c
+        aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2))
+        d = 1.0 + aa * d
+        d = 1.0 / (d if abs(d) > tiny else tiny)
+        c = 1.0 + aa / c
+        c = c if abs(c) > tiny else tiny
+        delta = d * c
+        h *= delta
+        if abs(delta - 1.0) < 1e-12:
+            break
+    return h
+
+
+def incomplete_beta(a, b, x):
+    """Regularized incomplete beta I_x(a, b)."""
+    if x <= 0.0:
+        return 0.0
+    if x >= 1.0:
+        return 1.0
+    front = math.exp(math.lgamma(a + b) - math.lgamma(a) - math.lgamma(b) +
+                     a * math.log(x) + b * math.log(1.0 - x))
+    if x < (a + 1.0) / (a + b + 2.0):
+        return front * _betacf(a, b, x) / a
+    return 1.0 - front * _betacf(b, a, 1.0 - x) / b
+
+
+def welch(a, b):
+    """Welch's unequal-variance t-test.  Returns (t, dof, two-sided p)."""
+    if len(a) < 2 or len(b) < 2:
+        return None, None, None
+    va, vb = stddev(a) ** 2 / len(a), stddev(b) ** 2 / len(b)
+    if va + vb == 0.0:
+        same = mean(a) == mean(b)
+        return 0.0 if same else math.copysign(math.inf, mean(b) - mean(a)), None, 1.0 if same else 0.0
+    t = (mean(b) - mean(a)) / math.sqrt(va + vb)
+    dof = (va + vb) ** 2 / ((va ** 2 / (len(a) - 1) if va else 0.0) +
+                            (vb ** 2 / (len(b) - 1) if vb else 0.0))
+    p = incomplete_beta(dof / 2.0, 0.5, dof / (dof + t * t))
+    return t, dof, p
+
+
+def compare_timings(base_ms, cand_ms, alpha):
+    t, dof, p = welch(base_ms, cand_ms)
+    base_mean, cand_mean = mean(base_ms), mean(cand_ms)
+    if min(cand_ms) > max(base_ms):
+        overlap = "candidate slower in every trial"
+    elif max(cand_ms) < min(base_ms):
+        overlap = "candidate faster in every trial"
+    else:
+        overlap = "overlapping"
+    significant = p is not None and p < alpha
+    if not significant:
+        verdict = "no significant change"
+    else:
+        verdict = "regression" if cand_mean > base_mean else "improvement"
+    return {
+        "baselineMeanMs": base_mean, "baselineStddevMs": stddev(base_ms),
+        "candidateMeanMs": cand_mean, "candidateStddevMs": stddev(cand_ms),
+        "deltaPercent": 100.0 * (cand_mean - base_mean) / base_mean if base_mean else None,
+        "welchT": t, "welchDof": dof, "pValue": p,
+        "trialOverlap": overlap, "verdict": verdict,
+    }
+
+
+# ---------------------------------------------------------------- images
+
+def _paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def decode_png(data):
+    """(width, height, channels, samples) for 8/16-bit non-interlaced gray/RGB(A) PNGs."""
+    if data[:8] != PNG_SIGNATURE:
+        raise ValueError("not a PNG file")
+    pos, idat, header = 8, [], None
+    while pos + 8 <= len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        payload = data[pos + 8:pos + 8 + length]
+        if len(payload) != length:
+            raise ValueError("truncated PNG chunk")
+        if kind == b"IHDR":
+            header = struct.unpack(">IIBBBBB", payload)
+        elif kind == b"IDAT":
+            idat.append(payload)
+        elif kind == b"IEND":
+            break
+        pos += 12 + length
+    if header is None or not idat:
+        raise ValueError("PNG is missing IHDR or IDAT")
+    width, height, depth, color, _, _, interlace = header
+    channels = {0: 1, 2: 3, 4: 2, 6: 4}.get(color)
+    if channels is None or depth not in (8, 16) or interlace:
+        raise ValueError(f"unsupported PNG (color type {color}, depth {depth}, interlace {interlace})")
+    bpp = channels * depth // 8
+    stride = width * bpp
+    raw = zlib.decompress(b"".join(idat))
+    if len(raw) != height * (stride + 1):
+        raise ValueError("PNG image data has the wrong size")
+    out = bytearray(height * stride)
+    prev = bytearray(stride)
+    for y in range(height):
+        kind = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        if kind == 1:
+            for i in range(bpp, stride):
+                line[i] = (line[i] + line[i - bpp]) & 0xff
+        elif kind == 2:
+            for i in range(stride):
+                line[i] = (line[i] + prev[i]) & 0xff
+        elif kind == 3:
+            for i in range(stride):
+                left = line[i - bpp] if i >= bpp else 0
+                line[i] = (line[i] + ((left + prev[i]) >> 1)) & 0xff
+        elif kind == 4:
+            for i in range(stride):
+                left = line[i - bpp] if i >= bpp else 0
+                upleft = prev[i - bpp] if i >= bpp else 0
+                line[i] = (line[i] + _paeth(left, prev[i], upleft)) & 0xff
+        elif kind != 0:
+            raise ValueError(f"bad PNG filter type {kind}")
+        out[y * stride:(y + 1) * stride] = line
+        prev = line
+    if depth == 16:
+        samples = struct.unpack(f">{len(out) // 2}H", bytes(out))
+        samples = [s / 257.0 for s in samples]
+    else:
+        samples = out
+    return width, height, channels, samples
+
+
+def image_rmse(path_a, path_b):
+    """RMSE in 8-bit units over all channels; None if the images differ in shape."""
+    wa, ha, ca, a = decode_png(Path(path_a).read_bytes())
+    wb, hb, cb, b = decode_png(Path(path_b).read_bytes())
+    if (wa, ha, ca) != (wb, hb, cb):
+        return None
+    if a == b:
+        return 0.0
+    return math.sqrt(sum((x - y) * (x - y) for x, y in zip(a, b)) / len(a))
+
+
+def compare_images(base_images, cand_images):
+    """Cross-binary RMSE against the candidate-vs-candidate noise floor."""
+    if len(base_images) < 1 or len(cand_images) < 2:
+        return {"status": "not enough images"}
+    rows = []
+    for name in sorted(set(cand_images[0]) & set(cand_images[1]) & set(base_images[0])):
+        try:
+            floor = image_rmse(cand_images[0][name], cand_images[1][name])
+            cross = image_rmse(base_images[0][name], cand_images[0][name])
+        except ValueError as exc:
+            rows.append({"image": name, "status": str(exc)})
+            continue
+        if floor is None or cross is None:
+            rows.append({"image": name, "status": "dimension mismatch"})
+            continue
+        if floor == 0.0:
+            status = "bit-identical" if cross == 0.0 else "DIFFERS (deterministic scene)"
+            ratio = None
+        else:
+            ratio = cross / floor
+            status = "within MC noise" if ratio <= 1.1 else "EXCEEDS MC noise"
+        rows.append({"image": name, "noiseFloorRmse": floor, "crossRmse": cross,
+                     "ratio": ratio, "status": status})
+    return {"status": "ok" if rows else "no comparable images", "images": rows}
+
+
+# ---------------------------------------------------------------- running
+
+def output_dirs(scene_path):
+    """Directories named by file_rasterizeroutput patterns; RISE does not create them."""
+    dirs = set()
+    for match in re.finditer(r"^\s*pattern\s+(\S+)", scene_path.read_text(errors="replace"), re.M):
+        parent = os.path.dirname(match.group(1))
+        if parent:
+            dirs.add(parent)
+    return sorted(dirs)
+
+
+def render_once(binary, scene, repo_root, options_file, work_dir, timeout):
+    """Render one scene in a scratch directory; returns (ms, {image name: path})."""
+    if work_dir.exists():
+        shutil.rmtree(work_dir)
+    work_dir.mkdir(parents=True)
+    for d in output_dirs(scene):
+        (work_dir / d).mkdir(parents=True, exist_ok=True)
+    env = dict(os.environ)
+    env["RISE_MEDIA_PATH"] = str(repo_root) + os.sep
+    env["RISE_OPTIONS_FILE"] = str(options_file)
+    proc = subprocess.run([str(binary), str(scene)], cwd=work_dir, input="render\nquit\n",
+                          stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True,
+                          errors="replace", timeout=timeout, check=False)
+    log_text = proc.stdout
+    for log in ("RISE_Log.txt", "RISELog.txt"):
+        if (work_dir / log).is_file():
+            log_text += (work_dir / log).read_text(errors="replace")
+    # The interactive console exits non-zero even after a clean `quit`, so
+    # the timing line is what tells a finished render from a failed one
+    ms = parse_render_ms(log_text)
+    if ms is None:
+        tail = "\n".join(proc.stdout.splitlines()[-15:])
+        raise RuntimeError(f"{binary} produced no render timing for {scene} "
+                           f"(exit {proc.returncode}):\n{tail}")
+    images = {}
+    for path in sorted(work_dir.rglob("*")):
+        if path.suffix.lower() in IMAGE_SUFFIXES:
+            images[str(path.relative_to(work_dir))] = path
+    return ms, images
+
+
+def trial_order(k):
+    """Arm order per trial: A B, B A, A B, ... so neither arm always runs first."""
+    return [("baseline", "candidate") if i % 2 == 0 else ("candidate", "baseline") for i in range(k)]
+
+
+def run(args):
+    repo_root = Path(args.repo_root).resolve()
+    binaries = {"baseline": Path(args.baseline).resolve(), "candidate": Path(args.candidate).resolve()}
+    for arm, binary in binaries.items():
+        if not binary.is_file():
+            raise ValueError(f"{arm} binary not found: {binary}")
+    patterns = args.scenes or [DEFAULT_SCENES]
+    scenes = []
+    for pattern in patterns:
+        matches = sorted(glob.glob(str(repo_root / pattern))) or sorted(glob.glob(pattern))
+        if not matches:
+            raise ValueError(f"no scene matches {pattern}")
+        scenes.extend(Path(m).resolve() for m in matches)
+
+    stamp = datetime.now(timezone.utc).strftime("%Y%m%dT%H%M%SZ")
+    out_dir = Path(args.output_dir) if args.output_dir else Path(tempfile.gettempdir()) / f"rise_perf_ab_{stamp}"
+    out_dir.mkdir(parents=True, exist_ok=True)
+    options_file = out_dir / "bench.options"
+    options_file.write_text(BENCH_OPTIONS, encoding="utf-8")
+
+    results = {
+        "generated": stamp,
+        "baseline": str(binaries["baseline"]), "candidate": str(binaries["candidate"]),
+        "trials": args.trials, "warmup": args.warmup, "alpha": args.alpha,
+        "scenes": [],
+    }
+    for scene in scenes:
+        name = scene.stem
+        print(f"[{name}]", flush=True)
+        for w in range(args.warmup):
+            for arm in ("baseline", "candidate"):
+                render_once(binaries[arm], scene, repo_root, options_file,
+                            out_dir / name / f"warmup_{arm}", args.timeout)
+        timings = {"baseline": [], "candidate": []}
+        images = {"baseline": [], "candidate": []}
+        for trial, order in enumerate(trial_order(args.trials)):
+            for arm in order:
+                work_dir = out_dir / name / f"{arm}_{trial}"
+                ms, trial_images = render_once(binaries[arm], scene, repo_root, options_file,
+                                               work_dir, args.timeout)
+                timings[arm].append(ms)
+                if len(images[arm]) < 2:
+                    images[arm].append(trial_images)
+                elif not args.keep_renders:
+                    shutil.rmtree(work_dir)
+                print(f"  trial {trial + 1} {arm:9s} {ms:8d} ms", flush=True)
+        entry = {"scene": str(scene.relative_to(repo_root)) if scene.is_relative_to(repo_root) else str(scene),
+                 "baselineMs": timings["baseline"], "candidateMs": timings["candidate"]}
+        entry.update(compare_timings(timings["baseline"], timings["candidate"], args.alpha))
+        entry["images"] = compare_images(images["baseline"], images["candidate"])
+        results["scenes"].append(entry)
+        if not args.keep_renders:
+            for d in (out_dir / name).glob("warmup_*"):
+                shutil.rmtree(d)
+
+    base_sum = sum(s["baselineMeanMs"] for s in results["scenes"])
+    cand_sum = sum(s["candidateMeanMs"] for s in results["scenes"])
+    results["aggregate"] = {"baselineSumOfMeansMs": base_sum, "candidateSumOfMeansMs": cand_sum,
+                            "deltaPercent": 100.0 * (cand_sum - base_sum) / base_sum if base_sum else None}
+    (out_dir / "results.json").write_text(json.dumps(results, indent=2) + "\n", encoding="utf-8")
+    report = report_markdown(results)
+    (out_dir / "REPORT.md").write_text(report, encoding="utf-8")
+    print("\n" + report, flush=True)
+    print(f"perf_ab: wrote {out_dir / 'REPORT.md'} and results.json", flush=True)
+    regressions = [s for s in results["scenes"] if s["verdict"] == "regression"]
+    return 1 if args.fail_on_regression and regressions else 0
+
+
+# ---------------------------------------------------------------- report
+
+def _fmt(value, spec, missing="n/a"):
+    return missing if value is None else format(value, spec)
+
+
+def report_markdown(results):
+    lines = [
+        "# RISE A/B performance report", "",
+        f"- Baseline: `{results['baseline']}`",
+        f"- Candidate: `{results['candidate']}`",
+        f"- Protocol: {results['warmup']} warm-up render(s) per arm, then K={results['trials']} "
+        "interleaved trials; metric is the RISE_PERF rasterize time",
+        f"- Significance: Welch's t-test, two-sided, alpha {results['alpha']}", "",
+        "## Timing", "",
+        "| Scene | Baseline (ms) ± σ | Candidate (ms) ± σ | Δ% | p | Trials | Verdict |",
+        "|---|---|---|---|---|---|---|",
+    ]
+    for s in results["scenes"]:
+        lines.append(
+            f"| `{Path(s['scene']).stem}` | {s['baselineMeanMs']:.1f} ± {s['baselineStddevMs']:.1f} "
+            f"| {s['candidateMeanMs']:.1f} ± {s['candidateStddevMs']:.1f} "
+            f"| {_fmt(s['deltaPercent'], '+.2f')}% | {_fmt(s['pValue'], '.3g')} "
+            f"| {s['trialOverlap']} | **{s['verdict']}** |")
+    agg = results["aggregate"]
+    lines += ["", f"**Aggregate** (sum of means): baseline {agg['baselineSumOfMeansMs'] / 1000.0:.2f} s, "
+              f"candidate {agg['candidateSumOfMeansMs'] / 1000.0:.2f} s, "
+              f"Δ = {_fmt(agg['deltaPercent'], '+.2f')}%", "",
+              "## Correctness", "",
+              "Cross RMSE is baseline trial 1 vs candidate trial 1; the noise floor is candidate "
+              "trial 1 vs candidate trial 2 (8-bit units).", "",
+              "| Scene | Image | Noise floor RMSE | Cross RMSE | Ratio | Verdict |",
+              "|---|---|---|---|---|---|"]
+    for s in results["scenes"]:
+        images = s["images"]
+        if images["status"] != "ok":
+            lines.append(f"| `{Path(s['scene']).stem}` | | | | | {images['status']} |")
+            continue
+        for row in images["images"]:
+            lines.append(f"| `{Path(s['scene']).stem}` | `{row['image']}` "
+                         f"| {_fmt(row.get('noiseFloorRmse'), '.3f')} | {_fmt(row.get('crossRmse'), '.3f')} "
+                         f"| {_fmt(row.get('ratio'), '.2f')} | {row['status']} |")
+    return "\n".join(lines) + "\n"
+
+
+# ---------------------------------------------------------------- self-test
+
+def self_test():
+    def png_chunk(kind, payload):
+        return (struct.pack(">I", len(payload)) + kind + payload +
+                struct.pack(">I", zlib.crc32(kind + payload) & 0xffffffff))
+
+    def make_png(width, height, rows, filters):
+        ihdr = struct.pack(">IIBBBBB", width, height, 8, 2, 0, 0, 0)
+        raw = b""
+        prev = bytes(width * 3)
+        for row, kind in zip(rows, filters):
+            enc = bytearray(row)
+            if kind == 1:
+                enc = bytearray((row[i] - (row[i - 3] if i >= 3 else 0)) & 0xff for i in range(len(row)))
+            elif kind == 2:
+                enc = bytearray((row[i] - prev[i]) & 0xff for i in range(len(row)))
+            elif kind == 4:
+                enc = bytearray((row[i] - _paeth(row[i - 3] if i >= 3 else 0, prev[i],
+                                                 prev[i - 3] if i >= 3 else 0)) & 0xff
+                                for i in range(len(row)))
+            raw += bytes([kind]) + bytes(enc)
+            prev = row
+        return (PNG_SIGNATURE + png_chunk(b"IHDR", ihdr) + png_chunk(b"IDAT", zlib.compress(raw)) +
+                png_chunk(b"IEND", b""))
+
+    rows = [bytes((x * 40 + y * 7 + c) & 0xff for x in range(4) for c in range(3)) for y in range(4)]
+    w, h, c, samples = decode_png(make_png(4, 4, rows, [0, 1, 2, 4]))
+    assert (w, h, c) == (4, 4, 3) and bytes(samples) == b"".join(rows), "PNG filters"
+
+    with tempfile.TemporaryDirectory() as tmp:
+        a, b = Path(tmp) / "a.png", Path(tmp) / "b.png"
+        a.write_bytes(make_png(4, 4, rows, [0, 0, 0, 0]))
+        shifted = [bytes((v + 2) & 0xff for v in row) for row in rows]
+        b.write_bytes(make_png(4, 4, shifted, [0, 0, 0, 0]))
+        assert image_rmse(a, a) == 0.0
+        assert abs(image_rmse(a, b) - 2.0) < 1e-9, "RMSE"
+
+    assert parse_render_ms('x RISE_PERF {"phase":"rasterize","ms":1234}\n') == 1234
+    assert parse_render_ms("Total Rasterization Time: 1 minutes 2 seconds 5 ms\n") == 62005
+    assert parse_render_ms("Total Rasterization Time: 7 seconds \n") == 7000
+    assert parse_render_ms("nothing here") is None
+
+    # Student-t CDF against tabulated two-sided critical values
+    for dof, t_crit in ((4, 2.776), (8, 2.306), (30, 2.042)):
+        p = incomplete_beta(dof / 2.0, 0.5, dof / (dof + t_crit * t_crit))
+        assert abs(p - 0.05) < 5e-4, f"t distribution dof {dof}: {p}"
+    cmp = compare_timings([100, 102, 98, 101, 99], [120, 121, 119, 122, 118], 0.05)
+    assert cmp["verdict"] == "regression" and cmp["trialOverlap"] == "candidate slower in every trial"
+    cmp = compare_timings([100, 110, 90, 105, 95], [101, 109, 91, 104, 96], 0.05)
+    assert cmp["verdict"] == "no significant change"
+    assert trial_order(3) == [("baseline", "candidate"), ("candidate", "baseline"),
+                              ("baseline", "candidate")]
+    print("perf_ab self-test: PASS")
+    return 0
+
+
+def parse_args(argv):
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--baseline", help="RISE binary for the A arm")
+    parser.add_argument("--candidate", help="RISE binary for the B arm")
+    parser.add_argument("--scenes", nargs="*", default=[],
+                        help=f"scene files or globs, relative to --repo-root (default {DEFAULT_SCENES})")
+    parser.add_argument("-k", "--trials", type=int, default=5)
+    parser.add_argument("--warmup", type=int, default=1)
+    parser.add_argument("--alpha", type=float, default=0.05)
+    parser.add_argument("--timeout", type=int, default=3600, help="seconds per render")
+    parser.add_argument("--repo-root", default=".")
+    parser.add_argument("--output-dir", default="")
+    parser.add_argument("--keep-renders", action="store_true")
+    parser.add_argument("--fail-on-regression", action="store_true",
+                        help="exit 1 if any scene is a significant regression")
+    parser.add_argument("--self-test", action="store_true")
+    args = parser.parse_args(argv)
+    if not args.self_test:
+        if not args.baseline or not args.candidate:
+            parser.error("--baseline and --candidate are required")
+        if args.trials < 2:
+            parser.error("--trials must be at least 2 (two images per arm set the noise floor)")
+        if args.warmup < 0:
+            parser.error("--warmup must be non-negative")
+        if not 0.0 < args.alpha < 1.0:
+            parser.error("--alpha must be in (0,1)")
+    return args
+
+
+if __name__ == "__main__":
+    parsed_args = parse_args(sys.argv[1:])
+    try:
+        raise SystemExit(self_test() if parsed_args.self_test else run(parsed_args))
+    except (ValueError, RuntimeError, OSError, json.JSONDecodeError,
+            subprocess.TimeoutExpired) as exc:
+        print(f"perf_ab: ERROR: {exc}", file=sys.stderr)
+        raise SystemExit(2)